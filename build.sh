@@ -41,6 +41,7 @@ Please select a build target:
   -t= | --target=[RESONANCE_AUDIO_API|         # Resonance Audio API C/C++ library
                   RESONANCE_AUDIO_CLI|         # Resonance Audio CLI
                   RESONANCE_AUDIO_TESTS|       # Resonance Audio unit tests
+                  RESONANCE_AUDIO_BENCHMARKS|  # Resonance Audio benchmarks
                   GEOMETRICAL_ACOUSTICS_TESTS| # Geometrical Acoustics unit tests
                   UNITY_PLUGIN|                # Resonance Audio Unity plugin
                   WWISE_AUTHORING_PLUGIN|      # Resonance Audio Wwise authoring plugin
@@ -145,7 +146,7 @@ case "$(uname -s)" in
 esac
 
 INSTALL_TARGET="install"
-if echo "${BUILD_TARGET}" | grep -q "TESTS"; then
+if echo "${BUILD_TARGET}" | grep -q "TESTS\|BENCHMARKS"; then
   INSTALL_TARGET=""
 fi
 
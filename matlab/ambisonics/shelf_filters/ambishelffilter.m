@@ -21,7 +21,7 @@ function [ soundfieldOutput ] = ambishelffilter(soundfieldInput, sampleRate)
 %   correction weightings to the high-passed portion of the spectrum.
 %   Since the filters operate 'per-order', it is agnostic to the channel
 %   sequence convention used. Expected normalization is SN3D. At the
-%   moment it supports 1st to 5th Order Ambisonics, however it is easily
+%   moment it supports 1st to 7th Order Ambisonics, however it is easily
 %   extensible to even higher orders by simply providing required
 %   cross-over frequencies and MaxRe values.
 %
@@ -44,20 +44,21 @@ if nargin < 2
 end
 
 % Maximum supported order.
-MAX_SUPPORTED_ORDER = 5;
+MAX_SUPPORTED_ORDER = 7;
 
-% Filter cross-over frequencies defined for 1st - 5th order sound fields.
+% Filter cross-over frequencies defined for 1st - 7th order sound fields.
+% The 6th and 7th order values continue the spacing of the lower orders.
 % Can be modified if different values are required.
 % Extending support to orders beyond MAX_SUPPORTED_ORDER consists in
 % supplying additional cross-over values to this vector.
-CROSSOVER_FREQUENCIES = [690, 1250, 1831, 2423, 3022];
+CROSSOVER_FREQUENCIES = [690, 1250, 1831, 2423, 3022, 3621, 4220];
 
 % MaxRe (energy optimization) values, equivalent to the highest roots of
 % the associated Legendre polynomials of degree n + 1. These values can be
 % found in the following table: http://goo.gl/4PXhVj. Extending support to
 % Ambisonic orders beyond MAX_SUPPORTED_ORDER consists in supplying
 % additional MaxRe values to this vector.
-MAX_RE_VALUES = [0.5774, 0.7746, 0.8611, 0.9062, 0.9325];
+MAX_RE_VALUES = [0.5774, 0.7746, 0.8611, 0.9062, 0.9325, 0.9491, 0.9603];
 
 % Determine the Ambisonic order from the number of channels.
 numInputChannels = size(soundfieldInput, 2);
@@ -32,7 +32,7 @@ function [] = loadsadie(ambisonicOrder)
 %          'ambisonicOrder'.
 %
 %   input:
-%   ambisonicOrder - Ambisonic order (max supported order is 5).
+%   ambisonicOrder - Ambisonic order (max supported order is 7).
 %
 
 % Target sampling rate.
@@ -58,6 +58,9 @@ switch ambisonicOrder
     case 5 % Vertices of a Pentakis Icosidodecahedron (42)
         load('symmetric_pentakis_icosidodecahedron.mat');
         savedir = 'sadie_subject_002_symmetric_pentakis_icosidodecahedron';
+    case {6, 7} % Rings of the regular SADIE grid (114)
+        load('symmetric_ring_grid.mat');
+        savedir = 'sadie_subject_002_symmetric_ring_grid';
     otherwise
         error('Unsupported Ambisonic order');
 end
@@ -41,6 +41,8 @@ switch ambisonicOrder
         hrirDir = 'sadie_subject_002_symmetric_pentakis_dodecahedron';
     case 5
         hrirDir = 'sadie_subject_002_symmetric_pentakis_icosidodecahedron';
+    case {6, 7}
+        hrirDir = 'sadie_subject_002_symmetric_ring_grid';
     otherwise
         error('Unsupported Ambisonic order');
 end
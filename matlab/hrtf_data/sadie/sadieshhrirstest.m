@@ -28,7 +28,7 @@ INPUT = [1; zeros(255, 1)];
 SOURCE_AZIMUTH_RAD = pi / 3;
 SOURCE_ELEVATION_RAD =  pi / 4;
 
-for ambisonicOrder = 1:5
+for ambisonicOrder = [1:5, 7]
 
     % Paths to directories containing standard symmetric SADIE HRIRs.
     switch ambisonicOrder
@@ -43,6 +43,8 @@ for ambisonicOrder = 1:5
         case 5
             hrirDir = ...
                 'sadie_subject_002_symmetric_pentakis_icosidodecahedron';
+        case {6, 7}
+            hrirDir = 'sadie_subject_002_symmetric_ring_grid';
         otherwise
             error('Unsupported Ambisonic order');
     end
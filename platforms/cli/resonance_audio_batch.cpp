@@ -0,0 +1,363 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <boost/program_options.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <api/offline_renderer.h>
+#include <platforms/common/room_effects_utils.h>
+#include <platforms/common/room_properties.h>
+#include <utils/sample_type_conversion.h>
+#include <utils/wav_reader.h>
+
+#include "wav_writer.hpp"
+
+// Renders a manifest of jobs in parallel. Each job renders any number of
+// sources with optional trajectories in an optional shoebox room into one
+// binaural stereo WAV file. The manifest is a JSON file of the form:
+//
+// {
+//   "jobs": [
+//     {
+//       "output": "out.wav",
+//       "tail_seconds": 1.5,
+//       "room": {
+//         "dimensions": [4, 3, 5],
+//         "materials": [2, 2, 16, 16, 22, 22]
+//       },
+//       "head": { "position": [0, 0, 0], "rotation": [0, 0, 0, 1] },
+//       "sources": [
+//         {
+//           "input": "voice.wav",
+//           "start_seconds": 0.5,
+//           "volume": 1.0,
+//           "rendering_mode": "binaural_high",
+//           "position": [0, 0, -1],
+//           "trajectory": [
+//             { "time": 0.0, "position": [-2, 0, -1] },
+//             { "time": 4.0, "position": [2, 0, -1] }
+//           ]
+//         }
+//       ]
+//     }
+//   ]
+// }
+//
+// "head" and "room" are optional. Each entry of "trajectory" holds a "time" in
+// seconds and a "position" and/or "volume" keyframe. "rotation" quaternions are
+// given as x y z w. The output is streamed to disk while rendering.
+
+namespace po = boost::program_options;
+namespace pt = boost::property_tree;
+
+// Number of frames rendered and written per chunk.
+constexpr size_t kNumFramesPerChunk = 16384;
+
+// Renderers of a worker, keyed by sample rate and maximum Ambisonic order.
+// Reusing a renderer across jobs avoids the setup cost of its graph.
+using RendererCache =
+    std::map<std::pair<int, int>, std::unique_ptr<vraudio::OfflineRenderer>>;
+
+struct JobResult {
+  bool success = false;
+  std::string error;
+  double audio_seconds = 0.0;
+  double wall_seconds = 0.0;
+};
+
+std::vector<float> read_float_array(const pt::ptree& node, size_t size) {
+  std::vector<float> values;
+  for (const auto& child : node) {
+    values.push_back(child.second.get_value<float>());
+  }
+  if (values.size() != size) {
+    throw std::runtime_error("expected array of " + std::to_string(size) +
+                             " values");
+  }
+  return values;
+}
+
+vraudio::RenderingMode read_rendering_mode(const std::string& name) {
+  if (name == "stereo_panning") return vraudio::kStereoPanning;
+  if (name == "binaural_low") return vraudio::kBinauralLowQuality;
+  if (name == "binaural_medium") return vraudio::kBinauralMediumQuality;
+  if (name == "binaural_high") return vraudio::kBinauralHighQuality;
+  if (name == "binaural_very_high") return vraudio::kBinauralVeryHighQuality;
+  if (name == "binaural_ultra_high") return vraudio::kBinauralUltraHighQuality;
+  if (name == "room_effects_only") return vraudio::kRoomEffectsOnly;
+  throw std::runtime_error("unknown rendering mode: " + name);
+}
+
+// Returns the Ambisonic order needed to render |mode| at full quality.
+int get_max_ambisonic_order(vraudio::RenderingMode mode) {
+  if (mode == vraudio::kBinauralUltraHighQuality) return 7;
+  if (mode == vraudio::kBinauralVeryHighQuality) return 5;
+  return vraudio::ResonanceAudioApiOptions().max_ambisonic_order;
+}
+
+void configure_room(const pt::ptree& room, vraudio::ResonanceAudioApi* api) {
+  vraudio::RoomProperties room_properties;
+  const std::vector<float> dimensions =
+      read_float_array(room.get_child("dimensions"), 3);
+  std::copy(dimensions.begin(), dimensions.end(), room_properties.dimensions);
+  size_t wall = 0;
+  for (const auto& child : room.get_child("materials")) {
+    const int material = child.second.get_value<int>();
+    if (wall >= 6 or material < 0 or material >= vraudio::kNumMaterialNames) {
+      throw std::runtime_error("need 6 materials between 0 and " +
+                               std::to_string(vraudio::kNumMaterialNames));
+    }
+    room_properties.material_names[wall++] =
+        static_cast<vraudio::MaterialName>(material);
+  }
+  if (wall != 6) throw std::runtime_error("need 6 materials");
+  api->SetReverbProperties(vraudio::ComputeReverbProperties(room_properties));
+  api->SetReflectionProperties(
+      vraudio::ComputeReflectionProperties(room_properties));
+}
+
+// Returns a renderer of |cache| for the given format, which is reset if it was
+// used by a previous job, or creates it.
+vraudio::OfflineRenderer* get_renderer(
+    int sample_rate_hz, size_t frames_per_block,
+    const vraudio::ResonanceAudioApiOptions& options, RendererCache* cache) {
+  std::unique_ptr<vraudio::OfflineRenderer>& renderer =
+      (*cache)[std::make_pair(sample_rate_hz, options.max_ambisonic_order)];
+  if (renderer != nullptr) {
+    renderer->Reset();
+  } else {
+    renderer.reset(vraudio::OfflineRenderer::Create(
+        vraudio::kNumStereoChannels, frames_per_block, sample_rate_hz,
+        options));
+  }
+  return renderer.get();
+}
+
+JobResult render_job(const pt::ptree& job, size_t frames_per_block,
+                     RendererCache* renderers) {
+  JobResult result;
+  const auto start_time = std::chrono::steady_clock::now();
+  try {
+    const std::string output_path = job.get<std::string>("output");
+
+    // Load all inputs, which determine the sample rate of the job.
+    struct Source {
+      std::vector<float> audio;
+      size_t num_channels;
+      vraudio::RenderingMode rendering_mode;
+      const pt::ptree* config;
+    };
+    std::vector<Source> sources;
+    int sample_rate_hz = 0;
+    // Only jobs with higher order sources pay for a higher order graph.
+    vraudio::ResonanceAudioApiOptions options;
+    for (const auto& child : job.get_child("sources")) {
+      const std::string input_path = child.second.get<std::string>("input");
+      std::ifstream input_stream(input_path, std::ios::binary);
+      vraudio::WavReader wav(&input_stream);
+      if (not wav.IsHeaderValid()) {
+        throw std::runtime_error("cannot read " + input_path);
+      }
+      if (sample_rate_hz == 0) {
+        sample_rate_hz = wav.GetSampleRateHz();
+      } else if (sample_rate_hz != wav.GetSampleRateHz()) {
+        throw std::runtime_error("sample rate mismatch in " + input_path);
+      }
+      Source source;
+      source.num_channels = wav.GetNumChannels();
+      source.rendering_mode = read_rendering_mode(
+          child.second.get<std::string>("rendering_mode", "binaural_high"));
+      options.max_ambisonic_order =
+          std::max(options.max_ambisonic_order,
+                   get_max_ambisonic_order(source.rendering_mode));
+      source.config = &child.second;
+      source.audio.resize(wav.GetNumTotalSamples());
+      source.audio.resize(
+          wav.ReadSamples(source.audio.size(), source.audio.data()));
+      sources.push_back(std::move(source));
+    }
+    if (sources.empty()) throw std::runtime_error("job has no sources");
+
+    vraudio::OfflineRenderer* const renderer =
+        get_renderer(sample_rate_hz, frames_per_block, options, renderers);
+    if (renderer == nullptr) throw std::runtime_error("cannot create renderer");
+    vraudio::ResonanceAudioApi* api = renderer->GetApi();
+    const auto seconds_to_frames = [sample_rate_hz](double seconds) {
+      return static_cast<size_t>(std::max(0.0, seconds) * sample_rate_hz);
+    };
+
+    if (const auto room = job.get_child_optional("room")) {
+      configure_room(*room, api);
+    } else {
+      api->EnableRoomEffects(false);
+    }
+    if (const auto head = job.get_child_optional("head")) {
+      if (const auto position = head->get_child_optional("position")) {
+        const std::vector<float> p = read_float_array(*position, 3);
+        api->SetHeadPosition(p[0], p[1], p[2]);
+      }
+      if (const auto rotation = head->get_child_optional("rotation")) {
+        const std::vector<float> q = read_float_array(*rotation, 4);
+        api->SetHeadRotation(q[0], q[1], q[2], q[3]);
+      }
+    }
+
+    for (const Source& source : sources) {
+      const pt::ptree& config = *source.config;
+      const size_t num_frames = source.audio.size() / source.num_channels;
+      const size_t start_frame =
+          seconds_to_frames(config.get<double>("start_seconds", 0.0));
+      const vraudio::ResonanceAudioApi::SourceId id =
+          renderer->AddSoundObjectSource(
+              source.audio.data(), source.num_channels, num_frames,
+              start_frame, source.rendering_mode);
+      if (id == vraudio::ResonanceAudioApi::kInvalidSourceId) {
+        throw std::runtime_error("cannot create source");
+      }
+      api->SetSourceVolume(id, config.get<float>("volume", 1.0f));
+      if (const auto position = config.get_child_optional("position")) {
+        const std::vector<float> p = read_float_array(*position, 3);
+        api->SetSourcePosition(id, p[0], p[1], p[2]);
+      }
+      if (const auto trajectory = config.get_child_optional("trajectory")) {
+        for (const auto& keyframe : *trajectory) {
+          const size_t frame =
+              seconds_to_frames(keyframe.second.get<double>("time"));
+          if (const auto p = keyframe.second.get_child_optional("position")) {
+            const std::vector<float> xyz = read_float_array(*p, 3);
+            renderer->AddSourcePositionKeyframe(id, frame, xyz[0], xyz[1],
+                                                xyz[2]);
+          }
+          if (const auto v = keyframe.second.get_optional<float>("volume")) {
+            renderer->AddSourceVolumeKeyframe(id, frame, *v);
+          }
+        }
+      }
+    }
+
+    // Render and stream the output to disk chunk by chunk.
+    const size_t num_output_frames =
+        renderer->GetNumTimelineFrames() +
+        seconds_to_frames(job.get<double>("tail_seconds", 0.0));
+    WavWriter writer(output_path, vraudio::kNumStereoChannels, sample_rate_hz);
+    if (not writer.good()) {
+      throw std::runtime_error("cannot write " + output_path);
+    }
+    std::vector<float> float_chunk(vraudio::kNumStereoChannels *
+                                   kNumFramesPerChunk);
+    std::vector<int16_t> int16_chunk(float_chunk.size());
+    while (renderer->GetNumRenderedFrames() < num_output_frames) {
+      const size_t num_frames =
+          std::min(kNumFramesPerChunk,
+                   num_output_frames - renderer->GetNumRenderedFrames());
+      if (not renderer->RenderInterleaved(vraudio::kNumStereoChannels,
+                                          num_frames, float_chunk.data())) {
+        throw std::runtime_error("render failed");
+      }
+      vraudio::ConvertPlanarSamples(num_frames * vraudio::kNumStereoChannels,
+                                    float_chunk.data(), int16_chunk.data());
+      writer.write(int16_chunk.data(), num_frames);
+    }
+    writer.close();
+
+    result.audio_seconds =
+        static_cast<double>(num_output_frames) / sample_rate_hz;
+    result.success = true;
+  } catch (const std::exception& e) {
+    result.error = e.what();
+  }
+  result.wall_seconds = std::chrono::duration<double>(
+                            std::chrono::steady_clock::now() - start_time)
+                            .count();
+  return result;
+}
+
+int main(int argc, char const* argv[]) {
+  std::string manifest_path;
+  size_t num_workers = std::max(1u, std::thread::hardware_concurrency());
+  size_t frames_per_block = vraudio::OfflineRenderer::kDefaultFramesPerBlock;
+
+  po::options_description desc("Usage");
+  // clang-format off
+  desc.add_options()
+      ("help,h", "produce help message")
+      ("manifest,m", po::value<std::string>(&manifest_path)->required(), "json manifest of render jobs")
+      ("jobs,j", po::value<size_t>(&num_workers), "number of concurrent jobs (default: number of cores)")
+      ("block-size,b", po::value<size_t>(&frames_per_block), "frames per internal processing block")
+      ;
+  // clang-format on
+
+  po::variables_map vm;
+  po::store(po::parse_command_line(argc, argv, desc), vm);
+  if (vm.count("help")) {
+    std::cout << desc << std::endl;
+    return 1;
+  }
+  po::notify(vm);
+
+  pt::ptree manifest;
+  try {
+    pt::read_json(manifest_path, manifest);
+  } catch (const pt::json_parser_error& e) {
+    std::cerr << "Cannot parse manifest: " << e.what() << std::endl;
+    return 1;
+  }
+  std::vector<const pt::ptree*> jobs;
+  for (const auto& child : manifest.get_child("jobs", pt::ptree())) {
+    jobs.push_back(&child.second);
+  }
+  num_workers = std::max<size_t>(1, std::min(num_workers, jobs.size()));
+  std::cout << "Rendering " << jobs.size() << " jobs on " << num_workers
+            << " workers" << std::endl;
+
+  // Workers pull the next job index until all jobs are taken.
+  std::atomic<size_t> next_job(0);
+  std::atomic<size_t> num_failed_jobs(0);
+  std::mutex output_mutex;
+  const auto worker = [&]() {
+    RendererCache renderers;
+    for (size_t i = next_job++; i < jobs.size(); i = next_job++) {
+      const JobResult result =
+          render_job(*jobs[i], frames_per_block, &renderers);
+      const std::string output_path =
+          jobs[i]->get<std::string>("output", "<no output>");
+      std::lock_guard<std::mutex> lock(output_mutex);
+      if (result.success) {
+        std::cout << "[" << i + 1 << "/" << jobs.size() << "] " << output_path
+                  << ": " << std::fixed << std::setprecision(2)
+                  << result.audio_seconds << " s audio in "
+                  << result.wall_seconds << " s, real-time factor "
+                  << result.audio_seconds / result.wall_seconds << std::endl;
+      } else {
+        ++num_failed_jobs;
+        std::cerr << "[" << i + 1 << "/" << jobs.size() << "] " << output_path
+                  << ": failed: " << result.error << std::endl;
+      }
+    }
+  };
+  const auto start_time = std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+  for (size_t i = 0; i < num_workers; ++i) workers.emplace_back(worker);
+  for (auto& thread : workers) thread.join();
+  const double wall_seconds = std::chrono::duration<double>(
+                                  std::chrono::steady_clock::now() - start_time)
+                                  .count();
+
+  std::cout << "Rendered " << jobs.size() - num_failed_jobs << " of "
+            << jobs.size() << " jobs in " << std::fixed
+            << std::setprecision(2) << wall_seconds << " s" << std::endl;
+  return num_failed_jobs == 0 ? 0 : 1;
+}
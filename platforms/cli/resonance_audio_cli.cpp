@@ -1,68 +1,25 @@
+#include <algorithm>
+#include <array>
 #include <fstream>
 #include <iostream>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <boost/program_options.hpp>
 
 #include <api/resonance_audio_api.h>
 #include <platforms/common/room_effects_utils.h>
 #include <platforms/common/room_properties.h>
-#include <utils/wav.h>
+#include <utils/wav_reader.h>
+
+#include "wav_writer.hpp"
 
 namespace po = boost::program_options;
 
 constexpr size_t kNumFramesPerBuffer = 256;
 
-template <typename Word>
-std::ostream& little_endian_write(std::ostream& out_stream, const Word value,
-                                  const unsigned num_bytes) {
-  for (unsigned i = 0; i < num_bytes; ++i) {
-    out_stream.put(value >> (i * 8));
-  }
-  return out_stream;
-}
-
-void write_wav_file(const std::string& file_name,
-                    const std::vector<int16_t>& interleaved_samples,
-                    const uint16_t num_channels,
-                    const uint32_t sample_rate_hz) {
-  const unsigned bytes_per_sample = 2;
-  const uint32_t bytes_of_samples =
-      interleaved_samples.size() * bytes_per_sample;
-
-  std::ofstream f(file_name,
-                  std::ios::out | std::ios::trunc | std::ios::binary);
-  std::cout << "writing to: " << file_name << std::endl;
-  f.imbue(std::locale::classic());
-
-  // RIFF CHUNK
-  f.write("RIFF", 4);                                // Chunk ID
-  little_endian_write(f, 36 + bytes_of_samples, 4);  // Chunk Size
-  f.write("WAVE", 4);                                // WAVE ID
-  // fmt Chunk
-  f.write("fmt ", 4);             // Chunk ID
-  little_endian_write(f, 16, 4);  // Chunk size
-  little_endian_write(f, 1, 2);   // Wave format: PCM - integer samples
-  little_endian_write(f, num_channels, 2);    // Num channels
-  little_endian_write(f, sample_rate_hz, 4);  // Samples per second (Hz)
-  // Average Bytes per second
-  little_endian_write(f, sample_rate_hz * bytes_per_sample * num_channels, 4);
-  little_endian_write(f, bytes_per_sample * num_channels, 2);  // Block Align
-  little_endian_write(f, bytes_per_sample * 8, 2);  // Bits per sample
-
-  // data Chunk
-  f.write("data", 4);
-  little_endian_write(f, bytes_of_samples, 4);
-
-  // Write the audio samples
-  for (const int16_t& sample : interleaved_samples) {
-    little_endian_write(f, sample, 2);
-  }
-  f.close();
-}
-
 bool verify_material_names(std::vector<int>& material_names) {
   for (const auto& n : material_names) {
     if (n < 0 or n >= vraudio::kNumMaterialNames) return false;
@@ -128,22 +85,23 @@ int main(int argc, char const* argv[]) {
     return 1;
   }
 
-  // Load wav file
+  // Open wav file, which is decoded while rendering
   std::ifstream input_wav_stream(input_wav_path, std::ios::binary);
-  std::unique_ptr<const vraudio::Wav> wav =
-      vraudio::Wav::CreateOrNull(&input_wav_stream);
-  const size_t kNumInputFrames =
-      wav->interleaved_samples().size() / wav->GetNumChannels();
+  vraudio::WavReader wav(&input_wav_stream);
+  if (not wav.IsHeaderValid()) {
+    std::cout << "Cannot read " << input_wav_path << std::endl;
+    return 1;
+  }
 
   // Print wav file info
-  std::cout << "Channels: " << wav->GetNumChannels() << std::endl;
-  std::cout << "SampleRateHz: " << wav->GetSampleRateHz() << std::endl;
+  std::cout << "Channels: " << wav.GetNumChannels() << std::endl;
+  std::cout << "SampleRateHz: " << wav.GetSampleRateHz() << std::endl;
 
   // Initialize Resonance Audio
   std::unique_ptr<vraudio::ResonanceAudioApi> api(
       vraudio::CreateResonanceAudioApi(vraudio::kNumStereoChannels,
                                        kNumFramesPerBuffer,
-                                       wav->GetSampleRateHz()));
+                                       wav.GetSampleRateHz()));
   vraudio::RoomProperties room_properties;
   std::copy(dimensions.begin(), dimensions.end(), room_properties.dimensions);
   for (size_t i = 0; i < material_names.size(); ++i)
@@ -159,42 +117,38 @@ int main(int argc, char const* argv[]) {
   api->SetHeadPosition(position[0], position[1], position[2]);
 
   //// Render output sound
-  // Number of buffers needed (rounded up)
-  const size_t kNumBuffersToRender =
-      (kNumInputFrames + kNumFramesPerBuffer - 1) / kNumFramesPerBuffer;
-
-  // Render each buffer
-  std::vector<int16_t> input_buffer(wav->GetNumChannels() *
-                                    kNumFramesPerBuffer);
+  // Render each buffer and stream it to the output file
+  const size_t num_input_channels = wav.GetNumChannels();
+  std::vector<std::vector<float>> input_buffer(
+      num_input_channels, std::vector<float>(kNumFramesPerBuffer));
+  std::vector<float*> input_channels;
+  for (auto& channel : input_buffer) input_channels.push_back(channel.data());
   std::array<int16_t, vraudio::kNumStereoChannels * kNumFramesPerBuffer>
       output_buffer;
-  std::vector<int16_t> output_samples;
-  output_samples.reserve(vraudio::kNumStereoChannels * kNumBuffersToRender);
-  auto input_sample_start_it = wav->interleaved_samples().begin();
-  for (size_t i = 0; i < kNumBuffersToRender;
-       ++i, input_sample_start_it +=
-            (kNumFramesPerBuffer * wav->GetNumChannels())) {
-    // Fill input buffer
-    input_buffer.insert(
-        input_buffer.begin(), input_sample_start_it,
-        input_sample_start_it + kNumFramesPerBuffer * wav->GetNumChannels());
+  WavWriter writer(output_wav_path, vraudio::kNumStereoChannels,
+                   wav.GetSampleRateHz());
+  std::cout << "writing to: " << output_wav_path << std::endl;
+  for (size_t i = 0;; ++i) {
+    // Decode input buffer, zero padding the last buffer
+    const size_t num_frames =
+        wav.ReadPlanarFrames(kNumFramesPerBuffer, input_channels.data());
+    if (num_frames == 0) break;
+    for (auto& channel : input_buffer) {
+      std::fill(channel.begin() + num_frames, channel.end(), 0.0f);
+    }
 
     // Add input buffer
-    api->SetInterleavedBuffer(stereo_id, input_buffer.data(),
-                              wav->GetNumChannels(), kNumFramesPerBuffer);
+    api->SetPlanarBuffer(stereo_id, input_channels.data(), num_input_channels,
+                         kNumFramesPerBuffer);
 
     // Fill output buffer
     bool rendered = api->FillInterleavedOutputBuffer(
         vraudio::kNumStereoChannels, kNumFramesPerBuffer, output_buffer.data());
 
-    // Append output bugger to output samples
+    // Append output buffer to output file, removing extra frames from the
+    // last buffer
     if (not rendered) LOG() << "Render failed on frame: " << i;
-    output_samples.insert(output_samples.end(), output_buffer.begin(),
-                          output_buffer.end());
+    writer.write(output_buffer.data(), num_frames);
   }
-  // Remove extra frames from last buffer
-  output_samples.resize(kNumInputFrames * vraudio::kNumStereoChannels);
-
-  write_wav_file(output_wav_path, output_samples, vraudio::kNumStereoChannels,
-                 wav->GetSampleRateHz());
+  writer.close();
 }
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Streams interleaved 16-bit PCM samples into a WAV file. The header is written
+// with placeholder sizes up front and patched when the writer is closed, so
+// samples can be written as they are rendered without holding the whole output
+// in memory.
+class WavWriter {
+ public:
+  WavWriter(const std::string& file_name, uint16_t num_channels,
+            uint32_t sample_rate_hz)
+      : file_(file_name, std::ios::out | std::ios::trunc | std::ios::binary),
+        num_channels_(num_channels),
+        num_bytes_of_samples_(0) {
+    file_.imbue(std::locale::classic());
+    write_header(sample_rate_hz);
+  }
+
+  ~WavWriter() { close(); }
+
+  // Returns false if the file could not be opened or written.
+  bool good() const { return file_.good(); }
+
+  // Appends |num_frames| interleaved frames.
+  void write(const int16_t* interleaved_samples, size_t num_frames) {
+    const size_t num_samples = num_frames * num_channels_;
+    bytes_.resize(num_samples * kBytesPerSample);
+    for (size_t i = 0; i < num_samples; ++i) {
+      const uint16_t sample = static_cast<uint16_t>(interleaved_samples[i]);
+      bytes_[2 * i] = static_cast<char>(sample & 0xff);
+      bytes_[2 * i + 1] = static_cast<char>(sample >> 8);
+    }
+    file_.write(bytes_.data(), bytes_.size());
+    num_bytes_of_samples_ += static_cast<uint32_t>(bytes_.size());
+  }
+
+  // Patches the chunk sizes and closes the file.
+  void close() {
+    if (!file_.is_open()) return;
+    file_.seekp(kRiffChunkSizeOffset);
+    little_endian_write(36 + num_bytes_of_samples_, 4);
+    file_.seekp(kDataChunkSizeOffset);
+    little_endian_write(num_bytes_of_samples_, 4);
+    file_.close();
+  }
+
+ private:
+  static constexpr unsigned kBytesPerSample = 2;
+  static constexpr std::streamoff kRiffChunkSizeOffset = 4;
+  static constexpr std::streamoff kDataChunkSizeOffset = 40;
+
+  template <typename Word>
+  void little_endian_write(const Word value, const unsigned num_bytes) {
+    for (unsigned i = 0; i < num_bytes; ++i) {
+      file_.put(static_cast<char>(value >> (i * 8)));
+    }
+  }
+
+  void write_header(uint32_t sample_rate_hz) {
+    // RIFF CHUNK
+    file_.write("RIFF", 4);                // Chunk ID
+    little_endian_write(uint32_t(36), 4);  // Chunk Size, patched in close()
+    file_.write("WAVE", 4);                // WAVE ID
+    // fmt Chunk
+    file_.write("fmt ", 4);                  // Chunk ID
+    little_endian_write(uint32_t(16), 4);    // Chunk size
+    little_endian_write(uint16_t(1), 2);     // Wave format: PCM
+    little_endian_write(num_channels_, 2);   // Num channels
+    little_endian_write(sample_rate_hz, 4);  // Samples per second (Hz)
+    // Average Bytes per second
+    little_endian_write(sample_rate_hz * kBytesPerSample * num_channels_, 4);
+    little_endian_write(uint16_t(kBytesPerSample * num_channels_),
+                        2);                                   // Block Align
+    little_endian_write(uint16_t(kBytesPerSample * 8), 2);  // Bits per sample
+    // data Chunk
+    file_.write("data", 4);
+    little_endian_write(uint32_t(0), 4);  // Chunk size, patched in close()
+  }
+
+  std::ofstream file_;
+  const uint16_t num_channels_;
+  uint32_t num_bytes_of_samples_;
+  // Little-endian byte buffer of the samples passed to write().
+  std::vector<char> bytes_;
+};
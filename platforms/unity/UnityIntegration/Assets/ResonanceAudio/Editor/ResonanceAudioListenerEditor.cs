@@ -105,7 +105,7 @@ public class ResonanceAudioListenerEditor : Editor {
         ++EditorGUI.indentLevel;
         Repaint();
       } else if (GUILayout.Button("Record")) {
-        listener.StartSoundfieldRecorder();
+        StartRecording();
       }
       EditorGUILayout.EndVertical();
       EditorGUILayout.EndHorizontal();
@@ -121,16 +121,25 @@ public class ResonanceAudioListenerEditor : Editor {
   }
   /// @endcond
 
-  // Stops soundfield recording.
-  private void StopRecording() {
-    // Save recorded soundfield clips into a temporary folder.
+  // Starts soundfield recording.
+  private void StartRecording() {
+    // Record soundfield clips into a temporary folder.
     string tempFolderPath = FileUtil.GetUniqueTempPathInProject();
     if (!Directory.Exists(tempFolderPath)) {
       Directory.CreateDirectory(tempFolderPath);
     }
     string tempFileName = Path.ChangeExtension(listener.name, "ogg");
-    string tempFilePath = Path.Combine(tempFolderPath, tempFileName);
-    listener.StopSoundfieldRecorder(tempFilePath);
+    listener.StartSoundfieldRecorder(Path.Combine(tempFolderPath, tempFileName));
+    if (!listener.IsRecording && Directory.Exists(tempFolderPath)) {
+      Directory.Delete(tempFolderPath, true);
+    }
+  }
+
+  // Stops soundfield recording.
+  private void StopRecording() {
+    string tempFilePath = listener.RecordFilePath;
+    string tempFolderPath = Path.GetDirectoryName(tempFilePath);
+    listener.StopSoundfieldRecorder(false);
 
     // Copy the recorded file as an ambisonic audio clip into project assets.
     string relativeClipPath = EditorUtility.SaveFilePanelInProject("Save Soundfield", listener.name,
@@ -106,21 +106,24 @@ public static class ResonanceAudio {
     Marshal.DestroyStructure(roomPropertiesPtr, typeof(RoomProperties));
   }
 
-  /// Starts soundfield recording.
+  /// Starts soundfield recording into target file path.
   /// @note This should only be called from the main Unity thread.
-  public static bool StartRecording() {
+  /// @note The target file path and the seamless flag used to be passed when the recording
+  /// stopped. They are now passed here, as the recorded data is encoded while recording.
+  public static bool StartRecording(string filePath, bool seamless) {
 #if UNITY_EDITOR
-    return StartSoundfieldRecorder();
+    return StartSoundfieldRecorder(filePath, seamless);
 #else
     return false;
 #endif  // UNITY_EDITOR
   }
 
-  /// Stops soundfield recording and saves it into target file path.
+  /// Stops soundfield recording and finalizes the recorded file, or deletes it if |discard| is
+  /// true.
   /// @note This should only be called from the main Unity thread.
-  public static bool StopRecordingAndSaveToFile(string filePath, bool seamless) {
+  public static bool StopRecording(bool discard) {
 #if UNITY_EDITOR
-    return StopSoundfieldRecorderAndWriteToFile(filePath, seamless);
+    return StopSoundfieldRecorder(discard);
 #else
     return false;
 #endif  // UNITY_EDITOR
@@ -435,10 +438,10 @@ public static class ResonanceAudio {
 #if UNITY_EDITOR
   // Soundfield recorder handlers.
   [DllImport(pluginName)]
-  private static extern bool StartSoundfieldRecorder();
+  private static extern bool StartSoundfieldRecorder(string filePath, bool seamless);
 
   [DllImport(pluginName)]
-  private static extern bool StopSoundfieldRecorderAndWriteToFile(string filePath, bool seamless);
+  private static extern bool StopSoundfieldRecorder(bool discard);
 
   // Reverb computer handlers.
   [DllImport(pluginName)]
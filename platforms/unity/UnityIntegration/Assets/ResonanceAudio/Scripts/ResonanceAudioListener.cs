@@ -51,6 +51,9 @@ public class ResonanceAudioListener : MonoBehaviour {
   /// Is currently recording soundfield?
   public bool IsRecording { get; private set; }
 
+  /// Target file path of the soundfield recording in progress.
+  public string RecordFilePath { get; private set; }
+
 #pragma warning disable 0414  // private variable assigned but is never used.
   // Denotes whether the soundfield recorder foldout should be expanded.
   [SerializeField]
@@ -74,7 +77,7 @@ public class ResonanceAudioListener : MonoBehaviour {
   void OnDisable() {
     if (Application.isEditor && IsRecording) {
       // Force stop soundfield recorder.
-      StopSoundfieldRecorder(null);
+      StopSoundfieldRecorder(true);
       Debug.LogWarning("Soundfield recording is stopped.");
     }
   }
@@ -98,8 +101,8 @@ public class ResonanceAudioListener : MonoBehaviour {
     return 0.0;
   }
 
-  /// Starts soundfield recording.
-  public void StartSoundfieldRecorder() {
+  /// Starts soundfield recording, which is encoded into target file path while recording.
+  public void StartSoundfieldRecorder(string filePath) {
     if (!(Application.isEditor && !Application.isPlaying)) {
       Debug.LogError("Soundfield recording is only supported in Unity Editor \"Edit Mode\".");
       return;
@@ -116,7 +119,8 @@ public class ResonanceAudioListener : MonoBehaviour {
         recorderTaggedSources[i].PlayScheduled(recorderStartTime);
       }
     }
-    IsRecording = ResonanceAudio.StartRecording();
+    RecordFilePath = filePath;
+    IsRecording = ResonanceAudio.StartRecording(filePath, recorderSeamless);
     if (!IsRecording) {
       Debug.LogError("Failed to start soundfield recording.");
       IsRecording = false;
@@ -126,8 +130,9 @@ public class ResonanceAudioListener : MonoBehaviour {
     }
   }
 
-  /// Stops soundfield recording and saves the recorded data into target file path.
-  public void StopSoundfieldRecorder(string filePath) {
+  /// Stops soundfield recording and finalizes the recorded file, or deletes it if |discard| is
+  /// true.
+  public void StopSoundfieldRecorder(bool discard) {
     if (!(Application.isEditor && !Application.isPlaying)) {
       Debug.LogError("Soundfield recording is only supported in Unity Editor \"Edit Mode\".");
       return;
@@ -140,7 +145,7 @@ public class ResonanceAudioListener : MonoBehaviour {
 
     IsRecording = false;
     recorderStartTime = 0.0;
-    if (!ResonanceAudio.StopRecordingAndSaveToFile(filePath, recorderSeamless)) {
+    if (!ResonanceAudio.StopRecording(discard) && !discard) {
       Debug.LogError("Failed to save soundfield recording into file.");
     }
     for (int i = 0; i < recorderTaggedSources.Count; ++i) {
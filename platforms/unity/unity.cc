@@ -39,9 +39,10 @@ namespace {
 const size_t kNumOutputChannels = 2;
 
 #if !(defined(PLATFORM_ANDROID) || defined(PLATFORM_IOS))
-// Maximum number of buffers allowed to record a soundfield, which is set to ~5
-// minutes (depending on the sampling rate and the number of frames per buffer).
-const size_t kMaxNumRecordBuffers = 15000;
+// Maximum number of buffers pending to be encoded while recording a soundfield,
+// which is set to ~1.5 seconds (depending on the sampling rate and the number
+// of frames per buffer).
+const size_t kMaxNumRecordBuffers = 64;
 
 // Record compression quality.
 const float kRecordQuality = 1.0f;
@@ -119,20 +120,10 @@ void ProcessListener(size_t num_frames, float* output) {
     // Record output into soundfield.
     auto* const resonance_audio_api_impl =
         static_cast<ResonanceAudioApiImpl*>(resonance_audio_copy->api.get());
-    const auto* soundfield_buffer =
-        resonance_audio_api_impl->GetAmbisonicOutputBuffer();
-    std::unique_ptr<AudioBuffer> record_buffer(
-        new AudioBuffer(kNumFirstOrderAmbisonicChannels, num_frames));
-    if (soundfield_buffer != nullptr) {
-      for (size_t ch = 0; ch < kNumFirstOrderAmbisonicChannels; ++ch) {
-        (*record_buffer)[ch] = (*soundfield_buffer)[ch];
-      }
-    } else {
-      // No output received, fill the record buffer with zeros.
-      record_buffer->Clear();
-    }
+    // No output received if the soundfield buffer is nullptr, in which case
+    // silence is recorded.
     resonance_audio_copy->soundfield_recorder->AddInput(
-        std::move(record_buffer));
+        resonance_audio_api_impl->GetAmbisonicOutputBuffer());
   }
 #endif  // !(defined(PLATFORM_ANDROID) || defined(PLATFORM_IOS))
 }
@@ -297,7 +288,7 @@ void SetRoomProperties(RoomProperties* room_properties, float* rt60s) {
 }
 
 #if !(defined(PLATFORM_ANDROID) || defined(PLATFORM_IOS))
-bool StartSoundfieldRecorder() {
+bool StartSoundfieldRecorder(const char* file_path, bool seamless) {
   auto resonance_audio_copy = resonance_audio;
   if (resonance_audio_copy == nullptr) {
     return false;
@@ -306,13 +297,17 @@ bool StartSoundfieldRecorder() {
     LOG(ERROR) << "Another soundfield recording already in progress";
     return false;
   }
+  if (file_path == nullptr ||
+      !resonance_audio_copy->soundfield_recorder->Start(
+          file_path, kRecordQuality, seamless)) {
+    return false;
+  }
 
   resonance_audio_copy->is_recording_soundfield = true;
   return true;
 }
 
-bool StopSoundfieldRecorderAndWriteToFile(const char* file_path,
-                                          bool seamless) {
+bool StopSoundfieldRecorder(bool discard) {
   auto resonance_audio_copy = resonance_audio;
   if (resonance_audio_copy == nullptr) {
     return false;
@@ -323,13 +318,11 @@ bool StopSoundfieldRecorderAndWriteToFile(const char* file_path,
   }
 
   resonance_audio_copy->is_recording_soundfield = false;
-  if (file_path == nullptr) {
+  if (discard) {
     resonance_audio_copy->soundfield_recorder->Reset();
     return false;
   }
-  resonance_audio_copy->soundfield_recorder->WriteToFile(
-      file_path, kRecordQuality, seamless);
-  return true;
+  return resonance_audio_copy->soundfield_recorder->Stop();
 }
 #endif  // !(defined(PLATFORM_ANDROID) || defined(PLATFORM_IOS))
 
@@ -99,12 +99,23 @@ void EXPORT_API SetListenerStereoSpeakerMode(bool enable_stereo_speaker_mode);
 void EXPORT_API SetRoomProperties(RoomProperties* room_properties,
                                   float* rt60s);
 
-// Starts the soundfield recorder.
-bool EXPORT_API StartSoundfieldRecorder();
-
-// Stops the soundfield recorder and writes the recorded data into file.
-bool EXPORT_API StopSoundfieldRecorderAndWriteToFile(const char* file_path,
-                                                     bool seamless);
+// Soundfield recorder.
+//
+// Note that this API is not backwards compatible with previous plugin versions.
+// The recorded data is encoded while recording, hence the file path and the
+// seamless flag are passed to |StartSoundfieldRecorder| instead of the removed
+// |StopSoundfieldRecorderAndWriteToFile(file_path, seamless)|, which is
+// replaced by |StopSoundfieldRecorder(discard)|. Passing |discard| = true
+// replaces passing a nullptr |file_path|. Managed code importing the previous
+// entry points must be updated along with the plugin.
+
+// Starts the soundfield recorder, which encodes the recorded data into
+// |file_path| while recording.
+bool EXPORT_API StartSoundfieldRecorder(const char* file_path, bool seamless);
+
+// Stops the soundfield recorder and finalizes the recorded file, or deletes it
+// if |discard| is true.
+bool EXPORT_API StopSoundfieldRecorder(bool discard);
 
 }  // extern C
 
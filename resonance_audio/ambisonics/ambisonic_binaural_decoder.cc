@@ -18,6 +18,7 @@ limitations under the License.
 
 #include "ambisonics/utils.h"
 #include "base/constants_and_types.h"
+#include "base/simd_utils.h"
 
 
 namespace vraudio {
@@ -26,8 +27,13 @@ AmbisonicBinauralDecoder::AmbisonicBinauralDecoder(const AudioBuffer& sh_hrirs,
                                                    size_t frames_per_buffer,
                                                    FftManager* fft_manager)
     : fft_manager_(fft_manager),
+      frames_per_buffer_(frames_per_buffer),
       freq_input_(kNumMonoChannels, NextPowTwo(frames_per_buffer) * 2),
-      filtered_input_(kNumMonoChannels, frames_per_buffer) {
+      freq_accumulators_(kNumStereoChannels, NextPowTwo(frames_per_buffer) * 2),
+      filtered_time_domain_buffers_(2 * kNumStereoChannels,
+                                    NextPowTwo(frames_per_buffer) * 2),
+      buffer_selector_(0),
+      filtered_input_(kNumStereoChannels, frames_per_buffer) {
   CHECK(fft_manager_);
   CHECK_NE(frames_per_buffer, 0U);
   const size_t num_channels = sh_hrirs.num_channels();
@@ -40,6 +46,7 @@ AmbisonicBinauralDecoder::AmbisonicBinauralDecoder(const AudioBuffer& sh_hrirs,
         new PartitionedFftFilter(filter_size, frames_per_buffer, fft_manager_));
     sh_hrir_filters_[i]->SetTimeDomainKernel(sh_hrirs[i]);
   }
+  filtered_time_domain_buffers_.Clear();
 }
 
 void AmbisonicBinauralDecoder::Process(const AudioBuffer& input,
@@ -50,31 +57,49 @@ void AmbisonicBinauralDecoder::Process(const AudioBuffer& input,
   DCHECK_EQ(input.num_frames(), output->num_frames());
   DCHECK_EQ(input.num_channels(), sh_hrir_filters_.size());
 
-  output->Clear();
-
+  freq_accumulators_.Clear();
   AudioBuffer::Channel* freq_input_channel = &freq_input_[0];
-  AudioBuffer::Channel* filtered_input_channel = &filtered_input_[0];
-  AudioBuffer::Channel* output_channel_0 = &(*output)[0];
-  AudioBuffer::Channel* output_channel_1 = &(*output)[1];
+  AudioBuffer::Channel* symmetric_accumulator = &freq_accumulators_[0];
+  AudioBuffer::Channel* antisymmetric_accumulator = &freq_accumulators_[1];
   for (size_t channel = 0; channel < input.num_channels(); ++channel) {
     const int degree = GetPeriphonicAmbisonicDegreeForChannel(channel);
     fft_manager_->FreqFromTimeDomain(input[channel], freq_input_channel);
-    sh_hrir_filters_[channel]->Filter(*freq_input_channel);
-    sh_hrir_filters_[channel]->GetFilteredSignal(filtered_input_channel);
-    if (degree < 0) {
-      // Degree is negative: spherical harmonic is asymetric.
-      // So add contributions to the left channel and subtract from the right
-      // channel.
-      *output_channel_0 += *filtered_input_channel;
-      *output_channel_1 -= *filtered_input_channel;
+    // Spherical harmonics of negative degree are antisymmetric with respect to
+    // the sagittal plane, all others are symmetric.
+    sh_hrir_filters_[channel]->FilterAndAccumulate(
+        *freq_input_channel,
+        degree < 0 ? antisymmetric_accumulator : symmetric_accumulator);
+  }
 
+  buffer_selector_ = !buffer_selector_;
+  const size_t chunk_size = fft_manager_->GetFftSize() / 2;
+  for (size_t i = 0; i < kNumStereoChannels; ++i) {
+    AudioBuffer::Channel* curr_buffer =
+        &filtered_time_domain_buffers_[2 * i + buffer_selector_];
+    const AudioBuffer::Channel& prev_buffer =
+        filtered_time_domain_buffers_[2 * i + !buffer_selector_];
+    fft_manager_->TimeFromFreqDomain(freq_accumulators_[i], curr_buffer);
+    // Overlap add.
+    AudioBuffer::Channel* filtered_channel = &filtered_input_[i];
+    if (frames_per_buffer_ == chunk_size) {
+      AddPointwise(chunk_size, &(*curr_buffer)[0], &prev_buffer[chunk_size],
+                   &(*filtered_channel)[0]);
     } else {
-      // Degree is zero or positive: spherical harmonic is symetric.
-      // So add contributions to both left and right channels.
-      *output_channel_0 += *filtered_input_channel;
-      *output_channel_1 += *filtered_input_channel;
+      for (size_t frame = 0; frame < frames_per_buffer_; ++frame) {
+        (*filtered_channel)[frame] =
+            (*curr_buffer)[frame] + prev_buffer[frame + frames_per_buffer_];
+      }
     }
   }
+
+  // The antisymmetric contributions are added to the left channel and
+  // subtracted from the right channel.
+  const AudioBuffer::Channel& symmetric_output = filtered_input_[0];
+  const AudioBuffer::Channel& antisymmetric_output = filtered_input_[1];
+  AddPointwise(frames_per_buffer_, &symmetric_output[0],
+               &antisymmetric_output[0], &(*output)[0][0]);
+  SubtractPointwise(frames_per_buffer_, &antisymmetric_output[0],
+                    &symmetric_output[0], &(*output)[1][0]);
 }
 
 }  // namespace vraudio
@@ -55,14 +55,32 @@ class AmbisonicBinauralDecoder {
   // Manager for all FFT related functionality (not owned).
   FftManager* const fft_manager_;
 
+  // Number of frames in each input/output buffer.
+  const size_t frames_per_buffer_;
+
   // Spherical Harmonic HRIR filter kernels.
   std::vector<std::unique_ptr<PartitionedFftFilter>> sh_hrir_filters_;
 
   // Frequency domain representation of the input signal.
   PartitionedFftFilter::FreqDomainBuffer freq_input_;
 
-  // Temporary audio buffer to store the convolution output for asymmetric or
-  // symmetric spherical harmonic HRIR.
+  // Frequency domain sums of the filtered symmetric (first channel) and
+  // antisymmetric (second channel) spherical harmonic channels. Summing before
+  // the inverse FFT reduces the number of inverse FFTs per buffer from the
+  // number of input channels to two.
+  PartitionedFftFilter::FreqDomainBuffer freq_accumulators_;
+
+  // Time domain outputs of |freq_accumulators_| for the current and previous
+  // buffer, used to perform the overlap add. Channels |2 * i| and |2 * i + 1|
+  // belong to the |i|th accumulator.
+  AudioBuffer filtered_time_domain_buffers_;
+
+  // Selects which of the two time domain buffers of each accumulator holds the
+  // current output.
+  size_t buffer_selector_;
+
+  // Temporary audio buffer to store the overlap added symmetric and
+  // antisymmetric outputs.
   AudioBuffer filtered_input_;
 };
 
@@ -0,0 +1,88 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ambisonics/ambisonic_binaural_decoder.h"
+
+#include <memory>
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "ambisonics/utils.h"
+#include "base/audio_buffer.h"
+#include "base/constants_and_types.h"
+#include "config/global_config.h"
+#include "dsp/fft_manager.h"
+#include "dsp/resampler.h"
+#include "dsp/sh_hrir_creator.h"
+#include "utils/benchmark_util.h"
+
+namespace vraudio {
+
+namespace {
+
+const int kSampleRate = 48000;
+
+// Returns the SH HRIR asset of the given ambisonic order used by the renderer.
+std::string GetShHrirFilename(int ambisonic_order) {
+  const GraphManagerConfig config = GlobalConfig(kMaxSupportedAmbisonicOrder);
+  for (const auto& sh_hrir_filename : config.sh_hrir_filenames) {
+    if (sh_hrir_filename.first == ambisonic_order) {
+      return sh_hrir_filename.second;
+    }
+  }
+  return std::string();
+}
+
+// Sweeps the number of frames per buffer and the ambisonic orders that have SH
+// HRIR assets, which are passed as |state.range(0)| and |state.range(1)|
+// respectively.
+void FramesPerBufferAndShHrirOrderArguments(
+    benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"frames", "order"});
+  const GraphManagerConfig config = GlobalConfig(kMaxSupportedAmbisonicOrder);
+  for (const auto& sh_hrir_filename : config.sh_hrir_filenames) {
+    for (int frames = kMinBenchmarkFramesPerBuffer;
+         frames <= kMaxBenchmarkFramesPerBuffer; frames *= 2) {
+      bench->Args({frames, sh_hrir_filename.first});
+    }
+  }
+}
+
+void BM_AmbisonicBinauralDecoder(benchmark::State& state) {
+  const size_t frames_per_buffer = static_cast<size_t>(state.range(0));
+  const int ambisonic_order = static_cast<int>(state.range(1));
+  Resampler resampler;
+  std::unique_ptr<AudioBuffer> sh_hrirs = CreateShHrirsFromAssets(
+      GetShHrirFilename(ambisonic_order), kSampleRate, &resampler);
+  FftManager fft_manager(frames_per_buffer);
+  AmbisonicBinauralDecoder decoder(*sh_hrirs, frames_per_buffer,
+                                   &fft_manager);
+  AudioBuffer input(GetNumPeriphonicComponents(ambisonic_order),
+                    frames_per_buffer);
+  FillWithNoise(&input);
+  AudioBuffer output(kNumStereoChannels, frames_per_buffer);
+  for (auto _ : state) {
+    decoder.Process(input, &output);
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(frames_per_buffer, &state);
+}
+BENCHMARK(BM_AmbisonicBinauralDecoder)
+    ->Apply(FramesPerBufferAndShHrirOrderArguments);
+
+}  // namespace
+
+}  // namespace vraudio
@@ -16,33 +16,45 @@ limitations under the License.
 
 #include "ambisonics/ambisonic_lookup_table.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "ambisonics/ambisonic_spread_coefficients.h"
 #include "ambisonics/associated_legendre_polynomials_generator.h"
 #include "ambisonics/utils.h"
 #include "base/constants_and_types.h"
+#include "base/logging.h"
 #include "base/misc_math.h"
 
-
 namespace vraudio {
 
 namespace {
 
-// Number of azimuth angles to store in the pre-computed encoder lookup table
-// (for 0 - 90 degrees using 1 degree increments).
-const size_t kNumAzimuths = 91;
+// Number of azimuth angles to store in the pre-computed azimuth lookup table
+// (for 0 - 180 degrees using 1 degree increments).
+const size_t kNumAzimuths = 181;
 
-// Number of elevation angles to store in the pre-computed encoder lookup table
-// (for 0 - 90 degrees using 1 degree increments).
+// Number of elevation angles to store in the pre-computed Legendre lookup
+// table (for 0 - 90 degrees using 1 degree increments).
 const size_t kNumElevations = 91;
 
-// Number of Cartesian axes for which to compute spherical harmonic symmetries.
-const size_t kNumAxes = 3;
+// Maximum ambisonic order for which spread gain correction coefficients are
+// tabulated in |kSpreadCoeffs|.
+const int kMaxSpreadTableAmbisonicOrder = 3;
 
 // Minimum angular source spreads at different orders for which we start to
 // apply spread gain correction coefficients. Array index corresponds to
 // ambisonic order. For more information about sound source spread control,
 // please refer to the Matlab code and the corresponding paper.
-const int kMinSpreads[kMaxSupportedAmbisonicOrder + 1] = {361, 54, 40, 31};
+const int kMinSpreads[kMaxSpreadTableAmbisonicOrder + 1] = {361, 54, 40, 31};
+
+// Minimum angular source spreads of the orders above
+// |kMaxSpreadTableAmbisonicOrder|, following the exponential fit of the spread
+// to the ambisonic order in the Matlab code (spread2ambiorder.m). Array index
+// corresponds to ambisonic order minus |kMaxSpreadTableAmbisonicOrder| minus 1.
+const float kMinHigherOrderSpreads[kMaxSupportedAmbisonicOrder -
+                                   kMaxSpreadTableAmbisonicOrder] = {
+    24.87f, 20.21f, 16.40f, 13.18f};
 
 // Spread coefficients are stored sequentially in a 1-d table. Therefore, to
 // access coefficients for the required ambisonic order we need to apply offsets
@@ -50,16 +62,16 @@ const int kMinSpreads[kMaxSupportedAmbisonicOrder + 1] = {361, 54, 40, 31};
 // example, the total number of coefficient in each ambisonic order 'n' is
 // equal to the number of unique orders multiplied by number of unique spreads,
 // i.e.: (n + 1) * (360 - kMinSpreads[n] + 1).
-const int kSpreadCoeffOffsets[kMaxSupportedAmbisonicOrder + 1] = {0, 1, 615,
-                                                                  1578};
-
-size_t GetEncoderTableIndex(size_t i, size_t j, size_t k, size_t width,
-                            size_t depth) {
-  return i * width * depth + j * depth + k;
-}
+const int kSpreadCoeffOffsets[kMaxSpreadTableAmbisonicOrder + 1] = {0, 1, 615,
+                                                                    1578};
 
-size_t GetSymmetriesTableIndex(size_t i, size_t j, size_t width) {
-  return i * width + j;
+// Returns the index of the associated Legendre polynomial of the given
+// |degree| >= 1 and |order| >= 0 in the Legendre tables.
+size_t GetLegendreIndex(int degree, int order) {
+  DCHECK_GE(degree, 1);
+  DCHECK_GE(order, 0);
+  DCHECK_LE(order, degree);
+  return static_cast<size_t>(degree * (degree + 1) / 2 + order - 1);
 }
 
 int GetSpreadTableIndex(int ambisonic_order, float source_spread_deg) {
@@ -71,96 +83,142 @@ int GetSpreadTableIndex(int ambisonic_order, float source_spread_deg) {
                               kMinSpreads[ambisonic_order]);
 }
 
+// Splits the non-negative |angle_deg| into the index of the lower of the two
+// enclosing table entries and the interpolation factor between them.
+void GetInterpolationIndex(float angle_deg, size_t num_entries, size_t* index,
+                           float* factor) {
+  // Signed conversion is cheaper than the unsigned one.
+  const int lower_index =
+      std::min(static_cast<int>(angle_deg), static_cast<int>(num_entries) - 2);
+  *index = static_cast<size_t>(lower_index);
+  *factor = angle_deg - static_cast<float>(lower_index);
+}
+
+// Enclosing rows of the azimuth and Legendre tables of a source direction,
+// together with the interpolation factors between them and the signs of the
+// source direction.
+struct TableRows {
+  const float* lower_azimuth_values;
+  const float* upper_azimuth_values;
+  float azimuth_factor;
+  bool is_negative_azimuth;
+  const float* lower_legendre_values;
+  const float* upper_legendre_values;
+  float elevation_factor;
+  bool is_negative_elevation;
+};
+
+// Interpolates the encoding coefficients of the given |AmbisonicOrder| from
+// the enclosing table |rows|. Specializing on the order lets the compiler
+// unroll the loops, which are only a few iterations long at low orders.
+template <int AmbisonicOrder>
+void InterpolateCoeffs(const TableRows& rows, float* encoding_coeffs) {
+  enum {
+    kNumAzimuthValues = 2 * AmbisonicOrder,
+    kNumLegendreValues = (AmbisonicOrder + 1) * (AmbisonicOrder + 2) / 2 - 1
+  };
+  // Interpolated cosines and sines of the multiples of the azimuth angle.
+  // Sines of negative azimuth angles change their sign.
+  const float sine_sign = rows.is_negative_azimuth ? -1.0f : 1.0f;
+  float azimuth_values[kNumAzimuthValues];
+  for (int i = 0; i < kNumAzimuthValues; i += 2) {
+    azimuth_values[i] =
+        rows.lower_azimuth_values[i] +
+        rows.azimuth_factor *
+            (rows.upper_azimuth_values[i] - rows.lower_azimuth_values[i]);
+    azimuth_values[i + 1] =
+        sine_sign * (rows.lower_azimuth_values[i + 1] +
+                     rows.azimuth_factor * (rows.upper_azimuth_values[i + 1] -
+                                            rows.lower_azimuth_values[i + 1]));
+  }
+
+  // Interpolated associated Legendre polynomials. The polynomials of lower
+  // degrees are stored first, so that the first entries of each row of the
+  // table hold the polynomials up to |AmbisonicOrder|.
+  float legendre_values[kNumLegendreValues];
+  for (int i = 0; i < kNumLegendreValues; ++i) {
+    legendre_values[i] =
+        rows.lower_legendre_values[i] +
+        rows.elevation_factor *
+            (rows.upper_legendre_values[i] - rows.lower_legendre_values[i]);
+  }
+
+  // Legendre polynomials of odd degree plus order change their sign at
+  // negative elevation angles.
+  const float odd_sign = rows.is_negative_elevation ? -1.0f : 1.0f;
+  encoding_coeffs[0] = 1.0f;
+  const float* legendre_value = legendre_values;
+  for (int degree = 1; degree <= AmbisonicOrder; ++degree) {
+    // Index of the coefficient of order 0 in ACN sequence.
+    const int center_idx = degree * degree + degree;
+    float sign = degree % 2 == 1 ? odd_sign : 1.0f;
+    encoding_coeffs[center_idx] = sign * legendre_value[0];
+    for (int order = 1; order <= degree; ++order) {
+      sign *= odd_sign;
+      const float value = sign * legendre_value[order];
+      encoding_coeffs[center_idx + order] =
+          value * azimuth_values[2 * (order - 1)];
+      encoding_coeffs[center_idx - order] =
+          value * azimuth_values[2 * (order - 1) + 1];
+    }
+    legendre_value += degree + 1;
+  }
+}
+
 }  // namespace
 
 AmbisonicLookupTable::AmbisonicLookupTable(int max_ambisonic_order)
     : max_ambisonic_order_(max_ambisonic_order),
-      max_num_coeffs_in_table_(
-          GetNumPeriphonicComponents(max_ambisonic_order_) - 1),
-      encoder_table_(kNumAzimuths * kNumElevations * max_num_coeffs_in_table_),
-      symmetries_table_(kNumAxes * max_num_coeffs_in_table_) {
+      num_legendre_polynomials_(static_cast<size_t>(
+          (max_ambisonic_order_ + 1) * (max_ambisonic_order_ + 2) / 2 - 1)),
+      sn3d_normalizations_(num_legendre_polynomials_) {
   DCHECK_GE(max_ambisonic_order_, 0);
   DCHECK_LE(max_ambisonic_order_, kMaxSupportedAmbisonicOrder);
-  ComputeEncoderTable();
-  ComputeSymmetriesTable();
+  for (int degree = 1; degree <= max_ambisonic_order_; ++degree) {
+    for (int order = 0; order <= degree; ++order) {
+      sn3d_normalizations_[GetLegendreIndex(degree, order)] =
+          Sn3dNormalization(degree, order);
+    }
+  }
+  ComputeEncoderTables();
 }
 
 void AmbisonicLookupTable::GetEncodingCoeffs(
     int ambisonic_order, const SphericalAngle& source_direction,
     float source_spread_deg, std::vector<float>* encoding_coeffs) const {
+  DCHECK(encoding_coeffs);
+  DCHECK_EQ(encoding_coeffs->size(),
+            GetNumPeriphonicComponents(ambisonic_order));
+  DCHECK_GE(ambisonic_order, 0);
+  DCHECK_LE(ambisonic_order, max_ambisonic_order_);
+  InterpolateEncodingCoeffs(ambisonic_order, source_direction,
+                            encoding_coeffs->data());
+  ApplySpreadGains(ambisonic_order, source_spread_deg,
+                   encoding_coeffs->data());
+}
 
+void AmbisonicLookupTable::GetEncodingCoeffs(
+    int ambisonic_order, size_t num_sources,
+    const SphericalAngle* source_directions, const float* source_spreads_deg,
+    float* encoding_coeffs) const {
   DCHECK_GE(ambisonic_order, 0);
-  DCHECK_LE(ambisonic_order, kMaxSupportedAmbisonicOrder);
-  DCHECK_GE(source_spread_deg, 0.0f);
-  DCHECK_LE(source_spread_deg, 360.0f);
+  DCHECK_LE(ambisonic_order, max_ambisonic_order_);
+  DCHECK(source_directions);
+  DCHECK(source_spreads_deg);
   DCHECK(encoding_coeffs);
-  // Raw coefficients are stored only for ambisonic orders 1 and up, since 0th
-  // order raw coefficient is always 1.
-  const size_t num_raw_coeffs = GetNumPeriphonicComponents(ambisonic_order) - 1;
-  // The actual number of returned Ambisonic coefficients is therefore
-  // |num_raw_coeffs + 1|.
-  DCHECK_EQ(encoding_coeffs->size(), num_raw_coeffs + 1);
-  DCHECK_GE(source_direction.azimuth(), -kPi);
-  DCHECK_LE(source_direction.azimuth(), kTwoPi);
-  DCHECK_GE(source_direction.elevation(), -kHalfPi);
-  DCHECK_LE(source_direction.elevation(), kHalfPi);
-  const int azimuth_deg =
-      source_direction.azimuth() < kPi
-          ? static_cast<int>(source_direction.azimuth() * kDegreesFromRadians)
-          : static_cast<int>(source_direction.azimuth() * kDegreesFromRadians) -
-                360;
-  const int elevation_deg =
-      static_cast<int>(source_direction.elevation() * kDegreesFromRadians);
-  const size_t abs_azimuth_deg = static_cast<size_t>(std::abs(azimuth_deg));
-  const size_t azimuth_idx =
-      abs_azimuth_deg > 90 ? 180 - abs_azimuth_deg : abs_azimuth_deg;
-  const size_t elevation_idx = static_cast<size_t>(std::abs(elevation_deg));
-  (*encoding_coeffs)[0] = 1.0f;
-  for (size_t raw_coeff_idx = 0; raw_coeff_idx < num_raw_coeffs;
-       ++raw_coeff_idx) {
-    // Variable to hold information about spherical harmonic phase flip. 1 means
-    // no flip; -1 means 180 degrees flip.
-    float flip = 1.0f;
-    // The following three 'if' statements implement the logic to correct the
-    // phase of the current spherical harmonic, depending on which quadrant the
-    // sound source is located in. For more information, please see the Matlab
-    // code and the corresponding paper.
-    if (azimuth_deg < 0) {
-      flip = symmetries_table_[GetSymmetriesTableIndex(
-          0, raw_coeff_idx, max_num_coeffs_in_table_)];
-    }
-    if (elevation_deg < 0) {
-      flip *= symmetries_table_[GetSymmetriesTableIndex(
-          1, raw_coeff_idx, max_num_coeffs_in_table_)];
-    }
-    if (abs_azimuth_deg > 90) {
-      flip *= symmetries_table_[GetSymmetriesTableIndex(
-          2, raw_coeff_idx, max_num_coeffs_in_table_)];
-    }
-    const size_t encoder_table_idx =
-        GetEncoderTableIndex(azimuth_idx, elevation_idx, raw_coeff_idx,
-                             kNumElevations, max_num_coeffs_in_table_);
-    (*encoding_coeffs)[raw_coeff_idx + 1] =
-        encoder_table_[encoder_table_idx] * flip;
-  }
-
-  // If the spread is more than min. theoretical spread for the given
-  // |ambisonic_order|, multiply the encoding coefficients by the required
-  // spread control gains from the |kSpreadCoeffs| lookup table.
-  if (source_spread_deg >= kMinSpreads[ambisonic_order]) {
-    const int spread_table_idx =
-        GetSpreadTableIndex(ambisonic_order, source_spread_deg);
-    (*encoding_coeffs)[0] *= kSpreadCoeffs[spread_table_idx];
-    for (size_t coeff = 1; coeff < encoding_coeffs->size(); ++coeff) {
-      const int current_coefficient_degree =
-          GetPeriphonicAmbisonicOrderForChannel(coeff);
-      (*encoding_coeffs)[coeff] *=
-          kSpreadCoeffs[spread_table_idx + current_coefficient_degree];
-    }
+  const size_t num_coeffs = GetNumPeriphonicComponents(ambisonic_order);
+  for (size_t source = 0; source < num_sources; ++source) {
+    float* const source_coeffs = encoding_coeffs + source * num_coeffs;
+    InterpolateEncodingCoeffs(ambisonic_order, source_directions[source],
+                              source_coeffs);
+    ApplySpreadGains(ambisonic_order, source_spreads_deg[source],
+                     source_coeffs);
   }
 }
 
-void AmbisonicLookupTable::ComputeEncoderTable() {
+void AmbisonicLookupTable::ComputeEncoderTables() {
+  legendre_table_.resize(kNumElevations * num_legendre_polynomials_);
+  azimuth_table_.resize(kNumAzimuths * 2 * max_ambisonic_order_);
 
   // Associated Legendre polynomial generator.
   AssociatedLegendrePolynomialsGenerator alp_generator(
@@ -168,64 +226,143 @@ void AmbisonicLookupTable::ComputeEncoderTable() {
       /*compute_negative_order=*/false);
   // Temporary storage for associated Legendre polynomials generated.
   std::vector<float> temp_associated_legendre_polynomials;
-  for (size_t azimuth_idx = 0; azimuth_idx < kNumAzimuths; ++azimuth_idx) {
-    for (size_t elevation_idx = 0; elevation_idx < kNumElevations;
-         ++elevation_idx) {
-      const SphericalAngle angle(
-          static_cast<float>(azimuth_idx) * kRadiansFromDegrees,
-          static_cast<float>(elevation_idx) * kRadiansFromDegrees);
-      temp_associated_legendre_polynomials =
-          alp_generator.Generate(std::sin(angle.elevation()));
-      // First spherical harmonic is always equal 1 for all angles so we do not
-      // need to compute and store it.
-      for (int degree = 1; degree <= max_ambisonic_order_; ++degree) {
-        for (int order = -degree; order <= degree; ++order) {
-          const size_t alp_index =
-              alp_generator.GetIndex(degree, std::abs(order));
-          const float alp_value =
-              temp_associated_legendre_polynomials[alp_index];
-          const size_t raw_coeff_idx = AcnSequence(degree, order) - 1;
-          const size_t encoder_table_idx =
-              GetEncoderTableIndex(azimuth_idx, elevation_idx, raw_coeff_idx,
-                                   kNumElevations, max_num_coeffs_in_table_);
-          encoder_table_[encoder_table_idx] =
-              Sn3dNormalization(degree, order) *
-              UnnormalizedSphericalHarmonic(alp_value, order, angle.azimuth());
-        }
+  for (size_t elevation_idx = 0; elevation_idx < kNumElevations;
+       ++elevation_idx) {
+    const float elevation_rad =
+        static_cast<float>(elevation_idx) * kRadiansFromDegrees;
+    temp_associated_legendre_polynomials =
+        alp_generator.Generate(std::sin(elevation_rad));
+    // First spherical harmonic is always equal 1 for all angles so we do not
+    // need to compute and store it.
+    for (int degree = 1; degree <= max_ambisonic_order_; ++degree) {
+      for (int order = 0; order <= degree; ++order) {
+        const size_t legendre_idx = GetLegendreIndex(degree, order);
+        legendre_table_[elevation_idx * num_legendre_polynomials_ +
+                        legendre_idx] =
+            sn3d_normalizations_[legendre_idx] *
+            temp_associated_legendre_polynomials[alp_generator.GetIndex(
+                degree, order)];
       }
     }
   }
+  for (size_t azimuth_idx = 0; azimuth_idx < kNumAzimuths; ++azimuth_idx) {
+    const float azimuth_rad =
+        static_cast<float>(azimuth_idx) * kRadiansFromDegrees;
+    float* azimuth_values = &azimuth_table_[azimuth_idx * 2 *
+                                            max_ambisonic_order_];
+    for (int order = 1; order <= max_ambisonic_order_; ++order) {
+      azimuth_values[2 * (order - 1)] =
+          std::cos(static_cast<float>(order) * azimuth_rad);
+      azimuth_values[2 * (order - 1) + 1] =
+          std::sin(static_cast<float>(order) * azimuth_rad);
+    }
+  }
 }
 
-void AmbisonicLookupTable::ComputeSymmetriesTable() {
-
-  for (int degree = 1; degree <= max_ambisonic_order_; ++degree) {
-    for (int order = -degree; order <= degree; ++order) {
-      const size_t raw_coeff_idx = AcnSequence(degree, order) - 1;
-      // Symmetry wrt the left-right axis (Y).
-      symmetries_table_[GetSymmetriesTableIndex(0, raw_coeff_idx,
-                                                max_num_coeffs_in_table_)] =
-          order < 0 ? -1.0f : 1.0f;
-      // Symmetry wrt the up-down axis (Z).
-      symmetries_table_[GetSymmetriesTableIndex(1, raw_coeff_idx,
-                                                max_num_coeffs_in_table_)] =
-          static_cast<float>(IntegerPow(-1, degree + order));
-      // Symmetry wrt the front-back axis (X).
-      symmetries_table_[GetSymmetriesTableIndex(2, raw_coeff_idx,
-                                                max_num_coeffs_in_table_)] =
-          order < 0 ? static_cast<float>(-IntegerPow(-1, std::abs(order)))
-                    : static_cast<float>(IntegerPow(-1, order));
-    }
+void AmbisonicLookupTable::InterpolateEncodingCoeffs(
+    int ambisonic_order, const SphericalAngle& source_direction,
+    float* encoding_coeffs) const {
+  DCHECK_GE(source_direction.azimuth(), -kPi);
+  DCHECK_LE(source_direction.azimuth(), kTwoPi);
+  DCHECK_GE(source_direction.elevation(), -kHalfPi);
+  DCHECK_LE(source_direction.elevation(), kHalfPi);
+  float azimuth_deg = source_direction.azimuth() * kDegreesFromRadians;
+  if (azimuth_deg > 180.0f) {
+    azimuth_deg -= 360.0f;
+  }
+  const float elevation_deg =
+      source_direction.elevation() * kDegreesFromRadians;
+  size_t azimuth_idx, elevation_idx;
+  float azimuth_factor, elevation_factor;
+  GetInterpolationIndex(std::min(std::abs(azimuth_deg), 180.0f), kNumAzimuths,
+                        &azimuth_idx, &azimuth_factor);
+  GetInterpolationIndex(std::min(std::abs(elevation_deg), 90.0f),
+                        kNumElevations, &elevation_idx, &elevation_factor);
+  const float* azimuth_values =
+      &azimuth_table_[azimuth_idx * 2 * max_ambisonic_order_];
+  const float* legendre_values =
+      &legendre_table_[elevation_idx * num_legendre_polynomials_];
+  const TableRows rows = {azimuth_values,
+                          azimuth_values + 2 * max_ambisonic_order_,
+                          azimuth_factor,
+                          azimuth_deg < 0.0f,
+                          legendre_values,
+                          legendre_values + num_legendre_polynomials_,
+                          elevation_factor,
+                          elevation_deg < 0.0f};
+  switch (ambisonic_order) {
+    case 0:
+      encoding_coeffs[0] = 1.0f;
+      break;
+    case 1:
+      InterpolateCoeffs<1>(rows, encoding_coeffs);
+      break;
+    case 2:
+      InterpolateCoeffs<2>(rows, encoding_coeffs);
+      break;
+    case 3:
+      InterpolateCoeffs<3>(rows, encoding_coeffs);
+      break;
+    case 4:
+      InterpolateCoeffs<4>(rows, encoding_coeffs);
+      break;
+    case 5:
+      InterpolateCoeffs<5>(rows, encoding_coeffs);
+      break;
+    case 6:
+      InterpolateCoeffs<6>(rows, encoding_coeffs);
+      break;
+    case 7:
+      InterpolateCoeffs<7>(rows, encoding_coeffs);
+      break;
+    default:
+      LOG(FATAL) << "Unsupported ambisonic order: " << ambisonic_order;
   }
 }
 
-float AmbisonicLookupTable::UnnormalizedSphericalHarmonic(float alp_value,
-                                                          int order,
-                                                          float azimuth_rad) {
-  const float horizontal_term =
-      (order >= 0) ? std::cos(static_cast<float>(order) * azimuth_rad)
-                   : std::sin(static_cast<float>(-order) * azimuth_rad);
-  return alp_value * horizontal_term;
+void AmbisonicLookupTable::ApplySpreadGains(int ambisonic_order,
+                                            float source_spread_deg,
+                                            float* encoding_coeffs) const {
+  DCHECK_GE(source_spread_deg, 0.0f);
+  DCHECK_LE(source_spread_deg, 360.0f);
+  // Spread gains are only tabulated up to |kMaxSpreadTableAmbisonicOrder|.
+  // Sources of higher orders fade out their higher degree components between
+  // the minimum spread of their order and the minimum spread of the table, and
+  // are spread like sources of the highest tabulated order beyond.
+  const int spread_table_order =
+      std::min(ambisonic_order, kMaxSpreadTableAmbisonicOrder);
+  if (ambisonic_order > kMaxSpreadTableAmbisonicOrder) {
+    const float min_spread_deg = kMinHigherOrderSpreads[
+        ambisonic_order - kMaxSpreadTableAmbisonicOrder - 1];
+    if (source_spread_deg > min_spread_deg) {
+      const float max_spread_deg =
+          static_cast<float>(kMinSpreads[kMaxSpreadTableAmbisonicOrder]);
+      const float higher_degree_gain = std::max(
+          0.0f, (max_spread_deg - source_spread_deg) /
+                    (max_spread_deg - min_spread_deg));
+      const size_t num_coeffs = GetNumPeriphonicComponents(ambisonic_order);
+      for (size_t coeff =
+               GetNumPeriphonicComponents(kMaxSpreadTableAmbisonicOrder);
+           coeff < num_coeffs; ++coeff) {
+        encoding_coeffs[coeff] *= higher_degree_gain;
+      }
+    }
+  }
+  // If the spread is more than min. theoretical spread for the given
+  // |ambisonic_order|, multiply the encoding coefficients by the required
+  // spread control gains from the |kSpreadCoeffs| lookup table.
+  if (source_spread_deg >= kMinSpreads[spread_table_order]) {
+    const int spread_table_idx =
+        GetSpreadTableIndex(spread_table_order, source_spread_deg);
+    encoding_coeffs[0] *= kSpreadCoeffs[spread_table_idx];
+    const size_t num_coeffs = GetNumPeriphonicComponents(spread_table_order);
+    for (size_t coeff = 1; coeff < num_coeffs; ++coeff) {
+      const int current_coefficient_degree =
+          GetPeriphonicAmbisonicOrderForChannel(coeff);
+      encoding_coeffs[coeff] *=
+          kSpreadCoeffs[spread_table_idx + current_coefficient_degree];
+    }
+  }
 }
 
 }  // namespace vraudio
@@ -26,6 +26,13 @@ namespace vraudio {
 // Represents a lookup table for encoding of Ambisonic periphonic sound fields.
 // Supports arbitrary Ambisonic order and uses AmbiX convention (ACN channel
 // sequencing, SN3D normalization).
+//
+// The real spherical harmonics are separable into an elevation dependent
+// associated Legendre polynomial and an azimuth dependent sine or cosine. The
+// table stores both factors separately, for non-negative elevations and
+// azimuths only, and interpolates them linearly. This corresponds to a
+// bilinear interpolation of the encoding coefficients at a fraction of the
+// memory of a table of all coefficients.
 class AmbisonicLookupTable {
  public:
   // Creates Ambisonic (AmbiX) encoder lookup table given the
@@ -47,44 +54,68 @@ class AmbisonicLookupTable {
                          float source_spread_deg,
                          std::vector<float>* encoding_coeffs) const;
 
+  // Gets spherical harmonic encoding coefficients for a batch of sources of
+  // the given order.
+  //
+  // @param ambisonic_order Ambisonic order of the encoded sound sources.
+  // @param num_sources Number of sound sources.
+  // @param source_directions Directions of the sound sources in spherical
+  //     coordinates.
+  // @param source_spreads_deg Angular spreads of the sound sources in degrees.
+  // @param encoding_coeffs Ambisonic encoding coefficients of the sound
+  //     sources, the coefficients of each source being stored contiguously.
+  //     Must hold |num_sources| times the number of Ambisonic channels.
+  void GetEncodingCoeffs(int ambisonic_order, size_t num_sources,
+                         const SphericalAngle* source_directions,
+                         const float* source_spreads_deg,
+                         float* encoding_coeffs) const;
+
  private:
-  // Computes a lookup table of encoding coefficients for one quadrant of the
-  // sphere.
-  void ComputeEncoderTable();
-
-  // Computes a table of spherical harmonics symmetry information for all
-  // cartesian axes. Value of 1 indicates that the current spherical harmonic is
-  // symmetric with respect to the current axis. Value of -1 indicates that the
-  // current spherical harmonic is anti-symmetric with respect to the current
-  // axis.
-  void ComputeSymmetriesTable();
-
-  // Returns the unnormalized spherical harmonic coefficient:
-  // Y_degree^order(azimuth, elevation).
+  // Computes the tables of the associated Legendre polynomials and of the
+  // sines and cosines of multiples of the azimuth angle.
+  void ComputeEncoderTables();
+
+  // Interpolates the spherical harmonic encoding coefficients of a source
+  // direction from the tables.
   //
-  // @param alp_value Associated Legendre polynomial for the given degree and
-  //     order evaluated at sin elevation angle: P_degree^order(sin(elevation)).
-  // @param order Order of the Associated Legendre polynomial.
-  // @param azimuth_rad Azimuth angle in radians.
-  // @return Unnormalized spherical harmonic coefficient.
-  float UnnormalizedSphericalHarmonic(float alp_value, int order,
-                                      float azimuth_rad);
+  // @param ambisonic_order Ambisonic order of the encoded sound source.
+  // @param source_direction Direction of a sound source in spherical
+  //     coordinates.
+  // @param encoding_coeffs Ambisonic encoding coefficients.
+  void InterpolateEncodingCoeffs(int ambisonic_order,
+                                 const SphericalAngle& source_direction,
+                                 float* encoding_coeffs) const;
+
+  // Multiplies the encoding coefficients by the spread control gains, if the
+  // spread is more than the minimum theoretical spread for the given
+  // |ambisonic_order|.
+  //
+  // @param ambisonic_order Ambisonic order of the encoded sound source.
+  // @param source_spread_deg Encoded sound source angular spread in degrees.
+  // @param encoding_coeffs Ambisonic encoding coefficients.
+  void ApplySpreadGains(int ambisonic_order, float source_spread_deg,
+                        float* encoding_coeffs) const;
 
   // Ambisonic order.
   const int max_ambisonic_order_;
 
-  // Maximum number of coefficients to be stored in the lookup table equal to
-  // the number of Ambisonic channels for |max_ambisonic_order_| - 1. This is
-  // because we do not need to store the coefficient for the first spherical
-  // harmonic coefficient as it is always 1.
-  const size_t max_num_coeffs_in_table_;
+  // Number of associated Legendre polynomials of degree 1 to
+  // |max_ambisonic_order_| and non-negative order. The polynomial of degree 0
+  // is always equal to 1.
+  const size_t num_legendre_polynomials_;
+
+  // SN3D normalization factors of the associated Legendre polynomials.
+  std::vector<float> sn3d_normalizations_;
 
-  // Lookup table for storing Ambisonic encoding coefficients for one quadrant
-  // of the sphere.
-  std::vector<float> encoder_table_;
+  // Lookup table of the SN3D normalized associated Legendre polynomials for
+  // elevation angles of 0 to 90 degrees. The polynomials at negative elevation
+  // angles follow from their parity.
+  std::vector<float> legendre_table_;
 
-  // Lookup table for storing information about spherical harmonic symmetries.
-  std::vector<float> symmetries_table_;
+  // Lookup table of the cosines and sines of the first |max_ambisonic_order_|
+  // multiples of the azimuth angle, for azimuth angles of 0 to 180 degrees.
+  // The values at negative azimuth angles follow from their parity.
+  std::vector<float> azimuth_table_;
 };
 
 }  // namespace vraudio
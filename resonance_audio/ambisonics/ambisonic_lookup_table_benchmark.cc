@@ -0,0 +1,93 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ambisonics/ambisonic_lookup_table.h"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "ambisonics/utils.h"
+#include "base/constants_and_types.h"
+
+namespace vraudio {
+
+namespace {
+
+// Number of source directions encoded per iteration.
+const size_t kNumSources = 64;
+
+// Spread of the encoded sources, below the minimum spread of all orders so
+// that only the spherical harmonics are measured.
+const float kSourceSpreadDeg = 0.0f;
+
+// Sweeps the ambisonic orders.
+void OrderArguments(benchmark::internal::Benchmark* bench) {
+  bench->ArgName("order");
+  for (int order = 1; order <= kMaxSupportedAmbisonicOrder; ++order) {
+    bench->Arg(order);
+  }
+}
+
+// Returns |kNumSources| directions at non-integer angles.
+std::vector<SphericalAngle> GenerateSourceDirections() {
+  std::vector<SphericalAngle> directions;
+  for (size_t i = 0; i < kNumSources; ++i) {
+    directions.push_back(SphericalAngle::FromDegrees(
+        -180.0f + 5.63f * static_cast<float>(i),
+        -89.0f + 2.79f * static_cast<float>(i)));
+  }
+  return directions;
+}
+
+void BM_AmbisonicLookupTableSingle(benchmark::State& state) {
+  const int ambisonic_order = static_cast<int>(state.range(0));
+  const AmbisonicLookupTable lookup_table(kMaxSupportedAmbisonicOrder);
+  const std::vector<SphericalAngle> directions = GenerateSourceDirections();
+  std::vector<float> encoding_coeffs(
+      GetNumPeriphonicComponents(ambisonic_order));
+  for (auto _ : state) {
+    for (const SphericalAngle& direction : directions) {
+      lookup_table.GetEncodingCoeffs(ambisonic_order, direction,
+                                     kSourceSpreadDeg, &encoding_coeffs);
+      benchmark::DoNotOptimize(encoding_coeffs.data());
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(kNumSources));
+}
+BENCHMARK(BM_AmbisonicLookupTableSingle)->Apply(OrderArguments);
+
+void BM_AmbisonicLookupTableBatch(benchmark::State& state) {
+  const int ambisonic_order = static_cast<int>(state.range(0));
+  const AmbisonicLookupTable lookup_table(kMaxSupportedAmbisonicOrder);
+  const std::vector<SphericalAngle> directions = GenerateSourceDirections();
+  const std::vector<float> spreads(kNumSources, kSourceSpreadDeg);
+  std::vector<float> encoding_coeffs(
+      kNumSources * GetNumPeriphonicComponents(ambisonic_order));
+  for (auto _ : state) {
+    lookup_table.GetEncodingCoeffs(ambisonic_order, kNumSources,
+                                   directions.data(), spreads.data(),
+                                   encoding_coeffs.data());
+    benchmark::DoNotOptimize(encoding_coeffs.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(kNumSources));
+}
+BENCHMARK(BM_AmbisonicLookupTableBatch)->Apply(OrderArguments);
+
+}  // namespace
+
+}  // namespace vraudio
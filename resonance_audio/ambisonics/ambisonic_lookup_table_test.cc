@@ -17,8 +17,10 @@ limitations under the License.
 #include "ambisonics/ambisonic_lookup_table.h"
 
 #include <cmath>
+#include <limits>
 
 #include "third_party/googletest/googletest/include/gtest/gtest.h"
+#include "ambisonics/associated_legendre_polynomials_generator.h"
 #include "ambisonics/utils.h"
 #include "base/constants_and_types.h"
 #include "base/misc_math.h"
@@ -31,14 +33,51 @@ const int kSourceAmbisonicOrder0 = 0;
 const int kSourceAmbisonicOrder1 = 1;
 const int kSourceAmbisonicOrder2 = 2;
 const int kSourceAmbisonicOrder3 = 3;
+const int kSourceAmbisonicOrder5 = 5;
+const int kSourceAmbisonicOrder7 = 7;
 
 // Minimum angular source spread of 0 ensures that no gain correction
 // coefficients should be applied to the Ambisonic encoding coefficients.
 const float kMinSpreadDeg = 0.0f;
 
+// Maximum error of the interpolated encoding coefficients between the 1 degree
+// steps of the lookup table.
+const float kInterpolationErrorTolerance = 5e-4f;
+
+// Maximum error of the interpolated seventh order encoding coefficients, whose
+// spherical harmonics vary faster with the direction.
+const float kHigherOrderInterpolationErrorTolerance = 2e-3f;
+
+// Evaluates the SN3D normalized real spherical harmonics up to the given
+// |ambisonic_order| in the |direction| in ACN sequence.
+std::vector<float> EvaluateSphericalHarmonics(int ambisonic_order,
+                                              const SphericalAngle& direction) {
+  AssociatedLegendrePolynomialsGenerator alp_generator(
+      ambisonic_order, /*condon_shortley_phase=*/false,
+      /*compute_negative_order=*/false);
+  const std::vector<float> associated_legendre_polynomials =
+      alp_generator.Generate(std::sin(direction.elevation()));
+  std::vector<float> coeffs(GetNumPeriphonicComponents(ambisonic_order));
+  for (int degree = 0; degree <= ambisonic_order; ++degree) {
+    for (int order = -degree; order <= degree; ++order) {
+      const float azimuth_term =
+          order >= 0
+              ? std::cos(static_cast<float>(order) * direction.azimuth())
+              : std::sin(static_cast<float>(-order) * direction.azimuth());
+      coeffs[AcnSequence(degree, order)] =
+          Sn3dNormalization(degree, order) *
+          associated_legendre_polynomials[alp_generator.GetIndex(
+              degree, std::abs(order))] *
+          azimuth_term;
+    }
+  }
+  return coeffs;
+}
+
 }  // namespace
 
-class AmbisonicLookupTableTest : public ::testing::TestWithParam<int> {
+class AmbisonicLookupTableTest
+    : public ::testing::TestWithParam<int> {
  protected:
   AmbisonicLookupTableTest()
       : lookup_table_(kMaxSupportedAmbisonicOrder),
@@ -81,6 +120,51 @@ class AmbisonicLookupTableTest : public ::testing::TestWithParam<int> {
     }
   }
 
+  // Tests whether the coefficients at directions between the full degree steps
+  // of the lookup table follow the spherical harmonics.
+  void TestFractionalDirections() {
+    for (float azimuth_deg = -179.7f; azimuth_deg < 360.0f;
+         azimuth_deg += 13.37f) {
+      for (float elevation_deg = -89.9f; elevation_deg < 90.0f;
+           elevation_deg += 7.43f) {
+        const SphericalAngle direction =
+            SphericalAngle::FromDegrees(azimuth_deg, elevation_deg);
+        const std::vector<float> kExpectedCoeffs =
+            GenerateExpectedCoeffs(direction);
+        lookup_table_.GetEncodingCoeffs(source_ambisonic_order_, direction,
+                                        kMinSpreadDeg, &encoding_coeffs_);
+        for (size_t j = 0; j < encoding_coeffs_.size(); ++j) {
+          EXPECT_NEAR(kExpectedCoeffs[j], encoding_coeffs_[j],
+                      kInterpolationErrorTolerance);
+        }
+      }
+    }
+  }
+
+  // Tests whether the batch GetEncodingCoeffs() method returns the same
+  // coefficients as encoding each source separately.
+  void TestBatchEncodingCoefficients() {
+    const size_t num_coeffs = encoding_coeffs_.size();
+    const size_t num_sources = kSourceDirections.size();
+    std::vector<float> spreads(num_sources);
+    for (size_t i = 0; i < num_sources; ++i) {
+      spreads[i] = static_cast<float>(i) * 360.0f /
+                   static_cast<float>(num_sources - 1);
+    }
+    std::vector<float> batch_coeffs(num_sources * num_coeffs);
+    lookup_table_.GetEncodingCoeffs(source_ambisonic_order_, num_sources,
+                                    kSourceDirections.data(), spreads.data(),
+                                    batch_coeffs.data());
+    for (size_t i = 0; i < num_sources; ++i) {
+      lookup_table_.GetEncodingCoeffs(source_ambisonic_order_,
+                                      kSourceDirections[i], spreads[i],
+                                      &encoding_coeffs_);
+      for (size_t j = 0; j < num_coeffs; ++j) {
+        EXPECT_EQ(encoding_coeffs_[j], batch_coeffs[i * num_coeffs + j]);
+      }
+    }
+  }
+
  private:
   // Generates expected ambisonic encoding coefficients for ambisonic orders 0
   // to 3, according to http://ambisonics.ch/standards/channels/index.
@@ -163,12 +247,96 @@ TEST_P(AmbisonicLookupTableTest, GetEncodingCoeffsTest) {
 // velocity channels.
 TEST_P(AmbisonicLookupTableTest, SpreadEnergyTest) { TestSpreadEnergy(); }
 
+// Tests whether the coefficients at directions between full degrees are
+// accurate.
+TEST_P(AmbisonicLookupTableTest, FractionalDirectionsTest) {
+  TestFractionalDirections();
+}
+
+// Tests whether encoding a batch of sources matches encoding each source
+// separately.
+TEST_P(AmbisonicLookupTableTest, BatchEncodingCoeffsTest) {
+  TestBatchEncodingCoefficients();
+}
+
 INSTANTIATE_TEST_CASE_P(TestParameters, AmbisonicLookupTableTest,
                         testing::Values(kSourceAmbisonicOrder0,
                                         kSourceAmbisonicOrder1,
                                         kSourceAmbisonicOrder2,
                                         kSourceAmbisonicOrder3));
 
+class AmbisonicLookupTableHigherOrderTest
+    : public ::testing::TestWithParam<int> {
+ protected:
+  AmbisonicLookupTableHigherOrderTest()
+      : source_ambisonic_order_(GetParam()),
+        lookup_table_(kMaxSupportedAmbisonicOrder),
+        encoding_coeffs_(GetNumPeriphonicComponents(source_ambisonic_order_)) {}
+
+  const int source_ambisonic_order_;
+  const AmbisonicLookupTable lookup_table_;
+  std::vector<float> encoding_coeffs_;
+};
+
+// Tests whether the SN3D normalized spherical harmonics of each degree satisfy
+// the addition theorem, i.e. their squares sum up to 1, and whether the
+// interpolated coefficients match them.
+TEST_P(AmbisonicLookupTableHigherOrderTest, AdditionTheoremTest) {
+  for (float azimuth_deg = -179.7f; azimuth_deg < 360.0f;
+       azimuth_deg += 23.11f) {
+    for (float elevation_deg = -89.9f; elevation_deg < 90.0f;
+         elevation_deg += 11.27f) {
+      const SphericalAngle direction =
+          SphericalAngle::FromDegrees(azimuth_deg, elevation_deg);
+      const std::vector<float> expected_coeffs =
+          EvaluateSphericalHarmonics(source_ambisonic_order_, direction);
+      lookup_table_.GetEncodingCoeffs(source_ambisonic_order_, direction,
+                                      kMinSpreadDeg, &encoding_coeffs_);
+      for (int degree = 0; degree <= source_ambisonic_order_; ++degree) {
+        float sum_of_squares = 0.0f;
+        for (int order = -degree; order <= degree; ++order) {
+          const size_t channel =
+              static_cast<size_t>(AcnSequence(degree, order));
+          sum_of_squares +=
+              expected_coeffs[channel] * expected_coeffs[channel];
+          EXPECT_NEAR(expected_coeffs[channel], encoding_coeffs_[channel],
+                      kHigherOrderInterpolationErrorTolerance);
+        }
+        EXPECT_NEAR(1.0f, sum_of_squares, 1e-5f);
+      }
+    }
+  }
+}
+
+// Tests whether increasing the source spread at orders without tabulated
+// spread coefficients monotonically moves energy from the velocity channels to
+// the pressure channel.
+TEST_P(AmbisonicLookupTableHigherOrderTest, SpreadEnergyTest) {
+  const SphericalAngle source_direction =
+      SphericalAngle::FromDegrees(-120.0f, 15.0f);
+  float current_pressure_energy = 0.0f;
+  float current_velocity_energy = std::numeric_limits<float>::max();
+  for (int spread_deg = 0; spread_deg <= 360; ++spread_deg) {
+    lookup_table_.GetEncodingCoeffs(source_ambisonic_order_,
+                                    source_direction,
+                                    static_cast<float>(spread_deg),
+                                    &encoding_coeffs_);
+    const float pressure_energy = encoding_coeffs_[0] * encoding_coeffs_[0];
+    float velocity_energy = 0.0f;
+    for (size_t i = 1; i < encoding_coeffs_.size(); ++i) {
+      velocity_energy += encoding_coeffs_[i] * encoding_coeffs_[i];
+    }
+    EXPECT_GE(pressure_energy, current_pressure_energy);
+    EXPECT_LE(velocity_energy, current_velocity_energy);
+    current_pressure_energy = pressure_energy;
+    current_velocity_energy = velocity_energy;
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(TestParameters, AmbisonicLookupTableHigherOrderTest,
+                        testing::Values(kSourceAmbisonicOrder5,
+                                        kSourceAmbisonicOrder7));
+
 class PreComputedCoeffsTest : public ::testing::Test {
  protected:
   // Tests whether the lookup table returns correct coefficients for sources
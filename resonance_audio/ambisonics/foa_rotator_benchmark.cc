@@ -0,0 +1,52 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ambisonics/foa_rotator.h"
+
+#include "benchmark/benchmark.h"
+#include "base/audio_buffer.h"
+#include "base/constants_and_types.h"
+#include "base/misc_math.h"
+#include "utils/benchmark_util.h"
+
+namespace vraudio {
+
+namespace {
+
+// Head rotation increment per buffer, large enough to exceed the rotation
+// quantization of |FoaRotator| in every buffer.
+const float kRotationIncrementRad = 0.05f;
+
+void BM_FoaRotator(benchmark::State& state) {
+  const size_t frames_per_buffer = static_cast<size_t>(state.range(0));
+  FoaRotator rotator;
+  AudioBuffer input(kNumFirstOrderAmbisonicChannels, frames_per_buffer);
+  FillWithNoise(&input);
+  AudioBuffer output(kNumFirstOrderAmbisonicChannels, frames_per_buffer);
+  float angle = 0.0f;
+  for (auto _ : state) {
+    angle += kRotationIncrementRad;
+    const WorldRotation rotation(
+        AngleAxisf(angle, WorldPosition(0.0f, 1.0f, 0.0f)));
+    benchmark::DoNotOptimize(rotator.Process(rotation, input, &output));
+  }
+  SetFramesProcessed(frames_per_buffer, &state);
+}
+BENCHMARK(BM_FoaRotator)->Apply(FramesPerBufferArguments);
+
+}  // namespace
+
+}  // namespace vraudio
@@ -23,6 +23,7 @@ limitations under the License.
 #include "base/constants_and_types.h"
 #include "base/logging.h"
 #include "base/misc_math.h"
+#include "base/simd_macros.h"
 
 namespace vraudio {
 
@@ -145,14 +146,22 @@ void ComputeUVWCoeff(int m, int n, int l, float* u, float* v, float* w) {
 //
 // This implementation comes from p. 5 (6346), Table 1 and 2 in [2] taking
 // into account the corrections from [2b].
-void ComputeBandRotation(int l, std::vector<Eigen::MatrixXf>* rotations) {
+//
+// |uvw_coeffs| holds the coefficients computed by ComputeUVWCoeff() for all
+// elements of the band in row major order.
+void ComputeBandRotation(int l, const float* uvw_coeffs,
+                         std::vector<Eigen::MatrixXf>* rotations) {
   // The lth band rotation matrix has rows and columns equal to the number of
   // coefficients within that band (-l <= m <= l implies 2l + 1 coefficients).
-  Eigen::MatrixXf rotation(2 * l + 1, 2 * l + 1);
+  // It only depends on the lower band matrices, and is thus updated in place.
+  Eigen::MatrixXf& rotation = (*rotations)[l];
+  DCHECK_EQ(rotation.rows(), 2 * l + 1);
+  DCHECK_EQ(rotation.cols(), 2 * l + 1);
   for (int m = -l; m <= l; ++m) {
     for (int n = -l; n <= l; ++n) {
-      float u, v, w;
-      ComputeUVWCoeff(m, n, l, &u, &v, &w);
+      float u = *uvw_coeffs++;
+      float v = *uvw_coeffs++;
+      float w = *uvw_coeffs++;
 
       // The functions U, V, W are only safe to call if the coefficients
       // u, v, w are not zero.
@@ -163,7 +172,141 @@ void ComputeBandRotation(int l, std::vector<Eigen::MatrixXf>* rotations) {
       rotation(m + l, n + l) = (u + v + w);
     }
   }
-  (*rotations)[l] = rotation;
+}
+
+// Computes the coefficients u, v, w of the band rotation recursion for all
+// elements of the bands 2 to |ambisonic_order|, which only depend on the
+// element indices. The coefficients are stored band by band in row major
+// order.
+std::vector<float> ComputeBandRotationCoeffs(int ambisonic_order) {
+  std::vector<float> uvw_coeffs;
+  for (int l = 2; l <= ambisonic_order; ++l) {
+    for (int m = -l; m <= l; ++m) {
+      for (int n = -l; n <= l; ++n) {
+        float u, v, w;
+        ComputeUVWCoeff(m, n, l, &u, &v, &w);
+        uvw_coeffs.push_back(u);
+        uvw_coeffs.push_back(v);
+        uvw_coeffs.push_back(w);
+      }
+    }
+  }
+  return uvw_coeffs;
+}
+
+// Rotates the spherical harmonics of the given |Band|, using the fixed size
+// band sub-matrix of the block diagonal |rotation_matrix|. All channels of the
+// band are read before they are written, which allows inplace rotation.
+template <int Band>
+void RotateBand(const Eigen::MatrixXf& rotation_matrix,
+                const AudioBuffer& input, size_t offset, size_t num_frames,
+                AudioBuffer* output) {
+  enum { kIndex = Band * Band, kSize = 2 * Band + 1 };
+  float band_matrix[kSize][kSize];
+  SimdVector band_matrix_vectors[kSize][kSize];
+  const float* input_samples[kSize];
+  float* output_samples[kSize];
+  for (int row = 0; row < kSize; ++row) {
+    for (int col = 0; col < kSize; ++col) {
+      band_matrix[row][col] = rotation_matrix(kIndex + row, kIndex + col);
+      band_matrix_vectors[row][col] =
+          SIMD_LOAD_ONE_FLOAT(band_matrix[row][col]);
+    }
+    input_samples[row] = input[kIndex + row].begin() + offset;
+    output_samples[row] = (*output)[kIndex + row].begin() + offset;
+  }
+
+  // |offset| is a multiple of the slerp interval, hence SIMD aligned.
+  const size_t num_simd_frames = num_frames / SIMD_LENGTH * SIMD_LENGTH;
+  for (size_t frame = 0; frame < num_simd_frames; frame += SIMD_LENGTH) {
+    SimdVector input_vectors[kSize];
+    for (int col = 0; col < kSize; ++col) {
+      input_vectors[col] =
+          *reinterpret_cast<const SimdVector*>(input_samples[col] + frame);
+    }
+    for (int row = 0; row < kSize; ++row) {
+      SimdVector rotated =
+          SIMD_MULTIPLY(band_matrix_vectors[row][0], input_vectors[0]);
+      for (int col = 1; col < kSize; ++col) {
+        rotated = SIMD_MULTIPLY_ADD(band_matrix_vectors[row][col],
+                                    input_vectors[col], rotated);
+      }
+      *reinterpret_cast<SimdVector*>(output_samples[row] + frame) = rotated;
+    }
+  }
+  for (size_t frame = num_simd_frames; frame < num_frames; ++frame) {
+    float input_values[kSize];
+    for (int col = 0; col < kSize; ++col) {
+      input_values[col] = input_samples[col][frame];
+    }
+    for (int row = 0; row < kSize; ++row) {
+      float rotated = 0.0f;
+      for (int col = 0; col < kSize; ++col) {
+        rotated += band_matrix[row][col] * input_values[col];
+      }
+      output_samples[row][frame] = rotated;
+    }
+  }
+}
+
+// Rotates the bands up to |AmbisonicOrder|.
+template <int AmbisonicOrder>
+void RotateBands(const Eigen::MatrixXf& rotation_matrix,
+                 const AudioBuffer& input, size_t offset, size_t num_frames,
+                 AudioBuffer* output) {
+  RotateBands<AmbisonicOrder - 1>(rotation_matrix, input, offset, num_frames,
+                                  output);
+  RotateBand<AmbisonicOrder>(rotation_matrix, input, offset, num_frames,
+                             output);
+}
+
+// The 0th order spherical harmonic is invariant under rotation.
+template <>
+void RotateBands<0>(const Eigen::MatrixXf& rotation_matrix,
+                    const AudioBuffer& input, size_t offset,
+                    size_t num_frames, AudioBuffer* output) {
+  if (&input != output) {
+    std::copy(input[0].begin() + offset, input[0].begin() + offset + num_frames,
+              (*output)[0].begin() + offset);
+  }
+}
+
+// Rotates the given frames of a sound field of |AmbisonicOrder|.
+template <int AmbisonicOrder>
+void RotateSoundField(const Eigen::MatrixXf& rotation_matrix,
+                      const AudioBuffer& input, size_t offset,
+                      size_t num_frames, AudioBuffer* output) {
+  DCHECK_EQ(input.num_channels(),
+            GetNumPeriphonicComponentsStatic<AmbisonicOrder>::value);
+  RotateBands<AmbisonicOrder>(rotation_matrix, input, offset, num_frames,
+                              output);
+}
+
+// Rotates the given frames of a sound field of arbitrary order.
+void RotateSoundField(const Eigen::MatrixXf& rotation_matrix,
+                      const AudioBuffer& input, size_t offset,
+                      size_t num_frames, AudioBuffer* output) {
+  const size_t channel_stride = input.GetChannelStride();
+
+  typedef Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
+      RowMajorMatrixf;
+
+  const Eigen::Map<const RowMajorMatrixf, Eigen::Aligned, Eigen::OuterStride<>>
+      input_matrix(input[0].begin(), static_cast<int>(input.num_channels()),
+                   static_cast<int>(input.num_frames()),
+                   Eigen::OuterStride<>(static_cast<int>(channel_stride)));
+
+  Eigen::Map<RowMajorMatrixf, Eigen::Aligned, Eigen::OuterStride<>>
+      output_matrix((*output)[0].begin(),
+                    static_cast<int>(input.num_channels()),
+                    static_cast<int>(input.num_frames()),
+                    Eigen::OuterStride<>(static_cast<int>(channel_stride)));
+
+  output_matrix.block(0 /* first channel */, static_cast<int>(offset),
+                      output->num_channels(), static_cast<int>(num_frames)) =
+      rotation_matrix *
+      input_matrix.block(0 /* first channel */, static_cast<int>(offset),
+                         input.num_channels(), static_cast<int>(num_frames));
 }
 
 }  // namespace
@@ -173,7 +316,9 @@ HoaRotator::HoaRotator(int ambisonic_order)
       rotation_matrices_(ambisonic_order_ + 1),
       rotation_matrix_(
           static_cast<int>(GetNumPeriphonicComponents(ambisonic_order)),
-          static_cast<int>(GetNumPeriphonicComponents(ambisonic_order))) {
+          static_cast<int>(GetNumPeriphonicComponents(ambisonic_order))),
+      band_rotation_coeffs_(ComputeBandRotationCoeffs(ambisonic_order)),
+      rotate_(GetRotateFunction(ambisonic_order)) {
   DCHECK_GE(ambisonic_order_, 2);
 
   // Initialize rotation sub-matrices.
@@ -209,25 +354,9 @@ bool HoaRotator::Process(const WorldRotation& target_rotation,
     return false;
   }
 
-  const size_t channel_stride = input.GetChannelStride();
-
-  typedef Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
-      RowMajorMatrixf;
-
-  const Eigen::Map<const RowMajorMatrixf, Eigen::Aligned, Eigen::OuterStride<>>
-      input_matrix(input[0].begin(), static_cast<int>(input.num_channels()),
-                   static_cast<int>(input.num_frames()),
-                   Eigen::OuterStride<>(static_cast<int>(channel_stride)));
-
-  Eigen::Map<RowMajorMatrixf, Eigen::Aligned, Eigen::OuterStride<>>
-      output_matrix((*output)[0].begin(),
-                    static_cast<int>(input.num_channels()),
-                    static_cast<int>(input.num_frames()),
-                    Eigen::OuterStride<>(static_cast<int>(channel_stride)));
-
   if (current_rotation_.AngularDifferenceRad(target_rotation) <
       kRotationQuantizationRad) {
-    output_matrix = rotation_matrix_ * input_matrix;
+    rotate_(rotation_matrix_, input, 0, input.num_frames(), output);
     return true;
   }
 
@@ -248,16 +377,32 @@ bool HoaRotator::Process(const WorldRotation& target_rotation,
                                        static_cast<float>(input.num_frames());
     UpdateRotationMatrix(
         current_rotation_.slerp(interpolation_factor, target_rotation));
-    output_matrix.block(0 /* first channel */, i, output->num_channels(),
-                        duration) =
-        rotation_matrix_ * input_matrix.block(0 /* first channel */, i,
-                                              input.num_channels(), duration);
+    rotate_(rotation_matrix_, input, i, duration, output);
   }
   current_rotation_ = target_rotation;
 
   return true;
 }
 
+HoaRotator::RotateFunction HoaRotator::GetRotateFunction(int ambisonic_order) {
+  switch (ambisonic_order) {
+    case 2:
+      return &RotateSoundField<2>;
+    case 3:
+      return &RotateSoundField<3>;
+    case 4:
+      return &RotateSoundField<4>;
+    case 5:
+      return &RotateSoundField<5>;
+    case 6:
+      return &RotateSoundField<6>;
+    case 7:
+      return &RotateSoundField<7>;
+    default:
+      return &RotateSoundField;
+  }
+}
+
 void HoaRotator::UpdateRotationMatrix(const WorldRotation& rotation) {
 
 
@@ -294,12 +439,15 @@ void HoaRotator::UpdateRotationMatrix(const WorldRotation& rotation) {
   // 0 | 0 0 0 | 0 0 0 0 0 | X X X X X X X
   // 0 | 0 0 0 | 0 0 0 0 0 | X X X X X X X
   //
+  const float* band_rotation_coeffs = band_rotation_coeffs_.data();
   for (int current_order = 2; current_order <= ambisonic_order_;
        ++current_order) {
-    ComputeBandRotation(current_order, &rotation_matrices_);
+    ComputeBandRotation(current_order, band_rotation_coeffs,
+                        &rotation_matrices_);
     const int index = current_order * current_order;
     const int size =
         static_cast<int>(GetNumNthOrderPeriphonicComponents(current_order));
+    band_rotation_coeffs += 3 * size * size;
     rotation_matrix_.block(index, index, size, size) =
         rotation_matrices_[current_order];
   }
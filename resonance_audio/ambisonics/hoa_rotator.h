@@ -45,6 +45,20 @@ class HoaRotator {
                AudioBuffer* output);
 
  private:
+  // Signature of the functions which apply the |rotation_matrix| to the frames
+  // [|offset|, |offset| + |num_frames|) of the |input| buffer.
+  typedef void (*RotateFunction)(const Eigen::MatrixXf& rotation_matrix,
+                                 const AudioBuffer& input, size_t offset,
+                                 size_t num_frames, AudioBuffer* output);
+
+  // Returns the function which rotates sound fields of the given order.
+  // Second and third order sound fields are rotated band by band with fixed
+  // size matrices, other orders use a dense dynamic size matrix.
+  //
+  // @param ambisonic_order Order of ambisonic sound field.
+  // @return Function rotating sound fields of |ambisonic_order|.
+  static RotateFunction GetRotateFunction(int ambisonic_order);
+
   // Updates the rotation matrix with using supplied WorldRotation.
   //
   // @param rotation World rotation.
@@ -62,6 +76,13 @@ class HoaRotator {
 
   // Final spherical harmonics rotation matrix.
   Eigen::MatrixXf rotation_matrix_;
+
+  // Coefficients of the recursive computation of the rotation sub-matrices,
+  // which only depend on the matrix element indices.
+  const std::vector<float> band_rotation_coeffs_;
+
+  // Applies |rotation_matrix_|, specialized on the order at construction.
+  const RotateFunction rotate_;
 };
 
 }  // namespace vraudio
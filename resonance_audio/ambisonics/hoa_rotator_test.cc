@@ -17,9 +17,11 @@ limitations under the License.
 #include "ambisonics/hoa_rotator.h"
 
 #include <algorithm>
+#include <cmath>
 
 #include "third_party/googletest/googletest/include/gtest/gtest.h"
 #include "ambisonics/ambisonic_codec_impl.h"
+#include "ambisonics/utils.h"
 #include "base/constants_and_types.h"
 #include "utils/planar_interleaved_conversion.h"
 
@@ -190,6 +192,56 @@ TEST_P(HoaAxesRotationTest, CompareWithExpectedAngleOddBufferSizes) {
                                         rotation_axis, expected_angle);
 }
 
+// Tests that the order specialized rotation of soundfields up to the maximum
+// supported order matches the lower order channels of the generic rotation of
+// a soundfield of a higher order, both inplace and out of place.
+TEST(HoaRotatorOrderTest, CompareSpecializedWithGenericRotation) {
+  const int kGenericAmbisonicOrder = kMaxSupportedAmbisonicOrder + 1;
+  const size_t kNumFrames = 2 * kSlerpFrameInterval + 3U;
+  const size_t num_generic_channels =
+      GetNumPeriphonicComponents(kGenericAmbisonicOrder);
+  AudioBuffer input(num_generic_channels, kNumFrames);
+  for (size_t channel = 0; channel < num_generic_channels; ++channel) {
+    for (size_t frame = 0; frame < kNumFrames; ++frame) {
+      input[channel][frame] =
+          std::sin(static_cast<float>(channel + 1) * static_cast<float>(frame));
+    }
+  }
+  const WorldRotation kRotations[] = {
+      WorldRotation(AngleAxisf(0.7f, WorldPosition(0.0f, 1.0f, 0.0f))),
+      WorldRotation(AngleAxisf(1.3f, WorldPosition(0.6f, 0.0f, 0.8f)))};
+
+  for (int ambisonic_order = 2; ambisonic_order <= kMaxSupportedAmbisonicOrder;
+       ++ambisonic_order) {
+    const size_t num_channels = GetNumPeriphonicComponents(ambisonic_order);
+    HoaRotator generic_rotator(kGenericAmbisonicOrder);
+    HoaRotator rotator(ambisonic_order);
+    HoaRotator inplace_rotator(ambisonic_order);
+    AudioBuffer generic_output(num_generic_channels, kNumFrames);
+    AudioBuffer order_input(num_channels, kNumFrames);
+    AudioBuffer output(num_channels, kNumFrames);
+    AudioBuffer inplace_output(num_channels, kNumFrames);
+    for (const auto& rotation : kRotations) {
+      for (size_t channel = 0; channel < num_channels; ++channel) {
+        order_input[channel] = input[channel];
+        inplace_output[channel] = input[channel];
+      }
+      EXPECT_TRUE(generic_rotator.Process(rotation, input, &generic_output));
+      EXPECT_TRUE(rotator.Process(rotation, order_input, &output));
+      EXPECT_TRUE(
+          inplace_rotator.Process(rotation, inplace_output, &inplace_output));
+      for (size_t channel = 0; channel < num_channels; ++channel) {
+        for (size_t frame = 0; frame < kNumFrames; ++frame) {
+          EXPECT_NEAR(generic_output[channel][frame], output[channel][frame],
+                      1e-5f);
+          EXPECT_NEAR(generic_output[channel][frame],
+                      inplace_output[channel][frame], 1e-5f);
+        }
+      }
+    }
+  }
+}
+
 INSTANTIATE_TEST_CASE_P(
     TestParameters, HoaAxesRotationTest,
     Values(TestParams({1.0f, 0.0f, 0.0f}, kXrotatedSourceAngle),
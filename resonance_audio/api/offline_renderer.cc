@@ -0,0 +1,56 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "api/offline_renderer.h"
+
+#include "base/constants_and_types.h"
+#include "base/logging.h"
+#include "dsp/fft_manager.h"
+#include "graph/offline_renderer_impl.h"
+
+namespace vraudio {
+
+const size_t OfflineRenderer::kDefaultFramesPerBlock;
+
+OfflineRenderer* OfflineRenderer::Create(size_t num_channels,
+                                         size_t frames_per_block,
+                                         int sample_rate_hz) {
+  return Create(num_channels, frames_per_block, sample_rate_hz,
+                ResonanceAudioApiOptions());
+}
+
+OfflineRenderer* OfflineRenderer::Create(
+    size_t num_channels, size_t frames_per_block, int sample_rate_hz,
+    const ResonanceAudioApiOptions& options) {
+  if (num_channels != kNumStereoChannels) {
+    LOG(ERROR) << "Only stereo output is supported";
+    return nullptr;
+  }
+  if (frames_per_block < FftManager::kMinFftSize ||
+      frames_per_block > kMaxSupportedNumFrames) {
+    LOG(ERROR) << "Block size must be in range [" << FftManager::kMinFftSize
+               << ", " << kMaxSupportedNumFrames << "]";
+    return nullptr;
+  }
+  if (sample_rate_hz <= 0) {
+    LOG(ERROR) << "Invalid sample rate: " << sample_rate_hz;
+    return nullptr;
+  }
+  return new OfflineRendererImpl(num_channels, frames_per_block,
+                                 sample_rate_hz, options);
+}
+
+}  // namespace vraudio
@@ -0,0 +1,172 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef RESONANCE_AUDIO_API_OFFLINE_RENDERER_H_
+#define RESONANCE_AUDIO_API_OFFLINE_RENDERER_H_
+
+#include "api/resonance_audio_api.h"
+
+namespace vraudio {
+
+// Renders complete source timelines faster than real-time. In contrast to the
+// callback driven |ResonanceAudioApi|, all source audio and all time-varying
+// parameters are known upfront: sources are registered with their whole audio
+// signal and a start frame on the output timeline, and parameters are given as
+// keyframes which are linearly interpolated (rotations are slerped). The
+// timeline is then rendered in large internal blocks, and the output is written
+// directly into the caller's buffers. |Render*| may be called repeatedly to
+// stream the output in chunks of arbitrary size.
+//
+// Each block is processed by a single pass of the rendering graph. Position and
+// rotation keyframe tracks are evaluated at the end of each block, and the
+// graph interpolates the source directions from the previous block across the
+// block. Volume keyframes are applied as sample accurate gain ramps to the
+// source audio and to the output, such that volume changes inside a block take
+// effect in time.
+//
+// Source audio passed to the renderer is *not* copied and must stay valid until
+// rendering has finished. This class is not thread-safe.
+class OfflineRenderer {
+ public:
+  // Default number of frames per internal processing block.
+  static const size_t kDefaultFramesPerBlock = 4096;
+
+  virtual ~OfflineRenderer() {}
+
+  // Factory method to create an |OfflineRenderer| instance with the default
+  // |ResonanceAudioApiOptions|. Caller must take ownership of returned
+  // instance and destroy it via operator delete.
+  //
+  // @param num_channels Number of channels of audio output.
+  // @param frames_per_block Number of frames per internal processing block.
+  //     Must not exceed |kMaxSupportedNumFrames|.
+  // @param sample_rate_hz Sample rate of source and output audio.
+  // @return |OfflineRenderer| instance, nullptr if creation fails.
+  static OfflineRenderer* Create(size_t num_channels, size_t frames_per_block,
+                                 int sample_rate_hz);
+
+  // Factory method to create an |OfflineRenderer| instance with the given
+  // |options|, e.g., to render up to fifth or seventh order Ambisonics. Caller
+  // must take ownership of returned instance and destroy it via operator
+  // delete.
+  //
+  // @param num_channels Number of channels of audio output.
+  // @param frames_per_block Number of frames per internal processing block.
+  //     Must not exceed |kMaxSupportedNumFrames|.
+  // @param sample_rate_hz Sample rate of source and output audio.
+  // @param options Reverb and Ambisonic rendering options.
+  // @return |OfflineRenderer| instance, nullptr if creation fails.
+  static OfflineRenderer* Create(size_t num_channels, size_t frames_per_block,
+                                 int sample_rate_hz,
+                                 const ResonanceAudioApiOptions& options);
+
+  // Returns the underlying |ResonanceAudioApi| instance which can be used to
+  // configure time-invariant properties, such as room effects, distance models
+  // or directivity patterns. Audio buffers must *not* be set or rendered via
+  // the returned instance.
+  //
+  // @return Underlying |ResonanceAudioApi| instance.
+  virtual ResonanceAudioApi* GetApi() = 0;
+
+  // Adds an ambisonic, stereo or sound object source whose interleaved or
+  // planar float audio starts at |start_frame| of the output timeline.
+  //
+  // @param audio Interleaved audio or array of pointers to planar audio.
+  // @param num_channels Number of channels of source audio.
+  // @param num_frames Number of frames of source audio.
+  // @param start_frame Output frame at which the source starts playing.
+  // @param rendering_mode Rendering mode of sound object source.
+  // @return Id of new source, |kInvalidSourceId| on failure.
+  virtual ResonanceAudioApi::SourceId AddAmbisonicSource(
+      const float* audio, size_t num_channels, size_t num_frames,
+      size_t start_frame) = 0;
+  virtual ResonanceAudioApi::SourceId AddAmbisonicSource(
+      const float* const* audio, size_t num_channels, size_t num_frames,
+      size_t start_frame) = 0;
+  virtual ResonanceAudioApi::SourceId AddStereoSource(
+      const float* audio, size_t num_channels, size_t num_frames,
+      size_t start_frame) = 0;
+  virtual ResonanceAudioApi::SourceId AddStereoSource(
+      const float* const* audio, size_t num_channels, size_t num_frames,
+      size_t start_frame) = 0;
+  virtual ResonanceAudioApi::SourceId AddSoundObjectSource(
+      const float* audio, size_t num_channels, size_t num_frames,
+      size_t start_frame, RenderingMode rendering_mode) = 0;
+  virtual ResonanceAudioApi::SourceId AddSoundObjectSource(
+      const float* const* audio, size_t num_channels, size_t num_frames,
+      size_t start_frame, RenderingMode rendering_mode) = 0;
+
+  // Adds keyframes for time-varying listener parameters. Values between two
+  // keyframes are interpolated, values before the first and after the last
+  // keyframe are held constant. Keyframes replace the corresponding values set
+  // via |GetApi|.
+  //
+  // @param frame Output frame of keyframe.
+  virtual void AddHeadPositionKeyframe(size_t frame, float x, float y,
+                                       float z) = 0;
+  virtual void AddHeadRotationKeyframe(size_t frame, float x, float y, float z,
+                                       float w) = 0;
+  virtual void AddMasterVolumeKeyframe(size_t frame, float volume) = 0;
+
+  // Adds keyframes for time-varying source parameters. See above.
+  //
+  // @param source_id Id of source.
+  // @param frame Output frame of keyframe.
+  virtual void AddSourcePositionKeyframe(ResonanceAudioApi::SourceId source_id,
+                                         size_t frame, float x, float y,
+                                         float z) = 0;
+  virtual void AddSourceRotationKeyframe(ResonanceAudioApi::SourceId source_id,
+                                         size_t frame, float x, float y,
+                                         float z, float w) = 0;
+  virtual void AddSourceVolumeKeyframe(ResonanceAudioApi::SourceId source_id,
+                                       size_t frame, float volume) = 0;
+
+  // Returns the end frame of the latest source on the timeline. Note that room
+  // effects may decay beyond this frame.
+  //
+  // @return Number of frames covered by the sources.
+  virtual size_t GetNumTimelineFrames() const = 0;
+
+  // Returns the current render position on the output timeline.
+  //
+  // @return Number of frames rendered so far.
+  virtual size_t GetNumRenderedFrames() const = 0;
+
+  // Renders the next |num_frames| frames of the timeline into an interleaved
+  // or planar float output buffer.
+  //
+  // @param num_channels Number of channels in output buffer.
+  // @param num_frames Number of frames to be rendered.
+  // @param buffer_ptr Output buffer.
+  // @return True on success, false otherwise.
+  virtual bool RenderInterleaved(size_t num_channels, size_t num_frames,
+                                 float* buffer_ptr) = 0;
+  virtual bool RenderPlanar(size_t num_channels, size_t num_frames,
+                            float* const* buffer_ptr) = 0;
+
+  // Prepares the renderer for a new timeline, which avoids the setup cost of
+  // a new instance, e.g., when rendering many short timelines. All sources and
+  // keyframes are removed, and the room effects and the remaining tails of the
+  // previous timeline are discarded.
+  // The listener pose, the master volume and the room properties are restored
+  // to their defaults, and room effects are enabled. Other properties set via
+  // |GetApi| are kept.
+  virtual void Reset() = 0;
+};
+
+}  // namespace vraudio
+
+#endif  // RESONANCE_AUDIO_API_OFFLINE_RENDERER_H_
@@ -27,4 +27,12 @@ extern "C" EXPORT_API ResonanceAudioApi* CreateResonanceAudioApi(
                                    sample_rate_hz);
 }
 
+extern "C" EXPORT_API ResonanceAudioApi* CreateResonanceAudioApiWithOptions(
+    size_t num_channels, size_t frames_per_buffer, int sample_rate_hz,
+    const ResonanceAudioApiOptions* options) {
+  DCHECK(options);
+  return new ResonanceAudioApiImpl(num_channels, frames_per_buffer,
+                                   sample_rate_hz, *options);
+}
+
 }  // namespace vraudio
@@ -53,6 +53,17 @@ enum RenderingMode {
   // render the corresponding room effects of given sound objects without the
   // direct spatialization.
   kRoomEffectsOnly,
+  // HRTF-based rendering using Fifth Order Ambisonics, decoded with spherical
+  // harmonic encoded HRIRs derived from a 42 point pentakis icosidodecahedron.
+  // Requires an instance which renders up to at least fifth order, see
+  // |ResonanceAudioApiOptions::max_ambisonic_order|.
+  kBinauralVeryHighQuality,
+  // HRTF-based rendering using Seventh Order Ambisonics, decoded with spherical
+  // harmonic encoded HRIRs derived from 114 points of the SADIE measurement
+  // grid. This gives the sharpest localization at the highest CPU cost.
+  // Requires an instance which renders up to seventh order, see
+  // |ResonanceAudioApiOptions::max_ambisonic_order|.
+  kBinauralUltraHighQuality,
 };
 
 // Distance rolloff models used for distance attenuation.
@@ -67,6 +78,59 @@ enum DistanceRolloffModel {
   kNone,
 };
 
+// Reverb quality tiers define CPU load / reverb quality balances.
+// Note that this enum is C-compatible by design to be used across external
+// C/C++ and C# implementations.
+enum ReverbQuality {
+  // Spectral reverb using a 4096 point FFT with four overlaps.
+  kReverbHighQuality = 0,
+  // Spectral reverb using a 2048 point FFT with two overlaps. This roughly
+  // halves the reverb processing cost at the expense of a coarser frequency
+  // resolution, e.g., for mobile devices.
+  kReverbLowQuality,
+};
+
+// Reverb algorithms used to render the late reverberation.
+// Note that this enum is C-compatible by design to be used across external
+// C/C++ and C# implementations.
+enum ReverbAlgorithm {
+  // Spectral reverb, whose FFT size is given by the |ReverbQuality| tier.
+  kReverbSpectral = 0,
+  // Feedback delay network reverb with a small constant per sample cost and
+  // absorption in three frequency band groups, e.g., for low latency
+  // applications with small buffer sizes.
+  kReverbFeedbackDelayNetwork,
+};
+
+// Options of a |ResonanceAudioApi| instance which are fixed at construction,
+// see |CreateResonanceAudioApiWithOptions|.
+// Note that this struct is C-compatible by design to be used across external
+// C/C++ and C# implementations.
+struct ResonanceAudioApiOptions {
+  // Default constructor initializing all data members to the defaults of
+  // |CreateResonanceAudioApi|.
+  ResonanceAudioApiOptions()
+      : reverb_algorithm(kReverbSpectral),
+        reverb_quality(kReverbHighQuality),
+        max_ambisonic_order(3) {}
+
+  // Reverb algorithm used to render the late reverberation.
+  ReverbAlgorithm reverb_algorithm;
+
+  // Reverb quality tier of the spectral reverb. Ignored by the other
+  // algorithms.
+  ReverbQuality reverb_quality;
+
+  // Maximum Ambisonic order to be rendered, i.e. 3, 5 or 7. Other orders are
+  // rounded down to the closest one of them. By default, sound objects and
+  // soundfields are rendered up to third order, and the
+  // |kBinauralVeryHighQuality| and |kBinauralUltraHighQuality| modes fall back
+  // to third order. Opting in to fifth or seventh order enables these modes,
+  // but also sizes all Ambisonic mixing, rotation and decoding stages for the
+  // higher order.
+  int max_ambisonic_order;
+};
+
 // Early reflection properties of an acoustic environment.
 // Note that this struct is C-compatible by design to be used across external
 // C/C++ and C# implementations.
@@ -78,7 +142,8 @@ struct ReflectionProperties {
         room_dimensions{0.0f, 0.0f, 0.0f},
         cutoff_frequency(0.0f),
         coefficients{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
-        gain(0.0f) {}
+        gain(0.0f),
+        reflection_order(1) {}
 
   // Center position of the shoebox room in world space.
   float room_position[3];
@@ -103,6 +168,12 @@ struct ReflectionProperties {
 
   // Uniform reflections gain which is applied to all reflections.
   float gain;
+
+  // Maximum number of wall bounces of the rendered image sources. Higher orders
+  // add denser early reflections which are also encoded at a higher ambisonic
+  // order. Values are clamped to [1, 3] and to the maximum ambisonic order of
+  // the rendering graph.
+  int reflection_order;
 };
 
 // Late reverberation properties of an acoustic environment.
@@ -122,10 +193,99 @@ struct ReverbProperties {
   float gain;
 };
 
+// Processing time statistics of an audio graph node or node type, see
+// |ResonanceAudioApi::GetNodeProcessingStats|.
+// Note that this struct is C-compatible by design to be used across external
+// C/C++ and C# implementations.
+struct NodeProcessingStats {
+  // Node type name, e.g. "ReverbNode". The string is owned by the
+  // |ResonanceAudioApi| instance and remains valid until the next
+  // |GetNodeProcessingStats| call.
+  const char* node_type;
+
+  // Id of the node, or 0 if the stats are aggregated per node type or over
+  // nodes that have been retired from the per-node stats.
+  size_t node_id;
+
+  // Number of nodes that contributed to the stats.
+  size_t num_nodes;
+
+  // Number of processing calls.
+  uint64_t num_calls;
+
+  // Accumulated number of input buffers over all processing calls.
+  uint64_t num_inputs;
+
+  // Accumulated processing time in milliseconds.
+  double total_time_ms;
+
+  // Processing time of the slowest call in milliseconds.
+  double max_time_ms;
+};
+
+// Number of bins of |BufferTimingStats::load_histogram|.
+const size_t kNumBufferLoadHistogramBins = 21;
+
+// Width of a |BufferTimingStats::load_histogram| bin in percent of the
+// real-time budget.
+const size_t kBufferLoadHistogramBinPercent = 10;
+
+// Maximum number of |BufferTimingStats::worst_buffers|.
+const size_t kMaxNumWorstBufferRecords = 8;
+
+// Processing state of a single audio buffer.
+// Note that this struct is C-compatible by design to be used across external
+// C/C++ and C# implementations.
+struct BufferTimingRecord {
+  // Index of the buffer, counted from construction.
+  uint64_t buffer_index;
+
+  // Processing time in milliseconds.
+  double processing_time_ms;
+
+  // Number of sources that produced input during processing. Sources that did
+  // not receive an input buffer for this buffer are not counted.
+  size_t num_sources;
+
+  // True if room effects were enabled during processing.
+  bool room_effects_enabled;
+};
+
+// Processing times of audio buffers relative to their real-time budget of
+// |frames_per_buffer| / |sample_rate_hz|, see
+// |ResonanceAudioApi::GetBufferTimingStats|.
+// Note that this struct is C-compatible by design to be used across external
+// C/C++ and C# implementations.
+struct BufferTimingStats {
+  // Real-time budget of a buffer in milliseconds.
+  double budget_ms;
+
+  // Number of processed buffers.
+  uint64_t num_buffers;
+
+  // Number of buffers whose processing time exceeded the budget.
+  uint64_t num_deadline_overruns;
+
+  // Accumulated processing time of all buffers in milliseconds.
+  double total_processing_time_ms;
+
+  // Histogram of the processing time in percent of the budget. Bin |i| counts
+  // the buffers with a load in [i, i + 1) * |kBufferLoadHistogramBinPercent|,
+  // the last bin also counts all buffers above its range.
+  uint64_t load_histogram[kNumBufferLoadHistogramBins];
+
+  // Number of valid entries in |worst_buffers|.
+  size_t num_worst_buffers;
+
+  // Slowest buffers, sorted by descending processing time.
+  BufferTimingRecord worst_buffers[kMaxNumWorstBufferRecords];
+};
+
 class ResonanceAudioApi;
 
-// Factory method to create a |ResonanceAudioApi| instance. Caller must
-// take ownership of returned instance and destroy it via operator delete.
+// Factory method to create a |ResonanceAudioApi| instance with the default
+// |ResonanceAudioApiOptions|. Caller must take ownership of returned instance
+// and destroy it via operator delete.
 //
 // @param num_channels Number of channels of audio output.
 // @param frames_per_buffer Number of frames per buffer.
@@ -133,6 +293,19 @@ class ResonanceAudioApi;
 extern "C" EXPORT_API ResonanceAudioApi* CreateResonanceAudioApi(
     size_t num_channels, size_t frames_per_buffer, int sample_rate_hz);
 
+// Factory method to create a |ResonanceAudioApi| instance with the given
+// |options|. Caller must take ownership of returned instance and destroy it
+// via operator delete.
+//
+// @param num_channels Number of channels of audio output.
+// @param frames_per_buffer Number of frames per buffer.
+// @param sample_rate_hz System sample rate.
+// @param options Reverb and Ambisonic rendering options, see
+//     |ResonanceAudioApiOptions|.
+extern "C" EXPORT_API ResonanceAudioApi* CreateResonanceAudioApiWithOptions(
+    size_t num_channels, size_t frames_per_buffer, int sample_rate_hz,
+    const ResonanceAudioApiOptions* options);
+
 // The ResonanceAudioApi library renders high-quality spatial audio. It provides
 // methods to binaurally render virtual sound sources with simulated room
 // acoustics. In addition, it supports decoding and binaural rendering of
@@ -148,8 +321,27 @@ class ResonanceAudioApi {
   // class construction.
   static const SourceId kInvalidSourceId = -1;
 
+  // Room zone identifier.
+  typedef int RoomZoneId;
+
+  // Room zone which exists from construction, which all sources are routed to
+  // by default and which is controlled by |SetReflectionProperties| and
+  // |SetReverbProperties|.
+  static const RoomZoneId kDefaultRoomZoneId = 0;
+
+  // Invalid room zone id.
+  static const RoomZoneId kInvalidRoomZoneId = -1;
+
   virtual ~ResonanceAudioApi() {}
 
+  // Note on buffer sizes: All |Fill*OutputBuffer|, |SetInterleavedBuffer| and
+  // |SetPlanarBuffer| calls accept an arbitrary number of frames, as long as
+  // the input buffers of all sources and the following output buffer request
+  // have the same size. Buffers that match the |frames_per_buffer| specified
+  // during construction are processed without any additional copy or latency.
+  // Other buffer sizes are internally re-blocked into |frames_per_buffer|
+  // sized buffers, which may add latency, see |GetLatencyFrames|.
+
   // Renders and outputs an interleaved output buffer in float format.
   //
   // @param num_frames Size of output buffer in frames.
@@ -190,6 +382,18 @@ class ResonanceAudioApi {
   virtual bool FillPlanarOutputBuffer(size_t num_channels, size_t num_frames,
                                       int16* const* buffer_ptr) = 0;
 
+  // Returns the latency in frames that is added by internally re-blocking
+  // input and output buffers whose size differs from |frames_per_buffer|. The
+  // latency is zero as long as all buffer sizes are multiples of
+  // |frames_per_buffer|. Otherwise it is |frames_per_buffer| minus the greatest
+  // common divisor of |frames_per_buffer| and all buffer sizes seen so far,
+  // i.e., it may grow when a host changes its buffer size. Audio that is
+  // already queued is kept in that case, and a silent gap of the added latency
+  // separates it from subsequent audio. This method is thread-safe.
+  //
+  // @return Latency in frames between input and output audio.
+  virtual size_t GetLatencyFrames() const = 0;
+
   // Sets listener's head position.
   //
   // @param x X coordinate of head position in world space.
@@ -288,6 +492,17 @@ class ResonanceAudioApi {
                                const int16* const* audio_buffer_ptr,
                                size_t num_channels, size_t num_frames) = 0;
 
+  // Sets the sample rate of the audio buffers passed to a sound source. By
+  // default, sources are expected to match the system sample rate. Buffers of
+  // sources at a different sample rate may have an arbitrary number of frames,
+  // which should on average cover the duration of the output buffers. They are
+  // re-blocked and resampled inside the audio graph, which adds a latency of
+  // |frames_per_buffer| frames at the system sample rate.
+  //
+  // @param source_id Id of sound source.
+  // @param sample_rate_hz Sample rate of the source audio buffers.
+  virtual void SetSourceSampleRate(SourceId source_id, int sample_rate_hz) = 0;
+
   // Sets the given source's distance attenuation value explicitly. The distance
   // rolloff model of the source must be set to |DistanceRolloffModel::kNone|
   // for the set value to take effect.
@@ -329,6 +544,19 @@ class ResonanceAudioApi {
   virtual void SetSourceRoomEffectsGain(SourceId source_id,
                                         float room_effects_gain) = 0;
 
+  // Sets the send gain of the given source into a room zone. Each source is
+  // routed into the default room zone with unit gain and into no other zone
+  // unless specified otherwise. The send gain is applied on top of the room
+  // effects gain.
+  //
+  // @param source_id Id of source.
+  // @param room_zone_id Id of room zone.
+  // @param send_gain Linear send gain in amplitude, zero to remove the source
+  //     from the room zone.
+  virtual void SetSourceRoomZoneSendGain(SourceId source_id,
+                                         RoomZoneId room_zone_id,
+                                         float send_gain) = 0;
+
   // Sets the given source's rotation.
   //
   // @param source_id Id of source.
@@ -387,6 +615,31 @@ class ResonanceAudioApi {
   virtual void SetSoundObjectOcclusionIntensity(SourceId sound_object_source_id,
                                                 float intensity) = 0;
 
+  // Turns on/off the propagation delay of the given sound object source. When
+  // enabled, the source is delayed by its distance to the listener divided by
+  // the speed of sound. The delay follows the source and listener movements
+  // smoothly, which results in a Doppler shift, consistent with the timing of
+  // the room reflections. Disabled by default.
+  //
+  // @param sound_object_source_id Id of sound object source.
+  // @param enabled True to enable the propagation delay.
+  virtual void SetSoundObjectPropagationDelayEnabled(
+      SourceId sound_object_source_id, bool enabled) = 0;
+
+  // Turns on/off the clustering of the given sound object source. Distant
+  // sources with clustering enabled that are heard from similar directions,
+  // e.g. the members of a crowd, are mixed together and encoded once at their
+  // centroid. Their distance attenuation is applied while mixing them, and
+  // their occlusion and directivity are not rendered, such that the cost per
+  // clustered source stays flat with large numbers of sources. Their room
+  // effects are unchanged. Only sources rendered binaurally can be clustered.
+  // Disabled by default.
+  //
+  // @param sound_object_source_id Id of sound object source.
+  // @param enabled True to enable the clustering.
+  virtual void SetSoundObjectClusteringEnabled(SourceId sound_object_source_id,
+                                               bool enabled) = 0;
+
   // Sets the given sound object source's spread.
   //
   // @param sound_object_source_id Id of sound object source.
@@ -408,6 +661,77 @@ class ResonanceAudioApi {
   // @param reverb_properties Reverb properties.
   virtual void SetReverbProperties(
       const ReverbProperties& reverb_properties) = 0;
+
+  // Creates a room zone with its own early reflections and late reverberation.
+  // Room zones render concurrently, e.g. to model adjacent rooms, and are
+  // skipped entirely while no source is sending into them. The properties of
+  // a new zone are initialized to the defaults, which disable its effects.
+  //
+  // @return Id of the new room zone, or |kInvalidRoomZoneId| if the maximum
+  //     number of room zones is reached.
+  virtual RoomZoneId CreateRoomZone() = 0;
+
+  // Destroys a room zone created with |CreateRoomZone| and removes all sends
+  // into it. The default room zone cannot be destroyed.
+  //
+  // @param room_zone_id Id of room zone to be destroyed.
+  virtual void DestroyRoomZone(RoomZoneId room_zone_id) = 0;
+
+  // Sets the early reflection properties of a room zone.
+  //
+  // @param room_zone_id Id of room zone.
+  // @param reflection_properties Reflection properties.
+  virtual void SetRoomZoneReflectionProperties(
+      RoomZoneId room_zone_id,
+      const ReflectionProperties& reflection_properties) = 0;
+
+  // Sets the late reverberation properties of a room zone.
+  //
+  // @param room_zone_id Id of room zone.
+  // @param reverb_properties Reverb properties.
+  virtual void SetRoomZoneReverbProperties(
+      RoomZoneId room_zone_id, const ReverbProperties& reverb_properties) = 0;
+
+  // Returns a snapshot of the buffer processing times accumulated since
+  // construction or the last |ResetBufferTimingStats| call. This method is
+  // thread-safe and non-blocking. Note that counters which are updated while
+  // the snapshot is taken may be off by one buffer with respect to each
+  // other.
+  //
+  // @param stats Output buffer timing stats.
+  virtual void GetBufferTimingStats(BufferTimingStats* stats) const = 0;
+
+  // Clears the buffer timing stats.
+  virtual void ResetBufferTimingStats() = 0;
+
+  // Note on node processing stats: The processing time of each audio graph
+  // node is only measured if the library is built with
+  // |ENABLE_NODE_PROFILING|. Otherwise, no stats are returned and no trace is
+  // written. The following methods may be called from any thread, but not
+  // concurrently with each other.
+
+  // Returns the processing time stats of the audio graph nodes accumulated
+  // since construction or the last |ResetNodeProcessingStats| call, sorted by
+  // descending total processing time.
+  //
+  // @param aggregate_by_type True to return one entry per node type (e.g. all
+  //     |ReverbNode|s), false to return one entry per node.
+  // @param stats Output array, may be nullptr to query the number of entries.
+  // @param max_num_stats Size of |stats|.
+  // @return Number of available entries, which may exceed |max_num_stats|.
+  virtual size_t GetNodeProcessingStats(bool aggregate_by_type,
+                                        NodeProcessingStats* stats,
+                                        size_t max_num_stats) = 0;
+
+  // Clears the node processing stats and trace events.
+  virtual void ResetNodeProcessingStats() = 0;
+
+  // Writes the most recent node processing calls as a Chrome trace event JSON
+  // file, which can be loaded into chrome://tracing or Perfetto.
+  //
+  // @param file_path Path of the trace file.
+  // @return False if profiling is disabled or the file cannot be written.
+  virtual bool WriteNodeProcessingTrace(const char* file_path) = 0;
 };
 
 }  // namespace vraudio
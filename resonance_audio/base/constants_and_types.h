@@ -30,18 +30,35 @@ typedef int SourceId;
 // class construction.
 static const SourceId kInvalidSourceId = -1;
 
+// Room zone identifier.
+typedef int RoomZoneId;
+
+// Room zone which all sources are routed to by default, and which is
+// controlled by the global reflection and reverb properties.
+static const RoomZoneId kDefaultRoomZoneId = 0;
+
+// Invalid room zone id.
+static const RoomZoneId kInvalidRoomZoneId = -1;
+
+// Maximum number of concurrent room zones, including the default zone.
+static const size_t kMaxNumRoomZones = 8;
+
 
 // Defines memory alignment of audio buffers. Note that not only the first
 // element of the |data_| buffer is memory aligned but also the address of the
 // first elements of the |ChannelView|s.
 const size_t kMemoryAlignmentBytes = 64;
 
-// Maximum Ambisonic order currently supported in vr audio, equivalent to High
-// Quality sound object rendering mode. This number is limited by a) number of
-// HRIR data points used in the binaural renderer; b) size of the lookup table
-// controlling the angular spread of a sound source in the Ambisonic Lookup
-// Table class.
-static const int kMaxSupportedAmbisonicOrder = 3;
+// Maximum Ambisonic order currently supported in vr audio, equivalent to Ultra
+// High Quality sound object rendering mode. This number is limited by the
+// number of HRIR data points used in the binaural renderer.
+static const int kMaxSupportedAmbisonicOrder = 7;
+
+// Maximum Ambisonic order rendered unless a higher order is requested at
+// construction, equivalent to High Quality sound object rendering mode. All
+// Ambisonic mixers, rotators and output buffers are sized for the maximum
+// rendered order.
+static const int kDefaultMaxAmbisonicOrder = 3;
 
 // Maximum allowed size of internal buffers.
 const size_t kMaxSupportedNumFrames = 16384;
@@ -132,6 +149,9 @@ const float kOctaveBandCentres[kNumReverbOctaveBands] = {
 // Number of surfaces in a shoe-box room.
 static const size_t kNumRoomSurfaces = 6;
 
+// Maximum supported image source order of the shoe-box room reflections.
+static const int kMaxReflectionOrder = 3;
+
 // Speed of sound in air at 20 degrees Celsius in meters per second.
 // http://www.sengpielaudio.com/calculator-speedsound.htm
 static const float kSpeedOfSound = 343.0f;
@@ -162,6 +182,14 @@ static const float kMinNearFieldDistance = 0.1f;
 // Maximum gain applied by Near Field Effect to the mono source signal.
 static const float kMaxNearFieldEffectGain = 9.0f;
 
+// Maximum number of clusters into which the distant sound objects with
+// clustering enabled are grouped, per Ambisonic order.
+static const size_t kMaxNumSourceClusters = 16;
+
+// Minimum distance from the listener in meters for a sound object to be
+// clustered. Closer sources are always encoded individually.
+static const float kMinSourceClusteringDistance = 4.0f;
+
 // Number of samples across which the gain value should be interpolated for
 // a unit gain change of 1.0f.
 
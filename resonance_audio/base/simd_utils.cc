@@ -29,6 +29,9 @@ limitations under the License.
 #include "base/misc_math.h"
 #include "base/simd_macros.h"
 
+#if defined(SIMD_SSE)
+#include <emmintrin.h>
+#endif  // defined(SIMD_SSE)
 
 namespace vraudio {
 
@@ -47,6 +50,16 @@ const float kInt16Min = static_cast<float>(-0x7FFF);
 const float kFloatFromInt16 = 1.0f / kInt16Max;
 const float kInt16FromFloat = kInt16Max;
 
+// Conversion factors from 24 and 32 bit ints to float, which map the largest
+// positive integer to 1.0f like |kFloatFromInt16|. 24 bit samples are
+// converted in the upper 24 bits of a 32 bit int in order to preserve the sign.
+const float kFloatFromInt24 =
+    1.0f / (static_cast<float>(0x7FFFFF) * static_cast<float>(1 << 8));
+const float kFloatFromInt32 = 1.0f / static_cast<float>(0x7FFFFFFF);
+
+// Number of bytes per 24 bit int.
+const size_t kNumBytesPerInt24 = 3;
+
 // Expected SIMD alignment in bytes.
 const size_t kSimdSizeBytes = 16;
 
@@ -414,6 +427,52 @@ void ScalarMultiplyAndAccumulate(size_t length, float gain, const float* input,
   }
 }
 
+float DotProduct(size_t length, const float* input_a, const float* input_b) {
+  DCHECK(input_a);
+  DCHECK(input_b);
+
+  const size_t num_chunks = GetNumChunks(length);
+  float dot_product = 0.0f;
+#if defined(SIMD_SSE)
+  SimdVector accumulator_vector = _mm_setzero_ps();
+  for (size_t i = 0; i < num_chunks; ++i) {
+    const SimdVector input_a_temp = _mm_loadu_ps(&input_a[i * SIMD_LENGTH]);
+    const SimdVector input_b_temp = _mm_loadu_ps(&input_b[i * SIMD_LENGTH]);
+    accumulator_vector =
+        SIMD_MULTIPLY_ADD(input_a_temp, input_b_temp, accumulator_vector);
+  }
+  float partial_sums[SIMD_LENGTH];
+  _mm_storeu_ps(partial_sums, accumulator_vector);
+  dot_product = (partial_sums[0] + partial_sums[1]) +
+                (partial_sums[2] + partial_sums[3]);
+#elif defined(SIMD_NEON)
+  SimdVector accumulator_vector = vdupq_n_f32(0.0f);
+  for (size_t i = 0; i < num_chunks; ++i) {
+    const SimdVector input_a_temp = vld1q_f32(&input_a[i * SIMD_LENGTH]);
+    const SimdVector input_b_temp = vld1q_f32(&input_b[i * SIMD_LENGTH]);
+    accumulator_vector =
+        SIMD_MULTIPLY_ADD(input_a_temp, input_b_temp, accumulator_vector);
+  }
+  float partial_sums[SIMD_LENGTH];
+  vst1q_f32(partial_sums, accumulator_vector);
+  dot_product = (partial_sums[0] + partial_sums[1]) +
+                (partial_sums[2] + partial_sums[3]);
+#else
+  for (size_t i = 0; i < num_chunks; ++i) {
+    dot_product += input_a[i] * input_b[i];
+  }
+#endif  // SIMD_SSE
+
+  // Accumulate the products of samples at the end that were missed by the SIMD
+  // chunking.
+  const size_t leftover_samples = GetLeftoverSamples(length);
+  DCHECK_GE(length, leftover_samples);
+  for (size_t i = length - leftover_samples; i < length; ++i) {
+    dot_product += input_a[i] * input_b[i];
+  }
+  return dot_product;
+}
+
 void ReciprocalSqrt(size_t length, const float* input, float* output) {
   DCHECK(input);
   DCHECK(output);
@@ -955,6 +1014,108 @@ void FloatFromInt16(size_t length, const int16_t* input, float* output) {
 
 #endif  // SIMD_NEON
 
+void FloatFromInt24(size_t length, const uint8_t* input, float* output) {
+  DCHECK(input);
+  DCHECK(output);
+
+  size_t num_simd_samples = 0;
+#if defined(SIMD_NEON)
+  // Loads eight samples at a time, deinterleaved into their three bytes.
+  const size_t kNumSamplesPerLoad = 2 * SIMD_LENGTH;
+  num_simd_samples = length - length % kNumSamplesPerLoad;
+  const SimdVector scaling_vector = SIMD_LOAD_ONE_FLOAT(kFloatFromInt24);
+  for (size_t i = 0; i < num_simd_samples; i += kNumSamplesPerLoad) {
+    const uint8x8x3_t bytes = vld3_u8(input + i * kNumBytesPerInt24);
+    const uint16x8_t low_bytes = vmovl_u8(bytes.val[0]);
+    const uint16x8_t middle_bytes = vmovl_u8(bytes.val[1]);
+    const uint16x8_t high_bytes = vmovl_u8(bytes.val[2]);
+    // Assembles the samples in the upper 24 bits of 32 bit ints.
+    const uint32x4_t first_samples = vorrq_u32(
+        vorrq_u32(vshll_n_u16(vget_low_u16(low_bytes), 8),
+                  vshlq_n_u32(vmovl_u16(vget_low_u16(middle_bytes)), 16)),
+        vshlq_n_u32(vmovl_u16(vget_low_u16(high_bytes)), 24));
+    const uint32x4_t second_samples = vorrq_u32(
+        vorrq_u32(vshll_n_u16(vget_high_u16(low_bytes), 8),
+                  vshlq_n_u32(vmovl_u16(vget_high_u16(middle_bytes)), 16)),
+        vshlq_n_u32(vmovl_u16(vget_high_u16(high_bytes)), 24));
+    vst1q_f32(output + i,
+              SIMD_MULTIPLY(scaling_vector,
+                            vcvtq_f32_s32(vreinterpretq_s32_u32(
+                                first_samples))));
+    vst1q_f32(output + i + SIMD_LENGTH,
+              SIMD_MULTIPLY(scaling_vector,
+                            vcvtq_f32_s32(vreinterpretq_s32_u32(
+                                second_samples))));
+  }
+#elif defined(SIMD_SSE)
+  // Loads 16 bytes of which the first twelve hold four samples, so the last
+  // samples are left to the scalar loop in order not to read past the input.
+  const size_t kNumSamplesPerLoad = SIMD_LENGTH;
+  const size_t kNumBytesPerLoad = 16;
+  if (length * kNumBytesPerInt24 >= kNumBytesPerLoad) {
+    num_simd_samples =
+        (length * kNumBytesPerInt24 - kNumBytesPerLoad) /
+            (kNumSamplesPerLoad * kNumBytesPerInt24) * kNumSamplesPerLoad +
+        kNumSamplesPerLoad;
+  }
+  const SimdVector scaling_vector = SIMD_LOAD_ONE_FLOAT(kFloatFromInt24);
+  for (size_t i = 0; i < num_simd_samples; i += kNumSamplesPerLoad) {
+    const __m128i bytes = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(input + i * kNumBytesPerInt24));
+    // Moves each sample into the lowest 32 bit lane of its own vector and
+    // shifts it into the upper 24 bits of the lane.
+    const __m128i first = _mm_slli_epi32(bytes, 8);
+    const __m128i second = _mm_slli_epi32(_mm_srli_si128(bytes, 3), 8);
+    const __m128i third = _mm_slli_epi32(_mm_srli_si128(bytes, 6), 8);
+    const __m128i fourth = _mm_slli_epi32(_mm_srli_si128(bytes, 9), 8);
+    const __m128i samples = _mm_unpacklo_epi64(
+        _mm_unpacklo_epi32(first, second), _mm_unpacklo_epi32(third, fourth));
+    _mm_storeu_ps(output + i,
+                  SIMD_MULTIPLY(scaling_vector, _mm_cvtepi32_ps(samples)));
+  }
+#endif  // SIMD_NEON
+
+  // The remainder.
+  input += num_simd_samples * kNumBytesPerInt24;
+  for (size_t i = num_simd_samples; i < length;
+       ++i, input += kNumBytesPerInt24) {
+    const int32_t sample = static_cast<int32_t>(
+        (static_cast<uint32_t>(input[0]) << 8) |
+        (static_cast<uint32_t>(input[1]) << 16) |
+        (static_cast<uint32_t>(input[2]) << 24));
+    output[i] = static_cast<float>(sample) * kFloatFromInt24;
+  }
+}
+
+void FloatFromInt32(size_t length, const int32_t* input, float* output) {
+  DCHECK(input);
+  DCHECK(output);
+
+  size_t num_simd_samples = 0;
+#if defined(SIMD_NEON)
+  num_simd_samples = length - GetLeftoverSamples(length);
+  const SimdVector scaling_vector = SIMD_LOAD_ONE_FLOAT(kFloatFromInt32);
+  for (size_t i = 0; i < num_simd_samples; i += SIMD_LENGTH) {
+    vst1q_f32(output + i, SIMD_MULTIPLY(scaling_vector,
+                                        vcvtq_f32_s32(vld1q_s32(input + i))));
+  }
+#elif defined(SIMD_SSE)
+  num_simd_samples = length - GetLeftoverSamples(length);
+  const SimdVector scaling_vector = SIMD_LOAD_ONE_FLOAT(kFloatFromInt32);
+  for (size_t i = 0; i < num_simd_samples; i += SIMD_LENGTH) {
+    const __m128i samples =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+    _mm_storeu_ps(output + i,
+                  SIMD_MULTIPLY(scaling_vector, _mm_cvtepi32_ps(samples)));
+  }
+#endif  // SIMD_NEON
+
+  // The remainder.
+  for (size_t i = num_simd_samples; i < length; ++i) {
+    output[i] = static_cast<float>(input[i]) * kFloatFromInt32;
+  }
+}
+
 void InterleaveStereo(size_t length, const int16_t* channel_0,
                       const int16_t* channel_1, int16_t* interleaved_buffer) {
   DCHECK(interleaved_buffer);
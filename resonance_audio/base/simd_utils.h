@@ -98,6 +98,15 @@ void ScalarMultiply(size_t length, float gain, const float* input,
 void ScalarMultiplyAndAccumulate(size_t length, float gain, const float* input,
                                  float* accumulator);
 
+// Calculates the dot product of two float arrays. The arrays need not be
+// aligned.
+//
+// @param length Number of floats.
+// @param input_a Pointer to the first float in input_a array.
+// @param input_b Pointer to the first float in input_b array.
+// @return Sum of the pointwise products of |input_a| and |input_b|.
+float DotProduct(size_t length, const float* input_a, const float* input_b);
+
 // Calculates an approximmate reciprocal square root.
 //
 // @param length Number of floats.
@@ -170,6 +179,24 @@ void Int16FromFloat(size_t length, const float* input, int16_t* output);
 // @param output Float array.
 void FloatFromInt16(size_t length, const int16_t* input, float* output);
 
+// Converts an array of little-endian packed 24 bit int input to 32 bit float
+// output. As for 16 bit input, the largest positive integer maps to 1.0f.
+//
+// @param length Number of 24 bit ints in the input array and floats in the
+//     output.
+// @param input Byte array of |3 * length| bytes.
+// @param output Float array.
+void FloatFromInt24(size_t length, const uint8_t* input, float* output);
+
+// Converts an array of 32 bit int input to 32 bit float output. As for 16 bit
+// input, the largest positive integer maps to 1.0f.
+//
+// @param length Number of int32_ts in the input array and floats in the
+//     output.
+// @param input Int array.
+// @param output Float array.
+void FloatFromInt32(size_t length, const int32_t* input, float* output);
+
 // Interleaves a pair of mono buffers of int_16 data into a stereo buffer.
 //
 // @param length Number of frames per mono channel. The interleaved buffer must
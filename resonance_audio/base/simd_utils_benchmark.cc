@@ -0,0 +1,367 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "base/simd_utils.h"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "base/audio_buffer.h"
+#include "utils/benchmark_util.h"
+
+namespace vraudio {
+
+namespace {
+
+// Number of planar channels, enough for the quad (de)interleaving kernels.
+const size_t kNumPlanarChannels = 4;
+
+// Aligned planar and interleaved buffers for a given number of frames. The
+// interleaved buffers can hold |kNumPlanarChannels| interleaved channels, and
+// the quad workspace buffers are five times the number of frames long, as
+// required by |InterleaveQuad| and |DeinterleaveQuad|.
+struct SimdBuffers {
+  explicit SimdBuffers(size_t num_frames)
+      : num_frames(num_frames),
+        planar_input(kNumPlanarChannels, num_frames),
+        planar_output(kNumPlanarChannels, num_frames),
+        magnitude(1, num_frames),
+        interleaved(1, kNumPlanarChannels * num_frames),
+        workspace(1, 5 * num_frames),
+        planar_input_int16(kNumPlanarChannels,
+                           AudioBuffer::AlignedInt16Vector(num_frames)),
+        planar_output_int16(kNumPlanarChannels,
+                            AudioBuffer::AlignedInt16Vector(num_frames)),
+        interleaved_int16(kNumPlanarChannels * num_frames),
+        workspace_int16(5 * num_frames) {
+    FillWithNoise(&planar_input);
+    FillWithNoise(&interleaved);
+    planar_output.Clear();
+    for (size_t i = 0; i < num_frames; ++i) {
+      magnitude[0][i] = std::abs(planar_input[0][i]);
+    }
+    for (auto& channel : planar_input_int16) {
+      Int16FromFloat(num_frames, planar_input[0].begin(), channel.data());
+    }
+    for (size_t i = 0; i < interleaved_int16.size(); ++i) {
+      interleaved_int16[i] = static_cast<int16_t>(i);
+    }
+  }
+
+  // Returns a pointer to a float input channel.
+  const float* in(size_t channel) const {
+    return planar_input[channel].begin();
+  }
+
+  // Returns a pointer to a float output channel.
+  float* out(size_t channel) { return planar_output[channel].begin(); }
+
+  const size_t num_frames;
+  AudioBuffer planar_input;
+  AudioBuffer planar_output;
+  // Non-negative input for the square root kernels.
+  AudioBuffer magnitude;
+  AudioBuffer interleaved;
+  AudioBuffer workspace;
+  std::vector<AudioBuffer::AlignedInt16Vector> planar_input_int16;
+  std::vector<AudioBuffer::AlignedInt16Vector> planar_output_int16;
+  AudioBuffer::AlignedInt16Vector interleaved_int16;
+  AudioBuffer::AlignedInt16Vector workspace_int16;
+};
+
+void BM_AddPointwise(benchmark::State& state) {
+  SimdBuffers buffers(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    AddPointwise(buffers.num_frames, buffers.in(0), buffers.in(1),
+                 buffers.out(0));
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(buffers.num_frames, &state);
+}
+BENCHMARK(BM_AddPointwise)->Apply(FramesPerBufferArguments);
+
+void BM_SubtractPointwise(benchmark::State& state) {
+  SimdBuffers buffers(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    SubtractPointwise(buffers.num_frames, buffers.in(0), buffers.in(1),
+                      buffers.out(0));
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(buffers.num_frames, &state);
+}
+BENCHMARK(BM_SubtractPointwise)->Apply(FramesPerBufferArguments);
+
+void BM_MultiplyPointwise(benchmark::State& state) {
+  SimdBuffers buffers(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    MultiplyPointwise(buffers.num_frames, buffers.in(0), buffers.in(1),
+                      buffers.out(0));
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(buffers.num_frames, &state);
+}
+BENCHMARK(BM_MultiplyPointwise)->Apply(FramesPerBufferArguments);
+
+void BM_MultiplyAndAccumulatePointwise(benchmark::State& state) {
+  SimdBuffers buffers(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    MultiplyAndAccumulatePointwise(buffers.num_frames, buffers.in(0),
+                                   buffers.in(1), buffers.out(0));
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(buffers.num_frames, &state);
+}
+BENCHMARK(BM_MultiplyAndAccumulatePointwise)->Apply(FramesPerBufferArguments);
+
+void BM_ScalarMultiply(benchmark::State& state) {
+  SimdBuffers buffers(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    ScalarMultiply(buffers.num_frames, 0.5f, buffers.in(0), buffers.out(0));
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(buffers.num_frames, &state);
+}
+BENCHMARK(BM_ScalarMultiply)->Apply(FramesPerBufferArguments);
+
+void BM_ScalarMultiplyAndAccumulate(benchmark::State& state) {
+  SimdBuffers buffers(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    ScalarMultiplyAndAccumulate(buffers.num_frames, 0.5f, buffers.in(0),
+                                buffers.out(0));
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(buffers.num_frames, &state);
+}
+BENCHMARK(BM_ScalarMultiplyAndAccumulate)->Apply(FramesPerBufferArguments);
+
+void BM_ReciprocalSqrt(benchmark::State& state) {
+  SimdBuffers buffers(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    ReciprocalSqrt(buffers.num_frames, buffers.magnitude[0].begin(),
+                   buffers.out(0));
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(buffers.num_frames, &state);
+}
+BENCHMARK(BM_ReciprocalSqrt)->Apply(FramesPerBufferArguments);
+
+void BM_Sqrt(benchmark::State& state) {
+  SimdBuffers buffers(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    Sqrt(buffers.num_frames, buffers.magnitude[0].begin(), buffers.out(0));
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(buffers.num_frames, &state);
+}
+BENCHMARK(BM_Sqrt)->Apply(FramesPerBufferArguments);
+
+void BM_ApproxComplexMagnitude(benchmark::State& state) {
+  SimdBuffers buffers(static_cast<size_t>(state.range(0)));
+  // The interleaved buffer holds |num_frames| complex values.
+  for (auto _ : state) {
+    ApproxComplexMagnitude(buffers.num_frames, buffers.interleaved[0].begin(),
+                           buffers.out(0));
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(buffers.num_frames, &state);
+}
+BENCHMARK(BM_ApproxComplexMagnitude)->Apply(FramesPerBufferArguments);
+
+void BM_ComplexInterleavedFormatFromMagnitudeAndSinCosPhase(
+    benchmark::State& state) {
+  SimdBuffers buffers(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    ComplexInterleavedFormatFromMagnitudeAndSinCosPhase(
+        buffers.num_frames, buffers.in(0), buffers.in(1), buffers.in(2),
+        buffers.interleaved[0].begin());
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(buffers.num_frames, &state);
+}
+BENCHMARK(BM_ComplexInterleavedFormatFromMagnitudeAndSinCosPhase)
+    ->Apply(FramesPerBufferArguments);
+
+void BM_StereoFromMonoSimd(benchmark::State& state) {
+  SimdBuffers buffers(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    StereoFromMonoSimd(buffers.num_frames, buffers.in(0), buffers.out(0),
+                       buffers.out(1));
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(buffers.num_frames, &state);
+}
+BENCHMARK(BM_StereoFromMonoSimd)->Apply(FramesPerBufferArguments);
+
+void BM_MonoFromStereoSimd(benchmark::State& state) {
+  SimdBuffers buffers(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    MonoFromStereoSimd(buffers.num_frames, buffers.in(0), buffers.in(1),
+                       buffers.out(0));
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(buffers.num_frames, &state);
+}
+BENCHMARK(BM_MonoFromStereoSimd)->Apply(FramesPerBufferArguments);
+
+void BM_Int16FromFloat(benchmark::State& state) {
+  SimdBuffers buffers(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    Int16FromFloat(buffers.num_frames, buffers.in(0),
+                   buffers.planar_output_int16[0].data());
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(buffers.num_frames, &state);
+}
+BENCHMARK(BM_Int16FromFloat)->Apply(FramesPerBufferArguments);
+
+void BM_FloatFromInt16(benchmark::State& state) {
+  SimdBuffers buffers(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    FloatFromInt16(buffers.num_frames, buffers.planar_input_int16[0].data(),
+                   buffers.out(0));
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(buffers.num_frames, &state);
+}
+BENCHMARK(BM_FloatFromInt16)->Apply(FramesPerBufferArguments);
+
+void BM_InterleaveStereoInt16(benchmark::State& state) {
+  SimdBuffers buffers(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    InterleaveStereo(buffers.num_frames, buffers.planar_input_int16[0].data(),
+                     buffers.planar_input_int16[1].data(),
+                     buffers.interleaved_int16.data());
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(buffers.num_frames, &state);
+}
+BENCHMARK(BM_InterleaveStereoInt16)->Apply(FramesPerBufferArguments);
+
+void BM_InterleaveStereoFloat(benchmark::State& state) {
+  SimdBuffers buffers(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    InterleaveStereo(buffers.num_frames, buffers.in(0), buffers.in(1),
+                     buffers.interleaved[0].begin());
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(buffers.num_frames, &state);
+}
+BENCHMARK(BM_InterleaveStereoFloat)->Apply(FramesPerBufferArguments);
+
+void BM_InterleaveStereoFloatToInt16(benchmark::State& state) {
+  SimdBuffers buffers(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    InterleaveStereo(buffers.num_frames, buffers.in(0), buffers.in(1),
+                     buffers.interleaved_int16.data());
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(buffers.num_frames, &state);
+}
+BENCHMARK(BM_InterleaveStereoFloatToInt16)->Apply(FramesPerBufferArguments);
+
+void BM_DeinterleaveStereoInt16(benchmark::State& state) {
+  SimdBuffers buffers(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    DeinterleaveStereo(buffers.num_frames, buffers.interleaved_int16.data(),
+                       buffers.planar_output_int16[0].data(),
+                       buffers.planar_output_int16[1].data());
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(buffers.num_frames, &state);
+}
+BENCHMARK(BM_DeinterleaveStereoInt16)->Apply(FramesPerBufferArguments);
+
+void BM_DeinterleaveStereoFloat(benchmark::State& state) {
+  SimdBuffers buffers(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    DeinterleaveStereo(buffers.num_frames, buffers.interleaved[0].begin(),
+                       buffers.out(0), buffers.out(1));
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(buffers.num_frames, &state);
+}
+BENCHMARK(BM_DeinterleaveStereoFloat)->Apply(FramesPerBufferArguments);
+
+void BM_DeinterleaveStereoInt16ToFloat(benchmark::State& state) {
+  SimdBuffers buffers(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    DeinterleaveStereo(buffers.num_frames, buffers.interleaved_int16.data(),
+                       buffers.out(0), buffers.out(1));
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(buffers.num_frames, &state);
+}
+BENCHMARK(BM_DeinterleaveStereoInt16ToFloat)->Apply(FramesPerBufferArguments);
+
+void BM_InterleaveQuadInt16(benchmark::State& state) {
+  SimdBuffers buffers(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    InterleaveQuad(buffers.num_frames, buffers.planar_input_int16[0].data(),
+                   buffers.planar_input_int16[1].data(),
+                   buffers.planar_input_int16[2].data(),
+                   buffers.planar_input_int16[3].data(),
+                   buffers.workspace_int16.data(),
+                   buffers.interleaved_int16.data());
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(buffers.num_frames, &state);
+}
+BENCHMARK(BM_InterleaveQuadInt16)->Apply(FramesPerBufferArguments);
+
+void BM_InterleaveQuadFloat(benchmark::State& state) {
+  SimdBuffers buffers(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    InterleaveQuad(buffers.num_frames, buffers.in(0), buffers.in(1),
+                   buffers.in(2), buffers.in(3), buffers.workspace[0].begin(),
+                   buffers.interleaved[0].begin());
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(buffers.num_frames, &state);
+}
+BENCHMARK(BM_InterleaveQuadFloat)->Apply(FramesPerBufferArguments);
+
+void BM_DeinterleaveQuadInt16(benchmark::State& state) {
+  SimdBuffers buffers(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    DeinterleaveQuad(buffers.num_frames, buffers.interleaved_int16.data(),
+                     buffers.workspace_int16.data(),
+                     buffers.planar_output_int16[0].data(),
+                     buffers.planar_output_int16[1].data(),
+                     buffers.planar_output_int16[2].data(),
+                     buffers.planar_output_int16[3].data());
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(buffers.num_frames, &state);
+}
+BENCHMARK(BM_DeinterleaveQuadInt16)->Apply(FramesPerBufferArguments);
+
+void BM_DeinterleaveQuadFloat(benchmark::State& state) {
+  SimdBuffers buffers(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    DeinterleaveQuad(buffers.num_frames, buffers.interleaved[0].begin(),
+                     buffers.workspace[0].begin(), buffers.out(0),
+                     buffers.out(1), buffers.out(2), buffers.out(3));
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(buffers.num_frames, &state);
+}
+BENCHMARK(BM_DeinterleaveQuadFloat)->Apply(FramesPerBufferArguments);
+
+}  // namespace
+
+}  // namespace vraudio
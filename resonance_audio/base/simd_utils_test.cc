@@ -186,6 +186,29 @@ TEST(SimdUtilsTest, ScalarMultiplyAndAccumuateTest) {
   }
 }
 
+TEST(SimdUtilsTest, DotProductTest) {
+  const size_t kLength = 15;
+  AudioBuffer aligned_audio_buffer(kNumStereoChannels, kLength + 1);
+  float expected_aligned = 0.0f;
+  float expected_unaligned = 0.0f;
+  for (size_t i = 0; i < kLength + 1; ++i) {
+    aligned_audio_buffer[0][i] = static_cast<float>(i) * 0.25f;
+    aligned_audio_buffer[1][i] = 1.0f - static_cast<float>(i) * 0.5f;
+  }
+  for (size_t i = 0; i < kLength; ++i) {
+    expected_aligned += aligned_audio_buffer[0][i] * aligned_audio_buffer[1][i];
+    expected_unaligned +=
+        aligned_audio_buffer[0][i + 1] * aligned_audio_buffer[1][i];
+  }
+  EXPECT_FLOAT_EQ(expected_aligned,
+                  DotProduct(kLength, &aligned_audio_buffer[0][0],
+                             &aligned_audio_buffer[1][0]));
+  // Check the result when one of the inputs is unaligned.
+  EXPECT_FLOAT_EQ(expected_unaligned,
+                  DotProduct(kLength, &aligned_audio_buffer[0][1],
+                             &aligned_audio_buffer[1][0]));
+}
+
 TEST(SimdUtilsTest, SqrtTest) {
   const std::vector<float> kNumbers{130.0f, 13.0f,  1.3f,
                                     0.13f,  0.013f, 0.0013f};
@@ -706,6 +729,87 @@ TEST(SimdUtilsTest, FloatFromInt16Test) {
   }
 }
 
+// Generates |length| 32 bit test values in the range of |num_bits| bit ints,
+// including the extremes.
+std::vector<int32_t> GenerateIntTestValues(size_t length, int num_bits) {
+  const int64_t max_value = (int64_t{1} << (num_bits - 1)) - 1;
+  std::vector<int32_t> values(length);
+  for (size_t i = 0; i < length; ++i) {
+    switch (i % 4) {
+      case 0:
+        values[i] = static_cast<int32_t>(max_value);
+        break;
+      case 1:
+        values[i] = static_cast<int32_t>(-max_value - 1);
+        break;
+      default:
+        values[i] = static_cast<int32_t>(
+            static_cast<int64_t>((i * 2654435761u) % (2 * max_value)) -
+            max_value);
+        break;
+    }
+  }
+  return values;
+}
+
+TEST(SimdUtilsTest, FloatFromInt24Test) {
+  const int32_t kInt24Max = 0x7FFFFF;
+  // Tests all lengths up to several SIMD loads and unaligned input.
+  for (size_t length = 0; length <= kHalfSize; ++length) {
+    const std::vector<int32_t> values = GenerateIntTestValues(length, 24);
+    std::vector<uint8_t> packed(3 * length + 1);
+    for (size_t i = 0; i < length; ++i) {
+      for (size_t byte = 0; byte < 3; ++byte) {
+        const uint32_t value = static_cast<uint32_t>(values[i]);
+        packed[1 + 3 * i + byte] = static_cast<uint8_t>(value >> (8 * byte));
+      }
+    }
+    std::vector<float> output(length);
+    FloatFromInt24(length, packed.data() + 1, output.data());
+    for (size_t i = 0; i < length; ++i) {
+      EXPECT_NEAR(static_cast<double>(values[i]) / kInt24Max, output[i],
+                  kEpsilonFloat);
+    }
+  }
+}
+
+TEST(SimdUtilsTest, FloatFromInt32Test) {
+  const int32_t kInt32Max = 0x7FFFFFFF;
+  for (size_t length = 0; length <= kHalfSize; ++length) {
+    const std::vector<int32_t> values = GenerateIntTestValues(length, 32);
+    std::vector<float> output(length);
+    FloatFromInt32(length, values.data(), output.data());
+    for (size_t i = 0; i < length; ++i) {
+      EXPECT_NEAR(static_cast<double>(values[i]) / kInt32Max, output[i],
+                  kEpsilonFloat);
+    }
+  }
+}
+
+// Tests that the largest positive integer maps to 1.0f for all bit depths.
+TEST(SimdUtilsTest, ConsistentFullScaleTest) {
+  const size_t kNumSamples = 4;
+  const int16_t kInt16FullScale[kNumSamples] = {0x7FFF, 0x7FFF, 0x7FFF,
+                                                0x7FFF};
+  const uint8_t kInt24FullScale[3 * kNumSamples] = {
+      0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F};
+  const int32_t kInt32FullScale[kNumSamples] = {0x7FFFFFFF, 0x7FFFFFFF,
+                                                0x7FFFFFFF, 0x7FFFFFFF};
+  float output[kNumSamples];
+  FloatFromInt16(kNumSamples, kInt16FullScale, output);
+  for (float sample : output) {
+    EXPECT_FLOAT_EQ(1.0f, sample);
+  }
+  FloatFromInt24(kNumSamples, kInt24FullScale, output);
+  for (float sample : output) {
+    EXPECT_FLOAT_EQ(1.0f, sample);
+  }
+  FloatFromInt32(kNumSamples, kInt32FullScale, output);
+  for (float sample : output) {
+    EXPECT_FLOAT_EQ(1.0f, sample);
+  }
+}
+
 }  // namespace
 
 }  // namespace vraudio
@@ -21,6 +21,7 @@ limitations under the License.
 
 #include "base/constants_and_types.h"
 #include "base/object_transform.h"
+#include "base/spherical_angle.h"
 
 namespace vraudio {
 
@@ -33,6 +34,30 @@ enum AttenuationType {
   kNumAttenuationTypes
 };
 
+// Listener relative geometry of an audio source, which is shared by all nodes
+// processing the source.
+struct SourceGeometry {
+  // Direction of the source relative to the listener position and orientation.
+  SphericalAngle direction_from_listener;
+
+  // Direction of the listener relative to the source position and orientation.
+  SphericalAngle direction_from_source;
+
+  // Distance between the listener and the source.
+  float distance = 0.0f;
+
+  // Vector from the listener to the source in world space and rotation of the
+  // listener, in the current and in the previous buffer. Used to interpolate
+  // the direction of moving sources within a buffer.
+  WorldPosition listener_to_source;
+  WorldRotation listener_rotation;
+  WorldPosition previous_listener_to_source;
+  WorldRotation previous_listener_rotation;
+
+  // Whether the geometry has been updated at least once.
+  bool is_initialized = false;
+};
+
 // Parameters describing an audio source.
 struct SourceParameters {
   // Object transform associated with this buffer.
@@ -47,6 +72,9 @@ struct SourceParameters {
   // Source gain attenuation factors to be calculated per each buffer.
   float attenuations[kNumAttenuationTypes];
 
+  // Listener relative geometry to be calculated per each buffer.
+  SourceGeometry geometry;
+
   // Distance attenuation. Value 1 represents no attenuation should be applied,
   // value 0 will fully attenuate the volume. Range [0, 1].
   float distance_attenuation = 1.0f;
@@ -92,8 +120,27 @@ struct SourceParameters {
   // Source gain factor for the room effects.
   float room_effects_gain = 1.0f;
 
+  // Send gain factors into each room zone, applied on top of
+  // |room_effects_gain|. Sources are only routed into the default room zone
+  // unless specified otherwise.
+  float room_zone_send_gains[kMaxNumRoomZones] = {1.0f};
+
   // Whether the source uses binaural rendering or stereo panning.
   bool enable_hrtf = true;
+
+  // Whether the source is delayed by its propagation time to the listener.
+  bool enable_propagation_delay = false;
+
+  // Whether the source may be grouped with other distant sources in similar
+  // directions and encoded at the cluster centroid.
+  bool enable_clustering = false;
+
+  // Whether the source is mixed into a cluster in the current buffer, i.e.
+  // its clustering is enabled and it is at least
+  // |kMinSourceClusteringDistance| away from the listener. Clustered sources
+  // bypass the per-source direct attenuation, occlusion and near field nodes,
+  // and the encoder applies their direct attenuation instead.
+  bool is_clustered = false;
 };
 
 }  // namespace vraudio
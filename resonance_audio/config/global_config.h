@@ -17,18 +17,38 @@ limitations under the License.
 #ifndef RESONANCE_AUDIO_CONFIG_GLOBAL_CONFIG_H_
 #define RESONANCE_AUDIO_CONFIG_GLOBAL_CONFIG_H_
 
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "graph/graph_manager_config.h"
 
 namespace vraudio {
 
-inline GraphManagerConfig GlobalConfig() {
+// Returns the configuration which renders up to the given Ambisonic order. As
+// SH-HRIRs are only available for some orders, the maximum order is rounded
+// down to the closest one of them.
+//
+// @param max_ambisonic_order Maximum Ambisonic order to be rendered.
+// @return Graph manager configuration.
+inline GraphManagerConfig GlobalConfig(int max_ambisonic_order) {
   GraphManagerConfig config;
   config.configuration_name = "Global Config";
 
-  config.max_ambisonic_order = 3;
-  config.sh_hrir_filenames = {{1, "WAV/Subject_002/SH/sh_hrir_order_1.wav"},
-                              {2, "WAV/Subject_002/SH/sh_hrir_order_2.wav"},
-                              {3, "WAV/Subject_002/SH/sh_hrir_order_3.wav"}};
+  const std::vector<std::pair<int, std::string>> sh_hrir_filenames = {
+      {1, "WAV/Subject_002/SH/sh_hrir_order_1.wav"},
+      {2, "WAV/Subject_002/SH/sh_hrir_order_2.wav"},
+      {3, "WAV/Subject_002/SH/sh_hrir_order_3.wav"},
+      {5, "WAV/Subject_002/SH/sh_hrir_order_5.wav"},
+      {7, "WAV/Subject_002/SH/sh_hrir_order_7.wav"}};
+  config.max_ambisonic_order = 1;
+  for (const auto& sh_hrir_filename : sh_hrir_filenames) {
+    if (sh_hrir_filename.first <= max_ambisonic_order ||
+        sh_hrir_filename.first == 1) {
+      config.max_ambisonic_order = sh_hrir_filename.first;
+      config.sh_hrir_filenames.push_back(sh_hrir_filename);
+    }
+  }
   return config;
 }
 
@@ -62,6 +62,28 @@ SourceGraphConfig BinauralHighQualityConfig() {
   return config;
 }
 
+SourceGraphConfig BinauralVeryHighQualityConfig() {
+  SourceGraphConfig config;
+  config.configuration_name = "Binaural Very High Quality";
+
+  config.ambisonic_order = 5;
+  config.enable_hrtf = true;
+  config.enable_direct_rendering = true;
+
+  return config;
+}
+
+SourceGraphConfig BinauralUltraHighQualityConfig() {
+  SourceGraphConfig config;
+  config.configuration_name = "Binaural Ultra High Quality";
+
+  config.ambisonic_order = 7;
+  config.enable_hrtf = true;
+  config.enable_direct_rendering = true;
+
+  return config;
+}
+
 SourceGraphConfig RoomEffectsOnlyConfig() {
   SourceGraphConfig config;
   config.configuration_name = "Room Effects Only";
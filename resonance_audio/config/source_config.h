@@ -25,6 +25,10 @@ SourceGraphConfig StereoPanningConfig();
 SourceGraphConfig BinauralLowQualityConfig();
 SourceGraphConfig BinauralMediumQualityConfig();
 SourceGraphConfig BinauralHighQualityConfig();
+
+SourceGraphConfig BinauralVeryHighQualityConfig();
+
+SourceGraphConfig BinauralUltraHighQualityConfig();
 SourceGraphConfig RoomEffectsOnlyConfig();
 
 }  // namespace vraudio
@@ -0,0 +1,228 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "dsp/biquad_bank.h"
+
+#include <algorithm>
+
+#include "base/constants_and_types.h"
+#include "base/logging.h"
+#include "base/simd_macros.h"
+
+namespace vraudio {
+
+namespace {
+
+// Crossfading over 256 samples was found to yield no audible artefacts in
+// |BiquadFilter|, the same length is used for coefficient ramps.
+const size_t kIdealSamplesToIterate = 256U;
+
+// Returns the |group|-th SIMD vector of |channel|.
+SimdVector* GetVector(size_t group, AudioBuffer::Channel* channel) {
+  return reinterpret_cast<SimdVector*>(channel->begin()) + group;
+}
+
+// Filters one frame of all lanes of a group in transposed direct form II:
+//   y[n] = b0 * x[n] + s1[n-1]
+//  s1[n] = b1 * x[n] - a1 * y[n] + s2[n-1]
+//  s2[n] = b2 * x[n] - a2 * y[n]
+// where the coefficients have been normalized by a0. |frame_vector| holds the
+// input on entry and the output on return.
+inline void FilterFrame(const SimdVector* coefficients,
+                        SimdVector* frame_vector, SimdVector* state_1,
+                        SimdVector* state_2) {
+  const SimdVector input = *frame_vector;
+  const SimdVector output = SIMD_MULTIPLY_ADD(coefficients[0], input, *state_1);
+  *state_1 = SIMD_SUB(SIMD_MULTIPLY_ADD(coefficients[1], input, *state_2),
+                      SIMD_MULTIPLY(coefficients[3], output));
+  *state_2 = SIMD_SUB(SIMD_MULTIPLY(coefficients[2], input),
+                      SIMD_MULTIPLY(coefficients[4], output));
+  *frame_vector = output;
+}
+
+}  // namespace
+
+BiquadBank::BiquadBank(size_t num_filters,
+                       const BiquadCoefficients& coefficients,
+                       size_t frames_per_buffer)
+    : num_filters_(num_filters),
+      num_lanes_((num_filters + SIMD_LENGTH - 1) / SIMD_LENGTH * SIMD_LENGTH),
+      frames_per_buffer_(frames_per_buffer),
+      frames_to_interpolate_(
+          std::min(frames_per_buffer, kIdealSamplesToIterate)),
+      interpolation_frames_remaining_(0),
+      coefficients_(kNumCoefficients, num_lanes_),
+      target_coefficients_(kNumCoefficients, num_lanes_),
+      coefficient_increments_(kNumCoefficients, num_lanes_),
+      state_(2, num_lanes_),
+      interleaved_buffer_(kNumMonoChannels, frames_per_buffer * num_lanes_) {
+  DCHECK_GT(num_filters, 0U);
+  DCHECK_GT(frames_per_buffer, 0U);
+  // Unused lanes pass their (silent) input through.
+  const BiquadCoefficients kIdentityCoefficients;
+  for (size_t lane = 0; lane < num_lanes_; ++lane) {
+    StoreCoefficients(
+        lane, lane < num_filters_ ? coefficients : kIdentityCoefficients,
+        &coefficients_);
+  }
+  for (size_t i = 0; i < kNumCoefficients; ++i) {
+    target_coefficients_[i] = coefficients_[i];
+  }
+  coefficient_increments_.Clear();
+  state_.Clear();
+  interleaved_buffer_.Clear();
+}
+
+void BiquadBank::Filter(const AudioBuffer& input, AudioBuffer* output) {
+  DCHECK(output);
+  DCHECK_EQ(input.num_channels(), num_filters_);
+  DCHECK_EQ(output->num_channels(), num_filters_);
+  const size_t num_frames = input.num_frames();
+  DCHECK_EQ(num_frames, output->num_frames());
+  DCHECK_LE(num_frames, frames_per_buffer_);
+
+  float* interleaved = interleaved_buffer_[0].begin();
+  for (size_t channel = 0; channel < num_filters_; ++channel) {
+    const AudioBuffer::Channel& input_channel = input[channel];
+    for (size_t frame = 0; frame < num_frames; ++frame) {
+      interleaved[frame * num_lanes_ + channel] = input_channel[frame];
+    }
+  }
+  Process(nullptr, num_frames);
+  for (size_t channel = 0; channel < num_filters_; ++channel) {
+    AudioBuffer::Channel& output_channel = (*output)[channel];
+    for (size_t frame = 0; frame < num_frames; ++frame) {
+      output_channel[frame] = interleaved[frame * num_lanes_ + channel];
+    }
+  }
+}
+
+void BiquadBank::Filter(const AudioBuffer::Channel& input_channel,
+                        AudioBuffer* output) {
+  DCHECK(output);
+  DCHECK_EQ(output->num_channels(), num_filters_);
+  const size_t num_frames = input_channel.size();
+  DCHECK_EQ(num_frames, output->num_frames());
+  DCHECK_LE(num_frames, frames_per_buffer_);
+
+  Process(input_channel.begin(), num_frames);
+  const float* interleaved = interleaved_buffer_[0].begin();
+  for (size_t channel = 0; channel < num_filters_; ++channel) {
+    AudioBuffer::Channel& output_channel = (*output)[channel];
+    for (size_t frame = 0; frame < num_frames; ++frame) {
+      output_channel[frame] = interleaved[frame * num_lanes_ + channel];
+    }
+  }
+}
+
+void BiquadBank::SetCoefficients(size_t filter_index,
+                                 const BiquadCoefficients& coefficients) {
+  DCHECK_LT(filter_index, num_filters_);
+  StoreCoefficients(filter_index, coefficients, &coefficients_);
+  StoreCoefficients(filter_index, coefficients, &target_coefficients_);
+  for (size_t i = 0; i < kNumCoefficients; ++i) {
+    coefficient_increments_[i][filter_index] = 0.0f;
+  }
+}
+
+void BiquadBank::InterpolateToCoefficients(
+    size_t filter_index, const BiquadCoefficients& coefficients) {
+  DCHECK_LT(filter_index, num_filters_);
+  StoreCoefficients(filter_index, coefficients, &target_coefficients_);
+  // Restart the ramps of all lanes, so that they share a single frame count.
+  const float scale = 1.0f / static_cast<float>(frames_to_interpolate_);
+  for (size_t i = 0; i < kNumCoefficients; ++i) {
+    for (size_t lane = 0; lane < num_lanes_; ++lane) {
+      coefficient_increments_[i][lane] =
+          scale * (target_coefficients_[i][lane] - coefficients_[i][lane]);
+    }
+  }
+  interpolation_frames_remaining_ = frames_to_interpolate_;
+}
+
+void BiquadBank::Clear() {
+  state_.Clear();
+  interleaved_buffer_.Clear();
+}
+
+void BiquadBank::StoreCoefficients(size_t filter_index,
+                                   const BiquadCoefficients& coefficients,
+                                   AudioBuffer* coefficient_buffer) {
+  DCHECK(coefficient_buffer);
+  DCHECK_GT(coefficients.a[0], kEpsilonFloat);
+  const float a0 = coefficients.a[0];
+  (*coefficient_buffer)[kB0][filter_index] = coefficients.b[0] / a0;
+  (*coefficient_buffer)[kB1][filter_index] = coefficients.b[1] / a0;
+  (*coefficient_buffer)[kB2][filter_index] = coefficients.b[2] / a0;
+  (*coefficient_buffer)[kA1][filter_index] = coefficients.a[1] / a0;
+  (*coefficient_buffer)[kA2][filter_index] = coefficients.a[2] / a0;
+}
+
+void BiquadBank::Process(const float* broadcast_input, size_t num_frames) {
+  const size_t num_groups = num_lanes_ / SIMD_LENGTH;
+  const size_t num_interpolated_frames =
+      std::min(interpolation_frames_remaining_, num_frames);
+  SimdVector* frame_vectors =
+      reinterpret_cast<SimdVector*>(interleaved_buffer_[0].begin());
+  if (broadcast_input != nullptr) {
+    for (size_t frame = 0; frame < num_frames; ++frame) {
+      const SimdVector input = SIMD_LOAD_ONE_FLOAT(broadcast_input[frame]);
+      for (size_t group = 0; group < num_groups; ++group) {
+        frame_vectors[frame * num_groups + group] = input;
+      }
+    }
+  }
+  for (size_t group = 0; group < num_groups; ++group) {
+    SimdVector coefficients[kNumCoefficients];
+    SimdVector increments[kNumCoefficients];
+    for (size_t i = 0; i < kNumCoefficients; ++i) {
+      coefficients[i] = *GetVector(group, &coefficients_[i]);
+      increments[i] = *GetVector(group, &coefficient_increments_[i]);
+    }
+    SimdVector state_1 = *GetVector(group, &state_[0]);
+    SimdVector state_2 = *GetVector(group, &state_[1]);
+    SimdVector* frame_vector = frame_vectors + group;
+    for (size_t frame = 0; frame < num_interpolated_frames; ++frame) {
+      for (size_t i = 0; i < kNumCoefficients; ++i) {
+        coefficients[i] = SIMD_ADD(coefficients[i], increments[i]);
+      }
+      FilterFrame(coefficients, frame_vector, &state_1, &state_2);
+      frame_vector += num_groups;
+    }
+    for (size_t frame = num_interpolated_frames; frame < num_frames; ++frame) {
+      FilterFrame(coefficients, frame_vector, &state_1, &state_2);
+      frame_vector += num_groups;
+    }
+    for (size_t i = 0; i < kNumCoefficients; ++i) {
+      *GetVector(group, &coefficients_[i]) = coefficients[i];
+    }
+    *GetVector(group, &state_[0]) = state_1;
+    *GetVector(group, &state_[1]) = state_2;
+  }
+
+  if (num_interpolated_frames > 0) {
+    interpolation_frames_remaining_ -= num_interpolated_frames;
+    if (interpolation_frames_remaining_ == 0) {
+      // Snap to the targets to discard any accumulated rounding error.
+      for (size_t i = 0; i < kNumCoefficients; ++i) {
+        coefficients_[i] = target_coefficients_[i];
+      }
+      coefficient_increments_.Clear();
+    }
+  }
+}
+
+}  // namespace vraudio
@@ -0,0 +1,122 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef RESONANCE_AUDIO_DSP_BIQUAD_BANK_H_
+#define RESONANCE_AUDIO_DSP_BIQUAD_BANK_H_
+
+#include "base/audio_buffer.h"
+#include "dsp/biquad_filter.h"
+
+namespace vraudio {
+
+// Bank of independent biquad filters which are processed together, one filter
+// per SIMD lane. The filters are implemented in transposed direct form II.
+// Coefficient changes can be interpolated per filter, in which case the
+// coefficients themselves are ramped linearly towards their new values.
+class BiquadBank {
+ public:
+  // Constructs a |BiquadBank| with all filters set to the same coefficients.
+  //
+  // @param num_filters Number of independent biquad filters.
+  // @param coefficients Initial coefficients of all filters.
+  // @param frames_per_buffer The number of frames in each data buffer to be
+  //     processed. This also determines the length of coefficient ramps.
+  BiquadBank(size_t num_filters, const BiquadCoefficients& coefficients,
+             size_t frames_per_buffer);
+
+  // Filters each channel of |input| with the filter of the same index.
+  //
+  // @param input Input buffer with |num_filters| channels.
+  // @param output Output buffer with |num_filters| channels. May be |input|.
+  void Filter(const AudioBuffer& input, AudioBuffer* output);
+
+  // Filters the same input channel with every filter of the bank.
+  //
+  // @param input_channel Input channel.
+  // @param output Output buffer with |num_filters| channels, channel i holds
+  //     the output of filter i.
+  void Filter(const AudioBuffer::Channel& input_channel, AudioBuffer* output);
+
+  // Sets the coefficients of a single filter, all coefficients bar a0 are
+  // scaled by 1/a0. Cancels any interpolation of that filter.
+  //
+  // @param filter_index Index of the filter.
+  // @param coefficients A set of |BiquadCoefficients|.
+  void SetCoefficients(size_t filter_index,
+                       const BiquadCoefficients& coefficients);
+
+  // Sets the target coefficients of a single filter, which are reached over
+  // the next buffer of at most 256 frames. Filters which are still
+  // interpolating continue towards their own targets over the same period.
+  //
+  // @param filter_index Index of the filter.
+  // @param coefficients A set of |BiquadCoefficients|.
+  void InterpolateToCoefficients(size_t filter_index,
+                                 const BiquadCoefficients& coefficients);
+
+  // Clears the internal state of all filters, except for coefficients.
+  void Clear();
+
+  // Returns the number of filters in the bank.
+  size_t num_filters() const { return num_filters_; }
+
+ private:
+  // Indices of the normalized coefficients in the coefficient buffers.
+  enum CoefficientIndex { kB0 = 0, kB1, kB2, kA1, kA2, kNumCoefficients };
+
+  // Writes the normalized |coefficients| into lane |filter_index| of
+  // |coefficient_buffer|.
+  void StoreCoefficients(size_t filter_index,
+                         const BiquadCoefficients& coefficients,
+                         AudioBuffer* coefficient_buffer);
+
+  // Runs all filters over |num_frames| frames of |interleaved_buffer_|, which
+  // holds |num_lanes_| interleaved input frames on entry and the interleaved
+  // output frames on return. If |broadcast_input| is not null it is used as
+  // input for every lane instead.
+  void Process(const float* broadcast_input, size_t num_frames);
+
+  // Number of filters in the bank.
+  const size_t num_filters_;
+
+  // Number of filters rounded up to a multiple of |SIMD_LENGTH|.
+  const size_t num_lanes_;
+
+  // Number of frames in each input buffer.
+  const size_t frames_per_buffer_;
+
+  // Number of frames over which coefficient changes are interpolated.
+  const size_t frames_to_interpolate_;
+
+  // Remaining number of frames of the current coefficient interpolation.
+  size_t interpolation_frames_remaining_;
+
+  // Current, target and per-frame increment of the normalized coefficients,
+  // one channel per coefficient and one frame per lane.
+  AudioBuffer coefficients_;
+  AudioBuffer target_coefficients_;
+  AudioBuffer coefficient_increments_;
+
+  // The two state variables of each lane.
+  AudioBuffer state_;
+
+  // Interleaved input and output frames of all lanes.
+  AudioBuffer interleaved_buffer_;
+};
+
+}  // namespace vraudio
+
+#endif  // RESONANCE_AUDIO_DSP_BIQUAD_BANK_H_
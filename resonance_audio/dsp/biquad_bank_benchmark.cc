@@ -0,0 +1,80 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "dsp/biquad_bank.h"
+
+#include "benchmark/benchmark.h"
+#include "base/audio_buffer.h"
+#include "base/constants_and_types.h"
+#include "dsp/filter_coefficient_generators.h"
+#include "utils/benchmark_util.h"
+
+namespace vraudio {
+
+namespace {
+
+const int kSampleRate = 48000;
+
+const size_t kFramesPerBuffer = 256;
+
+// Measures a bank of |state.range(0)| low-pass filters, one per channel, to
+// compare against the same number of |BiquadFilter| instances.
+void BM_BiquadBank(benchmark::State& state) {
+  const size_t num_filters = static_cast<size_t>(state.range(0));
+  BiquadBank bank(num_filters,
+                  ComputeLowPassBiquadCoefficients(kSampleRate, 4000.0f, -6.0f),
+                  kFramesPerBuffer);
+  AudioBuffer input(num_filters, kFramesPerBuffer);
+  FillWithNoise(&input);
+  AudioBuffer output(num_filters, kFramesPerBuffer);
+  for (auto _ : state) {
+    bank.Filter(input, &output);
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(num_filters * kFramesPerBuffer, &state);
+}
+BENCHMARK(BM_BiquadBank)->ArgName("filters")->RangeMultiplier(2)->Range(1, 16);
+
+// Measures the bank while every filter interpolates between coefficients in
+// every buffer.
+void BM_BiquadBankInterpolating(benchmark::State& state) {
+  const size_t num_filters = static_cast<size_t>(state.range(0));
+  const BiquadCoefficients coefficients[] = {
+      ComputeLowPassBiquadCoefficients(kSampleRate, 4000.0f, -6.0f),
+      ComputeLowPassBiquadCoefficients(kSampleRate, 2000.0f, -6.0f)};
+  BiquadBank bank(num_filters, coefficients[0], kFramesPerBuffer);
+  AudioBuffer input(num_filters, kFramesPerBuffer);
+  FillWithNoise(&input);
+  AudioBuffer output(num_filters, kFramesPerBuffer);
+  size_t index = 0;
+  for (auto _ : state) {
+    index = 1 - index;
+    for (size_t i = 0; i < num_filters; ++i) {
+      bank.InterpolateToCoefficients(i, coefficients[index]);
+    }
+    bank.Filter(input, &output);
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(num_filters * kFramesPerBuffer, &state);
+}
+BENCHMARK(BM_BiquadBankInterpolating)
+    ->ArgName("filters")
+    ->RangeMultiplier(2)
+    ->Range(1, 16);
+
+}  // namespace
+
+}  // namespace vraudio
@@ -0,0 +1,138 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "dsp/biquad_bank.h"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+#include "base/constants_and_types.h"
+#include "dsp/biquad_filter.h"
+#include "dsp/filter_coefficient_generators.h"
+#include "dsp/utils.h"
+
+namespace vraudio {
+
+namespace {
+
+const int kSampleRate = 48000;
+
+const size_t kFramesPerBuffer = 128;
+
+// Number of filters, chosen to not be a multiple of the SIMD length.
+const size_t kNumFilters = 5;
+
+const float kCutoffFrequenciesHz[kNumFilters] = {200.0f, 1000.0f, 2500.0f,
+                                                 8000.0f, 15000.0f};
+
+const float kEpsilon = 1e-5f;
+
+// Tests that each filter of the bank matches a |BiquadFilter| with the same
+// coefficients over several buffers.
+TEST(BiquadBankTest, MatchesBiquadFilterTest) {
+  const size_t kNumBuffers = 4;
+  BiquadBank bank(kNumFilters, BiquadCoefficients(), kFramesPerBuffer);
+  std::vector<std::unique_ptr<BiquadFilter>> filters;
+  for (size_t i = 0; i < kNumFilters; ++i) {
+    const BiquadCoefficients coefficients = ComputeLowPassBiquadCoefficients(
+        kSampleRate, kCutoffFrequenciesHz[i], -3.0f);
+    bank.SetCoefficients(i, coefficients);
+    filters.emplace_back(new BiquadFilter(coefficients, kFramesPerBuffer));
+  }
+  EXPECT_EQ(kNumFilters, bank.num_filters());
+
+  AudioBuffer input(kNumFilters, kFramesPerBuffer);
+  AudioBuffer output(kNumFilters, kFramesPerBuffer);
+  AudioBuffer expected(kNumFilters, kFramesPerBuffer);
+  for (size_t buffer = 0; buffer < kNumBuffers; ++buffer) {
+    for (size_t i = 0; i < kNumFilters; ++i) {
+      GenerateUniformNoise(-1.0f, 1.0f, static_cast<unsigned>(buffer + i),
+                           &input[i]);
+      filters[i]->Filter(input[i], &expected[i]);
+    }
+    bank.Filter(input, &output);
+    for (size_t i = 0; i < kNumFilters; ++i) {
+      for (size_t frame = 0; frame < kFramesPerBuffer; ++frame) {
+        EXPECT_NEAR(expected[i][frame], output[i][frame], kEpsilon);
+      }
+    }
+  }
+}
+
+// Tests that filtering a single channel with every filter gives the same
+// result as filtering copies of that channel.
+TEST(BiquadBankTest, SingleInputChannelTest) {
+  BiquadBank single_input_bank(kNumFilters, BiquadCoefficients(),
+                               kFramesPerBuffer);
+  BiquadBank multi_input_bank(kNumFilters, BiquadCoefficients(),
+                              kFramesPerBuffer);
+  for (size_t i = 0; i < kNumFilters; ++i) {
+    const BiquadCoefficients coefficients = ComputeBandPassBiquadCoefficients(
+        kSampleRate, kCutoffFrequenciesHz[i], /*bandwidth=*/1);
+    single_input_bank.SetCoefficients(i, coefficients);
+    multi_input_bank.SetCoefficients(i, coefficients);
+  }
+
+  AudioBuffer input(kNumFilters, kFramesPerBuffer);
+  GenerateUniformNoise(-1.0f, 1.0f, 0U, &input[0]);
+  for (size_t i = 1; i < kNumFilters; ++i) {
+    input[i] = input[0];
+  }
+  AudioBuffer single_input_output(kNumFilters, kFramesPerBuffer);
+  AudioBuffer multi_input_output(kNumFilters, kFramesPerBuffer);
+  single_input_bank.Filter(input[0], &single_input_output);
+  multi_input_bank.Filter(input, &multi_input_output);
+  for (size_t i = 0; i < kNumFilters; ++i) {
+    for (size_t frame = 0; frame < kFramesPerBuffer; ++frame) {
+      EXPECT_EQ(multi_input_output[i][frame], single_input_output[i][frame]);
+    }
+  }
+}
+
+// Tests that interpolated coefficients reach their target, by checking the DC
+// gain of a filter whose numerator is halved, while the other filters are left
+// untouched.
+TEST(BiquadBankTest, InterpolateToCoefficientsTest) {
+  const size_t kNumBuffers = 40;
+  const size_t kInterpolatedFilter = 2;
+  const BiquadCoefficients kCoefficients =
+      ComputeLowPassBiquadCoefficients(kSampleRate, 1000.0f, -3.0f);
+  BiquadCoefficients half_gain_coefficients = kCoefficients;
+  for (float& b : half_gain_coefficients.b) {
+    b *= 0.5f;
+  }
+  BiquadBank bank(kNumFilters, kCoefficients, kFramesPerBuffer);
+  bank.InterpolateToCoefficients(kInterpolatedFilter, half_gain_coefficients);
+
+  AudioBuffer input(kNumFilters, kFramesPerBuffer);
+  for (auto& channel : input) {
+    std::fill(channel.begin(), channel.end(), 1.0f);
+  }
+  AudioBuffer output(kNumFilters, kFramesPerBuffer);
+  for (size_t buffer = 0; buffer < kNumBuffers; ++buffer) {
+    bank.Filter(input, &output);
+  }
+  for (size_t i = 0; i < kNumFilters; ++i) {
+    const float expected_gain = i == kInterpolatedFilter ? 0.5f : 1.0f;
+    EXPECT_NEAR(expected_gain, output[i][kFramesPerBuffer - 1], kEpsilon);
+  }
+}
+
+}  // namespace
+
+}  // namespace vraudio
@@ -0,0 +1,71 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "dsp/biquad_filter.h"
+
+#include "benchmark/benchmark.h"
+#include "base/audio_buffer.h"
+#include "base/constants_and_types.h"
+#include "dsp/filter_coefficient_generators.h"
+#include "utils/benchmark_util.h"
+
+namespace vraudio {
+
+namespace {
+
+const int kSampleRate = 48000;
+
+void BM_BiquadFilter(benchmark::State& state) {
+  const size_t frames_per_buffer = static_cast<size_t>(state.range(0));
+  BiquadFilter filter(
+      ComputeLowPassBiquadCoefficients(kSampleRate, 4000.0f, -6.0f),
+      frames_per_buffer);
+  AudioBuffer input(kNumMonoChannels, frames_per_buffer);
+  FillWithNoise(&input);
+  AudioBuffer output(kNumMonoChannels, frames_per_buffer);
+  for (auto _ : state) {
+    filter.Filter(input[0], &output[0]);
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(frames_per_buffer, &state);
+}
+BENCHMARK(BM_BiquadFilter)->Apply(FramesPerBufferArguments);
+
+// Measures the filter while it interpolates between coefficients in every
+// buffer, e.g. when the occlusion of a moving source changes.
+void BM_BiquadFilterInterpolating(benchmark::State& state) {
+  const size_t frames_per_buffer = static_cast<size_t>(state.range(0));
+  const BiquadCoefficients coefficients[] = {
+      ComputeLowPassBiquadCoefficients(kSampleRate, 4000.0f, -6.0f),
+      ComputeLowPassBiquadCoefficients(kSampleRate, 2000.0f, -6.0f)};
+  BiquadFilter filter(coefficients[0], frames_per_buffer);
+  AudioBuffer input(kNumMonoChannels, frames_per_buffer);
+  FillWithNoise(&input);
+  AudioBuffer output(kNumMonoChannels, frames_per_buffer);
+  size_t index = 0;
+  for (auto _ : state) {
+    index = 1 - index;
+    filter.InterpolateToCoefficients(coefficients[index]);
+    filter.Filter(input[0], &output[0]);
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(frames_per_buffer, &state);
+}
+BENCHMARK(BM_BiquadFilterInterpolating)->Apply(FramesPerBufferArguments);
+
+}  // namespace
+
+}  // namespace vraudio
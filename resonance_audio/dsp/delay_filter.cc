@@ -17,12 +17,46 @@ limitations under the License.
 #include "dsp/delay_filter.h"
 
 #include <cmath>
+#include <cstdint>
 
 #include "base/constants_and_types.h"
 #include "base/misc_math.h"
+#include "base/simd_macros.h"
+#include "base/simd_utils.h"
 
 
 namespace vraudio {
+
+namespace {
+
+// Returns the dot product of the |FractionalDelayTable::kNumTaps| samples of
+// |input| with the aligned |kernel|.
+inline float ApplyKernel(const float* kernel, const float* input) {
+  static_assert(FractionalDelayTable::kNumTaps == 8,
+                "The kernel is applied as two SIMD vectors of four floats");
+#if defined(SIMD_SSE)
+  __m128 sum = _mm_mul_ps(_mm_load_ps(kernel), _mm_loadu_ps(input));
+  sum = _mm_add_ps(
+      sum, _mm_mul_ps(_mm_load_ps(kernel + 4), _mm_loadu_ps(input + 4)));
+  sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+  sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+  return _mm_cvtss_f32(sum);
+#elif defined(SIMD_NEON)
+  float32x4_t sum = vmulq_f32(vld1q_f32(kernel), vld1q_f32(input));
+  sum = vmlaq_f32(sum, vld1q_f32(kernel + 4), vld1q_f32(input + 4));
+  const float32x2_t half_sum = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+  return vget_lane_f32(vpadd_f32(half_sum, half_sum), 0);
+#else
+  float sum = 0.0f;
+  for (size_t tap = 0; tap < FractionalDelayTable::kNumTaps; ++tap) {
+    sum += kernel[tap] * input[tap];
+  }
+  return sum;
+#endif  // SIMD_SSE
+}
+
+}  // namespace
+
 // The following explains the behaviour of the delay line when a change to the
 // delay length is made. Initially |delay| is 2, |frames_per_buffer_|
 // is 4, and |delay_line_| is 8 in length.
@@ -141,16 +175,10 @@ void DelayFilter::GetDelayedData(size_t delay_samples,
                                  AudioBuffer::Channel* buffer) {
 
   DCHECK(buffer);
-  DCHECK_GE(delay_samples, 0U);
-  DCHECK_LE(delay_samples, max_delay_length_);
 
   const size_t delay_buffer_size = delay_line_->num_frames();
   // Position in the delay line to begin reading from.
-  DCHECK_GE(write_cursor_ + delay_buffer_size,
-            delay_samples + frames_per_buffer_);
-  const size_t read_cursor =
-      (write_cursor_ + delay_buffer_size - delay_samples - frames_per_buffer_) %
-      delay_buffer_size;
+  const size_t read_cursor = GetReadCursor(delay_samples);
   // Record the remaining space in the |delay_line_| after the read cursor.
   const size_t remaining_size_read = delay_buffer_size - read_cursor;
   AudioBuffer::Channel* delay_channel = &(*delay_line_)[0];
@@ -177,4 +205,108 @@ void DelayFilter::GetDelayedData(size_t delay_samples,
   }
 }
 
+void DelayFilter::GetInterpolatedDelayedData(
+    float previous_delay_samples, float delay_samples,
+    const FractionalDelayTable& kernel_table, AudioBuffer::Channel* buffer) {
+  DCHECK(buffer);
+  DCHECK_EQ(buffer->size(), frames_per_buffer_);
+  const size_t kNumTaps = FractionalDelayTable::kNumTaps;
+  DCHECK_GE(std::min(previous_delay_samples, delay_samples),
+            static_cast<float>(kNumTaps / 2));
+  DCHECK_LE(std::max(previous_delay_samples, delay_samples),
+            static_cast<float>(max_delay_length_ - kNumTaps / 2));
+
+  const size_t delay_buffer_size = delay_line_->num_frames();
+  const float* delay_data = (*delay_line_)[0].begin();
+  float* output = buffer->begin();
+  // The read position is tracked as the distance behind the |write_cursor_| in
+  // 32.32 fixed point samples, which avoids float conversions per frame. The
+  // distance is larger than the number of future taps for the valid delays.
+  const double kFixedPointScale = 4294967296.0;
+  const double delay_increment =
+      static_cast<double>(delay_samples - previous_delay_samples) /
+      static_cast<double>(frames_per_buffer_);
+  int64_t lookback = static_cast<int64_t>(
+      (static_cast<double>(frames_per_buffer_) +
+       static_cast<double>(previous_delay_samples) + delay_increment) *
+          kFixedPointScale +
+      0.5);
+  const int64_t lookback_step = static_cast<int64_t>(
+      std::floor((delay_increment - 1.0) * kFixedPointScale + 0.5));
+  const uint64_t kNumPhases = FractionalDelayTable::kNumPhases;
+  for (size_t frame = 0; frame < frames_per_buffer_; ++frame) {
+    const size_t integer_lookback = static_cast<size_t>(lookback >> 32);
+    const uint64_t lookback_fraction = static_cast<uint32_t>(lookback);
+    lookback += lookback_step;
+    // Interpolate between the samples |integer_lookback| + 1 and
+    // |integer_lookback| behind the cursor, at the phase of the fractional
+    // position past the former.
+    const size_t phase = static_cast<size_t>(
+        kNumPhases -
+        ((lookback_fraction * kNumPhases + (uint64_t{1} << 31)) >> 32));
+    const size_t first_tap_offset =
+        integer_lookback + 1 + FractionalDelayTable::kNumPrecedingTaps;
+    size_t first_tap = write_cursor_ + delay_buffer_size - first_tap_offset;
+    if (first_tap >= delay_buffer_size) {
+      first_tap -= delay_buffer_size;
+    }
+    const float* kernel = kernel_table.GetPhaseKernel(phase);
+    if (first_tap + kNumTaps <= delay_buffer_size) {
+      output[frame] = ApplyKernel(kernel, delay_data + first_tap);
+    } else {
+      // Gather the taps wrapping around the end of the delay line.
+      float taps[kNumTaps];
+      for (size_t tap = 0; tap < kNumTaps; ++tap) {
+        taps[tap] = delay_data[(first_tap + tap) % delay_buffer_size];
+      }
+      output[frame] = ApplyKernel(kernel, taps);
+    }
+  }
+}
+
+void DelayFilter::AccumulateMultiTapData(const std::vector<size_t>& delays,
+                                         const AudioBuffer& tap_gains,
+                                         AudioBuffer* output) {
+  DCHECK(output);
+  DCHECK_LE(tap_gains.num_channels(), output->num_channels());
+  DCHECK_GE(tap_gains.num_frames(), delays.size());
+  DCHECK_EQ(output->num_frames(), frames_per_buffer_);
+
+  const size_t delay_buffer_size = delay_line_->num_frames();
+  const size_t num_channels = tap_gains.num_channels();
+  const float* delay_data = (*delay_line_)[0].begin();
+  for (size_t tap = 0; tap < delays.size(); ++tap) {
+    const size_t read_cursor = GetReadCursor(delays[tap]);
+    // The tap is read in two segments when it wraps around the delay line.
+    const size_t first_segment_length =
+        std::min(frames_per_buffer_, delay_buffer_size - read_cursor);
+    const size_t second_segment_length =
+        frames_per_buffer_ - first_segment_length;
+    for (size_t channel = 0; channel < num_channels; ++channel) {
+      const float gain = tap_gains[channel][tap];
+      if (gain == 0.0f) {
+        continue;
+      }
+      float* output_data = (*output)[channel].begin();
+      ScalarMultiplyAndAccumulate(first_segment_length, gain,
+                                  delay_data + read_cursor, output_data);
+      if (second_segment_length > 0) {
+        ScalarMultiplyAndAccumulate(second_segment_length, gain, delay_data,
+                                    output_data + first_segment_length);
+      }
+    }
+  }
+}
+
+size_t DelayFilter::GetReadCursor(size_t delay_samples) const {
+  DCHECK_GE(delay_samples, 0U);
+  DCHECK_LE(delay_samples, max_delay_length_);
+  const size_t delay_buffer_size = delay_line_->num_frames();
+  DCHECK_GE(write_cursor_ + delay_buffer_size,
+            delay_samples + frames_per_buffer_);
+  return (write_cursor_ + delay_buffer_size - delay_samples -
+          frames_per_buffer_) %
+         delay_buffer_size;
+}
+
 }  // namespace vraudio
@@ -19,8 +19,10 @@ limitations under the License.
 
 #include <algorithm>
 #include <memory>
+#include <vector>
 
 #include "base/audio_buffer.h"
+#include "dsp/fractional_delay_table.h"
 
 namespace vraudio {
 
@@ -66,7 +68,39 @@ class DelayFilter {
   // @param buffer Pointer to the output data, i.e., delayed input data.
   void GetDelayedData(size_t delay_samples, AudioBuffer::Channel* buffer);
 
+  // Fills an |AudioBuffer::Channel| with data delayed by a fractional number of
+  // samples. The delay is linearly interpolated across the buffer, such that
+  // varying delays resample the delayed data, i.e. apply a Doppler shift.
+  //
+  // @param previous_delay_samples Delay of the last frame of the previous
+  //     buffer.
+  // @param delay_samples Delay of the last frame of the buffer. Both delays
+  //     must be in range [|FractionalDelayTable::kNumTaps| / 2,
+  //     |max_delay_length_| - |FractionalDelayTable::kNumTaps| / 2].
+  // @param kernel_table Interpolation kernels to read the delay line with.
+  // @param buffer Pointer to the output data, i.e., delayed input data.
+  void GetInterpolatedDelayedData(float previous_delay_samples,
+                                  float delay_samples,
+                                  const FractionalDelayTable& kernel_table,
+                                  AudioBuffer::Channel* buffer);
+
+  // Reads multiple taps off the delay line in a single pass, and accumulates
+  // each tap scaled by a per channel gain into the channels of |output|.
+  //
+  // @param delays Requested delay of each tap in samples. Each delay must be
+  //     less than or equal to |max_delay_length_|.
+  // @param tap_gains Gains with one frame per tap, and one channel per channel
+  //     of |output| to accumulate into. Taps with zero gain are skipped.
+  // @param output Pointer to the output buffer to accumulate the taps into.
+  void AccumulateMultiTapData(const std::vector<size_t>& delays,
+                              const AudioBuffer& tap_gains,
+                              AudioBuffer* output);
+
  private:
+  // Returns the position in the delay line to begin reading a buffer delayed
+  // by |delay_samples| from.
+  size_t GetReadCursor(size_t delay_samples) const;
+
   // Maximum length of the delay to be applied (in samples).
   size_t max_delay_length_;
 
@@ -0,0 +1,75 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "dsp/delay_filter.h"
+
+#include <cmath>
+
+#include "benchmark/benchmark.h"
+#include "base/audio_buffer.h"
+#include "base/constants_and_types.h"
+#include "dsp/fractional_delay_table.h"
+#include "utils/benchmark_util.h"
+
+namespace vraudio {
+
+namespace {
+
+const size_t kFramesPerBuffer = 256;
+
+const size_t kMaxDelayLength = 48000;
+
+// Measures integer delays as a baseline.
+void BM_DelayFilterIntegerDelay(benchmark::State& state) {
+  DelayFilter delay(kMaxDelayLength, kFramesPerBuffer);
+  AudioBuffer input(kNumMonoChannels, kFramesPerBuffer);
+  FillWithNoise(&input);
+  AudioBuffer output(kNumMonoChannels, kFramesPerBuffer);
+  for (auto _ : state) {
+    delay.InsertData(input[0]);
+    delay.GetDelayedData(1000, &output[0]);
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(kFramesPerBuffer, &state);
+}
+BENCHMARK(BM_DelayFilterIntegerDelay);
+
+// Measures interpolated delays which are modulated in every buffer, as for a
+// moving sound object.
+void BM_DelayFilterInterpolatedDelay(benchmark::State& state) {
+  const FractionalDelayTable kernel_table;
+  DelayFilter delay(kMaxDelayLength, kFramesPerBuffer);
+  AudioBuffer input(kNumMonoChannels, kFramesPerBuffer);
+  FillWithNoise(&input);
+  AudioBuffer output(kNumMonoChannels, kFramesPerBuffer);
+  float previous_delay = 1000.0f;
+  size_t buffer = 0;
+  for (auto _ : state) {
+    const float delay_samples =
+        1000.0f + 50.0f * std::sin(0.1f * static_cast<float>(buffer++));
+    delay.InsertData(input[0]);
+    delay.GetInterpolatedDelayedData(previous_delay, delay_samples,
+                                     kernel_table, &output[0]);
+    previous_delay = delay_samples;
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(kFramesPerBuffer, &state);
+}
+BENCHMARK(BM_DelayFilterInterpolatedDelay);
+
+}  // namespace
+
+}  // namespace vraudio
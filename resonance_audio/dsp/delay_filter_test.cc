@@ -16,8 +16,12 @@ limitations under the License.
 
 #include "dsp/delay_filter.h"
 
+#include <cmath>
+#include <vector>
+
 #include "third_party/googletest/googletest/include/gtest/gtest.h"
 #include "base/constants_and_types.h"
+#include "dsp/fractional_delay_table.h"
 
 namespace vraudio {
 
@@ -192,6 +196,121 @@ TEST(DelayFilterTest, InitialSizeVsResizeTest) {
   }
 }
 
+// Tests that the multi-tap reader accumulates the same data as the scaled
+// outputs of |GetDelayedData|, including the taps wrapping around the end of
+// the delay line.
+TEST(DelayFilterTest, AccumulateMultiTapDataTest) {
+  const size_t kMaxDelayLength = 7;
+  const size_t kNumBuffers = 5;
+  const std::vector<size_t> kDelays = {0, 3, 7, 5};
+  const std::vector<std::vector<float>> kTapGains = {
+      {1.0f, 0.5f, 0.0f, -2.0f}, {0.0f, -1.0f, 0.25f, 3.0f}};
+
+  DelayFilter delay(kMaxDelayLength, kFramesPerBuffer);
+  AudioBuffer tap_gains(kTapGains.size(), kDelays.size());
+  tap_gains = kTapGains;
+  AudioBuffer input(kNumMonoChannels, kFramesPerBuffer);
+  AudioBuffer delayed(kNumMonoChannels, kFramesPerBuffer);
+  AudioBuffer output(kTapGains.size(), kFramesPerBuffer);
+  for (size_t buffer = 0; buffer < kNumBuffers; ++buffer) {
+    for (size_t frame = 0; frame < kFramesPerBuffer; ++frame) {
+      input[0][frame] = static_cast<float>(buffer * kFramesPerBuffer + frame);
+    }
+    delay.InsertData(input[0]);
+    output.Clear();
+    delay.AccumulateMultiTapData(kDelays, tap_gains, &output);
+
+    for (size_t channel = 0; channel < kTapGains.size(); ++channel) {
+      std::vector<float> expected(kFramesPerBuffer, 0.0f);
+      for (size_t tap = 0; tap < kDelays.size(); ++tap) {
+        delay.GetDelayedData(kDelays[tap], &delayed[0]);
+        for (size_t frame = 0; frame < kFramesPerBuffer; ++frame) {
+          expected[frame] += kTapGains[channel][tap] * delayed[0][frame];
+        }
+      }
+      for (size_t frame = 0; frame < kFramesPerBuffer; ++frame) {
+        EXPECT_NEAR(expected[frame], output[channel][frame], kEpsilonFloat);
+      }
+    }
+  }
+}
+
+// Tests that interpolated reads of integer delays match |GetDelayedData|.
+TEST(DelayFilterTest, InterpolatedIntegerDelayTest) {
+  const size_t kMaxDelayLength = 16;
+  const size_t kNumBuffers = 6;
+  const std::vector<float> kDelays = {4.0f, 4.0f, 9.0f, 9.0f, 12.0f, 12.0f};
+  const FractionalDelayTable kernel_table;
+
+  DelayFilter delay(kMaxDelayLength, kFramesPerBuffer2);
+  AudioBuffer input(kNumMonoChannels, kFramesPerBuffer2);
+  AudioBuffer expected(kNumMonoChannels, kFramesPerBuffer2);
+  AudioBuffer output(kNumMonoChannels, kFramesPerBuffer2);
+  for (size_t buffer = 0; buffer < kNumBuffers; ++buffer) {
+    for (size_t frame = 0; frame < kFramesPerBuffer2; ++frame) {
+      input[0][frame] = static_cast<float>(buffer * kFramesPerBuffer2 + frame);
+    }
+    delay.InsertData(input[0]);
+    const float previous_delay = kDelays[buffer == 0 ? 0 : buffer - 1];
+    if (previous_delay != kDelays[buffer]) {
+      continue;
+    }
+    delay.GetDelayedData(static_cast<size_t>(kDelays[buffer]), &expected[0]);
+    delay.GetInterpolatedDelayedData(previous_delay, kDelays[buffer],
+                                     kernel_table, &output[0]);
+    for (size_t frame = 0; frame < kFramesPerBuffer2; ++frame) {
+      EXPECT_NEAR(expected[0][frame], output[0][frame], kEpsilonFloat);
+    }
+  }
+}
+
+// Tests that a sinusoid is delayed by fractional delays, which are linearly
+// interpolated across the buffers, including wrapping around the delay line.
+TEST(DelayFilterTest, InterpolatedFractionalDelayTest) {
+  const size_t kMaxDelayLength = 64;
+  const size_t kNumBuffers = 40;
+  const float kAngularFrequency = 0.1f;
+  const float kMinDelay = 5.25f;
+  const float kDelayIncrement = 1.3f;
+  // Allowed deviation due to the finite length of the interpolation kernels.
+  const float kInterpolationEpsilon = 5e-3f;
+  const FractionalDelayTable kernel_table;
+
+  DelayFilter delay(kMaxDelayLength, kFramesPerBuffer2);
+  AudioBuffer input(kNumMonoChannels, kFramesPerBuffer2);
+  AudioBuffer output(kNumMonoChannels, kFramesPerBuffer2);
+  float previous_delay = kMinDelay;
+  for (size_t buffer = 0; buffer < kNumBuffers; ++buffer) {
+    for (size_t frame = 0; frame < kFramesPerBuffer2; ++frame) {
+      input[0][frame] = std::sin(
+          kAngularFrequency *
+          static_cast<float>(buffer * kFramesPerBuffer2 + frame));
+    }
+    delay.InsertData(input[0]);
+    // Sweep the delay up and down in the range [kMinDelay, 40].
+    const float delay_samples =
+        kMinDelay + std::fmod(kDelayIncrement * static_cast<float>(buffer),
+                              35.0f);
+    delay.GetInterpolatedDelayedData(previous_delay, delay_samples,
+                                     kernel_table, &output[0]);
+    // Skip the first buffers until the delay line has been filled.
+    if (buffer * kFramesPerBuffer2 >= kMaxDelayLength) {
+      for (size_t frame = 0; frame < kFramesPerBuffer2; ++frame) {
+        const float frame_delay =
+            previous_delay + (delay_samples - previous_delay) *
+                                 static_cast<float>(frame + 1) /
+                                 static_cast<float>(kFramesPerBuffer2);
+        const float expected = std::sin(
+            kAngularFrequency *
+            (static_cast<float>(buffer * kFramesPerBuffer2 + frame) -
+             frame_delay));
+        EXPECT_NEAR(expected, output[0][frame], kInterpolationEpsilon);
+      }
+    }
+    previous_delay = delay_samples;
+  }
+}
+
 }  // namespace
 
 }  // namespace vraudio
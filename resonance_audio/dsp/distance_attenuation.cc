@@ -20,6 +20,7 @@ limitations under the License.
 #include <cmath>
 
 #include "base/constants_and_types.h"
+#include "base/logging.h"
 
 namespace vraudio {
 
@@ -28,6 +29,12 @@ float ComputeLogarithmicDistanceAttenuation(
     const WorldPosition& source_position, float min_distance,
     float max_distance) {
   const float distance = (listener_position - source_position).norm();
+  return ComputeLogarithmicDistanceAttenuation(distance, min_distance,
+                                               max_distance);
+}
+
+float ComputeLogarithmicDistanceAttenuation(float distance, float min_distance,
+                                            float max_distance) {
   if (distance > max_distance) {
     return 0.0f;
   }
@@ -55,6 +62,12 @@ float ComputeLinearDistanceAttenuation(const WorldPosition& listener_position,
                                        const WorldPosition& source_position,
                                        float min_distance, float max_distance) {
   const float distance = (listener_position - source_position).norm();
+  return ComputeLinearDistanceAttenuation(distance, min_distance,
+                                          max_distance);
+}
+
+float ComputeLinearDistanceAttenuation(float distance, float min_distance,
+                                       float max_distance) {
   if (distance > max_distance) {
     return 0.0f;
   }
@@ -73,18 +86,63 @@ float ComputeLinearDistanceAttenuation(const WorldPosition& listener_position,
 float ComputeNearFieldEffectGain(const WorldPosition& listener_position,
                                  const WorldPosition& source_position) {
   const float distance = (listener_position - source_position).norm();
+  return ComputeNearFieldEffectGain(distance);
+}
+
+float ComputeNearFieldEffectGain(float distance) {
   if (distance < kNearFieldThreshold) {
     return (1.0f / std::max(distance, kMinNearFieldDistance)) - 1.0f;
   }
   return 0.0f;
 }
 
+void UpdateSourceGeometry(const WorldPosition& listener_position,
+                          const WorldRotation& listener_rotation,
+                          SourceParameters* parameters) {
+  const ObjectTransform& source_transform = parameters->object_transform;
+  SourceGeometry* geometry = &parameters->geometry;
+  const WorldPosition source_to_listener =
+      listener_position - source_transform.position;
+  if (!geometry->is_initialized) {
+    // Sources without history start at rest.
+    geometry->listener_to_source = -source_to_listener;
+    geometry->listener_rotation = listener_rotation;
+    geometry->is_initialized = true;
+  }
+  // Keep the transforms of the previous buffer for interpolation.
+  geometry->previous_listener_to_source = geometry->listener_to_source;
+  geometry->previous_listener_rotation = geometry->listener_rotation;
+  geometry->listener_to_source = -source_to_listener;
+  geometry->listener_rotation = listener_rotation;
+  geometry->distance = source_to_listener.norm();
+  // Rotate the relative positions into the listener and source orientations,
+  // see |GetRelativeDirection|.
+  geometry->direction_from_listener = SphericalAngle::FromWorldPosition(
+      listener_rotation.conjugate() * geometry->listener_to_source);
+  geometry->direction_from_source = SphericalAngle::FromWorldPosition(
+      source_transform.rotation.conjugate() * source_to_listener);
+}
+
+SphericalAngle InterpolateDirectionFromListener(const SourceGeometry& geometry,
+                                                float interpolation_factor) {
+  DCHECK_GE(interpolation_factor, 0.0f);
+  DCHECK_LE(interpolation_factor, 1.0f);
+  const WorldPosition listener_to_source =
+      geometry.previous_listener_to_source +
+      interpolation_factor * (geometry.listener_to_source -
+                              geometry.previous_listener_to_source);
+  const WorldRotation listener_rotation =
+      geometry.previous_listener_rotation.slerp(interpolation_factor,
+                                                geometry.listener_rotation);
+  return SphericalAngle::FromWorldPosition(listener_rotation.conjugate() *
+                                           listener_to_source);
+}
+
 void UpdateAttenuationParameters(float master_gain, float reflections_gain,
                                  float reverb_gain,
-                                 const WorldPosition& listener_position,
                                  SourceParameters* parameters) {
   // Compute distance attenuation.
-  const WorldPosition& source_position = parameters->object_transform.position;
+  const float distance = parameters->geometry.distance;
   const auto rolloff_model = parameters->distance_rolloff_model;
   const float min_distance = parameters->minimum_distance;
   const float max_distance = parameters->maximum_distance;
@@ -93,11 +151,11 @@ void UpdateAttenuationParameters(float master_gain, float reflections_gain,
   switch (rolloff_model) {
     case DistanceRolloffModel::kLogarithmic:
       distance_attenuation = ComputeLogarithmicDistanceAttenuation(
-          listener_position, source_position, min_distance, max_distance);
+          distance, min_distance, max_distance);
       break;
     case DistanceRolloffModel::kLinear:
       distance_attenuation = ComputeLinearDistanceAttenuation(
-          listener_position, source_position, min_distance, max_distance);
+          distance, min_distance, max_distance);
       break;
     case DistanceRolloffModel::kNone:
     default:
@@ -116,6 +174,32 @@ void UpdateAttenuationParameters(float master_gain, float reflections_gain,
       room_effects_attenuation * direct_attenuation * reflections_gain;
   parameters->attenuations[AttenuationType::kReverb] =
       room_effects_attenuation * input_gain * reverb_gain;
+  parameters->is_clustered = parameters->enable_clustering &&
+                             distance >= kMinSourceClusteringDistance;
+}
+
+float ComputeRoomZoneAttenuation(AttenuationType attenuation_type,
+                                 float room_zone_gain, RoomZoneId room_zone_id,
+                                 const SourceParameters& parameters) {
+  DCHECK_GE(room_zone_id, 0);
+  DCHECK_LT(static_cast<size_t>(room_zone_id), kMaxNumRoomZones);
+  // Reflections follow the distance attenuation of the direct sound while the
+  // reverb is independent of the source position, see
+  // |UpdateAttenuationParameters|.
+  float source_attenuation = 0.0f;
+  switch (attenuation_type) {
+    case AttenuationType::kReflections:
+      source_attenuation = parameters.attenuations[AttenuationType::kDirect];
+      break;
+    case AttenuationType::kReverb:
+      source_attenuation = parameters.attenuations[AttenuationType::kInput];
+      break;
+    default:
+      LOG(FATAL) << "Unsupported room zone attenuation type";
+      break;
+  }
+  return parameters.room_effects_gain * source_attenuation * room_zone_gain *
+         parameters.room_zone_send_gains[room_zone_id];
 }
 
 }  // namespace vraudio
@@ -39,6 +39,18 @@ float ComputeLogarithmicDistanceAttenuation(
     const WorldPosition& source_position, float min_distance,
     float max_distance);
 
+// Returns the logarithmic distance attenuation for a given listener/source
+// |distance|, see above.
+//
+// @param distance Distance between the listener and the source.
+// @param min_distance The minimum distance at which distance attenuation is
+//     applied.
+// @param max_distance The maximum distance at which the direct sound has a gain
+//     of 0.0.
+// @return Attenuation (gain) value in range [0.0f, 1.0f].
+float ComputeLogarithmicDistanceAttenuation(float distance, float min_distance,
+                                            float max_distance);
+
 // Returns the distance attenuation for |source_position| with respect to
 // |listener_position|. The amplitude will decrease linearly between
 // |min_distance| and |max_distance| from 1.0 to 0.0.
@@ -54,6 +66,18 @@ float ComputeLinearDistanceAttenuation(const WorldPosition& listener_position,
                                        const WorldPosition& source_position,
                                        float min_distance, float max_distance);
 
+// Returns the linear distance attenuation for a given listener/source
+// |distance|, see above.
+//
+// @param distance Distance between the listener and the source.
+// @param min_distance The minimum distance at which distance attenuation is
+//     applied.
+// @param max_distance The maximum distance at which the direct sound has a gain
+//     of 0.0.
+// @return Attenuation (gain) value in range [0.0f, 1.0f].
+float ComputeLinearDistanceAttenuation(float distance, float min_distance,
+                                       float max_distance);
+
 // Calculates the gain to be applied to the near field compensating stereo mix.
 // This function will return 0.0f for all sources further away than one meter
 // and will return a value between 0.0 and 9.0 for sources as they approach
@@ -65,18 +89,62 @@ float ComputeLinearDistanceAttenuation(const WorldPosition& listener_position,
 float ComputeNearFieldEffectGain(const WorldPosition& listener_position,
                                  const WorldPosition& source_position);
 
-// Calculates and updates gain attenuations of the given source |parameters|.
+// Calculates the near field effect gain for a given listener/source
+// |distance|, see above.
+//
+// @param distance Distance between the listener and the source.
+// @return Gain value in range [0.0f, 9.0f].
+float ComputeNearFieldEffectGain(float distance);
+
+// Calculates and updates the listener relative geometry of the given source
+// |parameters|. This must be called once per buffer before any other per-source
+// computation, so that the directions and distance are only calculated once.
+//
+// @param listener_position World position of the listener.
+// @param listener_rotation World rotation of the listener.
+// @param parameters Source parameters to store the geometry into.
+void UpdateSourceGeometry(const WorldPosition& listener_position,
+                          const WorldRotation& listener_rotation,
+                          SourceParameters* parameters);
+
+// Returns the direction of the source relative to the listener at a fraction
+// of the current buffer. The listener and source positions are interpolated
+// linearly and the listener rotation spherically between the previous and the
+// current buffer.
+//
+// @param geometry Source geometry updated by |UpdateSourceGeometry|.
+// @param interpolation_factor Fraction of the buffer in range [0, 1], where 0
+//     corresponds to the previous and 1 to the current buffer.
+// @return Interpolated direction of the source relative to the listener.
+SphericalAngle InterpolateDirectionFromListener(const SourceGeometry& geometry,
+                                                float interpolation_factor);
+
+// Calculates and updates gain attenuations of the given source |parameters|,
+// and whether the source is clustered in the current buffer. The source
+// geometry must have been updated by |UpdateSourceGeometry| beforehand.
 //
 // @param master_gain Global gain adjustment in amplitude.
 // @param reflections_gain Reflections gain in amplitude.
 // @param reverb_gain Reverb gain in amplitude.
-// @param listener_position World position of the listener.
 // @param parameters Source parameters to apply the gain attenuations into.
 void UpdateAttenuationParameters(float master_gain, float reflections_gain,
                                  float reverb_gain,
-                                 const WorldPosition& listener_position,
                                  SourceParameters* parameters);
 
+// Calculates the reflections or reverb gain attenuation of the given source
+// |parameters| into a room zone. The direct and input attenuations must have
+// been updated by |UpdateAttenuationParameters| beforehand.
+//
+// @param attenuation_type Either |kReflections| or |kReverb|.
+// @param room_zone_gain Reflections or reverb gain of the room zone in
+//     amplitude.
+// @param room_zone_id Id of room zone.
+// @param parameters Source parameters.
+// @return Gain attenuation into the room zone.
+float ComputeRoomZoneAttenuation(AttenuationType attenuation_type,
+                                 float room_zone_gain, RoomZoneId room_zone_id,
+                                 const SourceParameters& parameters);
+
 }  // namespace vraudio
 
 #endif  // RESONANCE_AUDIO_DSP_DISTANCE_ATTENUATION_H_
@@ -19,6 +19,7 @@ limitations under the License.
 #include "third_party/googletest/googletest/include/gtest/gtest.h"
 #include "base/constants_and_types.h"
 #include "base/misc_math.h"
+#include "base/spherical_angle.h"
 
 namespace vraudio {
 
@@ -98,8 +99,10 @@ TEST(DistanceAttenuationTest, UpdateAttenuationParametersTest) {
   parameters.object_transform.position = kSourcePosition;
   parameters.room_effects_gain = kRoomEffectsGain;
   // Update the gain attenuation parameters.
+  UpdateSourceGeometry(kListenerPosition, WorldRotation::Identity(),
+                       &parameters);
   UpdateAttenuationParameters(kMasterGain, kReflectionsGain, kReverbGain,
-                              kListenerPosition, &parameters);
+                              &parameters);
   // Check the attenuation parameters against the pre-computed values.
   const size_t num_attenuations =
       static_cast<size_t>(AttenuationType::kNumAttenuationTypes);
@@ -112,6 +115,147 @@ TEST(DistanceAttenuationTest, UpdateAttenuationParametersTest) {
   }
 }
 
+// Tests that the source geometry matches the relative directions and distance
+// computed from the listener and source transforms.
+TEST(DistanceAttenuationTest, UpdateSourceGeometryTest) {
+  const WorldPosition kListenerPosition(0.5f, -1.0f, 2.0f);
+  const WorldRotation kListenerRotation(
+      AngleAxisf(0.3f, WorldPosition(0.0f, 1.0f, 0.0f).normalized()));
+  const WorldPosition kSourcePosition(-1.0f, 0.5f, -2.0f);
+  const WorldRotation kSourceRotation(
+      AngleAxisf(1.2f, WorldPosition(1.0f, 1.0f, 0.0f).normalized()));
+
+  SourceParameters parameters;
+  parameters.object_transform.position = kSourcePosition;
+  parameters.object_transform.rotation = kSourceRotation;
+  UpdateSourceGeometry(kListenerPosition, kListenerRotation, &parameters);
+
+  EXPECT_NEAR((kSourcePosition - kListenerPosition).norm(),
+              parameters.geometry.distance, kEpsilonFloat);
+  WorldPosition relative_direction;
+  GetRelativeDirection(kListenerPosition, kListenerRotation, kSourcePosition,
+                       &relative_direction);
+  const SphericalAngle direction_from_listener =
+      SphericalAngle::FromWorldPosition(relative_direction);
+  EXPECT_NEAR(direction_from_listener.azimuth(),
+              parameters.geometry.direction_from_listener.azimuth(),
+              kEpsilonFloat);
+  EXPECT_NEAR(direction_from_listener.elevation(),
+              parameters.geometry.direction_from_listener.elevation(),
+              kEpsilonFloat);
+  GetRelativeDirection(kSourcePosition, kSourceRotation, kListenerPosition,
+                       &relative_direction);
+  const SphericalAngle direction_from_source =
+      SphericalAngle::FromWorldPosition(relative_direction);
+  EXPECT_NEAR(direction_from_source.azimuth(),
+              parameters.geometry.direction_from_source.azimuth(),
+              kEpsilonFloat);
+  EXPECT_NEAR(direction_from_source.elevation(),
+              parameters.geometry.direction_from_source.elevation(),
+              kEpsilonFloat);
+}
+
+// Tests that the interpolated source direction matches the directions computed
+// from the interpolated listener and source transforms.
+TEST(DistanceAttenuationTest, InterpolateDirectionFromListenerTest) {
+  const WorldPosition kListenerPositions[] = {WorldPosition(0.5f, -1.0f, 2.0f),
+                                              WorldPosition(0.0f, 0.0f, 1.0f)};
+  const WorldRotation kListenerRotations[] = {
+      WorldRotation(
+          AngleAxisf(0.3f, WorldPosition(0.0f, 1.0f, 0.0f).normalized())),
+      WorldRotation(
+          AngleAxisf(0.9f, WorldPosition(0.2f, 1.0f, 0.0f).normalized()))};
+  const WorldPosition kSourcePositions[] = {WorldPosition(-1.0f, 0.5f, -2.0f),
+                                            WorldPosition(2.0f, 0.0f, -1.0f)};
+  const float kInterpolationFactors[] = {0.0f, 0.25f, 0.5f, 1.0f};
+
+  SourceParameters parameters;
+  for (size_t update = 0; update < 2; ++update) {
+    parameters.object_transform.position = kSourcePositions[update];
+    UpdateSourceGeometry(kListenerPositions[update], kListenerRotations[update],
+                         &parameters);
+    // Sources start at rest, then move from the previous to the current
+    // transforms.
+    const size_t previous = update == 0 ? 0 : update - 1;
+    for (const float interpolation_factor : kInterpolationFactors) {
+      const WorldPosition listener_position =
+          kListenerPositions[previous] +
+          interpolation_factor *
+              (kListenerPositions[update] - kListenerPositions[previous]);
+      const WorldPosition source_position =
+          kSourcePositions[previous] +
+          interpolation_factor *
+              (kSourcePositions[update] - kSourcePositions[previous]);
+      const WorldRotation listener_rotation(
+          kListenerRotations[previous].slerp(interpolation_factor,
+                                             kListenerRotations[update]));
+      WorldPosition relative_direction;
+      GetRelativeDirection(listener_position, listener_rotation,
+                           source_position, &relative_direction);
+      const SphericalAngle expected_direction =
+          SphericalAngle::FromWorldPosition(relative_direction);
+      const SphericalAngle direction = InterpolateDirectionFromListener(
+          parameters.geometry, interpolation_factor);
+      EXPECT_NEAR(expected_direction.azimuth(), direction.azimuth(), 1e-5f);
+      EXPECT_NEAR(expected_direction.elevation(), direction.elevation(),
+                  1e-5f);
+    }
+  }
+  const SphericalAngle direction =
+      InterpolateDirectionFromListener(parameters.geometry, 1.0f);
+  EXPECT_NEAR(parameters.geometry.direction_from_listener.azimuth(),
+              direction.azimuth(), kEpsilonFloat);
+  EXPECT_NEAR(parameters.geometry.direction_from_listener.elevation(),
+              direction.elevation(), kEpsilonFloat);
+}
+
+// Tests that the room zone attenuations match the global room effects
+// attenuations for the default zone, and scale with the zone and send gains.
+TEST(DistanceAttenuationTest, ComputeRoomZoneAttenuationTest) {
+  const float kMasterGain = 0.5f;
+  const float kReflectionsGain = 0.5f;
+  const float kReverbGain = 2.0f;
+  const WorldPosition kListenerPosition(0.0f, 0.0f, 0.0f);
+  const float kDistanceAttenuation = 0.2f;
+  const float kRoomEffectsGain = 0.25f;
+  const RoomZoneId kRoomZoneId = 3;
+  const float kSendGain = 0.5f;
+
+  SourceParameters parameters;
+  parameters.distance_rolloff_model = DistanceRolloffModel::kNone;
+  parameters.distance_attenuation = kDistanceAttenuation;
+  parameters.room_effects_gain = kRoomEffectsGain;
+  UpdateSourceGeometry(kListenerPosition, WorldRotation::Identity(),
+                       &parameters);
+  UpdateAttenuationParameters(kMasterGain, kReflectionsGain, kReverbGain,
+                              &parameters);
+
+  EXPECT_EQ(parameters.attenuations[AttenuationType::kReflections],
+            ComputeRoomZoneAttenuation(AttenuationType::kReflections,
+                                       kReflectionsGain, kDefaultRoomZoneId,
+                                       parameters));
+  EXPECT_EQ(parameters.attenuations[AttenuationType::kReverb],
+            ComputeRoomZoneAttenuation(AttenuationType::kReverb, kReverbGain,
+                                       kDefaultRoomZoneId, parameters));
+
+  // Sources are not routed into other zones by default.
+  EXPECT_EQ(0.0f, ComputeRoomZoneAttenuation(AttenuationType::kReverb,
+                                             kReverbGain, kRoomZoneId,
+                                             parameters));
+  parameters.room_zone_send_gains[kRoomZoneId] = kSendGain;
+  EXPECT_NEAR(kSendGain * parameters.attenuations[AttenuationType::kReverb],
+              ComputeRoomZoneAttenuation(AttenuationType::kReverb, kReverbGain,
+                                         kRoomZoneId, parameters),
+              kEpsilonFloat);
+  const float kZoneReflectionsGain = 0.25f;
+  EXPECT_NEAR(kSendGain * kZoneReflectionsGain / kReflectionsGain *
+                  parameters.attenuations[AttenuationType::kReflections],
+              ComputeRoomZoneAttenuation(AttenuationType::kReflections,
+                                         kZoneReflectionsGain, kRoomZoneId,
+                                         parameters),
+              kEpsilonFloat);
+}
+
 // Tests the near field effects gain computation method against the pre-computed
 // results.
 TEST(NearFieldEffectTest, ComputeNearFieldEffectTest) {
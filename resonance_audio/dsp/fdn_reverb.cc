@@ -0,0 +1,362 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include "dsp/fdn_reverb.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "base/constants_and_types.h"
+#include "base/logging.h"
+#include "base/simd_utils.h"
+#include "dsp/spectral_reverb.h"
+
+namespace vraudio {
+
+namespace {
+
+// Number of delay lines in the network.
+const size_t kNumDelayLines = 16;
+
+// Mutually prime delay line lengths at 48kHz, spanning roughly 21ms to 45ms.
+const size_t kDelayLengths48kHz[kNumDelayLines] = {
+    1031, 1093, 1163, 1229, 1303, 1373, 1447, 1523,
+    1601, 1669, 1747, 1823, 1901, 1987, 2069, 2153};
+
+// Sampling rate for which the delay line lengths are specified.
+const float kDelayLengthSampleRate = 48000.0f;
+
+// Minimum reverb time at 48kHz, matching the range supported by
+// |SpectralReverb|.
+const float kMinReverbTime48kHz = 0.15f;
+
+// The octave bands are grouped into low, mid and high frequency bands, each of
+// which sets the absorption of one section of the absorption filters.
+const size_t kFirstMidOctaveBand = 4;
+const size_t kFirstHighOctaveBand = 7;
+
+// Transition frequencies of the absorption shelving filters, halfway between
+// the centre frequencies of the adjacent octave band groups.
+const float kLowShelfFrequency = 353.55f;
+const float kHighShelfFrequency = 2828.43f;
+
+// Normalization of the 16 x 16 Hadamard feedback matrix, 1 / sqrt(16).
+const float kHadamardScale = 0.25f;
+
+// Signs with which the input is fed into the delay lines. These are chosen not
+// to match any row of the Hadamard matrix, such that the input is spread over
+// all delay lines after the first pass through the feedback matrix.
+const float kInputSigns[kNumDelayLines] = {1.0f,  -1.0f, -1.0f, 1.0f,
+                                           -1.0f, 1.0f,  1.0f,  1.0f,
+                                           -1.0f, -1.0f, 1.0f,  -1.0f,
+                                           1.0f,  1.0f,  -1.0f, -1.0f};
+
+// Returns the sign of a delay line in one of the two mutually orthogonal rows
+// of the Hadamard matrix which are used as the left and right output taps.
+inline float GetOutputSign(size_t line, size_t channel) {
+  return ((line >> channel) & 1U) != 0 ? -1.0f : 1.0f;
+}
+
+// Converts a level in decibels to a linear amplitude.
+inline float AmplitudeFromDecibels(float decibels) {
+  return std::pow(10.0f, decibels / 20.0f);
+}
+
+// Returns the mean attenuation per delay line pass in decibels over a group of
+// octave bands.
+//
+// @param delay Delay line length in frames.
+// @param sample_rate System sample rate.
+// @param min_rt60 Minimum reverberation time in seconds.
+// @param rt60_values Reverberation times of the octave bands in the group.
+// @param num_bands Number of octave bands in the group.
+// @return Mean attenuation in decibels.
+float GetMeanAttenuationDb(size_t delay, float sample_rate, float min_rt60,
+                           const float* rt60_values, size_t num_bands) {
+  float attenuation_db = 0.0f;
+  for (size_t band = 0; band < num_bands; ++band) {
+    const float rt60 = std::max(rt60_values[band], min_rt60);
+    attenuation_db -= 60.0f * static_cast<float>(delay) / (sample_rate * rt60);
+  }
+  return attenuation_db / static_cast<float>(num_bands);
+}
+
+// Computes a first order shelving filter with unity gain on one side of the
+// transition frequency, via the bilinear transform of
+//   H(s) = (s + w * sqrt(g)) / (s + w / sqrt(g))  (low shelf, DC gain g) or
+//   H(s) = (s * sqrt(g) + w) / (s / sqrt(g) + w)  (high shelf, HF gain g).
+// The gain at the transition frequency is sqrt(g).
+//
+// @param gain Linear gain of the shelf.
+// @param frequency Transition frequency in Hz.
+// @param sample_rate System sample rate.
+// @param low_shelf True for a low shelf, false for a high shelf.
+// @param numerator Receives the two numerator coefficients.
+// @param denominator Receives the first order denominator coefficient, the
+//     zeroth order coefficient being normalized to one.
+void ComputeFirstOrderShelf(float gain, float frequency, float sample_rate,
+                            bool low_shelf, float numerator[2],
+                            float* denominator) {
+  const float t = std::tan(kPi * frequency / sample_rate);
+  const float sqrt_gain = std::sqrt(gain);
+  float a0;
+  if (low_shelf) {
+    numerator[0] = 1.0f + sqrt_gain * t;
+    numerator[1] = sqrt_gain * t - 1.0f;
+    a0 = 1.0f + t / sqrt_gain;
+    *denominator = t / sqrt_gain - 1.0f;
+  } else {
+    numerator[0] = sqrt_gain + t;
+    numerator[1] = t - sqrt_gain;
+    a0 = 1.0f / sqrt_gain + t;
+    *denominator = t - 1.0f / sqrt_gain;
+  }
+  numerator[0] /= a0;
+  numerator[1] /= a0;
+  *denominator /= a0;
+}
+
+}  // namespace
+
+FdnReverb::FdnReverb(int sample_rate, size_t frames_per_buffer)
+    : sample_rate_(sample_rate),
+      frames_per_buffer_(frames_per_buffer),
+      delays_(kNumDelayLines),
+      max_chunk_length_(0),
+      write_index_(0),
+      chunk_lines_(kNumDelayLines + 1),
+      absorption_filters_(kNumDelayLines),
+      gain_(1.0f),
+      level_gain_(0.0f),
+      output_gain_(0.0f),
+      is_gain_near_zero_(false),
+      is_rt60_near_zero_(true) {
+  DCHECK_GT(sample_rate, 0);
+  DCHECK_GT(frames_per_buffer_, 0U);
+  const float delay_scale =
+      static_cast<float>(sample_rate_) / kDelayLengthSampleRate;
+  for (size_t i = 0; i < kNumDelayLines; ++i) {
+    delays_[i] = std::max<size_t>(
+        1, static_cast<size_t>(
+               std::round(static_cast<float>(kDelayLengths48kHz[i]) *
+                          delay_scale)));
+  }
+  max_chunk_length_ = std::min(delays_.front(), frames_per_buffer_);
+  delay_lines_ = AudioBuffer(kNumDelayLines, delays_.back());
+  chunk_buffer_ = AudioBuffer(kNumDelayLines + 1, max_chunk_length_);
+  for (size_t i = 0; i < chunk_lines_.size(); ++i) {
+    chunk_lines_[i] = chunk_buffer_[i].begin();
+  }
+  chunk_output_ = AudioBuffer(kNumStereoChannels, max_chunk_length_);
+  for (AbsorptionFilter& filter : absorption_filters_) {
+    filter.b0 = filter.b1 = filter.b2 = filter.a1 = filter.a2 = 0.0f;
+  }
+  ClearState();
+}
+
+void FdnReverb::SetGain(float gain) {
+  DCHECK_GE(gain, 0.0f);
+  gain_ = gain;
+  output_gain_ = gain_ * level_gain_;
+  // If the gain is less than -60dB we will bypass all processing.
+  is_gain_near_zero_ = gain <= kNegative60dbInAmplitude;
+  // If we are to bypass processing we clear the delay lines so that we don't
+  // output an old tail when the reverb is restarted.
+  if (is_gain_near_zero_ || is_rt60_near_zero_) {
+    ClearState();
+  }
+}
+
+void FdnReverb::SetRt60PerOctaveBand(const float* rt60_values) {
+  DCHECK(rt60_values);
+  const float sample_rate_float = static_cast<float>(sample_rate_);
+  const float min_rt60 =
+      kMinReverbTime48kHz * kDelayLengthSampleRate / sample_rate_float;
+  is_rt60_near_zero_ =
+      *std::max_element(rt60_values, rt60_values + kNumReverbOctaveBands) <
+      min_rt60;
+  if (is_gain_near_zero_ || is_rt60_near_zero_) {
+    ClearState();
+    return;
+  }
+  const size_t num_low_bands = kFirstMidOctaveBand;
+  const size_t num_mid_bands = kFirstHighOctaveBand - kFirstMidOctaveBand;
+  const size_t num_high_bands = kNumReverbOctaveBands - kFirstHighOctaveBand;
+  float network_power = 0.0f;
+  for (size_t i = 0; i < kNumDelayLines; ++i) {
+    // The attenuation per pass is proportional to the delay line length, such
+    // that all lines decay at the same rate.
+    const float low_db = GetMeanAttenuationDb(
+        delays_[i], sample_rate_float, min_rt60, rt60_values, num_low_bands);
+    const float mid_db = GetMeanAttenuationDb(
+        delays_[i], sample_rate_float, min_rt60,
+        rt60_values + kFirstMidOctaveBand, num_mid_bands);
+    const float high_db = GetMeanAttenuationDb(
+        delays_[i], sample_rate_float, min_rt60,
+        rt60_values + kFirstHighOctaveBand, num_high_bands);
+    float low_numerator[2];
+    float low_denominator;
+    ComputeFirstOrderShelf(AmplitudeFromDecibels(low_db - mid_db),
+                           kLowShelfFrequency, sample_rate_float,
+                           true /* low_shelf */, low_numerator,
+                           &low_denominator);
+    float high_numerator[2];
+    float high_denominator;
+    ComputeFirstOrderShelf(AmplitudeFromDecibels(high_db - mid_db),
+                           kHighShelfFrequency, sample_rate_float,
+                           false /* low_shelf */, high_numerator,
+                           &high_denominator);
+    // Cascade both shelves with the mid band gain and the normalization of the
+    // feedback matrix.
+    const float mid_gain = AmplitudeFromDecibels(mid_db);
+    const float gain = mid_gain * kHadamardScale;
+    AbsorptionFilter* filter = &absorption_filters_[i];
+    filter->b0 = gain * low_numerator[0] * high_numerator[0];
+    filter->b1 = gain * (low_numerator[0] * high_numerator[1] +
+                         low_numerator[1] * high_numerator[0]);
+    filter->b2 = gain * low_numerator[1] * high_numerator[1];
+    filter->a1 = low_denominator + high_denominator;
+    filter->a2 = low_denominator * high_denominator;
+    // Each line is fed the input once per pass, and the orthonormal feedback
+    // matrix preserves the power of the attenuated lines. A line therefore
+    // holds 1 / (1 - g^2) times the input power for its mid band gain g, and
+    // contributes it with the squared output tap gain.
+    const float mid_power = mid_gain * mid_gain;
+    network_power += kHadamardScale * kHadamardScale * mid_power /
+                     (1.0f - mid_power);
+  }
+  // Match the mid band output power to the |SpectralReverb| for the same
+  // reverberation times.
+  float spectral_power = 0.0f;
+  for (size_t band = kFirstMidOctaveBand; band < kFirstHighOctaveBand;
+       ++band) {
+    spectral_power += SpectralReverb::GetPowerGain(
+        std::max(rt60_values[band], min_rt60), sample_rate_);
+  }
+  spectral_power /= static_cast<float>(num_mid_bands);
+  level_gain_ = std::sqrt(spectral_power / network_power);
+  output_gain_ = gain_ * level_gain_;
+}
+
+void FdnReverb::Process(const AudioBuffer::Channel& input,
+                        AudioBuffer::Channel* left_out,
+                        AudioBuffer::Channel* right_out) {
+  DCHECK(left_out);
+  DCHECK(right_out);
+  DCHECK_EQ(input.size(), left_out->size());
+  DCHECK_EQ(input.size(), right_out->size());
+  DCHECK_EQ(input.size(), frames_per_buffer_);
+
+  if (is_gain_near_zero_ || is_rt60_near_zero_) {
+    left_out->Clear();
+    right_out->Clear();
+    return;
+  }
+
+  for (size_t offset = 0; offset < input.size();
+       offset += max_chunk_length_) {
+    const size_t length = std::min(max_chunk_length_, input.size() - offset);
+    ProcessChunk(length, input.begin() + offset, left_out->begin() + offset,
+                 right_out->begin() + offset);
+  }
+}
+
+void FdnReverb::ProcessChunk(size_t length, const float* input,
+                             float* left_out, float* right_out) {
+  DCHECK_LE(length, max_chunk_length_);
+  const size_t delay_line_length = delay_lines_.num_frames();
+
+  // Read the delay line outputs. As no delay is shorter than
+  // |max_chunk_length_|, these were all written by previous chunks.
+  for (size_t i = 0; i < kNumDelayLines; ++i) {
+    const size_t read_index =
+        (write_index_ + delay_line_length - delays_[i]) % delay_line_length;
+    const size_t first_length =
+        std::min(length, delay_line_length - read_index);
+    const float* delay_line = delay_lines_[i].begin();
+    std::copy_n(delay_line + read_index, first_length, chunk_lines_[i]);
+    std::copy_n(delay_line, length - first_length,
+                chunk_lines_[i] + first_length);
+  }
+
+  // Apply the absorption filters.
+  for (size_t i = 0; i < kNumDelayLines; ++i) {
+    AbsorptionFilter* filter = &absorption_filters_[i];
+    float* line = chunk_lines_[i];
+    for (size_t frame = 0; frame < length; ++frame) {
+      const float x = line[frame];
+      const float y = filter->b0 * x + filter->state_0;
+      filter->state_0 = filter->b1 * x - filter->a1 * y + filter->state_1;
+      filter->state_1 = filter->b2 * x - filter->a2 * y;
+      line[frame] = y;
+    }
+  }
+
+  // Tap the stereo output from two orthogonal combinations of the lines.
+  for (size_t channel = 0; channel < kNumStereoChannels; ++channel) {
+    float* output = chunk_output_[channel].begin();
+    ScalarMultiply(length, GetOutputSign(0, channel) * output_gain_,
+                   chunk_lines_[0], output);
+    for (size_t i = 1; i < kNumDelayLines; ++i) {
+      ScalarMultiplyAndAccumulate(
+          length, GetOutputSign(i, channel) * output_gain_, chunk_lines_[i],
+          output);
+    }
+  }
+  std::copy_n(chunk_output_[0].begin(), length, left_out);
+  std::copy_n(chunk_output_[1].begin(), length, right_out);
+
+  // Mix the lines with an in place fast Walsh-Hadamard transform. Each
+  // butterfly writes the sum into the spare line, which then takes the place of
+  // the first operand.
+  float** spare_line = &chunk_lines_[kNumDelayLines];
+  for (size_t half = 1; half < kNumDelayLines; half *= 2) {
+    for (size_t block = 0; block < kNumDelayLines; block += 2 * half) {
+      for (size_t i = block; i < block + half; ++i) {
+        float* first = chunk_lines_[i];
+        float* second = chunk_lines_[i + half];
+        AddPointwise(length, first, second, *spare_line);
+        SubtractPointwise(length, second, first, second);
+        std::swap(chunk_lines_[i], *spare_line);
+      }
+    }
+  }
+
+  // Feed in the input and write the lines back into the delay lines.
+  for (size_t i = 0; i < kNumDelayLines; ++i) {
+    ScalarMultiplyAndAccumulate(length, kInputSigns[i], input,
+                                chunk_lines_[i]);
+    const size_t first_length =
+        std::min(length, delay_line_length - write_index_);
+    float* delay_line = delay_lines_[i].begin();
+    std::copy_n(chunk_lines_[i], first_length, delay_line + write_index_);
+    std::copy_n(chunk_lines_[i] + first_length, length - first_length,
+                delay_line);
+  }
+  write_index_ = (write_index_ + length) % delay_line_length;
+}
+
+void FdnReverb::ClearState() {
+  delay_lines_.Clear();
+  write_index_ = 0;
+  for (AbsorptionFilter& filter : absorption_filters_) {
+    filter.state_0 = 0.0f;
+    filter.state_1 = 0.0f;
+  }
+}
+
+}  // namespace vraudio
@@ -0,0 +1,138 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#ifndef RESONANCE_AUDIO_DSP_FDN_REVERB_H_
+#define RESONANCE_AUDIO_DSP_FDN_REVERB_H_
+
+#include <vector>
+
+#include "base/audio_buffer.h"
+
+namespace vraudio {
+
+// Implements a feedback delay network reverb producing a decorrelated stereo
+// output. Sixteen delay lines are mixed by a Hadamard matrix and attenuated by
+// per line absorption filters matching the reverberation times in low, mid and
+// high frequency octave band groups. Unlike |SpectralReverb| it has a constant
+// per sample cost and adds no buffering latency. See:
+// [1] J.-M. Jot, A. Chaigne, "Digital Delay Networks for Designing Artificial
+//     Reverberators", 90th AES Convention, 1991.
+class FdnReverb {
+ public:
+  // Constructs a feedback delay network reverb.
+  //
+  // @param sample_rate The system sample rate.
+  // @param frames_per_buffer System frames per buffer of input and output.
+  FdnReverb(int sample_rate, size_t frames_per_buffer);
+
+  // Sets the overall gain to be applied to the output of the reverb.
+  //
+  // @param gain Gain to be applied to the reverb output, min value 0.0f.
+  void SetGain(float gain);
+
+  // Sets the |FdnReverb|'s reverberation times in different frequency bands.
+  // Processing is bypassed when all times are below the range supported by
+  // |SpectralReverb|, i.e. (0.15 * 48000 / |sample_rate|)s.
+  //
+  // @param rt60_values |kNumReverbOctaveBands| values denoting the
+  //     reverberation decay time to -60dB in octave bands starting at
+  //     |kLowestOctaveBand|.
+  void SetRt60PerOctaveBand(const float* rt60_values);
+
+  // Applies reverb to an input channel of audio data and produces a stereo
+  // output.
+  //
+  // @param input Mono input data.
+  // @param left_out Left channel of reverberated output.
+  // @param right_out Right channel of reverberated output.
+  void Process(const AudioBuffer::Channel& input,
+               AudioBuffer::Channel* left_out, AudioBuffer::Channel* right_out);
+
+ private:
+  // Coefficients and state of a delay line absorption filter, implemented as a
+  // biquad in transposed direct form II.
+  struct AbsorptionFilter {
+    float b0;
+    float b1;
+    float b2;
+    float a1;
+    float a2;
+    float state_0;
+    float state_1;
+  };
+
+  // Processes a chunk of at most |max_chunk_length_| frames.
+  //
+  // @param length Number of frames to process.
+  // @param input Pointer to |length| frames of mono input.
+  // @param left_out Pointer to |length| frames of left output.
+  // @param right_out Pointer to |length| frames of right output.
+  void ProcessChunk(size_t length, const float* input, float* left_out,
+                    float* right_out);
+
+  // Clears the delay lines and the absorption filter states.
+  void ClearState();
+
+  // System sample rate.
+  const int sample_rate_;
+
+  // System frames per buffer.
+  const size_t frames_per_buffer_;
+
+  // Delay line lengths in frames.
+  std::vector<size_t> delays_;
+
+  // Maximum number of frames processed at once, i.e. the shortest delay, such
+  // that the delay line outputs of a chunk never depend on its own inputs.
+  size_t max_chunk_length_;
+
+  // Circular delay lines, one channel per line, and the shared write index.
+  AudioBuffer delay_lines_;
+  size_t write_index_;
+
+  // Delay line outputs of the current chunk, one channel per line, plus one
+  // spare channel used by the in place Hadamard transform.
+  AudioBuffer chunk_buffer_;
+
+  // Channel pointers into |chunk_buffer_|, permuted by the Hadamard transform.
+  std::vector<float*> chunk_lines_;
+
+  // Per delay line absorption filters.
+  std::vector<AbsorptionFilter> absorption_filters_;
+
+  // Stereo output of the current chunk.
+  AudioBuffer chunk_output_;
+
+  // Gain set by the user.
+  float gain_;
+
+  // Gain matching the output level to |SpectralReverb| for the current
+  // reverberation times.
+  float level_gain_;
+
+  // Output gain, i.e. the product of |gain_| and |level_gain_|.
+  float output_gain_;
+
+  // Processing of the reverb is bypassed when the reverberation times are all
+  // below the supported range OR when the gain is set to near zero.
+  bool is_gain_near_zero_;
+  bool is_rt60_near_zero_;
+};
+
+}  // namespace vraudio
+
+#endif  // RESONANCE_AUDIO_DSP_FDN_REVERB_H_
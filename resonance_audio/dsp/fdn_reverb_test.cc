@@ -0,0 +1,308 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include "dsp/fdn_reverb.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+#include "base/constants_and_types.h"
+#include "dsp/biquad_filter.h"
+#include "dsp/filter_coefficient_generators.h"
+#include "dsp/spectral_reverb.h"
+#include "dsp/utils.h"
+
+namespace vraudio {
+
+namespace {
+
+const size_t kFramesPerBuffer32 = 32;
+const size_t kFramesPerBuffer64 = 64;
+const size_t kFramesPerBuffer512 = 512;
+const size_t kFramesPerBuffer713 = 713;
+const int kSampleFrequency24 = 24000;
+const int kSampleFrequency48 = 48000;
+
+// Renders |num_frames| of the impulse response of |reverb|.
+void ImpulseResponse(size_t num_frames, size_t frames_per_buffer,
+                     FdnReverb* reverb, std::vector<float>* left_response,
+                     std::vector<float>* right_response) {
+  AudioBuffer input(kNumMonoChannels, frames_per_buffer);
+  input.Clear();
+  input[0][0] = 1.0f;
+  AudioBuffer output(kNumStereoChannels, frames_per_buffer);
+  while (left_response->size() < num_frames) {
+    reverb->Process(input[0], &output[0], &output[1]);
+    left_response->insert(left_response->end(), output[0].begin(),
+                          output[0].end());
+    right_response->insert(right_response->end(), output[1].begin(),
+                           output[1].end());
+    input.Clear();
+  }
+}
+
+// Returns the energy of |length| samples of |response| starting at |offset|.
+float SegmentEnergy(const std::vector<float>& response, size_t offset,
+                    size_t length) {
+  return std::inner_product(response.begin() + offset,
+                            response.begin() + offset + length,
+                            response.begin() + offset, 0.0f);
+}
+
+// Renders the left output of |reverb| for |num_noise_buffers| of noise input
+// followed by |num_silent_buffers| of silence.
+template <typename ReverbType>
+std::vector<float> NoiseResponse(size_t frames_per_buffer,
+                                 size_t num_noise_buffers,
+                                 size_t num_silent_buffers,
+                                 ReverbType* reverb) {
+  AudioBuffer input(kNumMonoChannels, frames_per_buffer);
+  AudioBuffer output(kNumStereoChannels, frames_per_buffer);
+  std::vector<float> response;
+  for (size_t i = 0; i < num_noise_buffers + num_silent_buffers; ++i) {
+    if (i < num_noise_buffers) {
+      GenerateUniformNoise(-1.0f, 1.0f, static_cast<unsigned>(i), &input[0]);
+    } else {
+      input.Clear();
+    }
+    reverb->Process(input[0], &output[0], &output[1]);
+    response.insert(response.end(), output[0].begin(), output[0].end());
+  }
+  return response;
+}
+
+// Band pass filters |response| in place.
+void BandPassFilter(int sample_rate, float centre_frequency,
+                    std::vector<float>* response) {
+  const int kBandwidthOctaves = 1;
+  AudioBuffer buffer(kNumMonoChannels, response->size());
+  buffer[0] = *response;
+  BiquadFilter filter(ComputeBandPassBiquadCoefficients(
+                          sample_rate, centre_frequency, kBandwidthOctaves),
+                      response->size());
+  filter.Filter(buffer[0], &buffer[0]);
+  response->assign(buffer[0].begin(), buffer[0].end());
+}
+
+}  // namespace
+
+// Tests that the reverb produces a stereo tail for small and odd buffer sizes.
+TEST(FdnReverbTest, StereoOutputTest) {
+  const std::vector<float> kUniformRt60s(kNumReverbOctaveBands, 0.7f);
+  for (size_t frames_per_buffer :
+       {kFramesPerBuffer32, kFramesPerBuffer64, kFramesPerBuffer713}) {
+    FdnReverb reverb(kSampleFrequency24, frames_per_buffer);
+    reverb.SetRt60PerOctaveBand(kUniformRt60s.data());
+    std::vector<float> left;
+    std::vector<float> right;
+    ImpulseResponse(kSampleFrequency24, frames_per_buffer, &reverb, &left,
+                    &right);
+    // The tail starts after the shortest delay line, well within 50ms.
+    const size_t onset_frames = kSampleFrequency24 / 20;
+    EXPECT_GT(SegmentEnergy(left, 0, onset_frames), 0.0f);
+    EXPECT_GT(SegmentEnergy(right, 0, onset_frames), 0.0f);
+    EXPECT_FLOAT_EQ(0.0f, left[0]);
+    EXPECT_FLOAT_EQ(0.0f, right[0]);
+  }
+}
+
+// Tests that the output is all zeros when the reverberation times are below
+// the supported range or the gain is zero.
+TEST(FdnReverbTest, DisabledProcessingTest) {
+  const std::vector<float> kShortRt60s(kNumReverbOctaveBands, 0.1f);
+  FdnReverb reverb(kSampleFrequency24, kFramesPerBuffer512);
+  reverb.SetRt60PerOctaveBand(kShortRt60s.data());
+  std::vector<float> left;
+  std::vector<float> right;
+  ImpulseResponse(kSampleFrequency24, kFramesPerBuffer512, &reverb, &left,
+                  &right);
+  EXPECT_FLOAT_EQ(0.0f, SegmentEnergy(left, 0, left.size()));
+  EXPECT_FLOAT_EQ(0.0f, SegmentEnergy(right, 0, right.size()));
+
+  std::vector<float> rt60s(kNumReverbOctaveBands, 0.0f);
+  rt60s[0] = 0.4f;
+  reverb.SetRt60PerOctaveBand(rt60s.data());
+  left.clear();
+  right.clear();
+  ImpulseResponse(kSampleFrequency24, kFramesPerBuffer512, &reverb, &left,
+                  &right);
+  EXPECT_GT(SegmentEnergy(left, 0, left.size()), 0.0f);
+  EXPECT_GT(SegmentEnergy(right, 0, right.size()), 0.0f);
+
+  reverb.SetGain(0.0f);
+  left.clear();
+  right.clear();
+  ImpulseResponse(kSampleFrequency24, kFramesPerBuffer512, &reverb, &left,
+                  &right);
+  EXPECT_FLOAT_EQ(0.0f, SegmentEnergy(left, 0, left.size()));
+  EXPECT_FLOAT_EQ(0.0f, SegmentEnergy(right, 0, right.size()));
+}
+
+// Tests that the tail decays by 60dB over the reverberation time.
+TEST(FdnReverbTest, DecayRateTest) {
+  const float kMaxDecayErrorDb = 3.0f;
+  for (float rt60 : {0.5f, 1.0f, 2.0f}) {
+    const std::vector<float> kUniformRt60s(kNumReverbOctaveBands, rt60);
+    FdnReverb reverb(kSampleFrequency48, kFramesPerBuffer512);
+    reverb.SetRt60PerOctaveBand(kUniformRt60s.data());
+    std::vector<float> left;
+    std::vector<float> right;
+    const size_t segment_length = kSampleFrequency48 / 10;
+    const size_t decay_length =
+        static_cast<size_t>(rt60 * 0.5f * kSampleFrequency48);
+    ImpulseResponse(segment_length * 2 + decay_length, kFramesPerBuffer512,
+                    &reverb, &left, &right);
+    // Skip the onset while the echo density builds up.
+    const float first_energy = SegmentEnergy(left, segment_length,
+                                             segment_length);
+    const float last_energy =
+        SegmentEnergy(left, segment_length + decay_length, segment_length);
+    const float decay_db = 10.0f * std::log10(first_energy / last_energy);
+    EXPECT_NEAR(30.0f, decay_db, kMaxDecayErrorDb);
+  }
+}
+
+// Tests that low frequencies decay slower than high frequencies when the
+// reverberation times decrease with frequency.
+TEST(FdnReverbTest, FrequencyDependentDecayTest) {
+  const float kCrossoverFrequency = 1000.0f;
+  std::vector<float> rt60s(kNumReverbOctaveBands, 2.0f);
+  std::fill(rt60s.begin() + kNumReverbOctaveBands / 2, rt60s.end(), 0.4f);
+  FdnReverb reverb(kSampleFrequency48, kFramesPerBuffer512);
+  reverb.SetRt60PerOctaveBand(rt60s.data());
+  std::vector<float> left;
+  std::vector<float> right;
+  const size_t segment_length = kSampleFrequency48 / 10;
+  ImpulseResponse(segment_length * 5, kFramesPerBuffer512, &reverb, &left,
+                  &right);
+
+  BiquadCoefficients low_pass_coefficients;
+  BiquadCoefficients high_pass_coefficients;
+  ComputeDualBandBiquadCoefficients(kSampleFrequency48, kCrossoverFrequency,
+                                    &low_pass_coefficients,
+                                    &high_pass_coefficients);
+  AudioBuffer bands(kNumStereoChannels, left.size());
+  BiquadFilter low_pass(low_pass_coefficients, left.size());
+  BiquadFilter high_pass(high_pass_coefficients, left.size());
+  bands[0] = left;
+  bands[1] = left;
+  low_pass.Filter(bands[0], &bands[0]);
+  high_pass.Filter(bands[1], &bands[1]);
+
+  float decays_db[kNumStereoChannels];
+  for (size_t band = 0; band < kNumStereoChannels; ++band) {
+    const std::vector<float> response(bands[band].begin(), bands[band].end());
+    decays_db[band] =
+        10.0f * std::log10(SegmentEnergy(response, segment_length,
+                                         segment_length) /
+                           SegmentEnergy(response, 3 * segment_length,
+                                         segment_length));
+  }
+  EXPECT_LT(decays_db[0] * 2.0f, decays_db[1]);
+}
+
+// Tests that the stereo tails are highly decorrelated.
+TEST(FdnReverbTest, DecorrelatedTailsTest) {
+  const float kMaxNormalizedCorrelation = 0.2f;
+  const std::vector<float> kUniformRt60s(kNumReverbOctaveBands, 1.0f);
+  FdnReverb reverb(kSampleFrequency48, kFramesPerBuffer64);
+  reverb.SetRt60PerOctaveBand(kUniformRt60s.data());
+  std::vector<float> left;
+  std::vector<float> right;
+  ImpulseResponse(kSampleFrequency48, kFramesPerBuffer64, &reverb, &left,
+                  &right);
+  const float correlation =
+      std::inner_product(left.begin(), left.end(), right.begin(), 0.0f);
+  const float normalization = std::sqrt(SegmentEnergy(left, 0, left.size()) *
+                                        SegmentEnergy(right, 0, right.size()));
+  EXPECT_LT(std::abs(correlation) / normalization, kMaxNormalizedCorrelation);
+}
+
+// Tests that the steady state level and the decay of the reverb match
+// |SpectralReverb| within the octave bands covered by both reverbs.
+TEST(FdnReverbTest, MatchesSpectralReverbTest) {
+  const float kMaxLevelDifferenceDb = 2.0f;
+  const float kMaxDecayDifferenceDb = 4.0f;
+  const float kCentreFrequency = 1000.0f;
+  // The output of |SpectralReverb| builds up and decays over its FFT size.
+  const size_t kSpectralReverbLatency = 2 * SpectralReverb::kDefaultFftSize;
+  for (int sample_rate : {kSampleFrequency24, kSampleFrequency48}) {
+    for (float rt60 : {0.5f, 1.0f, 2.0f}) {
+      const std::vector<float> kUniformRt60s(kNumReverbOctaveBands, rt60);
+      FdnReverb fdn_reverb(sample_rate, kFramesPerBuffer512);
+      fdn_reverb.SetRt60PerOctaveBand(kUniformRt60s.data());
+      SpectralReverb spectral_reverb(sample_rate, kFramesPerBuffer512);
+      spectral_reverb.SetRt60PerOctaveBand(kUniformRt60s.data());
+
+      // Excite both reverbs with noise until they reach their steady state,
+      // then render half of the decay.
+      const float sample_rate_float = static_cast<float>(sample_rate);
+      const size_t level_length = static_cast<size_t>(sample_rate / 2);
+      const size_t decay_length =
+          static_cast<size_t>(0.5f * rt60 * sample_rate_float);
+      const size_t segment_length = static_cast<size_t>(sample_rate / 10);
+      const size_t num_noise_buffers =
+          (static_cast<size_t>(2.0f * rt60 * sample_rate_float) +
+           level_length) /
+          kFramesPerBuffer512;
+      const size_t num_silent_buffers =
+          (kSpectralReverbLatency + decay_length + segment_length) /
+              kFramesPerBuffer512 +
+          1;
+      std::vector<float> fdn_response =
+          NoiseResponse(kFramesPerBuffer512, num_noise_buffers,
+                        num_silent_buffers, &fdn_reverb);
+      std::vector<float> spectral_response =
+          NoiseResponse(kFramesPerBuffer512, num_noise_buffers,
+                        num_silent_buffers, &spectral_reverb);
+      BandPassFilter(sample_rate, kCentreFrequency, &fdn_response);
+      BandPassFilter(sample_rate, kCentreFrequency, &spectral_response);
+
+      // Compare the steady state levels right before the noise stops.
+      const size_t noise_end = num_noise_buffers * kFramesPerBuffer512;
+      const size_t level_offset = noise_end - level_length;
+      const float level_difference_db =
+          10.0f *
+          std::log10(
+              SegmentEnergy(fdn_response, level_offset, level_length) /
+              SegmentEnergy(spectral_response, level_offset, level_length));
+      EXPECT_NEAR(0.0f, level_difference_db, kMaxLevelDifferenceDb);
+
+      // Compare the decays over half of the reverberation time, which should
+      // both be 30dB.
+      const size_t decay_offset = noise_end + kSpectralReverbLatency;
+      const float fdn_decay_db =
+          10.0f * std::log10(SegmentEnergy(fdn_response, decay_offset,
+                                           segment_length) /
+                             SegmentEnergy(fdn_response,
+                                           decay_offset + decay_length,
+                                           segment_length));
+      const float spectral_decay_db =
+          10.0f * std::log10(SegmentEnergy(spectral_response, decay_offset,
+                                           segment_length) /
+                             SegmentEnergy(spectral_response,
+                                           decay_offset + decay_length,
+                                           segment_length));
+      EXPECT_NEAR(spectral_decay_db, fdn_decay_db, kMaxDecayDifferenceDb);
+    }
+  }
+}
+
+}  // namespace vraudio
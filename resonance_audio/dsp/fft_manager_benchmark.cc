@@ -0,0 +1,77 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "dsp/fft_manager.h"
+
+#include "benchmark/benchmark.h"
+#include "base/audio_buffer.h"
+#include "base/constants_and_types.h"
+#include "utils/benchmark_util.h"
+
+namespace vraudio {
+
+namespace {
+
+void BM_FreqFromTimeDomain(benchmark::State& state) {
+  const size_t frames_per_buffer = static_cast<size_t>(state.range(0));
+  FftManager fft_manager(frames_per_buffer);
+  AudioBuffer time_buffer(kNumMonoChannels, frames_per_buffer);
+  FillWithNoise(&time_buffer);
+  AudioBuffer freq_buffer(kNumMonoChannels, fft_manager.GetFftSize());
+  for (auto _ : state) {
+    fft_manager.FreqFromTimeDomain(time_buffer[0], &freq_buffer[0]);
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(frames_per_buffer, &state);
+}
+BENCHMARK(BM_FreqFromTimeDomain)->Apply(FramesPerBufferArguments);
+
+void BM_TimeFromFreqDomain(benchmark::State& state) {
+  const size_t frames_per_buffer = static_cast<size_t>(state.range(0));
+  FftManager fft_manager(frames_per_buffer);
+  AudioBuffer time_buffer(kNumMonoChannels, fft_manager.GetFftSize());
+  FillWithNoise(&time_buffer);
+  AudioBuffer freq_buffer(kNumMonoChannels, fft_manager.GetFftSize());
+  fft_manager.FreqFromTimeDomain(time_buffer[0], &freq_buffer[0]);
+  for (auto _ : state) {
+    fft_manager.TimeFromFreqDomain(freq_buffer[0], &time_buffer[0]);
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(frames_per_buffer, &state);
+}
+BENCHMARK(BM_TimeFromFreqDomain)->Apply(FramesPerBufferArguments);
+
+void BM_FreqDomainConvolution(benchmark::State& state) {
+  const size_t frames_per_buffer = static_cast<size_t>(state.range(0));
+  FftManager fft_manager(frames_per_buffer);
+  AudioBuffer time_buffer(kNumStereoChannels, frames_per_buffer);
+  FillWithNoise(&time_buffer);
+  AudioBuffer freq_buffer(kNumStereoChannels, fft_manager.GetFftSize());
+  fft_manager.FreqFromTimeDomain(time_buffer[0], &freq_buffer[0]);
+  fft_manager.FreqFromTimeDomain(time_buffer[1], &freq_buffer[1]);
+  AudioBuffer output_buffer(kNumMonoChannels, fft_manager.GetFftSize());
+  for (auto _ : state) {
+    fft_manager.FreqDomainConvolution(freq_buffer[0], freq_buffer[1],
+                                      &output_buffer[0]);
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(frames_per_buffer, &state);
+}
+BENCHMARK(BM_FreqDomainConvolution)->Apply(FramesPerBufferArguments);
+
+}  // namespace
+
+}  // namespace vraudio
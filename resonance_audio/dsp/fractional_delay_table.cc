@@ -0,0 +1,74 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "dsp/fractional_delay_table.h"
+
+#include <cmath>
+
+#include "base/constants_and_types.h"
+
+namespace vraudio {
+
+namespace {
+
+// Returns the Blackman window of half length |half_length| at |position|.
+float BlackmanWindow(float position, float half_length) {
+  if (std::abs(position) >= half_length) {
+    return 0.0f;
+  }
+  const float phase = kPi * position / half_length;
+  return 0.42f + 0.5f * std::cos(phase) + 0.08f * std::cos(2.0f * phase);
+}
+
+// Returns the normalized sinc function at |position|, which is exactly zero at
+// nonzero integer positions so that integer delays are not smeared.
+float Sinc(float position) {
+  if (position == std::round(position)) {
+    return position == 0.0f ? 1.0f : 0.0f;
+  }
+  const float phase = kPi * position;
+  return std::sin(phase) / phase;
+}
+
+}  // namespace
+
+const size_t FractionalDelayTable::kNumTaps;
+const size_t FractionalDelayTable::kNumPrecedingTaps;
+const size_t FractionalDelayTable::kNumPhases;
+
+FractionalDelayTable::FractionalDelayTable()
+    : kernels_(kNumPhases + 1, kNumTaps) {
+  const float half_length = static_cast<float>(kNumTaps / 2);
+  for (size_t phase = 0; phase <= kNumPhases; ++phase) {
+    const float fraction =
+        static_cast<float>(phase) / static_cast<float>(kNumPhases);
+    AudioBuffer::Channel* kernel = &kernels_[phase];
+    float kernel_sum = 0.0f;
+    for (size_t tap = 0; tap < kNumTaps; ++tap) {
+      // Distance of the tap from the interpolated position.
+      const float position = static_cast<float>(tap) -
+                             static_cast<float>(kNumPrecedingTaps) - fraction;
+      (*kernel)[tap] = Sinc(position) * BlackmanWindow(position, half_length);
+      kernel_sum += (*kernel)[tap];
+    }
+    // Normalize the kernel to unity gain at DC.
+    for (size_t tap = 0; tap < kNumTaps; ++tap) {
+      (*kernel)[tap] /= kernel_sum;
+    }
+  }
+}
+
+}  // namespace vraudio
@@ -0,0 +1,73 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef RESONANCE_AUDIO_DSP_FRACTIONAL_DELAY_TABLE_H_
+#define RESONANCE_AUDIO_DSP_FRACTIONAL_DELAY_TABLE_H_
+
+#include "base/audio_buffer.h"
+#include "base/logging.h"
+
+namespace vraudio {
+
+// Lookup table of windowed-sinc interpolation kernels to read a signal at
+// fractional sample positions. The table is not modified after construction,
+// so a single instance can be shared by all the delay lines of a graph.
+class FractionalDelayTable {
+ public:
+  // Number of taps of each interpolation kernel.
+  static const size_t kNumTaps = 8;
+
+  // Number of taps preceding the integer sample position a kernel is centered
+  // on, i.e. a kernel applies to the samples [n - kNumPrecedingTaps,
+  // n - kNumPrecedingTaps + kNumTaps) to interpolate position n + fraction.
+  static const size_t kNumPrecedingTaps = kNumTaps / 2 - 1;
+
+  // Number of fractional positions stored per sample interval.
+  static const size_t kNumPhases = 256;
+
+  FractionalDelayTable();
+
+  // Returns the aligned interpolation kernel of |kNumTaps| coefficients for
+  // the given |fraction| of a sample, quantized to the nearest phase.
+  //
+  // @param fraction Fractional sample position in range [0, 1].
+  // @return Pointer to the kernel coefficients.
+  const float* GetKernel(float fraction) const {
+    DCHECK_GE(fraction, 0.0f);
+    DCHECK_LE(fraction, 1.0f);
+    return GetPhaseKernel(static_cast<size_t>(
+        fraction * static_cast<float>(kNumPhases) + 0.5f));
+  }
+
+  // Returns the aligned interpolation kernel of |kNumTaps| coefficients for
+  // the fractional sample position |phase| / |kNumPhases|.
+  //
+  // @param phase Phase index in range [0, |kNumPhases|].
+  // @return Pointer to the kernel coefficients.
+  const float* GetPhaseKernel(size_t phase) const {
+    DCHECK_LE(phase, kNumPhases);
+    return kernels_[phase].begin();
+  }
+
+ private:
+  // Interpolation kernels with one channel per phase, including both integer
+  // positions at phases 0 and |kNumPhases|.
+  AudioBuffer kernels_;
+};
+
+}  // namespace vraudio
+
+#endif  // RESONANCE_AUDIO_DSP_FRACTIONAL_DELAY_TABLE_H_
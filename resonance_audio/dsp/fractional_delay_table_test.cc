@@ -0,0 +1,64 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "dsp/fractional_delay_table.h"
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+#include "base/constants_and_types.h"
+
+namespace vraudio {
+
+namespace {
+
+const size_t kNumTaps = FractionalDelayTable::kNumTaps;
+const size_t kNumPrecedingTaps = FractionalDelayTable::kNumPrecedingTaps;
+
+// Tests that the kernels of integer positions are unit impulses.
+TEST(FractionalDelayTableTest, IntegerPositionsTest) {
+  const FractionalDelayTable kernel_table;
+  const float* first_kernel = kernel_table.GetKernel(0.0f);
+  const float* last_kernel = kernel_table.GetKernel(1.0f);
+  for (size_t tap = 0; tap < kNumTaps; ++tap) {
+    EXPECT_EQ(tap == kNumPrecedingTaps ? 1.0f : 0.0f, first_kernel[tap]);
+    EXPECT_EQ(tap == kNumPrecedingTaps + 1 ? 1.0f : 0.0f, last_kernel[tap]);
+  }
+}
+
+// Tests that all the kernels have unity gain at DC, and that the kernel of the
+// half sample position is symmetric.
+TEST(FractionalDelayTableTest, KernelShapeTest) {
+  const FractionalDelayTable kernel_table;
+  const size_t kNumTestedFractions = 16;
+  for (size_t i = 0; i <= kNumTestedFractions; ++i) {
+    const float fraction =
+        static_cast<float>(i) / static_cast<float>(kNumTestedFractions);
+    const float* kernel = kernel_table.GetKernel(fraction);
+    float kernel_sum = 0.0f;
+    for (size_t tap = 0; tap < kNumTaps; ++tap) {
+      kernel_sum += kernel[tap];
+    }
+    EXPECT_NEAR(1.0f, kernel_sum, kEpsilonFloat);
+  }
+  const float* half_kernel = kernel_table.GetKernel(0.5f);
+  for (size_t tap = 0; tap < kNumTaps / 2; ++tap) {
+    EXPECT_NEAR(half_kernel[tap], half_kernel[kNumTaps - 1 - tap],
+                kEpsilonFloat);
+  }
+}
+
+}  // namespace
+
+}  // namespace vraudio
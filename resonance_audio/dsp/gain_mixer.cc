@@ -16,15 +16,170 @@ limitations under the License.
 
 #include "dsp/gain_mixer.h"
 
+#include <algorithm>
 #include <cmath>
 
+#include "ambisonics/utils.h"
 #include "base/logging.h"
+#include "base/simd_macros.h"
+#include "dsp/gain.h"
 
 namespace vraudio {
 
+namespace {
+
+// Number of buffers after which the processors of an inactive source are
+// deleted.
+const size_t kMaxNumInactiveBuffers = 512;
+
+// Number of frames per block of the specialized mixing of a single input
+// channel. Each input block stays in cache while it is added to all output
+// channels.
+const size_t kNumBlockFrames = 128;
+
+// Adds the |input| channel to each of the |output| channels, scaled by the
+// separate |gains|.
+void AddInputChannelToChannels(const AudioBuffer::Channel& input,
+                               const std::vector<float>& gains,
+                               std::vector<GainProcessor>* processors,
+                               AudioBuffer* output) {
+  for (size_t i = 0; i < output->num_channels(); ++i) {
+    (*processors)[i].ApplyGain(gains[i], input, &(*output)[i],
+                               true /* accumulate_output */);
+  }
+}
+
+// Same as above, but with the number of output channels known at compile time.
+// After the gain ramps, the constant gains of all output channels are applied
+// block by block, so that each input block is loaded from memory only once.
+template <size_t NumChannels>
+void AddInputChannelToChannels(const AudioBuffer::Channel& input,
+                               const std::vector<float>& gains,
+                               std::vector<GainProcessor>* processors,
+                               AudioBuffer* output) {
+  DCHECK_EQ(output->num_channels(), NumChannels);
+  const size_t num_frames = input.size();
+  size_t ramp_lengths[NumChannels];
+  float constant_gains[NumChannels];
+  size_t constant_gain_offset = 0;
+  for (size_t i = 0; i < NumChannels; ++i) {
+    ramp_lengths[i] = (*processors)[i].ApplyGainRamp(
+        gains[i], input, &(*output)[i], true /* accumulate_output */);
+    const float gain = (*processors)[i].GetGain();
+    constant_gains[i] = IsGainNearZero(gain) ? 0.0f : gain;
+    constant_gain_offset = std::max(constant_gain_offset, ramp_lengths[i]);
+  }
+  // Start the blocks at a SIMD aligned frame after all ramps.
+  constant_gain_offset =
+      std::min(num_frames, (constant_gain_offset + SIMD_LENGTH - 1) /
+                               SIMD_LENGTH * SIMD_LENGTH);
+
+  const float* input_samples = input.begin();
+  float* output_samples[NumChannels];
+  for (size_t i = 0; i < NumChannels; ++i) {
+    output_samples[i] = (*output)[i].begin();
+    for (size_t frame = ramp_lengths[i]; frame < constant_gain_offset;
+         ++frame) {
+      output_samples[i][frame] += constant_gains[i] * input_samples[frame];
+    }
+  }
+
+  const size_t num_simd_frames =
+      constant_gain_offset +
+      (num_frames - constant_gain_offset) / SIMD_LENGTH * SIMD_LENGTH;
+  for (size_t block = constant_gain_offset; block < num_simd_frames;
+       block += kNumBlockFrames) {
+    const size_t block_end = std::min(num_simd_frames, block + kNumBlockFrames);
+    for (size_t i = 0; i < NumChannels; ++i) {
+      if (constant_gains[i] == 0.0f) {
+        continue;
+      }
+      const SimdVector gain_vector = SIMD_LOAD_ONE_FLOAT(constant_gains[i]);
+      for (size_t frame = block; frame < block_end; frame += SIMD_LENGTH) {
+        const SimdVector input_vector =
+            *reinterpret_cast<const SimdVector*>(input_samples + frame);
+        SimdVector* output_vector =
+            reinterpret_cast<SimdVector*>(output_samples[i] + frame);
+        *output_vector =
+            SIMD_MULTIPLY_ADD(gain_vector, input_vector, *output_vector);
+      }
+    }
+  }
+  for (size_t frame = num_simd_frames; frame < num_frames; ++frame) {
+    for (size_t i = 0; i < NumChannels; ++i) {
+      output_samples[i][frame] += constant_gains[i] * input_samples[frame];
+    }
+  }
+}
+
+// Adds the |input| channel to each of the |output| channels, with the gains
+// ramping linearly to the |segment_gains| over consecutive segments. Each
+// input segment stays in cache while it is added to all output channels.
+void AddInputChannelToChannelsInSegments(const AudioBuffer::Channel& input,
+                                         size_t segment_length,
+                                         const float* segment_gains,
+                                         std::vector<GainProcessor>* processors,
+                                         AudioBuffer* output) {
+  DCHECK_EQ(segment_length % SIMD_LENGTH, 0U);
+  const size_t num_channels = output->num_channels();
+  const size_t num_frames = input.size();
+  const float* input_samples = input.begin();
+  for (size_t segment_begin = 0; segment_begin < num_frames;
+       segment_begin += segment_length) {
+    const size_t segment_end =
+        std::min(num_frames, segment_begin + segment_length);
+    const size_t num_simd_frames =
+        segment_begin +
+        (segment_end - segment_begin) / SIMD_LENGTH * SIMD_LENGTH;
+    const float inverse_length =
+        1.0f / static_cast<float>(segment_end - segment_begin);
+    for (size_t i = 0; i < num_channels; ++i) {
+      GainProcessor* processor = &(*processors)[i];
+      const float start_gain = processor->GetGain();
+      const float end_gain = segment_gains[i];
+      processor->Reset(end_gain);
+      if (IsGainNearZero(start_gain) && IsGainNearZero(end_gain)) {
+        continue;
+      }
+      const float gain_increment = (end_gain - start_gain) * inverse_length;
+      float* output_samples = (*output)[i].begin();
+      // The gain vector holds the gains of |SIMD_LENGTH| consecutive frames.
+      SimdVector gain_vector;
+      float* gains = reinterpret_cast<float*>(&gain_vector);
+      for (size_t lane = 0; lane < SIMD_LENGTH; ++lane) {
+        gains[lane] = start_gain + gain_increment * static_cast<float>(lane);
+      }
+      const float simd_gain_increment =
+          gain_increment * static_cast<float>(SIMD_LENGTH);
+      const SimdVector increment_vector =
+          SIMD_LOAD_ONE_FLOAT(simd_gain_increment);
+      for (size_t frame = segment_begin; frame < num_simd_frames;
+           frame += SIMD_LENGTH) {
+        const SimdVector input_vector =
+            *reinterpret_cast<const SimdVector*>(input_samples + frame);
+        SimdVector* output_vector =
+            reinterpret_cast<SimdVector*>(output_samples + frame);
+        *output_vector =
+            SIMD_MULTIPLY_ADD(gain_vector, input_vector, *output_vector);
+        gain_vector = SIMD_ADD(gain_vector, increment_vector);
+      }
+      for (size_t frame = num_simd_frames; frame < segment_end; ++frame) {
+        const float gain =
+            start_gain +
+            gain_increment * static_cast<float>(frame - segment_begin);
+        output_samples[frame] += gain * input_samples[frame];
+      }
+    }
+    segment_gains += num_channels;
+  }
+}
+
+}  // namespace
+
 GainMixer::GainMixer(size_t num_channels, size_t frames_per_buffer)
     : num_channels_(num_channels),
       output_(num_channels_, frames_per_buffer),
+      add_input_channel_(GetAddInputChannelFunction(num_channels_)),
       is_empty_(false) {
   DCHECK_NE(num_channels_, 0U);
   Reset();
@@ -58,11 +213,10 @@ void GainMixer::AddInputChannel(const AudioBuffer::Channel& input,
 
   auto* gain_processors = GetOrCreateProcessors(source_id);
   // Accumulate the input buffers into the output buffer.
-  for (size_t i = 0; i < num_channels_; ++i) {
-    if (input.IsEnabled()) {
-      (*gain_processors)[i].ApplyGain(gains[i], input, &output_[i],
-                                      true /* accumulate_output */);
-    } else {
+  if (input.IsEnabled()) {
+    add_input_channel_(input, gains, gain_processors, &output_);
+  } else {
+    for (size_t i = 0; i < num_channels_; ++i) {
       // Make sure the gain processor is initialized.
       (*gain_processors)[i].Reset(gains[i]);
     }
@@ -70,6 +224,51 @@ void GainMixer::AddInputChannel(const AudioBuffer::Channel& input,
   is_empty_ = false;
 }
 
+void GainMixer::AddInputChannelInSegments(const AudioBuffer::Channel& input,
+                                          SourceId source_id,
+                                          size_t segment_length,
+                                          const float* segment_gains) {
+  DCHECK(segment_gains);
+  DCHECK_GT(segment_length, 0U);
+  DCHECK_EQ(input.size(), output_.num_frames());
+
+  auto* gain_processors = GetOrCreateProcessors(source_id);
+  // Sources without gain history start at the gains of the first segment.
+  for (size_t i = 0; i < num_channels_; ++i) {
+    if (!(*gain_processors)[i].IsInitialized()) {
+      (*gain_processors)[i].Reset(segment_gains[i]);
+    }
+  }
+  if (input.IsEnabled()) {
+    AddInputChannelToChannelsInSegments(input, segment_length, segment_gains,
+                                        gain_processors, &output_);
+  } else {
+    // Make sure the gain processors end at the gains of the last segment.
+    const size_t num_segments =
+        (input.size() + segment_length - 1) / segment_length;
+    const float* last_segment_gains =
+        segment_gains + (num_segments - 1) * num_channels_;
+    for (size_t i = 0; i < num_channels_; ++i) {
+      (*gain_processors)[i].Reset(last_segment_gains[i]);
+    }
+  }
+  is_empty_ = false;
+}
+
+void GainMixer::AddSource(SourceId source_id) {
+  auto it = source_gain_processors_.find(source_id);
+  if (it == source_gain_processors_.end()) {
+    it = source_gain_processors_
+             .insert({source_id, GainProcessors(num_channels_)})
+             .first;
+  }
+  it->second.is_persistent = true;
+}
+
+void GainMixer::RemoveSource(SourceId source_id) {
+  source_gain_processors_.erase(source_id);
+}
+
 const AudioBuffer* GainMixer::GetOutput() const {
   if (is_empty_) {
     return nullptr;
@@ -85,9 +284,13 @@ void GainMixer::Reset() {
          /* no increment */) {
       if (it->second.processors_active) {
         it->second.processors_active = false;
+        it->second.num_inactive_buffers = 0;
         ++it;
-      } else {
+      } else if (++it->second.num_inactive_buffers > kMaxNumInactiveBuffers &&
+                 !it->second.is_persistent) {
         source_gain_processors_.erase(it++);
+      } else {
+        ++it;
       }
     }
     // Reset the output buffer.
@@ -96,20 +299,54 @@ void GainMixer::Reset() {
   is_empty_ = true;
 }
 
+GainMixer::AddInputChannelFunction GainMixer::GetAddInputChannelFunction(
+    size_t num_channels) {
+  switch (num_channels) {
+    case GetNumPeriphonicComponentsStatic<1>::value:
+      return &AddInputChannelToChannels<
+          GetNumPeriphonicComponentsStatic<1>::value>;
+    case GetNumPeriphonicComponentsStatic<2>::value:
+      return &AddInputChannelToChannels<
+          GetNumPeriphonicComponentsStatic<2>::value>;
+    case GetNumPeriphonicComponentsStatic<3>::value:
+      return &AddInputChannelToChannels<
+          GetNumPeriphonicComponentsStatic<3>::value>;
+    case GetNumPeriphonicComponentsStatic<5>::value:
+      return &AddInputChannelToChannels<
+          GetNumPeriphonicComponentsStatic<5>::value>;
+    case GetNumPeriphonicComponentsStatic<7>::value:
+      return &AddInputChannelToChannels<
+          GetNumPeriphonicComponentsStatic<7>::value>;
+    default:
+      return &AddInputChannelToChannels;
+  }
+}
+
 GainMixer::GainProcessors::GainProcessors(size_t num_channels)
-    : processors_active(true), processors(num_channels) {}
+    : processors_active(true),
+      num_inactive_buffers(0),
+      is_persistent(false),
+      processors(num_channels) {}
 
 std::vector<GainProcessor>* GainMixer::GetOrCreateProcessors(
     SourceId source_id) {
   // Attempt to find a |ScaleAndAccumulateProcessor| for the given |source_id|,
   // if none can be found add one. In either case mark that the processor has
   // been used so that it is not later deleted.
-  if (source_gain_processors_.find(source_id) ==
-      source_gain_processors_.end()) {
-    source_gain_processors_.insert({source_id, GainProcessors(num_channels_)});
+  auto it = source_gain_processors_.find(source_id);
+  if (it == source_gain_processors_.end()) {
+    it = source_gain_processors_
+             .insert({source_id, GainProcessors(num_channels_)})
+             .first;
+  } else if (it->second.num_inactive_buffers > 0) {
+    // Start without gain ramps, as for newly created processors.
+    for (auto& processor : it->second.processors) {
+      processor = GainProcessor();
+    }
+    it->second.num_inactive_buffers = 0;
   }
-  source_gain_processors_.at(source_id).processors_active = true;
-  return &(source_gain_processors_.at(source_id).processors);
+  it->second.processors_active = true;
+  return &(it->second.processors);
 }
 
 }  // namespace vraudio
@@ -49,6 +49,35 @@ class GainMixer {
   void AddInputChannel(const AudioBuffer::Channel& input, SourceId source_id,
                        const std::vector<float>& gains);
 
+  // Adds a single input channel to each of the output buffer's channels, with
+  // separate gains per output channel which change linearly over consecutive
+  // segments of the input. This follows the encoding gains of moving sources
+  // more closely than a single gain ramp per buffer.
+  //
+  // @param input Input channel to be added.
+  // @param source_id Identifier corresponding to the input.
+  // @param segment_length Number of frames per segment, a multiple of
+  //     |SIMD_LENGTH|. The last segment may be shorter.
+  // @param segment_gains Gains at the end of each segment, with the gains of
+  //     all output channels of a segment stored contiguously. The gains ramp
+  //     from the current gains of the source at the start of the input.
+  void AddInputChannelInSegments(const AudioBuffer::Channel& input,
+                                 SourceId source_id, size_t segment_length,
+                                 const float* segment_gains);
+
+  // Creates the processors of a source ahead of its input. Unlike processors
+  // created on demand, they are kept while the source is inactive until
+  // |RemoveSource| is called, so that a source which is only mixed in some
+  // buffers never allocates its processors during the mixing.
+  //
+  // @param source_id Identifier of the source.
+  void AddSource(SourceId source_id);
+
+  // Deletes the processors of a source.
+  //
+  // @param source_id Identifier of the source.
+  void RemoveSource(SourceId source_id);
+
   // Returns a pointer to the accumulator.
   //
   // @return Pointer to the processed (mixed) output buffer, or nullptr if no
@@ -67,12 +96,37 @@ class GainMixer {
     // Bool to signify if a given source is still passing data to a processor.
     bool processors_active;
 
+    // Number of consecutive buffers in which the source has not passed any
+    // data. The processors are kept for this many buffers, so that sources
+    // with intermittent input do not allocate processors on the audio thread.
+    size_t num_inactive_buffers;
+
+    // Whether the processors were created by |AddSource|, and hence are kept
+    // regardless of |num_inactive_buffers|.
+    bool is_persistent;
+
     // Scale and accumulation processors, one per channel for each source.
     std::vector<GainProcessor> processors;
   };
 
+  // Signature of the functions which add a single enabled input channel to
+  // each of the |output| channels, with a separate gain per output channel.
+  typedef void (*AddInputChannelFunction)(
+      const AudioBuffer::Channel& input, const std::vector<float>& gains,
+      std::vector<GainProcessor>* processors, AudioBuffer* output);
+
+  // Returns the function which adds a single input channel to |num_channels|
+  // output channels. Ambisonic sound fields up to third order as well as of
+  // fifth and seventh order are specialized.
+  //
+  // @param num_channels Number of output channels.
+  // @return Function adding a single input channel to the output channels.
+  static AddInputChannelFunction GetAddInputChannelFunction(
+      size_t num_channels);
+
   // Returns the |GainProcessor|s associated with a |source_id| (or creates
   // one if needed) and sets the corresponding |processors_active| flag to true.
+  // Processors of a source that was inactive are reinitialized.
   //
   // @param source_id Identifier for a given input.
   // @return The corresponding |ScalingAccumulators|.
@@ -84,6 +138,10 @@ class GainMixer {
   // Output buffer (accumulator).
   AudioBuffer output_;
 
+  // Adds a single input channel to the output, specialized on the number of
+  // output channels at construction.
+  const AddInputChannelFunction add_input_channel_;
+
   // Denotes whether the accumulator has processed any inputs or not.
   bool is_empty_;
 
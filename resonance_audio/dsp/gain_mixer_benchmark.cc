@@ -0,0 +1,80 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "dsp/gain_mixer.h"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "ambisonics/utils.h"
+#include "base/audio_buffer.h"
+#include "base/constants_and_types.h"
+#include "utils/benchmark_util.h"
+
+namespace vraudio {
+
+namespace {
+
+// Number of sources mixed per buffer.
+const SourceId kNumSources = 16;
+
+// Mixes |kNumSources| multichannel inputs into an ambisonic sound field, as
+// done for ambisonic sources.
+void BM_GainMixerAddInput(benchmark::State& state) {
+  const size_t frames_per_buffer = static_cast<size_t>(state.range(0));
+  const size_t num_channels =
+      GetNumPeriphonicComponents(static_cast<int>(state.range(1)));
+  GainMixer mixer(num_channels, frames_per_buffer);
+  AudioBuffer input(num_channels, frames_per_buffer);
+  FillWithNoise(&input);
+  const std::vector<float> gains(num_channels, 0.5f);
+  for (auto _ : state) {
+    mixer.Reset();
+    for (SourceId source_id = 0; source_id < kNumSources; ++source_id) {
+      input.set_source_id(source_id);
+      mixer.AddInput(input, gains);
+    }
+    benchmark::DoNotOptimize(mixer.GetOutput());
+  }
+  SetFramesProcessed(kNumSources * frames_per_buffer, &state);
+}
+BENCHMARK(BM_GainMixerAddInput)->Apply(FramesPerBufferAndOrderArguments);
+
+// Encodes |kNumSources| mono inputs into an ambisonic sound field, as done for
+// sound objects.
+void BM_GainMixerAddInputChannel(benchmark::State& state) {
+  const size_t frames_per_buffer = static_cast<size_t>(state.range(0));
+  const size_t num_channels =
+      GetNumPeriphonicComponents(static_cast<int>(state.range(1)));
+  GainMixer mixer(num_channels, frames_per_buffer);
+  AudioBuffer input(kNumMonoChannels, frames_per_buffer);
+  FillWithNoise(&input);
+  const std::vector<float> gains(num_channels, 0.5f);
+  for (auto _ : state) {
+    mixer.Reset();
+    for (SourceId source_id = 0; source_id < kNumSources; ++source_id) {
+      mixer.AddInputChannel(input[0], source_id, gains);
+    }
+    benchmark::DoNotOptimize(mixer.GetOutput());
+  }
+  SetFramesProcessed(kNumSources * frames_per_buffer, &state);
+}
+BENCHMARK(BM_GainMixerAddInputChannel)
+    ->Apply(FramesPerBufferAndOrderArguments);
+
+}  // namespace
+
+}  // namespace vraudio
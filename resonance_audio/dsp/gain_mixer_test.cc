@@ -16,11 +16,13 @@ limitations under the License.
 
 #include "dsp/gain_mixer.h"
 
+#include <algorithm>
 #include <iterator>
 #include <vector>
 
 #include "third_party/googletest/googletest/include/gtest/gtest.h"
 #include "base/constants_and_types.h"
+#include "dsp/gain_processor.h"
 #include "utils/planar_interleaved_conversion.h"
 
 namespace vraudio {
@@ -183,6 +185,91 @@ TEST(GainMixerTest, MonoChannelInputTest) {
   }
 }
 
+// Tests that the ramped gains of a mono input buffer mixed into the channels
+// of an ambisonic sound field match the gains applied channel by channel.
+TEST(GainMixerTest, AmbisonicMonoChannelInputRampTest) {
+  const size_t kNumFrames = 37;
+  const size_t kNumBuffers = 4;
+  for (int ambisonic_order = 1; ambisonic_order <= kMaxSupportedAmbisonicOrder;
+       ++ambisonic_order) {
+    const size_t num_channels = (ambisonic_order + 1) * (ambisonic_order + 1);
+    GainMixer gain_mixer(num_channels, kNumFrames);
+    std::vector<GainProcessor> processors(num_channels);
+    AudioBuffer input(kNumMonoChannels, kNumFrames);
+    AudioBuffer expected_output(num_channels, kNumFrames);
+    for (size_t i = 0; i < kNumFrames; ++i) {
+      input[0][i] = static_cast<float>(i % 5) - 2.0f;
+    }
+    std::vector<float> gains(num_channels);
+    for (size_t buffer = 0; buffer < kNumBuffers; ++buffer) {
+      // Changes the gains by different amounts per channel, which results in
+      // gain ramps of different lengths.
+      for (size_t channel = 0; channel < num_channels; ++channel) {
+        gains[channel] = static_cast<float>((buffer + 1) * (channel % 3)) *
+                         0.01f * (channel % 2 == 0 ? 1.0f : -1.0f);
+      }
+      gain_mixer.Reset();
+      gain_mixer.AddInputChannel(input[0], kId1, gains);
+      const AudioBuffer* output = gain_mixer.GetOutput();
+      ASSERT_FALSE(output == nullptr);
+      for (size_t channel = 0; channel < num_channels; ++channel) {
+        processors[channel].ApplyGain(gains[channel], input[0],
+                                      &expected_output[channel],
+                                      false /* accumulate_output */);
+        for (size_t i = 0; i < kNumFrames; ++i) {
+          EXPECT_NEAR(expected_output[channel][i], (*output)[channel][i],
+                      kEpsilonFloat);
+        }
+      }
+    }
+  }
+}
+
+// Tests that the gains of a mono input buffer mixed in segments ramp linearly
+// from the current gains to the gains at the end of each segment.
+TEST(GainMixerTest, AmbisonicMonoChannelInputSegmentsTest) {
+  const size_t kNumFrames = 150;
+  const size_t kSegmentLength = 32;
+  const size_t kNumSegments = 5;
+  for (int ambisonic_order = 1; ambisonic_order <= kMaxSupportedAmbisonicOrder;
+       ++ambisonic_order) {
+    const size_t num_channels = (ambisonic_order + 1) * (ambisonic_order + 1);
+    GainMixer gain_mixer(num_channels, kNumFrames);
+    AudioBuffer input(kNumMonoChannels, kNumFrames);
+    for (size_t i = 0; i < kNumFrames; ++i) {
+      input[0][i] = static_cast<float>(i % 5) - 2.0f;
+    }
+    // Gains at the start of the buffer, followed by the gains at the end of
+    // each segment.
+    std::vector<float> gains((kNumSegments + 1) * num_channels);
+    for (size_t i = 0; i < gains.size(); ++i) {
+      gains[i] = static_cast<float>((i * 7) % 11) * 0.1f - 0.5f;
+    }
+    const std::vector<float> start_gains(gains.begin(),
+                                         gains.begin() + num_channels);
+    gain_mixer.AddInputChannel(input[0], kId1, start_gains);
+    gain_mixer.Reset();
+    gain_mixer.AddInputChannelInSegments(input[0], kId1, kSegmentLength,
+                                         &gains[num_channels]);
+    const AudioBuffer* output = gain_mixer.GetOutput();
+    ASSERT_FALSE(output == nullptr);
+    for (size_t channel = 0; channel < num_channels; ++channel) {
+      for (size_t i = 0; i < kNumFrames; ++i) {
+        const size_t segment = i / kSegmentLength;
+        const size_t segment_begin = segment * kSegmentLength;
+        const size_t segment_length =
+            std::min(kNumFrames - segment_begin, kSegmentLength);
+        const float start_gain = gains[segment * num_channels + channel];
+        const float end_gain = gains[(segment + 1) * num_channels + channel];
+        const float fraction = static_cast<float>(i - segment_begin) /
+                               static_cast<float>(segment_length);
+        const float gain = start_gain + (end_gain - start_gain) * fraction;
+        EXPECT_NEAR(gain * input[0][i], (*output)[channel][i], 1e-5f);
+      }
+    }
+  }
+}
+
 }  // namespace
 
 }  // namespace vraudio
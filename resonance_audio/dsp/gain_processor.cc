@@ -35,7 +35,36 @@ void GainProcessor::ApplyGain(float target_gain,
                               const AudioBuffer::Channel& input,
                               AudioBuffer::Channel* output,
                               bool accumulate_output) {
+  const size_t ramp_length =
+      ApplyGainRamp(target_gain, input, output, accumulate_output);
 
+  // Apply constant gain to the rest of the buffer.
+  const size_t input_length = input.size();
+  if (ramp_length < input_length) {
+    if (IsGainNearZero(current_gain_)) {
+      // Skip processing if the gain is zero.
+      if (!accumulate_output) {
+        // Directly fill the remaining output with zeros.
+        std::fill(output->begin() + ramp_length, output->end(), 0.0f);
+      }
+      return;
+    } else if (IsGainNearUnity(current_gain_) && !accumulate_output) {
+      // Skip processing if the gain is unity.
+      if (&input != output) {
+        // Directly copy the remaining input samples into output.
+        std::copy(input.begin() + ramp_length, input.end(),
+                  output->begin() + ramp_length);
+      }
+      return;
+    }
+    ConstantGain(ramp_length, current_gain_, input, output, accumulate_output);
+  }
+}
+
+size_t GainProcessor::ApplyGainRamp(float target_gain,
+                                    const AudioBuffer::Channel& input,
+                                    AudioBuffer::Channel* output,
+                                    bool accumulate_output) {
   DCHECK(output);
 
   if (!is_initialized_) {
@@ -48,7 +77,7 @@ void GainProcessor::ApplyGain(float target_gain,
   DCHECK_EQ(input_length, output->size());
 
   // Index for where to stop interpolating.
-  size_t ramp_length =
+  const size_t ramp_length =
       static_cast<size_t>(std::abs(target_gain - current_gain_) *
                           static_cast<float>(kUnitRampLength));
 
@@ -61,31 +90,13 @@ void GainProcessor::ApplyGain(float target_gain,
     // No ramping needed.
     current_gain_ = target_gain;
   }
-
-  // Apply constant gain to the rest of the buffer.
-  if (ramp_length < input_length) {
-    if (IsGainNearZero(current_gain_)) {
-      // Skip processing if the gain is zero.
-      if (!accumulate_output) {
-        // Directly fill the remaining output with zeros.
-        std::fill(output->begin() + ramp_length, output->end(), 0.0f);
-      }
-      return;
-    } else if (IsGainNearUnity(current_gain_) && !accumulate_output) {
-      // Skip processing if the gain is unity.
-      if (&input != output) {
-        // Directly copy the remaining input samples into output.
-        std::copy(input.begin() + ramp_length, input.end(),
-                  output->begin() + ramp_length);
-      }
-      return;
-    }
-    ConstantGain(ramp_length, current_gain_, input, output, accumulate_output);
-  }
+  return std::min(ramp_length, input_length);
 }
 
 float GainProcessor::GetGain() const { return current_gain_; }
 
+bool GainProcessor::IsInitialized() const { return is_initialized_; }
+
 void GainProcessor::Reset(float gain) {
   current_gain_ = gain;
   is_initialized_ = true;
@@ -51,11 +51,30 @@ class GainProcessor {
   void ApplyGain(float target_gain, const AudioBuffer::Channel& input,
                  AudioBuffer::Channel* output, bool accumulate_output);
 
+  // Applies only the gain ramp from the current gain towards |target_gain| to
+  // the beginning of the input samples. The remaining samples are to be
+  // scaled by the constant |GetGain()| by the caller.
+  //
+  // @param target_gain Target gain value.
+  // @param input Samples to which gain will be applied.
+  // @param output Samples to which gain has been applied.
+  // @param accumulate_output True if the processed input should be mixed into
+  //     the output. Otherwise, the output will be replaced by the processed
+  //     input.
+  // @return Number of samples processed by the ramp.
+  size_t ApplyGainRamp(float target_gain, const AudioBuffer::Channel& input,
+                       AudioBuffer::Channel* output, bool accumulate_output);
+
   // Returns the |current_gain_| value.
   //
   // @return Current gain applied by the |GainProcessor|.
   float GetGain() const;
 
+  // Returns whether a gain has been assigned to the processor.
+  //
+  // @return True if the gain state is initialized.
+  bool IsInitialized() const;
+
   // Resets the gain processor to a new gain factor.
   //
   // @param gain Gain value.
@@ -19,16 +19,39 @@ limitations under the License.
 #include <algorithm>
 
 #include "base/constants_and_types.h"
-
+#include "base/simd_macros.h"
+#include "base/simd_utils.h"
 
 namespace vraudio {
 
-MonoPoleFilter::MonoPoleFilter(float coefficient) : previous_output_(0.0f) {
+MonoPoleFilter::MonoPoleFilter(float coefficient)
+    : previous_output_(0.0f),
+      coefficient_(-1.0f),
+      block_weights_(SIMD_LENGTH + 1, SIMD_LENGTH) {
   SetCoefficient(coefficient);
 }
 
 void MonoPoleFilter::SetCoefficient(float coefficient) {
-  coefficient_ = std::max(std::min(coefficient, 1.0f), 0.0f);
+  const float clamped_coefficient = std::max(std::min(coefficient, 1.0f), 0.0f);
+  if (clamped_coefficient == coefficient_) {
+    return;
+  }
+  coefficient_ = clamped_coefficient;
+  // Unrolling y[n] = a * y[n-1] + (1 - a) * x[n] over a block gives:
+  // y[n+k] = a^(k+1) * y[n-1] + sum_{i<=k} (1 - a) * a^(k-i) * x[n+i].
+  block_weights_.Clear();
+  float previous_output_weight = coefficient_;
+  for (size_t k = 0; k < SIMD_LENGTH; ++k) {
+    block_weights_[0][k] = previous_output_weight;
+    previous_output_weight *= coefficient_;
+  }
+  for (size_t i = 0; i < SIMD_LENGTH; ++i) {
+    float weight = 1.0f - coefficient_;
+    for (size_t k = i; k < SIMD_LENGTH; ++k) {
+      block_weights_[i + 1][k] = weight;
+      weight *= coefficient_;
+    }
+  }
 }
 
 bool MonoPoleFilter::Filter(const AudioBuffer::Channel& input,
@@ -45,10 +68,36 @@ bool MonoPoleFilter::Filter(const AudioBuffer::Channel& input,
     return false;
   }
 
+  size_t frame = 0;
+  if (IsAligned(input.begin()) && IsAligned(output->begin())) {
+    // Process whole blocks of |SIMD_LENGTH| frames with the unrolled
+    // recursion. The input part of each block does not depend on the previous
+    // output, which leaves a single multiply-add on the recursive path.
+    SimdVector weights[SIMD_LENGTH + 1];
+    for (size_t i = 0; i <= SIMD_LENGTH; ++i) {
+      weights[i] =
+          *reinterpret_cast<const SimdVector*>(block_weights_[i].begin());
+    }
+    SimdVector* output_vector = reinterpret_cast<SimdVector*>(output->begin());
+    const size_t num_chunks = num_frames / SIMD_LENGTH;
+    for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+      const size_t offset = chunk * SIMD_LENGTH;
+      SimdVector input_part = SIMD_MULTIPLY(
+          SIMD_LOAD_ONE_FLOAT(input[offset]), weights[1]);
+      for (size_t i = 1; i < SIMD_LENGTH; ++i) {
+        input_part = SIMD_MULTIPLY_ADD(SIMD_LOAD_ONE_FLOAT(input[offset + i]),
+                                       weights[i + 1], input_part);
+      }
+      output_vector[chunk] = SIMD_MULTIPLY_ADD(
+          SIMD_LOAD_ONE_FLOAT(previous_output_), weights[0], input_part);
+      previous_output_ = (*output)[offset + SIMD_LENGTH - 1];
+    }
+    frame = num_chunks * SIMD_LENGTH;
+  }
   // The difference equation implemented here is as follows:
   // y[n] = a * (y[n-1] - x[n]) + x[n]
   // where y[n] is the output and x[n] is the input vector.
-  for (size_t frame = 0; frame < num_frames; ++frame) {
+  for (; frame < num_frames; ++frame) {
     (*output)[frame] =
         coefficient_ * (previous_output_ - input[frame]) + input[frame];
     previous_output_ = (*output)[frame];
@@ -50,6 +50,13 @@ class MonoPoleFilter {
   // Represents and maintains the state of the filter in terms of its
   // transfer function coefficient.
   float coefficient_;
+
+  // The recursion unrolled over blocks of |SIMD_LENGTH| frames, so that a
+  // whole block can be computed from its inputs and the previous output with
+  // vector operations. Channel 0 holds the weights of the previous output for
+  // each frame of the block, channel i + 1 holds the weights of the i-th input
+  // frame of the block.
+  AudioBuffer block_weights_;
 };
 
 }  // namespace vraudio
@@ -54,6 +54,32 @@ TEST(MonoPoleFilterTest, AllPassNoProcessingTest) {
   EXPECT_FALSE(filter.Filter(buffer[0], &buffer[0]));
 }
 
+// Tests that the block processing matches the difference equation for buffer
+// sizes that are not a multiple of the SIMD length and for coefficient changes
+// between buffers.
+TEST(MonoPoleFilterTest, MatchesDifferenceEquationTest) {
+  const size_t kNumBuffers = 4;
+  const size_t kLongFramesPerBuffer = 37;
+  const float kCoefficients[kNumBuffers] = {0.25f, 0.25f, 0.9f, 0.6f};
+  MonoPoleFilter filter(kCoefficients[0]);
+  AudioBuffer input(1U, kLongFramesPerBuffer);
+  AudioBuffer output(1U, kLongFramesPerBuffer);
+  float expected_previous_output = 0.0f;
+  for (size_t buffer = 0; buffer < kNumBuffers; ++buffer) {
+    for (size_t i = 0; i < kLongFramesPerBuffer; ++i) {
+      input[0][i] = std::sin(static_cast<float>(buffer * 100 + i * i));
+    }
+    filter.SetCoefficient(kCoefficients[buffer]);
+    EXPECT_TRUE(filter.Filter(input[0], &output[0]));
+    for (size_t i = 0; i < kLongFramesPerBuffer; ++i) {
+      expected_previous_output =
+          kCoefficients[buffer] * (expected_previous_output - input[0][i]) +
+          input[0][i];
+      EXPECT_NEAR(output[0][i], expected_previous_output, kEpsilonFloat);
+    }
+  }
+}
+
 }  // namespace
 
 }  // namespace vraudio
@@ -37,6 +37,13 @@ const float kMeanHrtfGroupDelaySeconds = 0.00066667f;
 // Average group delay of the shelf-filter in samples.
 const size_t kMeanShelfFilterGroupDelaySamples = 1;
 
+// Indices of the band-splitting filters in the |BiquadBank|.
+enum BandSplitFilterIndex {
+  kLowPassFilterIndex = 0,
+  kHighPassFilterIndex,
+  kNumBandSplitFilters
+};
+
 }  // namespace
 
 NearFieldProcessor::NearFieldProcessor(int sample_rate,
@@ -45,9 +52,9 @@ NearFieldProcessor::NearFieldProcessor(int sample_rate,
       delay_compensation_(static_cast<size_t>(kMeanHrtfGroupDelaySeconds *
                                               static_cast<float>(sample_rate)) -
                           kMeanShelfFilterGroupDelaySamples),
-      lo_pass_filter_(BiquadCoefficients(), frames_per_buffer_),
-      hi_pass_filter_(BiquadCoefficients(), frames_per_buffer_),
-      low_passed_buffer_(kNumMonoChannels, frames_per_buffer_),
+      band_split_filters_(kNumBandSplitFilters, BiquadCoefficients(),
+                          frames_per_buffer_),
+      band_split_buffer_(kNumBandSplitFilters, frames_per_buffer_),
       delay_filter_(delay_compensation_, frames_per_buffer_) {
   DCHECK_GT(sample_rate, 0);
   DCHECK_GT(frames_per_buffer, 0);
@@ -61,9 +68,11 @@ NearFieldProcessor::NearFieldProcessor(int sample_rate,
                                     &lo_pass_coefficients,
                                     &hi_pass_coefficients);
 
-  // Create two biquad filters initialized with the above filter coefficients.
-  lo_pass_filter_.SetCoefficients(lo_pass_coefficients);
-  hi_pass_filter_.SetCoefficients(hi_pass_coefficients);
+  // Initialize the two biquad filters with the above filter coefficients.
+  band_split_filters_.SetCoefficients(kLowPassFilterIndex,
+                                      lo_pass_coefficients);
+  band_split_filters_.SetCoefficients(kHighPassFilterIndex,
+                                      hi_pass_coefficients);
 }
 
 void NearFieldProcessor::Process(const AudioBuffer::Channel& input,
@@ -74,17 +83,16 @@ void NearFieldProcessor::Process(const AudioBuffer::Channel& input,
   DCHECK_EQ(input.size(), frames_per_buffer_);
   DCHECK_EQ(output->size(), frames_per_buffer_);
 
-  // Low-pass filter the input and put it in the temporary low-passed buffer.
-  auto* low_passed_channel = &low_passed_buffer_[0];
-  lo_pass_filter_.Filter(input, low_passed_channel);
-
-  // High-pass filter the input and put it in the output channel (unmodified).
-  hi_pass_filter_.Filter(input, output);
+  // Low- and high-pass filter the input in a single pass, then copy the
+  // high-passed signal to the output channel (unmodified).
+  band_split_filters_.Filter(input, &band_split_buffer_);
+  const auto& low_passed_channel = band_split_buffer_[kLowPassFilterIndex];
+  *output = band_split_buffer_[kHighPassFilterIndex];
   // Iterate through all the samples in the |low_passed_buffer_| and apply
   // the bass boost. Then, combine with the high-passed part in order to form
   // the shelf-filtered output. Note: phase flip of the low-passed signal is
   // required  to form the correct filtered output.
-  ConstantGain(/*offset_index=*/0, -kBassBoost, *low_passed_channel, output,
+  ConstantGain(/*offset_index=*/0, -kBassBoost, low_passed_channel, output,
                /*accumulate_output=*/true);
 
   if (enable_hrtf) {
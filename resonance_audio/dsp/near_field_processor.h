@@ -18,7 +18,7 @@ limitations under the License.
 #define RESONANCE_AUDIO_DSP_NEAR_FIELD_PROCESSOR_H_
 
 #include "base/audio_buffer.h"
-#include "dsp/biquad_filter.h"
+#include "dsp/biquad_bank.h"
 #include "dsp/delay_filter.h"
 
 namespace vraudio {
@@ -58,13 +58,12 @@ class NearFieldProcessor {
   // using with stereo-panned sound sources.
   const size_t delay_compensation_;
 
-  // Biquad filters that apply frequency splitting of the input mono signal.
-  BiquadFilter lo_pass_filter_;
-  BiquadFilter hi_pass_filter_;
+  // Low- and high-pass biquad filters that apply frequency splitting of the
+  // input mono signal. Both filters are processed together.
+  BiquadBank band_split_filters_;
 
-  // Buffer for the low-passed signal. We do not modify the high-passed signal
-  // so we can write it directly to the output channel.
-  AudioBuffer low_passed_buffer_;
+  // Buffer for the low-passed and high-passed signals.
+  AudioBuffer band_split_buffer_;
 
   // Delay filter used to delay the incoming input mono buffer.
   DelayFilter delay_filter_;
@@ -23,6 +23,13 @@ limitations under the License.
 
 namespace vraudio {
 
+namespace {
+
+// Maximum directivity order that is evaluated with |IntegerPow|.
+const float kMaxIntegerPowOrder = 32.0f;
+
+}  // namespace
+
 float CalculateDirectivity(float alpha, float order,
                            const SphericalAngle& spherical_angle) {
   // Clamp alpha weighting.
@@ -36,7 +43,16 @@ float CalculateDirectivity(float alpha, float order,
                        alpha_clamped * (std::cos(spherical_angle.azimuth()) *
                                         std::cos(spherical_angle.elevation()));
 
-    return std::pow(std::abs(gain), std::max(order, 1.0f));
+    const float order_clamped = std::max(order, 1.0f);
+    // Directivity patterns typically use small integer orders, for which
+    // repeated multiplication is much cheaper than |std::pow|.
+    if (order_clamped <= kMaxIntegerPowOrder) {
+      const int integer_order = static_cast<int>(order_clamped);
+      if (static_cast<float>(integer_order) == order_clamped) {
+        return IntegerPow(std::abs(gain), integer_order);
+      }
+    }
+    return std::pow(std::abs(gain), order_clamped);
   }
 }
 
@@ -0,0 +1,59 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "dsp/occlusion_calculator.h"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "base/constants_and_types.h"
+#include "base/spherical_angle.h"
+
+namespace vraudio {
+
+namespace {
+
+// Number of source directions evaluated per iteration.
+const size_t kNumDirections = 256;
+
+// Balance between the dipole and the omnidirectional pattern.
+const float kAlpha = 0.5f;
+
+// Evaluates the directivity of |kNumDirections| sources of the directivity
+// order passed as |state.range(0)|.
+void BM_CalculateDirectivity(benchmark::State& state) {
+  const float order = static_cast<float>(state.range(0));
+  std::vector<SphericalAngle> directions;
+  for (size_t i = 0; i < kNumDirections; ++i) {
+    const float fraction =
+        static_cast<float>(i) / static_cast<float>(kNumDirections);
+    directions.emplace_back(kTwoPi * fraction, kHalfPi * (fraction - 0.5f));
+  }
+  for (auto _ : state) {
+    float sum = 0.0f;
+    for (const SphericalAngle& direction : directions) {
+      sum += CalculateDirectivity(kAlpha, order, direction);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(kNumDirections));
+}
+BENCHMARK(BM_CalculateDirectivity)->ArgName("order")->Arg(1)->Arg(2)->Arg(4);
+
+}  // namespace
+
+}  // namespace vraudio
@@ -88,6 +88,7 @@ DirectivityTestParams test_cases[] = {
     {0.5f, 1.0f, &(kListenerBesideRads[0]), 0.5f},
     {0.5f, 1.0f, &(kListenerAboveAndAheadRads[0]), 0.853553f},
     {0.5f, 2.0f, &(kListenerAboveAndAheadRads[0]), 0.728553f},
+    {0.5f, 1.5f, &(kListenerAboveAndAheadRads[0]), 0.788581f},
     // Hypercardioid.
     {0.75f, 1.0f, &(kListenerAheadRads[0]), 1.0f},
     {0.75f, 1.0f, &(kListenerBesideRads[0]), 0.25f},
@@ -207,12 +207,24 @@ void PartitionedFftFilter::SetFreqDomainKernel(const FreqDomainBuffer& kernel) {
 void PartitionedFftFilter::Filter(const FreqDomainBuffer::Channel& input) {
 
 
-  DCHECK_EQ(input.size(), fft_size_);
-  std::copy_n(input.begin(), fft_size_,
-              freq_domain_buffer_[curr_front_buffer_].begin());
   buffer_selector_ = !buffer_selector_;
   freq_domain_accumulator_.Clear();
   auto* accumulator_channel = &freq_domain_accumulator_[0];
+  FilterAndAccumulate(input, accumulator_channel);
+  // Perform inverse FFT transform of |freq_domain_buffer_| and store the
+  // result back in |filtered_time_domain_buffers_|.
+  fft_manager_->TimeFromFreqDomain(
+      *accumulator_channel, &filtered_time_domain_buffers_[buffer_selector_]);
+}
+
+void PartitionedFftFilter::FilterAndAccumulate(
+    const FreqDomainBuffer::Channel& input,
+    FreqDomainBuffer::Channel* accumulator) {
+  DCHECK(accumulator);
+  DCHECK_EQ(input.size(), fft_size_);
+  DCHECK_EQ(accumulator->size(), fft_size_);
+  std::copy_n(input.begin(), fft_size_,
+              freq_domain_buffer_[curr_front_buffer_].begin());
 
   for (size_t i = 0; i < num_partitions_; ++i) {
     // Complex vector product in frequency domain with filter kernel.
@@ -221,15 +233,11 @@ void PartitionedFftFilter::Filter(const FreqDomainBuffer::Channel& input) {
     // Perform inverse scaling along with accumulation of last fft buffer.
     fft_manager_->FreqDomainConvolution(freq_domain_buffer_[modulo_index],
                                         kernel_freq_domain_buffer_[i],
-                                        accumulator_channel);
+                                        accumulator);
   }
   // Our modulo based index.
   curr_front_buffer_ =
       (curr_front_buffer_ + num_partitions_ - 1) % num_partitions_;
-  // Perform inverse FFT transform of |freq_domain_buffer_| and store the
-  // result back in |filtered_time_domain_buffers_|.
-  fft_manager_->TimeFromFreqDomain(
-      *accumulator_channel, &filtered_time_domain_buffers_[buffer_selector_]);
 }
 
 void PartitionedFftFilter::GetFilteredSignal(AudioBuffer::Channel* output) {
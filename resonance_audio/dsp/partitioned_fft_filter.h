@@ -93,6 +93,18 @@ class PartitionedFftFilter {
   // @param Frequency domain input buffer.
   void Filter(const FreqDomainBuffer::Channel& input);
 
+  // Processes a block of frequency domain samples like |Filter|, but adds the
+  // (scaled) frequency domain output to |accumulator| instead of transforming
+  // it back to the time domain. This lets several filters whose outputs are
+  // summed share a single inverse FFT. |GetFilteredSignal| must not be used
+  // with this method.
+  //
+  // @param input Frequency domain input buffer.
+  // @param accumulator Frequency domain buffer of size |fft_size_| the filtered
+  //     signal is added to.
+  void FilterAndAccumulate(const FreqDomainBuffer::Channel& input,
+                           FreqDomainBuffer::Channel* accumulator);
+
   // Returns block of filtered signal output of size |fft_size_|/2.
   //
   // @param output Time domain block filtered with the given kernel.
@@ -0,0 +1,69 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "dsp/partitioned_fft_filter.h"
+
+#include "benchmark/benchmark.h"
+#include "base/audio_buffer.h"
+#include "base/constants_and_types.h"
+#include "dsp/fft_manager.h"
+#include "utils/benchmark_util.h"
+
+namespace vraudio {
+
+namespace {
+
+// Sweeps the number of frames per buffer and the filter length, which are
+// passed as |state.range(0)| and |state.range(1)| respectively.
+void FramesPerBufferAndFilterLengthArguments(
+    benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"frames", "taps"});
+  for (int filter_length : {256, 2048, 16384}) {
+    for (int frames = kMinBenchmarkFramesPerBuffer;
+         frames <= kMaxBenchmarkFramesPerBuffer; frames *= 2) {
+      bench->Args({frames, filter_length});
+    }
+  }
+}
+
+void BM_PartitionedFftFilter(benchmark::State& state) {
+  const size_t frames_per_buffer = static_cast<size_t>(state.range(0));
+  const size_t filter_length = static_cast<size_t>(state.range(1));
+  FftManager fft_manager(frames_per_buffer);
+  PartitionedFftFilter filter(filter_length, frames_per_buffer, &fft_manager);
+  AudioBuffer kernel(kNumMonoChannels, filter_length);
+  FillWithNoise(&kernel);
+  filter.SetTimeDomainKernel(kernel[0]);
+
+  AudioBuffer input(kNumMonoChannels, frames_per_buffer);
+  FillWithNoise(&input);
+  PartitionedFftFilter::FreqDomainBuffer freq_input(kNumMonoChannels,
+                                                    fft_manager.GetFftSize());
+  fft_manager.FreqFromTimeDomain(input[0], &freq_input[0]);
+  AudioBuffer output(kNumMonoChannels, frames_per_buffer);
+  for (auto _ : state) {
+    filter.Filter(freq_input[0]);
+    filter.GetFilteredSignal(&output[0]);
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(frames_per_buffer, &state);
+}
+BENCHMARK(BM_PartitionedFftFilter)
+    ->Apply(FramesPerBufferAndFilterLengthArguments);
+
+}  // namespace
+
+}  // namespace vraudio
@@ -23,6 +23,7 @@ limitations under the License.
 
 #include <cmath>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 #include "third_party/googletest/googletest/include/gtest/gtest.h"
@@ -456,6 +457,69 @@ TEST(PartitionedFftFilterTest, DiracImpulseTest) {
   }
 }
 
+// Tests that accumulating the frequency domain outputs of several filters and
+// transforming their sum back to the time domain matches the sum of the time
+// domain outputs of the individual filters.
+TEST(PartitionedFftFilterTest, FilterAndAccumulateTest) {
+  const size_t kFramesPerBuffer = 32;
+  const size_t kFilterSize = 3 * kFramesPerBuffer + 5;
+  const size_t kNumFilters = 3;
+  const size_t kNumBlocks = 6;
+
+  FftManager fft_manager(kFramesPerBuffer);
+  const size_t fft_size = fft_manager.GetFftSize();
+  std::vector<std::unique_ptr<PartitionedFftFilter>> reference_filters;
+  std::vector<std::unique_ptr<PartitionedFftFilter>> accumulating_filters;
+  AudioBuffer kernel(kNumMonoChannels, kFilterSize);
+  for (size_t filter = 0; filter < kNumFilters; ++filter) {
+    for (size_t i = 0; i < kFilterSize; ++i) {
+      kernel[0][i] = static_cast<float>((i * (filter + 2)) % 7) - 3.0f;
+    }
+    reference_filters.emplace_back(
+        new PartitionedFftFilter(kFilterSize, kFramesPerBuffer, &fft_manager));
+    reference_filters[filter]->SetTimeDomainKernel(kernel[0]);
+    accumulating_filters.emplace_back(
+        new PartitionedFftFilter(kFilterSize, kFramesPerBuffer, &fft_manager));
+    accumulating_filters[filter]->SetTimeDomainKernel(kernel[0]);
+  }
+
+  AudioBuffer input(kNumMonoChannels, kFramesPerBuffer);
+  PartitionedFftFilter::FreqDomainBuffer freq_input(kNumMonoChannels,
+                                                    fft_size);
+  PartitionedFftFilter::FreqDomainBuffer accumulator(kNumMonoChannels,
+                                                     fft_size);
+  AudioBuffer filtered_block(kNumMonoChannels, kFramesPerBuffer);
+  AudioBuffer expected_output(kNumMonoChannels, kFramesPerBuffer);
+  // Current and previous time domain output of the accumulated filters.
+  AudioBuffer time_domain_buffers(kNumStereoChannels, fft_size);
+  time_domain_buffers.Clear();
+  for (size_t block = 0; block < kNumBlocks; ++block) {
+    expected_output.Clear();
+    accumulator.Clear();
+    for (size_t filter = 0; filter < kNumFilters; ++filter) {
+      for (size_t i = 0; i < kFramesPerBuffer; ++i) {
+        input[0][i] = static_cast<float>((i + block + filter) % 5) - 2.0f;
+      }
+      fft_manager.FreqFromTimeDomain(input[0], &freq_input[0]);
+      reference_filters[filter]->Filter(freq_input[0]);
+      reference_filters[filter]->GetFilteredSignal(&filtered_block[0]);
+      expected_output[0] += filtered_block[0];
+      accumulating_filters[filter]->FilterAndAccumulate(freq_input[0],
+                                                        &accumulator[0]);
+    }
+    const size_t curr_buffer = block % 2;
+    const size_t prev_buffer = 1 - curr_buffer;
+    fft_manager.TimeFromFreqDomain(accumulator[0],
+                                   &time_domain_buffers[curr_buffer]);
+    for (size_t i = 0; i < kFramesPerBuffer; ++i) {
+      const float output =
+          time_domain_buffers[curr_buffer][i] +
+          time_domain_buffers[prev_buffer][i + kFramesPerBuffer];
+      EXPECT_NEAR(expected_output[0][i], output, kFftEpsilon);
+    }
+  }
+}
+
 }  // namespace
 
 class PartitionedFftFilterFrequencyBufferTest : public ::testing::Test {
@@ -17,16 +17,22 @@ limitations under the License.
 #ifndef RESONANCE_AUDIO_DSP_REFLECTION_H_
 #define RESONANCE_AUDIO_DSP_REFLECTION_H_
 
+#include "base/misc_math.h"
+
 namespace vraudio {
 
-// Describes a room reflection that contains information on its time of arrival
-// and magnitude.
+// Describes a room reflection that contains information on its time of arrival,
+// magnitude and direction of arrival.
 struct Reflection {
   // Time of arrival of the reflection in seconds.
   float delay_time_seconds = 0.0f;
 
   // Magnitude of the reflection.
   float magnitude = 0.0f;
+
+  // Unit vector pointing from the listener towards the image source, in the
+  // coordinate frame of the room.
+  WorldPosition direction = WorldPosition(0.0f, 0.0f, 0.0f);
 };
 
 }  // namespace vraudio
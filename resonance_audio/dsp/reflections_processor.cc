@@ -18,10 +18,10 @@ limitations under the License.
 
 #include <algorithm>
 
+#include "ambisonics/utils.h"
 #include "base/constants_and_types.h"
 #include "base/logging.h"
 #include "dsp/filter_coefficient_generators.h"
-#include "dsp/gain.h"
 #include "dsp/shoe_box_room.h"
 
 namespace vraudio {
@@ -44,28 +44,37 @@ float FindMaxReflectionDelayTime(const std::vector<Reflection>& reflections) {
 
 }  // namespace
 
-ReflectionsProcessor::ReflectionsProcessor(int sample_rate,
-                                           size_t frames_per_buffer)
+ReflectionsProcessor::ReflectionsProcessor(
+    int sample_rate, size_t frames_per_buffer,
+    const AmbisonicLookupTable& lookup_table, int reflection_order)
     : sample_rate_(sample_rate),
       frames_per_buffer_(frames_per_buffer),
       max_delay_samples_(kMaxDelayTimeSeconds * sample_rate_),
+      lookup_table_(lookup_table),
+      reflection_order_(reflection_order),
       low_pass_filter_(0.0f),
       temp_mono_buffer_(kNumMonoChannels, frames_per_buffer_),
-      current_reflection_buffer_(kNumFirstOrderAmbisonicChannels,
+      current_reflection_buffer_(GetNumPeriphonicComponents(reflection_order_),
                                  frames_per_buffer),
-      target_reflection_buffer_(kNumFirstOrderAmbisonicChannels,
+      target_reflection_buffer_(GetNumPeriphonicComponents(reflection_order_),
                                 frames_per_buffer),
-      target_reflections_(kNumRoomSurfaces),
+      target_reflections_(GetNumImageSources(reflection_order_)),
       crossfade_(false),
       crossfader_(frames_per_buffer_),
       num_frames_to_process_on_empty_input_(0),
-      delays_(kNumRoomSurfaces),
+      delays_(target_reflections_.size()),
       delay_filter_(max_delay_samples_, frames_per_buffer),
-      delay_buffer_(kNumRoomSurfaces, frames_per_buffer),
-      gains_(kNumRoomSurfaces),
-      gain_processors_(kNumRoomSurfaces) {
+      tap_directions_(target_reflections_.size()),
+      tap_spreads_deg_(target_reflections_.size(), 0.0f),
+      encoding_coeffs_(target_reflections_.size() *
+                       GetNumPeriphonicComponents(reflection_order_)),
+      tap_gains_(GetNumPeriphonicComponents(reflection_order_),
+                 target_reflections_.size()) {
   DCHECK_GT(sample_rate_, 0);
   DCHECK_GT(frames_per_buffer_, 0U);
+  DCHECK_GE(reflection_order_, 1);
+  DCHECK_LE(reflection_order_, kMaxReflectionOrder);
+  tap_gains_.Clear();
 }
 
 void ReflectionsProcessor::Update(
@@ -84,7 +93,8 @@ void ReflectionsProcessor::Update(
       listener_position, &relative_listener_position);
   ComputeReflections(relative_listener_position,
                      WorldPosition(reflection_properties.room_dimensions),
-                     reflection_properties.coefficients, &target_reflections_);
+                     reflection_properties.coefficients, reflection_order_,
+                     &target_reflections_);
   // Additional |frames_per_buffer_| to process needed to compensate the
   // crossfade between the current and target reflections.
   num_frames_to_process_on_empty_input_ =
@@ -100,7 +110,7 @@ void ReflectionsProcessor::Process(const AudioBuffer& input,
   DCHECK_EQ(input.num_channels(), kNumMonoChannels);
   DCHECK_EQ(input.num_frames(), frames_per_buffer_);
   DCHECK(output);
-  DCHECK_GE(output->num_channels(), kNumFirstOrderAmbisonicChannels);
+  DCHECK_GE(output->num_channels(), tap_gains_.num_channels());
   DCHECK_EQ(output->num_frames(), frames_per_buffer_);
   // Prefilter mono input.
   const AudioBuffer::Channel& input_channel = input[0];
@@ -124,54 +134,35 @@ void ReflectionsProcessor::Process(const AudioBuffer& input,
 }
 
 void ReflectionsProcessor::UpdateGainsAndDelays() {
-  for (size_t i = 0; i < kNumRoomSurfaces; ++i) {
+  const size_t num_reflections = target_reflections_.size();
+  for (size_t i = 0; i < num_reflections; ++i) {
+    const Reflection& reflection = target_reflections_[i];
     delays_[i] =
         std::min(max_delay_samples_,
-                 static_cast<size_t>(target_reflections_[i].delay_time_seconds *
+                 static_cast<size_t>(reflection.delay_time_seconds *
                                      static_cast<float>(sample_rate_)));
-    gains_[i] = target_reflections_[i].magnitude;
+    tap_directions_[i] =
+        SphericalAngle::FromWorldPosition(reflection.direction);
+  }
+  lookup_table_.GetEncodingCoeffs(reflection_order_, num_reflections,
+                                  tap_directions_.data(),
+                                  tap_spreads_deg_.data(),
+                                  encoding_coeffs_.data());
+  const size_t num_channels = tap_gains_.num_channels();
+  for (size_t i = 0; i < num_reflections; ++i) {
+    const float* reflection_coeffs = &encoding_coeffs_[i * num_channels];
+    for (size_t channel = 0; channel < num_channels; ++channel) {
+      tap_gains_[channel][i] =
+          target_reflections_[i].magnitude * reflection_coeffs[channel];
+    }
   }
 }
 
 void ReflectionsProcessor::ApplyReflections(AudioBuffer* output) {
   DCHECK(output);
-  DCHECK_GE(output->num_channels(), kNumFirstOrderAmbisonicChannels);
-  (*output).Clear();
-  for (size_t i = 0; i < kNumRoomSurfaces; ++i) {
-    auto* delay_channel = &delay_buffer_[i];
-    delay_filter_.GetDelayedData(delays_[i], delay_channel);
-    const bool zero_gain = IsGainNearZero(gains_[i]) &&
-                           IsGainNearZero(gain_processors_[i].GetGain());
-    if (!zero_gain) {
-      gain_processors_[i].ApplyGain(gains_[i], *delay_channel, delay_channel,
-                                    false /* accumulate_output */);
-      // Applies fast Ambisonic reflections encoding.
-      (*output)[0] += *delay_channel;
-      switch (i) {
-        case 0: /* left wall reflection */
-          (*output)[1] += *delay_channel;
-          break;
-        case 1: /* right wall reflection */
-          (*output)[1] -= *delay_channel;
-          break;
-        case 2: /* floor reflection */
-          (*output)[2] -= *delay_channel;
-          break;
-        case 3: /* ceiling reflection */
-          (*output)[2] += *delay_channel;
-          break;
-        case 4: /* front wall reflection */
-          (*output)[3] += *delay_channel;
-          break;
-        case 5: /* back wall reflection */
-          (*output)[3] -= *delay_channel;
-          break;
-      }
-    } else {
-      // Make sure the gain processor is initialized.
-      gain_processors_[i].Reset(0.0f);
-    }
-  }
+  DCHECK_GE(output->num_channels(), tap_gains_.num_channels());
+  output->Clear();
+  delay_filter_.AccumulateMultiTapData(delays_, tap_gains_, output);
 }
 
 }  // namespace vraudio
@@ -20,31 +20,38 @@ limitations under the License.
 #include <utility>
 #include <vector>
 
+#include "ambisonics/ambisonic_lookup_table.h"
 #include "api/resonance_audio_api.h"
 #include "base/audio_buffer.h"
 #include "base/misc_math.h"
+#include "base/spherical_angle.h"
 #include "dsp/delay_filter.h"
-#include "dsp/gain_processor.h"
 #include "dsp/mono_pole_filter.h"
 #include "dsp/reflection.h"
 #include "utils/buffer_crossfader.h"
 
 namespace vraudio {
 
-// Class that accepts single mono buffer as input and outputs a first order
-// ambisonic buffer of the mix of all the rooms early reflections computed for
-// the buffer.
+// Class that accepts single mono buffer as input and outputs an ambisonic
+// buffer of the mix of all the rooms early reflections computed for the buffer.
 //
 // The input consists of a mono mix of all the sound objects in the system. The
-// reflections are assumed to be aligned with the aabb axes and thus the first
-// order ambisonic axes.
+// reflections are computed by the image source method up to a given reflection
+// order, and each image source is encoded into ambisonics of the same order.
+// The room is assumed to be aligned with the ambisonic axes.
 class ReflectionsProcessor {
  public:
-  // Constructs a |ReflectionsProcessor|.
+  // Constructs a |ReflectionsProcessor| of the given |reflection_order|.
   //
   // @param sample_rate System sampling rate.
   // @param frames_per_buffer System frames per buffer.
-  ReflectionsProcessor(int sample_rate, size_t frames_per_buffer);
+  // @param lookup_table Ambisonic encoding lookup table of at least
+  //     |reflection_order|.
+  // @param reflection_order Image source order, which is also the ambisonic
+  //     order of the output. Must be in range [1, |kMaxReflectionOrder|].
+  ReflectionsProcessor(int sample_rate, size_t frames_per_buffer,
+                       const AmbisonicLookupTable& lookup_table,
+                       int reflection_order);
 
   // Updates reflections according to the new |ReflectionProperties|.
   //
@@ -56,9 +63,13 @@ class ReflectionsProcessor {
   // Processes a mono |AudioBuffer| into an ambisonic |AudioBuffer|.
   //
   // @param input Mono input buffer.
-  // @param output Ambisonic output buffer.
+  // @param output Ambisonic output buffer with at least
+  //     |GetNumPeriphonicComponents(reflection_order())| channels.
   void Process(const AudioBuffer& input, AudioBuffer* output);
 
+  // Returns the image source order, which is also the output ambisonic order.
+  int reflection_order() const { return reflection_order_; }
+
   // Returns the number of frames required to keep processing on empty input
   // signal. This value can be used to avoid any potential artifacts on the
   // final output signal when the input signal stream is empty.
@@ -67,11 +78,10 @@ class ReflectionsProcessor {
   }
 
  private:
-  // Updates |gains_| and |delays_| vectors of the |ReflectionsProcessor|.
+  // Updates |tap_gains_| and |delays_| of the |ReflectionsProcessor|.
   void UpdateGainsAndDelays();
 
-  // Applies |target_reflections_| and fast-encodes them into first order
-  // ambisonics.
+  // Applies |target_reflections_| and encodes them into ambisonics.
   //
   // @param output Ambisonic output buffer.
   void ApplyReflections(AudioBuffer* output);
@@ -85,13 +95,19 @@ class ReflectionsProcessor {
   // Maximum allowed delay time for a reflection (in samples).
   const size_t max_delay_samples_;
 
+  // Ambisonic encoding lookup table.
+  const AmbisonicLookupTable& lookup_table_;
+
+  // Image source order and output ambisonic order.
+  const int reflection_order_;
+
   // Low pass filter to be applied to input signal.
   MonoPoleFilter low_pass_filter_;
 
   // Audio buffer to store mono low pass filtered buffers during processing.
   AudioBuffer temp_mono_buffer_;
 
-  // Audio buffers to store FOA reflections buffers during crossfading.
+  // Audio buffers to store ambisonic reflections buffers during crossfading.
   AudioBuffer current_reflection_buffer_;
   AudioBuffer target_reflection_buffer_;
 
@@ -113,14 +129,20 @@ class ReflectionsProcessor {
   // Delay filter to delay the incoming buffer.
   DelayFilter delay_filter_;
 
-  // Delay buffer used to store delayed reflections before scaling and encoding.
-  AudioBuffer delay_buffer_;
+  // Directions of arrival of the reflections, in ambisonic coordinates.
+  std::vector<SphericalAngle> tap_directions_;
+
+  // Angular spreads of the reflections, which are all encoded as point
+  // sources.
+  std::vector<float> tap_spreads_deg_;
 
-  // Gains to be applied for each reflection.
-  std::vector<float> gains_;
+  // Ambisonic encoding coefficients of the reflections, the coefficients of
+  // each reflection being stored contiguously.
+  std::vector<float> encoding_coeffs_;
 
-  // |GainProcessor|s to apply |gains_|.
-  std::vector<GainProcessor> gain_processors_;
+  // Ambisonic encoding gains for each reflection, with one channel per
+  // ambisonic channel and one frame per reflection.
+  AudioBuffer tap_gains_;
 };
 
 }  // namespace vraudio
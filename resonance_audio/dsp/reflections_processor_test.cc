@@ -21,8 +21,12 @@ limitations under the License.
 #include <vector>
 
 #include "third_party/googletest/googletest/include/gtest/gtest.h"
+#include "ambisonics/ambisonic_lookup_table.h"
+#include "ambisonics/utils.h"
 #include "api/resonance_audio_api.h"
 #include "base/constants_and_types.h"
+#include "base/spherical_angle.h"
+#include "dsp/shoe_box_room.h"
 #include "utils/test_util.h"
 
 namespace vraudio {
@@ -38,6 +42,8 @@ const size_t kExpectedDelaySamples = 279;
 
 class ReflectionsProcessorTest : public ::testing::Test {
  protected:
+  ReflectionsProcessorTest() : lookup_table_(kMaxReflectionOrder) {}
+
   void SetUp() override {
     const float kReflectionCoefficients[kNumRoomSurfaces] = {0.5f, 0.5f, 0.5f,
                                                              0.5f, 0.5f, 0.5f};
@@ -50,13 +56,16 @@ class ReflectionsProcessorTest : public ::testing::Test {
     listener_position_ = kListenerPosition;
   }
 
+  AmbisonicLookupTable lookup_table_;
   ReflectionProperties reflection_properties_;
   WorldPosition listener_position_;
 };  // namespace vraudio
 
 // Tests that the processed output is delayed, filtered, and scaled as expected.
 TEST_F(ReflectionsProcessorTest, ProcessTest) {
-  ReflectionsProcessor reflections_processor(kSampleRate, kFramesPerBuffer);
+  ReflectionsProcessor reflections_processor(kSampleRate, kFramesPerBuffer,
+                                             lookup_table_,
+                                             1 /* reflection_order */);
   reflections_processor.Update(reflection_properties_, listener_position_);
 
   AudioBuffer input(kNumMonoChannels, kFramesPerBuffer);
@@ -106,7 +115,9 @@ TEST_F(ReflectionsProcessorTest, ProcessTest) {
 // with non-zero magnitude, there will be a steady incremental increase in
 // the "fade in".
 TEST_F(ReflectionsProcessorTest, CrossFadeTest) {
-  ReflectionsProcessor reflections_processor(kSampleRate, kFramesPerBuffer);
+  ReflectionsProcessor reflections_processor(kSampleRate, kFramesPerBuffer,
+                                             lookup_table_,
+                                             1 /* reflection_order */);
 
   AudioBuffer input(kNumMonoChannels, kFramesPerBuffer);
   AudioBuffer output(kNumFirstOrderAmbisonicChannels, kFramesPerBuffer);
@@ -139,4 +150,72 @@ TEST_F(ReflectionsProcessorTest, CrossFadeTest) {
   }
 }
 
+// Tests that higher order reflections are delayed, scaled and encoded into
+// higher order ambisonics as expected.
+TEST_F(ReflectionsProcessorTest, HigherOrderProcessTest) {
+  const int kReflectionOrder = 3;
+  const float kRoomDimensions[3] = {3.0f, 2.5f, 4.0f};
+  const WorldPosition kListenerPosition(0.3f, -0.2f, 0.1f);
+  const size_t kNumBuffers = 3;
+  // Allowed deviation due to the summation order of coinciding reflections.
+  const float kEncodingEpsilon = 1e-5f;
+  std::copy(std::begin(kRoomDimensions), std::end(kRoomDimensions),
+            std::begin(reflection_properties_.room_dimensions));
+  ReflectionsProcessor reflections_processor(kSampleRate, kFramesPerBuffer,
+                                             lookup_table_, kReflectionOrder);
+  EXPECT_EQ(kReflectionOrder, reflections_processor.reflection_order());
+  reflections_processor.Update(reflection_properties_, kListenerPosition);
+
+  const size_t num_channels = GetNumPeriphonicComponents(kReflectionOrder);
+  AudioBuffer input(kNumMonoChannels, kFramesPerBuffer);
+  AudioBuffer output(num_channels, kFramesPerBuffer);
+  // Process a silent buffer to complete the crossfade to the new reflections.
+  input.Clear();
+  reflections_processor.Process(input, &output);
+  // Process an impulse and collect its reflections.
+  std::vector<std::vector<float>> impulse_response(
+      num_channels, std::vector<float>(kNumBuffers * kFramesPerBuffer));
+  for (size_t buffer = 0; buffer < kNumBuffers; ++buffer) {
+    input.Clear();
+    if (buffer == 0) {
+      GenerateDiracImpulseFilter(0, &input[0]);
+    }
+    reflections_processor.Process(input, &output);
+    for (size_t channel = 0; channel < num_channels; ++channel) {
+      std::copy(output[channel].begin(), output[channel].end(),
+                impulse_response[channel].begin() + buffer * kFramesPerBuffer);
+    }
+  }
+
+  // Compute the expected impulse response with the image sources encoded by
+  // the ambisonic lookup table.
+  std::vector<Reflection> reflections(GetNumImageSources(kReflectionOrder));
+  ComputeReflections(kListenerPosition, WorldPosition(kRoomDimensions),
+                     reflection_properties_.coefficients, kReflectionOrder,
+                     &reflections);
+  std::vector<float> encoding_coefficients(num_channels);
+  std::vector<std::vector<float>> expected_impulse_response(
+      num_channels, std::vector<float>(kNumBuffers * kFramesPerBuffer, 0.0f));
+  for (const auto& reflection : reflections) {
+    const size_t delay = static_cast<size_t>(reflection.delay_time_seconds *
+                                             static_cast<float>(kSampleRate));
+    ASSERT_LT(delay, kNumBuffers * kFramesPerBuffer);
+    const SphericalAngle direction =
+        SphericalAngle::FromWorldPosition(reflection.direction);
+    lookup_table_.GetEncodingCoeffs(kReflectionOrder, direction,
+                                    0.0f /* source_spread_deg */,
+                                    &encoding_coefficients);
+    for (size_t channel = 0; channel < num_channels; ++channel) {
+      expected_impulse_response[channel][delay] +=
+          reflection.magnitude * encoding_coefficients[channel];
+    }
+  }
+  for (size_t channel = 0; channel < num_channels; ++channel) {
+    for (size_t frame = 0; frame < kNumBuffers * kFramesPerBuffer; ++frame) {
+      EXPECT_NEAR(expected_impulse_response[channel][frame],
+                  impulse_response[channel][frame], kEncodingEpsilon);
+    }
+  }
+}
+
 }  // namespace vraudio
@@ -21,6 +21,8 @@ limitations under the License.
 
 #include "dsp/resampler.h"
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
 #include <numeric>
 
@@ -41,14 +43,66 @@ namespace {
 // and filter rolloff wrt. cutoff frequency.
 const size_t kTransitionBandwidthRatio = 13;
 
-// Maximum number of channels internally based upon the maximum supported
-// ambisonic order.
+// Maximum number of channels of a default constructed resampler based upon the
+// maximum supported ambisonic order.
 const size_t kMaxNumChannels =
     (kMaxSupportedAmbisonicOrder + 1) * (kMaxSupportedAmbisonicOrder + 1);
 
+// Number of filter taps per output frame in arbitrary-ratio mode when
+// upsampling. This matches the number of coefficients per phase of the
+// rational filter, rounded up to a multiple of the SIMD length.
+const size_t kNumArbitraryRatioTaps = 16;
+
+// Maximum ratio between the source and destination sampling rate in
+// arbitrary-ratio mode. When downsampling, the number of filter taps grows with
+// the ratio in order to keep the transition bandwidth constant.
+const size_t kMaxArbitraryRatio = 8;
+
+// Maximum number of filter taps per output frame in arbitrary-ratio mode.
+const size_t kMaxNumArbitraryRatioTaps =
+    kMaxArbitraryRatio * kNumArbitraryRatioTaps;
+
+// Number of fractional bits of fixed point input positions.
+const size_t kNumFractionalPositionBits = 32;
+const uint64_t kFractionalPositionMask =
+    (uint64_t(1) << kNumFractionalPositionBits) - 1;
+
+// Number of phases of the arbitrary-ratio filter table. Filter coefficients
+// between two phases are linearly interpolated.
+const size_t kNumArbitraryRatioPhaseBits = 7;
+const size_t kNumArbitraryRatioPhases = 1 << kNumArbitraryRatioPhaseBits;
+
+// Number of fractional position bits used to interpolate between two phases of
+// the arbitrary-ratio filter table.
+const size_t kNumPhaseInterpolationBits =
+    kNumFractionalPositionBits - kNumArbitraryRatioPhaseBits;
+const uint64_t kPhaseInterpolationMask =
+    (uint64_t(1) << kNumPhaseInterpolationBits) - 1;
+const float kPhaseInterpolationScale =
+    1.0f / static_cast<float>(uint64_t(1) << kNumPhaseInterpolationBits);
+
+// Alignment of each phase of the arbitrary-ratio filter table in bytes.
+const size_t kSimdSizeBytes = 16;
+
+// Relative change of the arbitrary-ratio cutoff frequency below which the
+// filter table is kept, e.g. while following a drifting clock.
+const float kArbitraryRatioCutoffTolerance = 1e-3f;
+
+// Returns whether the rational polyphase filter for the given sampling rates
+// fits into |kMaxSupportedNumFrames|.
+bool IsRationalFilterSupported(int source, int destination) {
+  const int max_rate =
+      std::max(source, destination) / FindGcd(source, destination);
+  size_t filter_length = max_rate * kTransitionBandwidthRatio;
+  filter_length += filter_length % 2;
+  return filter_length <= kMaxSupportedNumFrames;
+}
+
 }  // namespace
 
-Resampler::Resampler()
+Resampler::Resampler() : Resampler(kMaxNumChannels) {}
+
+Resampler::Resampler(size_t max_num_channels)
     : up_rate_(0),
       down_rate_(0),
       time_modulo_up_rate_(0),
@@ -56,102 +110,107 @@ Resampler::Resampler()
       num_channels_(0),
       coeffs_per_phase_(0),
       transposed_filter_coeffs_(kNumMonoChannels, kMaxSupportedNumFrames),
+      arbitrary_ratio_(false),
+      input_position_(0),
+      input_position_step_(0),
+      arbitrary_ratio_cutoff_(0.0f),
+      arbitrary_ratio_filter_coeffs_(
+          kNumMonoChannels,
+          2 * kNumArbitraryRatioPhases * kMaxNumArbitraryRatioTaps),
+      interpolated_filter_coeffs_(kNumMonoChannels, kMaxNumArbitraryRatioTaps),
       temporary_filter_coeffs_(kNumMonoChannels, kMaxSupportedNumFrames),
-      state_(kMaxNumChannels, kMaxSupportedNumFrames) {
+      state_(max_num_channels, 2 * kMaxNumArbitraryRatioTaps) {
   state_.Clear();
 }
 
 void Resampler::Process(const AudioBuffer& input, AudioBuffer* output) {
+  DCHECK_LE(output->num_frames(), GetMaxOutputLength(input.num_frames()));
+  Process(input, input.num_frames(), output);
+}
+
+void Resampler::Process(const AudioBuffer& input, size_t num_input_frames,
+                        AudioBuffer* output) {
 
   // See "Digital Signal Processing, 4th Edition, Prolakis and Manolakis,
   // Pearson, Chapter 11 (specificaly Figures 11.5.10 and 11.5.13).
   DCHECK_EQ(input.num_channels(), num_channels_);
-  const size_t input_length = input.num_frames();
+  DCHECK_LE(num_input_frames, input.num_frames());
+  const size_t input_length = num_input_frames;
   DCHECK_GE(output->num_frames(), GetNextOutputLength(input_length));
-  DCHECK_LE(output->num_frames(), GetMaxOutputLength(input_length));
   DCHECK_EQ(output->num_channels(), num_channels_);
   output->Clear();
 
-  if (up_rate_ == down_rate_) {
-    *output = input;
+  if (!arbitrary_ratio_ && up_rate_ == down_rate_) {
+    for (size_t channel = 0; channel < num_channels_; ++channel) {
+      std::copy_n(input[channel].begin(), input_length,
+                  (*output)[channel].begin());
+    }
     return;
   }
 
-  // |input_sample| is the last processed sample.
-  size_t input_sample = last_processed_sample_;
-  // |output_sample| is the output.
-  size_t output_sample = 0;
-
-  const auto& filter_coefficients = transposed_filter_coeffs_[0];
-
-  while (input_sample < input_length) {
-    size_t filter_index = time_modulo_up_rate_ * coeffs_per_phase_;
-    size_t offset_input_index = input_sample - coeffs_per_phase_ + 1;
-    const int offset = -static_cast<int>(offset_input_index);
-
-    if (offset > 0) {
-      // We will need to draw data from the |state_| buffer.
-      const int state_num_frames = static_cast<int>(coeffs_per_phase_ - 1);
-      int state_index = state_num_frames - offset;
-      while (state_index < state_num_frames) {
-        for (size_t channel = 0; channel < num_channels_; ++channel) {
-          (*output)[channel][output_sample] +=
-              state_[channel][state_index] * filter_coefficients[filter_index];
-        }
-        state_index++;
-        filter_index++;
-      }
-      // Move along by |offset| samples up as far as |input|.
-      offset_input_index += offset;
-    }
+  // Append the first frames of |input| to the |state_| buffer, such that the
+  // filter taps of output frames straddling both are contiguous.
+  DCHECK_GT(coeffs_per_phase_, 0U);
+  const size_t state_num_frames = coeffs_per_phase_ - 1;
+  const size_t num_appended_frames = std::min(input_length, state_num_frames);
+  for (size_t channel = 0; channel < num_channels_; ++channel) {
+    std::copy_n(input[channel].begin(), num_appended_frames,
+                state_[channel].begin() + state_num_frames);
+  }
 
-    // We now move back to where |input_sample| "points".
-    while (offset_input_index <= input_sample) {
-      for (size_t channel = 0; channel < num_channels_; ++channel) {
-        (*output)[channel][output_sample] +=
-            input[channel][offset_input_index] *
-            filter_coefficients[filter_index];
-      }
-      offset_input_index++;
-      filter_index++;
+  if (arbitrary_ratio_) {
+    ProcessArbitraryRatio(input, input_length, output);
+  } else {
+    // |input_sample| is the last processed sample.
+    size_t input_sample = last_processed_sample_;
+    // |output_sample| is the output.
+    size_t output_sample = 0;
+
+    const float* filter_coefficients = transposed_filter_coeffs_[0].begin();
+
+    while (input_sample < input_length) {
+      const float* phase_coefficients =
+          filter_coefficients + time_modulo_up_rate_ * coeffs_per_phase_;
+      FilterFrame(input, input_sample, phase_coefficients, output_sample,
+                  output);
+      output_sample++;
+
+      time_modulo_up_rate_ += down_rate_;
+      // Advance the input pointer.
+      input_sample += time_modulo_up_rate_ / up_rate_;
+      // Decide which phase of the polyphase filter to use next.
+      time_modulo_up_rate_ %= up_rate_;
     }
-    output_sample++;
-
-    time_modulo_up_rate_ += down_rate_;
-    // Advance the input pointer.
-    input_sample += time_modulo_up_rate_ / up_rate_;
-    // Decide which phase of the polyphase filter to use next.
-    time_modulo_up_rate_ %= up_rate_;
+    DCHECK_GE(input_sample, input_length);
+    last_processed_sample_ = input_sample - input_length;
   }
-  DCHECK_GE(input_sample, input_length);
-  last_processed_sample_ = input_sample - input_length;
 
-  // Take care of the |state_| buffer.
-  const int samples_left_in_input =
-      static_cast<int>(coeffs_per_phase_) - 1 - static_cast<int>(input_length);
-  if (samples_left_in_input > 0) {
-    for (size_t channel = 0; channel < num_channels_; ++channel) {
-      // Copy end of the |state_| buffer to the beginning.
-      auto& state_channel = state_[channel];
-      DCHECK_GE(static_cast<int>(state_channel.size()), samples_left_in_input);
-      std::copy_n(state_channel.end() - samples_left_in_input,
-                  samples_left_in_input, state_channel.begin());
-      // Then copy input to the end of the buffer.
-      std::copy_n(input[channel].begin(), input_length,
-                  state_channel.end() - input_length);
-    }
-  } else {
-    for (size_t channel = 0; channel < num_channels_; ++channel) {
-      // Copy the last of the |input| samples into the |state_| buffer.
-      DCHECK_GT(coeffs_per_phase_, 0U);
-      DCHECK_GT(input[channel].size(), coeffs_per_phase_ - 1);
-      std::copy_n(input[channel].end() - (coeffs_per_phase_ - 1),
-                  coeffs_per_phase_ - 1, state_[channel].begin());
+  // Keep the last |state_num_frames| frames of the input stream in the
+  // |state_| buffer.
+  for (size_t channel = 0; channel < num_channels_; ++channel) {
+    auto& state_channel = state_[channel];
+    if (input_length >= state_num_frames) {
+      std::copy_n(input[channel].begin() + input_length - state_num_frames,
+                  state_num_frames, state_channel.begin());
+    } else {
+      // The appended |input| frames follow the previous state.
+      std::copy_n(state_channel.begin() + input_length, state_num_frames,
+                  state_channel.begin());
     }
   }
 }
 
 size_t Resampler::GetMaxOutputLength(size_t input_length) const {
+  if (arbitrary_ratio_) {
+    DCHECK_GT(input_position_step_, 0U);
+    // The next input position is always less than |input_position_step_|, so
+    // the output length will be equal to the return value or the return
+    // value - 1.
+    const uint64_t input_end = static_cast<uint64_t>(input_length)
+                               << kNumFractionalPositionBits;
+    return static_cast<size_t>((input_end + input_position_step_ - 1) /
+                               input_position_step_);
+  }
   if (up_rate_ == down_rate_) {
     return input_length;
   }
@@ -164,6 +223,16 @@ size_t Resampler::GetMaxOutputLength(size_t input_length) const {
 }
 
 size_t Resampler::GetNextOutputLength(size_t input_length) const {
+  if (arbitrary_ratio_) {
+    const uint64_t input_end = static_cast<uint64_t>(input_length)
+                               << kNumFractionalPositionBits;
+    if (input_position_ >= input_end) {
+      return 0;
+    }
+    return static_cast<size_t>(
+        (input_end - input_position_ + input_position_step_ - 1) /
+        input_position_step_);
+  }
   if (up_rate_ == down_rate_) {
     return input_length;
   }
@@ -183,6 +252,13 @@ void Resampler::SetRateAndNumChannels(int source_frequency,
   DCHECK_GT(source_frequency, 0);
   DCHECK_GT(destination_frequency, 0);
   DCHECK_GT(num_channels, 0U);
+  DCHECK_LE(num_channels, state_.num_channels());
+  if (!IsRationalFilterSupported(source_frequency, destination_frequency)) {
+    SetArbitraryRateAndNumChannels(static_cast<double>(source_frequency),
+                                   static_cast<double>(destination_frequency),
+                                   num_channels);
+    return;
+  }
   const int greatest_common_divisor =
       FindGcd(destination_frequency, source_frequency);
   const size_t destination =
@@ -194,6 +270,11 @@ void Resampler::SetRateAndNumChannels(int source_frequency,
   // |GenerateInterpolatingFilter()|.
   const size_t old_state_size =
       coeffs_per_phase_ > 0 ? coeffs_per_phase_ - 1 : 0;
+  if (arbitrary_ratio_) {
+    arbitrary_ratio_ = false;
+    last_processed_sample_ =
+        static_cast<size_t>(input_position_ >> kNumFractionalPositionBits);
+  }
   if ((destination != up_rate_) || (source != down_rate_)) {
     up_rate_ = destination;
     down_rate_ = source;
@@ -208,57 +289,215 @@ void Resampler::SetRateAndNumChannels(int source_frequency,
   }
 
   // Update the |state_| buffer.
-  if (num_channels_ != num_channels) {
-    num_channels_ = num_channels;
-    InitializeStateBuffer(old_state_size);
+  num_channels_ = num_channels;
+  InitializeStateBuffer(old_state_size);
+}
+
+void Resampler::SetArbitraryRateAndNumChannels(double source_frequency,
+                                               double destination_frequency,
+                                               size_t num_channels) {
+  DCHECK_GT(source_frequency, 0.0);
+  DCHECK_GT(destination_frequency, 0.0);
+  DCHECK_GT(num_channels, 0U);
+  DCHECK_LE(num_channels, state_.num_channels());
+  const double ratio = source_frequency / destination_frequency;
+  DCHECK_LE(ratio, static_cast<double>(kMaxArbitraryRatio));
+  DCHECK_GE(ratio, 1.0 / static_cast<double>(kMaxArbitraryRatio));
+
+  const size_t old_state_size =
+      coeffs_per_phase_ > 0 ? coeffs_per_phase_ - 1 : 0;
+  // Band limit the output to the Nyquist frequency of the lower rate.
+  const float cutoff = static_cast<float>(std::min(1.0, 1.0 / ratio));
+  if (!arbitrary_ratio_) {
+    arbitrary_ratio_ = true;
+    // Make sure the rational filter is regenerated when switching back.
+    up_rate_ = 0;
+    down_rate_ = 0;
+    input_position_ = static_cast<uint64_t>(last_processed_sample_)
+                      << kNumFractionalPositionBits;
+    GenerateArbitraryRatioFilter(cutoff);
+  } else if (std::abs(cutoff - arbitrary_ratio_cutoff_) >
+             kArbitraryRatioCutoffTolerance * arbitrary_ratio_cutoff_) {
+    GenerateArbitraryRatioFilter(cutoff);
   }
+  input_position_step_ = static_cast<uint64_t>(std::llround(
+      ratio * static_cast<double>(uint64_t(1) << kNumFractionalPositionBits)));
+
+  // Update the |state_| buffer.
+  num_channels_ = num_channels;
+  InitializeStateBuffer(old_state_size);
 }
 
 bool Resampler::AreSampleRatesSupported(int source, int destination) {
   DCHECK_GT(source, 0);
   DCHECK_GT(destination, 0);
   // Determines whether sample rates are supported based upon whether our
-  // maximul filter lenhgth is big enough to hold the corresponding
-  // interpolation filter.
-  const int max_rate =
-      std::max(source, destination) / FindGcd(source, destination);
-  size_t filter_length = max_rate * kTransitionBandwidthRatio;
-  filter_length += filter_length % 2;
-  return filter_length <= kMaxSupportedNumFrames;
+  // maximum filter length is big enough to hold the corresponding
+  // interpolation filter. Otherwise, the rates are supported in
+  // arbitrary-ratio mode as long as their ratio is within range.
+  if (IsRationalFilterSupported(source, destination)) {
+    return true;
+  }
+  const size_t max_rate = static_cast<size_t>(std::max(source, destination));
+  const size_t min_rate = static_cast<size_t>(std::min(source, destination));
+  return max_rate <= kMaxArbitraryRatio * min_rate;
 }
 
 void Resampler::ResetState() {
 
   time_modulo_up_rate_ = 0;
   last_processed_sample_ = 0;
+  input_position_ = 0;
   state_.Clear();
 }
 
 void Resampler::InitializeStateBuffer(size_t old_state_num_frames) {
   // Update the |state_| buffer if it is null or if the number of coefficients
   // per phase in the polyphase filter has changed.
-  if (up_rate_ == down_rate_ || num_channels_ == 0) {
+  if ((!arbitrary_ratio_ && up_rate_ == down_rate_) || num_channels_ == 0) {
     return;
   }
   // If the |state_| buffer is to be kept. For example in the case of a change
-  // in either source or destination sampling rate, maintaining the old |state_|
-  // buffers contents allows a glitch free transition.
+  // in either source or destination sampling rate, maintaining the most recent
+  // frames of the old |state_| buffer allows a glitch free transition.
   const size_t new_state_num_frames =
       coeffs_per_phase_ > 0 ? coeffs_per_phase_ - 1 : 0;
   if (old_state_num_frames != new_state_num_frames) {
-    const size_t min_size =
-        std::min(new_state_num_frames, old_state_num_frames);
-    const size_t max_size =
-        std::max(new_state_num_frames, old_state_num_frames);
     for (size_t channel = 0; channel < num_channels_; ++channel) {
       auto& state_channel = state_[channel];
-      DCHECK_LT(state_channel.begin() + max_size, state_channel.end());
-      std::fill(state_channel.begin() + min_size,
-                state_channel.begin() + max_size, 0.0f);
+      DCHECK_LE(2 * new_state_num_frames, state_channel.size());
+      if (new_state_num_frames < old_state_num_frames) {
+        std::copy(
+            state_channel.begin() + old_state_num_frames - new_state_num_frames,
+            state_channel.begin() + old_state_num_frames,
+            state_channel.begin());
+      } else {
+        std::copy_backward(state_channel.begin(),
+                           state_channel.begin() + old_state_num_frames,
+                           state_channel.begin() + new_state_num_frames);
+        std::fill(state_channel.begin(),
+                  state_channel.begin() + new_state_num_frames -
+                      old_state_num_frames,
+                  0.0f);
+      }
     }
   }
 }
 
+void Resampler::FilterFrame(const AudioBuffer& input, size_t input_sample,
+                            const float* coefficients, size_t output_sample,
+                            AudioBuffer* output) const {
+  const size_t state_num_frames = coeffs_per_phase_ - 1;
+  for (size_t channel = 0; channel < num_channels_; ++channel) {
+    // The filter taps start |state_num_frames| frames before |input_sample|.
+    const float* taps =
+        input_sample < state_num_frames
+            ? state_[channel].begin() + input_sample
+            : input[channel].begin() + (input_sample - state_num_frames);
+    (*output)[channel][output_sample] =
+        DotProduct(coeffs_per_phase_, taps, coefficients);
+  }
+}
+
+void Resampler::ProcessArbitraryRatio(const AudioBuffer& input,
+                                      size_t input_length,
+                                      AudioBuffer* output) {
+  DCHECK_GT(input_position_step_, 0U);
+  const uint64_t input_end = static_cast<uint64_t>(input_length)
+                             << kNumFractionalPositionBits;
+  const auto& filter_coefficients = arbitrary_ratio_filter_coeffs_[0];
+  float* interpolated_coefficients = interpolated_filter_coeffs_[0].begin();
+
+  size_t output_sample = 0;
+  while (input_position_ < input_end) {
+    const size_t input_sample =
+        static_cast<size_t>(input_position_ >> kNumFractionalPositionBits);
+    const uint64_t fraction = input_position_ & kFractionalPositionMask;
+    const size_t phase =
+        static_cast<size_t>(fraction >> kNumPhaseInterpolationBits);
+    const float interpolation_factor =
+        static_cast<float>(fraction & kPhaseInterpolationMask) *
+        kPhaseInterpolationScale;
+
+    // Interpolate the coefficients between |phase| and the following phase.
+    const float* phase_coefficients =
+        filter_coefficients.begin() + 2 * phase * coeffs_per_phase_;
+    std::copy_n(phase_coefficients, coeffs_per_phase_,
+                interpolated_coefficients);
+    ScalarMultiplyAndAccumulate(coeffs_per_phase_, interpolation_factor,
+                                phase_coefficients + coeffs_per_phase_,
+                                interpolated_coefficients);
+    FilterFrame(input, input_sample, interpolated_coefficients, output_sample,
+                output);
+    ++output_sample;
+    input_position_ += input_position_step_;
+  }
+  input_position_ -= input_end;
+}
+
+void Resampler::GenerateArbitraryRatioFilter(float cutoff) {
+  DCHECK_GT(cutoff, 0.0f);
+  DCHECK_LE(cutoff, 1.0f);
+  arbitrary_ratio_cutoff_ = cutoff;
+  // Scale the number of taps with the inverse cutoff to keep the transition
+  // bandwidth constant, and keep each phase aligned for SIMD access.
+  const size_t num_taps = FindNextAlignedArrayIndex(
+      static_cast<size_t>(
+          std::ceil(static_cast<float>(kNumArbitraryRatioTaps) / cutoff)),
+      sizeof(float), kSimdSizeBytes);
+  coeffs_per_phase_ = std::min(num_taps, kMaxNumArbitraryRatioTaps);
+
+  // The Hann windowed sinc spans |coeffs_per_phase_| input frames and is
+  // centered on the middle frame. Phase p evaluates it at an offset of
+  // p / |kNumArbitraryRatioPhases| frames, with the coefficients flipped so
+  // that they are ordered from the oldest to the most recent input frame.
+  const double window_length = static_cast<double>(coeffs_per_phase_);
+  const double half_window_length = window_length / 2.0;
+  auto generate_phase = [&](size_t phase, float* phase_coefficients) {
+    const double offset = static_cast<double>(phase) /
+                          static_cast<double>(kNumArbitraryRatioPhases);
+    double sum = 0.0;
+    for (size_t tap = 0; tap < coeffs_per_phase_; ++tap) {
+      const double time =
+          offset + static_cast<double>(coeffs_per_phase_ - 1 - tap);
+      const double window =
+          0.5 - 0.5 * std::cos(2.0 * M_PI * time / window_length);
+      const double sinc_time = time - half_window_length;
+      const double sinc =
+          std::abs(sinc_time) < kEpsilonDouble
+              ? static_cast<double>(cutoff)
+              : std::sin(M_PI * cutoff * sinc_time) / (M_PI * sinc_time);
+      phase_coefficients[tap] = static_cast<float>(window * sinc);
+      sum += window * sinc;
+    }
+    // Normalize for unity gain at DC.
+    DCHECK_GT(std::abs(sum), kEpsilonDouble);
+    ScalarMultiply(coeffs_per_phase_, static_cast<float>(1.0 / sum),
+                   phase_coefficients, phase_coefficients);
+  };
+
+  // Each phase is followed by its difference to the next phase.
+  auto& filter_coefficients = arbitrary_ratio_filter_coeffs_[0];
+  float* last_phase_coefficients = interpolated_filter_coeffs_[0].begin();
+  generate_phase(kNumArbitraryRatioPhases, last_phase_coefficients);
+  for (size_t phase = 0; phase < kNumArbitraryRatioPhases; ++phase) {
+    generate_phase(phase,
+                   filter_coefficients.begin() + 2 * phase * coeffs_per_phase_);
+  }
+  for (size_t phase = 0; phase < kNumArbitraryRatioPhases; ++phase) {
+    const float* phase_coefficients =
+        filter_coefficients.begin() + 2 * phase * coeffs_per_phase_;
+    const float* next_phase_coefficients =
+        phase + 1 < kNumArbitraryRatioPhases
+            ? phase_coefficients + 2 * coeffs_per_phase_
+            : last_phase_coefficients;
+    SubtractPointwise(coeffs_per_phase_, phase_coefficients,
+                      next_phase_coefficients,
+                      filter_coefficients.begin() +
+                          (2 * phase + 1) * coeffs_per_phase_);
+  }
+}
+
 void Resampler::GenerateInterpolatingFilter(int sample_rate) {
   // See "Digital Signal Processing, 4th Edition, Prolakis and Manolakis,
   // Pearson, Chapter 11 (specificaly Figures 11.5.10 and 11.5.13).
@@ -276,6 +515,7 @@ void Resampler::GenerateInterpolatingFilter(int sample_rate) {
   const size_t transposed_length =
       filter_length + max_rate - (filter_length % max_rate);
   coeffs_per_phase_ = transposed_length / max_rate;
+  DCHECK_LE(coeffs_per_phase_, kMaxNumArbitraryRatioTaps);
   ArrangeFilterAsPolyphase(filter_length, *filter_channel);
 }
 
@@ -17,15 +17,31 @@ limitations under the License.
 #ifndef RESONANCE_AUDIO_DSP_RESAMPLER_H_
 #define RESONANCE_AUDIO_DSP_RESAMPLER_H_
 
+#include <cstdint>
+
 #include "base/audio_buffer.h"
 
 namespace vraudio {
 
-// Class that provides rational resampling of audio data.
+// Class that provides rational and arbitrary-ratio resampling of audio data.
+//
+// Rate pairs whose polyphase filter fits into |kMaxSupportedNumFrames| are
+// resampled exactly with a rational polyphase filter. All other rate pairs, as
+// well as fractional rates set via |SetArbitraryRateAndNumChannels|, are
+// resampled by linearly interpolating between the phases of a fixed-size
+// polyphase filter table. In both modes each output frame is computed as a
+// dot product over contiguous filter taps of each channel.
 class Resampler {
  public:
   Resampler();
 
+  // Constructs a resampler for up to the given number of channels, which sizes
+  // its filter state. The default constructor supports Ambisonic input up to
+  // |kMaxSupportedAmbisonicOrder|.
+  //
+  // @param max_num_channels Maximum number of resampled channels.
+  explicit Resampler(size_t max_num_channels);
+
   // Resamples an |AudioBuffer| of input data sampled at |source_frequency| to
   // |destination_frequency|.
   //
@@ -33,6 +49,17 @@ class Resampler {
   // @param output Resampled output data.
   void Process(const AudioBuffer& input, AudioBuffer* output);
 
+  // Resamples the first |num_input_frames| frames of |input|, which allows for
+  // input and output buffers that are preallocated to a maximum size. Only the
+  // first |GetNextOutputLength(num_input_frames)| frames of |output| hold
+  // resampled data.
+  //
+  // @param input Input data to be resampled.
+  // @param num_input_frames Number of frames of |input| to be resampled.
+  // @param output Resampled output data.
+  void Process(const AudioBuffer& input, size_t num_input_frames,
+               AudioBuffer* output);
+
   // Returns the maximum length which the output buffer will be, given the
   // current source and destination frequencies and input length. The actual
   // output length will either be this or one less.
@@ -50,7 +77,8 @@ class Resampler {
 
   // Sets the source and destination sampling rate as well as the number of
   // channels. Note this method only resets the filter state number of channel
-  // changes.
+  // changes. Rate pairs which cannot be resampled by a rational polyphase
+  // filter are resampled in arbitrary-ratio mode.
   //
   // @param source_frequency Sampling rate of input data.
   // @param destination_frequency Desired output sampling rate.
@@ -58,7 +86,20 @@ class Resampler {
   void SetRateAndNumChannels(int source_frequency, int destination_frequency,
                              size_t num_channels);
 
-  // Returns whether the sampling rates provided are supported by the resampler.
+  // Sets fractional source and destination sampling rates as well as the
+  // number of channels and switches to arbitrary-ratio mode. The filter state
+  // is kept, so this method may be called between buffers to follow a
+  // drifting clock without glitches.
+  //
+  // @param source_frequency Sampling rate of input data.
+  // @param destination_frequency Desired output sampling rate.
+  // @param num_channels Number of channels to process.
+  void SetArbitraryRateAndNumChannels(double source_frequency,
+                                      double destination_frequency,
+                                      size_t num_channels);
+
+  // Returns whether the sampling rates provided are supported by the resampler,
+  // either in rational or in arbitrary-ratio mode.
   //
   // @param source Source sampling rate.
   // @param destination Destination sampling rate.
@@ -72,12 +113,43 @@ class Resampler {
  private:
   friend class PolyphaseFilterTest;
   // Initializes the |state_| buffer. Called when sampling rate is changed or
-  // the state is reset.
+  // the state is reset. The most recent input frames are kept in order to
+  // allow for a glitch free transition.
   //
   // @param size_t old_state_num_frames Number of frames in the |state_| buffer
   //     previous to the most recent call to |GenerateInterpolatingFilter|.
   void InitializeStateBuffer(size_t old_state_num_frames);
 
+  // Computes one output frame of all channels as the dot product of
+  // |coeffs_per_phase_| filter coefficients with the input frames ending at
+  // |input_sample|. Frames preceding the start of |input| are read from the
+  // |state_| buffer.
+  //
+  // @param input Input data to be resampled.
+  // @param input_sample Index of the most recent input frame to filter.
+  // @param coefficients Filter coefficients, ordered from oldest to most
+  //     recent input frame.
+  // @param output_sample Index of the output frame to compute.
+  // @param output Resampled output data.
+  void FilterFrame(const AudioBuffer& input, size_t input_sample,
+                   const float* coefficients, size_t output_sample,
+                   AudioBuffer* output) const;
+
+  // Resamples |input| in arbitrary-ratio mode.
+  //
+  // @param input Input data to be resampled.
+  // @param input_length Number of frames of |input| to be resampled.
+  // @param output Resampled output data.
+  void ProcessArbitraryRatio(const AudioBuffer& input, size_t input_length,
+                             AudioBuffer* output);
+
+  // Generates the interpolated polyphase filter table used in arbitrary-ratio
+  // mode.
+  //
+  // @param cutoff Cutoff frequency of the filter relative to the Nyquist
+  //     frequency of the input, in range (0, 1].
+  void GenerateArbitraryRatioFilter(float cutoff);
+
   // Generates a windowed sinc to act as the interpolating/anti-aliasing filter.
   //
   // @param sample_rate The system sampling rate.
@@ -122,11 +194,36 @@ class Resampler {
   // Filter coefficients stored in polyphase form.
   AudioBuffer transposed_filter_coeffs_;
 
+  // True if the resampler operates in arbitrary-ratio mode.
+  bool arbitrary_ratio_;
+
+  // Position of the next output frame relative to the start of the next input
+  // buffer in arbitrary-ratio mode, in fixed point input frames.
+  uint64_t input_position_;
+
+  // Distance between two output frames in arbitrary-ratio mode, in fixed point
+  // input frames.
+  uint64_t input_position_step_;
+
+  // Cutoff frequency of the arbitrary-ratio filter relative to the input
+  // Nyquist frequency.
+  float arbitrary_ratio_cutoff_;
+
+  // Filter table of the arbitrary-ratio mode. Each phase holds the flipped
+  // filter coefficients followed by their difference to the next phase.
+  AudioBuffer arbitrary_ratio_filter_coeffs_;
+
+  // Filter coefficients interpolated for the current output frame in
+  // arbitrary-ratio mode.
+  AudioBuffer interpolated_filter_coeffs_;
+
   // Filter coefficients in planar form, used for calculating the transposed
   // filter.
   AudioBuffer temporary_filter_coeffs_;
 
-  // Buffer holding the samples of input required between input buffers.
+  // Buffer holding the samples of input required between input buffers,
+  // followed by the first samples of the current input buffer so that filter
+  // taps straddling two input buffers are contiguous in memory.
   AudioBuffer state_;
 };
 
@@ -0,0 +1,68 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "dsp/resampler.h"
+
+#include "benchmark/benchmark.h"
+#include "ambisonics/utils.h"
+#include "base/audio_buffer.h"
+#include "utils/benchmark_util.h"
+
+namespace vraudio {
+
+namespace {
+
+// Resamples an ambisonic sound field of |state.range(1)| order, whose number of
+// channels is |GetNumPeriphonicComponents(order)|.
+void ResampleSoundfield(int source_rate, int destination_rate,
+                        benchmark::State* state) {
+  const size_t frames_per_buffer = static_cast<size_t>(state->range(0));
+  const size_t num_channels =
+      GetNumPeriphonicComponents(static_cast<int>(state->range(1)));
+  Resampler resampler;
+  resampler.SetRateAndNumChannels(source_rate, destination_rate, num_channels);
+  AudioBuffer input(num_channels, frames_per_buffer);
+  FillWithNoise(&input);
+  AudioBuffer output(num_channels,
+                     resampler.GetMaxOutputLength(frames_per_buffer));
+  for (auto _ : *state) {
+    resampler.Process(input, &output);
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(frames_per_buffer, state);
+}
+
+void BM_ResamplerUp(benchmark::State& state) {
+  ResampleSoundfield(44100, 48000, &state);
+}
+BENCHMARK(BM_ResamplerUp)->Apply(FramesPerBufferAndOrderArguments);
+
+void BM_ResamplerDown(benchmark::State& state) {
+  ResampleSoundfield(48000, 44100, &state);
+}
+BENCHMARK(BM_ResamplerDown)->Apply(FramesPerBufferAndOrderArguments);
+
+// Rate pair without a rational polyphase filter, resampled in arbitrary-ratio
+// mode.
+void BM_ResamplerArbitraryRatio(benchmark::State& state) {
+  ResampleSoundfield(44100, 48001, &state);
+}
+BENCHMARK(BM_ResamplerArbitraryRatio)
+    ->Apply(FramesPerBufferAndOrderArguments);
+
+}  // namespace
+
+}  // namespace vraudio
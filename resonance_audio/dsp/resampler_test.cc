@@ -16,6 +16,8 @@ limitations under the License.
 
 #include "dsp/resampler.h"
 
+#include <algorithm>
+#include <cmath>
 #include <numeric>
 #include <utility>
 #include <vector>
@@ -216,13 +218,17 @@ TEST(ResamplerTest, GetNextOutputLengthTest) {
 }
 
 TEST(Resampler, AreSampleRatesSupportedTest) {
-  const size_t kNumPairs = 6;
-  const int kSourceRates[kNumPairs] = {4000, 16000, 44100, 96000, 41999, 48000};
-  const int kDestRates[kNumPairs] = {96000, 44100, 48000, 32000, 44100, 43210};
-  const bool kExpectedResults[kNumPairs] = {true, true,  true,
-                                            true, false, false};
-
-  // We generally support only rates with relatively high GCD.
+  const size_t kNumPairs = 8;
+  const int kSourceRates[kNumPairs] = {4000,  16000, 44100, 96000,
+                                       41999, 48000, 1000,  44101};
+  const int kDestRates[kNumPairs] = {96000, 44100, 48000, 32000,
+                                     44100, 43210, 44101, 1000};
+  const bool kExpectedResults[kNumPairs] = {true, true, true,  true,
+                                            true, true, false, false};
+
+  // Rates with relatively high GCD are supported by the rational filter. Other
+  // rates are supported in arbitrary-ratio mode, unless their ratio is too
+  // large.
   for (size_t i = 0; i < kNumPairs; ++i) {
     const bool result =
         Resampler::AreSampleRatesSupported(kSourceRates[i], kDestRates[i]);
@@ -256,7 +262,164 @@ TEST_P(OutputLengthTest, OutputLengthTest) {
 
 INSTANTIATE_TEST_CASE_P(RatePairs, OutputLengthTest,
                         ::testing::Values(std::make_pair(44100, 48000),
-                                          std::make_pair(48000, 44100)));
+                                          std::make_pair(48000, 44100),
+                                          std::make_pair(44100, 48001),
+                                          std::make_pair(48001, 22050)));
+
+// Tests that a sine wave resampled in arbitrary-ratio mode matches the sine
+// wave sampled at the destination rate, delayed by the filter latency.
+TEST(ResamplerTest, ArbitraryRatioSineTest) {
+  const double kSourceRate = 44100.0;
+  const double kDestinationRates[] = {48001.0, 31999.5};
+  // Latency of the arbitrary-ratio filter in source frames, per destination
+  // rate.
+  const double kLatencies[] = {8.0, 12.0};
+  const size_t kNumBuffers = 8;
+  const size_t kSkippedOutputFrames = 64;
+  const float kMaxError = 5e-3f;
+
+  for (size_t rate = 0; rate < 2; ++rate) {
+    Resampler resampler;
+    resampler.SetArbitraryRateAndNumChannels(
+        kSourceRate, kDestinationRates[rate], kNumMonoChannels);
+    AudioBuffer input(kNumMonoChannels, kInputBufferLength);
+    size_t input_offset = 0;
+    size_t output_offset = 0;
+    for (size_t buffer = 0; buffer < kNumBuffers; ++buffer) {
+      for (size_t frame = 0; frame < kInputBufferLength; ++frame) {
+        input[0][frame] = static_cast<float>(
+            std::sin(2.0 * M_PI * kToneFrequency *
+                     static_cast<double>(input_offset + frame) / kSourceRate));
+      }
+      AudioBuffer output(kNumMonoChannels,
+                         resampler.GetNextOutputLength(kInputBufferLength));
+      resampler.Process(input, &output);
+      for (size_t frame = 0; frame < output.num_frames(); ++frame) {
+        const size_t output_frame = output_offset + frame;
+        if (output_frame < kSkippedOutputFrames) {
+          continue;
+        }
+        const double source_time =
+            static_cast<double>(output_frame) / kDestinationRates[rate] -
+            kLatencies[rate] / kSourceRate;
+        const float expected = static_cast<float>(
+            std::sin(2.0 * M_PI * kToneFrequency * source_time));
+        EXPECT_NEAR(expected, output[0][frame], kMaxError);
+      }
+      input_offset += kInputBufferLength;
+      output_offset += output.num_frames();
+    }
+    // The number of output frames follows the sampling rate ratio.
+    const double expected_output_length = static_cast<double>(input_offset) *
+                                          kDestinationRates[rate] / kSourceRate;
+    EXPECT_NEAR(expected_output_length, static_cast<double>(output_offset),
+                1.0);
+  }
+}
+
+// Tests that the output stays continuous while the destination rate follows a
+// drifting clock.
+TEST(ResamplerTest, DriftingClockTest) {
+  const int kSampleRate = 48000;
+  const size_t kNumBuffers = 64;
+  const float kMaxDrift = 2e-3f;
+  // Maximum difference between two consecutive frames of the sine wave, with
+  // a margin for the passband ripple of the filter.
+  const float kMaxFrameDifference = static_cast<float>(
+      1.01 * 2.0 * M_PI * kToneFrequency * (1.0 + kMaxDrift) / kSampleRate);
+
+  Resampler resampler;
+  AudioBuffer input(kNumMonoChannels, kInputBufferLength);
+  size_t input_offset = 0;
+  float previous_output = 0.0f;
+  for (size_t buffer = 0; buffer < kNumBuffers; ++buffer) {
+    const double drift =
+        kMaxDrift * std::sin(2.0 * M_PI * static_cast<double>(buffer) /
+                             static_cast<double>(kNumBuffers));
+    resampler.SetArbitraryRateAndNumChannels(
+        kSampleRate, kSampleRate * (1.0 + drift), kNumMonoChannels);
+    for (size_t frame = 0; frame < kInputBufferLength; ++frame) {
+      input[0][frame] = static_cast<float>(
+          std::sin(2.0 * M_PI * kToneFrequency *
+                   static_cast<double>(input_offset + frame) / kSampleRate));
+    }
+    AudioBuffer output(kNumMonoChannels,
+                       resampler.GetNextOutputLength(kInputBufferLength));
+    resampler.Process(input, &output);
+    for (size_t frame = 0; frame < output.num_frames(); ++frame) {
+      if (buffer > 0) {
+        EXPECT_LE(std::abs(output[0][frame] - previous_output),
+                  kMaxFrameDifference);
+      }
+      previous_output = output[0][frame];
+    }
+    input_offset += kInputBufferLength;
+  }
+}
+
+// Tests that switching between rational and arbitrary-ratio mode produces the
+// expected output lengths.
+TEST(ResamplerTest, SwitchModeTest) {
+  Resampler resampler;
+  resampler.SetRateAndNumChannels(44100, 48000, kNumStereoChannels);
+  AudioBuffer input(kNumStereoChannels, kInputBufferLength);
+  GenerateSineWave(kToneFrequency, kSourceDataSampleRate, &input[0]);
+  GenerateSineWave(kToneFrequency, kSourceDataSampleRate, &input[1]);
+  const int kDestinationRates[] = {48000, 48001, 24000, 43210, 44100};
+  for (const int destination_rate : kDestinationRates) {
+    resampler.SetRateAndNumChannels(kSourceDataSampleRate, destination_rate,
+                                    kNumStereoChannels);
+    const size_t max_output_length =
+        resampler.GetMaxOutputLength(kInputBufferLength);
+    const size_t next_output_length =
+        resampler.GetNextOutputLength(kInputBufferLength);
+    EXPECT_LE(max_output_length - next_output_length, 1U);
+    AudioBuffer output(kNumStereoChannels, next_output_length);
+    resampler.Process(input, &output);
+    // Both channels hold the same signal.
+    for (size_t frame = 0; frame < output.num_frames(); ++frame) {
+      EXPECT_EQ(output[0][frame], output[1][frame]);
+    }
+  }
+}
+
+// Tests that resampling the first frames of preallocated buffers matches
+// resampling buffers of the exact size, in all resampling modes.
+TEST(ResamplerTest, ProcessFirstFramesTest) {
+  const int kDestinationRates[] = {44100, 48000, 24000, 43210};
+  const size_t kNumInputFrames[] = {kInputBufferLength, 1, 100, 17};
+  const size_t kNumBuffers = 4;
+  AudioBuffer input(kNumMonoChannels, kInputBufferLength);
+  GenerateSineWave(kToneFrequency, kSourceDataSampleRate, &input[0]);
+  for (const int destination_rate : kDestinationRates) {
+    Resampler resampler;
+    resampler.SetRateAndNumChannels(kSourceDataSampleRate, destination_rate,
+                                    kNumMonoChannels);
+    Resampler reference_resampler;
+    reference_resampler.SetRateAndNumChannels(
+        kSourceDataSampleRate, destination_rate, kNumMonoChannels);
+    AudioBuffer output(kNumMonoChannels,
+                       resampler.GetMaxOutputLength(kInputBufferLength));
+    for (size_t buffer = 0; buffer < kNumBuffers; ++buffer) {
+      const size_t num_input_frames = kNumInputFrames[buffer];
+      const size_t num_output_frames =
+          resampler.GetNextOutputLength(num_input_frames);
+      resampler.Process(input, num_input_frames, &output);
+
+      AudioBuffer reference_input(kNumMonoChannels, num_input_frames);
+      std::copy_n(input[0].begin(), num_input_frames,
+                  reference_input[0].begin());
+      AudioBuffer reference_output(
+          kNumMonoChannels,
+          reference_resampler.GetNextOutputLength(num_input_frames));
+      reference_resampler.Process(reference_input, &reference_output);
+      ASSERT_EQ(reference_output.num_frames(), num_output_frames);
+      for (size_t frame = 0; frame < num_output_frames; ++frame) {
+        EXPECT_EQ(reference_output[0][frame], output[0][frame]);
+      }
+    }
+  }
+}
 
 }  // namespace
 
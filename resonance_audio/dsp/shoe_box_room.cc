@@ -16,46 +16,139 @@ limitations under the License.
 
 #include "dsp/shoe_box_room.h"
 
+#include <algorithm>
+#include <cstdlib>
+
 #include "base/constants_and_types.h"
+#include "base/logging.h"
 
 namespace vraudio {
 
+namespace {
+
+// Number of axes of the shoe-box room.
+const int kNumRoomAxes = 3;
+
+// Computes the reflection of a single image source. The image source is denoted
+// by its signed |image_indices| along each room axis, where an index of -n (n)
+// corresponds to n alternating bounces off the walls of that axis, starting
+// with the (-)ive ((+)ive) wall.
+Reflection ComputeImageSourceReflection(
+    const WorldPosition& relative_listener_position,
+    const WorldPosition& offsets, const float* reflection_coefficients,
+    const int* image_indices) {
+  // Since all the sources are 'attached' to the listener in the computation
+  // of reflections, the image source is mirrored at half of its actual path,
+  // which yields the listener-to-wall distance for the first order
+  // reflections.
+  WorldPosition half_path(0.0f, 0.0f, 0.0f);
+  float reflection_coefficient = 1.0f;
+  for (int axis = 0; axis < kNumRoomAxes; ++axis) {
+    const int image_index = image_indices[axis];
+    const int num_bounces = std::abs(image_index);
+    half_path[axis] = static_cast<float>(image_index) * offsets[axis];
+    if (num_bounces % 2 == 1) {
+      // Odd number of bounces mirror the listener position along the axis.
+      half_path[axis] -= relative_listener_position[axis];
+    }
+    const size_t first_wall = 2 * axis + (image_index > 0 ? 1 : 0);
+    const size_t second_wall = 2 * axis + (image_index > 0 ? 0 : 1);
+    for (int bounce = 0; bounce < num_bounces; ++bounce) {
+      reflection_coefficient *=
+          reflection_coefficients[bounce % 2 == 0 ? first_wall : second_wall];
+    }
+  }
+  const float half_path_length = half_path.norm();
+  // We add 1.0f to the computed distance in order to avoid delay time
+  // approaching 0 and the magnitude approaching +inf.
+  const float distance_travelled = half_path_length + 1.0f;
+
+  Reflection reflection;
+  // Convert distances to time delays in seconds.
+  reflection.delay_time_seconds = distance_travelled / kSpeedOfSound;
+  // Division by distance is performed here as we don't want this applied more
+  // than once.
+  reflection.magnitude = reflection_coefficient / distance_travelled;
+  if (half_path_length > kEpsilonFloat) {
+    reflection.direction = half_path / half_path_length;
+  } else {
+    // The listener is on the reflecting walls, use the direction of the image
+    // source lattice instead.
+    reflection.direction =
+        WorldPosition(static_cast<float>(image_indices[0]),
+                      static_cast<float>(image_indices[1]),
+                      static_cast<float>(image_indices[2]))
+            .normalized();
+  }
+  return reflection;
+}
+
+}  // namespace
+
+size_t GetNumImageSources(int reflection_order) {
+  DCHECK_GT(reflection_order, 0);
+  size_t num_image_sources = 0;
+  for (int order = 1; order <= reflection_order; ++order) {
+    num_image_sources += static_cast<size_t>(4 * order * order + 2);
+  }
+  return num_image_sources;
+}
+
+void ComputeReflections(const WorldPosition& relative_listener_position,
+                        const WorldPosition& room_dimensions,
+                        const float* reflection_coefficients,
+                        std::vector<Reflection>* reflections) {
+  ComputeReflections(relative_listener_position, room_dimensions,
+                     reflection_coefficients, 1 /* reflection_order */,
+                     reflections);
+}
+
 void ComputeReflections(const WorldPosition& relative_listener_position,
                         const WorldPosition& room_dimensions,
                         const float* reflection_coefficients,
+                        int reflection_order,
                         std::vector<Reflection>* reflections) {
   DCHECK(reflection_coefficients);
   DCHECK(reflections);
-  DCHECK_EQ(reflections->size(), kNumRoomSurfaces);
+  DCHECK_GT(reflection_order, 0);
+  DCHECK_EQ(reflections->size(), GetNumImageSources(reflection_order));
   const WorldPosition kOrigin(0.0f, 0.0f, 0.0f);
   if (!IsPositionInAabb(relative_listener_position, kOrigin, room_dimensions)) {
     // Listener is outside the room, skip computation.
     std::fill(reflections->begin(), reflections->end(), Reflection());
     return;
   }
-  // Calculate the distance of the listener to each wall.
-  // Since all the sources are 'attached' to the listener in the computation
-  // of reflections, the distance travelled is arbitrary. So, we add 1.0f to
-  // the computed distance in order to avoid delay time approaching 0 and the
-  // magnitude approaching +inf.
   const WorldPosition offsets = 0.5f * room_dimensions;
-  const float distances_travelled[kNumRoomSurfaces] = {
-      offsets[0] + relative_listener_position[0] + 1.0f,
-      offsets[0] - relative_listener_position[0] + 1.0f,
-      offsets[1] + relative_listener_position[1] + 1.0f,
-      offsets[1] - relative_listener_position[1] + 1.0f,
-      offsets[2] + relative_listener_position[2] + 1.0f,
-      offsets[2] - relative_listener_position[2] + 1.0f};
-
-  for (size_t i = 0; i < kNumRoomSurfaces; ++i) {
-    // Convert distances to time delays in seconds.
-    (*reflections)[i].delay_time_seconds =
-        distances_travelled[i] / kSpeedOfSound;
-    // Division by distance is performed here as we don't want this applied more
-    // than once.
-    (*reflections)[i].magnitude =
-        reflection_coefficients[i] / distances_travelled[i];
+  size_t reflection_index = 0;
+  // First order reflections off each wall.
+  for (size_t surface = 0; surface < kNumRoomSurfaces; ++surface) {
+    int image_indices[kNumRoomAxes] = {0, 0, 0};
+    image_indices[surface / 2] = (surface % 2 == 0) ? -1 : 1;
+    (*reflections)[reflection_index++] = ComputeImageSourceReflection(
+        relative_listener_position, offsets, reflection_coefficients,
+        image_indices);
+  }
+  // Higher order reflections, i.e. all the image sources whose indices sum up
+  // to |order| bounces in absolute value.
+  for (int order = 2; order <= reflection_order; ++order) {
+    for (int x = -order; x <= order; ++x) {
+      const int remaining_x = order - std::abs(x);
+      for (int y = -remaining_x; y <= remaining_x; ++y) {
+        const int remaining_y = remaining_x - std::abs(y);
+        int image_indices[kNumRoomAxes] = {x, y, -remaining_y};
+        (*reflections)[reflection_index++] = ComputeImageSourceReflection(
+            relative_listener_position, offsets, reflection_coefficients,
+            image_indices);
+        if (remaining_y > 0) {
+          image_indices[2] = remaining_y;
+          (*reflections)[reflection_index++] = ComputeImageSourceReflection(
+              relative_listener_position, offsets, reflection_coefficients,
+              image_indices);
+        }
+      }
+    }
   }
+  DCHECK_EQ(reflection_index, reflections->size());
 }
 
 }  // namespace vraudio
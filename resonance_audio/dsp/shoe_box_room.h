@@ -24,6 +24,14 @@ limitations under the License.
 
 namespace vraudio {
 
+// Returns the number of image sources of a shoe-box room up to the given
+// reflection order, i.e. the number of reflections computed by
+// |ComputeReflections|. Each order n adds 4n^2 + 2 image sources.
+//
+// @param reflection_order Maximum number of wall bounces, must be positive.
+// @return Number of image sources.
+size_t GetNumImageSources(int reflection_order);
+
 // Computes a set of reflections from each surface of a shoe-box room model.
 // Uses a simplified calculation method which assumes that all the sources are
 // 'attached' to the listener. Also, assumes that the listener is inside the
@@ -39,6 +47,24 @@ void ComputeReflections(const WorldPosition& relative_listener_position,
                         const float* reflection_coefficients,
                         std::vector<Reflection>* reflections);
 
+// Computes the reflections of all the image sources of a shoe-box room model up
+// to the given |reflection_order|. The first |kNumRoomSurfaces| reflections are
+// the first order reflections in the order of the |reflection_coefficients|,
+// followed by the higher order image sources, grouped by order.
+//
+// @param relative_listener_position Relative listener position to the center of
+//     the room.
+// @param room_dimensions Dimensions of the room.
+// @param reflection_coefficients Reflection coefficients.
+// @param reflection_order Maximum number of wall bounces, must be positive.
+// @param reflections List of computed reflections by the image source method,
+//     must hold |GetNumImageSources(reflection_order)| elements.
+void ComputeReflections(const WorldPosition& relative_listener_position,
+                        const WorldPosition& room_dimensions,
+                        const float* reflection_coefficients,
+                        int reflection_order,
+                        std::vector<Reflection>* reflections);
+
 }  // namespace vraudio
 
 #endif  // RESONANCE_AUDIO_DSP_SHOE_BOX_ROOM_H_
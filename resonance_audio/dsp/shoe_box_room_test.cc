@@ -17,6 +17,7 @@ limitations under the License.
 #include "dsp/shoe_box_room.h"
 
 #include <algorithm>
+#include <cmath>
 #include <vector>
 
 #include "third_party/googletest/googletest/include/gtest/gtest.h"
@@ -91,6 +92,67 @@ TEST(ShoeBoxRoomTest, ReflectionsOutsideRoomTest) {
   }
 }
 
+// Tests that the number of image sources grows as expected with the order.
+TEST(ShoeBoxRoomTest, NumImageSourcesTest) {
+  EXPECT_EQ(kNumRoomSurfaces, GetNumImageSources(1));
+  EXPECT_EQ(24U, GetNumImageSources(2));
+  EXPECT_EQ(62U, GetNumImageSources(3));
+}
+
+// Tests that higher order reflections extend the first order reflections with
+// image sources of the expected magnitudes, delays and directions.
+TEST(ShoeBoxRoomTest, HigherOrderReflectionsTest) {
+  const WorldPosition kListenerPosition(0.5f, -1.0f, 1.5f);
+  const WorldPosition kRoomDimensions(4.0f, 5.0f, 6.0f);
+  const float kReflectionCoefficients[kNumRoomSurfaces] = {0.9f, 0.8f, 0.7f,
+                                                           0.6f, 0.5f, 0.4f};
+  const int kReflectionOrder = 2;
+
+  std::vector<Reflection> first_order_reflections(kNumRoomSurfaces);
+  ComputeReflections(kListenerPosition, kRoomDimensions,
+                     kReflectionCoefficients, &first_order_reflections);
+  std::vector<Reflection> reflections(GetNumImageSources(kReflectionOrder));
+  ComputeReflections(kListenerPosition, kRoomDimensions,
+                     kReflectionCoefficients, kReflectionOrder, &reflections);
+
+  // First order reflections must be identical.
+  for (size_t i = 0; i < kNumRoomSurfaces; ++i) {
+    EXPECT_EQ(first_order_reflections[i].delay_time_seconds,
+              reflections[i].delay_time_seconds);
+    EXPECT_EQ(first_order_reflections[i].magnitude, reflections[i].magnitude);
+  }
+  for (const auto& reflection : reflections) {
+    EXPECT_GT(reflection.magnitude, 0.0f);
+    EXPECT_NEAR(1.0f, reflection.direction.norm(), kEpsilonFloat);
+  }
+
+  // The first second order image source bounces off the left and then the
+  // right wall, i.e. it travels the width of the room.
+  const float kLeftRightDistance = kRoomDimensions[0] + 1.0f;
+  EXPECT_NEAR(kLeftRightDistance / kSpeedOfSound,
+              reflections[kNumRoomSurfaces].delay_time_seconds,
+              kEpsilonFloat);
+  EXPECT_NEAR(0.9f * 0.8f / kLeftRightDistance,
+              reflections[kNumRoomSurfaces].magnitude, kEpsilonFloat);
+  EXPECT_NEAR(-1.0f, reflections[kNumRoomSurfaces].direction[0],
+              kEpsilonFloat);
+
+  // The next image source bounces off the left wall and the floor.
+  const WorldPosition kLeftFloorHalfPath(-2.5f, -1.5f, 0.0f);
+  const float kLeftFloorDistance = kLeftFloorHalfPath.norm() + 1.0f;
+  EXPECT_NEAR(kLeftFloorDistance / kSpeedOfSound,
+              reflections[kNumRoomSurfaces + 1].delay_time_seconds,
+              kEpsilonFloat);
+  EXPECT_NEAR(0.9f * 0.7f / kLeftFloorDistance,
+              reflections[kNumRoomSurfaces + 1].magnitude, kEpsilonFloat);
+  const WorldPosition kLeftFloorDirection = kLeftFloorHalfPath.normalized();
+  for (int axis = 0; axis < 3; ++axis) {
+    EXPECT_NEAR(kLeftFloorDirection[axis],
+                reflections[kNumRoomSurfaces + 1].direction[axis],
+                kEpsilonFloat);
+  }
+}
+
 }  // namespace
 
 }  // namespace vraudio
@@ -22,6 +22,7 @@ limitations under the License.
 #include "dsp/spectral_reverb.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdlib>
 #include <numeric>
 
@@ -35,22 +36,11 @@ namespace vraudio {
 
 namespace {
 
-// FFT length and length of time domain data processed.
-const size_t kFftSize = 4096;
+// Number of samples per overlap. The feedback and magnitude compensation tables
+// describe the decay per hop, so the hop size is fixed across FFT sizes.
+const size_t kOverlapLength = 1024;
 
-// Length of magnitude and phase buffers.
-const size_t kMagnitudeLength = kFftSize / 2 + 1;
-
-// Number of overlaps per kFftSize time domain chunk of input.
-const size_t kNumOverlap = 4;
-
-// Number of samples per overlap.
-const size_t kOverlapLength = kFftSize / kNumOverlap;
-
-// Three quarters FFT size, used for copying chunks of input.
-const size_t kThreeQuarterFftSize = kFftSize - kOverlapLength;
-
-// Number of channels needed to overlap add output data.
+// Number of channels needed to combine the two stereo reverb blocks.
 const size_t kNumQuadChannels = 4;
 
 // Number of buffers of delay applies to the magnitude spectrum.
@@ -59,8 +49,17 @@ const size_t kMagnitudeDelay = 3;
 // Length of a buffer of noise used to provide random phase.
 const size_t kNoiseLength = 16384;
 
-// Length of the noise buffer from which a phase buffer can start.
-const size_t kAvailableNoiselength = kNoiseLength - kMagnitudeLength;
+// Energy per hop of the |kDefaultFftSize| window, which all windows are
+// normalized to. The window is made of two hops at the peak value of 3/4 and
+// two raised cosine edges of one hop, whose mean squared value is 3/8 of the
+// peak squared value, i.e. (3/4)^2 * (2 + 2 * 3/8).
+const float kWindowEnergyPerHop = 99.0f / 64.0f;
+
+// Fraction of the energy of the reverb blocks which remains after windowing.
+// The random phases lie between 0 and pi, such that a fraction of 4 / pi^2 of
+// the energy is common to all blocks. Its inverse FFT is concentrated at the
+// block edges, where it is removed by the window.
+const float kWindowedEnergyFraction = 1.0f - 4.0f / (kPi * kPi);
 
 // Returns a random integer in the range provided. Used to index into the random
 // buffer for phase values.
@@ -69,34 +68,74 @@ inline size_t GetRandomIntegerInRange(size_t min, size_t max) {
   return min + static_cast<size_t>(std::rand()) % (max - min);
 }
 
+// Generates a pseudo tukey window from overlapping hann windows which span two
+// hops each, placed one hop apart.
+//
+// @param fft_size Length of the window.
+// @param window Channel of at least |fft_size| frames to hold the window.
+// @return Sum of the squared window samples.
+float GeneratePseudoTukeyWindow(size_t fft_size,
+                                AudioBuffer::Channel* window) {
+  DCHECK_GE(window->size(), fft_size);
+  const size_t hann_length = 2 * kOverlapLength + 1;
+  AudioBuffer hann_window(kNumMonoChannels, hann_length);
+  GenerateHannWindow(true /* full */, hann_length, &hann_window[0]);
+  // Scale the hann windows such that three of them sum to a unity peak.
+  const float kThreeQuarters = 0.75f;
+  float* hann = hann_window[0].begin();
+  ScalarMultiply(hann_length, kThreeQuarters, hann, hann);
+  window->Clear();
+  for (size_t offset = 0; offset + kOverlapLength < fft_size;
+       offset += kOverlapLength) {
+    // The final sample of the full hann window is zero and would lie beyond
+    // the end of the window.
+    const size_t length = std::min(hann_length, fft_size - offset);
+    float* window_start = window->begin() + offset;
+    AddPointwise(length, hann, window_start, window_start);
+  }
+  return std::inner_product(window->begin(), window->begin() + fft_size,
+                            window->begin(), 0.0f);
+}
+
 }  // namespace
 
+const size_t SpectralReverb::kDefaultFftSize;
+const size_t SpectralReverb::kReducedFftSize;
+
 SpectralReverb::SpectralReverb(int sample_rate, size_t frames_per_buffer)
+    : SpectralReverb(sample_rate, frames_per_buffer, kDefaultFftSize) {}
+
+SpectralReverb::SpectralReverb(int sample_rate, size_t frames_per_buffer,
+                               size_t fft_size)
     : sample_rate_(sample_rate),
       frames_per_buffer_(frames_per_buffer),
+      fft_size_(fft_size),
+      num_overlap_(fft_size / kOverlapLength),
+      magnitude_length_(fft_size / 2 + 1),
       magnitude_delay_index_(0),
       overlap_add_index_(0),
-      fft_manager_(kFftSize / 2),
+      fft_manager_(fft_size_ / 2),
       sin_cos_random_phase_buffer_(kNumStereoChannels, kNoiseLength),
-      unscaled_window_(kNumMonoChannels, kFftSize),
-      window_(kNumMonoChannels, kFftSize),
-      feedback_(kNumMonoChannels, kMagnitudeLength),
-      magnitude_compensation_(kNumMonoChannels, kMagnitudeLength),
-      magnitude_delay_(kMagnitudeDelay, kMagnitudeLength),
-      fft_size_input_(kNumMonoChannels, kFftSize),
-      input_circular_buffer_(kFftSize + frames_per_buffer_, frames_per_buffer_,
-                             kOverlapLength),
+      unscaled_window_(kNumMonoChannels, fft_size_),
+      window_(kNumMonoChannels, fft_size_),
+      feedback_(kNumMonoChannels, magnitude_length_),
+      magnitude_compensation_(kNumMonoChannels, magnitude_length_),
+      magnitude_delay_(kMagnitudeDelay, magnitude_length_),
+      fft_size_input_(kNumMonoChannels, fft_size_),
+      input_circular_buffer_(fft_size_ + frames_per_buffer_,
+                             frames_per_buffer_, kOverlapLength),
       output_circular_buffers_(kNumStereoChannels),
-      out_time_buffer_(kNumQuadChannels, kFftSize),
-      temp_freq_buffer_(kNumStereoChannels, kFftSize),
-      scaled_magnitude_buffer_(kNumMonoChannels, kMagnitudeLength),
-      temp_magnitude_buffer_(kNumMonoChannels, kMagnitudeLength),
-      temp_phase_buffer_(kNumStereoChannels, kMagnitudeLength),
+      out_time_buffer_(kNumQuadChannels, fft_size_),
+      temp_freq_buffer_(kNumStereoChannels, fft_size_),
+      scaled_magnitude_buffer_(kNumMonoChannels, magnitude_length_),
+      temp_magnitude_buffer_(kNumMonoChannels, magnitude_length_),
+      temp_phase_buffer_(kNumStereoChannels, magnitude_length_),
       output_accumulator_(kNumStereoChannels),
       is_gain_near_zero_(false),
       is_feedback_near_zero_(false) {
   DCHECK_GT(sample_rate, 0);
   DCHECK_GT(frames_per_buffer_, 0U);
+  DCHECK(fft_size_ == kDefaultFftSize || fft_size_ == kReducedFftSize);
 
   // Seed std::rand, used for phase selection.
   std::srand(1);
@@ -107,6 +146,29 @@ SpectralReverb::SpectralReverb(int sample_rate, size_t frames_per_buffer)
   magnitude_compensation_.Clear();
 }
 
+float SpectralReverb::GetPowerGain(float rt60, int sample_rate) {
+  const int index =
+      GetFeedbackIndexFromRt60(rt60, static_cast<float>(sample_rate));
+  if (index == kInvalidIndex) {
+    return 0.0f;
+  }
+  const float feedback = kSpectralReverbFeedback[index];
+  const float compensation = kMagnitudeCompensation[index];
+  // For white noise input, the input magnitudes of a bin are Rayleigh
+  // distributed with a mean squared value of pi/4 times their mean power. The
+  // magnitude delay lines accumulate the mean coherently and the remaining
+  // variance incoherently.
+  const float quarter_pi = 0.25f * kPi;
+  const float magnitude_power =
+      compensation * compensation *
+      (quarter_pi / ((1.0f - feedback) * (1.0f - feedback)) +
+       (1.0f - quarter_pi) / (1.0f - feedback * feedback));
+  // Each hop adds two uncorrelated blocks of random phase to the overlap add
+  // output, whose inverse FFT scaling is part of the window.
+  return 2.0f * magnitude_power * kWindowEnergyPerHop *
+         kWindowedEnergyFraction;
+}
+
 void SpectralReverb::SetGain(float gain) {
   DCHECK_GE(gain, 0.0f);
   ScalarMultiply(window_.num_frames(), gain, &unscaled_window_[0][0],
@@ -133,7 +195,8 @@ void SpectralReverb::SetRt60PerOctaveBand(const float* rt60_values) {
   AudioBuffer::Channel* magnitude_compensation_channel =
       &magnitude_compensation_[0];
   magnitude_compensation_channel->Clear();
-  const float frequency_step = sample_rate_float / static_cast<float>(kFftSize);
+  const float frequency_step =
+      sample_rate_float / static_cast<float>(fft_size_);
   int index = GetFeedbackIndexFromRt60(rt60_values[0], sample_rate_float);
   float current_feedback =
       index == kInvalidIndex ? 0.0f : kSpectralReverbFeedback[index];
@@ -190,15 +253,16 @@ void SpectralReverb::Process(const AudioBuffer::Channel& input,
 
   // Here we insert |frames_per_buffer_| samples on each function call. Then,
   // once there are |kOverlapLength| samples in the input circular buffer we
-  // retrieve |kOverlapLength| samples from it and process |kFftSize| samples of
-  // input at a time, sliding along by |kOverlapLength| samples. We then place
-  // |kOverlapLength| samples into the output buffer and we will extract
+  // retrieve |kOverlapLength| samples from it and process |fft_size_| samples
+  // of input at a time, sliding along by |kOverlapLength| samples. We then
+  // place |kOverlapLength| samples into the output buffer and we will extract
   // |frames_per_buffer_| samples from the output buffer on each function call.
+  const size_t history_length = fft_size_ - kOverlapLength;
   input_circular_buffer_.InsertBuffer(input);
   while (input_circular_buffer_.GetOccupancy() >= kOverlapLength) {
-    std::copy_n(&fft_size_input_[0][kOverlapLength], kThreeQuarterFftSize,
+    std::copy_n(&fft_size_input_[0][kOverlapLength], history_length,
                 &fft_size_input_[0][0]);
-    input_circular_buffer_.RetrieveBufferWithOffset(kThreeQuarterFftSize,
+    input_circular_buffer_.RetrieveBufferWithOffset(history_length,
                                                     &fft_size_input_[0]);
     fft_manager_.FreqFromTimeDomain(fft_size_input_[0], &temp_freq_buffer_[0]);
     fft_manager_.GetCanonicalFormatFreqBuffer(temp_freq_buffer_[0],
@@ -207,7 +271,7 @@ void SpectralReverb::Process(const AudioBuffer::Channel& input,
                                                   &scaled_magnitude_buffer_[0]);
     // Apply the magnitude compensation to the input magnitude spectrum before
     // feedback is applied.
-    MultiplyPointwise(kMagnitudeLength, magnitude_compensation_[0].begin(),
+    MultiplyPointwise(magnitude_length_, magnitude_compensation_[0].begin(),
                       scaled_magnitude_buffer_[0].begin(),
                       scaled_magnitude_buffer_[0].begin());
     // Generate time domain reverb blocks.
@@ -218,21 +282,21 @@ void SpectralReverb::Process(const AudioBuffer::Channel& input,
                        &out_time_buffer_[3]);
 
     // Combine the reverb blocks for both left and right output.
-    AddPointwise(kFftSize, out_time_buffer_[0].begin(),
+    AddPointwise(fft_size_, out_time_buffer_[0].begin(),
                  out_time_buffer_[2].begin(), out_time_buffer_[0].begin());
-    AddPointwise(kFftSize, out_time_buffer_[1].begin(),
+    AddPointwise(fft_size_, out_time_buffer_[1].begin(),
                  out_time_buffer_[3].begin(), out_time_buffer_[1].begin());
 
     // Window the left and right output (While applying inverse FFT scaling).
-    MultiplyPointwise(kFftSize, out_time_buffer_[0].begin(), window_[0].begin(),
-                      out_time_buffer_[0].begin());
-    MultiplyPointwise(kFftSize, out_time_buffer_[1].begin(), window_[0].begin(),
-                      out_time_buffer_[1].begin());
+    MultiplyPointwise(fft_size_, out_time_buffer_[0].begin(),
+                      window_[0].begin(), out_time_buffer_[0].begin());
+    MultiplyPointwise(fft_size_, out_time_buffer_[1].begin(),
+                      window_[0].begin(), out_time_buffer_[1].begin());
 
     // Next perform the addition and the submission into the output buffer.
     AccumulateOverlap(0 /*channel*/, out_time_buffer_[0]);
     AccumulateOverlap(1 /*channel*/, out_time_buffer_[1]);
-    overlap_add_index_ = (overlap_add_index_ + 1) % kNumOverlap;
+    overlap_add_index_ = (overlap_add_index_ + 1) % num_overlap_;
   }
   output_circular_buffers_[0]->RetrieveBuffer(left_out);
   output_circular_buffers_[1]->RetrieveBuffer(right_out);
@@ -242,8 +306,8 @@ void SpectralReverb::AccumulateOverlap(size_t channel_index,
                                        const AudioBuffer::Channel& buffer) {
   // Use a modulo indexed multi channel audio buffer with each channel of length
   // |kOverlapLength| to perform an overlap add.
-  for (size_t i = 0, index = overlap_add_index_; i < kNumOverlap;
-       ++i, index = (index + 1) % kNumOverlap) {
+  for (size_t i = 0, index = overlap_add_index_; i < num_overlap_;
+       ++i, index = (index + 1) % num_overlap_) {
     float* accumulator_start_point =
         output_accumulator_[channel_index][index].begin();
     AddPointwise(kOverlapLength, buffer.begin() + i * kOverlapLength,
@@ -255,20 +319,20 @@ void SpectralReverb::AccumulateOverlap(size_t channel_index,
 }
 
 void SpectralReverb::GenerateAnalysisWindow() {
-  // Genarate a pseudo tukey window from three overlapping hann windows, scaled
-  // by the inverse fft scale.
+  // Genarate a pseudo tukey window from overlapping hann windows, scaled by the
+  // inverse fft scale.
   AudioBuffer::Channel* window_channel = &window_[0];
-  // Use the unscaled window buffer as temporary storage.
-  GenerateHannWindow(true /* full */, kMagnitudeLength, &unscaled_window_[0]);
-  float* hann_window = &unscaled_window_[0][0];
-  // Scale the hann window such that the sum of three will have unity peak.
-  const float kThreeQuarters = 0.75f;
-  ScalarMultiply(kMagnitudeLength, kThreeQuarters, hann_window, hann_window);
-  for (size_t offset = 0; offset < kThreeQuarterFftSize;
-       offset += kOverlapLength) {
-    float* tripple_hann_window = &(*window_channel)[offset];
-    AddPointwise(kMagnitudeLength, hann_window, tripple_hann_window,
-                 tripple_hann_window);
+  const float window_energy =
+      GeneratePseudoTukeyWindow(fft_size_, window_channel);
+  if (fft_size_ != kDefaultFftSize) {
+    // The output is an overlap add of uncorrelated blocks, so its power is
+    // proportional to the window energy per hop. Match the energy of the
+    // default window so all FFT sizes share the same magnitude compensation.
+    AudioBuffer default_window(kNumMonoChannels, kDefaultFftSize);
+    const float default_window_energy =
+        GeneratePseudoTukeyWindow(kDefaultFftSize, &default_window[0]);
+    ScalarMultiply(fft_size_, std::sqrt(default_window_energy / window_energy),
+                   window_channel->begin(), window_channel->begin());
   }
   fft_manager_.ApplyReverseFftScaling(window_channel);
   unscaled_window_[0] = *window_channel;
@@ -299,7 +363,7 @@ void SpectralReverb::GetNextReverbBlock(size_t delay_index,
   AudioBuffer::Channel* temp_magnitude_channel = &temp_magnitude_buffer_[0];
   *temp_magnitude_channel = scaled_magnitude_buffer_[0];
   MultiplyAndAccumulatePointwise(
-      kMagnitudeLength, magnitude_delay_[delay_index].begin(),
+      magnitude_length_, magnitude_delay_[delay_index].begin(),
       feedback_[0].begin(), temp_magnitude_channel->begin());
   // Reinsert this new reverb magnitude into the delay buffer.
   magnitude_delay_[delay_index] = *temp_magnitude_channel;
@@ -307,7 +371,7 @@ void SpectralReverb::GetNextReverbBlock(size_t delay_index,
   for (size_t i = 0; i < kNumStereoChannels; ++i) {
     // Extract a random phase buffer.
     const size_t random_offset =
-        GetRandomIntegerInRange(0, kAvailableNoiselength);
+        GetRandomIntegerInRange(0, kNoiseLength - magnitude_length_);
     // We gaurantee an aligned offset as when SSE is used we need it.
     const size_t phase_offset = FindNextAlignedArrayIndex(
         random_offset, sizeof(float), kMemoryAlignmentBytes);
@@ -342,7 +406,7 @@ void SpectralReverb::InitializeCircularBuffersAndAccumulators() {
     for (size_t i = 0; i < zeroed_buffers_of_output; ++i) {
       output_circular_buffers_[channel]->InsertBuffer(zeros[0]);
     }
-    output_accumulator_[channel] = AudioBuffer(kNumOverlap, kOverlapLength);
+    output_accumulator_[channel] = AudioBuffer(num_overlap_, kOverlapLength);
     output_accumulator_[channel].Clear();
   }
 }
@@ -32,13 +32,40 @@ namespace vraudio {
 //     https://goo.gl/hv1pdJ.
 class SpectralReverb {
  public:
-  // Constructs a spectral reverb.
+  // FFT size of the full quality reverb, processed with four overlaps.
+  static const size_t kDefaultFftSize = 4096;
+
+  // FFT size of the reduced complexity reverb, processed with two overlaps.
+  // This roughly halves the processing cost at the expense of a coarser
+  // frequency resolution of the decay.
+  static const size_t kReducedFftSize = 2048;
+
+  // Constructs a spectral reverb using |kDefaultFftSize|.
   //
   // @param sample_rate The system sample rate.
   // @param frames_per_buffer System frames per buffer of input and output.
   //     Note that this class expects power of two buffers of input and output.
   SpectralReverb(int sample_rate, size_t frames_per_buffer);
 
+  // Constructs a spectral reverb.
+  //
+  // @param sample_rate The system sample rate.
+  // @param frames_per_buffer System frames per buffer of input and output.
+  //     Note that this class expects power of two buffers of input and output.
+  // @param fft_size FFT size, either |kDefaultFftSize| or |kReducedFftSize|.
+  //     The hop size is the same for both, so the number of overlaps scales
+  //     with the FFT size.
+  SpectralReverb(int sample_rate, size_t frames_per_buffer, size_t fft_size);
+
+  // Returns the steady state power gain of the reverb at unity gain for white
+  // noise input, i.e. the ratio of the output power in one channel to the input
+  // power, within the frequency range of an octave band.
+  //
+  // @param rt60 Reverberation time of the octave band in seconds.
+  // @param sample_rate The system sample rate.
+  // @return Power gain, zero if |rt60| is below the supported range.
+  static float GetPowerGain(float rt60, int sample_rate);
+
   // Sets the overall gain to be applied to the output of the reverb.
   //
   // @param gain Gain to be applied to the reverb output, min value 0.0f.
@@ -63,17 +90,18 @@ class SpectralReverb {
                AudioBuffer::Channel* left_out, AudioBuffer::Channel* right_out);
 
  private:
-  // Uses an AudioBuffer with four channels to overlap add and insert the final
-  // reverb into the output circular buffers.
+  // Uses an AudioBuffer with one channel per overlap to overlap add and insert
+  // the final reverb into the output circular buffers.
   //
   // @param channel_index Denotes the (left or right) channel to output to.
   // @param buffer The buffer to be added onto the pre-existing reverb output.
   void AccumulateOverlap(size_t channel_index,
                          const AudioBuffer::Channel& buffer);
 
-  // Generates a window function which is a normalized sum of three overlapping
-  // (50%) hann windows of length (|kFftSize| / 2) that also incorporates the
-  // inverse fft scaling.
+  // Generates a window function which is a sum of (|num_overlap_| - 1)
+  // overlapping (50%) hann windows spanning two hops each, that also
+  // incorporates the inverse fft scaling. The window is normalized such that
+  // the output level matches that of the |kDefaultFftSize| window.
   void GenerateAnalysisWindow();
 
   // Generates a large buffer of sines and cosines of random noise between 0 and
@@ -104,6 +132,15 @@ class SpectralReverb {
   // System frames per buffer.
   const size_t frames_per_buffer_;
 
+  // FFT length and length of time domain data processed.
+  const size_t fft_size_;
+
+  // Number of overlaps per |fft_size_| chunk of input.
+  const size_t num_overlap_;
+
+  // Length of magnitude and phase buffers.
+  const size_t magnitude_length_;
+
   // Indices into the magnitude and overlap add delay lines, modulo of their
   // respective lengths.
   size_t magnitude_delay_index_;
@@ -117,12 +154,11 @@ class SpectralReverb {
   // used for phase.
   AudioBuffer sin_cos_random_phase_buffer_;
 
-  // Buffer containing a triple overlapping hann window for windowing time
-  // domain data.
+  // Buffer containing overlapping hann windows for windowing time domain data.
   AudioBuffer unscaled_window_;
 
-  // Buffer containing a triple overlapping hann window for windowing time
-  // domain data, this window has been scaled by the output gain factor.
+  // Buffer containing overlapping hann windows for windowing time domain data,
+  // this window has been scaled by the output gain factor.
   AudioBuffer window_;
 
   // Buffer containing RT60 tuned feedback values.
@@ -135,11 +171,11 @@ class SpectralReverb {
   // Buffer that acts as the frequency domain magnitde delay.
   AudioBuffer magnitude_delay_;
 
-  // Buffer to contain a linear |kFftSize| chunk of input data.
+  // Buffer to contain a linear |fft_size_| chunk of input data.
   AudioBuffer fft_size_input_;
 
   // Circular buffers to sit at the input and output of the |Process()| method
-  // to allow |frames_per_buffer_| to differ from |kFftSize|.
+  // to allow |frames_per_buffer_| to differ from |fft_size_|.
   CircularBuffer input_circular_buffer_;
   std::vector<std::unique_ptr<CircularBuffer>> output_circular_buffers_;
 
@@ -0,0 +1,61 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "dsp/spectral_reverb.h"
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "base/audio_buffer.h"
+#include "base/constants_and_types.h"
+#include "utils/benchmark_util.h"
+
+namespace vraudio {
+
+namespace {
+
+const int kSampleRate = 48000;
+
+void RunSpectralReverb(size_t fft_size, benchmark::State* state) {
+  const size_t frames_per_buffer = static_cast<size_t>(state->range(0));
+  SpectralReverb reverb(kSampleRate, frames_per_buffer, fft_size);
+  const std::vector<float> rt60s(kNumReverbOctaveBands, 2.0f);
+  reverb.SetRt60PerOctaveBand(rt60s.data());
+  reverb.SetGain(1.0f);
+
+  AudioBuffer input(kNumMonoChannels, frames_per_buffer);
+  FillWithNoise(&input);
+  AudioBuffer output(kNumStereoChannels, frames_per_buffer);
+  for (auto _ : *state) {
+    reverb.Process(input[0], &output[0], &output[1]);
+    benchmark::ClobberMemory();
+  }
+  SetFramesProcessed(frames_per_buffer, state);
+}
+
+void BM_SpectralReverb(benchmark::State& state) {
+  RunSpectralReverb(SpectralReverb::kDefaultFftSize, &state);
+}
+BENCHMARK(BM_SpectralReverb)->Apply(FramesPerBufferArguments);
+
+void BM_SpectralReverbReducedFftSize(benchmark::State& state) {
+  RunSpectralReverb(SpectralReverb::kReducedFftSize, &state);
+}
+BENCHMARK(BM_SpectralReverbReducedFftSize)->Apply(FramesPerBufferArguments);
+
+}  // namespace
+
+}  // namespace vraudio
@@ -26,6 +26,7 @@ limitations under the License.
 #include "dsp/biquad_filter.h"
 #include "dsp/fft_manager.h"
 #include "dsp/filter_coefficient_generators.h"
+#include "dsp/utils.h"
 #include "utils/test_util.h"
 
 namespace vraudio {
@@ -243,6 +244,66 @@ TEST(SpectralReverbTest, DecorrelatedTailsTest) {
   DecorrelatedTailsTestHelper(kSampleFrequency16, kFramesPerBuffer713);
 }
 
+// Tests that the reduced FFT size reverb matches the steady state level and the
+// decay rate of the default reverb.
+TEST(SpectralReverbTest, ReducedFftSizeTest) {
+  const float kReverbLength = 1.0f;
+  const size_t kNumNoiseBuffers = 64;
+  const size_t kSegmentLength = 4096;
+  const size_t kFirstSegment = 2;
+  const size_t kLastSegment = 6;
+  // Maximum level differences in decibels.
+  const float kMaxLevelDifferenceDb = 1.0f;
+  const float kMaxDecayDifferenceDb = 1.5f;
+  const std::vector<float> kUniformRt60s(kNumReverbOctaveBands, kReverbLength);
+  const size_t kFftSizes[] = {SpectralReverb::kDefaultFftSize,
+                              SpectralReverb::kReducedFftSize};
+  std::vector<float> steady_state_levels_db;
+  std::vector<float> decays_db;
+  for (size_t fft_size : kFftSizes) {
+    SpectralReverb reverb(kSampleFrequency24, kFramesPerBuffer512, fft_size);
+    reverb.SetRt60PerOctaveBand(kUniformRt60s.data());
+
+    // Compare the level of the last half of the noise excited response.
+    AudioBuffer input(kNumMonoChannels, kFramesPerBuffer512);
+    AudioBuffer output(kNumStereoChannels, kFramesPerBuffer512);
+    float energy = 0.0f;
+    for (size_t i = 0; i < kNumNoiseBuffers; ++i) {
+      GenerateUniformNoise(-1.0f, 1.0f, static_cast<unsigned>(i), &input[0]);
+      reverb.Process(input[0], &output[0], &output[1]);
+      if (i >= kNumNoiseBuffers / 2) {
+        energy += std::inner_product(output[0].begin(), output[0].end(),
+                                     output[0].begin(), 0.0f);
+      }
+    }
+    steady_state_levels_db.push_back(10.0f * std::log10(energy));
+
+    // Compare the level drop between two segments of the impulse response
+    // tail, skipping the onset.
+    SpectralReverb impulse_reverb(kSampleFrequency24, kFramesPerBuffer512,
+                                  fft_size);
+    impulse_reverb.SetRt60PerOctaveBand(kUniformRt60s.data());
+    std::vector<float> output_left;
+    std::vector<float> output_right;
+    ImpulseResponse(kReverbLength, kSampleFrequency24, kFramesPerBuffer512,
+                    &impulse_reverb, &output_left, &output_right);
+    ASSERT_GE(output_left.size(), (kLastSegment + 1) * kSegmentLength);
+    const auto first_segment =
+        output_left.begin() + kFirstSegment * kSegmentLength;
+    const auto last_segment =
+        output_left.begin() + kLastSegment * kSegmentLength;
+    const float first_energy =
+        std::inner_product(first_segment, first_segment + kSegmentLength,
+                           first_segment, 0.0f);
+    const float last_energy = std::inner_product(
+        last_segment, last_segment + kSegmentLength, last_segment, 0.0f);
+    decays_db.push_back(10.0f * std::log10(first_energy / last_energy));
+  }
+  EXPECT_NEAR(steady_state_levels_db[0], steady_state_levels_db[1],
+              kMaxLevelDifferenceDb);
+  EXPECT_NEAR(decays_db[0], decays_db[1], kMaxDecayDifferenceDb);
+}
+
 // Tests that the gain parameter behaves as expected.
 TEST(SpecralReverbTest, GainTest) {
   const float kReverbLength = 0.5f;
@@ -26,7 +26,7 @@ limitations under the License.
 #include "base/logging.h"
 #include "base/misc_math.h"
 
-#include "dsp/biquad_filter.h"
+#include "dsp/biquad_bank.h"
 #include "dsp/filter_coefficient_generators.h"
 
 namespace {
@@ -107,13 +107,13 @@ void GenerateBandLimitedGaussianNoise(float center_frequency, int sampling_rate,
 
   BiquadCoefficients bandpass_coefficients = ComputeBandPassBiquadCoefficients(
       sampling_rate, center_frequency, /*bandwidth=*/1);
-  BiquadFilter bandpass_filter(bandpass_coefficients, num_frames);
+  BiquadBank bandpass_filters(noise_buffer->num_channels(),
+                              bandpass_coefficients, num_frames);
 
   for (auto& channel : *noise_buffer) {
     GenerateGaussianNoise(kMean, kStandardDeviation, seed, &channel);
-    bandpass_filter.Filter(channel, &channel);
-    bandpass_filter.Clear();
   }
+  bandpass_filters.Filter(*noise_buffer, noise_buffer);
 }
 
 std::unique_ptr<AudioBuffer> GenerateDecorrelationFilters(int sampling_rate) {
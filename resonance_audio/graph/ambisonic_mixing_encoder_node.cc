@@ -16,13 +16,90 @@ limitations under the License.
 
 #include "graph/ambisonic_mixing_encoder_node.h"
 
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+
 #include "ambisonics/utils.h"
 #include "base/constants_and_types.h"
 #include "base/logging.h"
-
+#include "base/simd_macros.h"
+#include "dsp/distance_attenuation.h"
+#include "dsp/gain.h"
 
 namespace vraudio {
 
+namespace {
+
+// Maximum angle between a source and a cluster centroid for the source to
+// join the cluster.
+const float kClusterJoinAngleDeg = 20.0f;
+
+// Angle between a source and its cluster centroid above which the source
+// leaves the cluster. Larger than |kClusterJoinAngleDeg| to avoid sources
+// switching back and forth between clusters.
+const float kClusterLeaveAngleDeg = 30.0f;
+
+// Minimum number of frames between the interpolated directions at which the
+// encoding coefficients of a moving source are evaluated. Must be a multiple
+// of |SIMD_LENGTH|.
+const size_t kMinEncodingSegmentFrames = 32;
+
+// Maximum change of the direction of a moving source between two evaluations
+// of its encoding coefficients.
+const float kMaxEncodingSegmentAngleDeg = 2.0f;
+
+// Maximum changes of the direction and of the position of a source relative to
+// the listener per buffer, above which the source is considered to jump, e.g.
+// when it is teleported. Jumps are not interpolated within the buffer, as the
+// image would sweep through all the directions in between.
+const float kMaxInterpolatedDirectionChangeDeg = 120.0f;
+const float kMaxInterpolatedPositionChange = 5.0f;
+
+// Returns the angle in degrees by which the direction of a source relative to
+// the listener changes between the previous and the current buffer.
+float GetDirectionChangeDeg(const SourceGeometry& geometry) {
+  if (geometry.previous_listener_to_source == geometry.listener_to_source &&
+      geometry.previous_listener_rotation.coeffs() ==
+          geometry.listener_rotation.coeffs()) {
+    return 0.0f;
+  }
+  const WorldPosition previous_direction =
+      (geometry.previous_listener_rotation.conjugate() *
+       geometry.previous_listener_to_source)
+          .normalized();
+  const WorldPosition direction =
+      (geometry.listener_rotation.conjugate() * geometry.listener_to_source)
+          .normalized();
+  const float cos_angle =
+      std::min(1.0f, std::max(-1.0f, previous_direction.dot(direction)));
+  return std::acos(cos_angle) * kDegreesFromRadians;
+}
+
+// Returns whether the source jumps between the previous and the current buffer
+// rather than moving continuously.
+bool IsJump(const SourceGeometry& geometry, float direction_change_deg) {
+  return direction_change_deg > kMaxInterpolatedDirectionChangeDeg ||
+         (geometry.listener_to_source - geometry.previous_listener_to_source)
+                 .norm() > kMaxInterpolatedPositionChange;
+}
+
+// Returns the maximum number of segments of a buffer.
+size_t GetMaxNumEncodingSegments(size_t frames_per_buffer) {
+  return (frames_per_buffer + kMinEncodingSegmentFrames - 1) /
+         kMinEncodingSegmentFrames;
+}
+
+// Returns the id under which the given cluster is encoded. These ids are
+// below |kInvalidSourceId| and thus never collide with source ids.
+SourceId GetClusterSourceId(int cluster) {
+  return kInvalidSourceId - 1 - cluster;
+}
+
+}  // namespace
+
+const int AmbisonicMixingEncoderNode::kNoCluster;
+
 AmbisonicMixingEncoderNode::AmbisonicMixingEncoderNode(
     const SystemSettings& system_settings,
     const AmbisonicLookupTable& lookup_table, int ambisonic_order)
@@ -31,15 +108,42 @@ AmbisonicMixingEncoderNode::AmbisonicMixingEncoderNode(
       ambisonic_order_(ambisonic_order),
       gain_mixer_(GetNumPeriphonicComponents(ambisonic_order_),
                   system_settings_.GetFramesPerBuffer()),
-      coefficients_(GetNumPeriphonicComponents(ambisonic_order_)) {}
-
-const AudioBuffer* AmbisonicMixingEncoderNode::AudioProcess(
-    const NodeInput& input) {
+      coefficients_(GetNumPeriphonicComponents(ambisonic_order_)),
+      segment_directions_(
+          GetMaxNumEncodingSegments(system_settings_.GetFramesPerBuffer())),
+      segment_spreads_deg_(segment_directions_.size()),
+      segment_coefficients_(segment_directions_.size() *
+                            GetNumPeriphonicComponents(ambisonic_order_)),
+      direct_buffer_(kNumMonoChannels, system_settings_.GetFramesPerBuffer()),
+      cluster_buffer_(kMaxNumSourceClusters,
+                      system_settings_.GetFramesPerBuffer()),
+      clusters_(kMaxNumSourceClusters) {
+  for (int i = 0; i < static_cast<int>(kMaxNumSourceClusters); ++i) {
+    gain_mixer_.AddSource(GetClusterSourceId(i));
+  }
+}
 
+void AmbisonicMixingEncoderNode::AddClusteredSource(SourceId source_id) {
+  // Look the source up first, as |emplace| allocates even for existing keys.
+  if (clustering_states_.find(source_id) == clustering_states_.end()) {
+    clustering_states_.emplace(source_id, ClusteringState());
+  }
+  // Keep the processors of the individual encoding while the source is
+  // clustered.
+  gain_mixer_.AddSource(source_id);
+}
 
-  const WorldPosition& listener_position = system_settings_.GetHeadPosition();
-  const WorldRotation& listener_rotation = system_settings_.GetHeadRotation();
+void AmbisonicMixingEncoderNode::RemoveClusteredSource(SourceId source_id) {
+  auto state_it = clustering_states_.find(source_id);
+  if (state_it != clustering_states_.end()) {
+    ResetClusteringState(&state_it->second);
+    clustering_states_.erase(state_it);
+    gain_mixer_.RemoveSource(source_id);
+  }
+}
 
+const AudioBuffer* AmbisonicMixingEncoderNode::AudioProcess(
+    const NodeInput& input) {
   gain_mixer_.Reset();
   for (auto& input_buffer : input.GetInputBuffers()) {
     const int source_id = input_buffer->source_id();
@@ -48,22 +152,302 @@ const AudioBuffer* AmbisonicMixingEncoderNode::AudioProcess(
     DCHECK_NE(source_id, kInvalidSourceId);
     DCHECK_EQ(input_buffer->num_channels(), 1U);
 
-    // Compute the relative source direction in spherical angles.
-    const ObjectTransform& source_transform =
-        source_parameters->object_transform;
-    WorldPosition relative_direction;
-    GetRelativeDirection(listener_position, listener_rotation,
-                         source_transform.position, &relative_direction);
-    const SphericalAngle source_direction =
-        SphericalAngle::FromWorldPosition(relative_direction);
+    // Sources which have clustering disabled are encoded individually, unless
+    // they still need to fade out of a cluster.
+    const auto state_it = clustering_states_.find(source_id);
+    if (state_it != clustering_states_.end() &&
+        (source_parameters->enable_clustering ||
+         state_it->second.cluster != kNoCluster ||
+         state_it->second.fading_cluster != kNoCluster)) {
+      ProcessClusteredSource(source_id, *source_parameters, (*input_buffer)[0],
+                             &state_it->second);
+      continue;
+    }
 
-    lookup_table_.GetEncodingCoeffs(ambisonic_order_, source_direction,
-                                    source_parameters->spread_deg,
-                                    &coefficients_);
-
-    gain_mixer_.AddInputChannel((*input_buffer)[0], source_id, coefficients_);
+    EncodeSource(source_id, *source_parameters, (*input_buffer)[0]);
+  }
+  if (!clustering_states_.empty()) {
+    EncodeClusters();
+    UpdateClusteringStates();
   }
   return gain_mixer_.GetOutput();
 }
 
+void AmbisonicMixingEncoderNode::EncodeSource(
+    SourceId source_id, const SourceParameters& parameters,
+    const AudioBuffer::Channel& input) {
+  const SourceGeometry& geometry = parameters.geometry;
+  const size_t num_frames = input.size();
+  // Split the buffer into segments short enough for the direction to change
+  // by at most |kMaxEncodingSegmentAngleDeg| per segment. Jumping sources are
+  // encoded once per buffer, such that the |GainMixer| crossfades between the
+  // encodings in the previous and the current direction.
+  const float direction_change_deg = GetDirectionChangeDeg(geometry);
+  size_t num_segments =
+      IsJump(geometry, direction_change_deg)
+          ? 1
+          : std::min(GetMaxNumEncodingSegments(num_frames),
+                     static_cast<size_t>(std::ceil(
+                         direction_change_deg / kMaxEncodingSegmentAngleDeg)));
+  if (num_segments <= 1) {
+    lookup_table_.GetEncodingCoeffs(ambisonic_order_,
+                                    geometry.direction_from_listener,
+                                    parameters.spread_deg, &coefficients_);
+    gain_mixer_.AddInputChannel(input, source_id, coefficients_);
+    return;
+  }
+
+  // Round the segments up to whole SIMD vectors.
+  const size_t segment_length =
+      ((num_frames + num_segments - 1) / num_segments + SIMD_LENGTH - 1) /
+      SIMD_LENGTH * SIMD_LENGTH;
+  num_segments = (num_frames + segment_length - 1) / segment_length;
+  DCHECK_LE(num_segments, segment_directions_.size());
+  for (size_t segment = 0; segment < num_segments; ++segment) {
+    const float interpolation_factor =
+        std::min(1.0f, static_cast<float>((segment + 1) * segment_length) /
+                           static_cast<float>(num_frames));
+    segment_directions_[segment] =
+        InterpolateDirectionFromListener(geometry, interpolation_factor);
+    segment_spreads_deg_[segment] = parameters.spread_deg;
+  }
+  lookup_table_.GetEncodingCoeffs(
+      ambisonic_order_, num_segments, segment_directions_.data(),
+      segment_spreads_deg_.data(), segment_coefficients_.data());
+  gain_mixer_.AddInputChannelInSegments(input, source_id, segment_length,
+                                        segment_coefficients_.data());
+}
+
+AmbisonicMixingEncoderNode::SourceCluster::SourceCluster()
+    : direction(0.0f, 0.0f, 0.0f),
+      direction_sum(0.0f, 0.0f, 0.0f),
+      spread_deg_sum(0.0f),
+      num_processed_sources(0),
+      num_sources(0),
+      num_fading_sources(0),
+      has_input(false) {}
+
+AmbisonicMixingEncoderNode::ClusteringState::ClusteringState()
+    : cluster(kNoCluster),
+      fading_cluster(kNoCluster),
+      applies_attenuation(false),
+      attenuation(1.0f),
+      is_active(false),
+      has_history(false) {}
+
+void AmbisonicMixingEncoderNode::ProcessClusteredSource(
+    SourceId source_id, const SourceParameters& parameters,
+    const AudioBuffer::Channel& input, ClusteringState* state) {
+  const WorldPosition direction =
+      parameters.geometry.direction_from_listener
+          .GetWorldPositionOnUnitSphere();
+
+  // Reassign the source only once any previous crossfade has completed.
+  const bool is_crossfading =
+      state->fading_cluster != kNoCluster ||
+      (state->cluster != kNoCluster &&
+       !IsGainNearZero(state->direct_processor.GetGain()));
+  if (!is_crossfading) {
+    if (!parameters.is_clustered) {
+      AssignCluster(kNoCluster, state);
+    } else if (state->cluster == kNoCluster ||
+               direction.dot(clusters_[state->cluster].direction) <
+                   std::cos(kClusterLeaveAngleDeg * kRadiansFromDegrees)) {
+      AssignCluster(FindCluster(direction), state);
+    }
+  }
+
+  // The input of clustered sources is not attenuated upstream.
+  UpdateAttenuationScope(parameters.is_clustered, state);
+  const float direct_attenuation =
+      parameters.attenuations[AttenuationType::kDirect];
+  const float attenuation =
+      parameters.is_clustered ? direct_attenuation : 1.0f;
+  state->attenuation = direct_attenuation;
+
+  // Individually encoded part of the source.
+  const float direct_gain = state->cluster == kNoCluster ? attenuation : 0.0f;
+  if (!state->direct_processor.IsInitialized()) {
+    // Sources start either clustered or individually encoded without a fade
+    // in, and fade in once they leave their first cluster.
+    state->direct_processor.Reset(direct_gain);
+  }
+  if (direct_gain > 0.0f ||
+      !IsGainNearZero(state->direct_processor.GetGain())) {
+    if (state->has_history && !parameters.is_clustered &&
+        IsGainNearUnity(state->direct_processor.GetGain()) &&
+        direct_gain > 0.0f) {
+      EncodeSource(source_id, parameters, input);
+    } else {
+      state->direct_processor.ApplyGain(direct_gain, input,
+                                        &direct_buffer_[0],
+                                        false /* accumulate_output */);
+      EncodeSource(source_id, parameters, direct_buffer_[0]);
+    }
+  }
+
+  // Clustered part of the source.
+  if (state->cluster != kNoCluster) {
+    SourceCluster* cluster = &clusters_[state->cluster];
+    cluster->direction_sum += direction;
+    cluster->spread_deg_sum += parameters.spread_deg;
+    ++cluster->num_processed_sources;
+    AddToCluster(state->cluster, attenuation, input,
+                 &state->cluster_processor);
+  }
+  if (state->fading_cluster != kNoCluster) {
+    AddToCluster(state->fading_cluster, 0.0f, input,
+                 &state->fading_processor);
+    if (IsGainNearZero(state->fading_processor.GetGain())) {
+      --clusters_[state->fading_cluster].num_fading_sources;
+      state->fading_cluster = kNoCluster;
+    }
+  }
+  state->is_active = true;
+  state->has_history = true;
+}
+
+int AmbisonicMixingEncoderNode::FindCluster(const WorldPosition& direction) {
+  int closest_cluster = kNoCluster;
+  float closest_dot = -2.0f;
+  int free_cluster = kNoCluster;
+  for (int i = 0; i < static_cast<int>(kMaxNumSourceClusters); ++i) {
+    const SourceCluster& cluster = clusters_[i];
+    if (cluster.num_sources == 0 && cluster.num_fading_sources == 0) {
+      if (free_cluster == kNoCluster) {
+        free_cluster = i;
+      }
+      continue;
+    }
+    const float dot = direction.dot(cluster.direction);
+    if (dot > closest_dot) {
+      closest_dot = dot;
+      closest_cluster = i;
+    }
+  }
+  if (closest_cluster != kNoCluster &&
+      closest_dot >= std::cos(kClusterJoinAngleDeg * kRadiansFromDegrees)) {
+    return closest_cluster;
+  }
+  if (free_cluster != kNoCluster) {
+    clusters_[free_cluster].direction = direction;
+    return free_cluster;
+  }
+  // All clusters are in use, so join the closest one.
+  return closest_cluster;
+}
+
+void AmbisonicMixingEncoderNode::AddToCluster(int cluster, float target_gain,
+                                              const AudioBuffer::Channel& input,
+                                              GainProcessor* processor) {
+  DCHECK(processor);
+  const bool accumulate_output = clusters_[cluster].has_input;
+  processor->ApplyGain(target_gain, input, &cluster_buffer_[cluster],
+                       accumulate_output);
+  clusters_[cluster].has_input = true;
+}
+
+void AmbisonicMixingEncoderNode::UpdateAttenuationScope(
+    bool applies_attenuation, ClusteringState* state) {
+  DCHECK(state);
+  if (applies_attenuation == state->applies_attenuation) {
+    return;
+  }
+  state->applies_attenuation = applies_attenuation;
+  if (!state->has_history) {
+    return;
+  }
+  float scale = state->attenuation;
+  if (!applies_attenuation) {
+    // The gains restart from zero if the previous attenuation was inaudible.
+    scale = IsGainNearZero(scale) ? 0.0f : 1.0f / scale;
+  }
+  for (GainProcessor* processor :
+       {&state->direct_processor, &state->cluster_processor,
+        &state->fading_processor}) {
+    if (processor->IsInitialized()) {
+      processor->Reset(scale * processor->GetGain());
+    }
+  }
+}
+
+void AmbisonicMixingEncoderNode::AssignCluster(int cluster,
+                                               ClusteringState* state) {
+  DCHECK(state);
+  if (cluster == state->cluster) {
+    return;
+  }
+  if (state->cluster != kNoCluster) {
+    --clusters_[state->cluster].num_sources;
+    if (state->has_history) {
+      // Fade out of the previous cluster.
+      state->fading_cluster = state->cluster;
+      state->fading_processor = state->cluster_processor;
+      ++clusters_[state->fading_cluster].num_fading_sources;
+    }
+  }
+  state->cluster = cluster;
+  if (cluster != kNoCluster) {
+    ++clusters_[cluster].num_sources;
+    // New sources start without a fade in, as in the |GainMixer|.
+    state->cluster_processor =
+        state->has_history ? GainProcessor(0.0f) : GainProcessor();
+  }
+}
+
+void AmbisonicMixingEncoderNode::ResetClusteringState(
+    ClusteringState* state) {
+  DCHECK(state);
+  if (state->cluster != kNoCluster) {
+    --clusters_[state->cluster].num_sources;
+  }
+  if (state->fading_cluster != kNoCluster) {
+    --clusters_[state->fading_cluster].num_fading_sources;
+  }
+  *state = ClusteringState();
+}
+
+void AmbisonicMixingEncoderNode::EncodeClusters() {
+  for (int i = 0; i < static_cast<int>(kMaxNumSourceClusters); ++i) {
+    SourceCluster* cluster = &clusters_[i];
+    if (cluster->num_processed_sources > 0) {
+      // Move the cluster to the centroid of its current members.
+      const float norm = cluster->direction_sum.norm();
+      if (norm > kEpsilonFloat) {
+        cluster->direction = cluster->direction_sum / norm;
+      }
+    }
+    if (cluster->has_input) {
+      const float spread_deg =
+          cluster->num_processed_sources > 0
+              ? cluster->spread_deg_sum /
+                    static_cast<float>(cluster->num_processed_sources)
+              : 0.0f;
+      lookup_table_.GetEncodingCoeffs(
+          ambisonic_order_,
+          SphericalAngle::FromWorldPosition(cluster->direction), spread_deg,
+          &coefficients_);
+      gain_mixer_.AddInputChannel(cluster_buffer_[i], GetClusterSourceId(i),
+                                  coefficients_);
+    }
+    cluster->direction_sum = WorldPosition(0.0f, 0.0f, 0.0f);
+    cluster->spread_deg_sum = 0.0f;
+    cluster->num_processed_sources = 0;
+    cluster->has_input = false;
+  }
+}
+
+void AmbisonicMixingEncoderNode::UpdateClusteringStates() {
+  for (auto& state_itr : clustering_states_) {
+    ClusteringState* state = &state_itr.second;
+    if (state->is_active) {
+      state->is_active = false;
+    } else if (state->has_history) {
+      // Sources without input leave their clusters immediately, and restart
+      // without fades once they become active again.
+      ResetClusteringState(state);
+    }
+  }
+}
+
 }  // namespace vraudio
@@ -17,12 +17,16 @@ limitations under the License.
 #ifndef RESONANCE_AUDIO_GRAPH_AMBISONIC_MIXING_ENCODER_NODE_H_
 #define RESONANCE_AUDIO_GRAPH_AMBISONIC_MIXING_ENCODER_NODE_H_
 
+#include <unordered_map>
 #include <vector>
 
 #include "ambisonics/ambisonic_lookup_table.h"
 #include "base/audio_buffer.h"
+#include "base/misc_math.h"
+#include "base/source_parameters.h"
 #include "base/spherical_angle.h"
 #include "dsp/gain_mixer.h"
+#include "dsp/gain_processor.h"
 #include "graph/system_settings.h"
 #include "node/processing_node.h"
 
@@ -30,8 +34,27 @@ namespace vraudio {
 
 // Node that accepts single mono sound object buffer as input and encodes it
 // into an Ambisonic sound field.
+//
+// The encoding coefficients of moving sources are evaluated at several points
+// within a buffer, at directions interpolated from the listener and source
+// transforms of the previous and current buffer, and the gains ramp linearly
+// between them. This avoids stepping of fast sources at large buffer sizes.
+// Sources which jump by a large distance or angle within a buffer are encoded
+// once per buffer instead.
+//
+// Distant sources with clustering enabled are not encoded individually.
+// Instead, they are grouped by direction into at most |kMaxNumSourceClusters|
+// clusters, whose mixed signals are encoded once at the cluster centroids. A
+// source keeps its cluster until it moves too far away from the centroid, and
+// changes of cluster are crossfaded. Clustered sources bypass the upstream
+// direct attenuation, occlusion and near field nodes, see
+// |SourceParameters::is_clustered|, so their direct attenuation is applied
+// while they are mixed.
 class AmbisonicMixingEncoderNode : public ProcessingNode {
  public:
+  // Indicates that a source is not assigned to any cluster.
+  static const int kNoCluster = -1;
+
   // Initializes AmbisonicMixingEncoderNode class.
   //
   // @param system_settings Global system configuration.
@@ -41,6 +64,20 @@ class AmbisonicMixingEncoderNode : public ProcessingNode {
                              const AmbisonicLookupTable& lookup_table,
                              int ambisonic_order);
 
+  // Creates the clustering state of the given source, if it does not exist
+  // yet. Sources without a clustering state are always encoded individually.
+  // Must be called before the clustering of the source is enabled, and
+  // synchronized with the audio processing.
+  //
+  // @param source_id Id of the source.
+  void AddClusteredSource(SourceId source_id);
+
+  // Removes the given source from its clusters and deletes its clustering
+  // state. Must be synchronized with the audio processing.
+  //
+  // @param source_id Id of the source.
+  void RemoveClusteredSource(SourceId source_id);
+
   // Node implementation.
   bool CleanUp() final {
     CallCleanUpOnInputNodes();
@@ -53,6 +90,127 @@ class AmbisonicMixingEncoderNode : public ProcessingNode {
   const AudioBuffer* AudioProcess(const NodeInput& input) override;
 
  private:
+  friend class AmbisonicMixingEncoderNodeTest;
+
+  // Cluster of sources mixed into a single channel of |cluster_buffer_|.
+  struct SourceCluster {
+    SourceCluster();
+
+    // Unit vector pointing towards the cluster centroid.
+    WorldPosition direction;
+
+    // Sum of the unit direction vectors and spreads of the member sources
+    // processed in the current buffer.
+    WorldPosition direction_sum;
+    float spread_deg_sum;
+    size_t num_processed_sources;
+
+    // Number of sources assigned to the cluster, and number of sources
+    // fading out of the cluster.
+    size_t num_sources;
+    size_t num_fading_sources;
+
+    // Whether the cluster channel holds any input in the current buffer.
+    bool has_input;
+  };
+
+  // Clustering state of a single source.
+  struct ClusteringState {
+    ClusteringState();
+
+    // Index of the cluster the source is assigned to, or |kNoCluster| if the
+    // source is encoded individually.
+    int cluster;
+
+    // Index of the cluster the source is fading out of, or |kNoCluster|.
+    int fading_cluster;
+
+    // Gain processors which crossfade the individual encoding, the current
+    // cluster and the fading cluster.
+    GainProcessor direct_processor;
+    GainProcessor cluster_processor;
+    GainProcessor fading_processor;
+
+    // Whether the direct attenuation of the source has been applied by the
+    // gain processors in the previous buffer, rather than upstream, and the
+    // direct attenuation of the previous buffer.
+    bool applies_attenuation;
+    float attenuation;
+
+    // Whether the source has been processed in the current buffer.
+    bool is_active;
+
+    // Whether the source has been processed in any previous buffer since its
+    // state was last reset.
+    bool has_history;
+  };
+
+  // Encodes a single source individually into the sound field, in segments
+  // of the buffer if the source moves relative to the listener.
+  //
+  // @param source_id Id of the source.
+  // @param parameters Parameters of the source.
+  // @param input Mono input channel of the source.
+  void EncodeSource(SourceId source_id, const SourceParameters& parameters,
+                    const AudioBuffer::Channel& input);
+
+  // Encodes a single source, which is either encoded individually or mixed
+  // into one of the clusters depending on its distance and direction.
+  //
+  // @param source_id Id of the source.
+  // @param parameters Parameters of the source.
+  // @param input Mono input channel of the source.
+  // @param state Clustering state of the source.
+  void ProcessClusteredSource(SourceId source_id,
+                              const SourceParameters& parameters,
+                              const AudioBuffer::Channel& input,
+                              ClusteringState* state);
+
+  // Returns the index of the cluster a source in the given |direction| should
+  // be assigned to. Claims a free cluster if no cluster is close enough.
+  //
+  // @param direction Unit vector pointing towards the source.
+  // @return Cluster index.
+  int FindCluster(const WorldPosition& direction);
+
+  // Mixes the |input| into the given cluster channel.
+  //
+  // @param cluster Cluster index.
+  // @param target_gain Target gain of the input.
+  // @param input Input channel.
+  // @param processor Gain processor of the input.
+  void AddToCluster(int cluster, float target_gain,
+                    const AudioBuffer::Channel& input,
+                    GainProcessor* processor);
+
+  // Rescales the gain processors of the source when its direct attenuation
+  // moves between the upstream node and the gain processors, such that its
+  // gains continue without a step.
+  //
+  // @param applies_attenuation Whether the gain processors apply the direct
+  //     attenuation in the current buffer.
+  // @param state Clustering state of the source.
+  void UpdateAttenuationScope(bool applies_attenuation,
+                              ClusteringState* state);
+
+  // Assigns the source to a new cluster, fading out of the current one.
+  //
+  // @param cluster New cluster index, or |kNoCluster|.
+  // @param state Clustering state of the source.
+  void AssignCluster(int cluster, ClusteringState* state);
+
+  // Removes the source from its clusters and resets its state.
+  //
+  // @param state Clustering state of the source.
+  void ResetClusteringState(ClusteringState* state);
+
+  // Encodes the clusters with input at their centroids.
+  void EncodeClusters();
+
+  // Resets the states of the sources which were not processed in the current
+  // buffer.
+  void UpdateClusteringStates();
+
   const SystemSettings& system_settings_;
   const AmbisonicLookupTable& lookup_table_;
 
@@ -64,6 +222,26 @@ class AmbisonicMixingEncoderNode : public ProcessingNode {
 
   // Encoding coefficient values to be applied to encode the input.
   std::vector<float> coefficients_;
+
+  // Interpolated directions and spreads of a moving source at the ends of the
+  // buffer segments, and the corresponding encoding coefficients.
+  std::vector<SphericalAngle> segment_directions_;
+  std::vector<float> segment_spreads_deg_;
+  std::vector<float> segment_coefficients_;
+
+  // Scratch channel holding the individually encoded part of a clustered
+  // source while it crossfades into or out of a cluster.
+  AudioBuffer direct_buffer_;
+
+  // Mixed signals of the source clusters, one channel per cluster.
+  AudioBuffer cluster_buffer_;
+
+  std::vector<SourceCluster> clusters_;
+
+  // Clustering states of the sources that may have clustering enabled. They
+  // are added and removed outside of the audio processing, which never
+  // allocates them.
+  std::unordered_map<SourceId, ClusteringState> clustering_states_;
 };
 
 }  // namespace vraudio
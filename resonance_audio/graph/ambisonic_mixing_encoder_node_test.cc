@@ -16,6 +16,9 @@ limitations under the License.
 
 #include "graph/ambisonic_mixing_encoder_node.h"
 
+#include <algorithm>
+#include <cmath>
+#include <utility>
 #include <vector>
 
 #include "third_party/googletest/googletest/include/gtest/gtest.h"
@@ -25,6 +28,7 @@ limitations under the License.
 #include "base/constants_and_types.h"
 #include "base/object_transform.h"
 #include "config/source_config.h"
+#include "dsp/distance_attenuation.h"
 #include "graph/buffered_source_node.h"
 #include "node/sink_node.h"
 #include "node/source_node.h"
@@ -58,6 +62,73 @@ class AmbisonicMixingEncoderNodeTest
             system_settings_, lookup_table_, ambisonic_order_);
   }
 
+  // Processes a single buffer of unit inputs of sources with clustering
+  // enabled at the given |positions| and with the given |distance_attenuation|.
+  // Like in the graph, the inputs of sources that are not clustered are
+  // attenuated upstream. The sources are created on the first call.
+  const AudioBuffer* ProcessClusteredSources(
+      const std::vector<WorldPosition>& positions,
+      float distance_attenuation) {
+    auto parameters_manager = system_settings_.GetSourceParametersManager();
+    if (buffered_source_nodes_.empty()) {
+      output_node_ = std::make_shared<SinkNode>();
+      output_node_->Connect(ambisonic_mixing_encoder_node_);
+      for (size_t i = 0; i < positions.size(); ++i) {
+        const SourceId source_id = static_cast<SourceId>(i);
+        buffered_source_nodes_.emplace_back(
+            std::make_shared<BufferedSourceNode>(source_id, kNumMonoChannels,
+                                                 kFramesPerBuffer));
+        parameters_manager->Register(source_id);
+        ambisonic_mixing_encoder_node_->AddClusteredSource(source_id);
+        auto source_parameters =
+            parameters_manager->GetMutableParameters(source_id);
+        source_parameters->enable_clustering = true;
+        source_parameters->distance_rolloff_model = DistanceRolloffModel::kNone;
+        ambisonic_mixing_encoder_node_->Connect(buffered_source_nodes_[i]);
+      }
+    }
+    DCHECK_EQ(positions.size(), buffered_source_nodes_.size());
+    for (size_t i = 0; i < positions.size(); ++i) {
+      auto source_parameters =
+          parameters_manager->GetMutableParameters(static_cast<SourceId>(i));
+      source_parameters->object_transform.position = positions[i];
+      source_parameters->distance_attenuation = distance_attenuation;
+      UpdateSourceGeometry(system_settings_.GetHeadPosition(),
+                           system_settings_.GetHeadRotation(),
+                           source_parameters);
+      UpdateAttenuationParameters(1.0f /* master_gain */,
+                                  1.0f /* reflections_gain */,
+                                  1.0f /* reverb_gain */, source_parameters);
+      AudioBuffer* input_buffer =
+          buffered_source_nodes_[i]->GetMutableAudioBufferAndSetNewBufferFlag();
+      std::fill((*input_buffer)[0].begin(), (*input_buffer)[0].end(),
+                source_parameters->is_clustered ? 1.0f
+                                                : distance_attenuation);
+    }
+    const std::vector<const AudioBuffer*>& buffer_vector =
+        output_node_->ReadInputs();
+    return buffer_vector.empty() ? nullptr : buffer_vector.front();
+  }
+
+  // Returns the number of clusters with assigned sources.
+  size_t GetNumUsedClusters() const {
+    size_t num_used_clusters = 0;
+    for (const auto& cluster : ambisonic_mixing_encoder_node_->clusters_) {
+      if (cluster.num_sources > 0) {
+        ++num_used_clusters;
+      }
+    }
+    return num_used_clusters;
+  }
+
+  // Returns the cluster the given source is assigned to.
+  int GetCluster(SourceId source_id) const {
+    const auto& states = ambisonic_mixing_encoder_node_->clustering_states_;
+    const auto it = states.find(source_id);
+    return it == states.end() ? AmbisonicMixingEncoderNode::kNoCluster
+                              : it->second.cluster;
+  }
+
   const AudioBuffer* ProcessMultipleInputs(size_t num_sources,
                                            const WorldPosition& position,
                                            float spread_deg) {
@@ -90,6 +161,9 @@ class AmbisonicMixingEncoderNodeTest
       auto source_parameters = parameters_manager->GetMutableParameters(
           static_cast<SourceId>(index));
       source_parameters->object_transform.position = position;
+      UpdateSourceGeometry(system_settings_.GetHeadPosition(),
+                           system_settings_.GetHeadRotation(),
+                           source_parameters);
       source_parameters->spread_deg = spread_deg;
     }
 
@@ -108,6 +182,7 @@ class AmbisonicMixingEncoderNodeTest
   AmbisonicLookupTable lookup_table_;
   std::shared_ptr<AmbisonicMixingEncoderNode> ambisonic_mixing_encoder_node_;
   std::vector<std::shared_ptr<BufferedSourceNode>> buffered_source_nodes_;
+  std::shared_ptr<SinkNode> output_node_;
 };
 
 // Tests that a number of sound objects encoded in the same direction are
@@ -142,9 +217,293 @@ TEST_P(AmbisonicMixingEncoderNodeTest, TestEncodeAndMix) {
   }
 }
 
+// Tests that distant sources in the same direction are grouped into a single
+// cluster, which is encoded like the individual sources.
+TEST_P(AmbisonicMixingEncoderNodeTest, TestClusterSameDirection) {
+  const size_t kNumSources = 4;
+  // Same direction as in |TestEncodeAndMix|, at a distance of 10 meters.
+  const WorldPosition kPosition =
+      10.0f * WorldPosition(-0.55901699f, 0.30901699f, -0.76942088f);
+  const std::vector<float> kExpectedSingleSourceOutput = {
+      1.0f,         0.55901699f,  0.30901699f,  0.76942088f,
+      0.74498856f,  0.29920441f,  -0.35676274f, 0.41181955f,
+      0.24206145f,  0.64679299f,  0.51477443f,  -0.17888019f,
+      -0.38975424f, -0.24620746f, 0.16726035f,  -0.21015578f};
+  const float kEpsilon = 1e-4f;
+
+  const AudioBuffer* output_buffer = ProcessClusteredSources(
+      std::vector<WorldPosition>(kNumSources, kPosition), 1.0f);
+  ASSERT_NE(output_buffer, nullptr);
+  EXPECT_EQ(GetNumUsedClusters(), 1U);
+
+  const size_t num_channels = GetNumPeriphonicComponents(ambisonic_order_);
+  for (size_t i = 0; i < num_channels; ++i) {
+    EXPECT_NEAR(
+        kExpectedSingleSourceOutput[i] * static_cast<float>(kNumSources),
+        (*output_buffer)[i][kFramesPerBuffer - 1], kEpsilon);
+  }
+}
+
+// Tests that removed sources leave their cluster, and are encoded individually
+// even though their clustering is still enabled.
+TEST_P(AmbisonicMixingEncoderNodeTest, TestRemoveClusteredSource) {
+  const size_t kNumSources = 4;
+  const WorldPosition kPosition(0.0f, 0.0f, -10.0f);
+  const std::vector<WorldPosition> positions(kNumSources, kPosition);
+
+  ASSERT_NE(ProcessClusteredSources(positions, 1.0f), nullptr);
+  EXPECT_EQ(GetNumUsedClusters(), 1U);
+  for (size_t i = 0; i < kNumSources; ++i) {
+    ambisonic_mixing_encoder_node_->RemoveClusteredSource(
+        static_cast<SourceId>(i));
+  }
+  EXPECT_EQ(GetNumUsedClusters(), 0U);
+
+  const AudioBuffer* output_buffer = ProcessClusteredSources(positions, 1.0f);
+  ASSERT_NE(output_buffer, nullptr);
+  EXPECT_EQ(GetNumUsedClusters(), 0U);
+  for (size_t i = 0; i < kNumSources; ++i) {
+    EXPECT_EQ(GetCluster(static_cast<SourceId>(i)),
+              AmbisonicMixingEncoderNode::kNoCluster);
+  }
+  EXPECT_NEAR(static_cast<float>(kNumSources),
+              (*output_buffer)[0][kFramesPerBuffer - 1], 1e-3f);
+}
+
+// Tests that the number of clusters is bounded, that nearby sources are not
+// clustered, and that the omnidirectional component is preserved.
+TEST_P(AmbisonicMixingEncoderNodeTest, TestClusterCountAndDistance) {
+  const size_t kNumSources = 256;
+  const float kDistance = 10.0f;
+  const size_t kNumNearSources = 4;
+  std::vector<WorldPosition> positions(kNumSources);
+  for (size_t i = 0; i < kNumSources; ++i) {
+    // Spiral the sources around the listener.
+    const float elevation =
+        std::asin(2.0f * (static_cast<float>(i) + 0.5f) /
+                      static_cast<float>(kNumSources) -
+                  1.0f);
+    const float azimuth = static_cast<float>(i) * 2.39996323f;
+    const float distance = i < kNumNearSources ? 1.0f : kDistance;
+    positions[i] = distance * WorldPosition(std::cos(elevation) *
+                                                std::sin(azimuth),
+                                            std::sin(elevation),
+                                            std::cos(elevation) *
+                                                std::cos(azimuth));
+  }
+
+  const AudioBuffer* output_buffer = ProcessClusteredSources(positions, 1.0f);
+  ASSERT_NE(output_buffer, nullptr);
+  EXPECT_EQ(GetNumUsedClusters(), kMaxNumSourceClusters);
+  for (size_t i = 0; i < kNumSources; ++i) {
+    const int cluster = GetCluster(static_cast<SourceId>(i));
+    if (i < kNumNearSources) {
+      EXPECT_EQ(cluster, AmbisonicMixingEncoderNode::kNoCluster);
+    } else {
+      EXPECT_NE(cluster, AmbisonicMixingEncoderNode::kNoCluster);
+    }
+  }
+  for (size_t frame = 0; frame < kFramesPerBuffer; ++frame) {
+    EXPECT_NEAR(static_cast<float>(kNumSources), (*output_buffer)[0][frame],
+                1e-3f);
+  }
+}
+
+// Tests that a source moving to another cluster is crossfaded smoothly.
+TEST_P(AmbisonicMixingEncoderNodeTest, TestClusterCrossfade) {
+  const WorldPosition kFrontPosition(0.0f, 0.0f, -10.0f);
+  const WorldPosition kLeftPosition(-10.0f, 0.0f, 0.0f);
+  // Maximum sample to sample change of the output, well below the step of a
+  // hard cluster switch.
+  const float kMaxStep = 4.0f / static_cast<float>(kUnitRampLength);
+  const size_t kNumBuffers = 2 * kUnitRampLength / kFramesPerBuffer;
+  const size_t num_channels = GetNumPeriphonicComponents(ambisonic_order_);
+
+  const std::vector<WorldPosition> front_positions(1, kFrontPosition);
+  const std::vector<WorldPosition> left_positions(1, kLeftPosition);
+  const AudioBuffer* output_buffer =
+      ProcessClusteredSources(front_positions, 1.0f);
+  ASSERT_NE(output_buffer, nullptr);
+  const int front_cluster = GetCluster(0);
+  std::vector<float> previous_output(num_channels);
+  for (size_t i = 0; i < num_channels; ++i) {
+    previous_output[i] = (*output_buffer)[i][kFramesPerBuffer - 1];
+  }
+  for (size_t buffer = 0; buffer < kNumBuffers; ++buffer) {
+    output_buffer = ProcessClusteredSources(left_positions, 1.0f);
+    ASSERT_NE(output_buffer, nullptr);
+    for (size_t i = 0; i < num_channels; ++i) {
+      for (size_t frame = 0; frame < kFramesPerBuffer; ++frame) {
+        EXPECT_NEAR(previous_output[i], (*output_buffer)[i][frame], kMaxStep);
+        previous_output[i] = (*output_buffer)[i][frame];
+      }
+    }
+  }
+  EXPECT_NE(GetCluster(0), front_cluster);
+  // Once the crossfade has completed, the source is encoded to the left.
+  EXPECT_NEAR(1.0f, previous_output[1], 1e-3f);
+  EXPECT_NEAR(0.0f, previous_output[3], 1e-3f);
+}
+
+// Tests that the direct attenuation of clustered sources is applied by the
+// node, and that the gain continues smoothly when the sources move into and out
+// of the clustering distance.
+TEST_P(AmbisonicMixingEncoderNodeTest, TestClusteredSourceAttenuation) {
+  const size_t kNumSources = 4;
+  const float kDistanceAttenuation = 0.5f;
+  const WorldPosition kDistantPosition(0.0f, 0.0f, -10.0f);
+  const WorldPosition kNearPosition(0.0f, 0.0f, -2.0f);
+  const size_t kNumBuffers = 2 * kUnitRampLength / kFramesPerBuffer;
+  const float kExpectedOutput =
+      kDistanceAttenuation * static_cast<float>(kNumSources);
+
+  for (const WorldPosition& position :
+       {kDistantPosition, kNearPosition, kDistantPosition}) {
+    const std::vector<WorldPosition> positions(kNumSources, position);
+    for (size_t buffer = 0; buffer < kNumBuffers; ++buffer) {
+      const AudioBuffer* output_buffer =
+          ProcessClusteredSources(positions, kDistanceAttenuation);
+      ASSERT_NE(output_buffer, nullptr);
+      for (size_t frame = 0; frame < kFramesPerBuffer; ++frame) {
+        EXPECT_NEAR(kExpectedOutput, (*output_buffer)[0][frame], 1e-3f);
+      }
+    }
+    EXPECT_EQ(GetNumUsedClusters(), position == kNearPosition ? 0U : 1U);
+  }
+}
+
 INSTANTIATE_TEST_CASE_P(TestParameters, AmbisonicMixingEncoderNodeTest,
                         testing::Values(BinauralLowQualityConfig(),
                                         BinauralMediumQualityConfig(),
                                         BinauralHighQualityConfig()));
 
+namespace {
+
+// Number of frames per input buffer of the moving source tests.
+const size_t kLargeFramesPerBuffer = 1024;
+
+// Ambisonic order of the moving source tests.
+const int kMovingSourceAmbisonicOrder = 3;
+
+// Renders two buffers of a constant input through an encoder node, with the
+// source at |start_position| and |end_position|, respectively. Returns the
+// encoding of the second buffer in |output| and the source parameters of the
+// second buffer in |parameters|.
+void RenderMovingSource(const WorldPosition& start_position,
+                        const WorldPosition& end_position,
+                        const AmbisonicLookupTable& lookup_table,
+                        AudioBuffer* output, SourceParameters* parameters) {
+  SystemSettings system_settings(kNumStereoChannels, kLargeFramesPerBuffer,
+                                 kSampleRate);
+  auto ambisonic_mixing_encoder_node =
+      std::make_shared<AmbisonicMixingEncoderNode>(
+          system_settings, lookup_table, kMovingSourceAmbisonicOrder);
+  auto output_node = std::make_shared<SinkNode>();
+  output_node->Connect(ambisonic_mixing_encoder_node);
+  const SourceId kSourceId = 0;
+  auto buffered_source_node = std::make_shared<BufferedSourceNode>(
+      kSourceId, kNumMonoChannels, kLargeFramesPerBuffer);
+  ambisonic_mixing_encoder_node->Connect(buffered_source_node);
+  auto parameters_manager = system_settings.GetSourceParametersManager();
+  parameters_manager->Register(kSourceId);
+  auto source_parameters = parameters_manager->GetMutableParameters(kSourceId);
+
+  for (const WorldPosition& position : {start_position, end_position}) {
+    AudioBuffer* input_buffer =
+        buffered_source_node->GetMutableAudioBufferAndSetNewBufferFlag();
+    std::fill((*input_buffer)[0].begin(), (*input_buffer)[0].end(), 1.0f);
+    source_parameters->object_transform.position = position;
+    UpdateSourceGeometry(system_settings.GetHeadPosition(),
+                         system_settings.GetHeadRotation(), source_parameters);
+    const std::vector<const AudioBuffer*>& buffer_vector =
+        output_node->ReadInputs();
+    ASSERT_EQ(1U, buffer_vector.size());
+    *output = *buffer_vector.front();
+  }
+  *parameters = *source_parameters;
+}
+
+}  // namespace
+
+// Tests that the encoding of a source moving within a large buffer follows the
+// directions interpolated from the source transforms, rather than ramping
+// towards the direction at the end of the buffer.
+TEST(AmbisonicMixingEncoderNodeMovingSourceTest, TestFollowsTrajectory) {
+  // Moves the source by 90 degrees around the listener within one buffer.
+  const WorldPosition kStartPosition(0.0f, 0.0f, -2.0f);
+  const WorldPosition kEndPosition(-2.0f, 0.0f, 0.0f);
+  // Maximum deviation from the exact encoding of the interpolated directions,
+  // which are evaluated at the ends of short segments of the buffer.
+  const float kMaxError = 5e-3f;
+
+  AmbisonicLookupTable lookup_table(kMaxSupportedAmbisonicOrder);
+  const size_t num_channels =
+      GetNumPeriphonicComponents(kMovingSourceAmbisonicOrder);
+  AudioBuffer output_buffer(num_channels, kLargeFramesPerBuffer);
+  SourceParameters source_parameters;
+  RenderMovingSource(kStartPosition, kEndPosition, lookup_table,
+                     &output_buffer, &source_parameters);
+
+  std::vector<float> expected_coeffs(num_channels);
+  for (size_t frame = 0; frame < kLargeFramesPerBuffer; ++frame) {
+    const float interpolation_factor =
+        static_cast<float>(frame) / static_cast<float>(kLargeFramesPerBuffer);
+    lookup_table.GetEncodingCoeffs(
+        kMovingSourceAmbisonicOrder,
+        InterpolateDirectionFromListener(source_parameters.geometry,
+                                         interpolation_factor),
+        source_parameters.spread_deg, &expected_coeffs);
+    for (size_t i = 0; i < num_channels; ++i) {
+      EXPECT_NEAR(expected_coeffs[i], output_buffer[i][frame], kMaxError);
+    }
+  }
+}
+
+// Tests that the encoding of a source which jumps by a large angle or distance
+// within a buffer ramps directly from the previous towards the current
+// direction, rather than sweeping through the directions in between.
+TEST(AmbisonicMixingEncoderNodeMovingSourceTest, TestDoesNotInterpolateJumps) {
+  // Jumps of 153 degrees and of 20 meters across the front of the listener.
+  const std::vector<std::pair<WorldPosition, WorldPosition>> kJumps = {
+      {WorldPosition(0.0f, 0.0f, -2.0f), WorldPosition(-1.0f, 0.0f, 2.0f)},
+      {WorldPosition(-10.0f, 0.0f, -10.0f),
+       WorldPosition(10.0f, 0.0f, -10.0f)}};
+  const float kEpsilon = 1e-5f;
+
+  AmbisonicLookupTable lookup_table(kMaxSupportedAmbisonicOrder);
+  const size_t num_channels =
+      GetNumPeriphonicComponents(kMovingSourceAmbisonicOrder);
+  std::vector<float> start_coeffs(num_channels);
+  std::vector<float> end_coeffs(num_channels);
+  for (const auto& jump : kJumps) {
+    AudioBuffer output_buffer(num_channels, kLargeFramesPerBuffer);
+    SourceParameters source_parameters;
+    RenderMovingSource(jump.first, jump.second, lookup_table, &output_buffer,
+                       &source_parameters);
+    lookup_table.GetEncodingCoeffs(
+        kMovingSourceAmbisonicOrder,
+        InterpolateDirectionFromListener(source_parameters.geometry, 0.0f),
+        source_parameters.spread_deg, &start_coeffs);
+    lookup_table.GetEncodingCoeffs(
+        kMovingSourceAmbisonicOrder,
+        InterpolateDirectionFromListener(source_parameters.geometry, 1.0f),
+        source_parameters.spread_deg, &end_coeffs);
+
+    // Each channel ramps linearly from the previous towards the current
+    // encoding coefficient, without leaving the range in between.
+    for (size_t i = 0; i < num_channels; ++i) {
+      const float min_coeff = std::min(start_coeffs[i], end_coeffs[i]);
+      const float max_coeff = std::max(start_coeffs[i], end_coeffs[i]);
+      for (size_t frame = 0; frame < kLargeFramesPerBuffer; ++frame) {
+        EXPECT_GE(output_buffer[i][frame], min_coeff - kEpsilon);
+        EXPECT_LE(output_buffer[i][frame], max_coeff + kEpsilon);
+        EXPECT_LE(std::abs(output_buffer[i][frame] - start_coeffs[i]),
+                  static_cast<float>(frame + 1) /
+                          static_cast<float>(kUnitRampLength) +
+                      kEpsilon);
+      }
+    }
+  }
+}
+
 }  // namespace vraudio
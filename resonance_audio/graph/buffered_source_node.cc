@@ -16,16 +16,69 @@ limitations under the License.
 
 #include "graph/buffered_source_node.h"
 
+#include <algorithm>
+
 #include "base/constants_and_types.h"
 #include "base/logging.h"
+#include "utils/planar_interleaved_conversion.h"
+#include "utils/sample_type_conversion.h"
 
 namespace vraudio {
 
+namespace {
+
+// Number of output buffers held by the resampling stage, which includes the
+// buffer of silence that absorbs the jitter of the input buffer sizes.
+const size_t kMaxNumResampledBuffers = 8;
+
+// Returns whether input buffers with |num_input_channels| channels can be
+// mapped to a source with |num_source_channels| channels.
+bool IsChannelMappingSupported(size_t num_input_channels,
+                               size_t num_source_channels) {
+  return num_input_channels >= num_source_channels ||
+         (num_input_channels == kNumMonoChannels &&
+          num_source_channels == kNumStereoChannels);
+}
+
+// Returns a sample of an interleaved input buffer as float.
+template <typename SampleType>
+float GetInputSample(const SampleType* buffer, size_t num_channels,
+                     size_t channel, size_t frame) {
+  float sample;
+  ConvertSampleToFloatFormat(buffer[frame * num_channels + channel], &sample);
+  return sample;
+}
+
+// Returns a sample of a planar input buffer as float.
+template <typename SampleType>
+float GetInputSample(const SampleType* const* buffer, size_t num_channels,
+                     size_t channel, size_t frame) {
+  float sample;
+  ConvertSampleToFloatFormat(buffer[channel][frame], &sample);
+  return sample;
+}
+
+}  // namespace
+
+BufferedSourceNode::ResamplingStage::ResamplingStage(size_t num_channels,
+                                                     size_t frames_per_buffer)
+    : resampler(num_channels),
+      input_frames(num_channels, frames_per_buffer),
+      max_frames_per_input_block(frames_per_buffer),
+      resampled_block(num_channels, frames_per_buffer),
+      resampled_frames(num_channels,
+                       kMaxNumResampledBuffers * frames_per_buffer),
+      num_resampled_frames(0) {}
+
 BufferedSourceNode::BufferedSourceNode(SourceId source_id, size_t num_channels,
                                        size_t frames_per_buffer)
     : source_id_(source_id),
       input_audio_buffer_(num_channels, frames_per_buffer),
-      new_buffer_flag_(false) {
+      new_buffer_flag_(false),
+      has_output_(false),
+      source_sample_rate_hz_(0),
+      system_sample_rate_hz_(0),
+      is_resampling_(false) {
   input_audio_buffer_.Clear();
 }
 
@@ -34,13 +87,169 @@ AudioBuffer* BufferedSourceNode::GetMutableAudioBufferAndSetNewBufferFlag() {
   return &input_audio_buffer_;
 }
 
+void BufferedSourceNode::SetSampleRate(int source_sample_rate_hz,
+                                       int system_sample_rate_hz) {
+  DCHECK_GT(source_sample_rate_hz, 0);
+  DCHECK_GT(system_sample_rate_hz, 0);
+  if (source_sample_rate_hz == source_sample_rate_hz_ &&
+      system_sample_rate_hz == system_sample_rate_hz_) {
+    return;
+  }
+  source_sample_rate_hz_ = source_sample_rate_hz;
+  system_sample_rate_hz_ = system_sample_rate_hz;
+  if (source_sample_rate_hz_ == system_sample_rate_hz_) {
+    is_resampling_ = false;
+    return;
+  }
+
+  const size_t num_channels = input_audio_buffer_.num_channels();
+  const size_t frames_per_buffer = input_audio_buffer_.num_frames();
+  if (resampling_stage_ == nullptr) {
+    resampling_stage_.reset(
+        new ResamplingStage(num_channels, frames_per_buffer));
+  }
+  ResamplingStage* const stage = resampling_stage_.get();
+  stage->resampler.SetRateAndNumChannels(
+      source_sample_rate_hz_, system_sample_rate_hz_, num_channels);
+  if (!is_resampling_) {
+    // Start with a buffer of silence, which absorbs the jitter of the input
+    // buffer sizes. Otherwise, the frames which have been resampled at the
+    // previous source sample rate are kept.
+    stage->resampler.ResetState();
+    stage->resampled_frames.Clear();
+    stage->num_resampled_frames = frames_per_buffer;
+    is_resampling_ = true;
+  }
+  // Limit the input blocks such that the resampled output of a block fits
+  // into |resampled_block|.
+  const size_t max_resampled_block_frames =
+      stage->resampled_block.num_frames();
+  stage->max_frames_per_input_block = std::max(
+      std::min(stage->input_frames.num_frames(),
+               (max_resampled_block_frames - 1) *
+                   static_cast<size_t>(source_sample_rate_hz_) /
+                   static_cast<size_t>(system_sample_rate_hz_)),
+      size_t(1));
+  DCHECK_LE(
+      stage->resampler.GetMaxOutputLength(stage->max_frames_per_input_block),
+      max_resampled_block_frames);
+}
+
+void BufferedSourceNode::AddSourceRateBuffer(const float* buffer,
+                                             size_t num_channels,
+                                             size_t num_frames) {
+  AddSourceRateBufferTemplated(buffer, num_channels, num_frames);
+}
+
+void BufferedSourceNode::AddSourceRateBuffer(const int16* buffer,
+                                             size_t num_channels,
+                                             size_t num_frames) {
+  AddSourceRateBufferTemplated(buffer, num_channels, num_frames);
+}
+
+void BufferedSourceNode::AddSourceRateBuffer(const float* const* buffer,
+                                             size_t num_channels,
+                                             size_t num_frames) {
+  AddSourceRateBufferTemplated(buffer, num_channels, num_frames);
+}
+
+void BufferedSourceNode::AddSourceRateBuffer(const int16* const* buffer,
+                                             size_t num_channels,
+                                             size_t num_frames) {
+  AddSourceRateBufferTemplated(buffer, num_channels, num_frames);
+}
+
 const AudioBuffer* BufferedSourceNode::AudioProcess() {
-  if (!new_buffer_flag_) {
-    return nullptr;
+  has_output_ = false;
+  if (is_resampling_) {
+    if (!ProcessResamplingStage()) {
+      return nullptr;
+    }
+  } else {
+    if (!new_buffer_flag_) {
+      return nullptr;
+    }
+    new_buffer_flag_ = false;
   }
-  new_buffer_flag_ = false;
   input_audio_buffer_.set_source_id(source_id_);
+  has_output_ = true;
   return &input_audio_buffer_;
 }
 
+template <typename BufferType>
+void BufferedSourceNode::AddSourceRateBufferTemplated(BufferType buffer,
+                                                      size_t num_channels,
+                                                      size_t num_frames) {
+  DCHECK(is_resampling_);
+  const size_t num_source_channels = input_audio_buffer_.num_channels();
+  if (!IsChannelMappingSupported(num_channels, num_source_channels)) {
+    LOG(WARNING) << "Number of input channels does not match the number of "
+                    "output channels";
+    return;
+  }
+  ResamplingStage* const stage = resampling_stage_.get();
+  size_t input_frame = 0;
+  while (input_frame < num_frames) {
+    const size_t num_block_frames = std::min(
+        num_frames - input_frame, stage->max_frames_per_input_block);
+    if (stage->num_resampled_frames +
+            stage->resampler.GetMaxOutputLength(num_block_frames) >
+        stage->resampled_frames.num_frames()) {
+      LOG(WARNING) << "Too many input frames queued, dropping input frames";
+      return;
+    }
+
+    // Map the input channels to the source channels. Mono input is copied to
+    // both channels of a stereo source, excess input channels are dropped.
+    if (num_channels == num_source_channels) {
+      FillAudioBufferWithOffset(buffer, num_frames, num_channels, input_frame,
+                                0 /* output_frame_offset */, num_block_frames,
+                                &stage->input_frames);
+    } else {
+      for (size_t channel = 0; channel < num_source_channels; ++channel) {
+        const size_t input_channel =
+            num_channels == kNumMonoChannels ? 0 : channel;
+        auto& input_channel_frames = stage->input_frames[channel];
+        for (size_t frame = 0; frame < num_block_frames; ++frame) {
+          input_channel_frames[frame] = GetInputSample(
+              buffer, num_channels, input_channel, input_frame + frame);
+        }
+      }
+    }
+
+    const size_t num_resampled_block_frames =
+        stage->resampler.GetNextOutputLength(num_block_frames);
+    stage->resampler.Process(stage->input_frames, num_block_frames,
+                             &stage->resampled_block);
+    for (size_t channel = 0; channel < num_source_channels; ++channel) {
+      std::copy_n(stage->resampled_block[channel].begin(),
+                  num_resampled_block_frames,
+                  stage->resampled_frames[channel].begin() +
+                      stage->num_resampled_frames);
+    }
+    stage->num_resampled_frames += num_resampled_block_frames;
+    input_frame += num_block_frames;
+  }
+}
+
+bool BufferedSourceNode::ProcessResamplingStage() {
+  ResamplingStage* const stage = resampling_stage_.get();
+  const size_t frames_per_buffer = input_audio_buffer_.num_frames();
+  if (stage->num_resampled_frames < frames_per_buffer) {
+    return false;
+  }
+
+  // Output the oldest resampled frames.
+  stage->num_resampled_frames -= frames_per_buffer;
+  for (size_t channel = 0; channel < input_audio_buffer_.num_channels();
+       ++channel) {
+    auto& resampled_channel = stage->resampled_frames[channel];
+    std::copy_n(resampled_channel.begin(), frames_per_buffer,
+                input_audio_buffer_[channel].begin());
+    std::copy_n(resampled_channel.begin() + frames_per_buffer,
+                stage->num_resampled_frames, resampled_channel.begin());
+  }
+  return true;
+}
+
 }  // namespace vraudio
@@ -17,15 +17,22 @@ limitations under the License.
 #ifndef RESONANCE_AUDIO_GRAPH_BUFFERED_SOURCE_NODE_H_
 #define RESONANCE_AUDIO_GRAPH_BUFFERED_SOURCE_NODE_H_
 
+#include <memory>
+
 #include "base/audio_buffer.h"
 #include "base/constants_and_types.h"
+#include "base/integral_types.h"
+#include "dsp/resampler.h"
 #include "node/source_node.h"
 
 namespace vraudio {
 
-// Node that sets the |AudioBuffer| of a source. This class is *not*
-// thread-safe and calls to this class must be synchronized with the graph
-// processing.
+// Node that sets the |AudioBuffer| of a source. Optionally, the node accepts
+// input buffers of arbitrary size at a source sample rate which differs from
+// the system sample rate, and re-blocks and resamples them to
+// |frames_per_buffer| sized buffers during graph processing. This class is
+// *not* thread-safe and calls to this class must be synchronized with the
+// graph processing.
 class BufferedSourceNode : public SourceNode {
  public:
   // Constructor.
@@ -42,10 +49,85 @@ class BufferedSourceNode : public SourceNode {
   // @return Mutable audio buffer pointer.
   AudioBuffer* GetMutableAudioBufferAndSetNewBufferFlag();
 
+  // Sets the sample rate of the input buffers. If it differs from the system
+  // sample rate, input buffers must be passed via |AddSourceRateBuffer| and
+  // are resampled by the node, which adds a latency of |frames_per_buffer|
+  // frames. The resampling stage is allocated on the first call with a
+  // differing sample rate and reconfigured in place afterwards, such that
+  // frames resampled at the previous sample rate are still output. Calls to
+  // this method must be synchronized with the audio graph processing.
+  //
+  // @param source_sample_rate_hz Sample rate of the input buffers.
+  // @param system_sample_rate_hz System sample rate.
+  void SetSampleRate(int source_sample_rate_hz, int system_sample_rate_hz);
+
+  // Returns true if input buffers are resampled to the system sample rate.
+  bool IsResampling() const { return is_resampling_; }
+
+  // Returns true if the node has output an input buffer in the most recent
+  // graph processing iteration.
+  bool HasOutput() const { return has_output_; }
+
+  // Adds an interleaved or planar, float or int16 input buffer of arbitrary
+  // size at the source sample rate, which is resampled right away. Mono input
+  // is copied to both channels of a stereo source and excess input channels
+  // are dropped, so the number of input channels may change between calls.
+  // Must only be called if |IsResampling| returns true. Calls to this method
+  // must be synchronized with the audio graph processing.
+  //
+  // @param buffer Input buffer.
+  // @param num_channels Number of channels in input buffer.
+  // @param num_frames Number of frames in input buffer.
+  void AddSourceRateBuffer(const float* buffer, size_t num_channels,
+                           size_t num_frames);
+  void AddSourceRateBuffer(const int16* buffer, size_t num_channels,
+                           size_t num_frames);
+  void AddSourceRateBuffer(const float* const* buffer, size_t num_channels,
+                           size_t num_frames);
+  void AddSourceRateBuffer(const int16* const* buffer, size_t num_channels,
+                           size_t num_frames);
+
  protected:
   // Implements SourceNode.
   const AudioBuffer* AudioProcess() override;
 
+  // Resampling state of a source whose sample rate differs from the system
+  // sample rate. All buffers are sized for the number of source channels and
+  // independently of the sample rates, so that the stage can be reconfigured
+  // without allocations.
+  struct ResamplingStage {
+    ResamplingStage(size_t num_channels, size_t frames_per_buffer);
+
+    // Resamples the input frames to the system sample rate.
+    Resampler resampler;
+
+    // Input frames at the source sample rate, mapped to the source channels.
+    AudioBuffer input_frames;
+
+    // Maximum number of |input_frames| resampled at once, such that the
+    // output fits into |resampled_block|.
+    size_t max_frames_per_input_block;
+
+    // Output of |resampler| for a single block of |input_frames|.
+    AudioBuffer resampled_block;
+
+    // Resampled frames which have not been output yet.
+    AudioBuffer resampled_frames;
+
+    // Number of valid frames in |resampled_frames|.
+    size_t num_resampled_frames;
+  };
+
+  // Templated implementation of |AddSourceRateBuffer|.
+  template <typename BufferType>
+  void AddSourceRateBufferTemplated(BufferType buffer, size_t num_channels,
+                                    size_t num_frames);
+
+  // Copies the next resampled output buffer into |input_audio_buffer_|.
+  //
+  // @return True if a complete output buffer was available.
+  bool ProcessResamplingStage();
+
   // Source id.
   const SourceId source_id_;
 
@@ -55,6 +137,22 @@ class BufferedSourceNode : public SourceNode {
   // Flag indicating if an new audio buffer has been set via
   // |GetMutableAudioBufferAndSetNewBufferFlag|.
   bool new_buffer_flag_;
+
+  // Flag indicating if the most recent |AudioProcess| call output a buffer.
+  bool has_output_;
+
+  // Sample rate of the input buffers.
+  int source_sample_rate_hz_;
+
+  // System sample rate.
+  int system_sample_rate_hz_;
+
+  // True if input buffers are resampled by |resampling_stage_|.
+  bool is_resampling_;
+
+  // Resampling stage, only allocated once the source sample rate differs from
+  // the system sample rate.
+  std::unique_ptr<ResamplingStage> resampling_stage_;
 };
 
 }  // namespace vraudio
@@ -0,0 +1,254 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include "graph/buffered_source_node.h"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+#include "base/audio_buffer.h"
+#include "base/constants_and_types.h"
+#include "dsp/resampler.h"
+#include "node/sink_node.h"
+
+namespace vraudio {
+
+namespace {
+
+const size_t kFramesPerBuffer = 256;
+const int kSystemSampleRate = 48000;
+const SourceId kSourceId = 1;
+const float kToneFrequency = 1000.0f;
+
+// Maximum deviation of the node output from the reference resampled signal.
+const float kEpsilon = 1e-5f;
+
+// Generates |num_frames| frames of a unit sine wave starting at frame
+// |start_frame|.
+std::vector<float> GenerateSineFrames(size_t start_frame, size_t num_frames,
+                                      int sample_rate_hz) {
+  std::vector<float> frames(num_frames);
+  for (size_t frame = 0; frame < num_frames; ++frame) {
+    frames[frame] = std::sin(kTwoPi * kToneFrequency *
+                             static_cast<float>(start_frame + frame) /
+                             static_cast<float>(sample_rate_hz));
+  }
+  return frames;
+}
+
+// Resamples |input| at once with the reference |resampler| and appends the
+// output to |output|.
+void AppendReferenceOutput(const AudioBuffer& input, Resampler* resampler,
+                           std::vector<std::vector<float>>* output) {
+  AudioBuffer resampled(input.num_channels(),
+                        resampler->GetNextOutputLength(input.num_frames()));
+  resampler->Process(input, &resampled);
+  for (size_t channel = 0; channel < input.num_channels(); ++channel) {
+    (*output)[channel].insert((*output)[channel].end(),
+                              resampled[channel].begin(),
+                              resampled[channel].end());
+  }
+}
+
+// Processes the graph once and appends the output of |sink_node| to |output|.
+void AppendNodeOutput(SinkNode* sink_node,
+                      std::vector<std::vector<float>>* output) {
+  const auto& output_buffers = sink_node->ReadInputs();
+  ASSERT_EQ(1U, output_buffers.size());
+  const AudioBuffer& buffer = *output_buffers[0];
+  EXPECT_EQ(kSourceId, buffer.source_id());
+  ASSERT_EQ(output->size(), buffer.num_channels());
+  ASSERT_EQ(kFramesPerBuffer, buffer.num_frames());
+  for (size_t channel = 0; channel < buffer.num_channels(); ++channel) {
+    (*output)[channel].insert((*output)[channel].end(),
+                              buffer[channel].begin(), buffer[channel].end());
+  }
+}
+
+// Expects the node output to match the reference output, delayed by the
+// latency of one buffer.
+void ExpectOutputMatchesReference(
+    const std::vector<std::vector<float>>& node_output,
+    const std::vector<std::vector<float>>& reference_output) {
+  ASSERT_EQ(reference_output.size(), node_output.size());
+  for (size_t channel = 0; channel < node_output.size(); ++channel) {
+    const auto& node_channel = node_output[channel];
+    const auto& reference_channel = reference_output[channel];
+    ASSERT_GE(reference_channel.size() + kFramesPerBuffer, node_channel.size());
+    for (size_t frame = 0; frame < node_channel.size(); ++frame) {
+      const float expected = frame < kFramesPerBuffer
+                                 ? 0.0f
+                                 : reference_channel[frame - kFramesPerBuffer];
+      ASSERT_NEAR(expected, node_channel[frame], kEpsilon)
+          << "channel " << channel << " frame " << frame;
+    }
+  }
+}
+
+// Tests that a source at the system sample rate only outputs buffers that have
+// been set.
+TEST(BufferedSourceNodeTest, NewBufferFlagTest) {
+  auto source_node = std::make_shared<BufferedSourceNode>(
+      kSourceId, kNumMonoChannels, kFramesPerBuffer);
+  auto sink_node = std::make_shared<SinkNode>();
+  sink_node->Connect(source_node);
+
+  EXPECT_FALSE(source_node->IsResampling());
+  EXPECT_TRUE(sink_node->ReadInputs().empty());
+  source_node->GetMutableAudioBufferAndSetNewBufferFlag();
+  EXPECT_EQ(1U, sink_node->ReadInputs().size());
+  EXPECT_TRUE(sink_node->ReadInputs().empty());
+
+  // Setting the system sample rate does not enable resampling.
+  source_node->SetSampleRate(kSystemSampleRate, kSystemSampleRate);
+  EXPECT_FALSE(source_node->IsResampling());
+}
+
+// Tests that input buffers whose number of frames varies are resampled to the
+// system sample rate exactly like the whole input stream, for rational as well
+// as arbitrary-ratio sample rates.
+TEST(BufferedSourceNodeTest, ResamplingTest) {
+  const int kSourceSampleRates[] = {22050, 24000, 44100, 44101, 96000};
+  const size_t kNumBuffers = 64;
+  for (const int source_sample_rate : kSourceSampleRates) {
+    auto source_node = std::make_shared<BufferedSourceNode>(
+        kSourceId, kNumMonoChannels, kFramesPerBuffer);
+    auto sink_node = std::make_shared<SinkNode>();
+    sink_node->Connect(source_node);
+    source_node->SetSampleRate(source_sample_rate, kSystemSampleRate);
+    EXPECT_TRUE(source_node->IsResampling());
+
+    Resampler reference_resampler;
+    reference_resampler.SetRateAndNumChannels(
+        source_sample_rate, kSystemSampleRate, kNumMonoChannels);
+    std::vector<std::vector<float>> node_output(kNumMonoChannels);
+    std::vector<std::vector<float>> reference_output(kNumMonoChannels);
+    size_t num_input_frames = 0;
+    for (size_t buffer = 0; buffer < kNumBuffers; ++buffer) {
+      // Pass the number of source frames covering the next output buffer,
+      // with a jitter of a third of a buffer.
+      const size_t jitter = (buffer % 2 == 0) ? 0 : kFramesPerBuffer / 3;
+      const size_t next_num_input_frames =
+          ((buffer + 1) * kFramesPerBuffer - jitter) * source_sample_rate /
+          kSystemSampleRate;
+      AudioBuffer input(kNumMonoChannels,
+                        next_num_input_frames - num_input_frames);
+      input[0] = GenerateSineFrames(num_input_frames, input.num_frames(),
+                                    source_sample_rate);
+      num_input_frames = next_num_input_frames;
+      source_node->AddSourceRateBuffer(input[0].begin(), kNumMonoChannels,
+                                       input.num_frames());
+      AppendReferenceOutput(input, &reference_resampler, &reference_output);
+      AppendNodeOutput(sink_node.get(), &node_output);
+    }
+    ExpectOutputMatchesReference(node_output, reference_output);
+  }
+}
+
+// Tests that changing the source sample rate keeps the frames which have been
+// resampled at the previous sample rate.
+TEST(BufferedSourceNodeTest, SampleRateChangeTest) {
+  const int kSourceSampleRates[] = {44100, 32000, 44101, 96000};
+  auto source_node = std::make_shared<BufferedSourceNode>(
+      kSourceId, kNumMonoChannels, kFramesPerBuffer);
+  auto sink_node = std::make_shared<SinkNode>();
+  sink_node->Connect(source_node);
+
+  Resampler reference_resampler;
+  std::vector<std::vector<float>> node_output(kNumMonoChannels);
+  std::vector<std::vector<float>> reference_output(kNumMonoChannels);
+  for (const int source_sample_rate : kSourceSampleRates) {
+    source_node->SetSampleRate(source_sample_rate, kSystemSampleRate);
+    reference_resampler.SetRateAndNumChannels(
+        source_sample_rate, kSystemSampleRate, kNumMonoChannels);
+    // Pass one and a half buffers, such that resampled frames are pending when
+    // the sample rate changes.
+    AudioBuffer input(kNumMonoChannels, 3 * kFramesPerBuffer *
+                                            source_sample_rate /
+                                            (2 * kSystemSampleRate));
+    input[0] = GenerateSineFrames(0, input.num_frames(), source_sample_rate);
+    source_node->AddSourceRateBuffer(input[0].begin(), kNumMonoChannels,
+                                     input.num_frames());
+    AppendReferenceOutput(input, &reference_resampler, &reference_output);
+    AppendNodeOutput(sink_node.get(), &node_output);
+  }
+  ExpectOutputMatchesReference(node_output, reference_output);
+
+  // Switching to the system sample rate bypasses the resampling stage.
+  source_node->SetSampleRate(kSystemSampleRate, kSystemSampleRate);
+  EXPECT_FALSE(source_node->IsResampling());
+  EXPECT_TRUE(sink_node->ReadInputs().empty());
+}
+
+// Tests that input buffers with a varying number of channels are mapped to the
+// source channels without interrupting the resampled stream. Mono input is
+// copied to both channels of a stereo source and excess input channels are
+// dropped.
+TEST(BufferedSourceNodeTest, ChannelMappingTest) {
+  const int kSourceSampleRate = 44100;
+  const size_t kNumInputFrames = kFramesPerBuffer;
+  const size_t kNumInputChannels[] = {kNumStereoChannels, kNumMonoChannels,
+                                      kNumFirstOrderAmbisonicChannels,
+                                      kNumStereoChannels};
+  auto source_node = std::make_shared<BufferedSourceNode>(
+      kSourceId, kNumStereoChannels, kFramesPerBuffer);
+  auto sink_node = std::make_shared<SinkNode>();
+  sink_node->Connect(source_node);
+  source_node->SetSampleRate(kSourceSampleRate, kSystemSampleRate);
+
+  Resampler reference_resampler;
+  reference_resampler.SetRateAndNumChannels(
+      kSourceSampleRate, kSystemSampleRate, kNumStereoChannels);
+  std::vector<std::vector<float>> node_output(kNumStereoChannels);
+  std::vector<std::vector<float>> reference_output(kNumStereoChannels);
+  size_t start_frame = 0;
+  for (const size_t num_input_channels : kNumInputChannels) {
+    // Each input channel holds the sine wave scaled by its channel number.
+    const std::vector<float> sine =
+        GenerateSineFrames(start_frame, kNumInputFrames, kSourceSampleRate);
+    start_frame += kNumInputFrames;
+    std::vector<float> interleaved_input(num_input_channels * kNumInputFrames);
+    for (size_t frame = 0; frame < kNumInputFrames; ++frame) {
+      for (size_t channel = 0; channel < num_input_channels; ++channel) {
+        interleaved_input[frame * num_input_channels + channel] =
+            static_cast<float>(channel + 1) * sine[frame];
+      }
+    }
+    source_node->AddSourceRateBuffer(interleaved_input.data(),
+                                     num_input_channels, kNumInputFrames);
+
+    AudioBuffer mapped_input(kNumStereoChannels, kNumInputFrames);
+    for (size_t channel = 0; channel < kNumStereoChannels; ++channel) {
+      const float gain = num_input_channels == kNumMonoChannels
+                             ? 1.0f
+                             : static_cast<float>(channel + 1);
+      for (size_t frame = 0; frame < kNumInputFrames; ++frame) {
+        mapped_input[channel][frame] = gain * sine[frame];
+      }
+    }
+    AppendReferenceOutput(mapped_input, &reference_resampler,
+                          &reference_output);
+    AppendNodeOutput(sink_node.get(), &node_output);
+  }
+  ExpectOutputMatchesReference(node_output, reference_output);
+}
+
+}  // namespace
+
+}  // namespace vraudio
@@ -16,9 +16,14 @@ limitations under the License.
 
 #include "graph/gain_mixer_node.h"
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 #include "base/constants_and_types.h"
+#include "base/logging.h"
+#include "dsp/distance_attenuation.h"
+#include "dsp/gain.h"
 
 
 namespace vraudio {
@@ -26,17 +31,33 @@ namespace vraudio {
 GainMixerNode::GainMixerNode(const AttenuationType& attenuation_type,
                              const SystemSettings& system_settings,
                              size_t num_channels)
+    : GainMixerNode(attenuation_type, system_settings, num_channels,
+                    kInvalidRoomZoneId) {}
+
+GainMixerNode::GainMixerNode(const AttenuationType& attenuation_type,
+                             const SystemSettings& system_settings,
+                             size_t num_channels, RoomZoneId room_zone_id)
     : mute_enabled_(false),
+      marked_for_removal_(false),
       attenuation_type_(attenuation_type),
+      room_zone_id_(room_zone_id),
+      num_ramp_down_frames_(0),
       gain_mixer_(num_channels, system_settings.GetFramesPerBuffer()),
-      system_settings_(system_settings) {}
+      gains_(num_channels),
+      system_settings_(system_settings) {
+  DCHECK(room_zone_id_ == kInvalidRoomZoneId ||
+         attenuation_type_ == AttenuationType::kReflections ||
+         attenuation_type_ == AttenuationType::kReverb);
+}
 
 void GainMixerNode::SetMute(bool mute_enabled) { mute_enabled_ = mute_enabled; }
 
+void GainMixerNode::MarkForRemoval() { marked_for_removal_ = true; }
+
 bool GainMixerNode::CleanUp() {
   CallCleanUpOnInputNodes();
   // Prevent node from being disconnected when all sources are removed.
-  return false;
+  return marked_for_removal_;
 }
 
 const AudioBuffer* GainMixerNode::AudioProcess(const NodeInput& input) {
@@ -47,20 +68,61 @@ const AudioBuffer* GainMixerNode::AudioProcess(const NodeInput& input) {
     return nullptr;
   }
 
+  if (room_zone_id_ != kInvalidRoomZoneId) {
+    const float max_target_gain = GetMaxTargetGain(input);
+    if (!IsGainNearZero(max_target_gain)) {
+      // Gains are ramped by |kUnitRampLength| frames per unit of change.
+      num_ramp_down_frames_ = static_cast<size_t>(std::ceil(
+          max_target_gain * static_cast<float>(kUnitRampLength)));
+    } else if (num_ramp_down_frames_ > 0) {
+      // Keep processing until the gains of the last senders are ramped down.
+      num_ramp_down_frames_ -= std::min(num_ramp_down_frames_,
+                                        system_settings_.GetFramesPerBuffer());
+    } else {
+      // Skip processing while no input is sending into the room zone.
+      return nullptr;
+    }
+  }
+
   // Apply the gain to each input buffer channel.
   gain_mixer_.Reset();
   for (auto input_buffer : input.GetInputBuffers()) {
     const auto source_parameters =
         system_settings_.GetSourceParameters(input_buffer->source_id());
     if (source_parameters != nullptr) {
-      const float target_gain =
-          source_parameters->attenuations[attenuation_type_];
+      const float target_gain = GetTargetGain(*source_parameters);
       const size_t num_channels = input_buffer->num_channels();
-      gain_mixer_.AddInput(*input_buffer,
-                           std::vector<float>(num_channels, target_gain));
+      gains_.assign(num_channels, target_gain);
+      gain_mixer_.AddInput(*input_buffer, gains_);
     }
   }
   return gain_mixer_.GetOutput();
 }
 
+float GainMixerNode::GetTargetGain(
+    const SourceParameters& source_parameters) const {
+  if (room_zone_id_ == kInvalidRoomZoneId) {
+    return source_parameters.attenuations[attenuation_type_];
+  }
+  const float room_zone_gain =
+      attenuation_type_ == AttenuationType::kReflections
+          ? system_settings_.GetRoomZoneReflectionProperties(room_zone_id_).gain
+          : system_settings_.GetRoomZoneReverbProperties(room_zone_id_).gain;
+  return ComputeRoomZoneAttenuation(attenuation_type_, room_zone_gain,
+                                    room_zone_id_, source_parameters);
+}
+
+float GainMixerNode::GetMaxTargetGain(const NodeInput& input) const {
+  float max_target_gain = 0.0f;
+  for (auto input_buffer : input.GetInputBuffers()) {
+    const auto source_parameters =
+        system_settings_.GetSourceParameters(input_buffer->source_id());
+    if (source_parameters != nullptr) {
+      max_target_gain = std::max(max_target_gain,
+                                 std::abs(GetTargetGain(*source_parameters)));
+    }
+  }
+  return max_target_gain;
+}
+
 }  // namespace vraudio
@@ -17,6 +17,8 @@ limitations under the License.
 #ifndef RESONANCE_AUDIO_GRAPH_GAIN_MIXER_NODE_H_
 #define RESONANCE_AUDIO_GRAPH_GAIN_MIXER_NODE_H_
 
+#include <vector>
+
 #include "base/audio_buffer.h"
 #include "base/source_parameters.h"
 #include "dsp/gain_mixer.h"
@@ -38,10 +40,27 @@ class GainMixerNode : public ProcessingNode {
   GainMixerNode(const AttenuationType& attenuation_type,
                 const SystemSettings& system_settings, size_t num_channels);
 
+  // Constructs |GainMixerNode| which accumulates the sends into a room zone.
+  // The gains are calculated with |ComputeRoomZoneAttenuation| from the
+  // properties of the room zone, and the processing is skipped while no input
+  // is sending into the zone.
+  //
+  // @param attenuation_type Either |kReflections| or |kReverb|.
+  // @param system_settings Global system settings.
+  // @param num_channels Number of channels.
+  // @param room_zone_id Id of room zone.
+  GainMixerNode(const AttenuationType& attenuation_type,
+                const SystemSettings& system_settings, size_t num_channels,
+                RoomZoneId room_zone_id);
+
   // Mute the mixer node by skipping the audio processing and outputting nullptr
   // buffers.
   void SetMute(bool mute_enabled);
 
+  // Allows the node to be disconnected from its output on the next |CleanUp|
+  // call, e.g. once the room zone it belongs to has been destroyed.
+  void MarkForRemoval();
+
   // Node implementation.
   bool CleanUp() final;
 
@@ -50,15 +69,42 @@ class GainMixerNode : public ProcessingNode {
   const AudioBuffer* AudioProcess(const NodeInput& input) override;
 
  private:
+  // Returns the target gain of an input.
+  //
+  // @param source_parameters Parameters of the input source.
+  // @return Target gain.
+  float GetTargetGain(const SourceParameters& source_parameters) const;
+
+  // Returns the maximum absolute target gain of all inputs.
+  //
+  // @param input Node input.
+  // @return Maximum absolute target gain.
+  float GetMaxTargetGain(const NodeInput& input) const;
+
   // Flag indicating the mute status.
   bool mute_enabled_;
 
+  // Flag indicating that the node can be disconnected from its output.
+  bool marked_for_removal_;
+
   // Gain attenuation type.
   const AttenuationType attenuation_type_;
 
+  // Id of room zone the inputs are sent into, or |kInvalidRoomZoneId| to apply
+  // the |attenuation_type_| gains only.
+  const RoomZoneId room_zone_id_;
+
+  // Number of frames to keep processing after the last input stopped sending
+  // into the room zone, so that its gain is ramped down before the processing
+  // is skipped.
+  size_t num_ramp_down_frames_;
+
   // Gain mixer.
   GainMixer gain_mixer_;
 
+  // Per channel gains of the current input buffer.
+  std::vector<float> gains_;
+
   // Global system settings.
   const SystemSettings& system_settings_;
 };
@@ -17,6 +17,7 @@ limitations under the License.
 #include "graph/gain_mixer_node.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 
 #include "third_party/googletest/googletest/include/gtest/gtest.h"
@@ -112,6 +113,35 @@ TEST(AudioNodesTest, CleanUpOnEmptyInputTest) {
   EXPECT_FALSE(sink_node_deleted);
 }
 
+// Tests that the |GainMixerNode| gets disconnected once it has been marked for
+// removal.
+TEST(AudioNodesTest, CleanUpOnMarkForRemovalTest) {
+  bool source_node_deleted = false;
+  bool gain_mixer_node_deleted = false;
+  bool sink_node_deleted = false;
+
+  SystemSettings system_settings(kNumMonoChannels, kNumFrames, kSampleRate);
+  auto sink_node = std::make_shared<MySinkNode>(&sink_node_deleted);
+  auto source_node = std::make_shared<MySourceNode>(&source_node_deleted);
+  {
+    auto gain_mixer_node = std::make_shared<MyGainMixerNode>(
+        &gain_mixer_node_deleted, AttenuationType::kReverb, system_settings);
+    sink_node->Connect(gain_mixer_node);
+    gain_mixer_node->Connect(source_node);
+
+    sink_node->CleanUp();
+    EXPECT_FALSE(gain_mixer_node_deleted);
+
+    gain_mixer_node->MarkForRemoval();
+  }
+
+  sink_node->CleanUp();
+
+  EXPECT_FALSE(source_node_deleted);
+  EXPECT_TRUE(gain_mixer_node_deleted);
+  EXPECT_FALSE(sink_node_deleted);
+}
+
 // Provides unit tests for |GainMixerNode|.
 class GainMixerNodeTest : public ::testing::Test {
  protected:
@@ -137,8 +167,19 @@ class GainMixerNodeTest : public ::testing::Test {
     // Tests will use |AttenuationType::kInput| which directly returns the
     // local
     // gain value in order to avoid extra complexity.
-    gain_mixer_node_ = std::make_shared<GainMixerNode>(
-        AttenuationType::kInput, system_settings_, kNumMonoChannels);
+    CreateGraph(num_inputs,
+                std::make_shared<GainMixerNode>(
+                    AttenuationType::kInput, system_settings_,
+                    kNumMonoChannels));
+  }
+
+  // Helper method that generates a node graph with a given mixer node.
+  //
+  // @param num_inputs Number of input buffers to be processed.
+  // @param gain_mixer_node Mixer node to be tested.
+  void CreateGraph(size_t num_inputs,
+                   const std::shared_ptr<GainMixerNode>& gain_mixer_node) {
+    gain_mixer_node_ = gain_mixer_node;
 
     output_node_ = std::make_shared<SinkNode>();
     output_node_->Connect(gain_mixer_node_);
@@ -241,6 +282,62 @@ TEST_F(GainMixerNodeTest, GainTest) {
   }
 }
 
+// Tests that a room zone |GainMixerNode| applies the send gains into the room
+// zone and skips processing while no input is sending into it.
+TEST_F(GainMixerNodeTest, RoomZoneSendGainTest) {
+  const RoomZoneId kRoomZoneId = 2;
+  const float kInputGain = 0.5f;
+  const float kSendGain = 0.25f;
+  const float kReverbGain = 2.0f;
+  const std::vector<std::vector<float>> inputs(
+      {{1.0f, 1.0f, 1.0f, 1.0f}, {2.0f, 2.0f, 2.0f, 2.0f}});
+  ReverbProperties reverb_properties;
+  reverb_properties.gain = kReverbGain;
+  system_settings_.SetRoomZoneReverbProperties(kRoomZoneId, reverb_properties);
+  CreateGraph(inputs.size(), std::make_shared<GainMixerNode>(
+                                 AttenuationType::kReverb, system_settings_,
+                                 kNumMonoChannels, kRoomZoneId));
+  auto parameters_manager = system_settings_.GetSourceParametersManager();
+
+  // No input is sending into the room zone by default.
+  EXPECT_EQ(nullptr, Process(kInputGain, inputs));
+
+  // Only the second input is sending into the room zone.
+  parameters_manager->GetMutableParameters(1)
+      ->room_zone_send_gains[kRoomZoneId] = kSendGain;
+  const AudioBuffer* output = nullptr;
+  for (size_t i = 0; i < kUnitRampLength / 2 + 1; ++i) {
+    output = Process(kInputGain, inputs);
+    ASSERT_NE(nullptr, output);
+  }
+  const float output_value = kInputGain * kSendGain * kReverbGain * inputs[1][0];
+  for (size_t i = 0; i < inputs[0].size(); ++i) {
+    EXPECT_NEAR((*output)[0][i], output_value, kEpsilonFloat);
+  }
+
+  // The gain is ramped down before the processing is skipped.
+  parameters_manager->GetMutableParameters(1)
+      ->room_zone_send_gains[kRoomZoneId] = 0.0f;
+  output = Process(kInputGain, inputs);
+  ASSERT_NE(nullptr, output);
+  EXPECT_NE((*output)[0][0], 0.0f);
+  const float ramp_length_frames = kInputGain * kSendGain * kReverbGain *
+                                   static_cast<float>(kUnitRampLength);
+  const size_t num_ramp_buffers =
+      static_cast<size_t>(std::ceil(ramp_length_frames / kNumFrames));
+  for (size_t i = 1; i < num_ramp_buffers; ++i) {
+    output = Process(kInputGain, inputs);
+    ASSERT_NE(nullptr, output);
+  }
+  // The last processed buffer holds the end of the ramp.
+  const float max_ramp_value =
+      static_cast<float>(kNumFrames) * output_value / ramp_length_frames;
+  for (size_t i = 0; i < inputs[0].size(); ++i) {
+    EXPECT_LE(std::abs((*output)[0][i]), max_ramp_value + kEpsilonFloat);
+  }
+  EXPECT_EQ(nullptr, Process(kInputGain, inputs));
+}
+
 }  // namespace
 
 }  // namespace vraudio
@@ -52,6 +52,16 @@ const AudioBuffer* GainNode::AudioProcess(const NodeInput& input) {
 
   const float current_gain = gain_processors_[0].GetGain();
   const float target_gain = source_parameters->attenuations[attenuation_type_];
+  if (attenuation_type_ == AttenuationType::kDirect &&
+      source_parameters->is_clustered) {
+    // The direct attenuation of clustered sources is applied by the encoder.
+    // Keep the gain processors at the target gain, to continue without a
+    // ramp once the source is no longer clustered.
+    for (size_t i = 0; i < num_channels_; ++i) {
+      gain_processors_[i].Reset(target_gain);
+    }
+    return input_buffer;
+  }
   if (IsGainNearZero(target_gain) && IsGainNearZero(current_gain)) {
     // Make sure the gain processors are initialized.
     for (size_t i = 0; i < num_channels_; ++i) {
@@ -16,6 +16,7 @@ limitations under the License.
 
 #include "graph/graph_manager.h"
 
+#include <algorithm>
 #include <functional>
 
 #include "ambisonics/utils.h"
@@ -27,13 +28,15 @@ limitations under the License.
 #include "graph/mono_from_soundfield_node.h"
 #include "graph/near_field_effect_node.h"
 #include "graph/occlusion_node.h"
+#include "graph/propagation_delay_node.h"
 
 namespace vraudio {
 
-GraphManager::GraphManager(const SystemSettings& system_settings)
+GraphManager::GraphManager(const SystemSettings& system_settings,
+                           int max_ambisonic_order)
     :
       room_effects_enabled_(true),
-      config_(GlobalConfig()),
+      config_(GlobalConfig(max_ambisonic_order)),
       system_settings_(system_settings),
       fft_manager_(system_settings.GetFramesPerBuffer()),
       output_node_(std::make_shared<SinkNode>()) {
@@ -64,8 +67,7 @@ GraphManager::GraphManager(const SystemSettings& system_settings)
   stereo_mixer_node_->Connect(stereo_mixing_panner_node_);
 
   // Initialize room effects graphs.
-  InitializeReflectionsGraph();
-  InitializeReverbGraph();
+  CreateRoomZone(kDefaultRoomZoneId);
   // Initialize ambisonic output mixer.
   ambisonic_output_mixer_.reset(
       new Mixer(GetNumPeriphonicComponents(config_.max_ambisonic_order),
@@ -103,8 +105,7 @@ void GraphManager::CreateAmbisonicSource(SourceId ambisonic_source_id,
   auto mono_from_soundfield_node = std::make_shared<MonoFromSoundfieldNode>(
       ambisonic_source_id, system_settings_);
   mono_from_soundfield_node->Connect(ambisonic_source_node);
-  reflections_gain_mixer_node_->Connect(mono_from_soundfield_node);
-  reverb_gain_mixer_node_->Connect(mono_from_soundfield_node);
+  ConnectToRoomZones(ambisonic_source_id, mono_from_soundfield_node);
 }
 
 void GraphManager::CreateSoundObjectSource(SourceId sound_object_source_id,
@@ -117,13 +118,19 @@ void GraphManager::CreateSoundObjectSource(SourceId sound_object_source_id,
       sound_object_source_id, kNumMonoChannels,
       system_settings_.GetFramesPerBuffer());
   source_nodes_[sound_object_source_id] = sound_object_source_node;
+  // Delay the source by its propagation time, which applies to both the direct
+  // sound and the room effects.
+  auto propagation_delay_node = std::make_shared<PropagationDelayNode>(
+      sound_object_source_id, system_settings_, fractional_delay_table_);
+  propagation_delay_node->Connect(sound_object_source_node);
+  propagation_delay_nodes_[sound_object_source_id] = propagation_delay_node;
 
   // Create direct rendering pipeline.
   if (enable_direct_rendering) {
     auto direct_attenuation_node =
         std::make_shared<GainNode>(sound_object_source_id, kNumMonoChannels,
                                    AttenuationType::kDirect, system_settings_);
-    direct_attenuation_node->Connect(sound_object_source_node);
+    direct_attenuation_node->Connect(propagation_delay_node);
     auto occlusion_node = std::make_shared<OcclusionNode>(
         sound_object_source_id, system_settings_);
     occlusion_node->Connect(direct_attenuation_node);
@@ -131,7 +138,11 @@ void GraphManager::CreateSoundObjectSource(SourceId sound_object_source_id,
         sound_object_source_id, system_settings_);
 
     if (enable_hrtf) {
-      ambisonic_mixing_encoder_nodes_[ambisonic_order]->Connect(occlusion_node);
+      // Sound objects above the maximum order are encoded at the maximum order.
+      const auto& encoder_node = ambisonic_mixing_encoder_nodes_[std::min(
+          ambisonic_order, config_.max_ambisonic_order)];
+      encoder_node->Connect(occlusion_node);
+      source_encoder_nodes_[sound_object_source_id] = encoder_node;
     } else {
       stereo_mixing_panner_node_->Connect(occlusion_node);
     }
@@ -141,14 +152,54 @@ void GraphManager::CreateSoundObjectSource(SourceId sound_object_source_id,
   }
 
   // Connect to room effects rendering pipeline.
-  reflections_gain_mixer_node_->Connect(sound_object_source_node);
-  reverb_gain_mixer_node_->Connect(sound_object_source_node);
+  ConnectToRoomZones(sound_object_source_id, propagation_delay_node);
+}
+
+void GraphManager::CreateRoomZone(RoomZoneId room_zone_id) {
+  DCHECK(room_zones_.find(room_zone_id) == room_zones_.end());
+  RoomZone* room_zone = &room_zones_[room_zone_id];
+  InitializeReflectionsGraph(room_zone_id, room_zone);
+  InitializeReverbGraph(room_zone_id, room_zone);
+  room_zone->reflections_gain_mixer_node->SetMute(!room_effects_enabled_);
+  room_zone->reverb_gain_mixer_node->SetMute(!room_effects_enabled_);
+  for (const auto& input_node_itr : room_effects_input_nodes_) {
+    room_zone->reflections_gain_mixer_node->Connect(input_node_itr.second);
+    room_zone->reverb_gain_mixer_node->Connect(input_node_itr.second);
+  }
+}
+
+void GraphManager::DestroyRoomZone(RoomZoneId room_zone_id) {
+  auto room_zone_itr = room_zones_.find(room_zone_id);
+  if (room_zone_itr == room_zones_.end()) {
+    LOG(WARNING) << "Room zone " << room_zone_id << " not found";
+    return;
+  }
+  // Disconnect the room effects subgraphs from the graph.
+  room_zone_itr->second.reflections_gain_mixer_node->MarkForRemoval();
+  room_zone_itr->second.reverb_gain_mixer_node->MarkForRemoval();
+  output_node_->CleanUp();
+  room_zones_.erase(room_zone_itr);
+}
+
+void GraphManager::ResetRoomZones() {
+  std::vector<RoomZoneId> room_zone_ids;
+  for (const auto& room_zone_itr : room_zones_) {
+    room_zone_ids.push_back(room_zone_itr.first);
+  }
+  for (const RoomZoneId room_zone_id : room_zone_ids) {
+    DestroyRoomZone(room_zone_id);
+    CreateRoomZone(room_zone_id);
+  }
 }
 
 void GraphManager::EnableRoomEffects(bool enable) {
   room_effects_enabled_ = enable;
-  reflections_gain_mixer_node_->SetMute(!room_effects_enabled_);
-  reverb_gain_mixer_node_->SetMute(!room_effects_enabled_);
+  for (auto& room_zone_itr : room_zones_) {
+    room_zone_itr.second.reflections_gain_mixer_node->SetMute(
+        !room_effects_enabled_);
+    room_zone_itr.second.reverb_gain_mixer_node->SetMute(
+        !room_effects_enabled_);
+  }
 }
 
 const AudioBuffer* GraphManager::GetAmbisonicBuffer() const {
@@ -171,30 +222,94 @@ size_t GraphManager::GetNumMaxAmbisonicChannels() const {
   return GetNumPeriphonicComponents(config_.max_ambisonic_order);
 }
 
+size_t GraphManager::GetNumRenderedAmbisonicChannels(
+    size_t num_channels) const {
+  // Not every order up to the maximum has SH-HRIRs, e.g. the 4th and 6th order
+  // inputs are rendered at the 3rd and 5th order respectively.
+  int ambisonic_order = std::min(GetPeriphonicAmbisonicOrder(num_channels),
+                                 config_.max_ambisonic_order);
+  while (ambisonic_order > 1 && ambisonic_mixer_nodes_.find(ambisonic_order) ==
+                                    ambisonic_mixer_nodes_.end()) {
+    --ambisonic_order;
+  }
+  return GetNumPeriphonicComponents(ambisonic_order);
+}
+
 bool GraphManager::GetRoomEffectsEnabled() const {
   return room_effects_enabled_;
 }
 
-void GraphManager::UpdateRoomReflections() { reflections_node_->Update(); }
+void GraphManager::UpdateRoomReflections() {
+  for (auto& room_zone_itr : room_zones_) {
+    for (auto& reflections_node : room_zone_itr.second.reflections_nodes) {
+      if (reflections_node != nullptr) {
+        reflections_node->Update();
+      }
+    }
+  }
+}
 
-void GraphManager::UpdateRoomReverb() { reverb_node_->Update(); }
+void GraphManager::UpdateRoomReverb() {
+  for (auto& room_zone_itr : room_zones_) {
+    room_zone_itr.second.reverb_node->Update();
+  }
+}
 
-void GraphManager::InitializeReverbGraph() {
-  reverb_gain_mixer_node_ = std::make_shared<GainMixerNode>(
-      AttenuationType::kReverb, system_settings_, kNumMonoChannels);
-  reverb_node_ = std::make_shared<ReverbNode>(system_settings_, &fft_manager_);
-  reverb_node_->Connect(reverb_gain_mixer_node_);
-  stereo_mixer_node_->Connect(reverb_node_);
+void GraphManager::InitializeReverbGraph(RoomZoneId room_zone_id,
+                                         RoomZone* room_zone) {
+  room_zone->reverb_gain_mixer_node = std::make_shared<GainMixerNode>(
+      AttenuationType::kReverb, system_settings_, kNumMonoChannels,
+      room_zone_id);
+  room_zone->reverb_node = std::make_shared<ReverbNode>(
+      system_settings_, &fft_manager_, room_zone_id);
+  room_zone->reverb_node->Connect(room_zone->reverb_gain_mixer_node);
+  stereo_mixer_node_->Connect(room_zone->reverb_node);
 }
 
-void GraphManager::InitializeReflectionsGraph() {
-  reflections_gain_mixer_node_ = std::make_shared<GainMixerNode>(
-      AttenuationType::kReflections, system_settings_, kNumMonoChannels);
-  reflections_node_ = std::make_shared<ReflectionsNode>(system_settings_);
-  reflections_node_->Connect(reflections_gain_mixer_node_);
-  // Reflections are limited to First Order Ambisonics to reduce complexity.
-  const int kAmbisonicOrder1 = 1;
-  ambisonic_mixer_nodes_[kAmbisonicOrder1]->Connect(reflections_node_);
+void GraphManager::InitializeReflectionsGraph(RoomZoneId room_zone_id,
+                                              RoomZone* room_zone) {
+  room_zone->reflections_gain_mixer_node = std::make_shared<GainMixerNode>(
+      AttenuationType::kReflections, system_settings_, kNumMonoChannels,
+      room_zone_id);
+  room_zone->reflections_nodes.resize(GetMaxReflectionOrder());
+  CreateReflectionsNode(room_zone_id, room_zone);
+}
+
+int GraphManager::GetMaxReflectionOrder() const {
+  // Reflections are encoded at the ambisonic order of their image sources.
+  return std::min(kMaxReflectionOrder, config_.max_ambisonic_order);
+}
+
+void GraphManager::CreateReflectionsNode(RoomZoneId room_zone_id,
+                                         RoomZone* room_zone) {
+  const int max_reflection_order = GetMaxReflectionOrder();
+  const int reflection_order = std::min(
+      std::max(system_settings_.GetRoomZoneReflectionProperties(room_zone_id)
+                   .reflection_order,
+               1),
+      max_reflection_order);
+  auto& reflections_node = room_zone->reflections_nodes[reflection_order - 1];
+  if (reflections_node != nullptr) {
+    return;
+  }
+  reflections_node = std::make_shared<ReflectionsNode>(
+      system_settings_, *lookup_table_, room_zone_id, reflection_order,
+      max_reflection_order);
+  reflections_node->Connect(room_zone->reflections_gain_mixer_node);
+  ambisonic_mixer_nodes_[reflection_order]->Connect(reflections_node);
+}
+
+void GraphManager::ConnectToRoomZones(
+    SourceId source_id,
+    const std::shared_ptr<ProcessingNode::PublisherNodeType>&
+        room_effects_input_node) {
+  room_effects_input_nodes_[source_id] = room_effects_input_node;
+  for (auto& room_zone_itr : room_zones_) {
+    room_zone_itr.second.reflections_gain_mixer_node->Connect(
+        room_effects_input_node);
+    room_zone_itr.second.reverb_gain_mixer_node->Connect(
+        room_effects_input_node);
+  }
 }
 
 void GraphManager::CreateAmbisonicPannerSource(SourceId sound_object_source_id,
@@ -238,6 +353,13 @@ void GraphManager::DestroySource(SourceId source_id) {
     output_node_->CleanUp();
     // Unregister the source from |source_nodes_|.
     source_nodes_.erase(source_id);
+    room_effects_input_nodes_.erase(source_id);
+    propagation_delay_nodes_.erase(source_id);
+    auto encoder_node_itr = source_encoder_nodes_.find(source_id);
+    if (encoder_node_itr != source_encoder_nodes_.end()) {
+      encoder_node_itr->second->RemoveClusteredSource(source_id);
+      source_encoder_nodes_.erase(encoder_node_itr);
+    }
   }
 }
 
@@ -248,6 +370,16 @@ void GraphManager::Process() {
   output_node_->ReadInputs();
 }
 
+size_t GraphManager::GetNumActiveSources() const {
+  size_t num_active_sources = 0;
+  for (const auto& source_node : source_nodes_) {
+    if (source_node.second->HasOutput()) {
+      ++num_active_sources;
+    }
+  }
+  return num_active_sources;
+}
+
 AudioBuffer* GraphManager::GetMutableAudioBuffer(SourceId source_id) {
   auto source_node = LookupSourceNode(source_id);
   if (source_node == nullptr) {
@@ -256,6 +388,47 @@ AudioBuffer* GraphManager::GetMutableAudioBuffer(SourceId source_id) {
   return source_node->GetMutableAudioBufferAndSetNewBufferFlag();
 }
 
+void GraphManager::SetSourceSampleRate(SourceId source_id, int sample_rate_hz) {
+  auto source_node = LookupSourceNode(source_id);
+  if (source_node == nullptr) {
+    return;
+  }
+  source_node->SetSampleRate(sample_rate_hz,
+                             system_settings_.GetSampleRateHz());
+}
+
+BufferedSourceNode* GraphManager::GetResamplingSourceNode(SourceId source_id) {
+  auto source_node_itr = source_nodes_.find(source_id);
+  if (source_node_itr == source_nodes_.end() ||
+      !source_node_itr->second->IsResampling()) {
+    return nullptr;
+  }
+  return source_node_itr->second.get();
+}
+
+void GraphManager::AllocateSourcePropagationDelay(SourceId source_id) {
+  auto node_itr = propagation_delay_nodes_.find(source_id);
+  if (node_itr != propagation_delay_nodes_.end()) {
+    node_itr->second->AllocateDelayLine();
+  }
+}
+
+bool GraphManager::AllocateSourceClustering(SourceId source_id) {
+  auto node_itr = source_encoder_nodes_.find(source_id);
+  if (node_itr == source_encoder_nodes_.end()) {
+    return false;
+  }
+  node_itr->second->AddClusteredSource(source_id);
+  return true;
+}
+
+void GraphManager::AllocateRoomZoneReflections(RoomZoneId room_zone_id) {
+  auto room_zone_itr = room_zones_.find(room_zone_id);
+  if (room_zone_itr != room_zones_.end()) {
+    CreateReflectionsNode(room_zone_id, &room_zone_itr->second);
+  }
+}
+
 void GraphManager::InitializeAmbisonicRendererGraph(
     int ambisonic_order, const std::string& sh_hrir_filename) {
   CHECK_LE(ambisonic_order, config_.max_ambisonic_order);
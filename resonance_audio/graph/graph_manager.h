@@ -20,18 +20,21 @@ limitations under the License.
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "ambisonics/ambisonic_lookup_table.h"
 #include "base/audio_buffer.h"
 #include "base/constants_and_types.h"
 #include "config/global_config.h"
 #include "dsp/fft_manager.h"
+#include "dsp/fractional_delay_table.h"
 #include "dsp/resampler.h"
 #include "graph/ambisonic_binaural_decoder_node.h"
 #include "graph/ambisonic_mixing_encoder_node.h"
 #include "graph/buffered_source_node.h"
 #include "graph/gain_mixer_node.h"
 #include "graph/mixer_node.h"
+#include "graph/propagation_delay_node.h"
 #include "graph/reflections_node.h"
 #include "graph/reverb_node.h"
 #include "graph/stereo_mixing_panner_node.h"
@@ -48,7 +51,10 @@ class GraphManager {
   // Initializes GraphManager class.
   //
   // @param system_settings Global system configuration.
-  explicit GraphManager(const SystemSettings& system_settings);
+  // @param max_ambisonic_order Maximum Ambisonic order to be rendered, see
+  //     |GlobalConfig|. Sound objects of higher orders are rendered at the
+  //     maximum order.
+  GraphManager(const SystemSettings& system_settings, int max_ambisonic_order);
 
   // Returns the sink node the audio graph is connected to.
   //
@@ -58,6 +64,13 @@ class GraphManager {
   // Triggers processing of the audio graph for all the connected nodes.
   void Process();
 
+  // Returns the number of sources which produced an input buffer in the most
+  // recent |Process| call. Sources without input in that buffer, e.g. paused
+  // or not yet started sources, are not counted.
+  //
+  // @return Number of active sources.
+  size_t GetNumActiveSources() const;
+
   // Returns a mutable pointer to the |AudioBuffer| of an audio source with
   // given |source_id|. Calls to this method must be synchronized with the audio
   // graph processing.
@@ -66,6 +79,49 @@ class GraphManager {
   // @return Mutable audio buffer pointer. Nullptr if source_id not found.
   AudioBuffer* GetMutableAudioBuffer(SourceId source_id);
 
+  // Sets the sample rate of the input buffers of an audio source with given
+  // |source_id|, see |BufferedSourceNode::SetSampleRate|. Calls to this method
+  // must be synchronized with the audio graph processing.
+  //
+  // @param source_id Source id.
+  // @param sample_rate_hz Sample rate of the input buffers.
+  void SetSourceSampleRate(SourceId source_id, int sample_rate_hz);
+
+  // Returns the source node of an audio source with given |source_id| whose
+  // input buffers are resampled to the system sample rate. Calls to this
+  // method must be synchronized with the audio graph processing.
+  //
+  // @param source_id Source id.
+  // @return Source node, nullptr if |source_id| is not found or the source is
+  //     not resampled.
+  BufferedSourceNode* GetResamplingSourceNode(SourceId source_id);
+
+  // Allocates the propagation delay line of a sound object source with given
+  // |source_id|, which is required before its propagation delay gets enabled,
+  // see |PropagationDelayNode::AllocateDelayLine|. Calls to this method must be
+  // synchronized with the audio graph processing.
+  //
+  // @param source_id Sound object source id.
+  void AllocateSourcePropagationDelay(SourceId source_id);
+
+  // Allocates the clustering state of a sound object source with given
+  // |source_id| in the Ambisonic mixing encoder node it is connected to, which
+  // is required before its clustering gets enabled. Sources that are not
+  // rendered through an encoder node are ignored. Calls to this method must be
+  // synchronized with the audio graph processing.
+  //
+  // @param source_id Sound object source id.
+  // @return True if the source is rendered through an encoder node.
+  bool AllocateSourceClustering(SourceId source_id);
+
+  // Creates the reflections node of the current reflection order of the room
+  // zone with given |room_zone_id|, unless it has been created before, which
+  // is required before the room zone renders reflections of a new order. Calls
+  // to this method must be synchronized with the audio graph processing.
+  //
+  // @param room_zone_id Id of room zone.
+  void AllocateRoomZoneReflections(RoomZoneId room_zone_id);
+
   // Creates an ambisonic panner source with given |sound_object_source_id|.
   //
   // Processing graph:
@@ -198,13 +254,32 @@ class GraphManager {
   //
   //
   // @param sound_object_source_id Id of sound object source.
-  // @param ambisonic_order Ambisonic order to encode the sound object source.
+  // @param ambisonic_order Ambisonic order to encode the sound object source,
+  //     limited to the maximum order of the graph.
   // @param enable_hrtf Flag to enable HRTF-based rendering.
   // @param enable_direct_rendering Flag to enable direct source rendering.
   void CreateSoundObjectSource(SourceId sound_object_source_id,
                                int ambisonic_order, bool enable_hrtf,
                                bool enable_direct_rendering);
 
+  // Creates the room effects subgraphs of a new room zone with given
+  // |room_zone_id|, see |InitializeReflectionsGraph| and
+  // |InitializeReverbGraph|, and connects all existing sources to it. The
+  // default room zone is created on construction.
+  //
+  // @param room_zone_id Id of new room zone.
+  void CreateRoomZone(RoomZoneId room_zone_id);
+
+  // Destroys the room zone with given |room_zone_id|. The room effects
+  // subgraphs are disconnected from the graph immediately.
+  //
+  // @param room_zone_id Id of room zone to be destroyed.
+  void DestroyRoomZone(RoomZoneId room_zone_id);
+
+  // Recreates the room effects subgraphs of all room zones, which discards
+  // their processing states, e.g., the remaining reverb tails.
+  void ResetRoomZones();
+
   // Mutes on/off the room effects mixers.
   //
   // @param Whether to enable room effects.
@@ -232,19 +307,44 @@ class GraphManager {
   // @return Number of channels based on Ambisonic order in the global config.
   size_t GetNumMaxAmbisonicChannels() const;
 
+  // Returns the number of channels of the highest ambisonic order with a
+  // binaural renderer that does not exceed the order of the given input.
+  //
+  // @param num_channels Number of channels of a valid ambisonic input.
+  // @return Number of channels the input is rendered with.
+  size_t GetNumRenderedAmbisonicChannels(size_t num_channels) const;
+
   // Returns whether the room effects graph is enabled.
   //
   // @return True if room effects are enabled.
   bool GetRoomEffectsEnabled() const;
 
-  // Updates the room reflections with the current properties for room effects
-  // processing.
+  // Updates the room reflections of all room zones with the current properties
+  // for room effects processing.
   void UpdateRoomReflections();
 
-  // Updates the room reverb.
+  // Updates the room reverb of all room zones.
   void UpdateRoomReverb();
 
  private:
+  // Room effects subgraphs of a single room zone.
+  struct RoomZone {
+    // Mono mixer node to accumulate the early reflection sources.
+    std::shared_ptr<GainMixerNode> reflections_gain_mixer_node;
+
+    // Reflections nodes indexed by their reflection order minus one. A node is
+    // only created once the room zone uses its reflection order, and is kept
+    // to render its tail after the order changes. Only the node of the current
+    // reflection order of the room zone renders the reflections.
+    std::vector<std::shared_ptr<ReflectionsNode>> reflections_nodes;
+
+    // Mono mixer to accumulate all reverb sources.
+    std::shared_ptr<GainMixerNode> reverb_gain_mixer_node;
+
+    // Reverb node.
+    std::shared_ptr<ReverbNode> reverb_node;
+  };
+
   // Initializes the Ambisonic renderer subgraph for the speficied Ambisonic
   // order and connects it to the |StereoMixerNode|.
   //
@@ -282,7 +382,9 @@ class GraphManager {
   std::shared_ptr<BufferedSourceNode> LookupSourceNode(SourceId source_id);
 
   // Creates an audio subgraph that renders early reflections based on a room
-  // model on a single mix.
+  // model on a single mix. The reflections node is created for the current
+  // reflection order of the room zone and connected to the ambisonic mixer of
+  // the same order.
   //
   // Processing graph:
   //
@@ -304,7 +406,19 @@ class GraphManager {
   //                          |                     |
   //                          +----------+----------+
   //
-  void InitializeReflectionsGraph();
+  // @param room_zone_id Id of room zone.
+  // @param room_zone Room zone to initialize the subgraph of.
+  void InitializeReflectionsGraph(RoomZoneId room_zone_id, RoomZone* room_zone);
+
+  // Returns the maximum reflection order rendered for the room zones.
+  int GetMaxReflectionOrder() const;
+
+  // Creates the reflections node of the current reflection order of a room
+  // zone and connects it to the subgraph, unless it has been created before.
+  //
+  // @param room_zone_id Id of room zone.
+  // @param room_zone Room zone to create the reflections node for.
+  void CreateReflectionsNode(RoomZoneId room_zone_id, RoomZone* room_zone);
 
   // Creates an audio subgraph that renders a reverb from a mono mix of all the
   // sound objects based on a room model.
@@ -329,22 +443,32 @@ class GraphManager {
   //                            |                 |
   //                            +-----------------+
   //
-  void InitializeReverbGraph();
+  // @param room_zone_id Id of room zone.
+  // @param room_zone Room zone to initialize the subgraph of.
+  void InitializeReverbGraph(RoomZoneId room_zone_id, RoomZone* room_zone);
+
+  // Connects a source to the room effects mixers of all room zones, and of all
+  // room zones created later on.
+  //
+  // @param source_id Source id.
+  // @param room_effects_input_node Node providing the mono room effects input
+  //     of the source.
+  void ConnectToRoomZones(
+      SourceId source_id,
+      const std::shared_ptr<ProcessingNode::PublisherNodeType>&
+          room_effects_input_node);
 
   // Flag indicating if room effects are enabled.
   bool room_effects_enabled_;
 
-  // Mono mixer to accumulate all reverb sources.
-  std::shared_ptr<GainMixerNode> reverb_gain_mixer_node_;
-
-  // Reflections node.
-  std::shared_ptr<ReflectionsNode> reflections_node_;
+  // Room effects subgraphs of all room zones.
+  std::unordered_map<RoomZoneId, RoomZone> room_zones_;
 
-  // Mono mixer node to accumulate the early reflection sources.
-  std::shared_ptr<GainMixerNode> reflections_gain_mixer_node_;
-
-  // Reverb node.
-  std::shared_ptr<ReverbNode> reverb_node_;
+  // Mono room effects input nodes of all sources which are connected to the
+  // room zones.
+  std::unordered_map<SourceId,
+                     std::shared_ptr<ProcessingNode::PublisherNodeType>>
+      room_effects_input_nodes_;
 
   // Ambisonic output mixer to accumulate incoming ambisonic inputs into a
   // single ambisonic output buffer.
@@ -359,6 +483,10 @@ class GraphManager {
   // Provides Ambisonic encoding coefficients.
   std::unique_ptr<AmbisonicLookupTable> lookup_table_;
 
+  // Provides fractional delay interpolation kernels to the propagation delay
+  // nodes of all sound objects.
+  FractionalDelayTable fractional_delay_table_;
+
   // |FftManager| to be used in nodes that require FFT transformations.
   FftManager fft_manager_;
 
@@ -384,6 +512,15 @@ class GraphManager {
   // Output node that enables audio playback of a single audio stream.
   std::shared_ptr<SinkNode> output_node_;
 
+  // Propagation delay nodes of all sound object sources, by source id.
+  std::unordered_map<SourceId, std::shared_ptr<PropagationDelayNode>>
+      propagation_delay_nodes_;
+
+  // Ambisonic mixing encoder nodes of the sound object sources rendered with
+  // HRTFs, by source id.
+  std::unordered_map<SourceId, std::shared_ptr<AmbisonicMixingEncoderNode>>
+      source_encoder_nodes_;
+
   // Holds all registered source nodes (independently of their type) and
   // allows look up by id.
   std::unordered_map<SourceId, std::shared_ptr<BufferedSourceNode>>
@@ -52,27 +52,25 @@ const AudioBuffer* NearFieldEffectNode::AudioProcess(const NodeInput& input) {
     LOG(WARNING) << "Could not find source parameters";
     return nullptr;
   }
+  if (source_parameters->is_clustered) {
+    // Clustered sources are beyond the near field, see |kNearFieldThreshold|.
+    left_panner_.Reset(0.0f);
+    right_panner_.Reset(0.0f);
+    return nullptr;
+  }
 
 
   DCHECK_EQ(pan_gains_.size(), kNumStereoChannels);
   const float near_field_gain = source_parameters->near_field_gain;
   if (near_field_gain > 0.0f) {
-    const auto& listener_position = system_settings_.GetHeadPosition();
-    const auto& listener_rotation = system_settings_.GetHeadRotation();
-    const auto& source_transform = source_parameters->object_transform;
-    // Compute the relative source direction in spherical angles to calculate
-    // the left and right panner gains.
-    WorldPosition relative_direction;
-    GetRelativeDirection(listener_position, listener_rotation,
-                         source_transform.position, &relative_direction);
-    const auto source_direction =
-        SphericalAngle::FromWorldPosition(relative_direction);
-    CalculateStereoPanGains(source_direction, &pan_gains_);
+    const SourceGeometry& geometry = source_parameters->geometry;
+    // Use the relative source direction in spherical angles to calculate the
+    // left and right panner gains.
+    CalculateStereoPanGains(geometry.direction_from_listener, &pan_gains_);
     // Combine pan gains with per-source near field gain.
     const float total_near_field_gain =
-        ComputeNearFieldEffectGain(listener_position,
-                                   source_transform.position) *
-        near_field_gain / kMaxNearFieldEffectGain;
+        ComputeNearFieldEffectGain(geometry.distance) * near_field_gain /
+        kMaxNearFieldEffectGain;
     for (size_t i = 0; i < pan_gains_.size(); ++i) {
       pan_gains_[i] *= total_near_field_gain;
     }
@@ -88,6 +88,9 @@ TEST(NearFieldEffectNodeTest, VariousDistanceTest) {
       auto source_parameters =
           parameters_manager->GetMutableParameters(kSourceId);
       source_parameters->object_transform.position = input_position;
+      UpdateSourceGeometry(system_settings.GetHeadPosition(),
+                           system_settings.GetHeadRotation(),
+                           source_parameters);
       source_parameters->near_field_gain = kMaxNearFieldEffectGain;
       // Retrieve the output.
       const auto& buffer_vector = output_node->ReadInputs();
@@ -62,21 +62,15 @@ const AudioBuffer* OcclusionNode::AudioProcess(const NodeInput& input) {
     LOG(WARNING) << "Could not find source parameters";
     return nullptr;
   }
+  if (source_parameters->is_clustered) {
+    // Clustered sources are mixed into their cluster unfiltered.
+    return input_buffer;
+  }
 
-  const WorldPosition& listener_position = system_settings_.GetHeadPosition();
-  const WorldRotation& listener_rotation = system_settings_.GetHeadRotation();
-  const ObjectTransform& source_transform = source_parameters->object_transform;
-  // Compute the relative listener/source direction in spherical angles.
-  WorldPosition relative_direction;
-  GetRelativeDirection(listener_position, listener_rotation,
-                       source_transform.position, &relative_direction);
-  const SphericalAngle listener_direction =
-      SphericalAngle::FromWorldPosition(relative_direction);
-
-  GetRelativeDirection(source_transform.position, source_transform.rotation,
-                       listener_position, &relative_direction);
-  const SphericalAngle source_direction =
-      SphericalAngle::FromWorldPosition(relative_direction);
+  // Relative listener/source directions in spherical angles.
+  const SourceGeometry& geometry = source_parameters->geometry;
+  const SphericalAngle& listener_direction = geometry.direction_from_listener;
+  const SphericalAngle& source_direction = geometry.direction_from_source;
   // Calculate low-pass filter coefficient based on listener/source directivity
   // and occlusion values.
   const float listener_directivity = CalculateDirectivity(
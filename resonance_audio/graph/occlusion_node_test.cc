@@ -18,6 +18,7 @@ limitations under the License.
 
 #include "third_party/googletest/googletest/include/gtest/gtest.h"
 #include "base/constants_and_types.h"
+#include "dsp/distance_attenuation.h"
 #include "utils/test_util.h"
 
 namespace vraudio {
@@ -48,9 +49,12 @@ class OcclusionNodeTest : public ::testing::Test {
   }
 
   // Function which wraps the buffer passed in a vector for processing and
-  // returns the output of the occlusion nodes AudioProcess method.
+  // returns the output of the occlusion nodes AudioProcess method. The source
+  // geometry is updated beforehand, as it would be once per buffer by the API.
   const AudioBuffer* GetProcessedData(const AudioBuffer* input_buffer,
                                       OcclusionNode* occlusion_node) {
+    UpdateSourceGeometry(system_settings_.GetHeadPosition(),
+                         system_settings_.GetHeadRotation(), GetParameters());
     std::vector<const AudioBuffer*> input_buffers;
     input_buffers.push_back(input_buffer);
     return occlusion_node->AudioProcess(
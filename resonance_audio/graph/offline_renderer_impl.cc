@@ -0,0 +1,424 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "graph/offline_renderer_impl.h"
+
+#include <algorithm>
+
+#include "base/constants_and_types.h"
+#include "base/logging.h"
+#include "base/simd_utils.h"
+#include "utils/planar_interleaved_conversion.h"
+
+namespace vraudio {
+
+OfflineRendererImpl::OfflineRendererImpl(size_t num_channels,
+                                         size_t frames_per_block,
+                                         int sample_rate_hz)
+    : OfflineRendererImpl(num_channels, frames_per_block, sample_rate_hz,
+                          ResonanceAudioApiOptions()) {}
+
+OfflineRendererImpl::OfflineRendererImpl(
+    size_t num_channels, size_t frames_per_block, int sample_rate_hz,
+    const ResonanceAudioApiOptions& options)
+    : num_channels_(num_channels),
+      frames_per_block_(frames_per_block),
+      api_(num_channels, frames_per_block, sample_rate_hz, options),
+      num_rendered_frames_(0),
+      num_processed_frames_(0),
+      output_block_(num_channels, frames_per_block),
+      output_block_ptrs_(num_channels),
+      planar_output_ptrs_(num_channels),
+      volume_envelope_(kNumMonoChannels, frames_per_block) {
+  GetRawChannelDataPointersFromAudioBuffer(&output_block_,
+                                           &output_block_ptrs_);
+}
+
+ResonanceAudioApi* OfflineRendererImpl::GetApi() { return &api_; }
+
+ResonanceAudioApi::SourceId OfflineRendererImpl::AddAmbisonicSource(
+    const float* audio, size_t num_channels, size_t num_frames,
+    size_t start_frame) {
+  return AddSourceTimeline(api_.CreateAmbisonicSource(num_channels), audio,
+                           num_channels, num_frames, start_frame);
+}
+
+ResonanceAudioApi::SourceId OfflineRendererImpl::AddAmbisonicSource(
+    const float* const* audio, size_t num_channels, size_t num_frames,
+    size_t start_frame) {
+  return AddSourceTimeline(api_.CreateAmbisonicSource(num_channels), audio,
+                           num_channels, num_frames, start_frame);
+}
+
+ResonanceAudioApi::SourceId OfflineRendererImpl::AddStereoSource(
+    const float* audio, size_t num_channels, size_t num_frames,
+    size_t start_frame) {
+  return AddSourceTimeline(api_.CreateStereoSource(num_channels), audio,
+                           num_channels, num_frames, start_frame);
+}
+
+ResonanceAudioApi::SourceId OfflineRendererImpl::AddStereoSource(
+    const float* const* audio, size_t num_channels, size_t num_frames,
+    size_t start_frame) {
+  return AddSourceTimeline(api_.CreateStereoSource(num_channels), audio,
+                           num_channels, num_frames, start_frame);
+}
+
+ResonanceAudioApi::SourceId OfflineRendererImpl::AddSoundObjectSource(
+    const float* audio, size_t num_channels, size_t num_frames,
+    size_t start_frame, RenderingMode rendering_mode) {
+  return AddSourceTimeline(api_.CreateSoundObjectSource(rendering_mode), audio,
+                           num_channels, num_frames, start_frame);
+}
+
+ResonanceAudioApi::SourceId OfflineRendererImpl::AddSoundObjectSource(
+    const float* const* audio, size_t num_channels, size_t num_frames,
+    size_t start_frame, RenderingMode rendering_mode) {
+  return AddSourceTimeline(api_.CreateSoundObjectSource(rendering_mode), audio,
+                           num_channels, num_frames, start_frame);
+}
+
+void OfflineRendererImpl::AddHeadPositionKeyframe(size_t frame, float x,
+                                                  float y, float z) {
+  head_position_.AddKeyframe(frame, WorldPosition(x, y, z));
+}
+
+void OfflineRendererImpl::AddHeadRotationKeyframe(size_t frame, float x,
+                                                  float y, float z, float w) {
+  head_rotation_.AddKeyframe(frame, WorldRotation(w, x, y, z));
+}
+
+void OfflineRendererImpl::AddMasterVolumeKeyframe(size_t frame, float volume) {
+  // The keyframes replace the master volume of the graph.
+  api_.SetMasterVolume(1.0f);
+  master_volume_.AddKeyframe(frame, volume);
+}
+
+void OfflineRendererImpl::AddSourcePositionKeyframe(
+    ResonanceAudioApi::SourceId source_id, size_t frame, float x, float y,
+    float z) {
+  SourceTimeline* timeline = GetSourceTimeline(source_id);
+  if (timeline != nullptr) {
+    timeline->position.AddKeyframe(frame, WorldPosition(x, y, z));
+  }
+}
+
+void OfflineRendererImpl::AddSourceRotationKeyframe(
+    ResonanceAudioApi::SourceId source_id, size_t frame, float x, float y,
+    float z, float w) {
+  SourceTimeline* timeline = GetSourceTimeline(source_id);
+  if (timeline != nullptr) {
+    timeline->rotation.AddKeyframe(frame, WorldRotation(w, x, y, z));
+  }
+}
+
+void OfflineRendererImpl::AddSourceVolumeKeyframe(
+    ResonanceAudioApi::SourceId source_id, size_t frame, float volume) {
+  SourceTimeline* timeline = GetSourceTimeline(source_id);
+  if (timeline != nullptr) {
+    // The keyframes replace the source volume of the graph.
+    api_.SetSourceVolume(source_id, 1.0f);
+    timeline->volume.AddKeyframe(frame, volume);
+  }
+}
+
+size_t OfflineRendererImpl::GetNumTimelineFrames() const {
+  size_t num_timeline_frames = 0;
+  for (const auto& timeline : sources_) {
+    num_timeline_frames = std::max(
+        num_timeline_frames, timeline->start_frame + timeline->num_frames);
+  }
+  return num_timeline_frames;
+}
+
+bool OfflineRendererImpl::RenderInterleaved(size_t num_channels,
+                                            size_t num_frames,
+                                            float* buffer_ptr) {
+  return RenderTemplated(num_channels, num_frames, buffer_ptr);
+}
+
+bool OfflineRendererImpl::RenderPlanar(size_t num_channels, size_t num_frames,
+                                       float* const* buffer_ptr) {
+  return RenderTemplated(num_channels, num_frames, buffer_ptr);
+}
+
+void OfflineRendererImpl::Reset() {
+  for (const auto& timeline : sources_) {
+    api_.DestroySource(timeline->source_id);
+  }
+  sources_.clear();
+  head_position_ = KeyframeTrack<WorldPosition>();
+  head_rotation_ = KeyframeTrack<WorldRotation>();
+  master_volume_ = KeyframeTrack<float>();
+
+  api_.SetHeadPosition(0.0f, 0.0f, 0.0f);
+  api_.SetHeadRotation(0.0f, 0.0f, 0.0f, 1.0f);
+  api_.SetMasterVolume(1.0f);
+  api_.SetReflectionProperties(ReflectionProperties());
+  api_.SetReverbProperties(ReverbProperties());
+  api_.EnableRoomEffects(true);
+  // The room effects are recreated rather than rendered until they have
+  // decayed, which also discards their internal states.
+  api_.ResetRoomEffects();
+
+  // Without sources, the graph is only processed as long as the decoders still
+  // output their tails.
+  while (api_.FillPlanarOutputBuffer(num_channels_, frames_per_block_,
+                                     output_block_ptrs_.data())) {
+  }
+  num_rendered_frames_ = 0;
+  num_processed_frames_ = 0;
+}
+
+ResonanceAudioApi::SourceId OfflineRendererImpl::AddSourceTimeline(
+    ResonanceAudioApi::SourceId source_id, const float* audio,
+    size_t num_channels, size_t num_frames, size_t start_frame) {
+  if (source_id == ResonanceAudioApi::kInvalidSourceId) {
+    return source_id;
+  }
+  std::unique_ptr<SourceTimeline> timeline(new SourceTimeline(
+      source_id, num_channels, num_frames, start_frame, frames_per_block_));
+  timeline->interleaved_audio = audio;
+  sources_.push_back(std::move(timeline));
+  return source_id;
+}
+
+ResonanceAudioApi::SourceId OfflineRendererImpl::AddSourceTimeline(
+    ResonanceAudioApi::SourceId source_id, const float* const* audio,
+    size_t num_channels, size_t num_frames, size_t start_frame) {
+  if (source_id == ResonanceAudioApi::kInvalidSourceId) {
+    return source_id;
+  }
+  std::unique_ptr<SourceTimeline> timeline(new SourceTimeline(
+      source_id, num_channels, num_frames, start_frame, frames_per_block_));
+  timeline->planar_audio.assign(audio, audio + num_channels);
+  timeline->block_ptrs.resize(num_channels);
+  sources_.push_back(std::move(timeline));
+  return source_id;
+}
+
+OfflineRendererImpl::SourceTimeline* OfflineRendererImpl::GetSourceTimeline(
+    ResonanceAudioApi::SourceId source_id) {
+  for (auto& timeline : sources_) {
+    if (timeline->source_id == source_id) {
+      return timeline.get();
+    }
+  }
+  LOG(WARNING) << "Source id not found: " << source_id;
+  return nullptr;
+}
+
+template <typename OutputType>
+bool OfflineRendererImpl::RenderTemplated(size_t num_channels,
+                                          size_t num_frames,
+                                          OutputType buffer_ptr) {
+  if (buffer_ptr == nullptr) {
+    LOG(WARNING) << "Invalid output buffer pointer";
+    return false;
+  }
+  if (num_channels != num_channels_) {
+    LOG(WARNING) << "Number of output channels must be " << num_channels_;
+    return false;
+  }
+
+  size_t num_frames_written = 0;
+  while (num_frames_written < num_frames) {
+    const size_t num_remaining_frames = num_frames - num_frames_written;
+    const size_t num_buffered_frames =
+        num_processed_frames_ - num_rendered_frames_;
+    size_t num_frames_to_copy = 0;
+    if (num_buffered_frames > 0) {
+      // Drain the remainder of a previously processed block first.
+      num_frames_to_copy = std::min(num_buffered_frames, num_remaining_frames);
+      FillExternalBufferWithOffset(
+          output_block_, frames_per_block_ - num_buffered_frames, buffer_ptr,
+          num_frames, num_channels, num_frames_written, num_frames_to_copy);
+    } else if (num_remaining_frames >= frames_per_block_) {
+      // Complete blocks are written directly into the caller's buffer.
+      ProcessNextBlock(buffer_ptr, num_frames_written);
+      num_frames_to_copy = frames_per_block_;
+    } else {
+      ProcessNextBlock(output_block_ptrs_.data(), 0);
+      continue;
+    }
+    num_frames_written += num_frames_to_copy;
+    num_rendered_frames_ += num_frames_to_copy;
+  }
+  return true;
+}
+
+void OfflineRendererImpl::PrepareNextBlock() {
+  // Positions and rotations are evaluated at the first frame of the following
+  // block. The graph interpolates the source directions towards these values
+  // across the block.
+  const size_t frame = num_processed_frames_ + frames_per_block_;
+  if (!head_position_.empty()) {
+    const WorldPosition position = head_position_.GetValue(frame);
+    api_.SetHeadPosition(position.x(), position.y(), position.z());
+  }
+  if (!head_rotation_.empty()) {
+    const WorldRotation rotation = head_rotation_.GetValue(frame);
+    api_.SetHeadRotation(rotation.x(), rotation.y(), rotation.z(),
+                         rotation.w());
+  }
+
+  for (auto& timeline : sources_) {
+    const ResonanceAudioApi::SourceId source_id = timeline->source_id;
+    if (!timeline->position.empty()) {
+      const WorldPosition position = timeline->position.GetValue(frame);
+      api_.SetSourcePosition(source_id, position.x(), position.y(),
+                             position.z());
+    }
+    if (!timeline->rotation.empty()) {
+      const WorldRotation rotation = timeline->rotation.GetValue(frame);
+      api_.SetSourceRotation(source_id, rotation.x(), rotation.y(),
+                             rotation.z(), rotation.w());
+    }
+    SetSourceBlock(timeline.get());
+  }
+}
+
+void OfflineRendererImpl::ProcessNextBlock(float* buffer_ptr,
+                                           size_t offset_frames) {
+  PrepareNextBlock();
+  float* const block_ptr = buffer_ptr + offset_frames * num_channels_;
+  if (!api_.FillInterleavedOutputBuffer(num_channels_, frames_per_block_,
+                                        block_ptr)) {
+    std::fill_n(block_ptr, frames_per_block_ * num_channels_, 0.0f);
+  } else if (!master_volume_.empty()) {
+    ComputeVolumeEnvelope(master_volume_);
+    const AudioBuffer::Channel& volumes = volume_envelope_[0];
+    for (size_t frame = 0; frame < frames_per_block_; ++frame) {
+      for (size_t channel = 0; channel < num_channels_; ++channel) {
+        block_ptr[frame * num_channels_ + channel] *= volumes[frame];
+      }
+    }
+  }
+  num_processed_frames_ += frames_per_block_;
+}
+
+void OfflineRendererImpl::ProcessNextBlock(float* const* buffer_ptr,
+                                           size_t offset_frames) {
+  PrepareNextBlock();
+  for (size_t channel = 0; channel < num_channels_; ++channel) {
+    planar_output_ptrs_[channel] = buffer_ptr[channel] + offset_frames;
+  }
+  if (!api_.FillPlanarOutputBuffer(num_channels_, frames_per_block_,
+                                   planar_output_ptrs_.data())) {
+    for (float* channel_ptr : planar_output_ptrs_) {
+      std::fill_n(channel_ptr, frames_per_block_, 0.0f);
+    }
+  } else if (!master_volume_.empty()) {
+    ComputeVolumeEnvelope(master_volume_);
+    for (float* channel_ptr : planar_output_ptrs_) {
+      for (size_t frame = 0; frame < frames_per_block_; ++frame) {
+        channel_ptr[frame] *= volume_envelope_[0][frame];
+      }
+    }
+  }
+  num_processed_frames_ += frames_per_block_;
+}
+
+void OfflineRendererImpl::SetSourceBlock(SourceTimeline* timeline) {
+  const size_t block_start_frame = num_processed_frames_;
+  const size_t block_end_frame = block_start_frame + frames_per_block_;
+  const size_t source_end_frame = timeline->start_frame + timeline->num_frames;
+  if (timeline->start_frame >= block_end_frame ||
+      source_end_frame <= block_start_frame) {
+    // Inactive sources are not fed and thus skipped by the graph.
+    return;
+  }
+
+  if (timeline->start_frame <= block_start_frame &&
+      source_end_frame >= block_end_frame && timeline->volume.empty()) {
+    // The block is entirely covered by the source audio, which is passed to
+    // the graph without an intermediate copy.
+    const size_t source_offset = block_start_frame - timeline->start_frame;
+    if (timeline->interleaved_audio != nullptr) {
+      api_.SetInterleavedBuffer(
+          timeline->source_id,
+          timeline->interleaved_audio + source_offset * timeline->num_channels,
+          timeline->num_channels, frames_per_block_);
+      return;
+    }
+    for (size_t channel = 0; channel < timeline->num_channels; ++channel) {
+      timeline->block_ptrs[channel] =
+          timeline->planar_audio[channel] + source_offset;
+    }
+    api_.SetPlanarBuffer(timeline->source_id, timeline->block_ptrs.data(),
+                         timeline->num_channels, frames_per_block_);
+    return;
+  }
+
+  // Copy the source audio, zero padded at its start and end.
+  const size_t first_frame = std::max(block_start_frame, timeline->start_frame);
+  const size_t num_frames_to_copy =
+      std::min(block_end_frame, source_end_frame) - first_frame;
+  AudioBuffer* input_block = &timeline->input_block;
+  input_block->Clear();
+  if (timeline->interleaved_audio != nullptr) {
+    FillAudioBufferWithOffset(
+        timeline->interleaved_audio, timeline->num_frames,
+        timeline->num_channels, first_frame - timeline->start_frame,
+        first_frame - block_start_frame, num_frames_to_copy, input_block);
+  } else {
+    FillAudioBufferWithOffset(
+        timeline->planar_audio.data(), timeline->num_frames,
+        timeline->num_channels, first_frame - timeline->start_frame,
+        first_frame - block_start_frame, num_frames_to_copy, input_block);
+  }
+  if (!timeline->volume.empty()) {
+    ComputeVolumeEnvelope(timeline->volume);
+    for (AudioBuffer::Channel& channel : *input_block) {
+      MultiplyPointwise(frames_per_block_, volume_envelope_[0].begin(),
+                        channel.begin(), channel.begin());
+    }
+  }
+  std::vector<const float*>& block_ptrs = timeline->block_ptrs;
+  block_ptrs.resize(timeline->num_channels);
+  GetRawChannelDataPointersFromAudioBuffer(*input_block, &block_ptrs);
+  api_.SetPlanarBuffer(timeline->source_id, block_ptrs.data(),
+                       timeline->num_channels, frames_per_block_);
+}
+
+void OfflineRendererImpl::ComputeVolumeEnvelope(
+    const KeyframeTrack<float>& volume) {
+  // The volume is linear between keyframes, so that it is only evaluated at
+  // the keyframes within the block and ramped in between.
+  const size_t block_start_frame = num_processed_frames_;
+  const size_t block_end_frame = block_start_frame + frames_per_block_;
+  AudioBuffer::Channel* envelope = &volume_envelope_[0];
+  size_t segment_start_frame = block_start_frame;
+  float segment_start_volume = volume.GetValue(segment_start_frame);
+  while (segment_start_frame < block_end_frame) {
+    const size_t segment_end_frame = std::min(
+        volume.GetNextKeyframeFrame(segment_start_frame), block_end_frame);
+    const float segment_end_volume = volume.GetValue(segment_end_frame);
+    const float volume_step =
+        (segment_end_volume - segment_start_volume) /
+        static_cast<float>(segment_end_frame - segment_start_frame);
+    for (size_t frame = segment_start_frame; frame < segment_end_frame;
+         ++frame) {
+      (*envelope)[frame - block_start_frame] =
+          segment_start_volume +
+          volume_step * static_cast<float>(frame - segment_start_frame);
+    }
+    segment_start_frame = segment_end_frame;
+    segment_start_volume = segment_end_volume;
+  }
+}
+
+}  // namespace vraudio
@@ -0,0 +1,233 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef RESONANCE_AUDIO_GRAPH_OFFLINE_RENDERER_IMPL_H_
+#define RESONANCE_AUDIO_GRAPH_OFFLINE_RENDERER_IMPL_H_
+
+#include <memory>
+#include <vector>
+
+#include "api/offline_renderer.h"
+#include "base/audio_buffer.h"
+#include "base/misc_math.h"
+#include "graph/resonance_audio_api_impl.h"
+#include "utils/keyframe_track.h"
+
+namespace vraudio {
+
+// Implementation of the |OfflineRenderer| interface, which drives a
+// |ResonanceAudioApiImpl| configured with the block size.
+class OfflineRendererImpl : public OfflineRenderer {
+ public:
+  // Constructor with the default |ResonanceAudioApiOptions|.
+  //
+  // @param num_channels Number of channels of audio output.
+  // @param frames_per_block Number of frames per internal processing block.
+  // @param sample_rate_hz Sample rate of source and output audio.
+  OfflineRendererImpl(size_t num_channels, size_t frames_per_block,
+                      int sample_rate_hz);
+
+  // Constructor.
+  //
+  // @param num_channels Number of channels of audio output.
+  // @param frames_per_block Number of frames per internal processing block.
+  // @param sample_rate_hz Sample rate of source and output audio.
+  // @param options Reverb and Ambisonic rendering options.
+  OfflineRendererImpl(size_t num_channels, size_t frames_per_block,
+                      int sample_rate_hz,
+                      const ResonanceAudioApiOptions& options);
+
+  ~OfflineRendererImpl() override {}
+
+  // Implements |OfflineRenderer| interface.
+  ResonanceAudioApi* GetApi() override;
+  ResonanceAudioApi::SourceId AddAmbisonicSource(const float* audio,
+                                                 size_t num_channels,
+                                                 size_t num_frames,
+                                                 size_t start_frame) override;
+  ResonanceAudioApi::SourceId AddAmbisonicSource(const float* const* audio,
+                                                 size_t num_channels,
+                                                 size_t num_frames,
+                                                 size_t start_frame) override;
+  ResonanceAudioApi::SourceId AddStereoSource(const float* audio,
+                                              size_t num_channels,
+                                              size_t num_frames,
+                                              size_t start_frame) override;
+  ResonanceAudioApi::SourceId AddStereoSource(const float* const* audio,
+                                              size_t num_channels,
+                                              size_t num_frames,
+                                              size_t start_frame) override;
+  ResonanceAudioApi::SourceId AddSoundObjectSource(
+      const float* audio, size_t num_channels, size_t num_frames,
+      size_t start_frame, RenderingMode rendering_mode) override;
+  ResonanceAudioApi::SourceId AddSoundObjectSource(
+      const float* const* audio, size_t num_channels, size_t num_frames,
+      size_t start_frame, RenderingMode rendering_mode) override;
+  void AddHeadPositionKeyframe(size_t frame, float x, float y,
+                               float z) override;
+  void AddHeadRotationKeyframe(size_t frame, float x, float y, float z,
+                               float w) override;
+  void AddMasterVolumeKeyframe(size_t frame, float volume) override;
+  void AddSourcePositionKeyframe(ResonanceAudioApi::SourceId source_id,
+                                 size_t frame, float x, float y,
+                                 float z) override;
+  void AddSourceRotationKeyframe(ResonanceAudioApi::SourceId source_id,
+                                 size_t frame, float x, float y, float z,
+                                 float w) override;
+  void AddSourceVolumeKeyframe(ResonanceAudioApi::SourceId source_id,
+                               size_t frame, float volume) override;
+  size_t GetNumTimelineFrames() const override;
+  size_t GetNumRenderedFrames() const override { return num_rendered_frames_; }
+  bool RenderInterleaved(size_t num_channels, size_t num_frames,
+                         float* buffer_ptr) override;
+  bool RenderPlanar(size_t num_channels, size_t num_frames,
+                    float* const* buffer_ptr) override;
+  void Reset() override;
+
+ private:
+  // Audio and time-varying parameters of a single source.
+  struct SourceTimeline {
+    SourceTimeline(ResonanceAudioApi::SourceId id, size_t num_channels,
+                   size_t num_frames, size_t start_frame,
+                   size_t frames_per_block)
+        : source_id(id),
+          interleaved_audio(nullptr),
+          num_channels(num_channels),
+          num_frames(num_frames),
+          start_frame(start_frame),
+          input_block(num_channels, frames_per_block) {}
+
+    // Id of the source in the underlying |ResonanceAudioApi|.
+    ResonanceAudioApi::SourceId source_id;
+
+    // Interleaved source audio, nullptr if the audio is planar.
+    const float* interleaved_audio;
+
+    // Planar source audio, empty if the audio is interleaved.
+    std::vector<const float*> planar_audio;
+
+    // Number of channels of source audio.
+    size_t num_channels;
+
+    // Number of frames of source audio.
+    size_t num_frames;
+
+    // Output frame at which the source starts playing.
+    size_t start_frame;
+
+    // Time-varying parameters.
+    KeyframeTrack<WorldPosition> position;
+    KeyframeTrack<WorldRotation> rotation;
+    KeyframeTrack<float> volume;
+
+    // Input block holding a copy of the source audio, which is used at the
+    // start and end of the source audio to zero pad it, and to apply
+    // time-varying volumes.
+    AudioBuffer input_block;
+
+    // Channel pointers of the current input block.
+    std::vector<const float*> block_ptrs;
+  };
+
+  // Adds a source timeline with interleaved or planar audio.
+  //
+  // @param source_id Id of source created in |api_|.
+  // @param audio Interleaved audio or array of pointers to planar audio.
+  // @param num_channels Number of channels of source audio.
+  // @param num_frames Number of frames of source audio.
+  // @param start_frame Output frame at which the source starts playing.
+  // @return |source_id|.
+  ResonanceAudioApi::SourceId AddSourceTimeline(
+      ResonanceAudioApi::SourceId source_id, const float* audio,
+      size_t num_channels, size_t num_frames, size_t start_frame);
+  ResonanceAudioApi::SourceId AddSourceTimeline(
+      ResonanceAudioApi::SourceId source_id, const float* const* audio,
+      size_t num_channels, size_t num_frames, size_t start_frame);
+
+  // Returns the timeline of a source.
+  //
+  // @param source_id Id of source.
+  // @return Source timeline, nullptr if |source_id| is unknown.
+  SourceTimeline* GetSourceTimeline(ResonanceAudioApi::SourceId source_id);
+
+  // Templated implementation of |RenderInterleaved| and |RenderPlanar|.
+  template <typename OutputType>
+  bool RenderTemplated(size_t num_channels, size_t num_frames,
+                       OutputType buffer_ptr);
+
+  // Updates the positions and rotations to their values at the end of the
+  // next block, and feeds the active sources for this block.
+  void PrepareNextBlock();
+
+  // Processes the next block of the timeline and writes it into an
+  // interleaved or planar output buffer. Silence is written if no source is
+  // connected to the graph.
+  //
+  // @param buffer_ptr Output buffer.
+  // @param offset_frames Frame offset into |buffer_ptr|.
+  void ProcessNextBlock(float* buffer_ptr, size_t offset_frames);
+  void ProcessNextBlock(float* const* buffer_ptr, size_t offset_frames);
+
+  // Sets the input block of a source that is active in the next block.
+  //
+  // @param timeline Source timeline.
+  void SetSourceBlock(SourceTimeline* timeline);
+
+  // Evaluates a volume keyframe track at each frame of the next block and
+  // stores the result in |volume_envelope_|.
+  //
+  // @param volume Volume keyframe track.
+  void ComputeVolumeEnvelope(const KeyframeTrack<float>& volume);
+
+  // Number of output channels.
+  const size_t num_channels_;
+
+  // Number of frames per internal processing block.
+  const size_t frames_per_block_;
+
+  // Underlying real-time renderer.
+  ResonanceAudioApiImpl api_;
+
+  // Time-varying listener parameters.
+  KeyframeTrack<WorldPosition> head_position_;
+  KeyframeTrack<WorldRotation> head_rotation_;
+  KeyframeTrack<float> master_volume_;
+
+  // Timelines of all sources.
+  std::vector<std::unique_ptr<SourceTimeline>> sources_;
+
+  // Number of frames returned to the caller.
+  size_t num_rendered_frames_;
+
+  // Number of frames processed by |api_|.
+  size_t num_processed_frames_;
+
+  // Output block used when the caller's buffer cannot hold a complete block.
+  AudioBuffer output_block_;
+
+  // Channel pointers into |output_block_|.
+  std::vector<float*> output_block_ptrs_;
+
+  // Channel pointers into the caller's planar output buffer.
+  std::vector<float*> planar_output_ptrs_;
+
+  // Per frame volumes of the next block.
+  AudioBuffer volume_envelope_;
+};
+
+}  // namespace vraudio
+
+#endif  // RESONANCE_AUDIO_GRAPH_OFFLINE_RENDERER_IMPL_H_
@@ -0,0 +1,305 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "graph/offline_renderer_impl.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <vector>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+#include "base/constants_and_types.h"
+#include "graph/resonance_audio_api_impl.h"
+
+namespace vraudio {
+
+namespace {
+
+const size_t kFramesPerBlock = 2048;
+const int kSampleRateHz = 48000;
+
+// Source audio and timeline configuration.
+const size_t kNumSourceFrames = 3000;
+const size_t kSourceStartFrame = 700;
+const size_t kNumOutputFrames = 4 * kFramesPerBlock + kSourceStartFrame +
+                                kNumSourceFrames;
+
+// Source position keyframes.
+const size_t kStartKeyframe = 1000;
+const size_t kEndKeyframe = 3000;
+const float kStartX = -2.0f;
+const float kEndX = 2.0f;
+
+// Tolerated difference between offline and real-time rendering.
+const float kEpsilon = 1e-6f;
+
+// Generates a deterministic mono test signal.
+std::vector<float> GenerateSourceAudio() {
+  std::vector<float> audio(kNumSourceFrames);
+  for (size_t frame = 0; frame < kNumSourceFrames; ++frame) {
+    audio[frame] = 0.5f * std::sin(0.05f * static_cast<float>(frame)) +
+                   0.25f * std::sin(0.37f * static_cast<float>(frame));
+  }
+  return audio;
+}
+
+// Returns the interpolated x coordinate of the source at |frame|.
+float GetSourceX(size_t frame) {
+  if (frame <= kStartKeyframe) {
+    return kStartX;
+  }
+  if (frame >= kEndKeyframe) {
+    return kEndX;
+  }
+  const float t = static_cast<float>(frame - kStartKeyframe) /
+                  static_cast<float>(kEndKeyframe - kStartKeyframe);
+  return kStartX + t * (kEndX - kStartX);
+}
+
+// Renders the test timeline block by block via the real-time API, with the
+// source position at the end of each block.
+std::vector<float> RenderRealTime(const std::vector<float>& source_audio) {
+  ResonanceAudioApiImpl api(kNumStereoChannels, kFramesPerBlock,
+                            kSampleRateHz);
+  const ResonanceAudioApi::SourceId source_id =
+      api.CreateSoundObjectSource(kBinauralHighQuality);
+  const size_t num_blocks =
+      (kNumOutputFrames + kFramesPerBlock - 1) / kFramesPerBlock;
+  std::vector<float> output(
+      num_blocks * kFramesPerBlock * kNumStereoChannels, 0.0f);
+  std::vector<float> block(kFramesPerBlock);
+  for (size_t b = 0; b < num_blocks; ++b) {
+    const size_t block_start_frame = b * kFramesPerBlock;
+    api.SetSourcePosition(
+        source_id, GetSourceX(block_start_frame + kFramesPerBlock), 0.0f,
+        -1.0f);
+    bool is_active = false;
+    for (size_t i = 0; i < kFramesPerBlock; ++i) {
+      const size_t frame = block_start_frame + i;
+      const bool is_source_frame =
+          frame >= kSourceStartFrame &&
+          frame < kSourceStartFrame + kNumSourceFrames;
+      block[i] = is_source_frame ? source_audio[frame - kSourceStartFrame]
+                                 : 0.0f;
+      is_active |= is_source_frame;
+    }
+    if (is_active) {
+      api.SetInterleavedBuffer(source_id, block.data(), kNumMonoChannels,
+                               kFramesPerBlock);
+    }
+    api.FillInterleavedOutputBuffer(
+        kNumStereoChannels, kFramesPerBlock,
+        output.data() + block_start_frame * kNumStereoChannels);
+  }
+  output.resize(kNumOutputFrames * kNumStereoChannels);
+  return output;
+}
+
+// Tests that rendering a timeline offline in output chunks of arbitrary size
+// matches the block-wise rendering via the real-time API.
+TEST(OfflineRendererImplTest, MatchesRealTimeRendering) {
+  const std::vector<float> source_audio = GenerateSourceAudio();
+  const std::vector<float> expected_output = RenderRealTime(source_audio);
+
+  OfflineRendererImpl renderer(kNumStereoChannels, kFramesPerBlock,
+                               kSampleRateHz);
+  const ResonanceAudioApi::SourceId source_id = renderer.AddSoundObjectSource(
+      source_audio.data(), kNumMonoChannels, kNumSourceFrames,
+      kSourceStartFrame, kBinauralHighQuality);
+  renderer.AddSourcePositionKeyframe(source_id, kEndKeyframe, kEndX, 0.0f,
+                                     -1.0f);
+  renderer.AddSourcePositionKeyframe(source_id, kStartKeyframe, kStartX, 0.0f,
+                                     -1.0f);
+  EXPECT_EQ(kSourceStartFrame + kNumSourceFrames,
+            renderer.GetNumTimelineFrames());
+
+  const std::vector<size_t> kChunkSizes = {
+      100, 2 * kFramesPerBlock + 1, 3, kFramesPerBlock, kNumOutputFrames};
+  std::vector<float> output(kNumOutputFrames * kNumStereoChannels);
+  size_t chunk_index = 0;
+  while (renderer.GetNumRenderedFrames() < kNumOutputFrames) {
+    const size_t num_rendered_frames = renderer.GetNumRenderedFrames();
+    const size_t num_frames =
+        std::min(kChunkSizes[chunk_index++ % kChunkSizes.size()],
+                 kNumOutputFrames - num_rendered_frames);
+    ASSERT_TRUE(renderer.RenderInterleaved(
+        kNumStereoChannels, num_frames,
+        output.data() + num_rendered_frames * kNumStereoChannels));
+  }
+
+  ASSERT_EQ(expected_output.size(), output.size());
+  for (size_t i = 0; i < output.size(); ++i) {
+    EXPECT_NEAR(expected_output[i], output[i], kEpsilon) << "at sample " << i;
+  }
+}
+
+// Tests that planar and interleaved source audio and output render the same
+// signal.
+TEST(OfflineRendererImplTest, PlanarMatchesInterleaved) {
+  const std::vector<float> source_audio = GenerateSourceAudio();
+  const float* const planar_source_ptrs[] = {source_audio.data()};
+
+  OfflineRendererImpl interleaved_renderer(kNumStereoChannels, kFramesPerBlock,
+                                           kSampleRateHz);
+  interleaved_renderer.AddStereoSource(source_audio.data(), kNumMonoChannels,
+                                       kNumSourceFrames, kSourceStartFrame);
+  std::vector<float> interleaved_output(kNumOutputFrames * kNumStereoChannels);
+  ASSERT_TRUE(interleaved_renderer.RenderInterleaved(
+      kNumStereoChannels, kNumOutputFrames, interleaved_output.data()));
+
+  OfflineRendererImpl planar_renderer(kNumStereoChannels, kFramesPerBlock,
+                                      kSampleRateHz);
+  planar_renderer.AddStereoSource(planar_source_ptrs, kNumMonoChannels,
+                                  kNumSourceFrames, kSourceStartFrame);
+  std::vector<float> left(kNumOutputFrames);
+  std::vector<float> right(kNumOutputFrames);
+  float* const planar_output_ptrs[] = {left.data(), right.data()};
+  ASSERT_TRUE(planar_renderer.RenderPlanar(kNumStereoChannels, kNumOutputFrames,
+                                           planar_output_ptrs));
+
+  for (size_t frame = 0; frame < kNumOutputFrames; ++frame) {
+    EXPECT_EQ(interleaved_output[kNumStereoChannels * frame], left[frame]);
+    EXPECT_EQ(interleaved_output[kNumStereoChannels * frame + 1],
+              right[frame]);
+  }
+  // The output before the source start must be silent.
+  EXPECT_TRUE(std::all_of(left.begin(), left.begin() + kSourceStartFrame,
+                          [](float sample) { return sample == 0.0f; }));
+}
+
+// Returns the properties of a small room with the given reverb |rt60|.
+void GetRoomProperties(float rt60, ReflectionProperties* reflections,
+                       ReverbProperties* reverb) {
+  reflections->room_dimensions[0] = 4.0f;
+  reflections->room_dimensions[1] = 3.0f;
+  reflections->room_dimensions[2] = 5.0f;
+  std::fill(std::begin(reflections->coefficients),
+            std::end(reflections->coefficients), 0.5f);
+  reflections->gain = 1.0f;
+  std::fill(std::begin(reverb->rt60_values), std::end(reverb->rt60_values),
+            rt60);
+  reverb->gain = 1.0f;
+}
+
+// Tests that a timeline rendered after a reset matches the same timeline
+// rendered by a new renderer, including the room effects.
+TEST(OfflineRendererImplTest, ResetRendersLikeNewInstance) {
+  const std::vector<float> source_audio = GenerateSourceAudio();
+  const std::vector<float> previous_audio(kNumSourceFrames, 1.0f);
+
+  // Adds the test timeline to |renderer| and renders it.
+  const auto render_timeline = [&source_audio](OfflineRendererImpl* renderer) {
+    ReflectionProperties reflections;
+    ReverbProperties reverb;
+    GetRoomProperties(0.3f, &reflections, &reverb);
+    renderer->GetApi()->SetReflectionProperties(reflections);
+    renderer->GetApi()->SetReverbProperties(reverb);
+    const ResonanceAudioApi::SourceId source_id =
+        renderer->AddSoundObjectSource(source_audio.data(), kNumMonoChannels,
+                                       kNumSourceFrames, kSourceStartFrame,
+                                       kBinauralHighQuality);
+    renderer->AddSourcePositionKeyframe(source_id, kStartKeyframe, kStartX,
+                                        0.0f, -1.0f);
+    renderer->AddSourcePositionKeyframe(source_id, kEndKeyframe, kEndX, 0.0f,
+                                        -1.0f);
+    std::vector<float> output(kNumOutputFrames * kNumStereoChannels);
+    EXPECT_TRUE(renderer->RenderInterleaved(kNumStereoChannels,
+                                            kNumOutputFrames, output.data()));
+    return output;
+  };
+
+  OfflineRendererImpl new_renderer(kNumStereoChannels, kFramesPerBlock,
+                                   kSampleRateHz);
+  const std::vector<float> expected_output = render_timeline(&new_renderer);
+
+  // Renders a previous timeline with a different source, room, listener pose
+  // and master volume, and stops mid-way through it.
+  OfflineRendererImpl reset_renderer(kNumStereoChannels, kFramesPerBlock,
+                                     kSampleRateHz);
+  ReflectionProperties previous_reflections;
+  ReverbProperties previous_reverb;
+  GetRoomProperties(2.0f, &previous_reflections, &previous_reverb);
+  reset_renderer.GetApi()->SetReflectionProperties(previous_reflections);
+  reset_renderer.GetApi()->SetReverbProperties(previous_reverb);
+  const ResonanceAudioApi::SourceId previous_source_id =
+      reset_renderer.AddSoundObjectSource(previous_audio.data(),
+                                          kNumMonoChannels, kNumSourceFrames,
+                                          0, kBinauralHighQuality);
+  reset_renderer.AddSourcePositionKeyframe(previous_source_id, 0, 1.0f, 0.0f,
+                                           0.0f);
+  reset_renderer.AddHeadPositionKeyframe(0, 0.0f, 1.0f, 0.0f);
+  reset_renderer.AddMasterVolumeKeyframe(0, 0.5f);
+  std::vector<float> previous_output(kFramesPerBlock * kNumStereoChannels);
+  ASSERT_TRUE(reset_renderer.RenderInterleaved(
+      kNumStereoChannels, kFramesPerBlock / 2, previous_output.data()));
+
+  reset_renderer.Reset();
+  EXPECT_EQ(0U, reset_renderer.GetNumTimelineFrames());
+  EXPECT_EQ(0U, reset_renderer.GetNumRenderedFrames());
+  const std::vector<float> output = render_timeline(&reset_renderer);
+
+  ASSERT_EQ(expected_output.size(), output.size());
+  for (size_t i = 0; i < output.size(); ++i) {
+    EXPECT_NEAR(expected_output[i], output[i], kEpsilon) << "at sample " << i;
+  }
+}
+
+// Tests that source and master volume keyframes within a block take effect
+// within the block, rather than at the start of the next block.
+TEST(OfflineRendererImplTest, FollowsKeyframesWithinBlock) {
+  const size_t kNumFrames = 2 * OfflineRenderer::kDefaultFramesPerBlock;
+  const size_t kFadeStartFrame = 1000;
+  const size_t kFadeEndFrame = 5000;
+  const float kFadeEndVolume = 0.5f;
+  const std::vector<float> source_audio(kNumFrames, 1.0f);
+
+  for (const bool fade_master_volume : {false, true}) {
+    OfflineRendererImpl renderer(kNumStereoChannels,
+                                 OfflineRenderer::kDefaultFramesPerBlock,
+                                 kSampleRateHz);
+    const ResonanceAudioApi::SourceId source_id = renderer.AddStereoSource(
+        source_audio.data(), kNumMonoChannels, kNumFrames, 0);
+    if (fade_master_volume) {
+      renderer.AddMasterVolumeKeyframe(kFadeStartFrame, 1.0f);
+      renderer.AddMasterVolumeKeyframe(kFadeEndFrame, kFadeEndVolume);
+    } else {
+      renderer.AddSourceVolumeKeyframe(source_id, kFadeStartFrame, 1.0f);
+      renderer.AddSourceVolumeKeyframe(source_id, kFadeEndFrame,
+                                       kFadeEndVolume);
+    }
+    std::vector<float> output(kNumFrames * kNumStereoChannels);
+    ASSERT_TRUE(renderer.RenderInterleaved(kNumStereoChannels, kNumFrames,
+                                           output.data()));
+
+    for (size_t frame = 0; frame < kNumFrames; ++frame) {
+      float volume = 1.0f;
+      if (frame >= kFadeEndFrame) {
+        volume = kFadeEndVolume;
+      } else if (frame > kFadeStartFrame) {
+        volume -= (1.0f - kFadeEndVolume) *
+                  static_cast<float>(frame - kFadeStartFrame) /
+                  static_cast<float>(kFadeEndFrame - kFadeStartFrame);
+      }
+      ASSERT_NEAR(volume, output[frame * kNumStereoChannels], kEpsilonFloat)
+          << "at frame " << frame;
+    }
+  }
+}
+
+}  // namespace
+
+}  // namespace vraudio
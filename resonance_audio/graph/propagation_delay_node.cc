@@ -0,0 +1,136 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "graph/propagation_delay_node.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "base/constants_and_types.h"
+#include "base/logging.h"
+
+namespace vraudio {
+
+namespace {
+
+// Maximum propagation delay, which corresponds to a distance of 343 meters.
+const float kMaxPropagationDelaySeconds = 1.0f;
+
+// Maximum change of the delay per frame in samples. This limits the Doppler
+// shift to an octave down and a fifth up, and avoids the delay line being read
+// backwards when sources move faster than sound or jump in space.
+const float kMaxDelayChangePerFrame = 0.5f;
+
+// Minimum delay supported by the interpolated delay line in samples. Sources
+// closer than this delay, i.e. about 3 centimeters at 48kHz, are clamped.
+const float kMinDelaySamples =
+    static_cast<float>(FractionalDelayTable::kNumTaps / 2);
+
+}  // namespace
+
+PropagationDelayNode::PropagationDelayNode(
+    SourceId source_id, const SystemSettings& system_settings,
+    const FractionalDelayTable& kernel_table)
+    : system_settings_(system_settings),
+      kernel_table_(kernel_table),
+      max_delay_samples_(kMaxPropagationDelaySeconds *
+                         static_cast<float>(system_settings.GetSampleRateHz())),
+      max_delay_length_(static_cast<size_t>(max_delay_samples_) +
+                        FractionalDelayTable::kNumTaps / 2 + 1),
+      delay_filter_(0, system_settings.GetFramesPerBuffer()),
+      is_enabled_(false),
+      current_delay_samples_(kMinDelaySamples),
+      num_frames_processed_on_empty_input_(std::numeric_limits<size_t>::max()),
+      output_buffer_(kNumMonoChannels, system_settings.GetFramesPerBuffer()),
+      silence_mono_buffer_(kNumMonoChannels,
+                           system_settings.GetFramesPerBuffer()) {
+  output_buffer_.Clear();
+  output_buffer_.set_source_id(source_id);
+  silence_mono_buffer_.Clear();
+  EnableProcessOnEmptyInput(true);
+}
+
+void PropagationDelayNode::AllocateDelayLine() {
+  if (delay_filter_.GetMaximumDelayLength() < max_delay_length_) {
+    delay_filter_.SetMaximumDelay(max_delay_length_);
+  }
+}
+
+float PropagationDelayNode::ComputeDelaySamples(float distance) const {
+  const float delay_samples =
+      distance / kSpeedOfSound *
+      static_cast<float>(system_settings_.GetSampleRateHz());
+  return std::min(std::max(delay_samples, kMinDelaySamples),
+                  max_delay_samples_);
+}
+
+const AudioBuffer* PropagationDelayNode::AudioProcess(const NodeInput& input) {
+
+  const AudioBuffer* input_buffer = input.GetSingleInput();
+  const auto source_parameters =
+      system_settings_.GetSourceParameters(output_buffer_.source_id());
+  if (source_parameters == nullptr ||
+      !source_parameters->enable_propagation_delay ||
+      delay_filter_.GetMaximumDelayLength() < max_delay_length_) {
+    is_enabled_ = false;
+    return input_buffer;
+  }
+
+  const size_t num_frames = system_settings_.GetFramesPerBuffer();
+  const float target_delay_samples =
+      ComputeDelaySamples(source_parameters->geometry.distance);
+  if (!is_enabled_) {
+    // Start from the current distance without a Doppler glide.
+    delay_filter_.ClearBuffer();
+    current_delay_samples_ = target_delay_samples;
+    num_frames_processed_on_empty_input_ = std::numeric_limits<size_t>::max();
+    is_enabled_ = true;
+  }
+
+  if (input_buffer == nullptr) {
+    // If we have no input, generate a silent input buffer until the delayed
+    // tail has been rendered.
+    const size_t num_tail_frames =
+        static_cast<size_t>(current_delay_samples_) +
+        FractionalDelayTable::kNumTaps;
+    if (num_frames_processed_on_empty_input_ < num_tail_frames) {
+      num_frames_processed_on_empty_input_ += num_frames;
+      input_buffer = &silence_mono_buffer_;
+    } else {
+      return nullptr;
+    }
+  } else {
+    num_frames_processed_on_empty_input_ = 0;
+    DCHECK_EQ(input_buffer->num_channels(), kNumMonoChannels);
+  }
+
+  // Limit the rate of change of the delay.
+  const float max_delay_change =
+      kMaxDelayChangePerFrame * static_cast<float>(num_frames);
+  const float delay_samples =
+      current_delay_samples_ +
+      std::min(std::max(target_delay_samples - current_delay_samples_,
+                        -max_delay_change),
+               max_delay_change);
+  delay_filter_.InsertData((*input_buffer)[0]);
+  delay_filter_.GetInterpolatedDelayedData(current_delay_samples_,
+                                           delay_samples, kernel_table_,
+                                           &output_buffer_[0]);
+  current_delay_samples_ = delay_samples;
+  return &output_buffer_;
+}
+
+}  // namespace vraudio
@@ -0,0 +1,98 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef RESONANCE_AUDIO_GRAPH_PROPAGATION_DELAY_NODE_H_
+#define RESONANCE_AUDIO_GRAPH_PROPAGATION_DELAY_NODE_H_
+
+#include "base/audio_buffer.h"
+#include "dsp/delay_filter.h"
+#include "dsp/fractional_delay_table.h"
+#include "graph/system_settings.h"
+#include "node/processing_node.h"
+
+namespace vraudio {
+
+// Node that accepts a single mono buffer as input and outputs the buffer
+// delayed by the propagation time of sound from the source to the listener.
+// The delay follows the source distance smoothly, which results in a Doppler
+// shift for moving sources or listeners. The input is passed through when the
+// propagation delay of the source is disabled.
+class PropagationDelayNode : public ProcessingNode {
+ public:
+  // Constructor.
+  //
+  // @param source_id Output buffer source id.
+  // @param system_settings Global system settings.
+  // @param kernel_table Fractional delay interpolation kernels shared by all
+  //     the sources.
+  PropagationDelayNode(SourceId source_id,
+                       const SystemSettings& system_settings,
+                       const FractionalDelayTable& kernel_table);
+
+  // Allocates the delay line to hold the maximum propagation delay. The input
+  // is passed through until this has been called, so that the delay line is
+  // only allocated for sources which enable their propagation delay, and never
+  // from within |AudioProcess|. Calls to this method must be synchronized with
+  // the audio graph processing.
+  void AllocateDelayLine();
+
+ protected:
+  // Implements ProcessingNode.
+  const AudioBuffer* AudioProcess(const NodeInput& input) override;
+
+ private:
+  friend class PropagationDelayNodeTest;
+
+  // Returns the propagation delay in samples for the given |distance|, clamped
+  // to the range supported by |delay_filter_|.
+  float ComputeDelaySamples(float distance) const;
+
+  const SystemSettings& system_settings_;
+
+  // Fractional delay interpolation kernels.
+  const FractionalDelayTable& kernel_table_;
+
+  // Maximum propagation delay in samples.
+  const float max_delay_samples_;
+
+  // Length of the delay line required for |max_delay_samples_|, including the
+  // interpolation kernel.
+  const size_t max_delay_length_;
+
+  // Delay line, which is only allocated to hold |max_delay_length_| by
+  // |AllocateDelayLine|.
+  DelayFilter delay_filter_;
+
+  // Denotes whether the propagation delay was enabled for the previous buffer.
+  bool is_enabled_;
+
+  // Delay applied to the last frame of the previous buffer in samples.
+  float current_delay_samples_;
+
+  // Number of frames processed since the input has become empty.
+  size_t num_frames_processed_on_empty_input_;
+
+  // Output buffer.
+  AudioBuffer output_buffer_;
+
+  // Silence mono buffer to render the delayed tail during the absence of input
+  // buffers.
+  AudioBuffer silence_mono_buffer_;
+};
+
+}  // namespace vraudio
+
+#endif  // RESONANCE_AUDIO_GRAPH_PROPAGATION_DELAY_NODE_H_
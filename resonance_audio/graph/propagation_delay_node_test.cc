@@ -0,0 +1,163 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "graph/propagation_delay_node.h"
+
+#include <vector>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+#include "base/constants_and_types.h"
+#include "utils/test_util.h"
+
+namespace vraudio {
+
+namespace {
+
+// Number of frames per buffer.
+const size_t kFramesPerBuffer = 256;
+
+// Sampling rate.
+const int kSampleRate = 48000;
+
+// Source id.
+const SourceId kSourceId = 1;
+
+// Propagation delay in samples used in the tests below.
+const size_t kDelaySamples = 300;
+
+}  // namespace
+
+class PropagationDelayNodeTest : public ::testing::Test {
+ protected:
+  PropagationDelayNodeTest()
+      : system_settings_(kNumStereoChannels, kFramesPerBuffer, kSampleRate) {}
+
+  void SetUp() override {
+    system_settings_.GetSourceParametersManager()->Register(kSourceId);
+  }
+
+  // Returns the output of the |AudioProcess| method of |node| for the given
+  // |input_buffer|, which may be nullptr to denote an empty input.
+  const AudioBuffer* GetProcessedData(const AudioBuffer* input_buffer,
+                                      PropagationDelayNode* node) {
+    std::vector<const AudioBuffer*> input_buffers;
+    if (input_buffer != nullptr) {
+      input_buffers.push_back(input_buffer);
+    }
+    return node->AudioProcess(ProcessingNode::NodeInput(input_buffers));
+  }
+
+  // Returns a pointer to the parameters of the source.
+  SourceParameters* GetParameters() {
+    return system_settings_.GetSourceParametersManager()->GetMutableParameters(
+        kSourceId);
+  }
+
+  // System settings.
+  SystemSettings system_settings_;
+
+  // Interpolation kernels.
+  FractionalDelayTable kernel_table_;
+};
+
+// Tests that the input is passed through when the propagation delay is
+// disabled or its delay line has not been allocated.
+TEST_F(PropagationDelayNodeTest, DisabledTest) {
+  PropagationDelayNode node(kSourceId, system_settings_, kernel_table_);
+  GetParameters()->geometry.distance = 10.0f;
+
+  AudioBuffer input(kNumMonoChannels, kFramesPerBuffer);
+  input.set_source_id(kSourceId);
+  GenerateDiracImpulseFilter(0, &input[0]);
+  EXPECT_EQ(&input, GetProcessedData(&input, &node));
+
+  // The input is also passed through while the delay line is not allocated.
+  GetParameters()->enable_propagation_delay = true;
+  EXPECT_EQ(&input, GetProcessedData(&input, &node));
+  node.AllocateDelayLine();
+  EXPECT_NE(&input, GetProcessedData(&input, &node));
+}
+
+// Tests that an impulse is delayed by the propagation time of the source, and
+// that the delayed tail is rendered after the input has become empty.
+TEST_F(PropagationDelayNodeTest, DelayTest) {
+  PropagationDelayNode node(kSourceId, system_settings_, kernel_table_);
+  SourceParameters* parameters = GetParameters();
+  node.AllocateDelayLine();
+  parameters->enable_propagation_delay = true;
+  parameters->geometry.distance = static_cast<float>(kDelaySamples) *
+                                  kSpeedOfSound /
+                                  static_cast<float>(kSampleRate);
+
+  AudioBuffer input(kNumMonoChannels, kFramesPerBuffer);
+  input.set_source_id(kSourceId);
+  GenerateDiracImpulseFilter(0, &input[0]);
+  std::vector<float> output_collect;
+  const AudioBuffer* output = GetProcessedData(&input, &node);
+  ASSERT_NE(nullptr, output);
+  output_collect.insert(output_collect.end(), (*output)[0].begin(),
+                        (*output)[0].end());
+  // The impulse arrives after the end of the input.
+  while ((output = GetProcessedData(nullptr, &node)) != nullptr) {
+    output_collect.insert(output_collect.end(), (*output)[0].begin(),
+                          (*output)[0].end());
+  }
+  ASSERT_GT(output_collect.size(), kDelaySamples);
+  for (size_t frame = 0; frame < output_collect.size(); ++frame) {
+    const float expected = frame == kDelaySamples ? 1.0f : 0.0f;
+    EXPECT_NEAR(expected, output_collect[frame], 1e-4f);
+  }
+}
+
+// Tests that a delay change is spread smoothly across the buffer instead of
+// being applied at once.
+TEST_F(PropagationDelayNodeTest, DopplerTest) {
+  PropagationDelayNode node(kSourceId, system_settings_, kernel_table_);
+  SourceParameters* parameters = GetParameters();
+  node.AllocateDelayLine();
+  parameters->enable_propagation_delay = true;
+  parameters->geometry.distance = 1.0f;
+
+  // Feed a ramp, so the output value reflects the read position directly.
+  AudioBuffer input(kNumMonoChannels, kFramesPerBuffer);
+  input.set_source_id(kSourceId);
+  float sample = 0.0f;
+  const size_t kNumBuffers = 8;
+  for (size_t buffer = 0; buffer < kNumBuffers; ++buffer) {
+    for (size_t frame = 0; frame < kFramesPerBuffer; ++frame) {
+      input[0][frame] = sample;
+      sample += 1.0f;
+    }
+    // Move the source away by 0.1 samples per frame after a few buffers.
+    if (buffer >= kNumBuffers / 2) {
+      parameters->geometry.distance +=
+          0.1f * static_cast<float>(kFramesPerBuffer) * kSpeedOfSound /
+          static_cast<float>(kSampleRate);
+    }
+    const AudioBuffer* output = GetProcessedData(&input, &node);
+    ASSERT_NE(nullptr, output);
+    if (buffer == 0) {
+      continue;
+    }
+    const float expected_slope = buffer >= kNumBuffers / 2 ? 0.9f : 1.0f;
+    for (size_t frame = 1; frame < kFramesPerBuffer; ++frame) {
+      EXPECT_NEAR(expected_slope, (*output)[0][frame] - (*output)[0][frame - 1],
+                  1e-2f);
+    }
+  }
+}
+
+}  // namespace vraudio
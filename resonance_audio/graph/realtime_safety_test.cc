@@ -0,0 +1,369 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+// Runs realistic rendering scenarios with the real-time safety checks, which
+// require a build with |ENABLE_REALTIME_SAFETY_CHECKS|. All setup, including
+// source creation and the first buffers which allocate processing state, is
+// excluded from the checks. The subsequent buffers must neither allocate nor
+// lock.
+
+#include <cmath>
+#include <functional>
+#include <vector>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+#include "api/resonance_audio_api.h"
+#include "base/constants_and_types.h"
+#include "graph/resonance_audio_api_impl.h"
+#include "utils/realtime_safety_checker.h"
+
+namespace vraudio {
+
+namespace {
+
+#if defined(ENABLE_REALTIME_SAFETY_CHECKS)
+
+const size_t kFramesPerBuffer = 256;
+const int kSampleRateHz = 48000;
+
+// Number of buffers rendered before the checks are enabled.
+const size_t kNumWarmUpBuffers = 16;
+
+// Number of buffers rendered with the checks enabled.
+const size_t kNumCheckedBuffers = 128;
+
+// Returns the options of the checked instance, which renders all supported
+// Ambisonic orders.
+ResonanceAudioApiOptions GetOptions() {
+  ResonanceAudioApiOptions options;
+  options.max_ambisonic_order = kMaxSupportedAmbisonicOrder;
+  return options;
+}
+
+class RealtimeSafetyTest : public ::testing::Test {
+ protected:
+  RealtimeSafetyTest()
+      : api_(kNumStereoChannels, kFramesPerBuffer, kSampleRateHz,
+             GetOptions()),
+        num_host_frames_(kFramesPerBuffer),
+        input_(kNumFirstOrderAmbisonicChannels * kFramesPerBuffer),
+        output_(kNumStereoChannels * kFramesPerBuffer) {
+    for (size_t i = 0; i < input_.size(); ++i) {
+      input_[i] = 0.5f * std::sin(0.01f * static_cast<float>(i));
+    }
+  }
+
+  // Enables room effects with reflections and reverb.
+  void EnableRoomEffects() {
+    api_.EnableRoomEffects(true);
+    ReflectionProperties reflection_properties;
+    for (size_t i = 0; i < 3; ++i) {
+      reflection_properties.room_dimensions[i] = 4.0f + static_cast<float>(i);
+    }
+    for (size_t i = 0; i < kNumRoomSurfaces; ++i) {
+      reflection_properties.coefficients[i] = 0.6f;
+    }
+    reflection_properties.gain = 1.0f;
+    api_.SetReflectionProperties(reflection_properties);
+    ReverbProperties reverb_properties;
+    for (size_t i = 0; i < kNumReverbOctaveBands; ++i) {
+      reverb_properties.rt60_values[i] = 0.8f;
+    }
+    reverb_properties.gain = 1.0f;
+    api_.SetReverbProperties(reverb_properties);
+  }
+
+  // Renders buffers first without and then with the checks. |update| is
+  // called before each buffer with the buffer index to feed sources and update
+  // parameters, and is not checked itself.
+  void RenderAndCheck(const std::function<void(size_t)>& update) {
+    for (size_t i = 0; i < kNumWarmUpBuffers; ++i) {
+      update(i);
+      api_.FillInterleavedOutputBuffer(kNumStereoChannels, num_host_frames_,
+                                       output_.data());
+    }
+    RealtimeSafetyChecker::Reset();
+    const size_t num_buffers = kNumWarmUpBuffers + kNumCheckedBuffers;
+    for (size_t i = kNumWarmUpBuffers; i < num_buffers; ++i) {
+      update(i);
+      api_.FillInterleavedOutputBuffer(kNumStereoChannels, num_host_frames_,
+                                       output_.data());
+    }
+    const auto violations = RealtimeSafetyChecker::GetViolations();
+    EXPECT_EQ(0U, RealtimeSafetyChecker::GetNumViolations());
+    for (const auto& violation : violations) {
+      ADD_FAILURE() << RealtimeSafetyChecker::DescribeViolation(violation);
+    }
+    RealtimeSafetyChecker::Reset();
+  }
+
+  // Feeds the next input buffer to a source.
+  void SetSourceInput(ResonanceAudioApi::SourceId source_id,
+                      size_t num_channels) {
+    api_.SetInterleavedBuffer(source_id, input_.data(), num_channels,
+                              num_host_frames_);
+  }
+
+  ResonanceAudioApiImpl api_;
+
+  // Host buffer size, which must not exceed |kFramesPerBuffer|.
+  size_t num_host_frames_;
+
+  std::vector<float> input_;
+  std::vector<float> output_;
+};
+
+// Tests moving sound objects of all rendering modes with room effects.
+TEST_F(RealtimeSafetyTest, MovingSoundObjectsWithRoomEffects) {
+  EnableRoomEffects();
+  const RenderingMode kRenderingModes[] = {
+      kStereoPanning,           kBinauralLowQuality,
+      kBinauralMediumQuality,   kBinauralHighQuality,
+      kBinauralVeryHighQuality, kBinauralUltraHighQuality,
+      kRoomEffectsOnly};
+  std::vector<ResonanceAudioApi::SourceId> source_ids;
+  for (int i = 0; i < 4; ++i) {
+    for (const RenderingMode rendering_mode : kRenderingModes) {
+      source_ids.push_back(api_.CreateSoundObjectSource(rendering_mode));
+    }
+  }
+
+  RenderAndCheck([this, &source_ids](size_t buffer) {
+    const float phase = 0.05f * static_cast<float>(buffer);
+    api_.SetHeadRotation(0.0f, std::sin(phase), 0.0f, std::cos(phase));
+    for (size_t i = 0; i < source_ids.size(); ++i) {
+      const ResonanceAudioApi::SourceId source_id = source_ids[i];
+      const float angle = phase + static_cast<float>(i);
+      SetSourceInput(source_id, kNumMonoChannels);
+      api_.SetSourcePosition(source_id, 2.0f * std::cos(angle), 0.5f,
+                             2.0f * std::sin(angle));
+      api_.SetSourceRotation(source_id, 0.0f, 0.0f, 0.0f, 1.0f);
+      api_.SetSourceVolume(source_id, 0.5f + 0.25f * std::sin(angle));
+      api_.SetSoundObjectDirectivity(source_id, 0.5f, 2.0f);
+      api_.SetSoundObjectListenerDirectivity(source_id, 0.5f, 1.0f);
+      api_.SetSoundObjectNearFieldEffectGain(source_id, 1.0f);
+      api_.SetSoundObjectOcclusionIntensity(source_id,
+                                            0.5f + 0.5f * std::sin(angle));
+      api_.SetSoundObjectSpread(source_id, 30.0f);
+    }
+  });
+}
+
+// Tests ambisonic and stereo sources alongside sound objects.
+TEST_F(RealtimeSafetyTest, AmbisonicAndStereoSources) {
+  const auto ambisonic_source_id =
+      api_.CreateAmbisonicSource(kNumFirstOrderAmbisonicChannels);
+  const auto stereo_source_id = api_.CreateStereoSource(kNumStereoChannels);
+  const auto sound_object_source_id =
+      api_.CreateSoundObjectSource(kBinauralHighQuality);
+
+  RenderAndCheck([&](size_t buffer) {
+    SetSourceInput(ambisonic_source_id, kNumFirstOrderAmbisonicChannels);
+    SetSourceInput(stereo_source_id, kNumStereoChannels);
+    SetSourceInput(sound_object_source_id, kNumMonoChannels);
+    api_.SetSourceRotation(ambisonic_source_id, 0.0f,
+                           std::sin(0.1f * static_cast<float>(buffer)), 0.0f,
+                           1.0f);
+    api_.SetMasterVolume(0.8f);
+  });
+}
+
+// Tests sources whose input is only available in some buffers.
+TEST_F(RealtimeSafetyTest, IntermittentSourceInput) {
+  EnableRoomEffects();
+  std::vector<ResonanceAudioApi::SourceId> source_ids;
+  for (int i = 0; i < 8; ++i) {
+    source_ids.push_back(api_.CreateSoundObjectSource(kBinauralMediumQuality));
+  }
+
+  RenderAndCheck([this, &source_ids](size_t buffer) {
+    for (size_t i = 0; i < source_ids.size(); ++i) {
+      if ((buffer + i) % 3 != 0) {
+        SetSourceInput(source_ids[i], kNumMonoChannels);
+      }
+    }
+  });
+}
+
+// Tests updates of the room properties in every buffer.
+TEST_F(RealtimeSafetyTest, RoomPropertiesUpdates) {
+  EnableRoomEffects();
+  const auto source_id = api_.CreateSoundObjectSource(kBinauralHighQuality);
+
+  RenderAndCheck([this, source_id](size_t buffer) {
+    SetSourceInput(source_id, kNumMonoChannels);
+    ReflectionProperties reflection_properties;
+    for (size_t i = 0; i < 3; ++i) {
+      reflection_properties.room_dimensions[i] =
+          4.0f + 0.01f * static_cast<float>(buffer);
+    }
+    for (size_t i = 0; i < kNumRoomSurfaces; ++i) {
+      reflection_properties.coefficients[i] = 0.6f;
+    }
+    reflection_properties.gain = 1.0f;
+    api_.SetReflectionProperties(reflection_properties);
+  });
+}
+
+// Tests sources crossfading their sends between two room zones.
+TEST_F(RealtimeSafetyTest, RoomZoneSendGainUpdates) {
+  EnableRoomEffects();
+  const auto room_zone_id = api_.CreateRoomZone();
+  ASSERT_NE(kInvalidRoomZoneId, room_zone_id);
+  ReflectionProperties reflection_properties;
+  for (size_t i = 0; i < 3; ++i) {
+    reflection_properties.room_dimensions[i] = 10.0f;
+  }
+  for (size_t i = 0; i < kNumRoomSurfaces; ++i) {
+    reflection_properties.coefficients[i] = 0.8f;
+  }
+  reflection_properties.gain = 1.0f;
+  api_.SetRoomZoneReflectionProperties(room_zone_id, reflection_properties);
+  ReverbProperties reverb_properties;
+  for (size_t i = 0; i < kNumReverbOctaveBands; ++i) {
+    reverb_properties.rt60_values[i] = 2.0f;
+  }
+  reverb_properties.gain = 1.0f;
+  api_.SetRoomZoneReverbProperties(room_zone_id, reverb_properties);
+  std::vector<ResonanceAudioApi::SourceId> source_ids;
+  for (int i = 0; i < 4; ++i) {
+    source_ids.push_back(api_.CreateSoundObjectSource(kBinauralLowQuality));
+  }
+
+  RenderAndCheck([this, &source_ids, room_zone_id](size_t buffer) {
+    for (size_t i = 0; i < source_ids.size(); ++i) {
+      const float crossfade =
+          0.5f + 0.5f * std::sin(0.05f * static_cast<float>(buffer + i));
+      SetSourceInput(source_ids[i], kNumMonoChannels);
+      api_.SetSourceRoomZoneSendGain(source_ids[i],
+                                     ResonanceAudioApi::kDefaultRoomZoneId,
+                                     crossfade);
+      api_.SetSourceRoomZoneSendGain(source_ids[i], room_zone_id,
+                                     1.0f - crossfade);
+    }
+  });
+}
+
+// Tests host buffer sizes which are re-blocked into graph buffers.
+TEST_F(RealtimeSafetyTest, ReblockedHostBuffers) {
+  num_host_frames_ = 100;
+  const auto ambisonic_source_id =
+      api_.CreateAmbisonicSource(kNumFirstOrderAmbisonicChannels);
+  const auto stereo_source_id = api_.CreateStereoSource(kNumStereoChannels);
+  std::vector<ResonanceAudioApi::SourceId> source_ids;
+  for (int i = 0; i < 4; ++i) {
+    source_ids.push_back(api_.CreateSoundObjectSource(kBinauralHighQuality));
+  }
+
+  RenderAndCheck([this, &source_ids, ambisonic_source_id,
+                  stereo_source_id](size_t buffer) {
+    SetSourceInput(ambisonic_source_id, kNumFirstOrderAmbisonicChannels);
+    SetSourceInput(stereo_source_id, kNumStereoChannels);
+    for (size_t i = 0; i < source_ids.size(); ++i) {
+      // Every other source skips a buffer now and then to be realigned.
+      if (i % 2 == 0 || (buffer + i) % 5 != 0) {
+        SetSourceInput(source_ids[i], kNumMonoChannels);
+      }
+    }
+  });
+}
+
+// Tests sources at other sample rates, which change their sample rate and
+// number of input channels after the resampling stages have been allocated.
+TEST_F(RealtimeSafetyTest, ResampledSourceChanges) {
+  const int kSourceSampleRatesHz[] = {44100, 32000};
+  const auto stereo_source_id = api_.CreateStereoSource(kNumStereoChannels);
+  const auto sound_object_source_id =
+      api_.CreateSoundObjectSource(kBinauralHighQuality);
+  int source_sample_rate_hz = 0;
+
+  RenderAndCheck([&](size_t buffer) {
+    // Change the sample rate every eight buffers. Each rate is used during the
+    // warm-up before.
+    const int next_source_sample_rate_hz = kSourceSampleRatesHz[buffer / 8 % 2];
+    if (next_source_sample_rate_hz != source_sample_rate_hz) {
+      source_sample_rate_hz = next_source_sample_rate_hz;
+      api_.SetSourceSampleRate(stereo_source_id, source_sample_rate_hz);
+      api_.SetSourceSampleRate(sound_object_source_id, source_sample_rate_hz);
+    }
+    // Pass the number of source frames covering the next output buffer.
+    const size_t num_frames =
+        (buffer + 1) * kFramesPerBuffer * source_sample_rate_hz /
+            kSampleRateHz -
+        buffer * kFramesPerBuffer * source_sample_rate_hz / kSampleRateHz;
+    const size_t num_stereo_input_channels =
+        buffer % 2 == 0 ? kNumStereoChannels : kNumMonoChannels;
+    api_.SetInterleavedBuffer(stereo_source_id, input_.data(),
+                              num_stereo_input_channels, num_frames);
+    api_.SetInterleavedBuffer(sound_object_source_id, input_.data(),
+                              kNumMonoChannels, num_frames);
+  });
+}
+
+// Tests toggling the propagation delay of moving sound objects, whose delay
+// lines are allocated when the delay is first enabled during the warm-up.
+TEST_F(RealtimeSafetyTest, PropagationDelayToggling) {
+  std::vector<ResonanceAudioApi::SourceId> source_ids;
+  for (int i = 0; i < 4; ++i) {
+    const auto source_id = api_.CreateSoundObjectSource(kBinauralLowQuality);
+    api_.SetSoundObjectPropagationDelayEnabled(source_id, true);
+    source_ids.push_back(source_id);
+  }
+
+  RenderAndCheck([this, &source_ids](size_t buffer) {
+    for (size_t i = 0; i < source_ids.size(); ++i) {
+      const ResonanceAudioApi::SourceId source_id = source_ids[i];
+      SetSourceInput(source_id, kNumMonoChannels);
+      api_.SetSourcePosition(
+          source_id, 1.0f + static_cast<float>((buffer + i) % 16), 0.0f, 0.0f);
+      if (buffer % 8 == i) {
+        api_.SetSoundObjectPropagationDelayEnabled(source_id, buffer % 16 < 8);
+      }
+    }
+  });
+}
+
+// Tests toggling the clustering of distant sound objects, whose clustering
+// states are allocated when the clustering is first enabled during the warm-up.
+TEST_F(RealtimeSafetyTest, ClusteringToggling) {
+  std::vector<ResonanceAudioApi::SourceId> source_ids;
+  for (int i = 0; i < 32; ++i) {
+    const auto source_id = api_.CreateSoundObjectSource(kBinauralHighQuality);
+    api_.SetSoundObjectClusteringEnabled(source_id, true);
+    source_ids.push_back(source_id);
+  }
+
+  RenderAndCheck([this, &source_ids](size_t buffer) {
+    for (size_t i = 0; i < source_ids.size(); ++i) {
+      const ResonanceAudioApi::SourceId source_id = source_ids[i];
+      const float angle = 0.05f * static_cast<float>(buffer) +
+                          0.2f * static_cast<float>(i);
+      SetSourceInput(source_id, kNumMonoChannels);
+      api_.SetSourcePosition(source_id, 10.0f * std::cos(angle), 0.0f,
+                             10.0f * std::sin(angle));
+      if (buffer % 16 == i % 16) {
+        api_.SetSoundObjectClusteringEnabled(source_id, buffer % 32 < 16);
+      }
+    }
+  });
+}
+
+#endif  // defined(ENABLE_REALTIME_SAFETY_CHECKS)
+
+}  // namespace
+
+}  // namespace vraudio
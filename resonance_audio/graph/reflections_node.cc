@@ -16,6 +16,9 @@ limitations under the License.
 
 #include "graph/reflections_node.h"
 
+#include <algorithm>
+
+#include "ambisonics/utils.h"
 #include "base/constants_and_types.h"
 #include "base/logging.h"
 #include "base/misc_math.h"
@@ -23,16 +26,30 @@ limitations under the License.
 
 namespace vraudio {
 
-ReflectionsNode::ReflectionsNode(const SystemSettings& system_settings)
+ReflectionsNode::ReflectionsNode(const SystemSettings& system_settings,
+                                 const AmbisonicLookupTable& lookup_table,
+                                 RoomZoneId room_zone_id, int reflection_order,
+                                 int max_reflection_order)
     : system_settings_(system_settings),
+      room_zone_id_(room_zone_id),
+      reflection_order_(reflection_order),
+      max_reflection_order_(max_reflection_order),
+      is_active_(true),
       reflections_processor_(system_settings_.GetSampleRateHz(),
-                             system_settings_.GetFramesPerBuffer()),
+                             system_settings_.GetFramesPerBuffer(),
+                             lookup_table, reflection_order_),
       num_frames_processed_on_empty_input_(
           system_settings_.GetFramesPerBuffer()),
-      output_buffer_(kNumFirstOrderAmbisonicChannels,
+      output_buffer_(GetNumPeriphonicComponents(reflection_order_),
                      system_settings_.GetFramesPerBuffer()),
       silence_mono_buffer_(kNumMonoChannels,
                            system_settings_.GetFramesPerBuffer()) {
+  DCHECK_GE(reflection_order_, 1);
+  DCHECK_LE(reflection_order_, max_reflection_order_);
+  DCHECK_LE(max_reflection_order_, kMaxReflectionOrder);
+  if (reflection_order_ > 1) {
+    hoa_rotator_.reset(new HoaRotator(reflection_order_));
+  }
   silence_mono_buffer_.Clear();
   EnableProcessOnEmptyInput(true);
 }
@@ -41,7 +58,7 @@ void ReflectionsNode::Update() {
 
   const auto& current_reflection_properties = reflection_properties_;
   const auto& new_reflection_properties =
-      system_settings_.GetReflectionProperties();
+      system_settings_.GetRoomZoneReflectionProperties(room_zone_id_);
   const bool room_position_changed =
       !EqualSafe(std::begin(current_reflection_properties.room_position),
                  std::end(current_reflection_properties.room_position),
@@ -65,6 +82,10 @@ void ReflectionsNode::Update() {
                  std::end(current_reflection_properties.coefficients),
                  std::begin(new_reflection_properties.coefficients),
                  std::end(new_reflection_properties.coefficients));
+  const int active_reflection_order = std::min(
+      std::max(new_reflection_properties.reflection_order, 1),
+      max_reflection_order_);
+  is_active_ = active_reflection_order == reflection_order_;
   const auto& current_listener_position = listener_position_;
   const auto& new_listener_position = system_settings_.GetHeadPosition();
   const bool listener_position_changed =
@@ -81,7 +102,9 @@ void ReflectionsNode::Update() {
 
 const AudioBuffer* ReflectionsNode::AudioProcess(const NodeInput& input) {
 
-  const AudioBuffer* input_buffer = input.GetSingleInput();
+  // Inactive nodes only render the remaining reflection tails.
+  const AudioBuffer* input_buffer =
+      is_active_ ? input.GetSingleInput() : nullptr;
   const size_t num_frames = system_settings_.GetFramesPerBuffer();
   if (input_buffer == nullptr) {
     // If we have no input, generate a silent input buffer until the node states
@@ -104,7 +127,13 @@ const AudioBuffer* ReflectionsNode::AudioProcess(const NodeInput& input) {
   // Rotate the reflections with respect to listener's orientation.
   const WorldRotation inverse_head_rotation =
       system_settings_.GetHeadRotation().conjugate();
-  foa_rotator_.Process(inverse_head_rotation, output_buffer_, &output_buffer_);
+  if (hoa_rotator_ != nullptr) {
+    hoa_rotator_->Process(inverse_head_rotation, output_buffer_,
+                          &output_buffer_);
+  } else {
+    foa_rotator_.Process(inverse_head_rotation, output_buffer_,
+                         &output_buffer_);
+  }
 
   // Copy buffer parameters.
   return &output_buffer_;
@@ -17,9 +17,12 @@ limitations under the License.
 #ifndef RESONANCE_AUDIO_GRAPH_REFLECTIONS_NODE_H_
 #define RESONANCE_AUDIO_GRAPH_REFLECTIONS_NODE_H_
 
+#include <memory>
 #include <vector>
 
+#include "ambisonics/ambisonic_lookup_table.h"
 #include "ambisonics/foa_rotator.h"
+#include "ambisonics/hoa_rotator.h"
 #include "api/resonance_audio_api.h"
 #include "base/audio_buffer.h"
 #include "base/misc_math.h"
@@ -33,10 +36,24 @@ namespace vraudio {
 // encoded sound field buffer of the mix of all the early room reflections.
 class ReflectionsNode : public ProcessingNode {
  public:
-  // Initializes |ReflectionsNode| class.
+  // Initializes |ReflectionsNode| class for a room zone and a given reflection
+  // order. The node renders the reflections only while the reflection order of
+  // the room zone, clamped to |max_reflection_order|, equals
+  // |reflection_order|, and only renders the remaining reflection tails
+  // otherwise.
   //
   // @param system_settings Global system configuration.
-  explicit ReflectionsNode(const SystemSettings& system_settings);
+  // @param lookup_table Ambisonic encoding lookup table of at least
+  //     |reflection_order|.
+  // @param room_zone_id Id of room zone to render the reflections of.
+  // @param reflection_order Image source order, which is also the ambisonic
+  //     order of the output.
+  // @param max_reflection_order Maximum reflection order rendered for the room
+  //     zone.
+  ReflectionsNode(const SystemSettings& system_settings,
+                  const AmbisonicLookupTable& lookup_table,
+                  RoomZoneId room_zone_id, int reflection_order,
+                  int max_reflection_order);
 
   // Updates the reflections. Depending on whether to use RT60s for reverb
   // according to the global system settings, the reflections are calculated
@@ -50,10 +67,27 @@ class ReflectionsNode : public ProcessingNode {
  private:
   const SystemSettings& system_settings_;
 
+  // Id of room zone to render the reflections of.
+  const RoomZoneId room_zone_id_;
+
+  // Image source order rendered by this node.
+  const int reflection_order_;
+
+  // Maximum reflection order rendered for the room zone.
+  const int max_reflection_order_;
+
+  // Denotes whether the reflection order of the room zone is rendered by this
+  // node.
+  bool is_active_;
+
   // First-order-ambisonics rotator to be used to rotate the reflections with
   // respect to the listener's orientation.
   FoaRotator foa_rotator_;
 
+  // Higher-order-ambisonics rotator used instead of |foa_rotator_| when the
+  // |reflection_order_| is higher than one.
+  std::unique_ptr<HoaRotator> hoa_rotator_;
+
   // Processes and encodes reflections into an ambisonic buffer.
   ReflectionsProcessor reflections_processor_;
 
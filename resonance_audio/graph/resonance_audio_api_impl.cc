@@ -17,6 +17,9 @@ limitations under the License.
 #include "graph/resonance_audio_api_impl.h"
 
 #include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
 #include <numeric>
 
 #include "ambisonics/utils.h"
@@ -29,10 +32,15 @@ limitations under the License.
 #include "config/source_config.h"
 #include "dsp/channel_converter.h"
 #include "dsp/distance_attenuation.h"
+#include "dsp/resampler.h"
 #include "graph/source_parameters_manager.h"
 #include "utils/planar_interleaved_conversion.h"
 #include "utils/sample_type_conversion.h"
 
+#if defined(ENABLE_REALTIME_SAFETY_CHECKS)
+#include "utils/realtime_safety_checker.h"
+#endif  // defined(ENABLE_REALTIME_SAFETY_CHECKS)
+
 namespace vraudio {
 
 namespace {
@@ -40,11 +48,15 @@ namespace {
 // Support 50 setter calls for 512 sources.
 const size_t kMaxNumTasksOnTaskQueue = 50 * 512;
 
+#if defined(ENABLE_NODE_PROFILING)
+// Number of most recent node processing calls kept for the trace export.
+const size_t kMaxNumNodeTraceEvents = 1 << 16;
+#endif  // defined(ENABLE_NODE_PROFILING)
+
 // User warning/notification messages.
 static const char* kBadInputPointerMessage = "Ignoring nullptr buffer";
-static const char* kBufferSizeMustMatchNumFramesMessage =
-    "Number of frames must match the frames per buffer specified during "
-    "construction - ignoring buffer";
+static const char* kSourceBufferNotFoundMessage =
+    "Source audio buffer not found";
 
 // Helper method to fetch |SourceGraphConfig| from |RenderingMode|.
 SourceGraphConfig GetSourceGraphConfigFromRenderingMode(
@@ -58,6 +70,10 @@ SourceGraphConfig GetSourceGraphConfigFromRenderingMode(
       return BinauralMediumQualityConfig();
     case RenderingMode::kBinauralHighQuality:
       return BinauralHighQualityConfig();
+    case RenderingMode::kBinauralVeryHighQuality:
+      return BinauralVeryHighQualityConfig();
+    case RenderingMode::kBinauralUltraHighQuality:
+      return BinauralUltraHighQualityConfig();
     case RenderingMode::kRoomEffectsOnly:
       return RoomEffectsOnlyConfig();
     default:
@@ -67,14 +83,40 @@ SourceGraphConfig GetSourceGraphConfigFromRenderingMode(
   return BinauralHighQualityConfig();
 }
 
+// Returns whether |room_zone_id| is in range [0, |kMaxNumRoomZones|).
+bool IsValidRoomZoneId(RoomZoneId room_zone_id) {
+  return room_zone_id >= 0 &&
+         static_cast<size_t>(room_zone_id) < kMaxNumRoomZones;
+}
+
 }  // namespace
 
 ResonanceAudioApiImpl::ResonanceAudioApiImpl(size_t num_channels,
                                              size_t frames_per_buffer,
                                              int sample_rate_hz)
-    : system_settings_(num_channels, frames_per_buffer, sample_rate_hz),
+    : ResonanceAudioApiImpl(num_channels, frames_per_buffer, sample_rate_hz,
+                            ResonanceAudioApiOptions()) {}
+
+ResonanceAudioApiImpl::ResonanceAudioApiImpl(
+    size_t num_channels, size_t frames_per_buffer, int sample_rate_hz,
+    const ResonanceAudioApiOptions& options)
+    : system_settings_(num_channels, frames_per_buffer, sample_rate_hz,
+                       options.reverb_algorithm, options.reverb_quality),
       task_queue_(kMaxNumTasksOnTaskQueue),
-      source_id_counter_(0) {
+      source_id_counter_(0),
+      room_zone_id_mask_(1U << kDefaultRoomZoneId),
+      host_frames_gcd_(frames_per_buffer),
+      latency_frames_(0),
+      num_host_frames_(0),
+      num_processed_frames_(0),
+      silence_buffer_(kNumStereoChannels, frames_per_buffer),
+      deadline_monitor_(frames_per_buffer, sample_rate_hz),
+      reblocked_output_valid_(true)
+#if defined(ENABLE_NODE_PROFILING)
+      ,
+      node_profiler_(kMaxNumNodeTraceEvents)
+#endif  // defined(ENABLE_NODE_PROFILING)
+{
   if (num_channels != kNumStereoChannels) {
     LOG(FATAL) << "Only stereo output is supported";
     return;
@@ -92,7 +134,12 @@ ResonanceAudioApiImpl::ResonanceAudioApiImpl(size_t num_channels,
                << FftManager::kMinFftSize << " samples";
     return;
   }
-  graph_manager_.reset(new GraphManager(system_settings_));
+  graph_manager_.reset(
+      new GraphManager(system_settings_, options.max_ambisonic_order));
+  output_unpartitioner_.reset(new BufferUnpartitioner(
+      kNumStereoChannels, frames_per_buffer,
+      std::bind(&ResonanceAudioApiImpl::ProcessReblockedBuffer, this)));
+  silence_buffer_.Clear();
 }
 
 ResonanceAudioApiImpl::~ResonanceAudioApiImpl() {
@@ -128,6 +175,10 @@ bool ResonanceAudioApiImpl::FillPlanarOutputBuffer(size_t num_channels,
   return FillOutputBuffer<int16* const*>(num_channels, num_frames, buffer_ptr);
 }
 
+size_t ResonanceAudioApiImpl::GetLatencyFrames() const {
+  return latency_frames_.load();
+}
+
 void ResonanceAudioApiImpl::SetHeadPosition(float x, float y, float z) {
   auto task = [this, x, y, z]() {
     const WorldPosition head_position(x, y, z);
@@ -162,7 +213,7 @@ int ResonanceAudioApiImpl::CreateAmbisonicSource(size_t num_channels) {
   const int ambisonic_source_id = source_id_counter_.fetch_add(1);
 
   const size_t num_valid_channels =
-      std::min(num_channels, graph_manager_->GetNumMaxAmbisonicChannels());
+      graph_manager_->GetNumRenderedAmbisonicChannels(num_channels);
   if (num_valid_channels < num_channels) {
     LOG(WARNING) << "Number of ambisonic channels will be diminished to "
                  << num_valid_channels;
@@ -171,6 +222,7 @@ int ResonanceAudioApiImpl::CreateAmbisonicSource(size_t num_channels) {
   auto task = [this, ambisonic_source_id, num_valid_channels]() {
     graph_manager_->CreateAmbisonicSource(ambisonic_source_id,
                                           num_valid_channels);
+    CreateSourceInputQueue(ambisonic_source_id, num_valid_channels);
     system_settings_.GetSourceParametersManager()->Register(
         ambisonic_source_id);
     // Overwrite default source parameters for ambisonic source.
@@ -194,6 +246,7 @@ int ResonanceAudioApiImpl::CreateStereoSource(size_t num_channels) {
 
   auto task = [this, stereo_source_id]() {
     graph_manager_->CreateStereoSource(stereo_source_id);
+    CreateSourceInputQueue(stereo_source_id, kNumStereoChannels);
     system_settings_.GetSourceParametersManager()->Register(stereo_source_id);
     auto source_parameters =
         system_settings_.GetSourceParametersManager()->GetMutableParameters(
@@ -213,6 +266,7 @@ int ResonanceAudioApiImpl::CreateSoundObjectSource(
     graph_manager_->CreateSoundObjectSource(
         sound_object_source_id, config.ambisonic_order, config.enable_hrtf,
         config.enable_direct_rendering);
+    CreateSourceInputQueue(sound_object_source_id, kNumMonoChannels);
     system_settings_.GetSourceParametersManager()->Register(
         sound_object_source_id);
     auto source_parameters =
@@ -228,6 +282,7 @@ void ResonanceAudioApiImpl::DestroySource(SourceId source_id) {
   auto task = [this, source_id]() {
     graph_manager_->DestroySource(source_id);
     system_settings_.GetSourceParametersManager()->Unregister(source_id);
+    source_input_queues_.erase(source_id);
   };
   task_queue_.Post(task);
 }
@@ -262,6 +317,27 @@ void ResonanceAudioApiImpl::SetPlanarBuffer(
                                        num_channels, num_frames);
 }
 
+void ResonanceAudioApiImpl::SetSourceSampleRate(SourceId source_id,
+                                                int sample_rate_hz) {
+  if (sample_rate_hz <= 0 ||
+      !Resampler::AreSampleRatesSupported(sample_rate_hz,
+                                          system_settings_.GetSampleRateHz())) {
+    LOG(WARNING) << "Unsupported source sample rate: " << sample_rate_hz;
+    return;
+  }
+  auto task = [this, source_id, sample_rate_hz]() {
+    graph_manager_->SetSourceSampleRate(source_id, sample_rate_hz);
+    // Buffers of resampled sources bypass the re-blocking input queues.
+    const auto input_queue_itr = source_input_queues_.find(source_id);
+    if (input_queue_itr != source_input_queues_.end()) {
+      input_queue_itr->second->buffers.Clear();
+      input_queue_itr->second->next_host_frame =
+          SourceInputQueue::kUnalignedHostFrame;
+    }
+  };
+  task_queue_.Post(task);
+}
+
 void ResonanceAudioApiImpl::SetSourceDistanceAttenuation(
     SourceId source_id, float distance_attenuation) {
   auto task = [this, source_id, distance_attenuation]() {
@@ -329,6 +405,24 @@ void ResonanceAudioApiImpl::SetSourceRoomEffectsGain(SourceId source_id,
   task_queue_.Post(task);
 }
 
+void ResonanceAudioApiImpl::SetSourceRoomZoneSendGain(SourceId source_id,
+                                                      RoomZoneId room_zone_id,
+                                                      float send_gain) {
+  if (!IsValidRoomZoneId(room_zone_id)) {
+    LOG(WARNING) << "Invalid room zone id: " << room_zone_id;
+    return;
+  }
+  auto task = [this, source_id, room_zone_id, send_gain]() {
+    auto source_parameters =
+        system_settings_.GetSourceParametersManager()->GetMutableParameters(
+            source_id);
+    if (source_parameters != nullptr) {
+      source_parameters->room_zone_send_gains[room_zone_id] = send_gain;
+    }
+  };
+  task_queue_.Post(task);
+}
+
 void ResonanceAudioApiImpl::SetSourceRotation(SourceId source_id, float x,
                                               float y, float z, float w) {
   const WorldRotation rotation(w, x, y, z);
@@ -409,6 +503,40 @@ void ResonanceAudioApiImpl::SetSoundObjectOcclusionIntensity(
   task_queue_.Post(task);
 }
 
+void ResonanceAudioApiImpl::SetSoundObjectPropagationDelayEnabled(
+    SourceId sound_object_source_id, bool enabled) {
+  auto task = [this, sound_object_source_id, enabled]() {
+    auto source_parameters =
+        system_settings_.GetSourceParametersManager()->GetMutableParameters(
+            sound_object_source_id);
+    if (source_parameters != nullptr) {
+      // Allocate the delay line here rather than in the audio processing of
+      // the node, as it is sized for the maximum propagation delay.
+      if (enabled) {
+        graph_manager_->AllocateSourcePropagationDelay(sound_object_source_id);
+      }
+      source_parameters->enable_propagation_delay = enabled;
+    }
+  };
+  task_queue_.Post(task);
+}
+
+void ResonanceAudioApiImpl::SetSoundObjectClusteringEnabled(
+    SourceId sound_object_source_id, bool enabled) {
+  auto task = [this, sound_object_source_id, enabled]() {
+    auto source_parameters =
+        system_settings_.GetSourceParametersManager()->GetMutableParameters(
+            sound_object_source_id);
+    if (source_parameters != nullptr) {
+      // Only sources rendered through an encoder node can be clustered.
+      source_parameters->enable_clustering =
+          enabled &&
+          graph_manager_->AllocateSourceClustering(sound_object_source_id);
+    }
+  };
+  task_queue_.Post(task);
+}
+
 void ResonanceAudioApiImpl::SetSoundObjectSpread(
     SourceId sound_object_source_id, float spread_deg) {
   auto task = [this, sound_object_source_id, spread_deg]() {
@@ -431,6 +559,7 @@ void ResonanceAudioApiImpl::SetReflectionProperties(
     const ReflectionProperties& reflection_properties) {
   auto task = [this, reflection_properties]() {
     system_settings_.SetReflectionProperties(reflection_properties);
+    graph_manager_->AllocateRoomZoneReflections(kDefaultRoomZoneId);
   };
   task_queue_.Post(task);
 }
@@ -443,6 +572,87 @@ void ResonanceAudioApiImpl::SetReverbProperties(
   task_queue_.Post(task);
 }
 
+ResonanceAudioApi::RoomZoneId ResonanceAudioApiImpl::CreateRoomZone() {
+  // Claim the lowest free room zone id.
+  unsigned int room_zone_id_mask = room_zone_id_mask_.load();
+  RoomZoneId room_zone_id = kInvalidRoomZoneId;
+  do {
+    room_zone_id = kInvalidRoomZoneId;
+    for (size_t i = 0; i < kMaxNumRoomZones; ++i) {
+      if ((room_zone_id_mask & (1U << i)) == 0) {
+        room_zone_id = static_cast<RoomZoneId>(i);
+        break;
+      }
+    }
+    if (room_zone_id == kInvalidRoomZoneId) {
+      // Maximum number of room zones reached.
+      return kInvalidRoomZoneId;
+    }
+  } while (!room_zone_id_mask_.compare_exchange_weak(
+      room_zone_id_mask, room_zone_id_mask | (1U << room_zone_id)));
+
+  auto task = [this, room_zone_id]() {
+    // Start from the default properties, which disable the room effects.
+    system_settings_.SetRoomZoneReflectionProperties(room_zone_id,
+                                                     ReflectionProperties());
+    system_settings_.SetRoomZoneReverbProperties(room_zone_id,
+                                                 ReverbProperties());
+    graph_manager_->CreateRoomZone(room_zone_id);
+  };
+  task_queue_.Post(task);
+  return room_zone_id;
+}
+
+void ResonanceAudioApiImpl::DestroyRoomZone(RoomZoneId room_zone_id) {
+  if (room_zone_id == kDefaultRoomZoneId ||
+      !IsValidRoomZoneId(room_zone_id) ||
+      (room_zone_id_mask_.load() & (1U << room_zone_id)) == 0) {
+    LOG(WARNING) << "Cannot destroy room zone: " << room_zone_id;
+    return;
+  }
+  auto task = [this, room_zone_id]() {
+    graph_manager_->DestroyRoomZone(room_zone_id);
+    // Remove all sends into the room zone so that they are not restored when
+    // the id is reused.
+    const auto remove_send = [room_zone_id](SourceParameters* parameters) {
+      parameters->room_zone_send_gains[room_zone_id] = 0.0f;
+    };
+    system_settings_.GetSourceParametersManager()->ProcessAllParameters(
+        remove_send);
+  };
+  task_queue_.Post(task);
+  // The id can be reused right away since the tasks are executed in order.
+  room_zone_id_mask_.fetch_and(~(1U << room_zone_id));
+}
+
+void ResonanceAudioApiImpl::SetRoomZoneReflectionProperties(
+    RoomZoneId room_zone_id,
+    const ReflectionProperties& reflection_properties) {
+  if (!IsValidRoomZoneId(room_zone_id)) {
+    LOG(WARNING) << "Invalid room zone id: " << room_zone_id;
+    return;
+  }
+  auto task = [this, room_zone_id, reflection_properties]() {
+    system_settings_.SetRoomZoneReflectionProperties(room_zone_id,
+                                                     reflection_properties);
+    graph_manager_->AllocateRoomZoneReflections(room_zone_id);
+  };
+  task_queue_.Post(task);
+}
+
+void ResonanceAudioApiImpl::SetRoomZoneReverbProperties(
+    RoomZoneId room_zone_id, const ReverbProperties& reverb_properties) {
+  if (!IsValidRoomZoneId(room_zone_id)) {
+    LOG(WARNING) << "Invalid room zone id: " << room_zone_id;
+    return;
+  }
+  auto task = [this, room_zone_id, reverb_properties]() {
+    system_settings_.SetRoomZoneReverbProperties(room_zone_id,
+                                                 reverb_properties);
+  };
+  task_queue_.Post(task);
+}
+
 const AudioBuffer* ResonanceAudioApiImpl::GetAmbisonicOutputBuffer() const {
   return graph_manager_->GetAmbisonicBuffer();
 }
@@ -452,13 +662,17 @@ const AudioBuffer* ResonanceAudioApiImpl::GetStereoOutputBuffer() const {
 }
 
 void ResonanceAudioApiImpl::ProcessNextBuffer() {
+#if defined(ENABLE_REALTIME_SAFETY_CHECKS)
+  // Reports any allocation or lock on the audio thread.
+  RealtimeSafetyChecker::ScopedRealtimeSection realtime_section;
+#endif  // defined(ENABLE_REALTIME_SAFETY_CHECKS)
+  const auto begin_time = std::chrono::steady_clock::now();
 #if defined(ENABLE_TRACING) && !ION_PRODUCTION
   // This enables tracing on the audio thread.
   auto task = []() { ENABLE_TRACING_ON_CURRENT_THREAD("AudioThread"); };
   task_queue_.Post(task);
 #endif  // defined(ENABLE_TRACING) && !ION_PRODUCTION
 
-
   task_queue_.Execute();
 
   // Update room effects only if the pipeline is initialized.
@@ -470,16 +684,93 @@ void ResonanceAudioApiImpl::ProcessNextBuffer() {
   const auto process = [this](SourceParameters* parameters) {
     const float master_gain = system_settings_.GetMasterGain();
     const auto& listener_position = system_settings_.GetHeadPosition();
+    const auto& listener_rotation = system_settings_.GetHeadRotation();
     const auto& reflection_properties =
         system_settings_.GetReflectionProperties();
     const auto& reverb_properties = system_settings_.GetReverbProperties();
+    UpdateSourceGeometry(listener_position, listener_rotation, parameters);
     UpdateAttenuationParameters(master_gain, reflection_properties.gain,
-                                reverb_properties.gain, listener_position,
-                                parameters);
+                                reverb_properties.gain, parameters);
   };
   system_settings_.GetSourceParametersManager()->ProcessAllParameters(process);
 
-  graph_manager_->Process();
+  {
+#if defined(ENABLE_NODE_PROFILING)
+    NodeProfiler::ScopedBuffer profiled_buffer(&node_profiler_);
+#endif  // defined(ENABLE_NODE_PROFILING)
+    graph_manager_->Process();
+  }
+
+  const auto processing_time = std::chrono::duration_cast<
+      std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin_time);
+  deadline_monitor_.RecordBuffer(
+      static_cast<uint64_t>(processing_time.count()),
+      graph_manager_->GetNumActiveSources(),
+      graph_manager_->GetRoomEffectsEnabled());
+}
+
+void ResonanceAudioApiImpl::ResetRoomEffects() {
+  auto task = [this]() { graph_manager_->ResetRoomZones(); };
+  task_queue_.Post(task);
+}
+
+void ResonanceAudioApiImpl::GetBufferTimingStats(
+    BufferTimingStats* stats) const {
+  if (stats == nullptr) {
+    LOG(WARNING) << kBadInputPointerMessage;
+    return;
+  }
+  deadline_monitor_.GetStats(stats);
+}
+
+void ResonanceAudioApiImpl::ResetBufferTimingStats() {
+  // The stats must only be modified by the audio thread.
+  auto task = [this]() { deadline_monitor_.Reset(); };
+  task_queue_.Post(task);
+}
+
+size_t ResonanceAudioApiImpl::GetNodeProcessingStats(
+    bool aggregate_by_type, NodeProcessingStats* stats, size_t max_num_stats) {
+#if defined(ENABLE_NODE_PROFILING)
+  node_stats_ = node_profiler_.GetStats(aggregate_by_type);
+  if (stats != nullptr) {
+    const size_t num_stats = std::min(max_num_stats, node_stats_.size());
+    for (size_t i = 0; i < num_stats; ++i) {
+      const NodeProfiler::NodeStats& node_stats = node_stats_[i];
+      stats[i].node_type = node_stats.node_type.c_str();
+      stats[i].node_id = node_stats.node_id;
+      stats[i].num_nodes = node_stats.num_nodes;
+      stats[i].num_calls = node_stats.num_calls;
+      stats[i].num_inputs = node_stats.num_inputs;
+      stats[i].total_time_ms = node_stats.total_time_ms;
+      stats[i].max_time_ms = node_stats.max_time_ms;
+    }
+  }
+  return node_stats_.size();
+#else
+  return 0;
+#endif  // defined(ENABLE_NODE_PROFILING)
+}
+
+void ResonanceAudioApiImpl::ResetNodeProcessingStats() {
+#if defined(ENABLE_NODE_PROFILING)
+  node_profiler_.Reset();
+#endif  // defined(ENABLE_NODE_PROFILING)
+}
+
+bool ResonanceAudioApiImpl::WriteNodeProcessingTrace(const char* file_path) {
+#if defined(ENABLE_NODE_PROFILING)
+  if (file_path == nullptr) {
+    return false;
+  }
+  std::ofstream trace_file(file_path, std::ios::out | std::ios::trunc);
+  trace_file.imbue(std::locale::classic());
+  node_profiler_.WriteChromeTrace(&trace_file);
+  trace_file.close();
+  return !trace_file.fail();
+#else
+  return false;
+#endif  // defined(ENABLE_NODE_PROFILING)
 }
 
 void ResonanceAudioApiImpl::SetStereoSpeakerMode(bool enabled) {
@@ -493,7 +784,10 @@ template <typename OutputType>
 bool ResonanceAudioApiImpl::FillOutputBuffer(size_t num_channels,
                                              size_t num_frames,
                                              OutputType buffer_ptr) {
-
+#if defined(ENABLE_REALTIME_SAFETY_CHECKS)
+  // Covers the output re-blocking in addition to |ProcessNextBuffer|.
+  RealtimeSafetyChecker::ScopedRealtimeSection realtime_section;
+#endif  // defined(ENABLE_REALTIME_SAFETY_CHECKS)
 
   if (buffer_ptr == nullptr) {
     LOG(WARNING) << kBadInputPointerMessage;
@@ -503,17 +797,23 @@ bool ResonanceAudioApiImpl::FillOutputBuffer(size_t num_channels,
     LOG(WARNING) << "Output buffer must be stereo";
     return false;
   }
-  const size_t num_input_samples = num_frames * num_channels;
-  const size_t num_expected_output_samples =
-      system_settings_.GetFramesPerBuffer() * system_settings_.GetNumChannels();
-  if (num_input_samples != num_expected_output_samples) {
-    LOG(WARNING) << "Output buffer size must be " << num_expected_output_samples
-                 << " samples";
-    return false;
+
+  UpdateReblockingLatency(num_frames);
+  if (!IsDirectProcessingPossible(num_frames)) {
+    // Pull as many graph buffers as needed to fill the host buffer. The
+    // remaining frames of the last graph buffer are kept for the next call.
+    reblocked_output_valid_ = true;
+    const size_t num_frames_written =
+        output_unpartitioner_->GetBuffer(buffer_ptr, num_channels, num_frames);
+    DCHECK_EQ(num_frames_written, num_frames);
+    num_host_frames_ += num_frames;
+    return reblocked_output_valid_;
   }
 
   // Get the processed output buffer.
   ProcessNextBuffer();
+  num_host_frames_ += num_frames;
+  num_processed_frames_ += num_frames;
   const AudioBuffer* output_buffer = GetStereoOutputBuffer();
   if (output_buffer == nullptr) {
     // This indicates that the graph processing is triggered without having any
@@ -533,21 +833,71 @@ void ResonanceAudioApiImpl::SetSourceBuffer(SourceId source_id,
   // Execute task queue to ensure newly created sound sources are initialized.
   task_queue_.Execute();
 
+#if defined(ENABLE_REALTIME_SAFETY_CHECKS)
+  // Reports any allocation or lock while the input is copied or re-blocked.
+  RealtimeSafetyChecker::ScopedRealtimeSection realtime_section;
+#endif  // defined(ENABLE_REALTIME_SAFETY_CHECKS)
+
   if (audio_buffer_ptr == nullptr) {
     LOG(WARNING) << kBadInputPointerMessage;
     return;
   }
-  if (num_frames != system_settings_.GetFramesPerBuffer()) {
-    LOG(WARNING) << kBufferSizeMustMatchNumFramesMessage;
+
+  BufferedSourceNode* const resampling_source_node =
+      graph_manager_->GetResamplingSourceNode(source_id);
+  if (resampling_source_node != nullptr) {
+    // Buffers at the source sample rate are re-blocked by the source node.
+    resampling_source_node->AddSourceRateBuffer(audio_buffer_ptr,
+                                                num_input_channels, num_frames);
     return;
   }
 
-  AudioBuffer* const output_buffer =
-      graph_manager_->GetMutableAudioBuffer(source_id);
-  if (output_buffer == nullptr) {
-    LOG(WARNING) << "Source audio buffer not found";
+  UpdateReblockingLatency(num_frames);
+  if (IsDirectProcessingPossible(num_frames)) {
+    AudioBuffer* const output_buffer =
+        graph_manager_->GetMutableAudioBuffer(source_id);
+    if (output_buffer == nullptr) {
+      LOG(WARNING) << kSourceBufferNotFoundMessage;
+      return;
+    }
+    CopyToSourceBuffer(audio_buffer_ptr, num_input_channels, num_frames,
+                       output_buffer);
     return;
   }
+
+  const auto input_queue_itr = source_input_queues_.find(source_id);
+  if (input_queue_itr == source_input_queues_.end()) {
+    LOG(WARNING) << kSourceBufferNotFoundMessage;
+    return;
+  }
+  std::unique_ptr<SourceInputQueue>& input_queue = input_queue_itr->second;
+  if (input_queue->buffers.num_channels() != num_input_channels) {
+    // Input channels are remapped to the source channels when the buffers are
+    // fed into the graph, so the queue must match the host channel layout. It
+    // is only rebuilt once for hosts whose layout differs from the source.
+    input_queue.reset(new SourceInputQueue(
+        num_input_channels, system_settings_.GetFramesPerBuffer()));
+  }
+  if (input_queue->next_host_frame != num_host_frames_) {
+    // Graph buffers are completed |latency_frames_| ahead of the host frame
+    // position. Pad new (or previously skipped) sources with silence such that
+    // their next input frame lines up with the input of all other sources.
+    DCHECK_GE(num_host_frames_ + latency_frames_, num_processed_frames_);
+    input_queue->buffers.Clear();
+    input_queue->buffers.AddSilence(num_host_frames_ + latency_frames_ -
+                                    num_processed_frames_);
+  }
+  input_queue->buffers.AddBuffer(audio_buffer_ptr, num_input_channels,
+                                 num_frames);
+  input_queue->next_host_frame = num_host_frames_ + num_frames;
+}
+
+template <typename SampleType>
+void ResonanceAudioApiImpl::CopyToSourceBuffer(SampleType audio_buffer_ptr,
+                                               size_t num_input_channels,
+                                               size_t num_frames,
+                                               AudioBuffer* output_buffer) {
+  DCHECK(output_buffer);
   const size_t num_output_channels = output_buffer->num_channels();
 
   if (num_input_channels == num_output_channels) {
@@ -579,4 +929,89 @@ void ResonanceAudioApiImpl::SetSourceBuffer(SourceId source_id,
                   "output channels";
 }
 
+void ResonanceAudioApiImpl::UpdateReblockingLatency(size_t num_frames) {
+  if (num_frames == 0) {
+    return;
+  }
+  const size_t host_frames_gcd = static_cast<size_t>(FindGcd(
+      static_cast<int>(host_frames_gcd_), static_cast<int>(num_frames)));
+  if (host_frames_gcd == host_frames_gcd_) {
+    return;
+  }
+  // The output must never run dry, i.e., the number of buffered frames must
+  // cover the largest possible remainder of the accumulated host frames
+  // modulo |frames_per_buffer|, which is |frames_per_buffer - gcd|.
+  // The gcd only ever decreases, so the latency only ever increases. Queued
+  // input is kept and the subsequent input of each source is delayed by the
+  // added latency, which leaves a silent gap in the output. Unaligned queues
+  // are padded according to the new latency on their next input.
+  host_frames_gcd_ = host_frames_gcd;
+  const size_t latency_frames =
+      system_settings_.GetFramesPerBuffer() - host_frames_gcd_;
+  DCHECK_GT(latency_frames, latency_frames_);
+  const size_t num_added_latency_frames = latency_frames - latency_frames_;
+  latency_frames_ = latency_frames;
+  for (auto& input_queue_itr : source_input_queues_) {
+    SourceInputQueue* const input_queue = input_queue_itr.second.get();
+    if (input_queue->next_host_frame >= num_host_frames_ &&
+        input_queue->next_host_frame !=
+            SourceInputQueue::kUnalignedHostFrame) {
+      input_queue->buffers.AddSilence(num_added_latency_frames);
+    }
+  }
+}
+
+void ResonanceAudioApiImpl::CreateSourceInputQueue(SourceId source_id,
+                                                   size_t num_channels) {
+  source_input_queues_[source_id].reset(new SourceInputQueue(
+      num_channels, system_settings_.GetFramesPerBuffer()));
+}
+
+const AudioBuffer* ResonanceAudioApiImpl::ProcessReblockedBuffer() {
+  for (auto& input_queue_itr : source_input_queues_) {
+    PartitionedBufferQueue* const input_buffers =
+        &input_queue_itr.second->buffers;
+    const AudioBuffer* input_buffer = input_buffers->Front();
+    if (input_buffer == nullptr) {
+      // No input for this source in this graph buffer.
+      continue;
+    }
+    AudioBuffer* const output_buffer =
+        graph_manager_->GetMutableAudioBuffer(input_queue_itr.first);
+    if (output_buffer == nullptr) {
+      LOG(WARNING) << kSourceBufferNotFoundMessage;
+    } else {
+      temp_planar_channel_ptrs_.resize(input_buffer->num_channels());
+      GetRawChannelDataPointersFromAudioBuffer(*input_buffer,
+                                               &temp_planar_channel_ptrs_);
+      CopyToSourceBuffer<const float* const*>(
+          temp_planar_channel_ptrs_.data(), input_buffer->num_channels(),
+          input_buffer->num_frames(), output_buffer);
+    }
+    input_buffers->PopFront();
+  }
+
+  ProcessNextBuffer();
+  num_processed_frames_ += system_settings_.GetFramesPerBuffer();
+  const AudioBuffer* output_buffer = GetStereoOutputBuffer();
+  if (output_buffer == nullptr) {
+    // No connected sources, see |FillOutputBuffer|.
+    reblocked_output_valid_ = false;
+    return &silence_buffer_;
+  }
+  return output_buffer;
+}
+
+bool ResonanceAudioApiImpl::IsDirectProcessingPossible(
+    size_t num_frames) const {
+  if (num_frames != system_settings_.GetFramesPerBuffer() ||
+      latency_frames_ != 0) {
+    return false;
+  }
+  // Without latency, buffer sizes are multiples of |frames_per_buffer| and
+  // every output request consumes all re-blocked frames.
+  DCHECK_EQ(num_host_frames_, num_processed_frames_);
+  return true;
+}
+
 }  // namespace vraudio
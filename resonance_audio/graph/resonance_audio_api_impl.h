@@ -19,6 +19,7 @@ limitations under the License.
 
 #include <atomic>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "base/integral_types.h"
@@ -26,7 +27,16 @@ limitations under the License.
 #include "base/audio_buffer.h"
 #include "graph/graph_manager.h"
 #include "graph/system_settings.h"
+#include "utils/buffer_deadline_monitor.h"
+#include "utils/buffer_unpartitioner.h"
 #include "utils/lockless_task_queue.h"
+#include "utils/partitioned_buffer_queue.h"
+
+#if defined(ENABLE_NODE_PROFILING)
+#include <string>
+
+#include "utils/node_profiler.h"
+#endif  // defined(ENABLE_NODE_PROFILING)
 
 namespace vraudio {
 
@@ -41,6 +51,17 @@ class ResonanceAudioApiImpl : public ResonanceAudioApi {
   ResonanceAudioApiImpl(size_t num_channels, size_t frames_per_buffer,
                         int sample_rate_hz);
 
+  // Constructor that initializes |ResonanceAudioApi| with system configuration
+  // and the options which are fixed at construction.
+  //
+  // @param num_channels Number of channels of audio output.
+  // @param frames_per_buffer Number of frames per buffer.
+  // @param sample_rate_hz System sample rate.
+  // @param options Reverb and Ambisonic rendering options.
+  ResonanceAudioApiImpl(size_t num_channels, size_t frames_per_buffer,
+                        int sample_rate_hz,
+                        const ResonanceAudioApiOptions& options);
+
   ~ResonanceAudioApiImpl() override;
 
   //////////////////////////////////
@@ -57,6 +78,9 @@ class ResonanceAudioApiImpl : public ResonanceAudioApi {
   bool FillPlanarOutputBuffer(size_t num_channels, size_t num_frames,
                               int16* const* buffer_ptr) override;
 
+  // Latency added by re-blocking of host buffers.
+  size_t GetLatencyFrames() const override;
+
   // Listener configuration.
   void SetHeadPosition(float x, float y, float z) override;
   void SetHeadRotation(float x, float y, float z, float w) override;
@@ -78,6 +102,7 @@ class ResonanceAudioApiImpl : public ResonanceAudioApi {
                        size_t num_channels, size_t num_frames) override;
   void SetPlanarBuffer(SourceId source_id, const int16* const* audio_buffer_ptr,
                        size_t num_channels, size_t num_frames) override;
+  void SetSourceSampleRate(SourceId source_id, int sample_rate_hz) override;
 
   // Source configuration.
   void SetSourceDistanceAttenuation(SourceId source_id,
@@ -88,6 +113,8 @@ class ResonanceAudioApiImpl : public ResonanceAudioApi {
                          float z) override;
   void SetSourceRoomEffectsGain(SourceId source_id,
                                 float room_effects_gain) override;
+  void SetSourceRoomZoneSendGain(SourceId source_id, RoomZoneId room_zone_id,
+                                 float send_gain) override;
   void SetSourceRotation(SourceId source_id, float x, float y, float z,
                          float w) override;
   void SetSourceVolume(SourceId source_id, float volume) override;
@@ -101,6 +128,10 @@ class ResonanceAudioApiImpl : public ResonanceAudioApi {
                                          float gain) override;
   void SetSoundObjectOcclusionIntensity(SourceId sound_object_source_id,
                                         float intensity) override;
+  void SetSoundObjectPropagationDelayEnabled(SourceId sound_object_source_id,
+                                             bool enabled) override;
+  void SetSoundObjectClusteringEnabled(SourceId sound_object_source_id,
+                                       bool enabled) override;
   void SetSoundObjectSpread(SourceId sound_object_source_id,
                             float spread_deg) override;
 
@@ -109,6 +140,25 @@ class ResonanceAudioApiImpl : public ResonanceAudioApi {
   void SetReflectionProperties(
       const ReflectionProperties& reflection_properties) override;
   void SetReverbProperties(const ReverbProperties& reverb_properties) override;
+  RoomZoneId CreateRoomZone() override;
+  void DestroyRoomZone(RoomZoneId room_zone_id) override;
+  void SetRoomZoneReflectionProperties(
+      RoomZoneId room_zone_id,
+      const ReflectionProperties& reflection_properties) override;
+  void SetRoomZoneReverbProperties(
+      RoomZoneId room_zone_id,
+      const ReverbProperties& reverb_properties) override;
+
+  // Buffer timing stats.
+  void GetBufferTimingStats(BufferTimingStats* stats) const override;
+  void ResetBufferTimingStats() override;
+
+  // Node processing stats.
+  size_t GetNodeProcessingStats(bool aggregate_by_type,
+                                NodeProcessingStats* stats,
+                                size_t max_num_stats) override;
+  void ResetNodeProcessingStats() override;
+  bool WriteNodeProcessingTrace(const char* file_path) override;
 
   //////////////////////////////////
   // Internal API methods.
@@ -127,7 +177,34 @@ class ResonanceAudioApiImpl : public ResonanceAudioApi {
   // Triggers processing of the audio graph with the updated system properties.
   void ProcessNextBuffer();
 
+  // Discards the processing states of the room effects of all room zones,
+  // e.g., to start a new offline rendering without the previous reverb tail.
+  void ResetRoomEffects();
+
  private:
+  // Re-blocking input state of a single source.
+  struct SourceInputQueue {
+    // Host frame position of a queue that must be realigned before its next
+    // input buffer.
+    static const size_t kUnalignedHostFrame = static_cast<size_t>(-1);
+
+    // Preallocates the queue for host buffers of up to |frames_per_buffer|
+    // frames at the maximum re-blocking latency. Larger host buffers grow the
+    // queue once on first use.
+    SourceInputQueue(size_t num_channels, size_t frames_per_buffer)
+        : buffers(num_channels, frames_per_buffer),
+          next_host_frame(kUnalignedHostFrame) {
+      buffers.Reserve(2 * frames_per_buffer);
+    }
+
+    // Queue of re-blocked input buffers.
+    PartitionedBufferQueue buffers;
+
+    // Host frame position at which the next input buffer is expected. A source
+    // that misses this position (i.e., skipped a buffer) is realigned.
+    size_t next_host_frame;
+  };
+
   // This method triggers the processing of the audio graph and outputs a
   // binaural stereo output buffer.
   //
@@ -151,6 +228,42 @@ class ResonanceAudioApiImpl : public ResonanceAudioApi {
   void SetSourceBuffer(SourceId source_id, SampleType audio_buffer_ptr,
                        size_t num_input_channels, size_t num_frames);
 
+  // Copies an input buffer into the |AudioBuffer| of a source and remaps the
+  // input channels to the source channels if needed.
+  //
+  // @param audio_buffer_ptr Pointer to planar or interleaved audio buffer.
+  // @param num_input_channels Number of input channels.
+  // @param num_frames Number of frames per channel / audio buffer.
+  // @param output_buffer Source audio buffer.
+  template <typename SampleType>
+  void CopyToSourceBuffer(SampleType audio_buffer_ptr,
+                          size_t num_input_channels, size_t num_frames,
+                          AudioBuffer* output_buffer);
+
+  // Creates the re-blocking input queue of a new source. This is called from
+  // the source creation tasks, alongside the allocation of the source nodes.
+  //
+  // @param source_id Id of new source.
+  // @param num_channels Number of input channels of the source.
+  void CreateSourceInputQueue(SourceId source_id, size_t num_channels);
+
+  // Updates the re-blocking latency for a host buffer of |num_frames| frames.
+  // Queued input is kept when the latency increases, i.e., the output of
+  // previously queued and subsequent input is separated by the added latency.
+  //
+  // @param num_frames Host buffer size in frames.
+  void UpdateReblockingLatency(size_t num_frames);
+
+  // Callback of |output_unpartitioner_| which feeds the next re-blocked input
+  // buffer of each source into the graph and processes it.
+  //
+  // @return Processed stereo output buffer.
+  const AudioBuffer* ProcessReblockedBuffer();
+
+  // Returns true if host buffers of |num_frames| frames can be passed to and
+  // from the graph directly, i.e., without re-blocking.
+  bool IsDirectProcessingPossible(size_t num_frames) const;
+
   // Graph manager used to create and destroy sound objects.
   std::unique_ptr<GraphManager> graph_manager_;
 
@@ -163,6 +276,52 @@ class ResonanceAudioApiImpl : public ResonanceAudioApi {
 
   // Incremental source id counter.
   std::atomic<int> source_id_counter_;
+
+  // Bit mask of the room zone ids in use.
+  std::atomic<unsigned int> room_zone_id_mask_;
+
+  // Greatest common divisor of |frames_per_buffer| and all host buffer sizes
+  // seen so far, which determines the re-blocking latency.
+  size_t host_frames_gcd_;
+
+  // Re-blocking latency in frames.
+  std::atomic<size_t> latency_frames_;
+
+  // Number of host frames rendered since the last re-blocking reset.
+  size_t num_host_frames_;
+
+  // Number of frames processed by the graph since the last re-blocking reset.
+  size_t num_processed_frames_;
+
+  // Re-blocking input queues of each source, which are created along with the
+  // source.
+  std::unordered_map<SourceId, std::unique_ptr<SourceInputQueue>>
+      source_input_queues_;
+
+  // Unpartitions processed graph output buffers into host sized buffers.
+  std::unique_ptr<BufferUnpartitioner> output_unpartitioner_;
+
+  // Silent output buffer used when the graph has no connected sources.
+  AudioBuffer silence_buffer_;
+
+  // Tracks the processing time of each buffer against its real-time budget.
+  BufferDeadlineMonitor deadline_monitor_;
+
+  // Flag indicating whether all graph buffers in the current re-blocked
+  // output request contained valid output.
+  bool reblocked_output_valid_;
+
+  // Temporary planar channel pointers to a re-blocked input buffer.
+  std::vector<const float*> temp_planar_channel_ptrs_;
+
+#if defined(ENABLE_NODE_PROFILING)
+  // Measures the processing time of the audio graph nodes.
+  NodeProfiler node_profiler_;
+
+  // Stats returned by the last |GetNodeProcessingStats| call, which own the
+  // node type names.
+  std::vector<NodeProfiler::NodeStats> node_stats_;
+#endif  // defined(ENABLE_NODE_PROFILING)
 };
 
 }  // namespace vraudio
@@ -0,0 +1,281 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "graph/resonance_audio_api_impl.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+#include "ambisonics/utils.h"
+#include "base/constants_and_types.h"
+#include "base/misc_math.h"
+
+namespace vraudio {
+
+namespace {
+
+const size_t kFramesPerBuffer = 256;
+const int kSampleRateHz = 48000;
+
+// Number of input frames rendered in each test.
+const size_t kNumInputFrames = 8192;
+
+// Tolerated difference between re-blocked and directly processed output.
+const float kEpsilon = 1e-6f;
+
+// Generates a deterministic interleaved stereo test signal.
+std::vector<float> GenerateStereoInput() {
+  std::vector<float> input(kNumInputFrames * kNumStereoChannels);
+  for (size_t frame = 0; frame < kNumInputFrames; ++frame) {
+    const float phase = static_cast<float>(frame);
+    input[frame * kNumStereoChannels] = 0.5f * std::sin(0.05f * phase);
+    input[frame * kNumStereoChannels + 1] = 0.25f * std::sin(0.37f * phase);
+  }
+  return input;
+}
+
+// Renders |input| through a stereo source with host buffers whose sizes cycle
+// through |host_buffer_sizes|. The latency reported after each host buffer is
+// stored in |latency_frames|.
+std::vector<float> RenderStereoSource(
+    const std::vector<float>& input,
+    const std::vector<size_t>& host_buffer_sizes,
+    std::vector<size_t>* latency_frames) {
+  ResonanceAudioApiImpl api(kNumStereoChannels, kFramesPerBuffer,
+                            kSampleRateHz);
+  const ResonanceAudioApi::SourceId source_id =
+      api.CreateStereoSource(kNumStereoChannels);
+  const size_t num_output_frames = kNumInputFrames + 2 * kFramesPerBuffer;
+  std::vector<float> output(num_output_frames * kNumStereoChannels, 0.0f);
+  // The input is padded with silence to flush the re-blocking latency.
+  std::vector<float> padded_input(input);
+  padded_input.resize(output.size(), 0.0f);
+  latency_frames->clear();
+  size_t frame = 0;
+  for (size_t i = 0; frame < num_output_frames; ++i) {
+    const size_t num_frames =
+        std::min(host_buffer_sizes[i % host_buffer_sizes.size()],
+                 num_output_frames - frame);
+    api.SetInterleavedBuffer(source_id,
+                             &padded_input[frame * kNumStereoChannels],
+                             kNumStereoChannels, num_frames);
+    EXPECT_TRUE(api.FillInterleavedOutputBuffer(
+        kNumStereoChannels, num_frames, &output[frame * kNumStereoChannels]));
+    latency_frames->push_back(api.GetLatencyFrames());
+    frame += num_frames;
+  }
+  return output;
+}
+
+// Tests that host buffers of the graph buffer size are processed without
+// latency.
+TEST(ResonanceAudioApiImplTest, NoLatencyForGraphBufferSize) {
+  const std::vector<float> input = GenerateStereoInput();
+  std::vector<size_t> latency_frames;
+  RenderStereoSource(input, {kFramesPerBuffer}, &latency_frames);
+  for (size_t latency : latency_frames) {
+    EXPECT_EQ(0U, latency);
+  }
+}
+
+// Tests that odd host buffer sizes are re-blocked into a delayed but otherwise
+// identical output, and that the delay matches the reported latency.
+TEST(ResonanceAudioApiImplTest, ReblocksOddHostBufferSizes) {
+  const std::vector<float> input = GenerateStereoInput();
+  std::vector<size_t> latency_frames;
+  const std::vector<float> reference =
+      RenderStereoSource(input, {kFramesPerBuffer}, &latency_frames);
+
+  for (size_t host_buffer_size : {100U, 441U, 512U}) {
+    SCOPED_TRACE(host_buffer_size);
+    const std::vector<float> output =
+        RenderStereoSource(input, {host_buffer_size}, &latency_frames);
+    const size_t latency =
+        kFramesPerBuffer -
+        static_cast<size_t>(FindGcd(static_cast<int>(kFramesPerBuffer),
+                                    static_cast<int>(host_buffer_size)));
+    for (size_t reported_latency : latency_frames) {
+      EXPECT_EQ(latency, reported_latency);
+    }
+    for (size_t i = 0; i < kNumInputFrames * kNumStereoChannels; ++i) {
+      const size_t delayed_index = i + latency * kNumStereoChannels;
+      ASSERT_NEAR(reference[i], output[delayed_index], kEpsilon);
+    }
+  }
+}
+
+// Tests that audio queued before a host buffer size change is kept, and that
+// subsequent audio is delayed by the added latency.
+TEST(ResonanceAudioApiImplTest, KeepsQueuedAudioOnLatencyChange) {
+  const size_t kFirstHostBufferSize = 100;
+  const size_t kSecondHostBufferSize = 441;
+  const std::vector<float> input = GenerateStereoInput();
+  std::vector<size_t> latency_frames;
+  const std::vector<float> reference =
+      RenderStereoSource(input, {kFramesPerBuffer}, &latency_frames);
+  const std::vector<float> output = RenderStereoSource(
+      input, {kFirstHostBufferSize, kSecondHostBufferSize}, &latency_frames);
+
+  // The gcd drops from 4 to 1 with the second host buffer.
+  const size_t kFirstLatency = kFramesPerBuffer - 4;
+  const size_t kSecondLatency = kFramesPerBuffer - 1;
+  ASSERT_GE(latency_frames.size(), 2U);
+  EXPECT_EQ(kFirstLatency, latency_frames[0]);
+  for (size_t i = 1; i < latency_frames.size(); ++i) {
+    EXPECT_EQ(kSecondLatency, latency_frames[i]);
+  }
+  for (size_t frame = 0; frame < kNumInputFrames; ++frame) {
+    const size_t latency =
+        frame < kFirstHostBufferSize ? kFirstLatency : kSecondLatency;
+    for (size_t channel = 0; channel < kNumStereoChannels; ++channel) {
+      const size_t index = frame * kNumStereoChannels + channel;
+      ASSERT_NEAR(reference[index],
+                  output[index + latency * kNumStereoChannels], kEpsilon);
+    }
+  }
+  // The added latency leaves a silent gap between the queued and the
+  // subsequent audio.
+  for (size_t frame = kFirstHostBufferSize + kFirstLatency;
+       frame < kFirstHostBufferSize + kSecondLatency; ++frame) {
+    EXPECT_EQ(0.0f, output[frame * kNumStereoChannels]);
+  }
+}
+
+// Tests that the buffer timing stats only count the sources which received
+// input for the processed buffer.
+TEST(ResonanceAudioApiImplTest, CountsOnlySourcesWithInput) {
+  const size_t kNumSources = 4;
+  const size_t kNumBuffers = 3;
+  ResonanceAudioApiImpl api(kNumStereoChannels, kFramesPerBuffer,
+                            kSampleRateHz);
+  std::vector<ResonanceAudioApi::SourceId> source_ids;
+  for (size_t i = 0; i < kNumSources; ++i) {
+    source_ids.push_back(
+        api.CreateSoundObjectSource(RenderingMode::kStereoPanning));
+  }
+  const std::vector<float> input(kFramesPerBuffer, 0.5f);
+  std::vector<float> output(kFramesPerBuffer * kNumStereoChannels);
+  // Buffer |i| receives input for the first |i| sources.
+  for (size_t buffer = 0; buffer < kNumBuffers; ++buffer) {
+    for (size_t i = 0; i < buffer; ++i) {
+      api.SetInterleavedBuffer(source_ids[i], input.data(), kNumMonoChannels,
+                               kFramesPerBuffer);
+    }
+    // No output is available for the first buffer without input.
+    api.FillInterleavedOutputBuffer(kNumStereoChannels, kFramesPerBuffer,
+                                    output.data());
+  }
+
+  BufferTimingStats stats;
+  api.GetBufferTimingStats(&stats);
+  ASSERT_EQ(kNumBuffers, stats.num_buffers);
+  ASSERT_EQ(kNumBuffers, stats.num_worst_buffers);
+  for (size_t i = 0; i < stats.num_worst_buffers; ++i) {
+    const BufferTimingRecord& record = stats.worst_buffers[i];
+    EXPECT_EQ(static_cast<size_t>(record.buffer_index), record.num_sources);
+  }
+}
+
+// Tests that the Ambisonic output is sized for the maximum Ambisonic order, to
+// which sound objects of higher orders are limited.
+TEST(ResonanceAudioApiImplTest, RendersUpToMaxAmbisonicOrder) {
+  // Pairs of the requested maximum order and the rendered maximum order.
+  const std::vector<std::pair<int, int>> kMaxAmbisonicOrders = {
+      {kDefaultMaxAmbisonicOrder, 3}, {4, 3}, {5, 5}, {7, 7}};
+  const std::vector<float> input(kFramesPerBuffer, 0.5f);
+  std::vector<float> output(kFramesPerBuffer * kNumStereoChannels);
+  for (const auto& max_ambisonic_order : kMaxAmbisonicOrders) {
+    ResonanceAudioApiOptions options;
+    options.max_ambisonic_order = max_ambisonic_order.first;
+    ResonanceAudioApiImpl api(kNumStereoChannels, kFramesPerBuffer,
+                              kSampleRateHz, options);
+    const ResonanceAudioApi::SourceId source_id =
+        api.CreateSoundObjectSource(kBinauralUltraHighQuality);
+    api.SetInterleavedBuffer(source_id, input.data(), kNumMonoChannels,
+                             kFramesPerBuffer);
+    EXPECT_TRUE(api.FillInterleavedOutputBuffer(
+        kNumStereoChannels, kFramesPerBuffer, output.data()));
+
+    const AudioBuffer* ambisonic_output = api.GetAmbisonicOutputBuffer();
+    ASSERT_NE(nullptr, ambisonic_output);
+    EXPECT_EQ(GetNumPeriphonicComponents(max_ambisonic_order.second),
+              ambisonic_output->num_channels());
+  }
+}
+
+// Tests that the reflections are rendered at the current reflection order of
+// the room, whose reflections node is only created once the order is used.
+TEST(ResonanceAudioApiImplTest, RendersReflectionsOfCurrentOrder) {
+  const size_t kNumBuffers = 8;
+  const int kHigherReflectionOrder = 3;
+  const size_t kNumFirstOrderChannels =
+      GetNumPeriphonicComponents(1 /* ambisonic_order */);
+  ResonanceAudioApiImpl api(kNumStereoChannels, kFramesPerBuffer,
+                            kSampleRateHz);
+  // Stereo panned sources only feed the Ambisonic output via the reflections.
+  const ResonanceAudioApi::SourceId source_id =
+      api.CreateSoundObjectSource(RenderingMode::kStereoPanning);
+  api.EnableRoomEffects(true);
+  ReflectionProperties reflection_properties;
+  std::fill(std::begin(reflection_properties.room_dimensions),
+            std::end(reflection_properties.room_dimensions), 2.0f);
+  std::fill(std::begin(reflection_properties.coefficients),
+            std::end(reflection_properties.coefficients), 0.5f);
+  reflection_properties.gain = 1.0f;
+
+  const std::vector<float> input(kFramesPerBuffer, 0.5f);
+  std::vector<float> output(kFramesPerBuffer * kNumStereoChannels);
+  // Returns the maximum magnitudes of the first order and the higher order
+  // channels of the Ambisonic output over |kNumBuffers| buffers.
+  const auto render = [&]() {
+    std::pair<float, float> max_magnitudes(0.0f, 0.0f);
+    for (size_t buffer = 0; buffer < kNumBuffers; ++buffer) {
+      api.SetInterleavedBuffer(source_id, input.data(), kNumMonoChannels,
+                               kFramesPerBuffer);
+      api.FillInterleavedOutputBuffer(kNumStereoChannels, kFramesPerBuffer,
+                                      output.data());
+      const AudioBuffer* ambisonic_output = api.GetAmbisonicOutputBuffer();
+      for (size_t channel = 0; channel < ambisonic_output->num_channels();
+           ++channel) {
+        float* max_magnitude = channel < kNumFirstOrderChannels
+                                   ? &max_magnitudes.first
+                                   : &max_magnitudes.second;
+        for (const float sample : (*ambisonic_output)[channel]) {
+          *max_magnitude = std::max(*max_magnitude, std::abs(sample));
+        }
+      }
+    }
+    return max_magnitudes;
+  };
+
+  api.SetReflectionProperties(reflection_properties);
+  const std::pair<float, float> first_order_magnitudes = render();
+  EXPECT_GT(first_order_magnitudes.first, 0.0f);
+  EXPECT_EQ(0.0f, first_order_magnitudes.second);
+
+  reflection_properties.reflection_order = kHigherReflectionOrder;
+  api.SetReflectionProperties(reflection_properties);
+  const std::pair<float, float> higher_order_magnitudes = render();
+  EXPECT_GT(higher_order_magnitudes.first, 0.0f);
+  EXPECT_GT(higher_order_magnitudes.second, 0.0f);
+}
+
+}  // namespace
+
+}  // namespace vraudio
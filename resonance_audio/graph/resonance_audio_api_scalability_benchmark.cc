@@ -0,0 +1,352 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "api/resonance_audio_api.h"
+#include "base/audio_buffer.h"
+#include "base/constants_and_types.h"
+#include "base/misc_math.h"
+#include "utils/benchmark_util.h"
+
+namespace vraudio {
+
+namespace {
+
+// Distance of the sound objects from the listener in meters.
+const float kSourceDistance = 2.0f;
+
+// Angular speed of the sound objects circling around the listener in radians
+// per second.
+const float kSourceAngularSpeedRad = 1.0f;
+
+// Number of untimed buffers rendered before the timed loop, which execute the
+// source creation tasks and let the room effects and the lazily initialized
+// processing state settle.
+const size_t kNumWarmUpBuffers = 16;
+
+// Maximum number of per-buffer latencies recorded per benchmark.
+const size_t kMaxNumRecordedLatencies = 1 << 16;
+
+// Rendering modes swept by the benchmark, indexed by the "mode" argument.
+const RenderingMode kRenderingModes[] = {
+    RenderingMode::kStereoPanning, RenderingMode::kBinauralLowQuality,
+    RenderingMode::kBinauralMediumQuality,
+    RenderingMode::kBinauralHighQuality,
+    RenderingMode::kBinauralVeryHighQuality,
+    RenderingMode::kBinauralUltraHighQuality};
+
+// Maximum Ambisonic orders of the instances rendering the |kRenderingModes|,
+// such that only the modes above third order opt in to higher orders.
+const int kMaxAmbisonicOrders[] = {
+    kDefaultMaxAmbisonicOrder, kDefaultMaxAmbisonicOrder,
+    kDefaultMaxAmbisonicOrder, kDefaultMaxAmbisonicOrder, 5, 7};
+
+// Sweeps the number of sources, rendering mode, frames per buffer, sample rate
+// and room effects.
+void ScalabilityArguments(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"sources", "mode", "frames", "rate", "room"})
+      ->ArgsProduct({{1, 4, 16, 64, 256, 1024, 4096},
+                     {0, 1, 2, 3, 4, 5},
+                     {64, 128, 256, 512, 1024, 2048},
+                     {44100, 48000},
+                     {0, 1}});
+}
+
+// Enables a medium sized shoebox room with reflections and reverb.
+void EnableRoomEffects(ResonanceAudioApi* api) {
+  ReflectionProperties reflection_properties;
+  reflection_properties.room_dimensions[0] = 10.0f;
+  reflection_properties.room_dimensions[1] = 3.0f;
+  reflection_properties.room_dimensions[2] = 8.0f;
+  std::fill(std::begin(reflection_properties.coefficients),
+            std::end(reflection_properties.coefficients), 0.5f);
+  reflection_properties.gain = 1.0f;
+  api->SetReflectionProperties(reflection_properties);
+
+  ReverbProperties reverb_properties;
+  std::fill(std::begin(reverb_properties.rt60_values),
+            std::end(reverb_properties.rt60_values), 1.0f);
+  reverb_properties.gain = 1.0f;
+  api->SetReverbProperties(reverb_properties);
+  api->EnableRoomEffects(true);
+}
+
+// Returns the |percentile| of the sorted |values|.
+double GetPercentile(const std::vector<double>& sorted_values,
+                     double percentile) {
+  if (sorted_values.empty()) {
+    return 0.0;
+  }
+  const size_t index = static_cast<size_t>(
+      percentile * static_cast<double>(sorted_values.size() - 1) + 0.5);
+  return sorted_values[index];
+}
+
+// End-to-end scalability benchmark of the |ResonanceAudioApi|. Each benchmark
+// renders N moving sound objects, where the audio thread (the benchmark
+// thread) feeds the source buffers and pulls the stereo output, and a
+// simulated game thread updates all source positions once per rendered
+// buffer. The reported time is the audio thread time per buffer; the
+// per-buffer latency percentiles and the real-time factor are reported as
+// counters.
+//
+// Example, writing all binaural high quality results for 1024 sources as JSON:
+//   ResonanceAudioScalabilityBenchmark
+//       --benchmark_filter='sources:1024/mode:3'
+//       --benchmark_out=scalability.json --benchmark_out_format=json
+void BM_ResonanceAudioApiScalability(benchmark::State& state) {
+  const size_t num_sources = static_cast<size_t>(state.range(0));
+  const RenderingMode rendering_mode = kRenderingModes[state.range(1)];
+  const size_t frames_per_buffer = static_cast<size_t>(state.range(2));
+  const int sample_rate = static_cast<int>(state.range(3));
+  const bool room_effects = state.range(4) != 0;
+
+  ResonanceAudioApiOptions options;
+  options.max_ambisonic_order = kMaxAmbisonicOrders[state.range(1)];
+  std::unique_ptr<ResonanceAudioApi> api(CreateResonanceAudioApiWithOptions(
+      kNumStereoChannels, frames_per_buffer, sample_rate, &options));
+  if (room_effects) {
+    EnableRoomEffects(api.get());
+  }
+  std::vector<ResonanceAudioApi::SourceId> source_ids(num_sources);
+  for (auto& source_id : source_ids) {
+    source_id = api->CreateSoundObjectSource(rendering_mode);
+  }
+
+  AudioBuffer input(kNumMonoChannels, frames_per_buffer);
+  FillWithNoise(&input);
+  std::vector<float> output(kNumStereoChannels * frames_per_buffer);
+
+  // The game thread updates all source positions once per rendered buffer,
+  // which bounds the number of tasks pending on the audio thread.
+  std::atomic<size_t> num_rendered_buffers(0);
+  std::atomic<bool> is_running(true);
+  std::thread game_thread([&]() {
+    size_t num_updated_buffers = 0;
+    while (is_running.load()) {
+      const size_t num_buffers = num_rendered_buffers.load();
+      if (num_buffers == num_updated_buffers) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        continue;
+      }
+      num_updated_buffers = num_buffers;
+      const float time_seconds = static_cast<float>(num_buffers) *
+                                 static_cast<float>(frames_per_buffer) /
+                                 static_cast<float>(sample_rate);
+      for (size_t i = 0; i < num_sources; ++i) {
+        const float angle =
+            kSourceAngularSpeedRad * time_seconds +
+            kTwoPi * static_cast<float>(i) / static_cast<float>(num_sources);
+        api->SetSourcePosition(source_ids[i],
+                               kSourceDistance * std::sin(angle), 0.0f,
+                               -kSourceDistance * std::cos(angle));
+      }
+    }
+  });
+
+  // Renders a single buffer on the audio (benchmark) thread.
+  const auto render_buffer = [&]() {
+    for (const auto source_id : source_ids) {
+      api->SetInterleavedBuffer(source_id, input[0].begin(), kNumMonoChannels,
+                                frames_per_buffer);
+    }
+    api->FillInterleavedOutputBuffer(kNumStereoChannels, frames_per_buffer,
+                                     output.data());
+  };
+  for (size_t i = 0; i < kNumWarmUpBuffers; ++i) {
+    render_buffer();
+    ++num_rendered_buffers;
+  }
+
+  std::vector<double> latencies_seconds;
+  latencies_seconds.reserve(kMaxNumRecordedLatencies);
+  double total_seconds = 0.0;
+  for (auto _ : state) {
+    const auto start = std::chrono::steady_clock::now();
+    render_buffer();
+    const double elapsed_seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                      start)
+            .count();
+    state.SetIterationTime(elapsed_seconds);
+    total_seconds += elapsed_seconds;
+    if (latencies_seconds.size() < kMaxNumRecordedLatencies) {
+      latencies_seconds.push_back(elapsed_seconds);
+    }
+    ++num_rendered_buffers;
+  }
+  is_running = false;
+  game_thread.join();
+
+  std::sort(latencies_seconds.begin(), latencies_seconds.end());
+  const double kMicrosecondsPerSecond = 1e6;
+  state.counters["p50_us"] =
+      kMicrosecondsPerSecond * GetPercentile(latencies_seconds, 0.5);
+  state.counters["p99_us"] =
+      kMicrosecondsPerSecond * GetPercentile(latencies_seconds, 0.99);
+  state.counters["max_us"] =
+      latencies_seconds.empty()
+          ? 0.0
+          : kMicrosecondsPerSecond * latencies_seconds.back();
+  const double audio_seconds = static_cast<double>(state.iterations()) *
+                               static_cast<double>(frames_per_buffer) /
+                               static_cast<double>(sample_rate);
+  state.counters["real_time_factor"] =
+      total_seconds > 0.0 ? audio_seconds / total_seconds : 0.0;
+  SetFramesProcessed(frames_per_buffer, &state);
+}
+BENCHMARK(BM_ResonanceAudioApiScalability)
+    ->Apply(ScalabilityArguments)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+
+// Distance of the clustered sound objects from the listener in meters, beyond
+// |kMinSourceClusteringDistance|.
+const float kClusteredSourceDistance = 8.0f;
+
+// Frames per buffer and sample rate of the clustering benchmark.
+const size_t kClusteringFramesPerBuffer = 256;
+const int kClusteringSampleRate = 48000;
+
+// Ratio of the number of sources of the clustering benchmark to the number of
+// sources of its reference instance, and number of rendered buffers of the
+// reference instance.
+const size_t kReferenceSourcesRatio = 4;
+const size_t kNumReferenceBuffers = 64;
+
+// Maximum ratio of the median time per clustered source to that of the
+// reference instance, once both have more sources than clusters.
+const double kMaxClusteredCostGrowth = 1.5;
+
+// Creates |num_sources| distant binaural sound objects spread around the
+// listener, with clustering enabled or disabled.
+std::vector<ResonanceAudioApi::SourceId> CreateDistantSources(
+    size_t num_sources, bool enable_clustering, ResonanceAudioApi* api) {
+  std::vector<ResonanceAudioApi::SourceId> source_ids(num_sources);
+  for (size_t i = 0; i < num_sources; ++i) {
+    source_ids[i] =
+        api->CreateSoundObjectSource(RenderingMode::kBinauralHighQuality);
+    api->SetSoundObjectClusteringEnabled(source_ids[i], enable_clustering);
+    const float angle =
+        kTwoPi * static_cast<float>(i) / static_cast<float>(num_sources);
+    api->SetSourcePosition(source_ids[i],
+                           kClusteredSourceDistance * std::sin(angle), 0.0f,
+                           -kClusteredSourceDistance * std::cos(angle));
+  }
+  return source_ids;
+}
+
+// Renders a single buffer of all |source_ids| and returns the elapsed time.
+double RenderClusteringBuffer(
+    const std::vector<ResonanceAudioApi::SourceId>& source_ids,
+    const AudioBuffer& input, ResonanceAudioApi* api,
+    std::vector<float>* output) {
+  const auto start = std::chrono::steady_clock::now();
+  for (const auto source_id : source_ids) {
+    api->SetInterleavedBuffer(source_id, input[0].begin(), kNumMonoChannels,
+                              input.num_frames());
+  }
+  api->FillInterleavedOutputBuffer(kNumStereoChannels, input.num_frames(),
+                                   output->data());
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start)
+      .count();
+}
+
+// Returns the median time per buffer and source of an instance rendering
+// |num_sources| distant sources for |num_buffers| buffers.
+double GetMedianSecondsPerSource(size_t num_sources, bool enable_clustering,
+                                 size_t num_buffers, const AudioBuffer& input,
+                                 std::vector<float>* output) {
+  std::unique_ptr<ResonanceAudioApi> api(CreateResonanceAudioApi(
+      kNumStereoChannels, kClusteringFramesPerBuffer, kClusteringSampleRate));
+  const std::vector<ResonanceAudioApi::SourceId> source_ids =
+      CreateDistantSources(num_sources, enable_clustering, api.get());
+  for (size_t i = 0; i < kNumWarmUpBuffers; ++i) {
+    RenderClusteringBuffer(source_ids, input, api.get(), output);
+  }
+  std::vector<double> elapsed_seconds(num_buffers);
+  for (auto& seconds : elapsed_seconds) {
+    seconds = RenderClusteringBuffer(source_ids, input, api.get(), output);
+  }
+  std::sort(elapsed_seconds.begin(), elapsed_seconds.end());
+  return GetPercentile(elapsed_seconds, 0.5) /
+         static_cast<double>(num_sources);
+}
+
+// Renders distant static sources with clustering enabled or disabled. Beyond
+// |kMaxNumSourceClusters| sources, the time per clustered source must stay
+// flat, which is checked against a reference instance with
+// |kReferenceSourcesRatio| times fewer sources. The growth of the time per
+// source relative to the reference is reported as counter.
+void BM_ResonanceAudioApiClustering(benchmark::State& state) {
+  const size_t num_sources = static_cast<size_t>(state.range(0));
+  const bool enable_clustering = state.range(1) != 0;
+  AudioBuffer input(kNumMonoChannels, kClusteringFramesPerBuffer);
+  FillWithNoise(&input);
+  std::vector<float> output(kNumStereoChannels * kClusteringFramesPerBuffer);
+  const size_t num_reference_sources = num_sources / kReferenceSourcesRatio;
+  const double reference_seconds_per_source = GetMedianSecondsPerSource(
+      num_reference_sources, enable_clustering, kNumReferenceBuffers, input,
+      &output);
+
+  std::unique_ptr<ResonanceAudioApi> api(CreateResonanceAudioApi(
+      kNumStereoChannels, kClusteringFramesPerBuffer, kClusteringSampleRate));
+  const std::vector<ResonanceAudioApi::SourceId> source_ids =
+      CreateDistantSources(num_sources, enable_clustering, api.get());
+  for (size_t i = 0; i < kNumWarmUpBuffers; ++i) {
+    RenderClusteringBuffer(source_ids, input, api.get(), &output);
+  }
+  std::vector<double> latencies_seconds;
+  latencies_seconds.reserve(kMaxNumRecordedLatencies);
+  for (auto _ : state) {
+    const double elapsed_seconds =
+        RenderClusteringBuffer(source_ids, input, api.get(), &output);
+    state.SetIterationTime(elapsed_seconds);
+    if (latencies_seconds.size() < kMaxNumRecordedLatencies) {
+      latencies_seconds.push_back(elapsed_seconds);
+    }
+  }
+
+  std::sort(latencies_seconds.begin(), latencies_seconds.end());
+  const double seconds_per_source = GetPercentile(latencies_seconds, 0.5) /
+                                    static_cast<double>(num_sources);
+  const double cost_growth =
+      seconds_per_source / reference_seconds_per_source;
+  state.counters["us_per_source"] = 1e6 * seconds_per_source;
+  state.counters["cost_growth"] = cost_growth;
+  if (enable_clustering && num_reference_sources > kMaxNumSourceClusters &&
+      cost_growth > kMaxClusteredCostGrowth) {
+    state.SkipWithError("Time per clustered source grows with their number");
+  }
+}
+BENCHMARK(BM_ResonanceAudioApiClustering)
+    ->ArgNames({"sources", "clustering"})
+    ->ArgsProduct({{64, 256, 1024, 4096}, {0, 1}})
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+
+}  // namespace vraudio
@@ -42,11 +42,29 @@ inline void InterpolateFloatParam(float update_step, float target,
   }
 }
 
+// Returns the FFT size of the spectral reverb for a given quality tier.
+inline size_t GetSpectralReverbFftSize(ReverbQuality reverb_quality) {
+  switch (reverb_quality) {
+    case ReverbQuality::kReverbHighQuality:
+      return SpectralReverb::kDefaultFftSize;
+    case ReverbQuality::kReverbLowQuality:
+      return SpectralReverb::kReducedFftSize;
+    default:
+      LOG(FATAL) << "Unknown reverb quality";
+      return SpectralReverb::kDefaultFftSize;
+  }
+}
+
 }  // namespace
 
 ReverbNode::ReverbNode(const SystemSettings& system_settings,
                        FftManager* fft_manager)
+    : ReverbNode(system_settings, fft_manager, kDefaultRoomZoneId) {}
+
+ReverbNode::ReverbNode(const SystemSettings& system_settings,
+                       FftManager* fft_manager, RoomZoneId room_zone_id)
     : system_settings_(system_settings),
+      room_zone_id_(room_zone_id),
       rt60_band_update_steps_(kNumReverbOctaveBands, 0.0f),
       gain_update_step_(0.0f),
       rt60_updating_(false),
@@ -55,10 +73,6 @@ ReverbNode::ReverbNode(const SystemSettings& system_settings,
           static_cast<float>(system_settings_.GetSampleRateHz()) *
           kUpdateTimeSeconds /
           static_cast<float>(system_settings_.GetFramesPerBuffer())),
-      spectral_reverb_(system_settings_.GetSampleRateHz(),
-                       system_settings_.GetFramesPerBuffer()),
-      onset_compensator_(system_settings_.GetSampleRateHz(),
-                         system_settings_.GetFramesPerBuffer(), fft_manager),
       num_frames_processed_on_empty_input_(0),
       reverb_length_frames_(0),
       output_buffer_(kNumStereoChannels, system_settings_.GetFramesPerBuffer()),
@@ -66,6 +80,23 @@ ReverbNode::ReverbNode(const SystemSettings& system_settings,
                                  system_settings_.GetFramesPerBuffer()),
       silence_mono_buffer_(kNumMonoChannels,
                            system_settings_.GetFramesPerBuffer()) {
+  const int sample_rate = system_settings_.GetSampleRateHz();
+  const size_t frames_per_buffer = system_settings_.GetFramesPerBuffer();
+  switch (system_settings_.GetReverbAlgorithm()) {
+    case ReverbAlgorithm::kReverbSpectral:
+      spectral_reverb_.reset(new SpectralReverb(
+          sample_rate, frames_per_buffer,
+          GetSpectralReverbFftSize(system_settings_.GetReverbQuality())));
+      onset_compensator_.reset(new ReverbOnsetCompensator(
+          sample_rate, frames_per_buffer, fft_manager));
+      break;
+    case ReverbAlgorithm::kReverbFeedbackDelayNetwork:
+      fdn_reverb_.reset(new FdnReverb(sample_rate, frames_per_buffer));
+      break;
+    default:
+      LOG(FATAL) << "Unknown reverb algorithm";
+      break;
+  }
   EnableProcessOnEmptyInput(true);
   output_buffer_.Clear();
   silence_mono_buffer_.Clear();
@@ -73,7 +104,8 @@ ReverbNode::ReverbNode(const SystemSettings& system_settings,
 }
 
 void ReverbNode::Update() {
-  new_reverb_properties_ = system_settings_.GetReverbProperties();
+  new_reverb_properties_ =
+      system_settings_.GetRoomZoneReverbProperties(room_zone_id_);
 
   rt60_updating_ = !EqualSafe(std::begin(reverb_properties_.rt60_values),
                               std::end(reverb_properties_.rt60_values),
@@ -102,14 +134,18 @@ const AudioBuffer* ReverbNode::AudioProcess(const NodeInput& input) {
                             new_reverb_properties_.rt60_values[i],
                             &reverb_properties_.rt60_values[i]);
     }
-    spectral_reverb_.SetRt60PerOctaveBand(reverb_properties_.rt60_values);
+    if (fdn_reverb_ != nullptr) {
+      fdn_reverb_->SetRt60PerOctaveBand(reverb_properties_.rt60_values);
+    } else {
+      spectral_reverb_->SetRt60PerOctaveBand(reverb_properties_.rt60_values);
+      onset_compensator_->Update(reverb_properties_.rt60_values,
+                                 reverb_properties_.gain);
+    }
     const auto max_rt_it =
         std::max_element(std::begin(reverb_properties_.rt60_values),
                          std::end(reverb_properties_.rt60_values));
     reverb_length_frames_ = static_cast<size_t>(
         *max_rt_it * static_cast<float>(system_settings_.GetSampleRateHz()));
-    onset_compensator_.Update(reverb_properties_.rt60_values,
-                              reverb_properties_.gain);
     // |InterpolateFloatParam| will set the two values below to be equal on
     // completion of interpolation.
     rt60_updating_ = !EqualSafe(std::begin(reverb_properties_.rt60_values),
@@ -121,9 +157,13 @@ const AudioBuffer* ReverbNode::AudioProcess(const NodeInput& input) {
   if (gain_updating_) {
     InterpolateFloatParam(gain_update_step_, new_reverb_properties_.gain,
                           &reverb_properties_.gain);
-    spectral_reverb_.SetGain(reverb_properties_.gain);
-    onset_compensator_.Update(reverb_properties_.rt60_values,
-                              reverb_properties_.gain);
+    if (fdn_reverb_ != nullptr) {
+      fdn_reverb_->SetGain(reverb_properties_.gain);
+    } else {
+      spectral_reverb_->SetGain(reverb_properties_.gain);
+      onset_compensator_->Update(reverb_properties_.rt60_values,
+                                 reverb_properties_.gain);
+    }
     // |InterpolateFloatParam| will set the two values below to be equal on
     // completion of interpolation.
     gain_updating_ = reverb_properties_.gain != new_reverb_properties_.gain;
@@ -136,8 +176,7 @@ const AudioBuffer* ReverbNode::AudioProcess(const NodeInput& input) {
     if (num_frames_processed_on_empty_input_ < reverb_length_frames_) {
       const size_t num_frames = system_settings_.GetFramesPerBuffer();
       num_frames_processed_on_empty_input_ += num_frames;
-      spectral_reverb_.Process(silence_mono_buffer_[0], &output_buffer_[0],
-                               &output_buffer_[1]);
+      ProcessReverb(silence_mono_buffer_[0]);
       return &output_buffer_;
     } else {
       // Skip processing entirely when the states are fully cleared.
@@ -146,12 +185,21 @@ const AudioBuffer* ReverbNode::AudioProcess(const NodeInput& input) {
   }
   DCHECK_EQ(input_buffer->num_channels(), kNumMonoChannels);
   num_frames_processed_on_empty_input_ = 0;
-  spectral_reverb_.Process((*input_buffer)[0], &output_buffer_[0],
-                           &output_buffer_[1]);
-  onset_compensator_.Process(*input_buffer, &compensator_output_buffer_);
-  output_buffer_[0] += compensator_output_buffer_[0];
-  output_buffer_[1] += compensator_output_buffer_[1];
+  ProcessReverb((*input_buffer)[0]);
+  if (spectral_reverb_ != nullptr) {
+    onset_compensator_->Process(*input_buffer, &compensator_output_buffer_);
+    output_buffer_[0] += compensator_output_buffer_[0];
+    output_buffer_[1] += compensator_output_buffer_[1];
+  }
   return &output_buffer_;
 }
 
+void ReverbNode::ProcessReverb(const AudioBuffer::Channel& input) {
+  if (fdn_reverb_ != nullptr) {
+    fdn_reverb_->Process(input, &output_buffer_[0], &output_buffer_[1]);
+  } else {
+    spectral_reverb_->Process(input, &output_buffer_[0], &output_buffer_[1]);
+  }
+}
+
 }  // namespace vraudio
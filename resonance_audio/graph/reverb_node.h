@@ -17,8 +17,11 @@ limitations under the License.
 #ifndef RESONANCE_AUDIO_GRAPH_REVERB_NODE_H_
 #define RESONANCE_AUDIO_GRAPH_REVERB_NODE_H_
 
+#include <memory>
+
 #include "api/resonance_audio_api.h"
 #include "base/audio_buffer.h"
+#include "dsp/fdn_reverb.h"
 #include "dsp/fft_manager.h"
 #include "dsp/reverb_onset_compensator.h"
 #include "dsp/spectral_reverb.h"
@@ -28,7 +31,9 @@ limitations under the License.
 namespace vraudio {
 
 // Implements a spectral reverb producing a decorrelated stereo output with
-// onset compensated by a pair of convolution filters.
+// onset compensated by a pair of convolution filters. Alternatively, a feedback
+// delay network reverb is used, depending on the reverb quality of the system
+// settings.
 class ReverbNode : public ProcessingNode {
  public:
   // Constructs a |ReverbNode|.
@@ -37,6 +42,14 @@ class ReverbNode : public ProcessingNode {
   // @param fft_manager Pointer to a manager to perform FFT transformations.
   ReverbNode(const SystemSettings& system_settings, FftManager* fft_manager);
 
+  // Constructs a |ReverbNode| for a room zone.
+  //
+  // @param system_settings Global system configuration.
+  // @param fft_manager Pointer to a manager to perform FFT transformations.
+  // @param room_zone_id Id of room zone to render the reverb of.
+  ReverbNode(const SystemSettings& system_settings, FftManager* fft_manager,
+             RoomZoneId room_zone_id);
+
   // Updates the |SpectralReverb| using the current room properties or RT60
   // values depending on the system settings.
   void Update();
@@ -46,9 +59,17 @@ class ReverbNode : public ProcessingNode {
   const AudioBuffer* AudioProcess(const NodeInput& input) override;
 
  private:
+  // Processes the reverb of the current backend into |output_buffer_|.
+  //
+  // @param input Mono input channel.
+  void ProcessReverb(const AudioBuffer::Channel& input);
+
   // Global system configuration.
   const SystemSettings& system_settings_;
 
+  // Id of room zone to render the reverb of.
+  const RoomZoneId room_zone_id_;
+
   // Current reverb properties.
   ReverbProperties reverb_properties_;
 
@@ -70,11 +91,16 @@ class ReverbNode : public ProcessingNode {
   // Number of buffers to updae rt60s over.
   float buffers_to_update_;
 
-  // DSP class to perform filtering associated with the reverb.
-  SpectralReverb spectral_reverb_;
+  // DSP class to perform filtering associated with the reverb. Only one of
+  // |spectral_reverb_| and |fdn_reverb_| is set.
+  std::unique_ptr<SpectralReverb> spectral_reverb_;
+
+  // Feedback delay network reverb, which needs no onset compensation.
+  std::unique_ptr<FdnReverb> fdn_reverb_;
 
-  // DSP class to perform spectral reverb onset compensation.
-  ReverbOnsetCompensator onset_compensator_;
+  // DSP class to perform spectral reverb onset compensation. Only set along
+  // with |spectral_reverb_|.
+  std::unique_ptr<ReverbOnsetCompensator> onset_compensator_;
 
   // Number of frames of zeroed out data to be processed by the node to ensure
   // the entire tail is rendered after input has ceased.
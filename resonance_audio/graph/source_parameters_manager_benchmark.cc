@@ -0,0 +1,79 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "graph/source_parameters_manager.h"
+
+#include <cmath>
+
+#include "benchmark/benchmark.h"
+#include "base/constants_and_types.h"
+#include "base/misc_math.h"
+#include "base/source_parameters.h"
+#include "dsp/distance_attenuation.h"
+
+namespace vraudio {
+
+namespace {
+
+// Distance of the sound objects from the listener in meters.
+const float kSourceDistance = 2.0f;
+
+// Listener rotation per iteration in radians, such that the geometry changes
+// on every buffer.
+const float kListenerRotationStepRad = 0.01f;
+
+// Measures the per buffer pass over all sources which updates their listener
+// relative geometry and gain attenuations, as done by
+// |ResonanceAudioApiImpl::ProcessNextBuffer|.
+void BM_SourceParametersPass(benchmark::State& state) {
+  const size_t num_sources = static_cast<size_t>(state.range(0));
+  SourceParametersManager manager;
+  for (size_t i = 0; i < num_sources; ++i) {
+    const SourceId source_id = static_cast<SourceId>(i);
+    manager.Register(source_id);
+    const float angle =
+        kTwoPi * static_cast<float>(i) / static_cast<float>(num_sources);
+    manager.GetMutableParameters(source_id)->object_transform.position =
+        WorldPosition(kSourceDistance * std::cos(angle), 0.0f,
+                      kSourceDistance * std::sin(angle));
+  }
+  const WorldPosition listener_position(0.0f, 0.0f, 0.0f);
+  float listener_angle = 0.0f;
+  for (auto _ : state) {
+    listener_angle += kListenerRotationStepRad;
+    const WorldRotation listener_rotation(
+        AngleAxisf(listener_angle, WorldPosition::UnitY()));
+    manager.ProcessAllParameters(
+        [&listener_position, &listener_rotation](SourceParameters* parameters) {
+          UpdateSourceGeometry(listener_position, listener_rotation,
+                               parameters);
+          UpdateAttenuationParameters(1.0f /* master_gain */,
+                                      1.0f /* reflections_gain */,
+                                      1.0f /* reverb_gain */, parameters);
+        });
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(num_sources));
+}
+BENCHMARK(BM_SourceParametersPass)
+    ->ArgName("sources")
+    ->RangeMultiplier(4)
+    ->Range(1, 4096);
+
+}  // namespace
+
+}  // namespace vraudio
@@ -34,9 +34,6 @@ const AudioBuffer* StereoMixingPannerNode::AudioProcess(
     const NodeInput& input) {
 
 
-  const WorldPosition& listener_position = system_settings_.GetHeadPosition();
-  const WorldRotation& listener_rotation = system_settings_.GetHeadRotation();
-
   gain_mixer_.Reset();
   for (auto& input_buffer : input.GetInputBuffers()) {
     const int source_id = input_buffer->source_id();
@@ -45,14 +42,9 @@ const AudioBuffer* StereoMixingPannerNode::AudioProcess(
     DCHECK_NE(source_id, kInvalidSourceId);
     DCHECK_EQ(input_buffer->num_channels(), 1U);
 
-    // Compute the relative source direction in spherical angles.
-    const ObjectTransform& source_transform =
-        source_parameters->object_transform;
-    WorldPosition relative_direction;
-    GetRelativeDirection(listener_position, listener_rotation,
-                         source_transform.position, &relative_direction);
-    const SphericalAngle source_direction =
-        SphericalAngle::FromWorldPosition(relative_direction);
+    // Relative source direction in spherical angles.
+    const SphericalAngle& source_direction =
+        source_parameters->geometry.direction_from_listener;
 
 
     CalculateStereoPanGains(source_direction, &coefficients_);
@@ -19,6 +19,7 @@ limitations under the License.
 
 #include "api/resonance_audio_api.h"
 #include "base/constants_and_types.h"
+#include "base/logging.h"
 #include "base/misc_math.h"
 #include "graph/source_parameters_manager.h"
 
@@ -36,9 +37,37 @@ class SystemSettings {
   // @param sample_rate_hz Sample rate.
   SystemSettings(size_t num_output_channels, size_t frames_per_buffer,
                  int sample_rate_hz)
+      : SystemSettings(num_output_channels, frames_per_buffer, sample_rate_hz,
+                       kReverbHighQuality) {}
+
+  // Constructor initializes the system configuration with a given reverb
+  // quality tier.
+  //
+  // @param num_output_channels Number of output channels.
+  // @param frames_per_buffer Buffer size in frames.
+  // @param sample_rate_hz Sample rate.
+  // @param reverb_quality Reverb quality tier.
+  SystemSettings(size_t num_output_channels, size_t frames_per_buffer,
+                 int sample_rate_hz, ReverbQuality reverb_quality)
+      : SystemSettings(num_output_channels, frames_per_buffer, sample_rate_hz,
+                       kReverbSpectral, reverb_quality) {}
+
+  // Constructor initializes the system configuration with a given reverb
+  // algorithm.
+  //
+  // @param num_output_channels Number of output channels.
+  // @param frames_per_buffer Buffer size in frames.
+  // @param sample_rate_hz Sample rate.
+  // @param reverb_algorithm Reverb algorithm.
+  // @param reverb_quality Reverb quality tier of the spectral reverb.
+  SystemSettings(size_t num_output_channels, size_t frames_per_buffer,
+                 int sample_rate_hz, ReverbAlgorithm reverb_algorithm,
+                 ReverbQuality reverb_quality)
       : sample_rate_hz_(sample_rate_hz),
         frames_per_buffer_(frames_per_buffer),
         num_channels_(num_output_channels),
+        reverb_algorithm_(reverb_algorithm),
+        reverb_quality_(reverb_quality),
         head_rotation_(WorldRotation::Identity()),
         head_position_(WorldPosition::Zero()),
         master_gain_(1.0f),
@@ -95,6 +124,16 @@ class SystemSettings {
   // @return Number of output channels.
   size_t GetNumChannels() const { return num_channels_; }
 
+  // Returns the reverb algorithm.
+  //
+  // @return Reverb algorithm.
+  ReverbAlgorithm GetReverbAlgorithm() const { return reverb_algorithm_; }
+
+  // Returns the reverb quality tier.
+  //
+  // @return Reverb quality tier.
+  ReverbQuality GetReverbQuality() const { return reverb_quality_; }
+
   // Returns the head rotation.
   //
   // @return Head orientation.
@@ -115,19 +154,42 @@ class SystemSettings {
   // @param master_gain Master output gain.
   void SetMasterGain(float master_gain) { master_gain_ = master_gain; }
 
-  // Sets current reflection properties.
+  // Sets current reflection properties of the default room zone.
   //
   // @param reflection_properties Reflection properties.
   void SetReflectionProperties(
       const ReflectionProperties& reflection_properties) {
-    reflection_properties_ = reflection_properties;
+    SetRoomZoneReflectionProperties(kDefaultRoomZoneId, reflection_properties);
   }
 
-  // Sets current reverb properties.
+  // Sets current reverb properties of the default room zone.
   //
   // @param reverb_properties Reflection properties.
   void SetReverbProperties(const ReverbProperties& reverb_properties) {
-    reverb_properties_ = reverb_properties;
+    SetRoomZoneReverbProperties(kDefaultRoomZoneId, reverb_properties);
+  }
+
+  // Sets current reflection properties of a room zone.
+  //
+  // @param room_zone_id Room zone id in range [0, |kMaxNumRoomZones|).
+  // @param reflection_properties Reflection properties.
+  void SetRoomZoneReflectionProperties(
+      RoomZoneId room_zone_id,
+      const ReflectionProperties& reflection_properties) {
+    DCHECK_GE(room_zone_id, 0);
+    DCHECK_LT(static_cast<size_t>(room_zone_id), kMaxNumRoomZones);
+    reflection_properties_[room_zone_id] = reflection_properties;
+  }
+
+  // Sets current reverb properties of a room zone.
+  //
+  // @param room_zone_id Room zone id in range [0, |kMaxNumRoomZones|).
+  // @param reverb_properties Reverb properties.
+  void SetRoomZoneReverbProperties(RoomZoneId room_zone_id,
+                                   const ReverbProperties& reverb_properties) {
+    DCHECK_GE(room_zone_id, 0);
+    DCHECK_LT(static_cast<size_t>(room_zone_id), kMaxNumRoomZones);
+    reverb_properties_[room_zone_id] = reverb_properties;
   }
 
   // Returns the master gain.
@@ -135,18 +197,40 @@ class SystemSettings {
   // @return Master output gain.
   float GetMasterGain() const { return master_gain_; }
 
-  // Returns the current reflection properties of the environment.
+  // Returns the current reflection properties of the default room zone.
   //
   // @return Current reflection properties.
   const ReflectionProperties& GetReflectionProperties() const {
-    return reflection_properties_;
+    return GetRoomZoneReflectionProperties(kDefaultRoomZoneId);
   }
 
-  // Returns the current reverb properties of the environment.
+  // Returns the current reverb properties of the default room zone.
   //
   // @return Current reverb properties.
   const ReverbProperties& GetReverbProperties() const {
-    return reverb_properties_;
+    return GetRoomZoneReverbProperties(kDefaultRoomZoneId);
+  }
+
+  // Returns the current reflection properties of a room zone.
+  //
+  // @param room_zone_id Room zone id in range [0, |kMaxNumRoomZones|).
+  // @return Current reflection properties.
+  const ReflectionProperties& GetRoomZoneReflectionProperties(
+      RoomZoneId room_zone_id) const {
+    DCHECK_GE(room_zone_id, 0);
+    DCHECK_LT(static_cast<size_t>(room_zone_id), kMaxNumRoomZones);
+    return reflection_properties_[room_zone_id];
+  }
+
+  // Returns the current reverb properties of a room zone.
+  //
+  // @param room_zone_id Room zone id in range [0, |kMaxNumRoomZones|).
+  // @return Current reverb properties.
+  const ReverbProperties& GetRoomZoneReverbProperties(
+      RoomZoneId room_zone_id) const {
+    DCHECK_GE(room_zone_id, 0);
+    DCHECK_LT(static_cast<size_t>(room_zone_id), kMaxNumRoomZones);
+    return reverb_properties_[room_zone_id];
   }
 
   // Disable copy and assignment operator. Since |SystemSettings| serves as a
@@ -164,6 +248,12 @@ class SystemSettings {
   // Number of channels per buffer.
   const size_t num_channels_;
 
+  // Reverb algorithm.
+  const ReverbAlgorithm reverb_algorithm_;
+
+  // Reverb quality tier.
+  const ReverbQuality reverb_quality_;
+
   // The most recently updated head rotation and position.
   WorldRotation head_rotation_;
   WorldPosition head_position_;
@@ -174,11 +264,11 @@ class SystemSettings {
   // Master gain in amplitude.
   float master_gain_;
 
-  // Current reflection properties of the environment.
-  ReflectionProperties reflection_properties_;
+  // Current reflection properties of each room zone.
+  ReflectionProperties reflection_properties_[kMaxNumRoomZones];
 
-  // Current reverb properties of the environment.
-  ReverbProperties reverb_properties_;
+  // Current reverb properties of each room zone.
+  ReverbProperties reverb_properties_[kMaxNumRoomZones];
 
   // Defines the state of the global speaker mode.
   bool stereo_speaker_mode_;
@@ -201,6 +201,8 @@ template <class T>
 void Node::Input<T>::AddOutput(const std::shared_ptr<Node>& node,
                                Output<T>* output) {
   outputs_[output] = node;
+  // Grow the read buffer on connection rather than during processing.
+  read_data_.reserve(outputs_.size());
 
   DCHECK(outputs_.find(output) != outputs_.end());
 }
@@ -240,6 +242,8 @@ void Node::Output<T>::Write(T data) {
 template <class T>
 void Node::Output<T>::AddInput(Input<T>* input) {
   inputs_.insert(input);
+  // Grow the write buffer on connection rather than during processing.
+  written_data_.reserve(inputs_.size());
 }
 
 template <class T>
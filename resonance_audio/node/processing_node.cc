@@ -16,6 +16,12 @@ limitations under the License.
 
 #include "node/processing_node.h"
 
+#if defined(ENABLE_NODE_PROFILING)
+#include <typeinfo>
+
+#include "utils/node_profiler.h"
+#endif  // defined(ENABLE_NODE_PROFILING)
+
 namespace vraudio {
 
 ProcessingNode::NodeInput::NodeInput(
@@ -38,7 +44,15 @@ ProcessingNode::NodeInput::GetInputBuffers() const {
 }
 
 ProcessingNode::ProcessingNode()
-    : Node(), output_stream_(this), process_on_no_input_(false) {}
+    : Node(),
+      output_stream_(this),
+      process_on_no_input_(false)
+#if defined(ENABLE_NODE_PROFILING)
+      ,
+      profiler_node_id_(NodeProfiler::GenerateNodeId())
+#endif  // defined(ENABLE_NODE_PROFILING)
+{
+}
 
 void ProcessingNode::Connect(
     const std::shared_ptr<PublisherNodeType>& publisher_node) {
@@ -51,7 +65,22 @@ void ProcessingNode::Process() {
   const AudioBuffer* output = nullptr;
   // Only call AudioProcess if input data is available.
   if (process_on_no_input_ || !input.GetInputBuffers().empty()) {
+#if defined(ENABLE_NODE_PROFILING)
+    NodeProfiler* profiler = NodeProfiler::GetCurrent();
+    if (profiler != nullptr) {
+      // Upstream nodes have already been processed by |Read|, so this only
+      // measures the time spent in this node.
+      const uint64_t begin_ticks = ReadProfilerTicks();
+      output = AudioProcess(input);
+      profiler->RecordNodeCall(profiler_node_id_, typeid(*this), begin_ticks,
+                               ReadProfilerTicks(),
+                               input.GetInputBuffers().size());
+    } else {
+      output = AudioProcess(input);
+    }
+#else
     output = AudioProcess(input);
+#endif  // defined(ENABLE_NODE_PROFILING)
   }
   output_stream_.Write(output);
 }
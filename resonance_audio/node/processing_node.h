@@ -108,6 +108,11 @@ class ProcessingNode : public Node,
   // Flag that indicates if |AudioProcess| should be called in case no input
   // data is available.
   bool process_on_no_input_;
+
+#if defined(ENABLE_NODE_PROFILING)
+  // Unique id of this node, which identifies it in the profiler stats.
+  const size_t profiler_node_id_;
+#endif  // defined(ENABLE_NODE_PROFILING)
 };
 
 }  // namespace vraudio
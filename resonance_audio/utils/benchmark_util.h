@@ -0,0 +1,73 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef RESONANCE_AUDIO_UTILS_BENCHMARK_UTIL_H_
+#define RESONANCE_AUDIO_UTILS_BENCHMARK_UTIL_H_
+
+#include <cstddef>
+
+#include "benchmark/benchmark.h"
+#include "base/audio_buffer.h"
+#include "base/constants_and_types.h"
+#include "dsp/utils.h"
+
+namespace vraudio {
+
+// Range of frames per buffer swept by the benchmarks.
+const int kMinBenchmarkFramesPerBuffer = 64;
+const int kMaxBenchmarkFramesPerBuffer = 4096;
+
+// Sweeps the number of frames per buffer, which is passed as |state.range(0)|.
+inline void FramesPerBufferArguments(benchmark::internal::Benchmark* bench) {
+  bench->ArgName("frames")
+      ->RangeMultiplier(2)
+      ->Range(kMinBenchmarkFramesPerBuffer, kMaxBenchmarkFramesPerBuffer);
+}
+
+// Sweeps the number of frames per buffer and the ambisonic order, which are
+// passed as |state.range(0)| and |state.range(1)| respectively.
+inline void FramesPerBufferAndOrderArguments(
+    benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"frames", "order"});
+  for (int order = 1; order <= kMaxSupportedAmbisonicOrder; ++order) {
+    for (int frames = kMinBenchmarkFramesPerBuffer;
+         frames <= kMaxBenchmarkFramesPerBuffer; frames *= 2) {
+      bench->Args({frames, order});
+    }
+  }
+}
+
+// Fills each channel of |buffer| with uniform noise between -1 and 1.
+inline void FillWithNoise(AudioBuffer* buffer) {
+  for (size_t channel = 0; channel < buffer->num_channels(); ++channel) {
+    GenerateUniformNoise(-1.0f, 1.0f, static_cast<unsigned>(channel),
+                         &(*buffer)[channel]);
+  }
+}
+
+// Reports the throughput of a benchmark in frames per second.
+//
+// @param frames_per_iteration Number of frames processed per iteration.
+// @param state Benchmark state.
+inline void SetFramesProcessed(size_t frames_per_iteration,
+                               benchmark::State* state) {
+  state->SetItemsProcessed(static_cast<int64_t>(state->iterations()) *
+                           static_cast<int64_t>(frames_per_iteration));
+}
+
+}  // namespace vraudio
+
+#endif  // RESONANCE_AUDIO_UTILS_BENCHMARK_UTIL_H_
@@ -0,0 +1,161 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include "utils/buffer_deadline_monitor.h"
+
+#include <algorithm>
+
+#include "base/logging.h"
+
+namespace vraudio {
+
+namespace {
+
+// Converts nanoseconds to milliseconds.
+double NanosecondsToMilliseconds(uint64_t nanoseconds) {
+  return static_cast<double>(nanoseconds) * 1e-6;
+}
+
+}  // namespace
+
+BufferDeadlineMonitor::BufferDeadlineMonitor(size_t frames_per_buffer,
+                                             int sample_rate_hz)
+    : budget_ns_(static_cast<uint64_t>(frames_per_buffer) * 1000000000ULL /
+                 static_cast<uint64_t>(std::max(sample_rate_hz, 1))),
+      num_buffers_(0),
+      num_deadline_overruns_(0),
+      total_processing_time_ns_(0),
+      worst_buffers_sequence_(0),
+      num_worst_buffers_(0) {
+  Reset();
+}
+
+void BufferDeadlineMonitor::RecordBuffer(uint64_t processing_time_ns,
+                                         size_t num_sources,
+                                         bool room_effects_enabled) {
+  const uint64_t buffer_index =
+      num_buffers_.load(std::memory_order_relaxed);
+  total_processing_time_ns_.store(
+      total_processing_time_ns_.load(std::memory_order_relaxed) +
+          processing_time_ns,
+      std::memory_order_relaxed);
+  if (processing_time_ns > budget_ns_) {
+    num_deadline_overruns_.fetch_add(1, std::memory_order_relaxed);
+  }
+  const uint64_t load_percent =
+      budget_ns_ > 0 ? processing_time_ns * 100 / budget_ns_ : 0;
+  const size_t bin = static_cast<size_t>(
+      std::min<uint64_t>(load_percent / kBufferLoadHistogramBinPercent,
+                         kNumBufferLoadHistogramBins - 1));
+  load_histogram_[bin].fetch_add(1, std::memory_order_relaxed);
+
+  // Insert the buffer into the slowest buffers if it is slower than the
+  // fastest of them.
+  const size_t num_worst_buffers =
+      num_worst_buffers_.load(std::memory_order_relaxed);
+  size_t insert_index = num_worst_buffers;
+  while (insert_index > 0 &&
+         worst_buffers_[insert_index - 1].processing_time_ns.load(
+             std::memory_order_relaxed) < processing_time_ns) {
+    --insert_index;
+  }
+  if (insert_index < kMaxNumWorstBufferRecords) {
+    worst_buffers_sequence_.fetch_add(1, std::memory_order_acq_rel);
+    const size_t last_index =
+        std::min(num_worst_buffers, kMaxNumWorstBufferRecords - 1);
+    for (size_t i = last_index; i > insert_index; --i) {
+      const Record& source = worst_buffers_[i - 1];
+      Record* target = &worst_buffers_[i];
+      target->buffer_index.store(
+          source.buffer_index.load(std::memory_order_relaxed),
+          std::memory_order_relaxed);
+      target->processing_time_ns.store(
+          source.processing_time_ns.load(std::memory_order_relaxed),
+          std::memory_order_relaxed);
+      target->num_sources.store(
+          source.num_sources.load(std::memory_order_relaxed),
+          std::memory_order_relaxed);
+      target->room_effects_enabled.store(
+          source.room_effects_enabled.load(std::memory_order_relaxed),
+          std::memory_order_relaxed);
+    }
+    Record* record = &worst_buffers_[insert_index];
+    record->buffer_index.store(buffer_index, std::memory_order_relaxed);
+    record->processing_time_ns.store(processing_time_ns,
+                                     std::memory_order_relaxed);
+    record->num_sources.store(num_sources, std::memory_order_relaxed);
+    record->room_effects_enabled.store(room_effects_enabled,
+                                       std::memory_order_relaxed);
+    num_worst_buffers_.store(last_index + 1, std::memory_order_relaxed);
+    worst_buffers_sequence_.fetch_add(1, std::memory_order_release);
+  }
+  num_buffers_.store(buffer_index + 1, std::memory_order_release);
+}
+
+void BufferDeadlineMonitor::Reset() {
+  num_buffers_.store(0, std::memory_order_relaxed);
+  num_deadline_overruns_.store(0, std::memory_order_relaxed);
+  total_processing_time_ns_.store(0, std::memory_order_relaxed);
+  for (auto& bin : load_histogram_) {
+    bin.store(0, std::memory_order_relaxed);
+  }
+  worst_buffers_sequence_.fetch_add(1, std::memory_order_acq_rel);
+  num_worst_buffers_.store(0, std::memory_order_relaxed);
+  worst_buffers_sequence_.fetch_add(1, std::memory_order_release);
+}
+
+void BufferDeadlineMonitor::GetStats(BufferTimingStats* stats) const {
+  DCHECK(stats);
+  stats->budget_ms = NanosecondsToMilliseconds(budget_ns_);
+  stats->num_buffers = num_buffers_.load(std::memory_order_acquire);
+  stats->num_deadline_overruns =
+      num_deadline_overruns_.load(std::memory_order_relaxed);
+  stats->total_processing_time_ms = NanosecondsToMilliseconds(
+      total_processing_time_ns_.load(std::memory_order_relaxed));
+  for (size_t i = 0; i < kNumBufferLoadHistogramBins; ++i) {
+    stats->load_histogram[i] =
+        load_histogram_[i].load(std::memory_order_relaxed);
+  }
+
+  // Retry until the slowest buffers are read without a concurrent update.
+  uint32_t sequence = 0;
+  do {
+    sequence = worst_buffers_sequence_.load(std::memory_order_acquire);
+    if ((sequence & 1U) != 0) {
+      continue;
+    }
+    stats->num_worst_buffers =
+        num_worst_buffers_.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < stats->num_worst_buffers; ++i) {
+      const Record& record = worst_buffers_[i];
+      BufferTimingRecord* output = &stats->worst_buffers[i];
+      output->buffer_index =
+          record.buffer_index.load(std::memory_order_relaxed);
+      output->processing_time_ms = NanosecondsToMilliseconds(
+          record.processing_time_ns.load(std::memory_order_relaxed));
+      output->num_sources = static_cast<size_t>(
+          record.num_sources.load(std::memory_order_relaxed));
+      output->room_effects_enabled =
+          record.room_effects_enabled.load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+  } while ((sequence & 1U) != 0 ||
+           sequence !=
+               worst_buffers_sequence_.load(std::memory_order_relaxed));
+}
+
+}  // namespace vraudio
@@ -0,0 +1,92 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#ifndef RESONANCE_AUDIO_UTILS_BUFFER_DEADLINE_MONITOR_H_
+#define RESONANCE_AUDIO_UTILS_BUFFER_DEADLINE_MONITOR_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "api/resonance_audio_api.h"
+
+namespace vraudio {
+
+// Tracks the processing time of audio buffers against their real-time budget.
+// Buffers are recorded by a single (audio) thread, while snapshots may be taken
+// from any thread without blocking. The slowest buffers are guarded by a
+// sequence lock, which the writer only takes when a new slowest buffer is
+// found.
+class BufferDeadlineMonitor {
+ public:
+  // Constructor.
+  //
+  // @param frames_per_buffer Number of frames per buffer.
+  // @param sample_rate_hz Sample rate.
+  BufferDeadlineMonitor(size_t frames_per_buffer, int sample_rate_hz);
+
+  // Records the processing time of the next buffer. Must only be called from
+  // a single thread.
+  //
+  // @param processing_time_ns Processing time in nanoseconds.
+  // @param num_sources Number of active sources.
+  // @param room_effects_enabled True if room effects are enabled.
+  void RecordBuffer(uint64_t processing_time_ns, size_t num_sources,
+                    bool room_effects_enabled);
+
+  // Clears all stats. Must only be called from the thread that records
+  // buffers.
+  void Reset();
+
+  // Takes a snapshot of the stats. This method is thread-safe.
+  //
+  // @param stats Output buffer timing stats.
+  void GetStats(BufferTimingStats* stats) const;
+
+ private:
+  // Atomic counterpart of |BufferTimingRecord|.
+  struct Record {
+    std::atomic<uint64_t> buffer_index;
+    std::atomic<uint64_t> processing_time_ns;
+    std::atomic<uint64_t> num_sources;
+    std::atomic<bool> room_effects_enabled;
+  };
+
+  // Real-time budget of a buffer in nanoseconds.
+  const uint64_t budget_ns_;
+
+  std::atomic<uint64_t> num_buffers_;
+  std::atomic<uint64_t> num_deadline_overruns_;
+  std::atomic<uint64_t> total_processing_time_ns_;
+  std::array<std::atomic<uint64_t>, kNumBufferLoadHistogramBins>
+      load_histogram_;
+
+  // Sequence counter of |worst_buffers_|, which is odd while the writer
+  // updates them.
+  std::atomic<uint32_t> worst_buffers_sequence_;
+
+  // Number of valid entries in |worst_buffers_|.
+  std::atomic<size_t> num_worst_buffers_;
+
+  // Slowest buffers, sorted by descending processing time.
+  std::array<Record, kMaxNumWorstBufferRecords> worst_buffers_;
+};
+
+}  // namespace vraudio
+
+#endif  // RESONANCE_AUDIO_UTILS_BUFFER_DEADLINE_MONITOR_H_
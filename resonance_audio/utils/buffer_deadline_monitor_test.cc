@@ -0,0 +1,128 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include "utils/buffer_deadline_monitor.h"
+
+#include <atomic>
+#include <thread>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace vraudio {
+
+namespace {
+
+const size_t kFramesPerBuffer = 480;
+const int kSampleRateHz = 48000;
+
+// Real-time budget of |kFramesPerBuffer| at |kSampleRateHz|.
+const uint64_t kBudgetNs = 10000000;
+
+// Tests that buffers are counted in the histogram bin of their load and that
+// buffers above the budget are counted as overruns.
+TEST(BufferDeadlineMonitorTest, CountsLoadAndOverruns) {
+  BufferDeadlineMonitor monitor(kFramesPerBuffer, kSampleRateHz);
+  monitor.RecordBuffer(kBudgetNs / 20, 1, false);
+  monitor.RecordBuffer(kBudgetNs / 2, 2, false);
+  monitor.RecordBuffer(kBudgetNs, 3, true);
+  monitor.RecordBuffer(kBudgetNs * 3 / 2, 4, true);
+  monitor.RecordBuffer(kBudgetNs * 5, 5, true);
+
+  BufferTimingStats stats;
+  monitor.GetStats(&stats);
+  EXPECT_DOUBLE_EQ(10.0, stats.budget_ms);
+  EXPECT_EQ(5U, stats.num_buffers);
+  EXPECT_EQ(2U, stats.num_deadline_overruns);
+  EXPECT_DOUBLE_EQ(80.5, stats.total_processing_time_ms);
+  for (size_t i = 0; i < kNumBufferLoadHistogramBins; ++i) {
+    const uint64_t expected_count =
+        (i == 0 || i == 5 || i == 10 || i == 15 || i == 20) ? 1U : 0U;
+    EXPECT_EQ(expected_count, stats.load_histogram[i]) << "Bin " << i;
+  }
+
+  ASSERT_EQ(5U, stats.num_worst_buffers);
+  EXPECT_EQ(4U, stats.worst_buffers[0].buffer_index);
+  EXPECT_DOUBLE_EQ(50.0, stats.worst_buffers[0].processing_time_ms);
+  EXPECT_EQ(5U, stats.worst_buffers[0].num_sources);
+  EXPECT_TRUE(stats.worst_buffers[0].room_effects_enabled);
+  EXPECT_EQ(0U, stats.worst_buffers[4].buffer_index);
+  EXPECT_FALSE(stats.worst_buffers[4].room_effects_enabled);
+
+  monitor.Reset();
+  monitor.GetStats(&stats);
+  EXPECT_EQ(0U, stats.num_buffers);
+  EXPECT_EQ(0U, stats.num_deadline_overruns);
+  EXPECT_EQ(0U, stats.num_worst_buffers);
+  EXPECT_EQ(0U, stats.load_histogram[20]);
+}
+
+// Tests that only the slowest buffers are kept, sorted by descending
+// processing time.
+TEST(BufferDeadlineMonitorTest, KeepsSlowestBuffers) {
+  BufferDeadlineMonitor monitor(kFramesPerBuffer, kSampleRateHz);
+  const size_t kNumBuffers = 4 * kMaxNumWorstBufferRecords;
+  for (size_t i = 0; i < kNumBuffers; ++i) {
+    // Alternate between fast and increasingly slow buffers.
+    const uint64_t processing_time_ns = (i % 2 == 0) ? 1000 : 1000 * (i + 1);
+    monitor.RecordBuffer(processing_time_ns, i, false);
+  }
+
+  BufferTimingStats stats;
+  monitor.GetStats(&stats);
+  ASSERT_EQ(kMaxNumWorstBufferRecords, stats.num_worst_buffers);
+  for (size_t i = 0; i < kMaxNumWorstBufferRecords; ++i) {
+    EXPECT_EQ(kNumBuffers - 1 - 2 * i, stats.worst_buffers[i].buffer_index);
+    EXPECT_EQ(stats.worst_buffers[i].buffer_index,
+              stats.worst_buffers[i].num_sources);
+  }
+}
+
+// Tests that snapshots taken concurrently to recording are consistent.
+TEST(BufferDeadlineMonitorTest, ConsistentConcurrentSnapshots) {
+  BufferDeadlineMonitor monitor(kFramesPerBuffer, kSampleRateHz);
+  const size_t kNumBuffers = 100000;
+  std::atomic<bool> done(false);
+  std::thread writer([&monitor, &done]() {
+    for (size_t i = 0; i < kNumBuffers; ++i) {
+      monitor.RecordBuffer(1000 + i, i, i % 2 == 0);
+    }
+    done = true;
+  });
+
+  BufferTimingStats stats;
+  while (!done) {
+    monitor.GetStats(&stats);
+    ASSERT_LE(stats.num_worst_buffers, kMaxNumWorstBufferRecords);
+    for (size_t i = 0; i < stats.num_worst_buffers; ++i) {
+      const BufferTimingRecord& record = stats.worst_buffers[i];
+      EXPECT_EQ(record.buffer_index, record.num_sources);
+      EXPECT_EQ(record.buffer_index % 2 == 0, record.room_effects_enabled);
+      if (i > 0) {
+        EXPECT_LT(record.buffer_index, stats.worst_buffers[i - 1].buffer_index);
+      }
+    }
+  }
+  writer.join();
+
+  monitor.GetStats(&stats);
+  EXPECT_EQ(kNumBuffers, stats.num_buffers);
+  EXPECT_EQ(kNumBuffers - 1, stats.worst_buffers[0].buffer_index);
+}
+
+}  // namespace
+
+}  // namespace vraudio
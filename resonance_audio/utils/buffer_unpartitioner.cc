@@ -58,14 +58,16 @@ size_t BufferUnpartitioner::GetBuffer(float* output_buffer, size_t num_channels,
   return GetBufferTemplated<float*>(output_buffer, num_channels, num_frames);
 }
 
-size_t BufferUnpartitioner::GetBuffer(int16** output_buffer,
+size_t BufferUnpartitioner::GetBuffer(int16* const* output_buffer,
                                       size_t num_channels, size_t num_frames) {
-  return GetBufferTemplated<int16**>(output_buffer, num_channels, num_frames);
+  return GetBufferTemplated<int16* const*>(output_buffer, num_channels,
+                                           num_frames);
 }
 
-size_t BufferUnpartitioner::GetBuffer(float** output_buffer,
+size_t BufferUnpartitioner::GetBuffer(float* const* output_buffer,
                                       size_t num_channels, size_t num_frames) {
-  return GetBufferTemplated<float**>(output_buffer, num_channels, num_frames);
+  return GetBufferTemplated<float* const*>(output_buffer, num_channels,
+                                           num_frames);
 }
 
 size_t BufferUnpartitioner::GetNumBufferedFrames() const {
@@ -78,7 +78,7 @@ class BufferUnpartitioner {
   // @param num_channels Number of channels in output buffer.
   // @param num_frames Number of frames in output buffer.
   // @return Number of frames actually written.
-  size_t GetBuffer(int16** output_buffer, size_t num_channels,
+  size_t GetBuffer(int16* const* output_buffer, size_t num_channels,
                    size_t num_frames);
 
   // Requests a planar float output buffer. This method triggers
@@ -88,7 +88,7 @@ class BufferUnpartitioner {
   // @param num_channels Number of channels in output buffer.
   // @param num_frames Number of frames in output buffer.
   // @return Number of frames actually written.
-  size_t GetBuffer(float** output_buffer, size_t num_channels,
+  size_t GetBuffer(float* const* output_buffer, size_t num_channels,
                    size_t num_frames);
 
   // Clears internal temporary buffer that holds remaining audio frames.
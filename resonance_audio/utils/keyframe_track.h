@@ -0,0 +1,133 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef RESONANCE_AUDIO_UTILS_KEYFRAME_TRACK_H_
+#define RESONANCE_AUDIO_UTILS_KEYFRAME_TRACK_H_
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "base/logging.h"
+#include "base/misc_math.h"
+
+namespace vraudio {
+
+// Interpolates between two keyframe values.
+//
+// @param from Value of preceding keyframe.
+// @param to Value of succeeding keyframe.
+// @param t Interpolation factor in range [0, 1].
+// @return Interpolated value.
+inline float InterpolateKeyframes(float from, float to, float t) {
+  return from + t * (to - from);
+}
+
+inline WorldPosition InterpolateKeyframes(const WorldPosition& from,
+                                          const WorldPosition& to, float t) {
+  return WorldPosition(from + t * (to - from));
+}
+
+inline WorldRotation InterpolateKeyframes(const WorldRotation& from,
+                                          const WorldRotation& to, float t) {
+  return WorldRotation(from.slerp(t, to));
+}
+
+// Time-varying parameter given by a sequence of keyframes. Values between two
+// keyframes are interpolated via |InterpolateKeyframes|, values before the
+// first and after the last keyframe are held constant.
+template <typename ValueType>
+class KeyframeTrack {
+ public:
+  // Adds a keyframe. An existing keyframe at the same frame is replaced.
+  //
+  // @param frame Frame position of keyframe.
+  // @param value Parameter value at |frame|.
+  void AddKeyframe(size_t frame, const ValueType& value);
+
+  // Returns true if no keyframe has been added.
+  bool empty() const { return keyframes_.empty(); }
+
+  // Returns the interpolated parameter value. Must not be called on an empty
+  // track.
+  //
+  // @param frame Frame position.
+  // @return Parameter value at |frame|.
+  ValueType GetValue(size_t frame) const;
+
+  // Returns the frame position of the first keyframe after |frame|. Values
+  // between |frame| and this position are linearly interpolated.
+  //
+  // @param frame Frame position.
+  // @return Frame position of next keyframe, or the maximum frame position if
+  //     there is none.
+  size_t GetNextKeyframeFrame(size_t frame) const;
+
+ private:
+  // Keyframes sorted by frame position.
+  std::vector<std::pair<size_t, ValueType>> keyframes_;
+};
+
+template <typename ValueType>
+void KeyframeTrack<ValueType>::AddKeyframe(size_t frame,
+                                           const ValueType& value) {
+  auto it = std::lower_bound(
+      keyframes_.begin(), keyframes_.end(), frame,
+      [](const std::pair<size_t, ValueType>& keyframe, size_t search_frame) {
+        return keyframe.first < search_frame;
+      });
+  if (it != keyframes_.end() && it->first == frame) {
+    it->second = value;
+    return;
+  }
+  keyframes_.emplace(it, frame, value);
+}
+
+template <typename ValueType>
+ValueType KeyframeTrack<ValueType>::GetValue(size_t frame) const {
+  DCHECK(!keyframes_.empty());
+  auto next = std::upper_bound(
+      keyframes_.begin(), keyframes_.end(), frame,
+      [](size_t search_frame, const std::pair<size_t, ValueType>& keyframe) {
+        return search_frame < keyframe.first;
+      });
+  if (next == keyframes_.begin()) {
+    return next->second;
+  }
+  if (next == keyframes_.end()) {
+    return keyframes_.back().second;
+  }
+  const auto previous = next - 1;
+  const float t = static_cast<float>(frame - previous->first) /
+                  static_cast<float>(next->first - previous->first);
+  return InterpolateKeyframes(previous->second, next->second, t);
+}
+
+template <typename ValueType>
+size_t KeyframeTrack<ValueType>::GetNextKeyframeFrame(size_t frame) const {
+  auto next = std::upper_bound(
+      keyframes_.begin(), keyframes_.end(), frame,
+      [](size_t search_frame, const std::pair<size_t, ValueType>& keyframe) {
+        return search_frame < keyframe.first;
+      });
+  return next == keyframes_.end() ? std::numeric_limits<size_t>::max()
+                                  : next->first;
+}
+
+}  // namespace vraudio
+
+#endif  // RESONANCE_AUDIO_UTILS_KEYFRAME_TRACK_H_
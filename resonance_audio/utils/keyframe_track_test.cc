@@ -0,0 +1,89 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "utils/keyframe_track.h"
+
+#include <limits>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+#include "base/constants_and_types.h"
+
+namespace vraudio {
+
+namespace {
+
+// Tests that values are held before the first and after the last keyframe and
+// linearly interpolated in between, regardless of the insertion order.
+TEST(KeyframeTrackTest, InterpolatesFloatKeyframes) {
+  KeyframeTrack<float> track;
+  EXPECT_TRUE(track.empty());
+  track.AddKeyframe(200, 3.0f);
+  track.AddKeyframe(100, 1.0f);
+  track.AddKeyframe(300, 0.0f);
+  EXPECT_FALSE(track.empty());
+
+  EXPECT_FLOAT_EQ(1.0f, track.GetValue(0));
+  EXPECT_FLOAT_EQ(1.0f, track.GetValue(100));
+  EXPECT_FLOAT_EQ(2.0f, track.GetValue(150));
+  EXPECT_FLOAT_EQ(3.0f, track.GetValue(200));
+  EXPECT_FLOAT_EQ(1.5f, track.GetValue(250));
+  EXPECT_FLOAT_EQ(0.0f, track.GetValue(1000));
+
+  // Adding a keyframe at an existing position replaces its value.
+  track.AddKeyframe(200, 5.0f);
+  EXPECT_FLOAT_EQ(3.0f, track.GetValue(150));
+}
+
+// Tests that the next keyframe is found strictly after the given frame.
+TEST(KeyframeTrackTest, FindsNextKeyframe) {
+  KeyframeTrack<float> track;
+  EXPECT_EQ(std::numeric_limits<size_t>::max(), track.GetNextKeyframeFrame(0));
+  track.AddKeyframe(200, 3.0f);
+  track.AddKeyframe(100, 1.0f);
+  EXPECT_EQ(100U, track.GetNextKeyframeFrame(0));
+  EXPECT_EQ(200U, track.GetNextKeyframeFrame(100));
+  EXPECT_EQ(200U, track.GetNextKeyframeFrame(199));
+  EXPECT_EQ(std::numeric_limits<size_t>::max(),
+            track.GetNextKeyframeFrame(200));
+}
+
+// Tests that positions are interpolated linearly and rotations along the
+// shortest arc.
+TEST(KeyframeTrackTest, InterpolatesPositionsAndRotations) {
+  KeyframeTrack<WorldPosition> position_track;
+  position_track.AddKeyframe(0, WorldPosition(0.0f, 0.0f, 0.0f));
+  position_track.AddKeyframe(100, WorldPosition(2.0f, -4.0f, 1.0f));
+  const WorldPosition position = position_track.GetValue(25);
+  EXPECT_FLOAT_EQ(0.5f, position.x());
+  EXPECT_FLOAT_EQ(-1.0f, position.y());
+  EXPECT_FLOAT_EQ(0.25f, position.z());
+
+  const WorldRotation start_rotation;
+  const WorldRotation end_rotation(
+      AngleAxisf(kPi / 2.0f, WorldPosition(0.0f, 1.0f, 0.0f)));
+  KeyframeTrack<WorldRotation> rotation_track;
+  rotation_track.AddKeyframe(0, start_rotation);
+  rotation_track.AddKeyframe(100, end_rotation);
+  const WorldRotation rotation = rotation_track.GetValue(50);
+  EXPECT_NEAR(kPi / 4.0f, start_rotation.AngularDifferenceRad(rotation),
+              kEpsilonFloat);
+  EXPECT_NEAR(kPi / 4.0f, rotation.AngularDifferenceRad(end_rotation),
+              kEpsilonFloat);
+}
+
+}  // namespace
+
+}  // namespace vraudio
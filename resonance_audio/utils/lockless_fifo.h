@@ -0,0 +1,159 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef RESONANCE_AUDIO_UTILS_LOCKLESS_FIFO_H_
+#define RESONANCE_AUDIO_UTILS_LOCKLESS_FIFO_H_
+
+#include <atomic>
+#include <vector>
+
+#include "base/logging.h"
+
+namespace vraudio {
+
+// Single producer - single consumer ring buffer of preallocated objects. The
+// producer and the consumer only synchronize through an atomic write and read
+// index, hence none of the methods lock, block or allocate. Unlike
+// |ThreadsafeFifo|, the consumer is not notified about new objects and is
+// expected to poll the FIFO from its own thread.
+//
+// @tparam T Object type that the FIFO handles.
+template <typename T>
+class LocklessFifo {
+ public:
+  // Constructor preallocates the maximum number of objects in the FIFO queue.
+  //
+  // @param max_objects Maximum number of objects in FIFO queue.
+  // @param init Initializer to be assigned to allocated objects.
+  LocklessFifo(size_t max_objects, const T& init);
+
+  // Returns a pointer to an available input object T. If the queue is full, a
+  // nullptr is returned. Must only be called by the producer.
+  //
+  // @return Pointer to an available input object. Nullptr if no input object is
+  //     available.
+  T* AcquireInputObject();
+
+  // Releases a previously acquired input object to be pushed onto the FIFO
+  // front. Must only be called by the producer.
+  void ReleaseInputObject(const T* object);
+
+  // Returns a pointer to an output object T. If the queue is empty, a nullptr
+  // is returned. Must only be called by the consumer.
+  //
+  // @return Pointer to the output object. Nullptr on empty queue.
+  T* AcquireOutputObject();
+
+  // Releases a previously acquired output object back to the FIFO. Must only
+  // be called by the consumer.
+  void ReleaseOutputObject(const T* object);
+
+  // Returns the number of objects in the FIFO queue.
+  size_t Size() const;
+
+  // Returns true if FIFO queue is empty, false otherwise.
+  bool Empty() const;
+
+  // Returns true if FIFO queue is full, false otherwise.
+  bool Full() const;
+
+  // Clears the FIFO queue. This call is only thread-safe if called by the
+  // consumer.
+  void Clear();
+
+ private:
+  // Vector that stores all objects.
+  std::vector<T> fifo_;
+
+  // Total number of objects pushed and popped since construction. The slot of
+  // the next input (output) object is |write_count_| (|read_count_|) modulo
+  // the FIFO size. Only the producer modifies |write_count_| and only the
+  // consumer modifies |read_count_|.
+  std::atomic<size_t> write_count_;
+  std::atomic<size_t> read_count_;
+};
+
+template <typename T>
+LocklessFifo<T>::LocklessFifo(size_t max_objects, const T& init)
+    : fifo_(max_objects), write_count_(0), read_count_(0) {
+  CHECK_GT(max_objects, 0U) << "FIFO size must be greater than zero";
+  for (auto& object : fifo_) {
+    object = init;
+  }
+}
+
+template <typename T>
+T* LocklessFifo<T>::AcquireInputObject() {
+  const size_t write_count = write_count_.load(std::memory_order_relaxed);
+  // Acquire ordering guarantees that the consumer has finished reading the
+  // slot before it is handed out for writing.
+  if (write_count - read_count_.load(std::memory_order_acquire) >=
+      fifo_.size()) {
+    return nullptr;
+  }
+  return &fifo_[write_count % fifo_.size()];
+}
+
+template <typename T>
+void LocklessFifo<T>::ReleaseInputObject(const T* object) {
+  const size_t write_count = write_count_.load(std::memory_order_relaxed);
+  DCHECK_EQ(object, &fifo_[write_count % fifo_.size()]);
+  // Release ordering publishes the object contents to the consumer.
+  write_count_.store(write_count + 1, std::memory_order_release);
+}
+
+template <typename T>
+T* LocklessFifo<T>::AcquireOutputObject() {
+  const size_t read_count = read_count_.load(std::memory_order_relaxed);
+  if (write_count_.load(std::memory_order_acquire) == read_count) {
+    return nullptr;
+  }
+  return &fifo_[read_count % fifo_.size()];
+}
+
+template <typename T>
+void LocklessFifo<T>::ReleaseOutputObject(const T* object) {
+  const size_t read_count = read_count_.load(std::memory_order_relaxed);
+  DCHECK_EQ(object, &fifo_[read_count % fifo_.size()]);
+  read_count_.store(read_count + 1, std::memory_order_release);
+}
+
+template <typename T>
+size_t LocklessFifo<T>::Size() const {
+  // Load the read index first, so that the size never underflows.
+  const size_t read_count = read_count_.load(std::memory_order_acquire);
+  return write_count_.load(std::memory_order_acquire) - read_count;
+}
+
+template <typename T>
+bool LocklessFifo<T>::Empty() const {
+  return Size() == 0;
+}
+
+template <typename T>
+bool LocklessFifo<T>::Full() const {
+  return Size() >= fifo_.size();
+}
+
+template <typename T>
+void LocklessFifo<T>::Clear() {
+  read_count_.store(write_count_.load(std::memory_order_acquire),
+                    std::memory_order_release);
+}
+
+}  // namespace vraudio
+
+#endif  // RESONANCE_AUDIO_UTILS_LOCKLESS_FIFO_H_
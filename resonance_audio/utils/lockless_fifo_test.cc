@@ -0,0 +1,125 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "utils/lockless_fifo.h"
+
+#include <thread>
+#include <vector>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace vraudio {
+
+namespace {
+
+// Maximum number of objects in the FIFO.
+const size_t kMaxObjects = 4;
+
+// Number of objects passed between the producer and the consumer thread.
+const size_t kNumTransferredObjects = 100000;
+
+// Tests that objects are popped in the order they were pushed, including after
+// the indices wrap around the end of the FIFO.
+TEST(LocklessFifoTest, PushPopInOrderTest) {
+  LocklessFifo<size_t> fifo(kMaxObjects, 0);
+  EXPECT_TRUE(fifo.Empty());
+  EXPECT_EQ(nullptr, fifo.AcquireOutputObject());
+
+  size_t next_input = 0;
+  size_t next_output = 0;
+  for (size_t round = 0; round < 3 * kMaxObjects; ++round) {
+    // Push three objects and pop two objects per round, draining the FIFO
+    // whenever it is full.
+    for (size_t i = 0; i < 3; ++i) {
+      size_t* const input = fifo.AcquireInputObject();
+      if (input == nullptr) {
+        EXPECT_TRUE(fifo.Full());
+        break;
+      }
+      *input = next_input++;
+      fifo.ReleaseInputObject(input);
+    }
+    const size_t num_pops = fifo.Full() ? kMaxObjects : 2;
+    for (size_t i = 0; i < num_pops; ++i) {
+      size_t* const output = fifo.AcquireOutputObject();
+      ASSERT_NE(nullptr, output);
+      EXPECT_EQ(next_output++, *output);
+      fifo.ReleaseOutputObject(output);
+    }
+    EXPECT_EQ(next_input - next_output, fifo.Size());
+  }
+}
+
+// Tests that no input object is available on a full FIFO until an output
+// object is released.
+TEST(LocklessFifoTest, FullFifoTest) {
+  LocklessFifo<size_t> fifo(kMaxObjects, 0);
+  for (size_t i = 0; i < kMaxObjects; ++i) {
+    size_t* const input = fifo.AcquireInputObject();
+    ASSERT_NE(nullptr, input);
+    fifo.ReleaseInputObject(input);
+  }
+  EXPECT_TRUE(fifo.Full());
+  EXPECT_EQ(nullptr, fifo.AcquireInputObject());
+
+  // Acquiring an output object without releasing it keeps the FIFO full.
+  size_t* const output = fifo.AcquireOutputObject();
+  ASSERT_NE(nullptr, output);
+  EXPECT_EQ(nullptr, fifo.AcquireInputObject());
+  fifo.ReleaseOutputObject(output);
+  EXPECT_NE(nullptr, fifo.AcquireInputObject());
+
+  fifo.Clear();
+  EXPECT_TRUE(fifo.Empty());
+  EXPECT_EQ(nullptr, fifo.AcquireOutputObject());
+}
+
+// Tests that a producer and a consumer thread exchange all objects in order.
+TEST(LocklessFifoTest, ProducerConsumerThreadsTest) {
+  LocklessFifo<size_t> fifo(kMaxObjects, 0);
+  std::vector<size_t> received;
+  received.reserve(kNumTransferredObjects);
+
+  std::thread consumer([&fifo, &received]() {
+    while (received.size() < kNumTransferredObjects) {
+      size_t* const output = fifo.AcquireOutputObject();
+      if (output == nullptr) {
+        std::this_thread::yield();
+        continue;
+      }
+      received.push_back(*output);
+      fifo.ReleaseOutputObject(output);
+    }
+  });
+  for (size_t i = 0; i < kNumTransferredObjects; ++i) {
+    size_t* input = nullptr;
+    while ((input = fifo.AcquireInputObject()) == nullptr) {
+      std::this_thread::yield();
+    }
+    *input = i;
+    fifo.ReleaseInputObject(input);
+  }
+  consumer.join();
+
+  EXPECT_TRUE(fifo.Empty());
+  for (size_t i = 0; i < kNumTransferredObjects; ++i) {
+    ASSERT_EQ(i, received[i]);
+  }
+}
+
+}  // namespace
+
+}  // namespace vraudio
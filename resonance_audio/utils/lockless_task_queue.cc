@@ -25,9 +25,13 @@ LocklessTaskQueue::LocklessTaskQueue(size_t max_tasks) {
   Init(max_tasks);
 }
 
-LocklessTaskQueue::~LocklessTaskQueue() { Clear(); }
+LocklessTaskQueue::~LocklessTaskQueue() {
+  Clear();
+  ReleaseExecutedTasks();
+}
 
 void LocklessTaskQueue::Post(Task&& task) {
+  ReleaseExecutedTasks();
   Node* const free_node = PopNodeFromList(&free_list_head_);
   if (free_node == nullptr) {
     LOG(WARNING) << "Queue capacity reached - dropping task";
@@ -60,6 +64,17 @@ void LocklessTaskQueue::PushNodeToList(std::atomic<Node*>* list_head,
       std::memory_order_relaxed));
 }
 
+void LocklessTaskQueue::ReleaseExecutedTasks() {
+  // Concurrent producers each take over a disjoint part of the executed list.
+  Node* node = executed_list_head_.exchange(nullptr);
+  while (node != nullptr) {
+    Node* const next_node = node->next;
+    node->task = nullptr;
+    PushNodeToList(&free_list_head_, node);
+    node = next_node;
+  }
+}
+
 LocklessTaskQueue::Node* LocklessTaskQueue::PopNodeFromList(
     std::atomic<Node*>* list_head) {
   DCHECK(list_head);
@@ -81,28 +96,32 @@ LocklessTaskQueue::Node* LocklessTaskQueue::PopNodeFromList(
 void LocklessTaskQueue::ProcessTaskList(Node* list_head, bool execute) {
   Node* node_itr = list_head;
   while (node_itr != nullptr) {
-    Node* next_node_ptr = node_itr->next;
-    temp_tasks_.emplace_back(std::move(node_itr->task));
-    node_itr->task = nullptr;
-    PushNodeToList(&free_list_head_, node_itr);
-    node_itr = next_node_ptr;
+    temp_nodes_.push_back(node_itr);
+    node_itr = node_itr->next;
   }
 
-  if (execute) {
-    // Execute tasks in reverse order.
-    for (std::vector<Task>::reverse_iterator task_itr = temp_tasks_.rbegin();
-         task_itr != temp_tasks_.rend(); ++task_itr) {
-      if (*task_itr != nullptr) {
-        (*task_itr)();
+  // Execute tasks in reverse order.
+  for (std::vector<Node*>::reverse_iterator node_ptr_itr = temp_nodes_.rbegin();
+       node_ptr_itr != temp_nodes_.rend(); ++node_ptr_itr) {
+    Node* const node = *node_ptr_itr;
+    if (execute) {
+      if (node->task != nullptr) {
+        node->task();
       }
+      // Hand the executed task back for destruction in |Post|, which avoids
+      // freeing its captured state on the executing thread.
+      PushNodeToList(&executed_list_head_, node);
+    } else {
+      node->task = nullptr;
+      PushNodeToList(&free_list_head_, node);
     }
   }
-  temp_tasks_.clear();
+  temp_nodes_.clear();
 }
 
 void LocklessTaskQueue::Init(size_t num_nodes) {
   nodes_.resize(num_nodes);
-  temp_tasks_.reserve(num_nodes);
+  temp_nodes_.reserve(num_nodes);
 
   // Initialize free list.
   free_list_head_ = &nodes_[0];
@@ -111,8 +130,9 @@ void LocklessTaskQueue::Init(size_t num_nodes) {
   }
   nodes_[num_nodes - 1].next = nullptr;
 
-  // Initialize task list.
+  // Initialize task list and executed list.
   task_list_head_ = nullptr;
+  executed_list_head_ = nullptr;
 }
 
 }  // namespace vraudio
@@ -39,12 +39,16 @@ class LocklessTaskQueue {
 
   ~LocklessTaskQueue();
 
-  // Posts a new task to task queue.
+  // Posts a new task to task queue. Destroys the tasks executed since the last
+  // call beforehand, such that their captured state is released on the posting
+  // thread rather than on the executor thread.
   //
   // @param task Task to process.
   void Post(Task&& task);
 
-  // Executes all tasks on the task queue.
+  // Executes all tasks on the task queue. Executed tasks are not destroyed
+  // here, as this may free memory on the executor thread, but handed back to
+  // be destroyed by the next call to |Post| or on destruction of the queue.
   void Execute();
 
   // Removes all tasks on the task queue.
@@ -71,14 +75,19 @@ class LocklessTaskQueue {
   // @param node Node to be pushed to the front of the list.
   void PushNodeToList(std::atomic<Node*>* list_head, Node* node);
 
+  // Destroys the tasks on the executed list and pushes their nodes back to the
+  // free list.
+  void ReleaseExecutedTasks();
+
   // Pops a node from the front of a list.
   //
   // @param list_head Pointer to list head.
   // @return Front node, nullptr if list is empty.
   Node* PopNodeFromList(std::atomic<Node*>* list_head);
 
-  // Iterates over list and moves all tasks to |temp_tasks_| to be executed in
-  // FIFO order. All processed nodes are pushed back to the free list.
+  // Iterates over list and collects all nodes in |temp_nodes_| to execute
+  // their tasks in FIFO order. Executed nodes are pushed to the executed list,
+  // cleared nodes are pushed back to the free list.
   //
   // @param list_head Head node of list to be processed.
   // @param execute If true, tasks on task list are executed.
@@ -95,12 +104,16 @@ class LocklessTaskQueue {
   // Pointer to head node of task list.
   std::atomic<Node*> task_list_head_;
 
+  // Pointer to head node of the list of executed tasks, which are pending to
+  // be destroyed.
+  std::atomic<Node*> executed_list_head_;
+
   // Holds preallocated nodes.
   std::vector<Node> nodes_;
 
-  // Temporary vector to hold |Task|s in order to execute them in reverse order
-  // (FIFO, instead of LIFO).
-  std::vector<Task> temp_tasks_;
+  // Temporary vector to hold the nodes of a task list in order to execute them
+  // in reverse order (FIFO, instead of LIFO).
+  std::vector<Node*> temp_nodes_;
 };
 
 }  // namespace vraudio
@@ -161,6 +161,30 @@ TEST_F(LocklessTaskQueueTest, Clear) {
   EXPECT_EQ(work_vector_[0], 0U);
 }
 
+// Tests that the captured state of executed tasks is released by the next
+// |Post| call rather than by |Execute|.
+TEST_F(LocklessTaskQueueTest, ReleasesExecutedTasksOnPost) {
+  LocklessTaskQueue task_queue(1);
+
+  auto state = std::make_shared<int>(0);
+  task_queue.Post([state]() { ++(*state); });
+  task_queue.Execute();
+  EXPECT_EQ(1, *state);
+  EXPECT_EQ(2, state.use_count());
+
+  task_queue.Post([]() {});
+  EXPECT_EQ(1, state.use_count());
+
+  // Executed tasks are released on destruction of the queue as well.
+  {
+    LocklessTaskQueue other_task_queue(1);
+    other_task_queue.Post([state]() { ++(*state); });
+    other_task_queue.Execute();
+    EXPECT_EQ(2, state.use_count());
+  }
+  EXPECT_EQ(1, state.use_count());
+}
+
 TEST_F(LocklessTaskQueueTest, SynchronousTaskExecution) {
   const size_t kNumRounds = 5;
   const size_t kNumTasksPerRound = 20;
@@ -0,0 +1,358 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include "utils/node_profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <limits>
+#include <unordered_map>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif  // defined(__GNUG__)
+
+#include "base/logging.h"
+
+namespace vraudio {
+
+namespace {
+
+// Maximum number of events recorded by the audio thread between two merges.
+const size_t kMaxNumPendingEvents = 8192;
+
+// Marks an invalid pending event index.
+const size_t kInvalidEventIndex = std::numeric_limits<size_t>::max();
+
+// Marks an unused node entry.
+const size_t kInvalidNodeId = 0;
+
+// Id assigned to the next node created.
+std::atomic<size_t> next_node_id(kInvalidNodeId + 1);
+
+// Profiler installed on the current thread.
+thread_local NodeProfiler* current_profiler = nullptr;
+
+// Returns the demangled name of |type| without namespace qualifiers.
+std::string GetTypeName(const std::type_info& type) {
+  std::string name = type.name();
+#if defined(__GNUG__)
+  int status = 0;
+  char* demangled =
+      abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+  if (status == 0 && demangled != nullptr) {
+    name = demangled;
+  }
+  std::free(demangled);
+#endif  // defined(__GNUG__)
+  // Strip "class " prefixes of MSVC and namespaces, but keep template
+  // arguments intact.
+  const size_t template_begin = std::min(name.find('<'), name.size());
+  const size_t name_begin = name.rfind(' ', template_begin);
+  if (name_begin != std::string::npos) {
+    name = name.substr(name_begin + 1);
+  }
+  const size_t scope_end = name.rfind("::", template_begin - 1);
+  if (scope_end != std::string::npos && scope_end < template_begin) {
+    name = name.substr(scope_end + 2);
+  }
+  return name;
+}
+
+}  // namespace
+
+const size_t NodeProfiler::kMaxNumNodeEntries;
+const size_t NodeProfiler::kMaxNumRetiredNodeTypes;
+
+NodeProfiler::ScopedBuffer::ScopedBuffer(NodeProfiler* profiler)
+    : profiler_(profiler), previous_profiler_(current_profiler) {
+  current_profiler = profiler_;
+  if (profiler_ == nullptr) {
+    return;
+  }
+  profiler_->buffer_event_index_ = kInvalidEventIndex;
+  if (profiler_->num_pending_events_ < profiler_->pending_events_.size()) {
+    profiler_->buffer_event_index_ = profiler_->num_pending_events_++;
+    Event* event = &profiler_->pending_events_[profiler_->buffer_event_index_];
+    event->node_id = kInvalidNodeId;
+    event->node_type = nullptr;
+    event->begin_ticks = ReadProfilerTicks();
+    event->end_ticks = event->begin_ticks;
+    event->num_inputs = 0;
+  }
+}
+
+NodeProfiler::ScopedBuffer::~ScopedBuffer() {
+  current_profiler = previous_profiler_;
+  if (profiler_ == nullptr) {
+    return;
+  }
+  if (profiler_->buffer_event_index_ != kInvalidEventIndex) {
+    profiler_->pending_events_[profiler_->buffer_event_index_].end_ticks =
+        ReadProfilerTicks();
+  }
+  profiler_->MergePendingEvents();
+}
+
+NodeProfiler::NodeProfiler(size_t max_num_trace_events)
+    : start_ticks_(ReadProfilerTicks()),
+      start_time_(std::chrono::steady_clock::now()),
+      pending_events_(kMaxNumPendingEvents),
+      num_pending_events_(0),
+      buffer_event_index_(kInvalidEventIndex),
+      node_entries_(kMaxNumNodeEntries),
+      retired_node_entries_(kMaxNumRetiredNodeTypes),
+      num_retired_node_types_(0),
+      trace_events_(max_num_trace_events),
+      trace_write_index_(0),
+      num_trace_events_(0) {
+  for (auto& entry : node_entries_) {
+    entry.node_id = kInvalidNodeId;
+  }
+}
+
+size_t NodeProfiler::GenerateNodeId() {
+  size_t node_id = next_node_id++;
+  // Skip the invalid id once the counter wraps around.
+  while (node_id == kInvalidNodeId) {
+    node_id = next_node_id++;
+  }
+  return node_id;
+}
+
+NodeProfiler* NodeProfiler::GetCurrent() { return current_profiler; }
+
+void NodeProfiler::RecordNodeCall(size_t node_id,
+                                  const std::type_info& node_type,
+                                  uint64_t begin_ticks, uint64_t end_ticks,
+                                  size_t num_inputs) {
+  if (num_pending_events_ == pending_events_.size()) {
+    return;
+  }
+  Event* event = &pending_events_[num_pending_events_++];
+  event->node_id = node_id;
+  event->node_type = &node_type;
+  event->begin_ticks = begin_ticks;
+  event->end_ticks = end_ticks;
+  event->num_inputs = num_inputs;
+}
+
+std::vector<NodeProfiler::NodeStats> NodeProfiler::GetStats(
+    bool aggregate_by_type) {
+  std::vector<NodeStats> stats;
+  // Node type of each entry in |stats|.
+  std::vector<const std::type_info*> stats_types;
+  std::unordered_map<const std::type_info*, size_t> type_indices;
+  const double ms_per_tick = 1.0 / GetTicksPerMs();
+  const auto accumulate = [&](const NodeEntry& entry) {
+    if (aggregate_by_type) {
+      const auto type_index = type_indices.find(entry.node_type);
+      if (type_index != type_indices.end()) {
+        NodeStats* node_stats = &stats[type_index->second];
+        node_stats->num_nodes += entry.num_nodes;
+        node_stats->num_calls += entry.num_calls;
+        node_stats->num_inputs += entry.num_inputs;
+        node_stats->total_time_ms +=
+            static_cast<double>(entry.total_ticks) * ms_per_tick;
+        node_stats->max_time_ms =
+            std::max(node_stats->max_time_ms,
+                     static_cast<double>(entry.max_ticks) * ms_per_tick);
+        return;
+      }
+      type_indices[entry.node_type] = stats.size();
+    }
+    NodeStats node_stats;
+    node_stats.node_id = aggregate_by_type ? 0 : entry.node_id;
+    node_stats.num_nodes = entry.num_nodes;
+    node_stats.num_calls = entry.num_calls;
+    node_stats.num_inputs = entry.num_inputs;
+    node_stats.total_time_ms =
+        static_cast<double>(entry.total_ticks) * ms_per_tick;
+    node_stats.max_time_ms = static_cast<double>(entry.max_ticks) * ms_per_tick;
+    stats.push_back(node_stats);
+    stats_types.push_back(entry.node_type);
+  };
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& entry : node_entries_) {
+      if (entry.node_id != kInvalidNodeId) {
+        accumulate(entry);
+      }
+    }
+    for (size_t i = 0; i < num_retired_node_types_; ++i) {
+      accumulate(retired_node_entries_[i]);
+    }
+  }
+  // Resolve the type names outside of the lock, since demangling allocates.
+  std::unordered_map<const std::type_info*, std::string> type_names;
+  for (size_t i = 0; i < stats.size(); ++i) {
+    auto type_name = type_names.find(stats_types[i]);
+    if (type_name == type_names.end()) {
+      type_name = type_names
+                      .insert(std::make_pair(stats_types[i],
+                                             GetTypeName(*stats_types[i])))
+                      .first;
+    }
+    stats[i].node_type = type_name->second;
+  }
+  std::sort(stats.begin(), stats.end(),
+            [](const NodeStats& lhs, const NodeStats& rhs) {
+              if (lhs.total_time_ms != rhs.total_time_ms) {
+                return lhs.total_time_ms > rhs.total_time_ms;
+              }
+              return lhs.node_id < rhs.node_id;
+            });
+  return stats;
+}
+
+void NodeProfiler::Reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto& entry : node_entries_) {
+    entry.node_id = kInvalidNodeId;
+  }
+  num_retired_node_types_ = 0;
+  trace_write_index_ = 0;
+  num_trace_events_ = 0;
+}
+
+void NodeProfiler::WriteChromeTrace(std::ostream* stream) {
+  DCHECK(stream);
+  const double us_per_tick = 1e3 / GetTicksPerMs();
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::unordered_map<const std::type_info*, std::string> type_names;
+  const std::ios::fmtflags flags = stream->flags();
+  const std::streamsize precision = stream->precision();
+  *stream << std::fixed << std::setprecision(3);
+  *stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  const size_t first_index =
+      (trace_write_index_ + trace_events_.size() - num_trace_events_) %
+      std::max<size_t>(trace_events_.size(), 1);
+  for (size_t i = 0; i < num_trace_events_; ++i) {
+    const Event& event =
+        trace_events_[(first_index + i) % trace_events_.size()];
+    const double begin_us =
+        static_cast<double>(event.begin_ticks - start_ticks_) * us_per_tick;
+    const double duration_us =
+        static_cast<double>(event.end_ticks - event.begin_ticks) * us_per_tick;
+    *stream << (i == 0 ? "\n" : ",\n");
+    if (event.node_type == nullptr) {
+      *stream << "{\"name\":\"ProcessNextBuffer\",\"cat\":\"buffer\"";
+    } else {
+      auto type_name = type_names.find(event.node_type);
+      if (type_name == type_names.end()) {
+        type_name = type_names
+                        .insert(std::make_pair(event.node_type,
+                                               GetTypeName(*event.node_type)))
+                        .first;
+      }
+      *stream << "{\"name\":\"" << type_name->second
+              << "\",\"cat\":\"node\",\"args\":{\"node_id\":"
+              << event.node_id << ",\"num_inputs\":" << event.num_inputs
+              << "}";
+    }
+    *stream << ",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":" << begin_us
+            << ",\"dur\":" << duration_us << "}";
+  }
+  *stream << "\n]}\n";
+  stream->flags(flags);
+  stream->precision(precision);
+}
+
+void NodeProfiler::MergePendingEvents() {
+  std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+  if (!lock.owns_lock()) {
+    // Keep the pending events until the next buffer rather than blocking the
+    // audio thread.
+    return;
+  }
+  for (size_t i = 0; i < num_pending_events_; ++i) {
+    const Event& event = pending_events_[i];
+    if (event.node_type != nullptr) {
+      NodeEntry* entry = &node_entries_[event.node_id % node_entries_.size()];
+      if (entry->node_id != event.node_id) {
+        if (entry->node_id != kInvalidNodeId) {
+          // The slot is taken by a node created |kMaxNumNodeEntries| nodes
+          // earlier.
+          RetireNodeEntry(*entry);
+        }
+        entry->node_id = event.node_id;
+        entry->node_type = event.node_type;
+        entry->num_nodes = 1;
+        entry->num_calls = 0;
+        entry->num_inputs = 0;
+        entry->total_ticks = 0;
+        entry->max_ticks = 0;
+      }
+      const uint64_t ticks = event.end_ticks - event.begin_ticks;
+      ++entry->num_calls;
+      entry->num_inputs += event.num_inputs;
+      entry->total_ticks += ticks;
+      entry->max_ticks = std::max(entry->max_ticks, ticks);
+    }
+    if (!trace_events_.empty()) {
+      trace_events_[trace_write_index_] = event;
+      trace_write_index_ = (trace_write_index_ + 1) % trace_events_.size();
+      num_trace_events_ = std::min(num_trace_events_ + 1, trace_events_.size());
+    }
+  }
+  num_pending_events_ = 0;
+}
+
+void NodeProfiler::RetireNodeEntry(const NodeEntry& entry) {
+  NodeEntry* const retired_entries_end =
+      retired_node_entries_.data() + num_retired_node_types_;
+  NodeEntry* retired_entry = std::find_if(
+      retired_node_entries_.data(), retired_entries_end,
+      [&entry](const NodeEntry& retired) {
+        return retired.node_type == entry.node_type;
+      });
+  if (retired_entry == retired_entries_end) {
+    if (num_retired_node_types_ == retired_node_entries_.size()) {
+      return;
+    }
+    ++num_retired_node_types_;
+    *retired_entry = entry;
+    retired_entry->node_id = kInvalidNodeId;
+    return;
+  }
+  retired_entry->num_nodes += entry.num_nodes;
+  retired_entry->num_calls += entry.num_calls;
+  retired_entry->num_inputs += entry.num_inputs;
+  retired_entry->total_ticks += entry.total_ticks;
+  retired_entry->max_ticks =
+      std::max(retired_entry->max_ticks, entry.max_ticks);
+}
+
+double NodeProfiler::GetTicksPerMs() const {
+#if defined(RESONANCE_AUDIO_HAS_TSC)
+  const uint64_t ticks = ReadProfilerTicks() - start_ticks_;
+  const double elapsed_ms =
+      std::chrono::duration<double, std::milli>(
+          std::chrono::steady_clock::now() - start_time_)
+          .count();
+  if (ticks == 0 || elapsed_ms <= 0.0) {
+    return 1.0;
+  }
+  return static_cast<double>(ticks) / elapsed_ms;
+#else
+  return 1e6;
+#endif  // defined(RESONANCE_AUDIO_HAS_TSC)
+}
+
+}  // namespace vraudio
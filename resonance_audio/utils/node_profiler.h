@@ -0,0 +1,223 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#ifndef RESONANCE_AUDIO_UTILS_NODE_PROFILER_H_
+#define RESONANCE_AUDIO_UTILS_NODE_PROFILER_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || \
+    defined(_M_X64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define RESONANCE_AUDIO_HAS_TSC
+#endif
+
+namespace vraudio {
+
+// Returns the current value of a low-overhead monotonic tick counter. This is
+// the time stamp counter on x86 and a steady clock in nanoseconds elsewhere.
+inline uint64_t ReadProfilerTicks() {
+#if defined(RESONANCE_AUDIO_HAS_TSC)
+  return static_cast<uint64_t>(__rdtsc());
+#else
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+#endif
+}
+
+// Collects the processing time of audio graph nodes. The audio thread records
+// node calls into a preallocated buffer without locking, and merges them into
+// the preallocated statistics and trace events at the end of each audio buffer
+// only if no other thread currently reads them. Queries may be issued from any
+// thread.
+//
+// Nodes are identified by the id they are assigned at construction via
+// |GenerateNodeId|. The per-node stats hold up to |kMaxNumNodeEntries| nodes
+// in a table indexed by node id, hence the entry of a node is retired when a
+// node created |kMaxNumNodeEntries| nodes later is processed. Retired entries
+// are accumulated per node type.
+class NodeProfiler {
+ public:
+  // Processing time statistics of a node or node type.
+  struct NodeStats {
+    // Demangled node type name without namespace, e.g. "ReverbNode".
+    std::string node_type;
+
+    // Id of the node, or zero if the stats are aggregated per node type or
+    // over retired nodes.
+    size_t node_id;
+
+    // Number of nodes that contributed to the stats.
+    size_t num_nodes;
+
+    // Number of |AudioProcess| calls.
+    uint64_t num_calls;
+
+    // Accumulated number of input buffers over all calls.
+    uint64_t num_inputs;
+
+    // Accumulated processing time over all calls in milliseconds.
+    double total_time_ms;
+
+    // Processing time of the slowest call in milliseconds.
+    double max_time_ms;
+  };
+
+  // Installs a profiler as the current profiler of the calling thread for the
+  // lifetime of the object, and marks the processing of one audio buffer.
+  class ScopedBuffer {
+   public:
+    // @param profiler Profiler to record into, may be nullptr.
+    explicit ScopedBuffer(NodeProfiler* profiler);
+    ~ScopedBuffer();
+
+   private:
+    NodeProfiler* const profiler_;
+    NodeProfiler* const previous_profiler_;
+  };
+
+  // Constructor.
+  //
+  // @param max_num_trace_events Maximum number of most recent node calls that
+  //     are kept for the Chrome trace export.
+  explicit NodeProfiler(size_t max_num_trace_events);
+
+  // Maximum number of nodes with individual stats.
+  static const size_t kMaxNumNodeEntries = 4096;
+
+  // Maximum number of node types with stats of retired nodes. Retired nodes of
+  // further types are not accounted for.
+  static const size_t kMaxNumRetiredNodeTypes = 128;
+
+  // Returns a new process-wide unique node id, which is never zero. This
+  // method is thread-safe.
+  //
+  // @return Node id.
+  static size_t GenerateNodeId();
+
+  // Returns the profiler installed on the calling thread.
+  //
+  // @return Current profiler, nullptr if none is installed.
+  static NodeProfiler* GetCurrent();
+
+  // Records a single node call. Must only be called on the audio thread
+  // between the construction and destruction of a |ScopedBuffer|.
+  //
+  // @param node_id Id of the processed node.
+  // @param node_type Dynamic type of the processed node.
+  // @param begin_ticks Tick count at the start of the call.
+  // @param end_ticks Tick count at the end of the call.
+  // @param num_inputs Number of input buffers passed to the node.
+  void RecordNodeCall(size_t node_id, const std::type_info& node_type,
+                      uint64_t begin_ticks, uint64_t end_ticks,
+                      size_t num_inputs);
+
+  // Returns the stats accumulated since construction or the last |Reset| call,
+  // sorted by descending total processing time.
+  //
+  // @param aggregate_by_type True to return one entry per node type, false to
+  //     return one entry per node.
+  // @return Node stats.
+  std::vector<NodeStats> GetStats(bool aggregate_by_type);
+
+  // Clears all stats and trace events.
+  void Reset();
+
+  // Writes the recorded trace events in the Chrome trace event JSON format,
+  // which can be loaded into chrome://tracing or Perfetto.
+  //
+  // @param stream Output stream.
+  void WriteChromeTrace(std::ostream* stream);
+
+ private:
+  // Single node call or audio buffer (if |node_type| is nullptr).
+  struct Event {
+    size_t node_id;
+    const std::type_info* node_type;
+    uint64_t begin_ticks;
+    uint64_t end_ticks;
+    size_t num_inputs;
+  };
+
+  // Accumulated stats of a single node, or of all retired nodes of a type.
+  struct NodeEntry {
+    // Id of the node, zero for unused or retired entries.
+    size_t node_id;
+    const std::type_info* node_type;
+    size_t num_nodes;
+    uint64_t num_calls;
+    uint64_t num_inputs;
+    uint64_t total_ticks;
+    uint64_t max_ticks;
+  };
+
+  // Merges |pending_events_| into the shared state if it is not locked by
+  // another thread. Called on the audio thread at the end of each buffer.
+  void MergePendingEvents();
+
+  // Accumulates |entry| into the stats of retired nodes of the same type.
+  void RetireNodeEntry(const NodeEntry& entry);
+
+  // Returns the number of ticks per millisecond.
+  double GetTicksPerMs() const;
+
+  // Tick count and time at construction, used to calibrate the tick rate.
+  const uint64_t start_ticks_;
+  const std::chrono::steady_clock::time_point start_time_;
+
+  // Events recorded by the audio thread since the last merge. Events are
+  // dropped if more calls are recorded than fit into the preallocated buffer.
+  std::vector<Event> pending_events_;
+  size_t num_pending_events_;
+
+  // Index of the pending event marking the current audio buffer.
+  size_t buffer_event_index_;
+
+  // Guards the members below.
+  std::mutex mutex_;
+
+  // Accumulated stats of the most recently processed nodes. The entry of a
+  // node is located at its node id modulo |kMaxNumNodeEntries|.
+  std::vector<NodeEntry> node_entries_;
+
+  // Accumulated stats of retired nodes, one entry per node type. Only the
+  // first |num_retired_node_types_| entries are used.
+  std::vector<NodeEntry> retired_node_entries_;
+  size_t num_retired_node_types_;
+
+  // Ring buffer of the most recent events.
+  std::vector<Event> trace_events_;
+  size_t trace_write_index_;
+  size_t num_trace_events_;
+};
+
+}  // namespace vraudio
+
+#endif  // RESONANCE_AUDIO_UTILS_NODE_PROFILER_H_
@@ -0,0 +1,182 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include "utils/node_profiler.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace vraudio {
+
+namespace {
+
+// Node types used to tag recorded calls.
+class FastNode {};
+class SlowNode {};
+
+// Records a call of the node with |node_id| that took |num_ticks| ticks.
+void RecordCall(NodeProfiler* profiler, size_t node_id,
+                const std::type_info& node_type, uint64_t num_ticks,
+                size_t num_inputs) {
+  const uint64_t begin_ticks = ReadProfilerTicks();
+  profiler->RecordNodeCall(node_id, node_type, begin_ticks,
+                           begin_ticks + num_ticks, num_inputs);
+}
+
+// Tests that the profiler is only installed on the current thread while a
+// buffer is processed.
+TEST(NodeProfilerTest, InstallsCurrentProfilerPerBuffer) {
+  NodeProfiler profiler(16);
+  EXPECT_EQ(nullptr, NodeProfiler::GetCurrent());
+  {
+    NodeProfiler::ScopedBuffer buffer(&profiler);
+    EXPECT_EQ(&profiler, NodeProfiler::GetCurrent());
+  }
+  EXPECT_EQ(nullptr, NodeProfiler::GetCurrent());
+}
+
+// Tests that calls are accumulated per node and per node type, and sorted by
+// descending total time.
+TEST(NodeProfilerTest, AccumulatesStatsPerNodeAndType) {
+  NodeProfiler profiler(16);
+  const size_t fast_node_id = NodeProfiler::GenerateNodeId();
+  const size_t slow_node_ids[2] = {NodeProfiler::GenerateNodeId(),
+                                   NodeProfiler::GenerateNodeId()};
+  for (int buffer = 0; buffer < 2; ++buffer) {
+    NodeProfiler::ScopedBuffer scoped_buffer(&profiler);
+    RecordCall(&profiler, fast_node_id, typeid(FastNode), 10, 1);
+    RecordCall(&profiler, slow_node_ids[0], typeid(SlowNode), 1000, 2);
+    RecordCall(&profiler, slow_node_ids[1], typeid(SlowNode), 3000, 3);
+  }
+
+  const std::vector<NodeProfiler::NodeStats> node_stats =
+      profiler.GetStats(false /* aggregate_by_type */);
+  ASSERT_EQ(3U, node_stats.size());
+  EXPECT_EQ("SlowNode", node_stats[0].node_type);
+  EXPECT_EQ("SlowNode", node_stats[1].node_type);
+  EXPECT_EQ("FastNode", node_stats[2].node_type);
+  EXPECT_EQ(slow_node_ids[1], node_stats[0].node_id);
+  EXPECT_EQ(slow_node_ids[0], node_stats[1].node_id);
+  EXPECT_EQ(fast_node_id, node_stats[2].node_id);
+  EXPECT_EQ(2U, node_stats[0].num_calls);
+  EXPECT_EQ(6U, node_stats[0].num_inputs);
+  EXPECT_EQ(1U, node_stats[0].num_nodes);
+  EXPECT_NEAR(3.0 * node_stats[1].total_time_ms, node_stats[0].total_time_ms,
+              1e-9);
+  EXPECT_NEAR(0.5 * node_stats[0].total_time_ms, node_stats[0].max_time_ms,
+              1e-9);
+
+  const std::vector<NodeProfiler::NodeStats> type_stats =
+      profiler.GetStats(true /* aggregate_by_type */);
+  ASSERT_EQ(2U, type_stats.size());
+  EXPECT_EQ("SlowNode", type_stats[0].node_type);
+  EXPECT_EQ(0U, type_stats[0].node_id);
+  EXPECT_EQ(2U, type_stats[0].num_nodes);
+  EXPECT_EQ(4U, type_stats[0].num_calls);
+  EXPECT_EQ(10U, type_stats[0].num_inputs);
+  // The tick rate is recalibrated on each query, so only compare times
+  // within the same query.
+  EXPECT_NEAR(8000.0 / 3000.0,
+              type_stats[0].total_time_ms / type_stats[0].max_time_ms, 1e-9);
+  EXPECT_EQ("FastNode", type_stats[1].node_type);
+  EXPECT_EQ(2U, type_stats[1].num_calls);
+
+  profiler.Reset();
+  EXPECT_TRUE(profiler.GetStats(true /* aggregate_by_type */).empty());
+}
+
+// Tests that the entry of a node is retired into the stats of its node type
+// once a node created |kMaxNumNodeEntries| nodes later is processed, so that
+// the per-node stats never grow beyond the preallocated table.
+TEST(NodeProfilerTest, RetiresEntriesOfOldNodes) {
+  NodeProfiler profiler(16);
+  const size_t old_node_id = NodeProfiler::GenerateNodeId();
+  const size_t new_node_id = old_node_id + NodeProfiler::kMaxNumNodeEntries;
+  const size_t newest_node_id = new_node_id + NodeProfiler::kMaxNumNodeEntries;
+  {
+    NodeProfiler::ScopedBuffer scoped_buffer(&profiler);
+    RecordCall(&profiler, old_node_id, typeid(SlowNode), 1000, 1);
+    RecordCall(&profiler, new_node_id, typeid(SlowNode), 3000, 1);
+    RecordCall(&profiler, newest_node_id, typeid(FastNode), 10, 1);
+  }
+
+  const std::vector<NodeProfiler::NodeStats> node_stats =
+      profiler.GetStats(false /* aggregate_by_type */);
+  ASSERT_EQ(2U, node_stats.size());
+  // Both slow nodes have been retired into a single entry.
+  EXPECT_EQ("SlowNode", node_stats[0].node_type);
+  EXPECT_EQ(0U, node_stats[0].node_id);
+  EXPECT_EQ(2U, node_stats[0].num_nodes);
+  EXPECT_EQ(2U, node_stats[0].num_calls);
+  EXPECT_EQ("FastNode", node_stats[1].node_type);
+  EXPECT_EQ(newest_node_id, node_stats[1].node_id);
+  EXPECT_EQ(1U, node_stats[1].num_nodes);
+
+  const std::vector<NodeProfiler::NodeStats> type_stats =
+      profiler.GetStats(true /* aggregate_by_type */);
+  ASSERT_EQ(2U, type_stats.size());
+  EXPECT_EQ(2U, type_stats[0].num_nodes);
+  EXPECT_EQ(1U, type_stats[1].num_nodes);
+
+  profiler.Reset();
+  EXPECT_TRUE(profiler.GetStats(false /* aggregate_by_type */).empty());
+}
+
+// Tests that node ids are unique and never zero.
+TEST(NodeProfilerTest, GeneratesUniqueNodeIds) {
+  const size_t first_node_id = NodeProfiler::GenerateNodeId();
+  const size_t second_node_id = NodeProfiler::GenerateNodeId();
+  EXPECT_NE(0U, first_node_id);
+  EXPECT_NE(0U, second_node_id);
+  EXPECT_NE(first_node_id, second_node_id);
+}
+
+// Tests that the trace contains the most recent buffer and node events only.
+TEST(NodeProfilerTest, WritesMostRecentEventsAsChromeTrace) {
+  NodeProfiler profiler(2);
+  const size_t fast_node_id = NodeProfiler::GenerateNodeId();
+  const size_t slow_node_id = NodeProfiler::GenerateNodeId();
+  {
+    NodeProfiler::ScopedBuffer scoped_buffer(&profiler);
+    RecordCall(&profiler, fast_node_id, typeid(FastNode), 10, 1);
+  }
+  {
+    NodeProfiler::ScopedBuffer scoped_buffer(&profiler);
+    RecordCall(&profiler, slow_node_id, typeid(SlowNode), 1000, 4);
+  }
+
+  std::ostringstream trace;
+  profiler.WriteChromeTrace(&trace);
+  const std::string trace_json = trace.str();
+  EXPECT_EQ(0U, trace_json.find("{\"displayTimeUnit\":\"ms\""));
+  EXPECT_NE(std::string::npos, trace_json.find("\"traceEvents\":["));
+  EXPECT_NE(std::string::npos,
+            trace_json.find("\"name\":\"ProcessNextBuffer\""));
+  EXPECT_NE(std::string::npos, trace_json.find("\"name\":\"SlowNode\""));
+  EXPECT_NE(std::string::npos, trace_json.find("\"num_inputs\":4"));
+  EXPECT_NE(std::string::npos,
+            trace_json.find("\"node_id\":" + std::to_string(slow_node_id)));
+  EXPECT_EQ(std::string::npos, trace_json.find("FastNode"));
+  EXPECT_NE(std::string::npos, trace_json.find("\"ph\":\"X\""));
+}
+
+}  // namespace
+
+}  // namespace vraudio
@@ -16,92 +16,207 @@ limitations under the License.
 
 #include "utils/ogg_vorbis_recorder.h"
 
+#include <cstdio>
+#include <thread>
+
 #include "base/logging.h"
 #include "utils/planar_interleaved_conversion.h"
 
 namespace vraudio {
 
+namespace {
+
+// Number of times per input buffer duration that the encoder thread polls for
+// new input.
+const size_t kNumPollsPerBuffer = 4;
+
+}  // namespace
+
 OggVorbisRecorder::OggVorbisRecorder(int sample_rate_hz, size_t num_channels,
                                      size_t num_frames, size_t max_num_buffers)
     : sample_rate_hz_(sample_rate_hz),
       num_channels_(num_channels),
       num_frames_(num_frames),
-      max_num_buffers_(max_num_buffers),
+      polling_period_(static_cast<std::chrono::microseconds::rep>(
+          1e6 * static_cast<double>(num_frames) /
+          static_cast<double>(sample_rate_hz * kNumPollsPerBuffer))),
+      seamless_(false),
+      is_recording_(false),
+      is_adding_input_(false),
+      is_encoding_(false),
+      num_dropped_buffers_(0),
+      input_fifo_(max_num_buffers, AudioBuffer(num_channels, num_frames)),
+      num_received_buffers_(0),
+      encoder_ok_(true),
+      head_buffer_(num_channels, num_frames),
+      tail_buffer_(num_channels, num_frames),
       temp_data_channel_ptrs_(num_channels),
       crossfader_(num_frames_),
       crossfade_buffer_(num_channels_, num_frames_) {
   DCHECK_GT(sample_rate_hz_, 0);
   DCHECK_NE(num_channels_, 0U);
   DCHECK_NE(num_frames_, 0U);
-  CHECK_NE(max_num_buffers_, 0U);
+  CHECK_NE(max_num_buffers, 0U);
 }
 
-void OggVorbisRecorder::AddInput(std::unique_ptr<AudioBuffer> input_buffer) {
-  DCHECK(input_buffer);
-  DCHECK_EQ(input_buffer->num_channels(), num_channels_);
-  DCHECK_EQ(input_buffer->num_frames(), num_frames_);
+OggVorbisRecorder::~OggVorbisRecorder() { Reset(); }
 
-  if (data_.size() == max_num_buffers_) {
-    LOG(WARNING) << "Maximum input buffer limit reached, overwriting data";
-    data_.erase(data_.begin());
-  }
-  data_.push_back(std::move(input_buffer));
-}
-
-void OggVorbisRecorder::Reset() { data_.clear(); }
-
-bool OggVorbisRecorder::WriteToFile(const std::string& file_path, float quality,
-                                    bool seamless) {
-  if (data_.empty()) {
-    LOG(WARNING) << "No recorded data";
+bool OggVorbisRecorder::Start(const std::string& file_path, float quality,
+                              bool seamless) {
+  if (encoder_thread_.joinable()) {
+    LOG(WARNING) << "Recording already in progress";
     return false;
   }
-
-  if (seamless) {
-    MakeSeamless();
-  }
-
   if (!encoder_.InitializeForFile(
           file_path, num_channels_, sample_rate_hz_,
           VorbisStreamEncoder::EncodingMode::kVariableBitRate, 0 /* bitrate */,
           quality)) {
     LOG(WARNING) << "Cannot initialize file to record: " << file_path;
-    Reset();
     return false;
   }
-  for (const auto& audio_buffer : data_) {
-    GetRawChannelDataPointersFromAudioBuffer(*audio_buffer,
-                                             &temp_data_channel_ptrs_);
-    if (!encoder_.AddPlanarBuffer(temp_data_channel_ptrs_.data(), num_channels_,
-                                  num_frames_)) {
-      LOG(WARNING) << "Failed to write buffer into file: " << file_path;
-      Reset();
-      return false;
+  file_path_ = file_path;
+  seamless_ = seamless;
+  num_received_buffers_ = 0;
+  encoder_ok_ = true;
+  num_dropped_buffers_ = 0;
+
+  // The previous recording has drained the FIFO.
+  DCHECK(input_fifo_.Empty());
+  is_encoding_ = true;
+  is_recording_ = true;
+  encoder_thread_ = std::thread(&OggVorbisRecorder::EncoderThreadLoop, this);
+  return true;
+}
+
+void OggVorbisRecorder::AddInput(const AudioBuffer* input_buffer) {
+  // Announce the access to the FIFO before checking whether the recording is in
+  // progress. Both flags are sequentially consistent, hence either the
+  // recording is observed to be stopped here, or |StopEncoderThread| waits for
+  // this call to complete.
+  is_adding_input_ = true;
+  if (!is_recording_.load()) {
+    is_adding_input_ = false;
+    return;
+  }
+  AudioBuffer* const record_buffer = input_fifo_.AcquireInputObject();
+  if (record_buffer == nullptr) {
+    // The encoder thread is lagging behind, drop the input buffer.
+    num_dropped_buffers_.fetch_add(1, std::memory_order_relaxed);
+    is_adding_input_ = false;
+    return;
+  }
+  if (input_buffer != nullptr) {
+    DCHECK_GE(input_buffer->num_channels(), num_channels_);
+    DCHECK_EQ(input_buffer->num_frames(), num_frames_);
+    for (size_t channel = 0; channel < num_channels_; ++channel) {
+      (*record_buffer)[channel] = (*input_buffer)[channel];
     }
+  } else {
+    record_buffer->Clear();
   }
-  if (!encoder_.FlushAndClose()) {
-    LOG(WARNING) << "Failed to safely close file: " << file_path;
-    Reset();
+  input_fifo_.ReleaseInputObject(record_buffer);
+  is_adding_input_ = false;
+}
+
+bool OggVorbisRecorder::Stop() {
+  if (!encoder_thread_.joinable()) {
+    LOG(WARNING) << "No recording in progress";
     return false;
   }
+  StopEncoderThread();
+  const size_t num_dropped_buffers = num_dropped_buffers_.load();
+  if (num_dropped_buffers > 0) {
+    LOG(WARNING) << "Dropped " << num_dropped_buffers
+                 << " input buffers, as the encoder fell behind";
+  }
 
-  Reset();
+  if (seamless_ && num_received_buffers_ > 1) {
+    // Replace the first buffer of the loop with the crossfade from the last
+    // into the first buffer. The crossfaded buffer is placed at the end of the
+    // record, which yields the same loop rotated by one buffer.
+    crossfader_.ApplyLinearCrossfade(head_buffer_, tail_buffer_,
+                                     &crossfade_buffer_);
+    encoder_ok_ = encoder_ok_ && EncodeBuffer(crossfade_buffer_);
+  } else if (seamless_ && num_received_buffers_ == 1) {
+    LOG(WARNING) << "Not enough data to make seamless file";
+    encoder_ok_ = encoder_ok_ && EncodeBuffer(head_buffer_);
+  }
+  const bool closed = encoder_.FlushAndClose();
+
+  if (num_received_buffers_ == 0) {
+    LOG(WARNING) << "No recorded data";
+    std::remove(file_path_.c_str());
+    return false;
+  }
+  if (!encoder_ok_) {
+    LOG(WARNING) << "Failed to write buffer into file: " << file_path_;
+    return false;
+  }
+  if (!closed) {
+    LOG(WARNING) << "Failed to safely close file: " << file_path_;
+    return false;
+  }
   return true;
 }
 
-void OggVorbisRecorder::MakeSeamless() {
-  if (data_.size() == 1) {
-    LOG(WARNING) << "Not enough data to make seamless file";
+void OggVorbisRecorder::Reset() {
+  if (!encoder_thread_.joinable()) {
     return;
   }
-  // Apply crossfade between the beginning and the end buffers of |data_|.
-  auto* front_buffer = data_.front().get();
-  const auto& back_buffer = *data_.back();
-  crossfader_.ApplyLinearCrossfade(*front_buffer, back_buffer,
-                                   &crossfade_buffer_);
-
-  *front_buffer = crossfade_buffer_;
-  data_.pop_back();
+  StopEncoderThread();
+  encoder_.FlushAndClose();
+  std::remove(file_path_.c_str());
+}
+
+void OggVorbisRecorder::EncoderThreadLoop() {
+  while (true) {
+    AudioBuffer* const input_buffer = input_fifo_.AcquireOutputObject();
+    if (input_buffer == nullptr) {
+      if (!is_encoding_.load()) {
+        // No further input can be added. Drain any input that was added right
+        // before the recording stopped.
+        if (input_fifo_.Empty()) {
+          break;
+        }
+        continue;
+      }
+      std::this_thread::sleep_for(polling_period_);
+      continue;
+    }
+    ++num_received_buffers_;
+    if (!encoder_ok_) {
+      // Keep draining the FIFO after a write error.
+    } else if (!seamless_) {
+      encoder_ok_ = EncodeBuffer(*input_buffer);
+    } else if (num_received_buffers_ == 1) {
+      head_buffer_ = *input_buffer;
+    } else {
+      // Hold back the most recent buffer, as it may be the last one to be
+      // crossfaded with |head_buffer_|.
+      if (num_received_buffers_ > 2) {
+        encoder_ok_ = EncodeBuffer(tail_buffer_);
+      }
+      tail_buffer_ = *input_buffer;
+    }
+    input_fifo_.ReleaseOutputObject(input_buffer);
+  }
+}
+
+bool OggVorbisRecorder::EncodeBuffer(const AudioBuffer& audio_buffer) {
+  GetRawChannelDataPointersFromAudioBuffer(audio_buffer,
+                                           &temp_data_channel_ptrs_);
+  return encoder_.AddPlanarBuffer(temp_data_channel_ptrs_.data(),
+                                  num_channels_, num_frames_);
+}
+
+void OggVorbisRecorder::StopEncoderThread() {
+  is_recording_ = false;
+  // Wait for an |AddInput| call that observed the recording in progress.
+  while (is_adding_input_.load()) {
+    std::this_thread::yield();
+  }
+  is_encoding_ = false;
+  encoder_thread_.join();
 }
 
 }  // namespace vraudio
@@ -17,34 +17,41 @@ limitations under the License.
 #ifndef RESONANCE_AUDIO_UTILS_OGG_VORBIS_RECORDER_H_
 #define RESONANCE_AUDIO_UTILS_OGG_VORBIS_RECORDER_H_
 
-#include <memory>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include "base/audio_buffer.h"
 #include "utils/buffer_crossfader.h"
+#include "utils/lockless_fifo.h"
 #include "utils/vorbis_stream_encoder.h"
 
 namespace vraudio {
 
 // Class that takes audio buffers as input and writes them into a compressed OGG
-// Vorbis file.
-
+// Vorbis file. Input buffers are copied into a preallocated lockless FIFO on
+// the calling (audio) thread and encoded incrementally to disk on a background
+// thread, which polls the FIFO. Hence the memory usage is independent of the
+// record length and the audio thread never locks or waits for the encoder.
 class OggVorbisRecorder {
  public:
   // Constructs a new recorder with given sampling rate and number of channels.
-
+  //
+  // @param sample_rate_hz Record sampling rate.
+  // @param num_channels Record number of channels.
+  // @param num_frames Number of frames per input buffer.
+  // @param max_num_buffers Maximum number of input buffers that can be pending
+  //     for encoding before further input is dropped.
   OggVorbisRecorder(int sample_rate_hz, size_t num_channels, size_t num_frames,
                     size_t max_num_buffers);
 
-  // Adds next input buffer at the end of the record data.
-  //
-  // @param input_buffer Next audio buffer to be recorded.
-  void AddInput(std::unique_ptr<AudioBuffer> input_buffer);
+  // Discards any recording in progress.
+  ~OggVorbisRecorder();
 
-  // Flushes the record data.
-  void Reset();
-
-  // Writes the current record data into a file and resets the recorder.
+  // Starts recording into a file. Any existing file at |file_path| is
+  // overwritten.
   //
   // @param file_path Full path of the file to be recorded into.
   // @param quality Compression quality of the record. The usable range is from
@@ -52,12 +59,44 @@ class OggVorbisRecorder {
   //     file).
   // @param seamless True to record seamlessly for looping. Note that this
   //     option will truncate the record length by |num_frames_| samples.
-  // @return False if fails to successfully write data into |file_path|.
-  bool WriteToFile(const std::string& file_path, float quality, bool seamless);
+  // @return False if a recording is already in progress or |file_path| cannot
+  //     be opened.
+  bool Start(const std::string& file_path, float quality, bool seamless);
+
+  // Adds next input buffer at the end of the record data. This method does not
+  // allocate, lock or block and may be called from the audio thread. Input is
+  // ignored when no recording is in progress, and dropped when the encoder
+  // thread falls behind by more than |max_num_buffers| buffers. Dropped buffers
+  // are reported once the recording is stopped. Must only be called from a
+  // single thread at a time.
+  //
+  // @param input_buffer Next audio buffer to be recorded, whose first
+  //     |num_channels_| channels are recorded. Silence is recorded if nullptr.
+  void AddInput(const AudioBuffer* input_buffer);
+
+  // Stops recording, encodes the pending input buffers and closes the file.
+  //
+  // @return False if no data was recorded or the file could not be written.
+  bool Stop();
+
+  // Stops recording and deletes the file.
+  void Reset();
 
  private:
-  // Helper method to make record data seamless.
-  void MakeSeamless();
+  // Encodes the input buffers popped from |input_fifo_| until the recording is
+  // stopped and the FIFO is drained. Sleeps for |polling_period_| whenever the
+  // FIFO is empty. Runs on |encoder_thread_|.
+  void EncoderThreadLoop();
+
+  // Encodes a single buffer into the output file.
+  //
+  // @param audio_buffer Audio buffer to be encoded.
+  // @return False if the buffer could not be written.
+  bool EncodeBuffer(const AudioBuffer& audio_buffer);
+
+  // Ends the recording, waits for a concurrent |AddInput| call to complete and
+  // joins |encoder_thread_| once it has drained |input_fifo_|.
+  void StopEncoderThread();
 
   // Record sampling rate.
   const int sample_rate_hz_;
@@ -68,11 +107,54 @@ class OggVorbisRecorder {
   // Record number of frames per buffer.
   const size_t num_frames_;
 
-  // Maximum number of input buffers allowed to record.
-  const size_t max_num_buffers_;
+  // Period at which |encoder_thread_| polls |input_fifo_| for new input.
+  const std::chrono::microseconds polling_period_;
 
-  // Record data that is stored as a list of planar audio buffers.
-  std::vector<std::unique_ptr<AudioBuffer>> data_;
+  // Path of the file that is currently recorded into.
+  std::string file_path_;
+
+  // True to record seamlessly for looping.
+  bool seamless_;
+
+  // Flag indicating whether a recording is in progress, i.e., whether
+  // |AddInput| accepts new input.
+  std::atomic<bool> is_recording_;
+
+  // Flag indicating whether |AddInput| may be pushing into |input_fifo_|. It is
+  // set before |is_recording_| is checked, such that the recording is only
+  // considered stopped once this flag has been observed to be false.
+  std::atomic<bool> is_adding_input_;
+
+  // Flag indicating whether |encoder_thread_| should keep polling for input.
+  // It is cleared once no producer can access |input_fifo_| anymore, such that
+  // the FIFO is always drained by |encoder_thread_|.
+  std::atomic<bool> is_encoding_;
+
+  // Number of input buffers dropped as |input_fifo_| was full.
+  std::atomic<size_t> num_dropped_buffers_;
+
+  // Input buffers that are pending for encoding.
+  LocklessFifo<AudioBuffer> input_fifo_;
+
+  // Background thread that encodes the input buffers.
+  std::thread encoder_thread_;
+
+  // The following members are only accessed by |encoder_thread_| while a
+  // recording is in progress.
+
+  // Number of input buffers received by |encoder_thread_|.
+  size_t num_received_buffers_;
+
+  // False if the encoder failed to write into the file.
+  bool encoder_ok_;
+
+  // First input buffer of a seamless record, which is crossfaded with the last
+  // input buffer once the recording is stopped.
+  AudioBuffer head_buffer_;
+
+  // Most recent input buffer of a seamless record, which is held back until the
+  // next input buffer arrives.
+  AudioBuffer tail_buffer_;
 
   // Temporary vector to extract pointers to planar channels in an
   // |AudioBuffer|.
@@ -82,7 +164,6 @@ class OggVorbisRecorder {
   BufferCrossfader crossfader_;
 
   // Temporary buffer to store the crossfaded output.
-
   AudioBuffer crossfade_buffer_;
 
   // OGG Vorbis encoder to write record data into file in compressed format.
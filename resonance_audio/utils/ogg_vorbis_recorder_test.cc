@@ -0,0 +1,269 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "utils/ogg_vorbis_recorder.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+#include "base/audio_buffer.h"
+#include "base/constants_and_types.h"
+#include "vorbis/vorbisfile.h"
+
+namespace vraudio {
+
+namespace {
+
+// Record sampling rate.
+const int kSampleRate = 48000;
+
+// Number of recorded channels.
+const size_t kNumChannels = kNumFirstOrderAmbisonicChannels;
+
+// Number of frames per input buffer.
+const size_t kNumFrames = 512;
+
+// Number of input buffers per test record.
+const size_t kNumBuffers = 128;
+
+// Record compression quality.
+const float kQuality = 1.0f;
+
+// Frequency of the test sine, which has an integer number of periods per input
+// buffer such that all input buffers are in phase.
+const float kSineFrequency =
+    8.0f * static_cast<float>(kSampleRate) / static_cast<float>(kNumFrames);
+
+// Amplitude of the first, the intermediate and the last input buffers.
+const float kHeadAmplitude = 0.8f;
+const float kBodyAmplitude = 0.5f;
+const float kTailAmplitude = 0.2f;
+
+// Allowed deviation of the decoded RMS from the expected value due to the
+// lossy compression.
+const float kRmsTolerance = 0.03f;
+
+// Maximum time to wait for the encoder thread to write into the file.
+const std::chrono::seconds kMaxWaitTime(10);
+
+// Returns the path of a temporary test file.
+std::string GetTestFilePath(const std::string& name) {
+  return ::testing::TempDir() + "/" + name + ".ogg";
+}
+
+// Returns the size of the file at |file_path| in bytes, or zero if the file
+// does not exist.
+size_t GetFileSize(const std::string& file_path) {
+  std::ifstream file(file_path, std::ios::binary | std::ios::ate);
+  if (!file.good()) {
+    return 0;
+  }
+  return static_cast<size_t>(file.tellg());
+}
+
+// Fills all channels of |buffer| with the test sine of given |amplitude|.
+void FillSineBuffer(float amplitude, AudioBuffer* buffer) {
+  for (size_t channel = 0; channel < buffer->num_channels(); ++channel) {
+    for (size_t frame = 0; frame < buffer->num_frames(); ++frame) {
+      (*buffer)[channel][frame] =
+          amplitude * std::sin(kTwoPi * kSineFrequency *
+                               static_cast<float>(frame) /
+                               static_cast<float>(kSampleRate));
+    }
+  }
+}
+
+// Records |kNumBuffers| buffers of the test sine, whose first and last buffers
+// have the amplitudes |kHeadAmplitude| and |kTailAmplitude|.
+void AddTestInput(OggVorbisRecorder* recorder) {
+  AudioBuffer input(kNumChannels, kNumFrames);
+  for (size_t i = 0; i < kNumBuffers; ++i) {
+    float amplitude = kBodyAmplitude;
+    if (i == 0) {
+      amplitude = kHeadAmplitude;
+    } else if (i == kNumBuffers - 1) {
+      amplitude = kTailAmplitude;
+    }
+    FillSineBuffer(amplitude, &input);
+    recorder->AddInput(&input);
+  }
+}
+
+// Decodes the first channel of the file at |file_path|.
+std::vector<float> DecodeFirstChannel(const std::string& file_path) {
+  std::vector<float> output;
+  OggVorbis_File vorbis_file;
+  if (ov_fopen(file_path.c_str(), &vorbis_file) != 0) {
+    return output;
+  }
+  float** pcm = nullptr;
+  int bitstream = 0;
+  long num_read_frames = 0;
+  while ((num_read_frames = ov_read_float(&vorbis_file, &pcm, 1024,
+                                          &bitstream)) > 0) {
+    output.insert(output.end(), pcm[0], pcm[0] + num_read_frames);
+  }
+  ov_clear(&vorbis_file);
+  return output;
+}
+
+// Returns the RMS of |length| samples of |input| starting at |offset|.
+float ComputeRms(const std::vector<float>& input, size_t offset,
+                 size_t length) {
+  float sum_of_squares = 0.0f;
+  for (size_t i = offset; i < offset + length; ++i) {
+    sum_of_squares += input[i] * input[i];
+  }
+  return std::sqrt(sum_of_squares / static_cast<float>(length));
+}
+
+// Tests that the recorded data is encoded into the file while recording.
+TEST(OggVorbisRecorderTest, WritesIncrementallyTest) {
+  const std::string file_path = GetTestFilePath("incremental");
+  OggVorbisRecorder recorder(kSampleRate, kNumChannels, kNumFrames,
+                             kNumBuffers);
+  ASSERT_TRUE(recorder.Start(file_path, kQuality, false /* seamless */));
+  const size_t header_size = GetFileSize(file_path);
+  AddTestInput(&recorder);
+
+  const auto deadline = std::chrono::steady_clock::now() + kMaxWaitTime;
+  while (GetFileSize(file_path) <= header_size &&
+         std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_GT(GetFileSize(file_path), header_size);
+
+  EXPECT_TRUE(recorder.Stop());
+  std::remove(file_path.c_str());
+}
+
+// Tests that stopping the recording encodes all pending input buffers.
+TEST(OggVorbisRecorderTest, StopFlushesPendingInputTest) {
+  const std::string file_path = GetTestFilePath("flush");
+  OggVorbisRecorder recorder(kSampleRate, kNumChannels, kNumFrames,
+                             kNumBuffers);
+  ASSERT_TRUE(recorder.Start(file_path, kQuality, false /* seamless */));
+  AddTestInput(&recorder);
+  // Stop immediately, such that most input buffers are still pending.
+  ASSERT_TRUE(recorder.Stop());
+
+  const std::vector<float> output = DecodeFirstChannel(file_path);
+  ASSERT_EQ(kNumBuffers * kNumFrames, output.size());
+  const float kSqrtHalf = std::sqrt(0.5f);
+  EXPECT_NEAR(kHeadAmplitude * kSqrtHalf, ComputeRms(output, 0, kNumFrames),
+              kRmsTolerance);
+  EXPECT_NEAR(kBodyAmplitude * kSqrtHalf,
+              ComputeRms(output, kNumFrames, kNumFrames), kRmsTolerance);
+  EXPECT_NEAR(kTailAmplitude * kSqrtHalf,
+              ComputeRms(output, output.size() - kNumFrames, kNumFrames),
+              kRmsTolerance);
+
+  // The recorder can be restarted once stopped.
+  ASSERT_TRUE(recorder.Start(file_path, kQuality, false /* seamless */));
+  recorder.AddInput(nullptr);
+  EXPECT_TRUE(recorder.Stop());
+  EXPECT_EQ(kNumFrames, DecodeFirstChannel(file_path).size());
+  std::remove(file_path.c_str());
+}
+
+// Tests that a seamless record replaces the first buffer with the crossfade
+// from the last into the first buffer, which is appended at the end.
+TEST(OggVorbisRecorderTest, SeamlessTailCrossfadeTest) {
+  const std::string file_path = GetTestFilePath("seamless");
+  OggVorbisRecorder recorder(kSampleRate, kNumChannels, kNumFrames,
+                             kNumBuffers);
+  ASSERT_TRUE(recorder.Start(file_path, kQuality, true /* seamless */));
+  AddTestInput(&recorder);
+  ASSERT_TRUE(recorder.Stop());
+
+  // The seamless record is truncated by one buffer.
+  const std::vector<float> output = DecodeFirstChannel(file_path);
+  ASSERT_EQ((kNumBuffers - 1) * kNumFrames, output.size());
+  const float kSqrtHalf = std::sqrt(0.5f);
+  EXPECT_NEAR(kBodyAmplitude * kSqrtHalf, ComputeRms(output, 0, kNumFrames),
+              kRmsTolerance);
+
+  // The amplitude of the last buffer ramps linearly from the tail into the
+  // head amplitude, as all input buffers are in phase.
+  const size_t kNumSegments = 4;
+  const size_t segment_length = kNumFrames / kNumSegments;
+  const size_t crossfade_offset = output.size() - kNumFrames;
+  for (size_t segment = 0; segment < kNumSegments; ++segment) {
+    const float fade_in = (static_cast<float>(segment) + 0.5f) /
+                          static_cast<float>(kNumSegments);
+    const float expected_amplitude =
+        fade_in * kHeadAmplitude + (1.0f - fade_in) * kTailAmplitude;
+    EXPECT_NEAR(expected_amplitude * kSqrtHalf,
+                ComputeRms(output, crossfade_offset + segment * segment_length,
+                           segment_length),
+                kRmsTolerance);
+  }
+  std::remove(file_path.c_str());
+}
+
+// Tests that input added concurrently from another thread while the recording
+// stops is either recorded or ignored, and does not leak into the next record.
+TEST(OggVorbisRecorderTest, ConcurrentStopTest) {
+  const std::string file_path = GetTestFilePath("concurrent");
+  OggVorbisRecorder recorder(kSampleRate, kNumChannels, kNumFrames,
+                             kNumBuffers);
+  ASSERT_TRUE(recorder.Start(file_path, kQuality, false /* seamless */));
+  std::atomic<bool> is_running(true);
+  std::thread producer([&recorder, &is_running]() {
+    AudioBuffer input(kNumChannels, kNumFrames);
+    FillSineBuffer(kBodyAmplitude, &input);
+    while (is_running.load()) {
+      recorder.AddInput(&input);
+      std::this_thread::yield();
+    }
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  recorder.Stop();
+  is_running = false;
+  producer.join();
+
+  ASSERT_TRUE(recorder.Start(file_path, kQuality, false /* seamless */));
+  recorder.AddInput(nullptr);
+  EXPECT_TRUE(recorder.Stop());
+  EXPECT_EQ(kNumFrames, DecodeFirstChannel(file_path).size());
+  std::remove(file_path.c_str());
+}
+
+// Tests that resetting the recorder deletes the file.
+TEST(OggVorbisRecorderTest, ResetDiscardsFileTest) {
+  const std::string file_path = GetTestFilePath("discard");
+  OggVorbisRecorder recorder(kSampleRate, kNumChannels, kNumFrames,
+                             kNumBuffers);
+  ASSERT_TRUE(recorder.Start(file_path, kQuality, false /* seamless */));
+  AddTestInput(&recorder);
+  recorder.Reset();
+  EXPECT_EQ(0U, GetFileSize(file_path));
+
+  // Input is ignored when no recording is in progress.
+  AddTestInput(&recorder);
+  EXPECT_EQ(0U, GetFileSize(file_path));
+}
+
+}  // namespace
+
+}  // namespace vraudio
@@ -0,0 +1,165 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "utils/partitioned_buffer_queue.h"
+
+#include <algorithm>
+#include <functional>
+
+#include "base/logging.h"
+
+namespace vraudio {
+
+namespace {
+
+// Initial number of buffer slots. One slot is always held by the partitioner,
+// so this allows for one queued buffer without growing.
+const size_t kInitialNumBufferSlots = 2;
+
+}  // namespace
+
+PartitionedBufferQueue::PartitionedBufferQueue(size_t num_channels,
+                                               size_t frames_per_buffer)
+    : num_channels_(num_channels),
+      frames_per_buffer_(frames_per_buffer),
+      read_index_(0),
+      num_queued_buffers_(0),
+      silence_buffer_(num_channels, frames_per_buffer),
+      partitioner_(num_channels, frames_per_buffer,
+                   std::bind(&PartitionedBufferQueue::PartitionerCallback,
+                             this, std::placeholders::_1)) {
+  DCHECK_GT(num_channels_, 0U);
+  DCHECK_GT(frames_per_buffer_, 0U);
+  silence_buffer_.Clear();
+  buffers_.reserve(kInitialNumBufferSlots);
+  for (size_t i = 0; i < kInitialNumBufferSlots; ++i) {
+    buffers_.emplace_back(new AudioBuffer(num_channels_, frames_per_buffer_));
+  }
+}
+
+void PartitionedBufferQueue::AddBuffer(const float* buffer,
+                                       size_t num_channels,
+                                       size_t num_frames) {
+  AddBufferTemplated<const float*>(buffer, num_channels, num_frames);
+}
+
+void PartitionedBufferQueue::AddBuffer(const int16* buffer,
+                                       size_t num_channels,
+                                       size_t num_frames) {
+  AddBufferTemplated<const int16*>(buffer, num_channels, num_frames);
+}
+
+void PartitionedBufferQueue::AddBuffer(const float* const* buffer,
+                                       size_t num_channels,
+                                       size_t num_frames) {
+  AddBufferTemplated<const float* const*>(buffer, num_channels, num_frames);
+}
+
+void PartitionedBufferQueue::AddBuffer(const int16* const* buffer,
+                                       size_t num_channels,
+                                       size_t num_frames) {
+  AddBufferTemplated<const int16* const*>(buffer, num_channels, num_frames);
+}
+
+void PartitionedBufferQueue::Reserve(size_t num_frames) {
+  DCHECK_EQ(num_queued_buffers_, 0U);
+  ReserveForNumFrames(num_frames);
+}
+
+void PartitionedBufferQueue::AddSilence(size_t num_frames) {
+  ReserveForNumFrames(num_frames);
+  while (num_frames > 0) {
+    const size_t num_frames_to_add = std::min(num_frames, frames_per_buffer_);
+    partitioner_.AddBuffer(num_frames_to_add, silence_buffer_);
+    num_frames -= num_frames_to_add;
+  }
+}
+
+size_t PartitionedBufferQueue::GetNumPartialFrames() const {
+  return partitioner_.GetNumBufferedFrames();
+}
+
+const AudioBuffer* PartitionedBufferQueue::Front() const {
+  if (num_queued_buffers_ == 0) {
+    return nullptr;
+  }
+  return buffers_[read_index_].get();
+}
+
+void PartitionedBufferQueue::PopFront() {
+  if (num_queued_buffers_ == 0) {
+    return;
+  }
+  read_index_ = (read_index_ + 1) % buffers_.size();
+  --num_queued_buffers_;
+}
+
+void PartitionedBufferQueue::Clear() {
+  partitioner_.Clear();
+  read_index_ = 0;
+  num_queued_buffers_ = 0;
+}
+
+AudioBuffer* PartitionedBufferQueue::PartitionerCallback(
+    AudioBuffer* filled_buffer) {
+  if (filled_buffer != nullptr) {
+    DCHECK_EQ(filled_buffer, buffers_[GetWriteIndex()].get());
+    ++num_queued_buffers_;
+  }
+  // |ReserveForNumFrames| guarantees a free slot behind the queued buffers.
+  DCHECK_LT(num_queued_buffers_, buffers_.size());
+  return buffers_[GetWriteIndex()].get();
+}
+
+void PartitionedBufferQueue::ReserveForNumFrames(size_t num_frames) {
+  // One slot is held by |partitioner_| in addition to the queued buffers.
+  const size_t num_required_slots =
+      num_queued_buffers_ +
+      partitioner_.GetNumGeneratedBuffersForNumInputFrames(num_frames) + 1;
+  if (num_required_slots <= buffers_.size()) {
+    return;
+  }
+  const size_t num_new_slots = num_required_slots - buffers_.size();
+  const size_t write_index = GetWriteIndex();
+  // Insert the new slots right after the write slot. If the queued buffers
+  // wrap around the end of the ring, the read position moves accordingly.
+  std::vector<std::unique_ptr<AudioBuffer>> new_slots;
+  new_slots.reserve(num_new_slots);
+  for (size_t i = 0; i < num_new_slots; ++i) {
+    new_slots.emplace_back(new AudioBuffer(num_channels_, frames_per_buffer_));
+  }
+  buffers_.insert(buffers_.begin() + write_index + 1,
+                  std::make_move_iterator(new_slots.begin()),
+                  std::make_move_iterator(new_slots.end()));
+  if (read_index_ > write_index) {
+    read_index_ += num_new_slots;
+  }
+}
+
+template <typename BufferType>
+void PartitionedBufferQueue::AddBufferTemplated(BufferType buffer,
+                                                size_t num_channels,
+                                                size_t num_frames) {
+  DCHECK_EQ(num_channels, num_channels_);
+  ReserveForNumFrames(num_frames);
+  partitioner_.AddBuffer(buffer, num_channels, num_frames);
+}
+
+size_t PartitionedBufferQueue::GetWriteIndex() const {
+  return (read_index_ + num_queued_buffers_) % buffers_.size();
+}
+
+}  // namespace vraudio
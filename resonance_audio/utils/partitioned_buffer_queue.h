@@ -0,0 +1,134 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef RESONANCE_AUDIO_UTILS_PARTITIONED_BUFFER_QUEUE_H_
+#define RESONANCE_AUDIO_UTILS_PARTITIONED_BUFFER_QUEUE_H_
+
+#include <memory>
+#include <vector>
+
+#include "base/integral_types.h"
+#include "base/audio_buffer.h"
+#include "utils/buffer_partitioner.h"
+
+namespace vraudio {
+
+// Re-blocks input buffers of arbitrary sizes into a FIFO queue of fixed size
+// |AudioBuffer|s by means of a |BufferPartitioner|. The queue storage can be
+// preallocated with |Reserve| and otherwise grows on demand when more buffers
+// are generated than can be held, which only happens when the input buffer
+// size increases. This class is *not* thread-safe.
+class PartitionedBufferQueue {
+ public:
+  // Constructor.
+  //
+  // @param num_channels Number of audio channels in input and output buffers.
+  // @param frames_per_buffer Number of frames in queued |AudioBuffer|s.
+  PartitionedBufferQueue(size_t num_channels, size_t frames_per_buffer);
+
+  // Adds an interleaved or planar, float or int16 input buffer.
+  //
+  // @param buffer Input buffer.
+  // @param num_channels Number of channels in input buffer.
+  // @param num_frames Number of frames in input buffer.
+  void AddBuffer(const float* buffer, size_t num_channels, size_t num_frames);
+  void AddBuffer(const int16* buffer, size_t num_channels, size_t num_frames);
+  void AddBuffer(const float* const* buffer, size_t num_channels,
+                 size_t num_frames);
+  void AddBuffer(const int16* const* buffer, size_t num_channels,
+                 size_t num_frames);
+
+  // Preallocates the queue storage such that adding up to |num_frames| frames
+  // to an empty queue does not allocate.
+  //
+  // @param num_frames Number of frames to reserve storage for.
+  void Reserve(size_t num_frames);
+
+  // Adds |num_frames| frames of silence.
+  //
+  // @param num_frames Number of silent frames to be added.
+  void AddSilence(size_t num_frames);
+
+  // Returns the number of complete |AudioBuffer|s in the queue.
+  size_t GetNumQueuedBuffers() const { return num_queued_buffers_; }
+
+  // Returns the number of frames in the incomplete buffer currently being
+  // filled.
+  size_t GetNumPartialFrames() const;
+
+  // Returns the oldest complete |AudioBuffer| in the queue.
+  //
+  // @return Oldest queued buffer, nullptr if the queue is empty.
+  const AudioBuffer* Front() const;
+
+  // Removes the oldest complete |AudioBuffer| from the queue.
+  void PopFront();
+
+  // Discards all queued buffers and partial frames.
+  void Clear();
+
+  // Returns the number of channels.
+  size_t num_channels() const { return num_channels_; }
+
+ private:
+  // Callback of |partitioner_| which queues the filled |AudioBuffer| and
+  // returns the next buffer slot to be filled.
+  //
+  // @param filled_buffer Pointer to completed buffer, nullptr on first call.
+  // @return Pointer to next buffer to be filled.
+  AudioBuffer* PartitionerCallback(AudioBuffer* filled_buffer);
+
+  // Ensures that adding |num_frames| frames does not overrun the queue
+  // storage. New slots are inserted right behind the slot that is currently
+  // being filled so that buffer pointers held by |partitioner_| stay valid.
+  //
+  // @param num_frames Number of frames about to be added.
+  void ReserveForNumFrames(size_t num_frames);
+
+  // Templated implementation of |AddBuffer|.
+  template <typename BufferType>
+  void AddBufferTemplated(BufferType buffer, size_t num_channels,
+                          size_t num_frames);
+
+  // Index of the slot following the newest queued buffer.
+  size_t GetWriteIndex() const;
+
+  // Number of channels.
+  const size_t num_channels_;
+
+  // Number of frames per queued buffer.
+  const size_t frames_per_buffer_;
+
+  // Ring of buffer slots. Slots are heap allocated individually so that
+  // growing the ring does not invalidate the slot held by |partitioner_|.
+  std::vector<std::unique_ptr<AudioBuffer>> buffers_;
+
+  // Index of the oldest queued buffer in |buffers_|.
+  size_t read_index_;
+
+  // Number of complete buffers in the queue.
+  size_t num_queued_buffers_;
+
+  // Silent buffer used to feed |AddSilence|.
+  AudioBuffer silence_buffer_;
+
+  // Partitions input buffers into the slots of |buffers_|.
+  BufferPartitioner partitioner_;
+};
+
+}  // namespace vraudio
+
+#endif  // RESONANCE_AUDIO_UTILS_PARTITIONED_BUFFER_QUEUE_H_
@@ -0,0 +1,128 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "utils/partitioned_buffer_queue.h"
+
+#include <numeric>
+#include <vector>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+#include "base/constants_and_types.h"
+
+namespace vraudio {
+
+namespace {
+
+// Number of frames per queued buffer.
+const size_t kFramesPerBuffer = 64;
+
+// Generates an interleaved stereo ramp of |num_frames| frames starting at
+// |start_value|.
+std::vector<float> GenerateRamp(size_t num_frames, float start_value) {
+  std::vector<float> ramp(num_frames * kNumStereoChannels);
+  std::iota(ramp.begin(), ramp.end(), start_value);
+  return ramp;
+}
+
+// Tests that input buffers of arbitrary size are re-blocked into a continuous
+// sequence of fixed size buffers.
+TEST(PartitionedBufferQueueTest, ReblocksArbitraryBufferSizes) {
+  const size_t kInputSizes[] = {17, 64, 3, 250, 1, 45, 128};
+  PartitionedBufferQueue queue(kNumStereoChannels, kFramesPerBuffer);
+
+  float next_input_value = 0.0f;
+  float next_output_value = 0.0f;
+  size_t num_total_input_frames = 0;
+  size_t num_total_output_frames = 0;
+  for (size_t input_size : kInputSizes) {
+    const std::vector<float> input = GenerateRamp(input_size, next_input_value);
+    next_input_value += static_cast<float>(input.size());
+    queue.AddBuffer(input.data(), kNumStereoChannels, input_size);
+    num_total_input_frames += input_size;
+
+    while (queue.GetNumQueuedBuffers() > 0) {
+      const AudioBuffer* output = queue.Front();
+      ASSERT_NE(nullptr, output);
+      ASSERT_EQ(kFramesPerBuffer, output->num_frames());
+      for (size_t frame = 0; frame < kFramesPerBuffer; ++frame) {
+        for (size_t channel = 0; channel < kNumStereoChannels; ++channel) {
+          EXPECT_EQ(next_output_value, (*output)[channel][frame]);
+          next_output_value += 1.0f;
+        }
+      }
+      queue.PopFront();
+      num_total_output_frames += kFramesPerBuffer;
+    }
+    EXPECT_EQ(num_total_input_frames - num_total_output_frames,
+              queue.GetNumPartialFrames());
+  }
+  EXPECT_EQ(nullptr, queue.Front());
+}
+
+// Tests that the queue keeps its order when it needs to grow while buffers are
+// queued.
+TEST(PartitionedBufferQueueTest, GrowsWithoutReordering) {
+  PartitionedBufferQueue queue(kNumStereoChannels, kFramesPerBuffer);
+  const size_t kNumFirstFrames = kFramesPerBuffer + kFramesPerBuffer / 2;
+  const size_t kNumSecondFrames = 7 * kFramesPerBuffer;
+
+  const std::vector<float> first = GenerateRamp(kNumFirstFrames, 0.0f);
+  queue.AddBuffer(first.data(), kNumStereoChannels, kNumFirstFrames);
+  EXPECT_EQ(1U, queue.GetNumQueuedBuffers());
+  // Advance the read position so that the second input wraps around.
+  queue.PopFront();
+  const std::vector<float> second = GenerateRamp(
+      kNumSecondFrames, static_cast<float>(first.size()));
+  queue.AddBuffer(second.data(), kNumStereoChannels, kNumSecondFrames);
+  EXPECT_EQ(7U, queue.GetNumQueuedBuffers());
+
+  float next_output_value =
+      static_cast<float>(kFramesPerBuffer * kNumStereoChannels);
+  while (queue.GetNumQueuedBuffers() > 0) {
+    const AudioBuffer& output = *queue.Front();
+    for (size_t frame = 0; frame < kFramesPerBuffer; ++frame) {
+      EXPECT_EQ(next_output_value, output[0][frame]);
+      next_output_value += static_cast<float>(kNumStereoChannels);
+    }
+    queue.PopFront();
+  }
+}
+
+// Tests that silence is prepended and |Clear| discards all frames.
+TEST(PartitionedBufferQueueTest, AddSilenceAndClear) {
+  PartitionedBufferQueue queue(kNumMonoChannels, kFramesPerBuffer);
+  const size_t kNumSilentFrames = kFramesPerBuffer / 4;
+  queue.AddSilence(kNumSilentFrames);
+  EXPECT_EQ(0U, queue.GetNumQueuedBuffers());
+  EXPECT_EQ(kNumSilentFrames, queue.GetNumPartialFrames());
+
+  const std::vector<float> ones(kFramesPerBuffer, 1.0f);
+  queue.AddBuffer(ones.data(), kNumMonoChannels, kFramesPerBuffer);
+  ASSERT_EQ(1U, queue.GetNumQueuedBuffers());
+  const AudioBuffer& output = *queue.Front();
+  for (size_t frame = 0; frame < kFramesPerBuffer; ++frame) {
+    EXPECT_EQ(frame < kNumSilentFrames ? 0.0f : 1.0f, output[0][frame]);
+  }
+
+  queue.Clear();
+  EXPECT_EQ(0U, queue.GetNumQueuedBuffers());
+  EXPECT_EQ(0U, queue.GetNumPartialFrames());
+  EXPECT_EQ(nullptr, queue.Front());
+}
+
+}  // namespace
+
+}  // namespace vraudio
@@ -0,0 +1,309 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include "utils/realtime_safety_checker.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <sstream>
+
+#if defined(__GLIBC__)
+#include <execinfo.h>
+#include <pthread.h>
+#endif  // defined(__GLIBC__)
+
+#if defined(__GNUC__)
+// Avoids lazy allocation of thread-local storage, which would recursively
+// call the interposed allocator.
+#define INITIAL_EXEC_TLS __attribute__((tls_model("initial-exec")))
+#else
+#define INITIAL_EXEC_TLS
+#endif  // defined(__GNUC__)
+
+namespace vraudio {
+
+namespace {
+
+// Nesting depth of real-time sections on the current thread.
+thread_local int realtime_section_depth INITIAL_EXEC_TLS = 0;
+
+// Set while a violation is reported on the current thread to ignore the
+// operations of the checker itself.
+thread_local bool is_reporting_violation INITIAL_EXEC_TLS = false;
+
+std::atomic<bool> should_abort_on_violation(false);
+std::atomic<bool> is_stack_capture_initialized(false);
+std::atomic<size_t> num_violations(0);
+RealtimeSafetyChecker::Violation
+    violations[RealtimeSafetyChecker::kMaxNumViolations];
+
+// Returns the name of a violation type.
+const char* GetViolationTypeName(RealtimeSafetyChecker::ViolationType type) {
+  switch (type) {
+    case RealtimeSafetyChecker::kAllocation:
+      return "allocation";
+    case RealtimeSafetyChecker::kDeallocation:
+      return "deallocation";
+    case RealtimeSafetyChecker::kLock:
+      return "mutex lock";
+  }
+  return "unknown";
+}
+
+// Captures the call stack of the current thread.
+size_t CaptureStack(void** stack, size_t max_num_frames) {
+#if defined(__GLIBC__)
+  return static_cast<size_t>(
+      backtrace(stack, static_cast<int>(max_num_frames)));
+#else
+  return 0;
+#endif  // defined(__GLIBC__)
+}
+
+}  // namespace
+
+RealtimeSafetyChecker::ScopedRealtimeSection::ScopedRealtimeSection() {
+  if (!is_stack_capture_initialized.load(std::memory_order_acquire)) {
+    // The first stack capture may allocate while loading the unwinder.
+    void* stack[1];
+    CaptureStack(stack, 1);
+    is_stack_capture_initialized.store(true, std::memory_order_release);
+  }
+  ++realtime_section_depth;
+}
+
+RealtimeSafetyChecker::ScopedRealtimeSection::~ScopedRealtimeSection() {
+  --realtime_section_depth;
+}
+
+bool RealtimeSafetyChecker::IsEnabled() {
+#if defined(ENABLE_REALTIME_SAFETY_CHECKS)
+  return true;
+#else
+  return false;
+#endif  // defined(ENABLE_REALTIME_SAFETY_CHECKS)
+}
+
+bool RealtimeSafetyChecker::IsInRealtimeSection() {
+  return realtime_section_depth > 0;
+}
+
+void RealtimeSafetyChecker::SetAbortOnViolation(bool abort_on_violation) {
+  should_abort_on_violation.store(abort_on_violation);
+}
+
+void RealtimeSafetyChecker::ReportViolation(ViolationType type, size_t size) {
+  if (realtime_section_depth == 0 || is_reporting_violation) {
+    return;
+  }
+  is_reporting_violation = true;
+  const size_t index = num_violations.fetch_add(1);
+  Violation violation;
+  violation.type = type;
+  violation.size = size;
+  violation.num_stack_frames =
+      CaptureStack(violation.stack, kMaxNumStackFrames);
+  if (index < kMaxNumViolations) {
+    violations[index] = violation;
+  }
+  if (should_abort_on_violation.load()) {
+    std::cerr << "Real-time safety violation: " << DescribeViolation(violation)
+              << std::endl;
+    std::abort();
+  }
+  is_reporting_violation = false;
+}
+
+size_t RealtimeSafetyChecker::GetNumViolations() {
+  return num_violations.load();
+}
+
+std::vector<RealtimeSafetyChecker::Violation>
+RealtimeSafetyChecker::GetViolations() {
+  const size_t num_recorded_violations =
+      std::min(num_violations.load(), kMaxNumViolations);
+  return std::vector<Violation>(violations,
+                                violations + num_recorded_violations);
+}
+
+std::string RealtimeSafetyChecker::DescribeViolation(
+    const Violation& violation) {
+  std::ostringstream description;
+  description << GetViolationTypeName(violation.type);
+  if (violation.type == kAllocation) {
+    description << " of " << violation.size << " bytes";
+  }
+#if defined(__GLIBC__)
+  char** symbols = backtrace_symbols(
+      violation.stack, static_cast<int>(violation.num_stack_frames));
+  if (symbols != nullptr) {
+    for (size_t i = 0; i < violation.num_stack_frames; ++i) {
+      description << "\n  #" << i << " " << symbols[i];
+    }
+    free(symbols);
+  }
+#endif  // defined(__GLIBC__)
+  return description.str();
+}
+
+void RealtimeSafetyChecker::Reset() { num_violations.store(0); }
+
+}  // namespace vraudio
+
+#if defined(ENABLE_REALTIME_SAFETY_CHECKS)
+#if defined(__GLIBC__)
+
+#include <dlfcn.h>
+
+namespace {
+
+typedef int (*PthreadMutexLockFunction)(pthread_mutex_t*);
+
+// Returns the next definition of |pthread_mutex_lock| after the interposed
+// one.
+PthreadMutexLockFunction GetNextPthreadMutexLock() {
+  static std::atomic<PthreadMutexLockFunction> next_pthread_mutex_lock(
+      nullptr);
+  PthreadMutexLockFunction function =
+      next_pthread_mutex_lock.load(std::memory_order_acquire);
+  if (function == nullptr) {
+    function = reinterpret_cast<PthreadMutexLockFunction>(
+        dlsym(RTLD_NEXT, "pthread_mutex_lock"));
+    next_pthread_mutex_lock.store(function, std::memory_order_release);
+  }
+  return function;
+}
+
+}  // namespace
+
+// With glibc, the allocator and |pthread_mutex_lock| are interposed directly,
+// which also covers allocations from C code and the C++ runtime.
+extern "C" {
+
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t num_elements, size_t element_size);
+void* __libc_realloc(void* ptr, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+void __libc_free(void* ptr);
+
+void* malloc(size_t size) __THROW {
+  vraudio::RealtimeSafetyChecker::ReportViolation(
+      vraudio::RealtimeSafetyChecker::kAllocation, size);
+  return __libc_malloc(size);
+}
+
+void* calloc(size_t num_elements, size_t element_size) __THROW {
+  vraudio::RealtimeSafetyChecker::ReportViolation(
+      vraudio::RealtimeSafetyChecker::kAllocation,
+      num_elements * element_size);
+  return __libc_calloc(num_elements, element_size);
+}
+
+void* realloc(void* ptr, size_t size) __THROW {
+  vraudio::RealtimeSafetyChecker::ReportViolation(
+      vraudio::RealtimeSafetyChecker::kAllocation, size);
+  return __libc_realloc(ptr, size);
+}
+
+void* memalign(size_t alignment, size_t size) __THROW {
+  vraudio::RealtimeSafetyChecker::ReportViolation(
+      vraudio::RealtimeSafetyChecker::kAllocation, size);
+  return __libc_memalign(alignment, size);
+}
+
+void* aligned_alloc(size_t alignment, size_t size) __THROW {
+  vraudio::RealtimeSafetyChecker::ReportViolation(
+      vraudio::RealtimeSafetyChecker::kAllocation, size);
+  return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** ptr, size_t alignment, size_t size) __THROW {
+  if (alignment == 0 || (alignment & (alignment - 1)) != 0 ||
+      alignment % sizeof(void*) != 0) {
+    return EINVAL;
+  }
+  vraudio::RealtimeSafetyChecker::ReportViolation(
+      vraudio::RealtimeSafetyChecker::kAllocation, size);
+  *ptr = __libc_memalign(alignment, size);
+  return *ptr != nullptr ? 0 : ENOMEM;
+}
+
+void free(void* ptr) __THROW {
+  if (ptr != nullptr) {
+    vraudio::RealtimeSafetyChecker::ReportViolation(
+        vraudio::RealtimeSafetyChecker::kDeallocation, 0);
+  }
+  __libc_free(ptr);
+}
+
+int pthread_mutex_lock(pthread_mutex_t* mutex) __THROW {
+  vraudio::RealtimeSafetyChecker::ReportViolation(
+      vraudio::RealtimeSafetyChecker::kLock, 0);
+  return GetNextPthreadMutexLock()(mutex);
+}
+
+}  // extern "C"
+
+#else
+
+// Elsewhere, only the global C++ allocation functions are replaced.
+void* operator new(std::size_t size) {
+  vraudio::RealtimeSafetyChecker::ReportViolation(
+      vraudio::RealtimeSafetyChecker::kAllocation, size);
+  void* ptr = std::malloc(size == 0 ? 1 : size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void* operator new[](std::size_t size) { return operator new(size); }
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+  vraudio::RealtimeSafetyChecker::ReportViolation(
+      vraudio::RealtimeSafetyChecker::kAllocation, size);
+  return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept {
+  return operator new(size, tag);
+}
+
+void operator delete(void* ptr) noexcept {
+  if (ptr != nullptr) {
+    vraudio::RealtimeSafetyChecker::ReportViolation(
+        vraudio::RealtimeSafetyChecker::kDeallocation, 0);
+  }
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept { operator delete(ptr); }
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+  operator delete(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+  operator delete(ptr);
+}
+
+#endif  // defined(__GLIBC__)
+#endif  // defined(ENABLE_REALTIME_SAFETY_CHECKS)
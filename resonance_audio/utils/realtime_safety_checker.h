@@ -0,0 +1,112 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#ifndef RESONANCE_AUDIO_UTILS_REALTIME_SAFETY_CHECKER_H_
+#define RESONANCE_AUDIO_UTILS_REALTIME_SAFETY_CHECKER_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace vraudio {
+
+// Detects operations which are not real-time safe, i.e., heap allocations,
+// deallocations and blocking mutex locks, on threads that are inside a
+// real-time section. The detection relies on interposing the allocator and
+// |pthread_mutex_lock|, which is only compiled in with
+// |ENABLE_REALTIME_SAFETY_CHECKS|. Otherwise, no violations are ever reported.
+// Note that lock detection and stack capture are only supported with glibc.
+class RealtimeSafetyChecker {
+ public:
+  // Type of an operation which is not real-time safe.
+  enum ViolationType {
+    kAllocation = 0,
+    kDeallocation,
+    kLock,
+  };
+
+  // Maximum number of captured stack frames per violation.
+  static const size_t kMaxNumStackFrames = 32;
+
+  // Maximum number of recorded violations. Further violations are only
+  // counted.
+  static const size_t kMaxNumViolations = 64;
+
+  // Single violation.
+  struct Violation {
+    // Type of the violation.
+    ViolationType type;
+
+    // Number of allocated bytes, zero for other types.
+    size_t size;
+
+    // Return addresses of the call stack at the violation.
+    void* stack[kMaxNumStackFrames];
+
+    // Number of valid entries in |stack|.
+    size_t num_stack_frames;
+  };
+
+  // Marks the calling thread as real-time thread for the lifetime of the
+  // object. Sections may be nested.
+  class ScopedRealtimeSection {
+   public:
+    ScopedRealtimeSection();
+    ~ScopedRealtimeSection();
+  };
+
+  // Returns true if the checks are compiled in.
+  static bool IsEnabled();
+
+  // Returns true if the calling thread is inside a real-time section.
+  static bool IsInRealtimeSection();
+
+  // Enables aborting the process on the first violation, which is disabled by
+  // default.
+  //
+  // @param abort_on_violation True to abort on violations.
+  static void SetAbortOnViolation(bool abort_on_violation);
+
+  // Reports a violation on the calling thread if it is inside a real-time
+  // section. This is called by the interposed functions.
+  //
+  // @param type Type of the violation.
+  // @param size Number of allocated bytes, zero for other types.
+  static void ReportViolation(ViolationType type, size_t size);
+
+  // Returns the number of violations reported since the last |Reset| call.
+  static size_t GetNumViolations();
+
+  // Returns the first |kMaxNumViolations| violations reported since the last
+  // |Reset| call. Must not be called concurrently to real-time sections.
+  static std::vector<Violation> GetViolations();
+
+  // Returns a human readable description of a violation including its
+  // symbolized call stack.
+  //
+  // @param violation Violation.
+  // @return Description of |violation|.
+  static std::string DescribeViolation(const Violation& violation);
+
+  // Clears all reported violations. Must not be called concurrently to
+  // real-time sections.
+  static void Reset();
+};
+
+}  // namespace vraudio
+
+#endif  // RESONANCE_AUDIO_UTILS_REALTIME_SAFETY_CHECKER_H_
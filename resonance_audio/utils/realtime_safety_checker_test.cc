@@ -0,0 +1,112 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include "utils/realtime_safety_checker.h"
+
+#include <mutex>
+#include <new>
+#include <string>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace vraudio {
+
+namespace {
+
+const size_t kAllocationSize = 64;
+
+#if defined(ENABLE_REALTIME_SAFETY_CHECKS)
+
+// Tests that allocations and deallocations are only reported inside real-time
+// sections.
+TEST(RealtimeSafetyCheckerTest, ReportsAllocationsInRealtimeSections) {
+  RealtimeSafetyChecker::Reset();
+  // Explicit calls of the allocation functions cannot be elided.
+  void* ptr = ::operator new(kAllocationSize);
+  ::operator delete(ptr);
+  EXPECT_FALSE(RealtimeSafetyChecker::IsInRealtimeSection());
+  EXPECT_EQ(0U, RealtimeSafetyChecker::GetNumViolations());
+
+  {
+    RealtimeSafetyChecker::ScopedRealtimeSection realtime_section;
+    {
+      RealtimeSafetyChecker::ScopedRealtimeSection nested_realtime_section;
+    }
+    EXPECT_TRUE(RealtimeSafetyChecker::IsInRealtimeSection());
+    ptr = ::operator new(kAllocationSize);
+    ::operator delete(ptr);
+  }
+  EXPECT_FALSE(RealtimeSafetyChecker::IsInRealtimeSection());
+
+  ASSERT_EQ(2U, RealtimeSafetyChecker::GetNumViolations());
+  const auto violations = RealtimeSafetyChecker::GetViolations();
+  ASSERT_EQ(2U, violations.size());
+  EXPECT_EQ(RealtimeSafetyChecker::kAllocation, violations[0].type);
+  EXPECT_EQ(kAllocationSize, violations[0].size);
+  EXPECT_EQ(RealtimeSafetyChecker::kDeallocation, violations[1].type);
+  const std::string description =
+      RealtimeSafetyChecker::DescribeViolation(violations[0]);
+  EXPECT_EQ(0U, description.find("allocation of 64 bytes"));
+
+  RealtimeSafetyChecker::Reset();
+  EXPECT_EQ(0U, RealtimeSafetyChecker::GetNumViolations());
+  EXPECT_TRUE(RealtimeSafetyChecker::GetViolations().empty());
+}
+
+#if defined(__GLIBC__)
+
+// Tests that blocking mutex locks are reported, while try locks are not, and
+// that the call stack is captured.
+TEST(RealtimeSafetyCheckerTest, ReportsLocksWithCallStack) {
+  std::mutex mutex;
+  RealtimeSafetyChecker::Reset();
+  {
+    RealtimeSafetyChecker::ScopedRealtimeSection realtime_section;
+    if (mutex.try_lock()) {
+      mutex.unlock();
+    }
+    EXPECT_EQ(0U, RealtimeSafetyChecker::GetNumViolations());
+    mutex.lock();
+    mutex.unlock();
+  }
+
+  const auto violations = RealtimeSafetyChecker::GetViolations();
+  ASSERT_EQ(1U, violations.size());
+  EXPECT_EQ(RealtimeSafetyChecker::kLock, violations[0].type);
+  EXPECT_GT(violations[0].num_stack_frames, 0U);
+  RealtimeSafetyChecker::Reset();
+}
+
+#endif  // defined(__GLIBC__)
+
+#else
+
+// Tests that no violations are reported if the checks are compiled out.
+TEST(RealtimeSafetyCheckerTest, DisabledChecksReportNothing) {
+  EXPECT_FALSE(RealtimeSafetyChecker::IsEnabled());
+  RealtimeSafetyChecker::ScopedRealtimeSection realtime_section;
+  EXPECT_TRUE(RealtimeSafetyChecker::IsInRealtimeSection());
+  void* ptr = ::operator new(kAllocationSize);
+  ::operator delete(ptr);
+  EXPECT_EQ(0U, RealtimeSafetyChecker::GetNumViolations());
+}
+
+#endif  // defined(ENABLE_REALTIME_SAFETY_CHECKS)
+
+}  // namespace
+
+}  // namespace vraudio
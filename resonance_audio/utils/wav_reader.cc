@@ -19,8 +19,10 @@ limitations under the License.
 #include <algorithm>
 #include <string>
 
+#include "base/constants_and_types.h"
 #include "base/integral_types.h"
 #include "base/logging.h"
+#include "base/simd_utils.h"
 
 namespace vraudio {
 
@@ -42,26 +44,26 @@ struct WavFormat {
 };
 static_assert(sizeof(WavFormat) == 24, "Padding in WavFormat struct detected");
 
-struct WavHeader {
-  struct {
-    ChunkHeader header;
-    char format[4];
-  } riff;
-  WavFormat format;
-  struct {
-    ChunkHeader header;
-  } data;
+struct RiffHeader {
+  ChunkHeader header;
+  char format[4];
 };
+static_assert(sizeof(RiffHeader) == 12,
+              "Padding in RiffHeader struct detected");
 
-// Size of WAV header.
-const size_t kWavHeaderSize = 44;
+// Size of the extensible format fields following the |WavFormat| fields,
+// including the two-byte extension size field.
+const size_t kExtensibleFormatSize = 24;
 
-static_assert(sizeof(WavHeader) == kWavHeaderSize,
-              "Padding in WavHeader struct detected");
+// Number of samples decoded per read from the input stream. This bounds the
+// memory used for reading independently of the requested number of samples.
+const size_t kNumSamplesPerReadChunk = 4096;
 
 // Supported WAV encoding formats.
 static const uint16 kExtensibleWavFormat = 0xfffe;
 static const uint16 kPcmFormat = 0x1;
+static const uint16 kIeeeFloatFormat = 0x3;
+
 }  // namespace
 
 WavReader::WavReader(std::istream* binary_stream)
@@ -70,6 +72,8 @@ WavReader::WavReader(std::istream* binary_stream)
       sample_rate_hz_(-1),
       num_total_samples_(0),
       num_remaining_samples_(0),
+      format_tag_(0),
+      bytes_per_sample_(0),
       pcm_offset_bytes_(0) {
   init_ = ParseHeader();
 }
@@ -83,75 +87,79 @@ size_t WavReader::ReadBinaryDataFromStream(void* target_ptr, size_t size) {
 }
 
 bool WavReader::ParseHeader() {
-  WavHeader header;
-  // Exclude data field to be able to optionally parse the two-byte extension
-  // field.
-  if (ReadBinaryDataFromStream(&header, kWavHeaderSize - sizeof(header.data)) !=
-      kWavHeaderSize - sizeof(header.data))
-    return false;
-  const uint32 format_size = header.format.header.size;
-  // Size of |WavFormat| without |ChunkHeader|.
-  static const uint32 kFormatSubChunkHeader =
-      sizeof(WavFormat) - sizeof(ChunkHeader);
-  if (format_size < kFormatSubChunkHeader) {
+  RiffHeader riff_header;
+  if (ReadBinaryDataFromStream(&riff_header, sizeof(riff_header)) !=
+          sizeof(riff_header) ||
+      std::string(riff_header.header.id, 4) != "RIFF" ||
+      std::string(riff_header.format, 4) != "WAVE") {
     return false;
   }
-  if (format_size != kFormatSubChunkHeader) {
-    // Parse optional extension fields.
-    int16 extension_size;
-    if (ReadBinaryDataFromStream(&extension_size, sizeof(extension_size)) !=
-        sizeof(extension_size))
-      return false;
-    int8 extension_data;
-    for (size_t i = 0; i < static_cast<size_t>(extension_size); ++i) {
-      if (ReadBinaryDataFromStream(&extension_data, sizeof(extension_data)) !=
-          sizeof(extension_data))
-        return false;
-    }
-  }
-  if (header.format.format_tag == kExtensibleWavFormat) {
-    // Skip extensible wav format "fact" header.
-    ChunkHeader fact_header;
-    if (ReadBinaryDataFromStream(&fact_header, sizeof(fact_header)) !=
-        sizeof(fact_header)) {
+
+  // Scan the chunks up to the "data" chunk. Chunks other than "fmt " (e.g.,
+  // "fact" or "LIST") are skipped.
+  WavFormat format;
+  bool has_format = false;
+  ChunkHeader chunk_header;
+  while (true) {
+    if (ReadBinaryDataFromStream(&chunk_header, sizeof(chunk_header)) !=
+        sizeof(chunk_header)) {
       return false;
     }
-    if (std::string(fact_header.id, 4) != "fact") {
-      return false;
+    const std::string chunk_id(chunk_header.id, 4);
+    if (chunk_id == "data") {
+      break;
     }
-    int8 fact_data;
-    for (size_t i = 0; i < static_cast<size_t>(fact_header.size); ++i) {
-      if (ReadBinaryDataFromStream(&fact_data, sizeof(fact_data)) !=
-          sizeof(fact_data))
+    // Chunks are padded to an even number of bytes.
+    size_t num_bytes_to_skip = chunk_header.size + (chunk_header.size & 1);
+    if (chunk_id == "fmt ") {
+      // Size of |WavFormat| without |ChunkHeader|.
+      static const size_t kFormatSubChunkSize =
+          sizeof(WavFormat) - sizeof(ChunkHeader);
+      if (chunk_header.size < kFormatSubChunkSize ||
+          ReadBinaryDataFromStream(&format.format_tag, kFormatSubChunkSize) !=
+              kFormatSubChunkSize) {
         return false;
+      }
+      num_bytes_to_skip -= kFormatSubChunkSize;
+      if (format.format_tag == kExtensibleWavFormat) {
+        // The sub format GUID starts with the actual format tag.
+        uint8 extension[kExtensibleFormatSize];
+        if (chunk_header.size < kFormatSubChunkSize + kExtensibleFormatSize ||
+            ReadBinaryDataFromStream(extension, kExtensibleFormatSize) !=
+                kExtensibleFormatSize) {
+          return false;
+        }
+        format.format_tag = static_cast<uint16>(extension[8] |
+                                                (extension[9] << 8));
+        num_bytes_to_skip -= kExtensibleFormatSize;
+      }
+      has_format = true;
     }
+    binary_stream_->ignore(num_bytes_to_skip);
   }
-
-  // Read the "data" header.
-  if (ReadBinaryDataFromStream(&header.data, sizeof(header.data)) !=
-      sizeof(header.data)) {
+  if (!has_format) {
     return false;
   }
 
-  num_channels_ = header.format.num_channels;
-  sample_rate_hz_ = header.format.samples_rate;
-
-  bytes_per_sample_ = header.format.bits_per_sample / 8;
-  if (bytes_per_sample_ == 0 || bytes_per_sample_ != sizeof(int16)) {
+  num_channels_ = format.num_channels;
+  sample_rate_hz_ = format.samples_rate;
+  format_tag_ = format.format_tag;
+  bytes_per_sample_ = format.bits_per_sample / 8;
+  const bool is_supported_pcm =
+      format_tag_ == kPcmFormat &&
+      (bytes_per_sample_ == 2 || bytes_per_sample_ == 3 ||
+       bytes_per_sample_ == 4);
+  const bool is_supported_float =
+      format_tag_ == kIeeeFloatFormat && bytes_per_sample_ == sizeof(float);
+  if (!is_supported_pcm && !is_supported_float) {
     return false;
   }
-  const size_t bytes_in_payload = header.data.header.size;
+  const size_t bytes_in_payload = chunk_header.size;
   num_total_samples_ = bytes_in_payload / bytes_per_sample_;
   num_remaining_samples_ = num_total_samples_;
 
-  if (header.format.num_channels == 0 || num_total_samples_ == 0 ||
-      bytes_in_payload % bytes_per_sample_ != 0 ||
-      (header.format.format_tag != kPcmFormat &&
-       header.format.format_tag != kExtensibleWavFormat) ||
-      (std::string(header.riff.header.id, 4) != "RIFF") ||
-      (std::string(header.riff.format, 4) != "WAVE") ||
-      (std::string(header.format.header.id, 4) != "fmt ") ||
-      (std::string(header.data.header.id, 4) != "data")) {
+  if (num_channels_ == 0 || num_total_samples_ == 0 ||
+      bytes_in_payload % bytes_per_sample_ != 0) {
     return false;
   }
 
@@ -164,25 +172,118 @@ bool WavReader::ParseHeader() {
 }
 
 size_t WavReader::ReadSamples(size_t num_samples, int16* target_buffer) {
-  const size_t num_samples_to_read =
-      std::min(num_remaining_samples_, num_samples);
-  if (num_samples_to_read == 0) {
-    return 0;
+  if (bytes_per_sample_ == sizeof(int16)) {
+    // 16-bit PCM is read without conversion.
+    const size_t num_samples_to_read =
+        std::min(num_remaining_samples_, num_samples);
+    if (num_samples_to_read == 0) {
+      return 0;
+    }
+    const size_t num_bytes_read = ReadBinaryDataFromStream(
+        target_buffer, num_samples_to_read * sizeof(int16));
+    const size_t num_samples_read = num_bytes_read / bytes_per_sample_;
+    num_remaining_samples_ -= num_samples_read;
+    return num_samples_read;
   }
-  const size_t num_bytes_read =
-      ReadBinaryDataFromStream(target_buffer, num_samples * sizeof(int16));
-  const size_t num_samples_read = num_bytes_read / bytes_per_sample_;
 
-  num_remaining_samples_ -= num_samples_read;
+  size_t num_samples_read = 0;
+  conversion_buffer_.resize(kNumSamplesPerReadChunk);
+  while (num_samples_read < num_samples) {
+    const size_t num_chunk_samples = ReadSamples(
+        std::min(kNumSamplesPerReadChunk, num_samples - num_samples_read),
+        conversion_buffer_.data());
+    if (num_chunk_samples == 0) {
+      break;
+    }
+    Int16FromFloat(num_chunk_samples, conversion_buffer_.data(),
+                   target_buffer + num_samples_read);
+    num_samples_read += num_chunk_samples;
+  }
+  return num_samples_read;
+}
+
+size_t WavReader::ReadSamples(size_t num_samples, float* target_buffer) {
+  size_t num_samples_read = 0;
+  read_buffer_.resize(kNumSamplesPerReadChunk * bytes_per_sample_);
+  while (num_samples_read < num_samples) {
+    const size_t num_samples_to_read =
+        std::min(std::min(num_remaining_samples_, kNumSamplesPerReadChunk),
+                 num_samples - num_samples_read);
+    if (num_samples_to_read == 0) {
+      break;
+    }
+    const size_t num_chunk_samples =
+        ReadBinaryDataFromStream(read_buffer_.data(),
+                                 num_samples_to_read * bytes_per_sample_) /
+        bytes_per_sample_;
+    if (num_chunk_samples == 0) {
+      break;
+    }
+    float* const output = target_buffer + num_samples_read;
+    if (format_tag_ == kIeeeFloatFormat) {
+      std::copy_n(reinterpret_cast<const float*>(read_buffer_.data()),
+                  num_chunk_samples, output);
+    } else if (bytes_per_sample_ == sizeof(int16)) {
+      FloatFromInt16(num_chunk_samples,
+                     reinterpret_cast<const int16*>(read_buffer_.data()),
+                     output);
+    } else if (bytes_per_sample_ == 3) {
+      FloatFromInt24(num_chunk_samples, read_buffer_.data(), output);
+    } else {
+      FloatFromInt32(num_chunk_samples,
+                     reinterpret_cast<const int32*>(read_buffer_.data()),
+                     output);
+    }
+    num_remaining_samples_ -= num_chunk_samples;
+    num_samples_read += num_chunk_samples;
+  }
   return num_samples_read;
 }
 
+size_t WavReader::ReadPlanarFrames(size_t num_frames,
+                                   float* const* target_channels) {
+  const size_t num_frames_per_chunk =
+      std::max<size_t>(1, kNumSamplesPerReadChunk / num_channels_);
+  conversion_buffer_.resize(num_frames_per_chunk * num_channels_);
+  size_t num_frames_read = 0;
+  while (num_frames_read < num_frames) {
+    const size_t num_chunk_frames =
+        ReadSamples(std::min(num_frames_per_chunk,
+                             num_frames - num_frames_read) *
+                        num_channels_,
+                    conversion_buffer_.data()) /
+        num_channels_;
+    if (num_chunk_frames == 0) {
+      break;
+    }
+    if (num_channels_ == kNumStereoChannels) {
+      DeinterleaveStereo(num_chunk_frames, conversion_buffer_.data(),
+                         target_channels[0] + num_frames_read,
+                         target_channels[1] + num_frames_read);
+    } else {
+      for (size_t channel = 0; channel < num_channels_; ++channel) {
+        float* const output = target_channels[channel] + num_frames_read;
+        const float* input = conversion_buffer_.data() + channel;
+        for (size_t frame = 0; frame < num_chunk_frames;
+             ++frame, input += num_channels_) {
+          output[frame] = *input;
+        }
+      }
+    }
+    num_frames_read += num_chunk_frames;
+  }
+  return num_frames_read;
+}
+
 int64 WavReader::SeekToFrame(const uint64 frame_position) {
   DCHECK_GT(num_channels_, 0U);
   if (frame_position <= (num_total_samples_ / num_channels_)) {
     const uint64 seek_position_byte =
         pcm_offset_bytes_ + frame_position * num_channels_ * bytes_per_sample_;
     binary_stream_->seekg(seek_position_byte, binary_stream_->beg);
+    num_remaining_samples_ =
+        num_total_samples_ -
+        static_cast<size_t>(frame_position) * num_channels_;
   }
 
   int64 binary_stream_position_byte =
@@ -19,12 +19,16 @@ limitations under the License.
 
 #include <cstdint>
 #include <istream>
+#include <vector>
 
 #include "base/integral_types.h"
 
 namespace vraudio {
 
-// Basic RIFF WAVE decoder that supports multichannel 16-bit PCM.
+// Basic RIFF WAVE decoder that supports multichannel 16-bit, 24-bit and 32-bit
+// PCM as well as 32-bit float samples. Samples are decoded incrementally from
+// the input stream, using a bounded amount of memory regardless of the file
+// length.
 class WavReader {
  public:
   // Constructor decodes WAV header.
@@ -53,12 +57,22 @@ class WavReader {
   //     negative return value indicates a stream failure.
   int64 SeekToFrame(const uint64 frame_position);
 
-  // Reads samples from WAV file into target buffer.
+  // Reads interleaved samples from WAV file into target buffer. Samples are
+  // converted if the sample format of the file differs from the target buffer.
   //
   // @param num_samples Number of samples to read.
   // @param target_buffer Target buffer to write to.
   // @return Number of decoded samples.
   size_t ReadSamples(size_t num_samples, int16_t* target_buffer);
+  size_t ReadSamples(size_t num_samples, float* target_buffer);
+
+  // Reads frames from WAV file into planar float channel buffers, e.g., to be
+  // passed to |ResonanceAudioApi::SetPlanarBuffer|.
+  //
+  // @param num_frames Number of frames to read.
+  // @param target_channels Array of |GetNumChannels| target channel pointers.
+  // @return Number of decoded frames.
+  size_t ReadPlanarFrames(size_t num_frames, float* const* target_channels);
 
  private:
   // Parses WAV header.
@@ -91,11 +105,20 @@ class WavReader {
   // Number of remaining samples in WAV file.
   size_t num_remaining_samples_;
 
+  // Format tag of the samples, i.e., PCM or IEEE float.
+  uint16 format_tag_;
+
   // Bytes per sample as defined in the WAV header.
   size_t bytes_per_sample_;
 
   // Offset into data stream where PCM data begins.
   uint64 pcm_offset_bytes_;
+
+  // Raw sample data of a single read from the input stream.
+  std::vector<uint8> read_buffer_;
+
+  // Decoded float samples used for conversion and deinterleaving.
+  std::vector<float> conversion_buffer_;
 };
 
 }  // namespace vraudio
@@ -0,0 +1,231 @@
+/*
+Copyright 2018 Google Inc. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS-IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "utils/wav_reader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+#include "base/constants_and_types.h"
+
+namespace vraudio {
+
+namespace {
+
+const int kSampleRateHz = 48000;
+
+// Number of frames in the test files. Exceeds the internal read chunk size.
+const size_t kNumFrames = 5000;
+
+// Tolerated error of 16-bit quantization.
+const float kEpsilon = 1.0f / 32768.0f;
+
+// WAV format tags.
+const uint16 kPcmFormat = 0x1;
+const uint16 kIeeeFloatFormat = 0x3;
+const uint16 kExtensibleFormat = 0xfffe;
+
+// Appends a little-endian integer to |data|.
+void AppendLittleEndian(uint32 value, size_t num_bytes, std::string* data) {
+  for (size_t i = 0; i < num_bytes; ++i) {
+    data->push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+  }
+}
+
+// Returns the test signal value of |channel| at |frame|.
+float GetTestSample(size_t channel, size_t frame) {
+  return (static_cast<float>(frame % 200) / 100.0f - 1.0f) *
+         (channel == 0 ? 0.5f : -0.25f);
+}
+
+// Encodes a WAV file of little-endian encoded |samples|. An extensible file
+// additionally contains a "fact" and a "LIST" chunk.
+std::string EncodeWav(uint16 format_tag, size_t bytes_per_sample,
+                      size_t num_channels, bool extensible,
+                      const std::string& samples);
+
+// Encodes a WAV file of the test signal.
+std::string EncodeTestWav(uint16 format_tag, size_t bytes_per_sample,
+                          size_t num_channels, bool extensible) {
+  std::string samples;
+  for (size_t frame = 0; frame < kNumFrames; ++frame) {
+    for (size_t channel = 0; channel < num_channels; ++channel) {
+      const float value = GetTestSample(channel, frame);
+      if (format_tag == kIeeeFloatFormat) {
+        uint32 bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        AppendLittleEndian(bits, 4, &samples);
+      } else {
+        const double scale =
+            static_cast<double>(1u << (8 * bytes_per_sample - 1));
+        AppendLittleEndian(
+            static_cast<uint32>(static_cast<int32>(value * scale)),
+            bytes_per_sample, &samples);
+      }
+    }
+  }
+  return EncodeWav(format_tag, bytes_per_sample, num_channels, extensible,
+                   samples);
+}
+
+std::string EncodeWav(uint16 format_tag, size_t bytes_per_sample,
+                      size_t num_channels, bool extensible,
+                      const std::string& samples) {
+  std::string format;
+  AppendLittleEndian(extensible ? kExtensibleFormat : format_tag, 2, &format);
+  AppendLittleEndian(static_cast<uint32>(num_channels), 2, &format);
+  AppendLittleEndian(kSampleRateHz, 4, &format);
+  AppendLittleEndian(
+      static_cast<uint32>(kSampleRateHz * num_channels * bytes_per_sample), 4,
+      &format);
+  AppendLittleEndian(static_cast<uint32>(num_channels * bytes_per_sample), 2,
+                     &format);
+  AppendLittleEndian(static_cast<uint32>(8 * bytes_per_sample), 2, &format);
+  if (extensible) {
+    AppendLittleEndian(22, 2, &format);
+    AppendLittleEndian(static_cast<uint32>(8 * bytes_per_sample), 2, &format);
+    AppendLittleEndian(0, 4, &format);
+    // Sub format GUID, which starts with the actual format tag.
+    AppendLittleEndian(format_tag, 2, &format);
+    format.append(14, '\x01');
+  }
+
+  std::string chunks = "fmt ";
+  AppendLittleEndian(static_cast<uint32>(format.size()), 4, &chunks);
+  chunks += format;
+  if (extensible) {
+    chunks += "fact";
+    AppendLittleEndian(4, 4, &chunks);
+    AppendLittleEndian(static_cast<uint32>(kNumFrames), 4, &chunks);
+    // Odd sized chunk followed by a pad byte.
+    chunks += "LIST";
+    AppendLittleEndian(3, 4, &chunks);
+    chunks += "abc";
+    chunks.push_back('\0');
+  }
+  chunks += "data";
+  AppendLittleEndian(static_cast<uint32>(samples.size()), 4, &chunks);
+  chunks += samples;
+
+  std::string wav = "RIFF";
+  AppendLittleEndian(static_cast<uint32>(4 + chunks.size()), 4, &wav);
+  wav += "WAVE" + chunks;
+  return wav;
+}
+
+struct WavFormatParams {
+  uint16 format_tag;
+  size_t bytes_per_sample;
+  bool extensible;
+};
+
+class WavReaderTest : public ::testing::TestWithParam<WavFormatParams> {};
+
+// Tests that all supported sample formats are decoded into planar float
+// channels, in reads of arbitrary size.
+TEST_P(WavReaderTest, ReadPlanarFrames) {
+  const WavFormatParams params = GetParam();
+  std::istringstream stream(
+      EncodeTestWav(params.format_tag, params.bytes_per_sample,
+                    kNumStereoChannels, params.extensible));
+  WavReader reader(&stream);
+  ASSERT_TRUE(reader.IsHeaderValid());
+  EXPECT_EQ(kNumStereoChannels, reader.GetNumChannels());
+  EXPECT_EQ(kSampleRateHz, reader.GetSampleRateHz());
+  EXPECT_EQ(kNumFrames * kNumStereoChannels, reader.GetNumTotalSamples());
+
+  std::vector<float> left(kNumFrames + 1);
+  std::vector<float> right(kNumFrames + 1);
+  const size_t kReadSize = 333;
+  size_t num_frames_read = 0;
+  while (true) {
+    float* const channels[] = {left.data() + num_frames_read,
+                               right.data() + num_frames_read};
+    const size_t num_frames = reader.ReadPlanarFrames(
+        std::min(kReadSize, left.size() - num_frames_read), channels);
+    if (num_frames == 0) {
+      break;
+    }
+    num_frames_read += num_frames;
+  }
+  ASSERT_EQ(kNumFrames, num_frames_read);
+  for (size_t frame = 0; frame < kNumFrames; ++frame) {
+    EXPECT_NEAR(GetTestSample(0, frame), left[frame], kEpsilon);
+    EXPECT_NEAR(GetTestSample(1, frame), right[frame], kEpsilon);
+  }
+}
+
+// Tests that any supported sample format can be read as int16 and that seeking
+// restarts the decoding at the requested frame.
+TEST_P(WavReaderTest, ReadInt16SamplesAfterSeek) {
+  const WavFormatParams params = GetParam();
+  std::istringstream stream(EncodeTestWav(
+      params.format_tag, params.bytes_per_sample, kNumMonoChannels,
+      params.extensible));
+  WavReader reader(&stream);
+  ASSERT_TRUE(reader.IsHeaderValid());
+
+  const size_t kSeekFrame = 4000;
+  EXPECT_EQ(static_cast<int64>(kSeekFrame), reader.SeekToFrame(kSeekFrame));
+  std::vector<int16> samples(kNumFrames);
+  ASSERT_EQ(kNumFrames - kSeekFrame,
+            reader.ReadSamples(samples.size(), samples.data()));
+  for (size_t i = 0; i < kNumFrames - kSeekFrame; ++i) {
+    EXPECT_NEAR(GetTestSample(0, kSeekFrame + i),
+                static_cast<float>(samples[i]) / 32768.0f, 2.0f * kEpsilon);
+  }
+}
+
+// Tests that the largest positive integer maps to 1.0f for all PCM bit depths.
+TEST(WavReaderFullScaleTest, FullScaleIsConsistentAcrossBitDepths) {
+  for (size_t bytes_per_sample = 2; bytes_per_sample <= 4;
+       ++bytes_per_sample) {
+    SCOPED_TRACE(bytes_per_sample);
+    const uint32 max_value = (1u << (8 * bytes_per_sample - 1)) - 1u;
+    std::string samples;
+    for (size_t frame = 0; frame < kNumFrames; ++frame) {
+      const uint32 value = frame % 2 == 0 ? max_value : 0u - max_value;
+      AppendLittleEndian(value, bytes_per_sample, &samples);
+    }
+    std::istringstream stream(EncodeWav(kPcmFormat, bytes_per_sample,
+                                        kNumMonoChannels, false, samples));
+    WavReader reader(&stream);
+    ASSERT_TRUE(reader.IsHeaderValid());
+    std::vector<float> output(kNumFrames);
+    float* const channels[] = {output.data()};
+    ASSERT_EQ(kNumFrames, reader.ReadPlanarFrames(kNumFrames, channels));
+    for (size_t frame = 0; frame < kNumFrames; ++frame) {
+      EXPECT_FLOAT_EQ(frame % 2 == 0 ? 1.0f : -1.0f, output[frame]);
+    }
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(
+    SampleFormats, WavReaderTest,
+    ::testing::Values(WavFormatParams{kPcmFormat, 2, false},
+                      WavFormatParams{kPcmFormat, 3, false},
+                      WavFormatParams{kPcmFormat, 4, false},
+                      WavFormatParams{kIeeeFloatFormat, 4, false},
+                      WavFormatParams{kPcmFormat, 3, true},
+                      WavFormatParams{kIeeeFloatFormat, 4, true}));
+
+}  // namespace
+
+}  // namespace vraudio
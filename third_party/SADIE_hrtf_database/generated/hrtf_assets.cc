@@ -1195,6 +1195,3923 @@ const HrtfAssets::AssetDataMap HrtfAssets::kAssetMap = {
       0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
       0x0, 0x0, 0x0, 0xff, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
       0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff,
-      0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff}}};
+      0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff}},
+    {"WAV/Subject_002/SH/sh_hrir_order_5.wav",
+     {0x52, 0x49, 0x46, 0x46, 0x24, 0x48, 0x0, 0x0, 0x57, 0x41, 0x56, 0x45,
+      0x66, 0x6d, 0x74, 0x20, 0x10, 0x0, 0x0, 0x0, 0x1, 0x0, 0x24, 0x0, 0x80,
+      0xbb, 0x0, 0x0, 0x0, 0xbc, 0x34, 0x0, 0x48, 0x0, 0x10, 0x0, 0x64, 0x61,
+      0x74, 0x61, 0x0, 0x48, 0x0, 0x0, 0xfe, 0xff, 0x5, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x0,
+      0x0, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf5, 0xff, 0x18, 0x0, 0xff, 0xff,
+      0xff, 0xff, 0xfe, 0xff, 0x1, 0x0, 0xfb, 0xff, 0xfc, 0xff, 0xf8, 0xff,
+      0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x4, 0x0, 0xff, 0xff, 0x1,
+      0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0xfe, 0xff, 0x0, 0x0, 0x0,
+      0x0, 0x1, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+      0xff, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x2,
+      0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
+      0x0, 0xfe, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+      0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+      0x0, 0xf3, 0xff, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x3, 0x0, 0x2,
+      0x0, 0x5, 0x0, 0x1, 0x0, 0x1, 0x0, 0x2, 0x0, 0x0, 0x0, 0xfe, 0xff, 0xff,
+      0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x2, 0x0, 0x0,
+      0x0, 0xff, 0xff, 0xff, 0xff, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff,
+      0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+      0x1, 0x0, 0x4, 0x0, 0xfc, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xfd,
+      0xff, 0x1, 0x0, 0x2, 0x0, 0x1, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x0, 0x1,
+      0x0, 0xfe, 0xff, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0xff, 0xff, 0x2,
+      0x0, 0x2, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x1, 0x0, 0x1, 0x0, 0x0,
+      0x0, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1,
+      0x0, 0xff, 0xff, 0x1, 0x0, 0x9, 0x0, 0xe8, 0xff, 0x3, 0x0, 0x2, 0x0, 0x3,
+      0x0, 0x1, 0x0, 0x7, 0x0, 0x3, 0x0, 0xc, 0x0, 0x5, 0x0, 0x1, 0x0, 0x5, 0x0,
+      0x1, 0x0, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x0, 0x0, 0xfe, 0xff, 0xff,
+      0xff, 0x2, 0x0, 0x3, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x0, 0x0, 0x0, 0x0, 0x2,
+      0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x2, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xff,
+      0xff, 0x1, 0x0, 0x2, 0x0, 0x0, 0x0, 0x4, 0x0, 0xef, 0xff, 0x2, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0, 0x3, 0x0, 0x5, 0x0, 0xff, 0xff, 0x2,
+      0x0, 0x1, 0x0, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0x1, 0x0, 0x0, 0x0,
+      0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x2, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+      0xff, 0x3, 0x0, 0x1, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xfe, 0xff,
+      0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0xb, 0x0,
+      0xe7, 0xff, 0xfc, 0xff, 0x3, 0x0, 0x6, 0x0, 0xf6, 0xff, 0xa, 0x0, 0x4,
+      0x0, 0xe, 0x0, 0xa, 0x0, 0x3, 0x0, 0x9, 0x0, 0x6, 0x0, 0xf9, 0xff, 0x9,
+      0x0, 0xfb, 0xff, 0xfc, 0xff, 0x5, 0x0, 0xfc, 0xff, 0x6, 0x0, 0x5, 0x0,
+      0x0, 0x0, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0,
+      0x0, 0x0, 0x0, 0x8, 0x0, 0xfd, 0xff, 0x1, 0x0, 0xfe, 0xff, 0x3, 0x0, 0xfe,
+      0xff, 0x2, 0x0, 0xe8, 0xff, 0xa1, 0xff, 0x9, 0x0, 0x2, 0x0, 0x0, 0x0,
+      0x10, 0x0, 0x36, 0x0, 0x2, 0x0, 0x5a, 0x0, 0x4d, 0x0, 0xff, 0xff, 0x3c,
+      0x0, 0xf8, 0xff, 0xff, 0xff, 0xf1, 0xff, 0x5, 0x0, 0x5, 0x0, 0xf4, 0xff,
+      0x3, 0x0, 0xfa, 0xff, 0xe2, 0xff, 0x1, 0x0, 0xd2, 0xff, 0x2, 0x0, 0xd3,
+      0xff, 0xf3, 0xff, 0x1, 0x0, 0xed, 0xff, 0x1, 0x0, 0xe0, 0xff, 0xff, 0xff,
+      0x0, 0x0, 0x2, 0x0, 0xff, 0xff, 0x7, 0x0, 0xff, 0xff, 0xdc, 0xff, 0x64,
+      0xff, 0xf1, 0xff, 0xfe, 0xff, 0x1, 0x0, 0xdd, 0xff, 0x6a, 0x0, 0x7, 0x0,
+      0x9e, 0x0, 0x99, 0x0, 0x7, 0x0, 0x76, 0x0, 0x10, 0x0, 0xf5, 0xff, 0x20,
+      0x0, 0xfa, 0xff, 0xf8, 0xff, 0x16, 0x0, 0xf8, 0xff, 0xd, 0x0, 0xcd, 0xff,
+      0xfe, 0xff, 0xb3, 0xff, 0xf9, 0xff, 0x90, 0xff, 0xd8, 0xff, 0xfd, 0xff,
+      0xee, 0xff, 0xfe, 0xff, 0xdb, 0xff, 0xfc, 0xff, 0x0, 0x0, 0xfd, 0xff, 0x6,
+      0x0, 0xf3, 0xff, 0x6, 0x0, 0xf3, 0xff, 0xf1, 0xff, 0x11, 0x0, 0xb, 0x0,
+      0xd, 0x0, 0x1c, 0x0, 0xb3, 0xff, 0xf8, 0xff, 0xcb, 0xff, 0x4e, 0xff, 0xee,
+      0xff, 0x55, 0xff, 0xf8, 0xff, 0x1, 0x0, 0xea, 0xff, 0xff, 0xff, 0x6, 0x0,
+      0xf2, 0xff, 0x5, 0x0, 0x3, 0x0, 0xa6, 0x0, 0x8, 0x0, 0xc8, 0x0, 0x14, 0x0,
+      0xd5, 0x0, 0x82, 0x0, 0x7, 0x0, 0x61, 0x0, 0x7, 0x0, 0xe3, 0x0, 0xfc,
+      0xff, 0x1, 0x0, 0xff, 0xff, 0xfd, 0xff, 0x8, 0x0, 0xfa, 0xff, 0x3b, 0x0,
+      0x2c, 0x1, 0x25, 0x0, 0xe9, 0xff, 0xd6, 0xff, 0x4b, 0x0, 0x67, 0xfe, 0xf2,
+      0xff, 0xcc, 0xfd, 0x80, 0xfc, 0xe3, 0xff, 0x64, 0xfd, 0xba, 0xff, 0x0,
+      0x0, 0xbd, 0xff, 0x26, 0x0, 0xf, 0x0, 0xe1, 0xff, 0x2, 0x0, 0xba, 0xff,
+      0xf7, 0x1, 0xe, 0x0, 0x7f, 0x2, 0x18, 0x0, 0x41, 0x3, 0x85, 0x1, 0x6, 0x0,
+      0xf6, 0x0, 0x8, 0x0, 0x30, 0x2, 0xe, 0x0, 0x0, 0x0, 0x14, 0x0, 0x2, 0x0,
+      0x6, 0x0, 0x0, 0x0, 0x1d, 0x0, 0x97, 0xff, 0x5, 0x0, 0xb9, 0xff, 0x74,
+      0xff, 0xf3, 0xff, 0xf9, 0x0, 0x12, 0x0, 0x93, 0x0, 0x26, 0x1, 0x21, 0x0,
+      0xe1, 0x1, 0x20, 0x0, 0x29, 0x0, 0x21, 0x0, 0x9b, 0x0, 0x63, 0x0, 0x22,
+      0x0, 0x21, 0x0, 0x35, 0x0, 0x64, 0xfe, 0xe8, 0xff, 0xf7, 0xfd, 0xdc, 0xff,
+      0xdd, 0xfe, 0x4c, 0xff, 0xee, 0xff, 0xd0, 0xfe, 0xea, 0xff, 0xa6, 0xfd,
+      0xef, 0xff, 0x2, 0x0, 0xec, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xdc, 0xff,
+      0x4a, 0x2, 0x2d, 0x4, 0x26, 0xff, 0xdb, 0xff, 0xa5, 0xff, 0xf3, 0xfd,
+      0x29, 0xff, 0x4c, 0x0, 0xdb, 0xfd, 0x84, 0x3, 0x90, 0x0, 0xf0, 0x1, 0x13,
+      0x2, 0x42, 0x0, 0xe2, 0x1, 0x6a, 0x0, 0x34, 0x0, 0xdb, 0x0, 0x45, 0x0,
+      0x1b, 0x2, 0xbd, 0xfb, 0x9d, 0xff, 0x5b, 0xfb, 0x67, 0xff, 0xeb, 0xf9,
+      0xed, 0xfb, 0xc1, 0xff, 0xa7, 0xfd, 0xae, 0xff, 0xfd, 0xf8, 0x86, 0xff,
+      0xfb, 0xff, 0x6f, 0xff, 0xe7, 0xff, 0xf0, 0xff, 0xf9, 0xff, 0x38, 0x0,
+      0xb5, 0x1, 0x9d, 0x1, 0x40, 0x1, 0xa0, 0x2, 0x3a, 0x3, 0x48, 0xfd, 0xb0,
+      0xff, 0x8c, 0xfd, 0x1b, 0xfe, 0x7a, 0xff, 0xd2, 0xfb, 0x33, 0xfe, 0x68,
+      0xff, 0x3b, 0xfd, 0xdf, 0xfc, 0xd1, 0xfd, 0x9, 0xfe, 0x88, 0xff, 0x94,
+      0xfe, 0xdf, 0x1, 0x27, 0x0, 0x38, 0x3, 0x71, 0x0, 0x2f, 0x0, 0x31, 0xff,
+      0x24, 0x0, 0xd8, 0x1, 0x24, 0x0, 0xa2, 0x1, 0x56, 0x0, 0xf3, 0xff, 0x51,
+      0x0, 0x6b, 0x0, 0x56, 0x1, 0xf7, 0x0, 0x2c, 0xfa, 0x74, 0xf2, 0xdf, 0x0,
+      0x63, 0x1, 0xe2, 0x2, 0xcf, 0x3, 0x7b, 0x7, 0x35, 0x0, 0x38, 0xb, 0x7d,
+      0x2, 0x1f, 0x0, 0xc2, 0x4, 0xb6, 0xf9, 0x73, 0xfe, 0x6a, 0xfb, 0xaf, 0xfc,
+      0xdd, 0xfd, 0xbb, 0xfd, 0x7a, 0xfe, 0x6a, 0xf8, 0x83, 0x2, 0xc2, 0x0,
+      0xa5, 0x1, 0x2b, 0x0, 0x60, 0x3, 0xbe, 0x3, 0x27, 0x0, 0x94, 0x1, 0xb9,
+      0x0, 0xaf, 0x7, 0xf1, 0x1, 0x8, 0x0, 0x51, 0x2, 0xee, 0x0, 0x19, 0x0,
+      0xf2, 0x0, 0x5, 0x2, 0xb2, 0x1, 0x1f, 0xf7, 0xec, 0xfd, 0x21, 0xfc, 0xe4,
+      0xef, 0xde, 0x2, 0x4, 0x1, 0xea, 0x2, 0x63, 0x4, 0xb8, 0x1, 0x8a, 0x5,
+      0xe0, 0x7, 0xae, 0xff, 0x5e, 0xc, 0x5b, 0x4, 0x24, 0x3, 0xc9, 0x6, 0x60,
+      0xff, 0xf2, 0x4, 0x29, 0x1, 0xb4, 0xff, 0x35, 0xfc, 0x5e, 0xfe, 0x0, 0xfe,
+      0x3, 0x2, 0x70, 0xff, 0xbe, 0xfd, 0xc6, 0xff, 0x4a, 0x5, 0x32, 0xff, 0x5f,
+      0x0, 0xf6, 0xfe, 0xf5, 0xff, 0xc5, 0xfc, 0x8a, 0xfe, 0x44, 0xff, 0x6c,
+      0xfe, 0x3c, 0x5, 0xb8, 0xfc, 0x28, 0xf9, 0xd8, 0x5, 0x88, 0xfe, 0xcb,
+      0xfd, 0xb1, 0x0, 0x3f, 0x2, 0xc3, 0xfc, 0xb5, 0xfe, 0xef, 0x4, 0xb7, 0x3,
+      0x41, 0xfe, 0x28, 0x8, 0xb1, 0x5, 0xa2, 0xfe, 0x9f, 0x3, 0xce, 0x9, 0x3,
+      0xff, 0x91, 0xff, 0x5c, 0xfd, 0x71, 0x2, 0xb8, 0xfd, 0xb7, 0xff, 0xb9,
+      0x0, 0x76, 0xfd, 0x72, 0xff, 0x5c, 0xfc, 0xcc, 0xfc, 0xe, 0x0, 0x5a, 0xfc,
+      0x9f, 0xfd, 0xf2, 0x1, 0xc, 0xfd, 0xc7, 0xfb, 0x33, 0xf8, 0xd6, 0xc, 0x17,
+      0x3, 0xdc, 0x4, 0x29, 0x14, 0x9c, 0x4, 0x96, 0x0, 0xe0, 0x1, 0x59, 0xfd,
+      0xb4, 0x0, 0xc3, 0x2, 0xf0, 0xf7, 0x15, 0x0, 0x7b, 0xf3, 0xce, 0xfb, 0x87,
+      0xfd, 0xa, 0xfd, 0xd5, 0x0, 0x3e, 0xfd, 0x84, 0xfa, 0xae, 0xff, 0xc0, 0x1,
+      0x8f, 0xff, 0x31, 0x2, 0x1e, 0xfe, 0xec, 0xff, 0x22, 0x4, 0xcd, 0xff,
+      0xcd, 0xf8, 0xb3, 0xff, 0x47, 0xff, 0x95, 0x0, 0xd7, 0xff, 0xff, 0xfd,
+      0x7, 0x1, 0xd7, 0x7, 0xd0, 0xf, 0xf8, 0xf4, 0xe6, 0x5, 0xa9, 0xa, 0xd5,
+      0xee, 0x97, 0xf8, 0xd0, 0x2, 0x87, 0xf9, 0xb5, 0xfb, 0x5d, 0x3, 0xbf,
+      0xf9, 0xb3, 0x4, 0xdd, 0xfb, 0x42, 0xa, 0x1e, 0xf7, 0x63, 0xfc, 0x5a, 0x4,
+      0x88, 0xfc, 0x8, 0xff, 0x44, 0x5, 0x6d, 0x1, 0x33, 0xa, 0x5e, 0xfe, 0x22,
+      0x7, 0x18, 0x5, 0xe0, 0xff, 0x66, 0x7, 0x9c, 0x1, 0xbc, 0x9, 0x34, 0x1,
+      0x53, 0x0, 0x4c, 0x1, 0x56, 0x1, 0x63, 0xfe, 0xeb, 0x0, 0x89, 0xf8, 0x97,
+      0xf3, 0xa, 0xfd, 0xf9, 0xf5, 0x93, 0xf0, 0x5f, 0x1, 0x99, 0xf7, 0x78,
+      0xfb, 0x70, 0x1, 0x4b, 0xf7, 0x77, 0xf8, 0xc7, 0xef, 0x2d, 0xf8, 0x37,
+      0x4, 0x2a, 0xfa, 0x17, 0xa, 0xb7, 0x2, 0xf7, 0xf6, 0x44, 0x2, 0x16, 0xf5,
+      0x49, 0x7, 0x49, 0x2, 0xc4, 0x6, 0x63, 0x7, 0x39, 0xd, 0x49, 0x9, 0xb6,
+      0x2, 0x65, 0xfd, 0xb, 0x2, 0x15, 0x1, 0x9e, 0x3, 0x2a, 0x0, 0xc, 0x2,
+      0xe5, 0xff, 0x52, 0xa, 0x5d, 0x0, 0x7c, 0xfc, 0x26, 0xff, 0x18, 0x6, 0xd,
+      0xfc, 0x86, 0xf7, 0xf7, 0x8, 0x7a, 0x1, 0x7b, 0x0, 0x41, 0xf1, 0x56, 0xf0,
+      0x25, 0x3, 0xb9, 0xfd, 0x1a, 0xf8, 0xe8, 0x2, 0xf8, 0xfe, 0xb0, 0x4, 0xac,
+      0xfd, 0x1d, 0x5, 0x8f, 0x1, 0xbc, 0xfb, 0x7a, 0xfd, 0xaa, 0xfa, 0xf3,
+      0xff, 0x83, 0xfb, 0xca, 0x1, 0x23, 0xf9, 0xc2, 0xfd, 0xc5, 0xff, 0xa7,
+      0xfb, 0xbc, 0xf7, 0x50, 0x1, 0x6d, 0xfe, 0x2c, 0x0, 0x5e, 0x2, 0xbf, 0xfb,
+      0xc1, 0x4, 0x89, 0x10, 0xbf, 0x1f, 0x39, 0xfb, 0xe8, 0xf, 0x43, 0x14,
+      0x73, 0xf3, 0x8c, 0xf7, 0xc6, 0x5, 0x22, 0xf2, 0x77, 0x1, 0x24, 0xa, 0x12,
+      0x1, 0xfb, 0x11, 0xb, 0xf9, 0x6f, 0x7, 0x23, 0xfa, 0xee, 0x3, 0x6c, 0x2,
+      0xcd, 0xfc, 0xb3, 0x10, 0x34, 0xff, 0xaf, 0xfc, 0xf8, 0xfc, 0xa0, 0xf4,
+      0x17, 0xf8, 0x4d, 0xf7, 0x5, 0xfb, 0x6, 0x1, 0xdb, 0xfb, 0xb0, 0xfe, 0x45,
+      0xfb, 0xfe, 0x0, 0xda, 0xfd, 0x13, 0xff, 0xcd, 0xfc, 0x88, 0xfc, 0x4c,
+      0x5, 0x7b, 0xf, 0x8, 0xff, 0xc6, 0xf4, 0xd4, 0xf9, 0x7d, 0xfe, 0xe6, 0xef,
+      0x78, 0xfb, 0x9b, 0xea, 0xc7, 0xf2, 0xbc, 0xf7, 0xea, 0xee, 0xf5, 0x3,
+      0x59, 0xfd, 0xf4, 0xfb, 0x3c, 0xfa, 0x23, 0xfb, 0x49, 0xf8, 0x9f, 0xfb,
+      0x22, 0x0, 0x7a, 0x2, 0xee, 0x5, 0xe2, 0xfd, 0xb5, 0x5, 0x9c, 0x1, 0xe3,
+      0xfc, 0x4e, 0x1, 0xc1, 0xf7, 0x11, 0x3, 0xfb, 0xf5, 0xba, 0xff, 0x2, 0x3,
+      0xe0, 0x1, 0xa2, 0xff, 0x6e, 0x5, 0xd8, 0xfe, 0xbd, 0x3, 0xc5, 0xa, 0xe4,
+      0x3, 0x8a, 0xfa, 0x3e, 0x0, 0x25, 0x3, 0x3a, 0x6, 0xe, 0xfe, 0x8b, 0xef,
+      0x2, 0xfb, 0xa6, 0xfb, 0x8f, 0x4, 0x9, 0xf8, 0x50, 0x5, 0xe4, 0x4, 0xde,
+      0xef, 0x8d, 0xee, 0x35, 0x7, 0x7c, 0x1, 0xcc, 0xf7, 0xd7, 0xfe, 0x2b, 0x1,
+      0x96, 0xfd, 0xb5, 0x7, 0xd9, 0xf6, 0x31, 0xfa, 0xd5, 0x3, 0xbe, 0xfb,
+      0x62, 0x3, 0x73, 0x1, 0x54, 0x3, 0x69, 0xfe, 0x57, 0x1, 0x1f, 0x3, 0x36,
+      0xfd, 0xbd, 0x8, 0xc, 0x4, 0xb1, 0xfe, 0x72, 0x1, 0x58, 0x15, 0xbb, 0xf,
+      0x97, 0x3, 0xcd, 0x6, 0xce, 0x7, 0xb0, 0x15, 0xa9, 0x18, 0x7f, 0xa, 0x77,
+      0x10, 0xdd, 0xfc, 0xe3, 0xfa, 0xef, 0xf8, 0x52, 0x7, 0xa6, 0x8, 0x5c,
+      0xfa, 0x71, 0x2, 0x53, 0xf8, 0x23, 0xfd, 0xd7, 0xfe, 0x66, 0xf4, 0xf9,
+      0xf8, 0x15, 0xf5, 0xc1, 0xff, 0x20, 0xfe, 0xf9, 0xfc, 0x2f, 0xff, 0xf3,
+      0x4, 0x6c, 0x2, 0xc8, 0xfd, 0xc6, 0x2, 0x64, 0xfe, 0x9a, 0x2, 0x44, 0xff,
+      0x31, 0x2, 0x12, 0xa, 0xa9, 0xf3, 0xc1, 0xfc, 0x45, 0xfd, 0xcc, 0xf4,
+      0xea, 0xf8, 0x61, 0xfc, 0xb2, 0xf8, 0x71, 0x1, 0xee, 0xfe, 0xe9, 0x6,
+      0x94, 0xfe, 0x48, 0xfa, 0xe, 0x6, 0x10, 0x3, 0x24, 0x6, 0xac, 0x4, 0x61,
+      0xf9, 0xeb, 0x1, 0x7a, 0xfc, 0x56, 0x0, 0x80, 0xf4, 0xa6, 0xf9, 0xe7,
+      0xf7, 0xac, 0xfe, 0x17, 0xfc, 0xa4, 0xfb, 0xed, 0xfc, 0xa7, 0x8, 0xb,
+      0xff, 0x5f, 0x2, 0x1d, 0xfc, 0x5d, 0xff, 0x20, 0xff, 0x9f, 0xf8, 0x9a,
+      0x3, 0x10, 0x7, 0x9f, 0xfa, 0x0, 0xfd, 0x7a, 0x7, 0x85, 0xfb, 0x1a, 0xa,
+      0xe7, 0xfc, 0x8f, 0x0, 0x4d, 0xc, 0x63, 0xfb, 0x94, 0x15, 0x46, 0x2, 0xce,
+      0x8, 0x6c, 0x7, 0x73, 0xf3, 0xba, 0x0, 0x88, 0x4, 0x38, 0x2, 0xf9, 0xc,
+      0xce, 0xf6, 0xed, 0xfc, 0x4f, 0xfa, 0x61, 0x5, 0x2c, 0xf2, 0xe9, 0x3,
+      0x48, 0x2, 0xbf, 0xfd, 0xdc, 0x0, 0x13, 0x10, 0x39, 0xfb, 0xb9, 0xff,
+      0x7e, 0xf8, 0x38, 0xff, 0x0, 0x1, 0x2d, 0xf9, 0x62, 0x5, 0x93, 0xff, 0x12,
+      0xe, 0x2a, 0xff, 0x45, 0xf8, 0xd5, 0xd, 0xb9, 0x1, 0x81, 0xb, 0xcf, 0x10,
+      0x99, 0xc, 0xf8, 0x8, 0xe0, 0x2, 0x5b, 0x2, 0x1f, 0xfe, 0x70, 0xf9, 0x3,
+      0x10, 0xe4, 0x8, 0x67, 0xfc, 0xff, 0x4, 0xe4, 0x1, 0x9f, 0xfd, 0x44, 0xfc,
+      0x7, 0x0, 0x54, 0x3, 0xe7, 0x6, 0xb1, 0x9, 0xa5, 0x3, 0x60, 0x2, 0x55,
+      0x1, 0x81, 0xfb, 0xa, 0xff, 0xcb, 0xff, 0xde, 0x1, 0xa6, 0xfd, 0x3f, 0xff,
+      0x6d, 0x1, 0x7c, 0x8, 0x2d, 0xe, 0xf3, 0x6, 0xb6, 0xff, 0x8, 0xf6, 0x32,
+      0x8, 0x48, 0xf8, 0xd, 0xfa, 0x87, 0xfe, 0xe3, 0x1, 0x95, 0xfc, 0xd6, 0xfb,
+      0x3c, 0xfe, 0x48, 0x1, 0xb9, 0xfd, 0xb9, 0x7, 0xa5, 0xfc, 0x42, 0x3, 0xf1,
+      0x2, 0xdd, 0x0, 0x1b, 0xfd, 0x9a, 0x1, 0x50, 0x7, 0x1c, 0x2, 0x99, 0x6,
+      0x75, 0x5, 0x14, 0x2, 0xe3, 0x9, 0x84, 0xff, 0x16, 0xf9, 0x6e, 0x0, 0x51,
+      0x0, 0x1d, 0xff, 0xfb, 0xfe, 0xe3, 0xfa, 0x1f, 0x3, 0x3e, 0x1, 0xd3, 0xff,
+      0x46, 0xfe, 0x4d, 0xb, 0xb3, 0x7, 0xa4, 0x2, 0x9, 0xfd, 0x47, 0xf4, 0x6b,
+      0x9, 0x58, 0xb, 0xed, 0xf2, 0x35, 0x0, 0x33, 0xfb, 0x9c, 0x8, 0xec, 0xf5,
+      0xdc, 0x2, 0xba, 0x6, 0xcf, 0xf5, 0x74, 0x4, 0xd0, 0xf9, 0x41, 0xfa, 0x2a,
+      0x7, 0xbf, 0x6, 0x4f, 0x0, 0x9, 0xff, 0xf3, 0x3, 0x75, 0xfd, 0xb6, 0x8,
+      0x9e, 0x2, 0x1a, 0xf9, 0x6a, 0x1, 0x6, 0xfb, 0x97, 0x1, 0x16, 0x2, 0x66,
+      0x5, 0x70, 0xfd, 0xc, 0x0, 0x1b, 0x0, 0x46, 0xfd, 0x94, 0xf3, 0x54, 0xf8,
+      0x84, 0xfb, 0x85, 0xfe, 0x28, 0x8, 0xcc, 0x1, 0xb7, 0x1, 0xdc, 0x7, 0xeb,
+      0xfa, 0x1d, 0xfb, 0xd5, 0xfc, 0xd1, 0x5, 0xa9, 0x4, 0xae, 0x4, 0x32, 0x4,
+      0xfe, 0xf8, 0xbb, 0xf6, 0xd8, 0x3, 0x69, 0xfc, 0xa9, 0xff, 0x98, 0xfb,
+      0x89, 0x5, 0x25, 0xff, 0x82, 0xfd, 0xc1, 0x3, 0x4b, 0xff, 0xd3, 0xf7,
+      0x36, 0x3, 0x5c, 0x2, 0x3b, 0x2, 0xff, 0x5, 0x76, 0x2, 0x45, 0x4, 0xd,
+      0x1, 0x31, 0xfb, 0xd4, 0xff, 0xa4, 0xf7, 0xe2, 0xf5, 0xc6, 0xfb, 0x56,
+      0x8, 0x7c, 0x2, 0x4c, 0x7, 0x27, 0x0, 0xc3, 0x8, 0xc2, 0xff, 0xc8, 0x5,
+      0x43, 0x0, 0x30, 0x4, 0x13, 0xfe, 0xfb, 0xf5, 0xb, 0x4, 0xb1, 0xfe, 0xc8,
+      0x4, 0x3b, 0x5, 0x7d, 0xf7, 0x3d, 0x3, 0x85, 0xfe, 0x53, 0x5, 0xa1, 0xfe,
+      0x2c, 0x2, 0x18, 0x1, 0x38, 0xfc, 0xe7, 0xfe, 0x14, 0xff, 0x33, 0x7, 0x29,
+      0xfe, 0xcb, 0x1, 0x0, 0xff, 0x21, 0x6, 0xb6, 0xff, 0x5e, 0xf4, 0xac, 0x3,
+      0x90, 0x7, 0xe2, 0xfe, 0x23, 0xfa, 0xb6, 0x8, 0x16, 0xfb, 0x1e, 0xf, 0xad,
+      0xfe, 0xc3, 0xf6, 0xb2, 0xfd, 0xfd, 0x12, 0xf5, 0xfc, 0x32, 0xfe, 0x1f,
+      0x3, 0x61, 0xfa, 0x80, 0xfb, 0xad, 0x3, 0x0, 0xa, 0x25, 0xb, 0xf3, 0x2,
+      0xe2, 0x3, 0xff, 0xfe, 0xb, 0x9, 0x3e, 0x0, 0x89, 0xfc, 0xdb, 0xff, 0xbc,
+      0xfe, 0x73, 0x1, 0x84, 0xfd, 0x47, 0xff, 0x4b, 0x3, 0x3, 0xfe, 0x3c, 0xfc,
+      0x6c, 0x3, 0xe4, 0xfe, 0xf, 0xfc, 0xc5, 0x2, 0x86, 0xfd, 0xb5, 0x5, 0x78,
+      0x1, 0x0, 0xa, 0xfb, 0x1, 0x2a, 0xa, 0xee, 0x6, 0x65, 0xff, 0xa9, 0x7,
+      0x5a, 0x8, 0x63, 0xfe, 0xc6, 0x6, 0x4a, 0xf7, 0x37, 0xfd, 0x22, 0x5, 0xe0,
+      0xfb, 0x4c, 0x7, 0xef, 0x6, 0x68, 0x5, 0x31, 0xff, 0x87, 0xff, 0x65, 0x5,
+      0xe, 0x2, 0x48, 0xff, 0xee, 0xfd, 0xdb, 0x0, 0x63, 0x4, 0x4d, 0xff, 0xca,
+      0xfc, 0x33, 0x2, 0xaf, 0xfe, 0xca, 0xfd, 0x8b, 0x0, 0x78, 0xfe, 0xd9,
+      0xf9, 0xd0, 0x2, 0x25, 0xfc, 0x71, 0x0, 0x4d, 0x5, 0x6b, 0x2, 0xec, 0xff,
+      0x26, 0x6, 0x61, 0xfd, 0xe8, 0x3, 0x1a, 0x0, 0x45, 0xff, 0xb7, 0x2, 0x45,
+      0x1, 0xaa, 0xfb, 0xde, 0xfe, 0x5e, 0x1, 0x81, 0xfd, 0xcf, 0x1, 0x81, 0x2,
+      0x92, 0x4, 0xba, 0x5, 0xf9, 0xff, 0xa2, 0x5, 0x45, 0x1, 0x7a, 0x2, 0xf6,
+      0xfc, 0x98, 0x3, 0x88, 0x2, 0xce, 0x0, 0x58, 0x0, 0xe3, 0xfe, 0xe0, 0x0,
+      0xaa, 0x0, 0x74, 0xfe, 0xac, 0xff, 0xfa, 0xfa, 0x3, 0xff, 0xad, 0x2, 0x41,
+      0x3, 0x5b, 0xff, 0xdb, 0xfe, 0xe3, 0xfc, 0xbf, 0x0, 0xb7, 0xf6, 0x84,
+      0xfb, 0x5e, 0xfe, 0xe0, 0xf9, 0xc2, 0xfd, 0x51, 0xfe, 0x21, 0xfe, 0xe1,
+      0xfe, 0x70, 0xfe, 0xd6, 0x1, 0xa, 0xfd, 0xbf, 0xff, 0x61, 0x0, 0x50, 0x2,
+      0x7f, 0x2, 0xfa, 0x3, 0x14, 0xff, 0xe5, 0xfe, 0x41, 0xfe, 0xf9, 0x2, 0x14,
+      0x3, 0xbd, 0x1, 0x97, 0xff, 0x30, 0xfd, 0x7e, 0xff, 0x9f, 0x0, 0x60, 0xfd,
+      0xe, 0xfe, 0x6b, 0xfb, 0x9d, 0xf9, 0xb7, 0x3, 0x2a, 0x1, 0xf8, 0x1, 0xff,
+      0xfc, 0x38, 0x5, 0xa, 0x5, 0xc7, 0xfd, 0x48, 0x4, 0xf0, 0xff, 0x8a, 0xf2,
+      0x44, 0xfe, 0x9d, 0xfc, 0xca, 0x0, 0xa, 0x1, 0x47, 0xfe, 0xeb, 0xff, 0x80,
+      0xf7, 0x9b, 0xf6, 0x35, 0xfc, 0x54, 0x2, 0x18, 0x3, 0xaf, 0xff, 0xee,
+      0xfd, 0x13, 0x2, 0xb5, 0xfc, 0x2b, 0xff, 0x9b, 0x0, 0x34, 0x2, 0xa6, 0xfd,
+      0x34, 0x0, 0x85, 0xfd, 0x9a, 0x4, 0x67, 0xfc, 0xf4, 0xff, 0x9f, 0xfa,
+      0xbf, 0xfa, 0x6e, 0xfc, 0x77, 0xf7, 0x96, 0xfe, 0x5f, 0xfc, 0xc6, 0x2,
+      0xf8, 0x3, 0x43, 0xf6, 0x7, 0x4, 0x46, 0xf9, 0xa1, 0xff, 0x33, 0xff, 0xbf,
+      0xfe, 0x92, 0x4, 0xa6, 0x0, 0x7c, 0x0, 0x47, 0xfc, 0x89, 0xfc, 0x50, 0xfd,
+      0xc, 0xfe, 0x58, 0x5, 0x8c, 0xfe, 0x96, 0xff, 0x5b, 0xfa, 0x7a, 0x0, 0xa4,
+      0xfc, 0x67, 0xfd, 0x67, 0x1, 0xa4, 0x0, 0xac, 0x0, 0x23, 0x1, 0x36, 0x0,
+      0xf9, 0xff, 0x3, 0xff, 0xa5, 0xff, 0x42, 0xf8, 0xa6, 0xff, 0x4d, 0x0,
+      0xe4, 0x3, 0x5f, 0xfd, 0xbe, 0x5, 0x9c, 0xfb, 0xeb, 0x2, 0xa8, 0xfe, 0x3c,
+      0xff, 0x34, 0x0, 0x60, 0x5, 0x22, 0x2, 0xf8, 0xff, 0x82, 0xfa, 0x47, 0x1,
+      0xdd, 0xfa, 0x8b, 0x0, 0x56, 0x4, 0x6a, 0x1, 0x8, 0xfe, 0xae, 0xff, 0x78,
+      0xfe, 0xd2, 0xf9, 0xb1, 0xfb, 0x1e, 0xff, 0x7a, 0xff, 0x8e, 0xfe, 0x61,
+      0x1, 0xc9, 0xfe, 0x55, 0xfd, 0x99, 0xff, 0xd5, 0xfe, 0xd0, 0xff, 0x59,
+      0xfe, 0xeb, 0xff, 0xf2, 0xf8, 0xce, 0x4, 0xf5, 0x0, 0x43, 0x0, 0x82, 0xfc,
+      0xdd, 0x4, 0x23, 0x3, 0x5a, 0x3, 0xa9, 0xfa, 0xf1, 0x0, 0xb5, 0xfc, 0xe6,
+      0x0, 0xae, 0xfe, 0xd, 0x6, 0x6, 0x1, 0x4a, 0x0, 0xf6, 0xff, 0x67, 0x0,
+      0x31, 0x3, 0xd, 0x4, 0xb, 0x0, 0xec, 0xfd, 0x7d, 0xff, 0x6b, 0xfd, 0x9c,
+      0xfc, 0x88, 0xff, 0xf, 0xff, 0x72, 0x0, 0x4a, 0xfe, 0x39, 0xff, 0x41,
+      0xfd, 0x94, 0xff, 0xa3, 0xff, 0xb1, 0xff, 0x94, 0x0, 0x49, 0x1, 0x32,
+      0xfb, 0xc2, 0x4, 0xa, 0xff, 0x97, 0x0, 0x3c, 0xff, 0xf2, 0x7, 0x6, 0xfe,
+      0x99, 0x3, 0xac, 0xfb, 0xde, 0xfd, 0x2, 0x0, 0x2c, 0x3, 0xf5, 0x0, 0x84,
+      0xfe, 0xe5, 0xfe, 0xa5, 0xfc, 0x11, 0x4, 0xe6, 0x0, 0xbd, 0x0, 0x23, 0x3,
+      0xa8, 0x3, 0xcd, 0xfa, 0xd4, 0x0, 0x4d, 0xff, 0x3e, 0xfe, 0x17, 0x0, 0x3e,
+      0xff, 0x26, 0x1, 0x16, 0x0, 0xa4, 0xfd, 0x88, 0x1, 0x4b, 0xfd, 0x8a, 0x0,
+      0xd7, 0xfd, 0xc4, 0xff, 0xcf, 0xfe, 0xce, 0xfc, 0xef, 0x1, 0x13, 0x2,
+      0x18, 0x2, 0x1e, 0x1, 0xef, 0x1, 0x8, 0xfd, 0xcd, 0xfe, 0xa0, 0xfe, 0xbf,
+      0xfd, 0xd0, 0xfc, 0x1f, 0x0, 0x31, 0x1, 0xfd, 0xf8, 0x2c, 0xfe, 0x96, 0x1,
+      0xda, 0xfe, 0x6e, 0x1, 0xc7, 0xfb, 0x4d, 0x0, 0xb8, 0x2, 0x53, 0xfc, 0x3f,
+      0x0, 0xac, 0xfe, 0xe2, 0xff, 0xe5, 0x0, 0x8b, 0x0, 0xc3, 0x0, 0x7e, 0xfd,
+      0x34, 0xfe, 0x46, 0x0, 0x81, 0xff, 0x69, 0xfe, 0x14, 0x0, 0x90, 0xfe,
+      0x91, 0xfe, 0xa1, 0xfe, 0xaf, 0xfe, 0xea, 0xfd, 0x9e, 0xfd, 0xfc, 0x1,
+      0xab, 0xfc, 0x73, 0x4, 0x8f, 0xfd, 0x87, 0xfa, 0x25, 0x0, 0x78, 0xfb,
+      0x6c, 0xf8, 0x34, 0xfe, 0xe2, 0x0, 0xd, 0x3, 0xe1, 0x3, 0x62, 0x2, 0xd2,
+      0xfc, 0x12, 0xfb, 0x8e, 0xfe, 0x54, 0xff, 0x6a, 0xfe, 0x86, 0xff, 0xd7,
+      0xff, 0x2a, 0x1, 0x2e, 0xff, 0xcb, 0x0, 0xc3, 0x0, 0x92, 0xfb, 0x17, 0x0,
+      0xc8, 0x1, 0x8b, 0xfe, 0xe0, 0xff, 0xb7, 0xff, 0xfa, 0x0, 0x1a, 0xfd,
+      0x79, 0xfc, 0xba, 0xfb, 0x35, 0xff, 0xe7, 0x2, 0x4b, 0x2, 0x9c, 0xfe,
+      0xb4, 0xff, 0x7, 0xfe, 0x5d, 0xff, 0x9c, 0x3, 0x86, 0xfe, 0x85, 0xfa,
+      0x5b, 0x0, 0xd9, 0xfe, 0x26, 0x1, 0x7, 0x1, 0x80, 0xfe, 0x1d, 0xff, 0x39,
+      0xfc, 0xfb, 0xfb, 0xe, 0x0, 0x9f, 0x0, 0x38, 0x0, 0xa, 0xfe, 0x7d, 0x1,
+      0xe0, 0x0, 0xe9, 0x1, 0x4b, 0xff, 0x56, 0xfb, 0x71, 0xff, 0x48, 0x1, 0x6e,
+      0xff, 0x3, 0x0, 0xca, 0x0, 0x2, 0x0, 0xb3, 0xfd, 0x8f, 0xfb, 0x52, 0xfe,
+      0xa2, 0xff, 0xd0, 0x0, 0x27, 0xfd, 0x98, 0xfe, 0x6f, 0x1, 0xcb, 0xfd, 0xe,
+      0xfe, 0x9a, 0x0, 0xec, 0xfd, 0x14, 0x0, 0x70, 0xfd, 0x13, 0x2, 0xd0, 0x1,
+      0x98, 0xfe, 0x25, 0xfe, 0xf6, 0x0, 0x6, 0x0, 0xb9, 0x0, 0x6c, 0xfe, 0x81,
+      0x1, 0xeb, 0xfe, 0x53, 0xfe, 0xb2, 0x0, 0xbb, 0xff, 0xc9, 0x0, 0x61, 0xfe,
+      0x94, 0xfe, 0xb3, 0xff, 0x58, 0x0, 0x59, 0x1, 0xd8, 0xff, 0xe6, 0xff,
+      0xef, 0x0, 0x2c, 0xff, 0x2b, 0xfb, 0xf8, 0xff, 0xdd, 0xff, 0xb6, 0x1,
+      0xab, 0x0, 0x33, 0x1, 0x93, 0xff, 0x76, 0x0, 0x8d, 0x2, 0xf6, 0xfd, 0xc0,
+      0x2, 0xa0, 0x0, 0xd7, 0x1, 0x5b, 0x2, 0x10, 0xfe, 0x63, 0xff, 0x8c, 0xfe,
+      0x53, 0x2, 0x50, 0x3, 0xfd, 0x0, 0xa4, 0xfd, 0xf7, 0xff, 0xf1, 0xff, 0xa2,
+      0xfc, 0xe7, 0x2, 0x1f, 0xff, 0x4, 0xff, 0x2c, 0xff, 0x7e, 0x0, 0x62, 0xff,
+      0x22, 0xff, 0x7b, 0x0, 0xbf, 0x0, 0x6f, 0xff, 0xca, 0x0, 0x63, 0xff, 0x24,
+      0xfa, 0x59, 0x1, 0x94, 0x0, 0x18, 0xfe, 0x4c, 0x1, 0xc1, 0x0, 0xd3, 0xfc,
+      0xf6, 0xfd, 0xeb, 0xfe, 0x97, 0xff, 0x18, 0x0, 0xd4, 0x4, 0xa8, 0x0, 0xdb,
+      0x0, 0xcc, 0xfd, 0x35, 0xfe, 0xac, 0xff, 0x22, 0x1, 0xe2, 0x1, 0xad, 0x3,
+      0x7f, 0x1, 0x5c, 0xff, 0xee, 0x0, 0x1d, 0xfe, 0xb7, 0x1, 0xea, 0xff, 0x79,
+      0xfe, 0x7a, 0xff, 0x4a, 0x2, 0xea, 0xfe, 0x31, 0xff, 0x6b, 0x1, 0x62, 0x1,
+      0x3a, 0xfe, 0xa1, 0x2, 0x40, 0x0, 0xbe, 0xfa, 0xb8, 0x2, 0x8e, 0xff, 0x47,
+      0xff, 0x90, 0x0, 0xe7, 0x2, 0x95, 0xff, 0xd5, 0xfe, 0x89, 0x0, 0x59, 0xff,
+      0x36, 0x2, 0x69, 0x2, 0x9f, 0xfe, 0x3, 0xff, 0xe2, 0xfe, 0x3a, 0xff, 0xfe,
+      0x0, 0xf4, 0xff, 0xc5, 0x0, 0x3, 0x2, 0x6c, 0x1, 0x5d, 0xfc, 0xa4, 0x0,
+      0xae, 0xfe, 0xcf, 0x2, 0x90, 0xff, 0xe2, 0xff, 0x30, 0x1, 0x81, 0x3, 0x5f,
+      0xff, 0xf3, 0x0, 0x95, 0xff, 0xdb, 0x0, 0x1c, 0xfe, 0x31, 0x1, 0x24, 0xff,
+      0xa4, 0xfc, 0xef, 0xff, 0x78, 0x0, 0x9b, 0x0, 0x40, 0x0, 0x54, 0xfe, 0x21,
+      0x1, 0x60, 0xfb, 0x7, 0x2, 0xb0, 0x0, 0xfd, 0xfe, 0xb9, 0xfc, 0x5d, 0xff,
+      0xb7, 0xff, 0x5c, 0x1, 0xb4, 0x0, 0x67, 0x0, 0x50, 0xff, 0x33, 0xff, 0xc5,
+      0xfe, 0xba, 0x0, 0xd6, 0xfd, 0xbd, 0xff, 0x53, 0x0, 0xf6, 0x1, 0xa0, 0x0,
+      0xf5, 0x1, 0xe3, 0x0, 0x9b, 0x1, 0x37, 0x0, 0x27, 0x1, 0xbc, 0xff, 0x59,
+      0x0, 0xc4, 0xff, 0xc5, 0xff, 0x94, 0xfe, 0x19, 0xfc, 0xf4, 0xfd, 0xf0,
+      0xff, 0x3f, 0xfe, 0x8a, 0x0, 0xd8, 0xfd, 0x87, 0x2, 0xef, 0xfb, 0xd8,
+      0xfe, 0x35, 0x0, 0x64, 0xfe, 0xc3, 0xfc, 0xd8, 0xfd, 0x87, 0xff, 0x74,
+      0x1, 0x63, 0x0, 0x59, 0x1, 0x33, 0xfe, 0xe0, 0xff, 0x61, 0xfe, 0x55, 0xff,
+      0x8d, 0xfe, 0xd0, 0xfe, 0xd7, 0x0, 0x22, 0x0, 0x3c, 0x0, 0xe5, 0x1, 0x38,
+      0x0, 0x39, 0x2, 0x77, 0x0, 0x23, 0x2, 0x2a, 0xff, 0x9, 0x0, 0x85, 0x0,
+      0x49, 0x0, 0x91, 0xfd, 0x69, 0xfd, 0x8d, 0xfd, 0x6f, 0xff, 0xd2, 0xff,
+      0x2, 0x0, 0xcb, 0xfe, 0x11, 0x0, 0x34, 0xfd, 0xa, 0x2, 0xb5, 0x0, 0xa,
+      0x0, 0xef, 0xfc, 0x28, 0x0, 0xbc, 0xfe, 0x7c, 0xff, 0x92, 0x2, 0x68, 0xff,
+      0x1, 0x1, 0x5f, 0xff, 0xbe, 0xfc, 0x45, 0xff, 0xcd, 0xff, 0x98, 0xff,
+      0x43, 0xfe, 0x4, 0x1, 0xb8, 0x0, 0xcb, 0x1, 0xac, 0xff, 0xbf, 0x0, 0x58,
+      0x0, 0xb4, 0xff, 0x25, 0x0, 0x95, 0xff, 0x59, 0x2, 0x25, 0xfe, 0x2, 0xfe,
+      0xbe, 0xfd, 0xc1, 0xff, 0xd5, 0xfe, 0x36, 0xfe, 0xe4, 0xfd, 0x16, 0xfe,
+      0xcd, 0x0, 0x81, 0xfd, 0xb9, 0xff, 0xe1, 0xff, 0xeb, 0xfe, 0x24, 0xff,
+      0xeb, 0xff, 0xfc, 0x1, 0x62, 0x0, 0x74, 0xff, 0x96, 0x0, 0x76, 0x0, 0xbc,
+      0x1, 0xd2, 0xff, 0xf8, 0xfe, 0xe3, 0x0, 0x2c, 0x0, 0x4f, 0x1, 0x79, 0xff,
+      0xdd, 0xff, 0x4f, 0x0, 0xf1, 0xfe, 0xa3, 0x1, 0x5d, 0x0, 0x28, 0xff, 0xa1,
+      0x0, 0x95, 0x0, 0x35, 0x1, 0xbe, 0x0, 0x67, 0xff, 0x8, 0xfd, 0xda, 0x0,
+      0x1e, 0x0, 0x5f, 0x2, 0xa9, 0xff, 0xce, 0x1, 0xe6, 0xfe, 0x8b, 0x0, 0xa1,
+      0x2, 0x25, 0xff, 0x92, 0x1, 0xb1, 0x1, 0xd1, 0x1, 0xfa, 0xfe, 0xff, 0xfe,
+      0xfa, 0xfe, 0x4e, 0xff, 0x33, 0x1, 0x7f, 0x2, 0xea, 0xfe, 0xe5, 0xfe,
+      0xe4, 0xff, 0xb7, 0x0, 0x3a, 0x0, 0xa2, 0xff, 0xbd, 0xff, 0x19, 0xff,
+      0xa3, 0xff, 0x2a, 0x1, 0xc5, 0xff, 0x93, 0xfe, 0xf, 0x0, 0xfb, 0xff, 0x2c,
+      0x0, 0xe7, 0xff, 0xd4, 0xfe, 0xd, 0xfe, 0xf5, 0x0, 0x9, 0x0, 0x73, 0x1,
+      0xae, 0xfe, 0x99, 0x1, 0x1c, 0xfe, 0x54, 0xff, 0x88, 0x0, 0xed, 0xff,
+      0x5d, 0x0, 0x21, 0x3, 0xdc, 0xff, 0x57, 0x0, 0x77, 0xff, 0x78, 0xfe, 0xb5,
+      0x0, 0xb2, 0x0, 0x44, 0x0, 0xf7, 0x0, 0xa, 0x1, 0x8c, 0xff, 0xb4, 0x0,
+      0xa1, 0x0, 0xed, 0xfe, 0xdb, 0xff, 0x46, 0xff, 0x74, 0xff, 0xe1, 0x0,
+      0x66, 0xff, 0xd8, 0xfe, 0x3a, 0x1, 0xa, 0x0, 0x54, 0xff, 0x13, 0x0, 0x7a,
+      0xfe, 0x10, 0xfd, 0x15, 0x1, 0x12, 0x0, 0x1f, 0x1, 0x96, 0x1, 0x5a, 0x1,
+      0x45, 0x1, 0x61, 0x1, 0x35, 0x0, 0x94, 0xff, 0xf9, 0x0, 0x29, 0x0, 0xe3,
+      0xff, 0xda, 0xfe, 0xc1, 0xff, 0x31, 0xff, 0x75, 0x0, 0x69, 0xff, 0x96,
+      0x0, 0x4b, 0x1, 0xa8, 0xff, 0x3c, 0xff, 0x11, 0x0, 0x4f, 0x2, 0xcf, 0xff,
+      0x42, 0xff, 0x5d, 0x0, 0xc9, 0x0, 0x99, 0x0, 0x62, 0xff, 0x9f, 0x0, 0x66,
+      0xff, 0x72, 0x0, 0x8d, 0xff, 0x3a, 0x0, 0x54, 0xfe, 0x99, 0xfe, 0x8a,
+      0xff, 0xb5, 0x0, 0x2f, 0x0, 0x8, 0x1, 0x51, 0xfe, 0xc1, 0x0, 0xf0, 0xfd,
+      0x14, 0x1, 0x11, 0x0, 0x32, 0xff, 0x67, 0xfe, 0x8d, 0xff, 0x33, 0xff,
+      0x24, 0x0, 0xcc, 0x1, 0xce, 0xff, 0x40, 0xff, 0xf7, 0xfe, 0x9c, 0x0, 0x65,
+      0x0, 0xa4, 0x0, 0xb8, 0xff, 0x0, 0x1, 0xe6, 0xff, 0x52, 0x0, 0xfa, 0x0,
+      0xca, 0x0, 0xb7, 0xfe, 0xd1, 0xff, 0x44, 0x0, 0xf9, 0xff, 0x10, 0x0, 0x40,
+      0x0, 0x3d, 0xff, 0x7b, 0xfe, 0x3f, 0xfe, 0xd0, 0xfe, 0xc4, 0x0, 0x5d,
+      0xfe, 0x6c, 0x0, 0x43, 0xfe, 0x51, 0x1, 0x36, 0xfd, 0x9d, 0x0, 0x6, 0x0,
+      0x1d, 0x1, 0x8a, 0xfe, 0xf8, 0xfd, 0x97, 0xff, 0xe3, 0xff, 0xed, 0x0,
+      0xed, 0x0, 0xd3, 0xfe, 0x23, 0xff, 0xde, 0x0, 0x11, 0x0, 0xfa, 0x0, 0xe9,
+      0xff, 0x2d, 0x1, 0x27, 0xff, 0x48, 0x0, 0x4, 0x0, 0xfc, 0xff, 0x52, 0xff,
+      0xf, 0x0, 0x19, 0x1, 0x7c, 0xff, 0xe0, 0xff, 0x6c, 0x0, 0x2f, 0x0, 0x4e,
+      0xfe, 0x63, 0xfe, 0x63, 0xfe, 0x4c, 0x0, 0xb6, 0xff, 0xa6, 0x0, 0x5, 0xfe,
+      0x68, 0x0, 0x7e, 0xfc, 0x11, 0x2, 0x88, 0x0, 0x34, 0x1, 0x48, 0xfe, 0x1b,
+      0x1, 0x50, 0xff, 0x12, 0x0, 0x92, 0x1, 0xdb, 0xfe, 0xd6, 0x0, 0xbf, 0xff,
+      0x53, 0xff, 0x1b, 0xff, 0xd5, 0x2, 0xcd, 0xff, 0xa1, 0x0, 0x4b, 0xff,
+      0x37, 0x0, 0xd6, 0xff, 0xa2, 0xff, 0x12, 0xfe, 0x54, 0x0, 0xde, 0xff,
+      0xb3, 0xff, 0x69, 0xff, 0xd, 0x1, 0x91, 0xfe, 0xd9, 0xfe, 0x8, 0xff, 0xa0,
+      0xff, 0x69, 0xff, 0xd6, 0xfe, 0xf3, 0xfd, 0x5a, 0xff, 0x97, 0xff, 0xa7,
+      0xfd, 0x47, 0x0, 0x11, 0xff, 0xb, 0x1, 0xb9, 0x0, 0x42, 0x0, 0x78, 0x1,
+      0x31, 0x0, 0xcf, 0xff, 0x4f, 0x0, 0x96, 0x0, 0x2c, 0x1, 0x3, 0x1, 0x12,
+      0x0, 0x20, 0x2, 0xe1, 0xff, 0x37, 0x1, 0xb3, 0xfe, 0x97, 0xff, 0xe5, 0xfe,
+      0x5f, 0xff, 0x57, 0xff, 0x4f, 0x0, 0xf9, 0xff, 0xa0, 0x0, 0x2e, 0x0, 0x1f,
+      0x0, 0x50, 0x0, 0xf, 0xff, 0xdf, 0xfd, 0x34, 0x0, 0xaa, 0x0, 0x97, 0x1,
+      0xf6, 0xff, 0x8c, 0x0, 0x2b, 0xff, 0xd5, 0x0, 0x39, 0x2, 0xa6, 0xff, 0x7b,
+      0x1, 0x3a, 0x1, 0x1, 0x1, 0x1f, 0xff, 0x40, 0xff, 0xe3, 0xff, 0xb5, 0xff,
+      0x13, 0x1, 0x8, 0x1, 0xa7, 0x0, 0xb2, 0xff, 0x37, 0x1, 0x15, 0x0, 0xf8,
+      0xff, 0xab, 0xff, 0xd7, 0xff, 0x7c, 0xfe, 0xfb, 0xff, 0x4d, 0xff, 0xa7,
+      0xff, 0xad, 0xff, 0x16, 0x0, 0x4a, 0x0, 0xa8, 0xff, 0x5a, 0x0, 0x72, 0xfe,
+      0x1, 0xfe, 0x82, 0x0, 0x63, 0x0, 0x4f, 0x0, 0x58, 0x0, 0x8e, 0xff, 0x6f,
+      0xff, 0x96, 0xfe, 0x79, 0x0, 0x4d, 0x0, 0xec, 0xff, 0x93, 0x1, 0xf4, 0xff,
+      0x1f, 0x1, 0xbd, 0x0, 0x49, 0xff, 0x54, 0x0, 0x37, 0x0, 0x5f, 0x0, 0xb7,
+      0x1, 0xe9, 0x0, 0xdd, 0x0, 0xc8, 0xff, 0xf0, 0xff, 0x5f, 0xff, 0xc6, 0xff,
+      0x9a, 0xfe, 0x4, 0x0, 0x22, 0xff, 0x74, 0xff, 0xc8, 0xff, 0x86, 0x0, 0x63,
+      0x0, 0xfe, 0xfe, 0x8e, 0x0, 0xb7, 0xfe, 0x5c, 0xfd, 0x51, 0x0, 0x95, 0x0,
+      0x93, 0x0, 0x3a, 0x1, 0xf8, 0x0, 0xb1, 0x0, 0x1a, 0x0, 0xc3, 0x0, 0xad,
+      0xff, 0x91, 0x1, 0x39, 0x0, 0x95, 0xff, 0x73, 0xff, 0xfc, 0xff, 0x4b,
+      0xff, 0x87, 0x0, 0x57, 0xff, 0x19, 0x0, 0xfc, 0x0, 0xff, 0xff, 0xa3, 0xff,
+      0x4d, 0x0, 0x3c, 0x0, 0xc, 0x0, 0xb4, 0xff, 0x4f, 0xff, 0x7a, 0x0, 0x7e,
+      0xff, 0x97, 0xff, 0xf9, 0x0, 0xa7, 0xff, 0x42, 0x0, 0xe6, 0xff, 0x1c, 0x1,
+      0x66, 0xfe, 0x50, 0xfe, 0x59, 0xff, 0x69, 0x0, 0xc7, 0xff, 0x37, 0x0,
+      0x3a, 0xfe, 0x13, 0x0, 0x37, 0xfe, 0xef, 0xff, 0x84, 0x0, 0x77, 0xff, 0xe,
+      0xff, 0xa7, 0xff, 0xb6, 0xff, 0x99, 0xff, 0x94, 0x0, 0x76, 0x0, 0xb6,
+      0xff, 0x93, 0xfe, 0xa8, 0x0, 0xcf, 0xff, 0xbb, 0x0, 0xc2, 0xff, 0xd5,
+      0xff, 0x4d, 0x0, 0x66, 0x0, 0x4e, 0x0, 0xd7, 0xff, 0x35, 0xff, 0xdd, 0xff,
+      0x91, 0x0, 0xf, 0x0, 0x17, 0x0, 0x5a, 0x0, 0x27, 0x0, 0x71, 0xfe, 0x36,
+      0xff, 0x52, 0xff, 0x2f, 0x0, 0x0, 0xff, 0xc0, 0xff, 0xd0, 0xff, 0x57, 0x0,
+      0x66, 0xff, 0x32, 0xff, 0x38, 0xff, 0x94, 0x0, 0xb, 0xff, 0x15, 0xff,
+      0x54, 0xff, 0xfa, 0xff, 0xc5, 0xff, 0x36, 0x0, 0x97, 0xff, 0x92, 0xff,
+      0xe8, 0xff, 0xe5, 0xff, 0x1f, 0x0, 0x88, 0xff, 0x47, 0x0, 0xc, 0x0, 0xd,
+      0x0, 0x43, 0x0, 0x3, 0x0, 0xff, 0xff, 0x19, 0x0, 0xfd, 0x0, 0xeb, 0xff,
+      0x13, 0x0, 0x3b, 0x0, 0x17, 0x0, 0x97, 0xfe, 0x3f, 0x0, 0xd9, 0xfe, 0xff,
+      0xff, 0x59, 0x0, 0x6b, 0xff, 0x3e, 0x0, 0x52, 0x0, 0xf2, 0xff, 0x22, 0x0,
+      0x16, 0x0, 0xb4, 0xff, 0xc0, 0xfe, 0x4e, 0x0, 0xd, 0xff, 0x24, 0x0, 0x3b,
+      0x0, 0x11, 0xff, 0x81, 0x0, 0xeb, 0xff, 0x25, 0xff, 0x56, 0xff, 0x87, 0x0,
+      0xfc, 0xff, 0x21, 0xff, 0xf1, 0xff, 0x6a, 0x0, 0x81, 0x0, 0xea, 0xff,
+      0x53, 0xff, 0x59, 0x0, 0x3, 0x0, 0x70, 0x0, 0xa2, 0xff, 0x75, 0x0, 0x36,
+      0xff, 0xab, 0xfe, 0xb, 0x0, 0x8d, 0xff, 0x75, 0xff, 0x79, 0xff, 0x99,
+      0xfe, 0x1c, 0x0, 0xd0, 0xff, 0xd, 0x0, 0xf6, 0xfe, 0x6f, 0x0, 0xa9, 0xff,
+      0x39, 0x0, 0xf7, 0xff, 0xf4, 0x0, 0x70, 0x0, 0x7c, 0xff, 0xf9, 0xff, 0x34,
+      0x0, 0x25, 0x1, 0x7a, 0x0, 0x3a, 0x0, 0x8, 0x0, 0xa7, 0xff, 0xae, 0xff,
+      0xd4, 0xff, 0xd0, 0xff, 0xe7, 0xff, 0x8e, 0xff, 0x79, 0x0, 0xed, 0xff,
+      0xd2, 0xff, 0x9c, 0x0, 0x1f, 0x0, 0x72, 0xff, 0xe, 0x0, 0xcf, 0xfe, 0x2a,
+      0xff, 0x59, 0x0, 0x51, 0x0, 0xec, 0x0, 0x7a, 0x0, 0x2, 0x1, 0x8c, 0xff,
+      0xd2, 0x0, 0x93, 0x0, 0x26, 0x0, 0xc7, 0xff, 0x50, 0x0, 0xdb, 0x0, 0x76,
+      0xff, 0xfe, 0xff, 0xb1, 0xff, 0x4e, 0xff, 0x8b, 0x0, 0xaa, 0x0, 0xbd,
+      0xff, 0xa6, 0xff, 0xa6, 0xff, 0x4e, 0x0, 0xa1, 0xff, 0x84, 0x0, 0xc9,
+      0xff, 0x99, 0xff, 0x2f, 0x0, 0x59, 0x0, 0xa7, 0xff, 0xab, 0xff, 0x41, 0x0,
+      0xca, 0xff, 0x8a, 0xff, 0xae, 0xff, 0x95, 0xfe, 0x23, 0xff, 0xbe, 0x0,
+      0x3a, 0x0, 0x87, 0xff, 0x75, 0x0, 0xb8, 0xff, 0xbc, 0xff, 0x64, 0xff,
+      0x2b, 0xff, 0x61, 0x0, 0xc4, 0xfe, 0x5a, 0x0, 0xdb, 0xff, 0xfb, 0x0, 0x35,
+      0x0, 0x75, 0xff, 0xc5, 0x0, 0xef, 0xff, 0x64, 0x0, 0xf7, 0x0, 0x33, 0x0,
+      0xc5, 0xff, 0x5d, 0x0, 0xda, 0xff, 0x67, 0x0, 0xd1, 0xff, 0x86, 0xff, 0x9,
+      0x0, 0x5c, 0x0, 0xc6, 0xff, 0x1d, 0x0, 0x3d, 0x0, 0xde, 0xff, 0x3e, 0xff,
+      0xdd, 0xff, 0x9c, 0xfe, 0xde, 0xfe, 0xb2, 0xff, 0x81, 0x0, 0x14, 0x0,
+      0xae, 0x0, 0x4a, 0x0, 0xf4, 0xff, 0x6d, 0x0, 0x8e, 0xff, 0xf0, 0xff, 0xcb,
+      0x0, 0xa3, 0xff, 0xf3, 0xff, 0x86, 0xff, 0xc6, 0xff, 0x2, 0x0, 0x62, 0x0,
+      0x99, 0xff, 0x1b, 0x0, 0xe5, 0xff, 0x2b, 0x0, 0x57, 0xff, 0x2c, 0x0, 0x1a,
+      0x0, 0xd9, 0x0, 0xca, 0xff, 0xeb, 0xff, 0x72, 0x0, 0x56, 0x0, 0xd2, 0xff,
+      0x78, 0x0, 0x75, 0xff, 0x37, 0x0, 0xcb, 0xff, 0x6, 0x0, 0x67, 0xfe, 0x76,
+      0xff, 0x7a, 0xff, 0xf, 0x0, 0x12, 0x0, 0xd, 0x0, 0x73, 0xff, 0x67, 0x0,
+      0x1a, 0xff, 0x7e, 0xff, 0x15, 0x0, 0xed, 0xff, 0x15, 0xff, 0x68, 0xff,
+      0x10, 0x0, 0xb, 0x0, 0x2f, 0x0, 0xc9, 0xff, 0x97, 0xff, 0xc8, 0xfe, 0xbb,
+      0xff, 0x4, 0x0, 0xb5, 0xff, 0x82, 0x0, 0x6d, 0xff, 0x3b, 0x0, 0x4b, 0x0,
+      0x79, 0x0, 0x2d, 0x0, 0x21, 0x0, 0x3f, 0x0, 0x3d, 0x0, 0xf1, 0xff, 0x23,
+      0x0, 0x3e, 0x0, 0xd5, 0xff, 0xaa, 0xfe, 0xcd, 0xff, 0x92, 0xff, 0x5d, 0x0,
+      0xe3, 0xff, 0x12, 0x0, 0xe2, 0xff, 0x86, 0x0, 0x9d, 0x0, 0x97, 0xff, 0x93,
+      0xff, 0x6d, 0x0, 0x8e, 0xff, 0x4b, 0xff, 0xa, 0x0, 0xe1, 0xff, 0xa, 0x0,
+      0xc9, 0xff, 0xbe, 0xff, 0x2a, 0x0, 0x4d, 0xff, 0xf7, 0xff, 0xb7, 0xff,
+      0x23, 0x0, 0xad, 0xff, 0x15, 0x0, 0x9, 0x0, 0x89, 0x0, 0x2f, 0x0, 0x82,
+      0x0, 0x26, 0x0, 0x73, 0x0, 0x7f, 0xff, 0x25, 0x0, 0x48, 0x0, 0x1c, 0x0,
+      0xc6, 0xfe, 0x16, 0x0, 0xf5, 0xfe, 0x3d, 0x0, 0x57, 0x0, 0xe2, 0xff, 0x43,
+      0xff, 0x80, 0xff, 0x1, 0x0, 0xa8, 0xff, 0x29, 0x0, 0x61, 0xff, 0x1f, 0x0,
+      0x92, 0x0, 0x48, 0x0, 0xfa, 0xff, 0x6b, 0x0, 0x7a, 0xff, 0x61, 0x0, 0xb4,
+      0xff, 0x1a, 0xff, 0x98, 0xff, 0x27, 0x0, 0xbd, 0xff, 0xc6, 0xff, 0xe7,
+      0xff, 0x42, 0x0, 0x7e, 0x0, 0xf3, 0xff, 0x3d, 0x0, 0x28, 0x0, 0xaa, 0xff,
+      0xe2, 0xff, 0xd6, 0xff, 0x80, 0x0, 0xb5, 0xff, 0xb4, 0xfe, 0xb2, 0xff,
+      0xef, 0xff, 0xcb, 0xff, 0x1f, 0x0, 0xff, 0xff, 0x56, 0x0, 0xb8, 0xff,
+      0x1e, 0x0, 0x3c, 0xff, 0xa, 0x0, 0xfe, 0xff, 0x9c, 0x0, 0x68, 0x0, 0xb8,
+      0x0, 0x80, 0x0, 0x76, 0xff, 0x4a, 0x0, 0xd7, 0xff, 0x1b, 0x0, 0x38, 0x0,
+      0xf3, 0xff, 0x57, 0xff, 0xee, 0xff, 0xe3, 0xff, 0x9a, 0xff, 0xd3, 0xff,
+      0xea, 0xff, 0xfa, 0xff, 0xe8, 0x0, 0x3f, 0x0, 0xe8, 0xff, 0x4, 0x0, 0x1,
+      0x0, 0xf, 0x0, 0x54, 0x0, 0xc4, 0xfe, 0xea, 0xff, 0xd9, 0xff, 0x18, 0x0,
+      0x15, 0x1, 0x68, 0x0, 0xa9, 0x0, 0xf2, 0xff, 0xec, 0x0, 0x37, 0x0, 0x1,
+      0x0, 0xb9, 0xff, 0x6c, 0x0, 0xea, 0x0, 0xab, 0xff, 0x7d, 0x0, 0x27, 0x0,
+      0xe9, 0xff, 0xea, 0xff, 0x43, 0x0, 0x80, 0xff, 0xba, 0xff, 0xb6, 0xff,
+      0xeb, 0xff, 0xab, 0xff, 0xf9, 0xff, 0xea, 0xff, 0xe2, 0xff, 0x58, 0x0,
+      0x55, 0x0, 0x1c, 0x0, 0xa5, 0xff, 0xea, 0xff, 0xf1, 0xff, 0xeb, 0xff,
+      0x1c, 0x0, 0xa0, 0xfe, 0xab, 0xff, 0x62, 0x0, 0xb7, 0xff, 0xd6, 0xff,
+      0x3a, 0x0, 0xbe, 0xff, 0x13, 0x0, 0x24, 0x0, 0x2f, 0xff, 0xb, 0x0, 0xa5,
+      0xff, 0xac, 0x0, 0xdd, 0xff, 0x86, 0x0, 0x8f, 0x0, 0xa1, 0xff, 0x54, 0x0,
+      0x91, 0xff, 0xed, 0xff, 0x74, 0x0, 0x30, 0x0, 0xb5, 0xff, 0xe1, 0xff,
+      0x1b, 0x0, 0xc8, 0xff, 0xd, 0x0, 0xac, 0xff, 0x24, 0x0, 0x73, 0x0, 0x4,
+      0x0, 0x26, 0x0, 0x12, 0x0, 0x15, 0x0, 0xbf, 0xff, 0x66, 0x0, 0xbd, 0xfe,
+      0xcf, 0xff, 0x1d, 0x0, 0x34, 0x0, 0x79, 0x0, 0x8e, 0x0, 0x4c, 0x0, 0x47,
+      0x0, 0xee, 0x0, 0x48, 0x0, 0xf1, 0xff, 0x86, 0x0, 0x6, 0x0, 0xf2, 0xff,
+      0x75, 0xff, 0xc8, 0xff, 0xfc, 0xff, 0xec, 0xff, 0xc4, 0xff, 0xde, 0xff,
+      0xb3, 0xff, 0xe6, 0xff, 0x9c, 0xff, 0x2b, 0x0, 0xdd, 0xff, 0x13, 0x0, 0xc,
+      0x0, 0x11, 0x0, 0x63, 0x0, 0x3, 0x0, 0x0, 0x0, 0x5d, 0x0, 0x91, 0xff,
+      0x19, 0x0, 0x7c, 0x0, 0x42, 0x0, 0xac, 0xfe, 0x8e, 0x0, 0xbf, 0xff, 0x8e,
+      0xff, 0xf9, 0xff, 0xbd, 0xff, 0x7b, 0xff, 0x9, 0x0, 0x12, 0x0, 0xb2, 0xff,
+      0x37, 0x0, 0x45, 0xff, 0xc6, 0xff, 0x87, 0xff, 0xb7, 0x0, 0xd7, 0xff,
+      0x4e, 0x0, 0x43, 0x0, 0xb5, 0xff, 0xc3, 0xff, 0xec, 0xff, 0xbd, 0xff, 0x9,
+      0x0, 0xe2, 0xff, 0x10, 0x0, 0xcc, 0xff, 0x16, 0x0, 0x49, 0x0, 0xe6, 0xff,
+      0x4, 0x0, 0x39, 0x0, 0x3a, 0x0, 0xc7, 0xff, 0x14, 0x0, 0x7f, 0x0, 0x21,
+      0x0, 0xb2, 0xfe, 0x3f, 0x0, 0xea, 0xff, 0x85, 0xff, 0xd5, 0xff, 0x39, 0x0,
+      0x8d, 0x0, 0xf7, 0xff, 0x10, 0x1, 0xd6, 0xff, 0xe2, 0xff, 0x4f, 0x0, 0x95,
+      0xff, 0xbe, 0xff, 0xf5, 0xff, 0xe3, 0xff, 0x1c, 0x0, 0x12, 0x0, 0xec,
+      0xff, 0x1d, 0x0, 0x8e, 0xff, 0xb8, 0xff, 0xe3, 0xff, 0xb5, 0xff, 0x5b,
+      0x0, 0xdf, 0xff, 0xb9, 0xff, 0x1c, 0x0, 0xf7, 0xff, 0x40, 0x0, 0x5e, 0x0,
+      0x63, 0x0, 0x92, 0xff, 0x23, 0x0, 0x67, 0x0, 0x19, 0x0, 0xa0, 0xfe, 0x63,
+      0x0, 0x7f, 0xff, 0xb7, 0xff, 0x25, 0x0, 0xd5, 0xff, 0x55, 0x0, 0xd, 0x0,
+      0x50, 0x0, 0x2f, 0x0, 0x69, 0x0, 0x59, 0xff, 0xcb, 0xff, 0x3f, 0x0, 0x33,
+      0x0, 0xeb, 0xff, 0x58, 0x0, 0xe0, 0xff, 0x5c, 0x0, 0xb9, 0xff, 0x60, 0xff,
+      0xcc, 0xff, 0x23, 0x0, 0xea, 0xff, 0xf0, 0xff, 0xb1, 0xff, 0x3, 0x0, 0x21,
+      0x0, 0xd3, 0xff, 0xb8, 0xff, 0x73, 0x0, 0xd7, 0xff, 0x0, 0x0, 0xe6, 0xff,
+      0x30, 0x0, 0xca, 0xff, 0x94, 0xfe, 0x5, 0x0, 0xec, 0xff, 0xda, 0xff, 0x6c,
+      0x0, 0xd0, 0xff, 0x46, 0x0, 0x3c, 0x0, 0x9d, 0x0, 0xb5, 0xff, 0x21, 0x0,
+      0xc0, 0xff, 0x6d, 0x0, 0x1e, 0x0, 0x33, 0x0, 0x1a, 0x0, 0xe4, 0xff, 0xec,
+      0xff, 0x2a, 0x0, 0x92, 0x0, 0x27, 0x0, 0x2a, 0x0, 0xae, 0xff, 0x21, 0x0,
+      0x34, 0x0, 0xcf, 0xff, 0xea, 0xff, 0xbd, 0xff, 0xd8, 0xff, 0x37, 0x0,
+      0x37, 0x0, 0x16, 0x0, 0xfc, 0xff, 0x9, 0x0, 0xb8, 0xff, 0xc, 0x0, 0x9d,
+      0xfe, 0x1c, 0x0, 0xff, 0xff, 0xd, 0x0, 0xdb, 0x0, 0x35, 0x0, 0x4f, 0x0,
+      0xf6, 0xff, 0xaa, 0x0, 0x38, 0x0, 0x3, 0x0, 0x9c, 0xff, 0x2a, 0x0, 0x99,
+      0x0, 0x5f, 0xff, 0x2d, 0x0, 0x66, 0x0, 0x79, 0xff, 0x66, 0x0, 0xf, 0x0,
+      0xba, 0xff, 0xeb, 0xff, 0xf4, 0xff, 0xd, 0x0, 0xd7, 0xff, 0x1b, 0x0, 0x4,
+      0x0, 0xc4, 0xff, 0x20, 0x0, 0xd1, 0xff, 0x1e, 0x0, 0xb8, 0xff, 0x1d, 0x0,
+      0x2, 0x0, 0xf4, 0xff, 0xbe, 0xff, 0xc6, 0xfe, 0x21, 0x0, 0x67, 0x0, 0xfc,
+      0xff, 0xc7, 0xff, 0x1c, 0x0, 0x1e, 0x0, 0xec, 0xff, 0x4a, 0x0, 0xd0, 0xff,
+      0xeb, 0xff, 0xbf, 0xff, 0x30, 0x0, 0xd0, 0xff, 0x4e, 0x0, 0x2b, 0x0, 0xa,
+      0x0, 0x3b, 0x0, 0x3, 0x0, 0xc, 0x0, 0x52, 0x0, 0x35, 0x0, 0xb4, 0xff,
+      0xeb, 0xff, 0xfc, 0xff, 0x17, 0x0, 0xf6, 0xff, 0xae, 0xff, 0xc, 0x0, 0xe4,
+      0xff, 0x17, 0x0, 0x9, 0x0, 0xc, 0x0, 0x13, 0x0, 0xe0, 0xff, 0x1d, 0x0,
+      0xde, 0xfe, 0x6b, 0x0, 0xcc, 0xff, 0x34, 0x0, 0x26, 0x0, 0x5b, 0x0, 0x40,
+      0x0, 0xe0, 0xff, 0xa5, 0x0, 0x3f, 0x0, 0xb1, 0xff, 0x2d, 0x0, 0xf4, 0xff,
+      0xf7, 0xff, 0xa6, 0xff, 0xb6, 0xff, 0x4d, 0x0, 0x8, 0x0, 0xd, 0x0, 0xed,
+      0xff, 0xeb, 0xff, 0xdf, 0xff, 0x1, 0x0, 0x6, 0x0, 0xf0, 0xff, 0x66, 0x0,
+      0xe2, 0xff, 0x6, 0x0, 0x1c, 0x0, 0xb8, 0xff, 0x18, 0x0, 0xb, 0x0, 0xbd,
+      0xff, 0x20, 0x0, 0x5d, 0x0, 0xf0, 0xff, 0x9c, 0xfe, 0x5e, 0x0, 0xcf, 0xff,
+      0xa4, 0xff, 0x85, 0xff, 0x7, 0x0, 0xe3, 0xff, 0x24, 0x0, 0xd7, 0xff, 0xdb,
+      0xff, 0x1c, 0x0, 0xbd, 0xff, 0xe5, 0xff, 0x7e, 0xff, 0x68, 0x0, 0xf5,
+      0xff, 0xe, 0x0, 0x1e, 0x0, 0xbc, 0xff, 0x8a, 0xff, 0x27, 0x0, 0xfe, 0xff,
+      0xa, 0x0, 0xf5, 0xff, 0xe4, 0xff, 0x13, 0x0, 0xf5, 0xff, 0x1e, 0x0, 0xe1,
+      0xff, 0xdd, 0xff, 0x3c, 0x0, 0x2, 0x0, 0xe, 0x0, 0x2f, 0x0, 0x4c, 0x0,
+      0xfc, 0xff, 0xb8, 0xfe, 0x4a, 0x0, 0xed, 0xff, 0x17, 0x0, 0x4, 0x0, 0x24,
+      0x0, 0x19, 0x0, 0x68, 0x0, 0x79, 0x0, 0x4c, 0x0, 0x1b, 0x0, 0x3b, 0x0,
+      0xe2, 0xff, 0xea, 0xff, 0xc7, 0xff, 0xfa, 0xff, 0xee, 0xff, 0xfe, 0xff,
+      0xd1, 0xff, 0x16, 0x0, 0xed, 0xff, 0xe4, 0xff, 0xf5, 0xff, 0x23, 0x0,
+      0xe3, 0xff, 0x35, 0x0, 0xf9, 0xff, 0x1a, 0x0, 0xf, 0x0, 0xf1, 0xff, 0x26,
+      0x0, 0xe, 0x0, 0xda, 0xff, 0x15, 0x0, 0x20, 0x0, 0xf2, 0xff, 0xb2, 0xfe,
+      0x9d, 0x0, 0x97, 0xff, 0x5, 0x0, 0xe, 0x0, 0xe2, 0xff, 0xb4, 0xff, 0xe9,
+      0xff, 0xd4, 0xff, 0xe9, 0xff, 0x28, 0x0, 0x6e, 0xff, 0x50, 0x0, 0x48, 0x0,
+      0x3f, 0x0, 0xe, 0x0, 0x17, 0x0, 0xf3, 0xff, 0xe, 0x0, 0xd1, 0xff, 0x1b,
+      0x0, 0xc2, 0xff, 0x5a, 0x0, 0xf7, 0xff, 0xf0, 0xff, 0x2, 0x0, 0x18, 0x0,
+      0xc, 0x0, 0xe5, 0xff, 0xe7, 0xff, 0x1b, 0x0, 0xab, 0xff, 0x24, 0x0, 0xe9,
+      0xff, 0x14, 0x0, 0xc5, 0xff, 0xca, 0xfe, 0x2d, 0x0, 0x18, 0x0, 0xe6, 0xff,
+      0x3b, 0x0, 0x52, 0x0, 0x56, 0x0, 0xdd, 0xff, 0x67, 0x0, 0xf4, 0xff, 0xdc,
+      0xff, 0x4d, 0x0, 0x5a, 0x0, 0x1b, 0x0, 0x29, 0x0, 0x14, 0x0, 0xbe, 0xff,
+      0xc5, 0xff, 0x8, 0x0, 0x35, 0x0, 0x1f, 0x0, 0x22, 0x0, 0xcb, 0xff, 0xf6,
+      0xff, 0x5, 0x0, 0xc, 0x0, 0xe5, 0xff, 0xe0, 0xff, 0x1a, 0x0, 0x15, 0x0,
+      0xc, 0x0, 0xe8, 0xff, 0x7, 0x0, 0xfa, 0xff, 0xfd, 0xff, 0x0, 0x0, 0xe8,
+      0xfe, 0x99, 0x0, 0xf2, 0xff, 0xf3, 0xff, 0x6e, 0x0, 0x17, 0x0, 0x2c, 0x0,
+      0xfa, 0xff, 0x33, 0x0, 0x40, 0x0, 0xf1, 0xff, 0xb7, 0xff, 0x2d, 0x0, 0x46,
+      0x0, 0xd, 0x0, 0x15, 0x0, 0xd, 0x0, 0x13, 0x0, 0x1f, 0x0, 0xa, 0x0, 0xf8,
+      0xff, 0xe1, 0xff, 0x5, 0x0, 0x14, 0x0, 0xbf, 0xff, 0x2d, 0x0, 0x2, 0x0,
+      0x7, 0x0, 0x19, 0x0, 0xc1, 0xff, 0xa, 0x0, 0xaf, 0xff, 0x11, 0x0, 0xcf,
+      0xff, 0xa, 0x0, 0xd7, 0xff, 0xcb, 0xfe, 0x66, 0x0, 0x22, 0x0, 0xe5, 0xff,
+      0x72, 0xff, 0x11, 0x0, 0x32, 0x0, 0xe5, 0xff, 0x9, 0x0, 0xbf, 0xff, 0xf7,
+      0xff, 0x8, 0x0, 0x2d, 0x0, 0xda, 0xff, 0x3a, 0x0, 0x2f, 0x0, 0xd5, 0xff,
+      0x38, 0x0, 0xbd, 0xff, 0x2e, 0x0, 0x5f, 0x0, 0x16, 0x0, 0xcd, 0xff, 0xec,
+      0xff, 0x11, 0x0, 0x1f, 0x0, 0xf4, 0xff, 0xe0, 0xff, 0xf7, 0xff, 0x1b, 0x0,
+      0xf, 0x0, 0x3, 0x0, 0xf9, 0xff, 0xee, 0xff, 0xfa, 0xff, 0x14, 0x0, 0xc0,
+      0xfe, 0x4c, 0x0, 0xf7, 0xff, 0x25, 0x0, 0xe4, 0xff, 0x6b, 0x0, 0x57, 0x0,
+      0x7, 0x0, 0x47, 0x0, 0x44, 0x0, 0xe, 0x0, 0x44, 0x0, 0xb0, 0xff, 0xd, 0x0,
+      0x95, 0xff, 0xf3, 0xff, 0x2b, 0x0, 0xc5, 0xff, 0xf8, 0xff, 0xe0, 0xff,
+      0xd4, 0xff, 0xfc, 0xff, 0xe6, 0xff, 0x27, 0x0, 0xcd, 0xff, 0x35, 0x0, 0x8,
+      0x0, 0x1e, 0x0, 0x1c, 0x0, 0xd9, 0xff, 0x2a, 0x0, 0xf5, 0xff, 0xf5, 0xff,
+      0xff, 0xff, 0x3f, 0x0, 0xea, 0xff, 0xbc, 0xfe, 0x56, 0x0, 0xd2, 0xff, 0x3,
+      0x0, 0xaa, 0xff, 0x9, 0x0, 0xd6, 0xff, 0x26, 0x0, 0xd6, 0xff, 0xca, 0xff,
+      0x3d, 0x0, 0xab, 0xff, 0xf9, 0xff, 0xd9, 0xff, 0x5e, 0x0, 0x21, 0x0, 0x8,
+      0x0, 0x3c, 0x0, 0xf1, 0xff, 0xe2, 0xff, 0x25, 0x0, 0xf, 0x0, 0xf3, 0xff,
+      0xc, 0x0, 0x3, 0x0, 0x0, 0x0, 0x16, 0x0, 0x8, 0x0, 0xe0, 0xff, 0xed, 0xff,
+      0x36, 0x0, 0x3, 0x0, 0x5, 0x0, 0xff, 0xff, 0x17, 0x0, 0x1b, 0x0, 0xd7,
+      0xfe, 0x3a, 0x0, 0xad, 0xff, 0x10, 0x0, 0x1c, 0x0, 0x1f, 0x0, 0xff, 0xff,
+      0xde, 0xff, 0x30, 0x0, 0x3, 0x0, 0xd6, 0xff, 0x33, 0x0, 0xef, 0xff, 0x4f,
+      0x0, 0xb5, 0xff, 0xfc, 0xff, 0xf3, 0xff, 0xb5, 0xff, 0x2c, 0x0, 0x8, 0x0,
+      0xb5, 0xff, 0x28, 0x0, 0x4, 0x0, 0x3, 0x0, 0x20, 0x0, 0x15, 0x0, 0x15,
+      0x0, 0x6, 0x0, 0xa, 0x0, 0xeb, 0xff, 0x38, 0x0, 0xf6, 0xff, 0xda, 0xff,
+      0x4, 0x0, 0x27, 0x0, 0x3, 0x0, 0xe6, 0xfe, 0x5b, 0x0, 0xef, 0xff, 0xd4,
+      0xff, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0xd8, 0xff, 0xc1, 0xff, 0xf2, 0xff,
+      0xef, 0xff, 0xd2, 0xff, 0x1c, 0x0, 0xf5, 0xff, 0xe, 0x0, 0xf8, 0xff, 0xe3,
+      0xff, 0xee, 0xff, 0x26, 0x0, 0xbd, 0xff, 0xd0, 0xff, 0x22, 0x0, 0x12, 0x0,
+      0xff, 0xff, 0xf6, 0xff, 0xd8, 0xff, 0x27, 0x0, 0x5, 0x0, 0xf4, 0xff, 0xd6,
+      0xff, 0x36, 0x0, 0xa3, 0xff, 0x34, 0x0, 0xef, 0xff, 0xfd, 0xff, 0xed,
+      0xff, 0xb, 0xff, 0x4a, 0x0, 0x5, 0x0, 0x29, 0x0, 0x15, 0x0, 0x15, 0x0,
+      0x3b, 0x0, 0xf5, 0xff, 0x3c, 0x0, 0xef, 0xff, 0x20, 0x0, 0x1c, 0x0, 0x43,
+      0x0, 0xe9, 0xff, 0xbe, 0xff, 0x11, 0x0, 0xcc, 0xff, 0xfa, 0xff, 0x7, 0x0,
+      0x32, 0x0, 0xdf, 0xff, 0x38, 0x0, 0xe0, 0xff, 0xea, 0xff, 0xa, 0x0, 0xf1,
+      0xff, 0x15, 0x0, 0xdf, 0xff, 0x5, 0x0, 0xe9, 0xff, 0x14, 0x0, 0xce, 0xff,
+      0xed, 0xff, 0x4, 0x0, 0xdd, 0xff, 0xf, 0x0, 0xe1, 0xfe, 0x3e, 0x0, 0xe4,
+      0xff, 0xf0, 0xff, 0xfc, 0xff, 0x0, 0x0, 0x1b, 0x0, 0xe1, 0xff, 0xf9, 0xff,
+      0xd4, 0xff, 0x2b, 0x0, 0xcb, 0xff, 0xff, 0xff, 0xc, 0x0, 0xb9, 0xff, 0x5,
+      0x0, 0xf0, 0xff, 0xf4, 0xff, 0x6, 0x0, 0xc6, 0xff, 0xc7, 0xff, 0x31, 0x0,
+      0xd, 0x0, 0xe4, 0xff, 0xe1, 0xff, 0xf1, 0xff, 0x1c, 0x0, 0xfe, 0xff, 0x9,
+      0x0, 0xe3, 0xff, 0x16, 0x0, 0xc0, 0xff, 0xb, 0x0, 0xb, 0x0, 0xea, 0xff,
+      0xfa, 0xff, 0xe8, 0xfe, 0x16, 0x0, 0x59, 0x0, 0xc, 0x0, 0xc7, 0xff, 0x2d,
+      0x0, 0x35, 0x0, 0x2b, 0x0, 0x2b, 0x0, 0xe7, 0xff, 0x37, 0x0, 0x27, 0x0,
+      0xfe, 0xff, 0x8a, 0xff, 0xee, 0xff, 0x2, 0x0, 0xd9, 0xff, 0x3b, 0x0, 0xbc,
+      0xff, 0xd, 0x0, 0xf5, 0xff, 0x4b, 0x0, 0xc7, 0xff, 0xe6, 0xff, 0xf3, 0xff,
+      0xf6, 0xff, 0x2, 0x0, 0xea, 0xff, 0x1b, 0x0, 0x15, 0x0, 0x4, 0x0, 0xf3,
+      0xff, 0x3, 0x0, 0xe, 0x0, 0xc9, 0xff, 0x17, 0x0, 0x3, 0xff, 0x89, 0x0,
+      0xd5, 0xff, 0x4b, 0x0, 0x18, 0x0, 0x19, 0x0, 0xd6, 0xff, 0x2b, 0x0, 0x2a,
+      0x0, 0x1c, 0x0, 0x1a, 0x0, 0xe3, 0xff, 0xfa, 0xff, 0xf0, 0xff, 0xc0, 0xff,
+      0xe5, 0xff, 0x1d, 0x0, 0xe, 0x0, 0xdf, 0xff, 0x16, 0x0, 0xc3, 0xff, 0x15,
+      0x0, 0x25, 0x0, 0xfb, 0xff, 0xe0, 0xff, 0xd, 0x0, 0x23, 0x0, 0xa, 0x0,
+      0x8, 0x0, 0xea, 0xff, 0x10, 0x0, 0xda, 0xff, 0xed, 0xff, 0xfd, 0xff, 0xf7,
+      0xff, 0xda, 0xff, 0xe8, 0xfe, 0x66, 0x0, 0xef, 0xff, 0xe5, 0xff, 0xad,
+      0xff, 0x35, 0x0, 0xed, 0xff, 0xfa, 0xff, 0x1, 0x0, 0xc4, 0xff, 0xec, 0xff,
+      0xf7, 0xff, 0x1e, 0x0, 0xb3, 0xff, 0x21, 0x0, 0xec, 0xff, 0xe2, 0xff,
+      0x28, 0x0, 0xce, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0x24, 0x0, 0xd, 0x0, 0xdb,
+      0xff, 0x1a, 0x0, 0xed, 0xff, 0x15, 0x0, 0x1, 0x0, 0xed, 0xff, 0x29, 0x0,
+      0x1a, 0x0, 0xed, 0xff, 0x15, 0x0, 0xfe, 0xff, 0xe6, 0xff, 0xee, 0xff, 0xc,
+      0xff, 0x6f, 0x0, 0xf5, 0xff, 0x1c, 0x0, 0x4a, 0x0, 0x1b, 0x0, 0x24, 0x0,
+      0x2c, 0x0, 0x44, 0x0, 0x1f, 0x0, 0x2, 0x0, 0x2a, 0x0, 0x3, 0x0, 0xca,
+      0xff, 0xcd, 0xff, 0xed, 0xff, 0x15, 0x0, 0xf6, 0xff, 0xfc, 0xff, 0x12,
+      0x0, 0xba, 0xff, 0xee, 0xff, 0xfa, 0xff, 0xf, 0x0, 0xf5, 0xff, 0xc, 0x0,
+      0x23, 0x0, 0xd, 0x0, 0x17, 0x0, 0xfc, 0xff, 0x11, 0x0, 0xd4, 0xff, 0x1,
+      0x0, 0xf1, 0xff, 0xfa, 0xff, 0xc6, 0xff, 0x12, 0xff, 0x61, 0x0, 0xfb,
+      0xff, 0x8, 0x0, 0x1, 0x0, 0xd4, 0xff, 0xf3, 0xff, 0xf7, 0xff, 0xfc, 0xff,
+      0xb6, 0xff, 0xf9, 0xff, 0xd3, 0xff, 0x43, 0x0, 0xbd, 0xff, 0x38, 0x0,
+      0x18, 0x0, 0x7, 0x0, 0x2c, 0x0, 0xe1, 0xff, 0x6, 0x0, 0xd, 0x0, 0xd3,
+      0xff, 0x19, 0x0, 0xf8, 0xff, 0xd, 0x0, 0xf4, 0xff, 0x24, 0x0, 0xfc, 0xff,
+      0xf1, 0xff, 0xd, 0x0, 0xe, 0x0, 0xd1, 0xff, 0x15, 0x0, 0xe6, 0xff, 0xf2,
+      0xff, 0xcb, 0xff, 0x19, 0xff, 0x1d, 0x0, 0x57, 0x0, 0x29, 0x0, 0x11, 0x0,
+      0x45, 0x0, 0x32, 0x0, 0xc1, 0xff, 0x6f, 0x0, 0x9, 0x0, 0xe3, 0xff, 0x73,
+      0x0, 0x1a, 0x0, 0xdb, 0xff, 0xd8, 0xff, 0xa, 0x0, 0xf6, 0xff, 0xee, 0xff,
+      0xf5, 0xff, 0x12, 0x0, 0xf4, 0xff, 0xf8, 0xff, 0xf5, 0xff, 0xe0, 0xff,
+      0x4, 0x0, 0x7, 0x0, 0xfd, 0xff, 0xfc, 0xff, 0x25, 0x0, 0x21, 0x0, 0xd,
+      0x0, 0xeb, 0xff, 0xff, 0xff, 0xec, 0xff, 0x3, 0x0, 0xd4, 0xff, 0x5, 0xff,
+      0x4d, 0x0, 0x2c, 0x0, 0x11, 0x0, 0x14, 0x0, 0xfd, 0xff, 0xec, 0xff, 0x1e,
+      0x0, 0x21, 0x0, 0xd, 0x0, 0xd, 0x0, 0xe1, 0xff, 0xf5, 0xff, 0xed, 0xff,
+      0x22, 0x0, 0x19, 0x0, 0xe, 0x0, 0x25, 0x0, 0xb, 0x0, 0xd4, 0xff, 0x1f,
+      0x0, 0xf4, 0xff, 0xef, 0xff, 0x5, 0x0, 0xd9, 0xff, 0xfb, 0xff, 0xb, 0x0,
+      0x16, 0x0, 0xb, 0x0, 0xfd, 0xff, 0x2d, 0x0, 0xdf, 0xff, 0x8, 0x0, 0xeb,
+      0xff, 0xc, 0x0, 0xdd, 0xff, 0x8, 0xff, 0x35, 0x0, 0x20, 0x0, 0xa, 0x0,
+      0xd0, 0xff, 0xed, 0xff, 0xe1, 0xff, 0x7, 0x0, 0x34, 0x0, 0xc9, 0xff, 0xd5,
+      0xff, 0xdf, 0xff, 0xf, 0x0, 0xf0, 0xff, 0x13, 0x0, 0x2b, 0x0, 0xe4, 0xff,
+      0x1a, 0x0, 0xf6, 0xff, 0x17, 0x0, 0x41, 0x0, 0xe, 0x0, 0xef, 0xff, 0xef,
+      0xff, 0x2d, 0x0, 0xd, 0x0, 0xf7, 0xff, 0x17, 0x0, 0x1, 0x0, 0x2b, 0x0,
+      0x2b, 0x0, 0xd, 0x0, 0xdb, 0xff, 0x1, 0x0, 0x6, 0x0, 0xc, 0x0, 0x3, 0xff,
+      0x4c, 0x0, 0x11, 0x0, 0xfa, 0xff, 0x17, 0x0, 0xdd, 0xff, 0xf3, 0xff, 0x6,
+      0x0, 0x6, 0x0, 0xf2, 0xff, 0xe4, 0xff, 0xea, 0xff, 0xe8, 0xff, 0x19, 0x0,
+      0xe7, 0xff, 0xfe, 0xff, 0xe, 0x0, 0xd6, 0xff, 0x20, 0x0, 0xdb, 0xff, 0xf4,
+      0xff, 0xa, 0x0, 0x4, 0x0, 0x9, 0x0, 0xf9, 0xff, 0x2, 0x0, 0x14, 0x0, 0x29,
+      0x0, 0xb, 0x0, 0x1a, 0x0, 0x32, 0x0, 0xe6, 0xff, 0xfe, 0xff, 0x3, 0x0,
+      0x1e, 0x0, 0xe9, 0xff, 0xf, 0xff, 0x36, 0x0, 0x21, 0x0, 0xfd, 0xff, 0xf0,
+      0xff, 0xcb, 0xff, 0x14, 0x0, 0x3d, 0x0, 0xc, 0x0, 0xd0, 0xff, 0x15, 0x0,
+      0xe3, 0xff, 0x1d, 0x0, 0xe1, 0xff, 0x2b, 0x0, 0x8, 0x0, 0x2, 0x0, 0x10,
+      0x0, 0x2, 0x0, 0xa, 0x0, 0xd, 0x0, 0x2, 0x0, 0xd5, 0xff, 0x7, 0x0, 0x4,
+      0x0, 0xee, 0xff, 0x9, 0x0, 0xff, 0xff, 0xf2, 0xff, 0x24, 0x0, 0x1d, 0x0,
+      0xfa, 0xff, 0xfc, 0xff, 0x9, 0x0, 0xf5, 0xff, 0x2, 0x0, 0x20, 0xff, 0x43,
+      0x0, 0xf1, 0xff, 0x10, 0x0, 0x23, 0x0, 0xc1, 0xff, 0xd9, 0xff, 0xfc, 0xff,
+      0x23, 0x0, 0xeb, 0xff, 0xfc, 0xff, 0xd5, 0xff, 0xfb, 0xff, 0x4a, 0x0,
+      0xdc, 0xff, 0xfa, 0xff, 0x10, 0x0, 0xcc, 0xff, 0x3e, 0x0, 0xfe, 0xff,
+      0xc3, 0xff, 0xfc, 0xff, 0xd, 0x0, 0xb, 0x0, 0x2, 0x0, 0x2, 0x0, 0x0, 0x0,
+      0xb, 0x0, 0xb, 0x0, 0x6, 0x0, 0x10, 0x0, 0xef, 0xff, 0xd9, 0xff, 0x14,
+      0x0, 0xfd, 0xff, 0xeb, 0xff, 0xfe, 0xfe, 0x14, 0x0, 0x3c, 0x0, 0xee, 0xff,
+      0xfe, 0xff, 0xd1, 0xff, 0xf3, 0xff, 0x16, 0x0, 0x9, 0x0, 0xe2, 0xff, 0xf3,
+      0xff, 0xf7, 0xff, 0xea, 0xff, 0x22, 0x0, 0x18, 0x0, 0xf9, 0xff, 0xfa,
+      0xff, 0xf0, 0xff, 0x1f, 0x0, 0xca, 0xff, 0xe2, 0xff, 0x2f, 0x0, 0xe3,
+      0xff, 0x6, 0x0, 0xe6, 0xff, 0xe8, 0xff, 0xfa, 0xff, 0xfc, 0xff, 0x9, 0x0,
+      0x22, 0x0, 0x1a, 0x0, 0xfc, 0xff, 0xfe, 0xff, 0x11, 0x0, 0xe9, 0xff, 0x2,
+      0x0, 0x2a, 0xff, 0x35, 0x0, 0x38, 0x0, 0x1d, 0x0, 0x2, 0x0, 0xdf, 0xff,
+      0xf9, 0xff, 0x37, 0x0, 0x47, 0x0, 0x1a, 0x0, 0xee, 0xff, 0xfd, 0xff, 0xf2,
+      0xff, 0x17, 0x0, 0x6, 0x0, 0x0, 0x0, 0x13, 0x0, 0xf4, 0xff, 0x7, 0x0,
+      0xfe, 0xff, 0xe5, 0xff, 0x5, 0x0, 0xb, 0x0, 0x5, 0x0, 0xd1, 0xff, 0x6,
+      0x0, 0xf7, 0xff, 0xfb, 0xff, 0xf, 0x0, 0x5, 0x0, 0x1a, 0x0, 0x3, 0x0,
+      0xed, 0xff, 0x4, 0x0, 0xfa, 0xff, 0x3, 0x0, 0x1a, 0xff, 0x58, 0x0, 0x9,
+      0x0, 0xc5, 0xff, 0xb8, 0xff, 0xe7, 0xff, 0xc5, 0xff, 0xfd, 0xff, 0xe9,
+      0xff, 0xcb, 0xff, 0xd1, 0xff, 0xe1, 0xff, 0x8, 0x0, 0x20, 0x0, 0x30, 0x0,
+      0x6, 0x0, 0xf2, 0xff, 0xfe, 0xff, 0x13, 0x0, 0xdc, 0xff, 0x16, 0x0, 0x6,
+      0x0, 0x29, 0x0, 0x3, 0x0, 0xe7, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xb, 0x0,
+      0xf8, 0xff, 0xff, 0xff, 0x28, 0x0, 0xe, 0x0, 0x3, 0x0, 0x3, 0x0, 0xfa,
+      0xff, 0x6, 0x0, 0x1a, 0xff, 0x2b, 0x0, 0x34, 0x0, 0xd7, 0xff, 0xef, 0xff,
+      0x1d, 0x0, 0xa, 0x0, 0x16, 0x0, 0x21, 0x0, 0xf8, 0xff, 0xda, 0xff, 0x64,
+      0x0, 0xed, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf3, 0xff, 0x7, 0x0, 0xe9, 0xff,
+      0x1, 0x0, 0x4, 0x0, 0xea, 0xff, 0x28, 0x0, 0xe5, 0xff, 0x0, 0x0, 0xe9,
+      0xff, 0xf9, 0xff, 0xf3, 0xff, 0x14, 0x0, 0x13, 0x0, 0x8, 0x0, 0xd, 0x0,
+      0x2d, 0x0, 0xff, 0xff, 0x1, 0x0, 0xe8, 0xff, 0x2, 0x0, 0x36, 0xff, 0x4f,
+      0x0, 0xfe, 0xff, 0xf6, 0xff, 0xe, 0x0, 0xc0, 0xff, 0xbb, 0xff, 0x33, 0x0,
+      0x16, 0x0, 0xf8, 0xff, 0x9, 0x0, 0xf6, 0xff, 0xd8, 0xff, 0xe5, 0xff, 0x1c,
+      0x0, 0xa, 0x0, 0x33, 0x0, 0xfb, 0xff, 0x11, 0x0, 0x7, 0x0, 0xda, 0xff,
+      0xf6, 0xff, 0x0, 0x0, 0x13, 0x0, 0xe6, 0xff, 0xf8, 0xff, 0xa, 0x0, 0x16,
+      0x0, 0x2, 0x0, 0xe5, 0xff, 0x3, 0x0, 0x29, 0x0, 0xfd, 0xff, 0x0, 0x0,
+      0xef, 0xff, 0xf7, 0xff, 0x32, 0xff, 0x17, 0x0, 0x19, 0x0, 0xb, 0x0, 0xd7,
+      0xff, 0xf0, 0xff, 0xea, 0xff, 0x0, 0x0, 0x39, 0x0, 0xc0, 0xff, 0xde, 0xff,
+      0x42, 0x0, 0x12, 0x0, 0xda, 0xff, 0xf, 0x0, 0x25, 0x0, 0xf2, 0xff, 0xe2,
+      0xff, 0x12, 0x0, 0x1c, 0x0, 0xc, 0x0, 0xb, 0x0, 0xd7, 0xff, 0x5, 0x0,
+      0x27, 0x0, 0xed, 0xff, 0xf3, 0xff, 0x3, 0x0, 0x8, 0x0, 0x4, 0x0, 0x8, 0x0,
+      0x4d, 0x0, 0xeb, 0xff, 0x7, 0x0, 0xe1, 0xff, 0x18, 0x0, 0x3d, 0xff, 0x29,
+      0x0, 0x16, 0x0, 0x34, 0x0, 0x2a, 0x0, 0xeb, 0xff, 0xea, 0xff, 0x28, 0x0,
+      0x4d, 0x0, 0xe, 0x0, 0xf1, 0xff, 0x43, 0x0, 0xf8, 0xff, 0xe7, 0xff, 0x5,
+      0x0, 0x18, 0x0, 0x16, 0x0, 0xc6, 0xff, 0x2d, 0x0, 0xf2, 0xff, 0xfb, 0xff,
+      0xfe, 0xff, 0xe1, 0xff, 0x22, 0x0, 0xf7, 0xff, 0xe9, 0xff, 0xf6, 0xff,
+      0x1a, 0x0, 0x1f, 0x0, 0xe7, 0xff, 0x10, 0x0, 0x30, 0x0, 0xfa, 0xff, 0xf3,
+      0xff, 0xf3, 0xff, 0x6, 0x0, 0x3d, 0xff, 0x3a, 0x0, 0x6, 0x0, 0x16, 0x0,
+      0xeb, 0xff, 0xf3, 0xff, 0xc5, 0xff, 0x2c, 0x0, 0x3d, 0x0, 0xde, 0xff, 0x7,
+      0x0, 0x1c, 0x0, 0x12, 0x0, 0xc9, 0xff, 0x46, 0x0, 0x3d, 0x0, 0xf2, 0xff,
+      0x3, 0x0, 0x15, 0x0, 0xd, 0x0, 0x46, 0x0, 0xef, 0xff, 0xe0, 0xff, 0x15,
+      0x0, 0x24, 0x0, 0xec, 0xff, 0xf3, 0xff, 0xb, 0x0, 0x5, 0x0, 0xf8, 0xff,
+      0x13, 0x0, 0x42, 0x0, 0x4, 0x0, 0xf5, 0xff, 0xea, 0xff, 0x31, 0x0, 0x49,
+      0xff, 0x39, 0x0, 0x15, 0x0, 0x13, 0x0, 0xfd, 0xff, 0x24, 0x0, 0xf5, 0xff,
+      0xe9, 0xff, 0x2e, 0x0, 0xf4, 0xff, 0xce, 0xff, 0x57, 0x0, 0xc, 0x0, 0x1,
+      0x0, 0xdc, 0xff, 0x10, 0x0, 0xe1, 0xff, 0xc5, 0xff, 0xf, 0x0, 0x0, 0x0,
+      0x1d, 0x0, 0xfb, 0xff, 0xf1, 0xff, 0x0, 0x0, 0x20, 0x0, 0xf3, 0xff, 0xf0,
+      0xff, 0x17, 0x0, 0x13, 0x0, 0x0, 0x0, 0xd, 0x0, 0x31, 0x0, 0x8, 0x0, 0xf6,
+      0xff, 0xf5, 0xff, 0x23, 0x0, 0x4a, 0xff, 0x2c, 0x0, 0x35, 0x0, 0xef, 0xff,
+      0x1, 0x0, 0xf1, 0xff, 0xfe, 0xff, 0x29, 0x0, 0x6, 0x0, 0x1, 0x0, 0xeb,
+      0xff, 0x2c, 0x0, 0xff, 0xff, 0xea, 0xff, 0x16, 0x0, 0xa, 0x0, 0x3, 0x0,
+      0xf8, 0xff, 0xf2, 0xff, 0xde, 0xff, 0x23, 0x0, 0xd, 0x0, 0xd2, 0xff, 0x8,
+      0x0, 0xfc, 0xff, 0xdf, 0xff, 0x1, 0x0, 0xf, 0x0, 0xff, 0xff, 0xfb, 0xff,
+      0x6, 0x0, 0x28, 0x0, 0x1d, 0x0, 0xf7, 0xff, 0xe7, 0xff, 0x18, 0x0, 0x5a,
+      0xff, 0x3f, 0x0, 0x20, 0x0, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x7, 0x0,
+      0x15, 0x0, 0x34, 0x0, 0xf7, 0xff, 0xff, 0xff, 0x27, 0x0, 0x1a, 0x0, 0xfd,
+      0xff, 0x0, 0x0, 0x24, 0x0, 0x1b, 0x0, 0x7, 0x0, 0xf5, 0xff, 0x12, 0x0,
+      0x17, 0x0, 0xed, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0x20, 0x0, 0xfa, 0xff, 0x2,
+      0x0, 0x10, 0x0, 0xff, 0xff, 0xe9, 0xff, 0xfb, 0xff, 0x21, 0x0, 0x7, 0x0,
+      0xf8, 0xff, 0xf1, 0xff, 0x14, 0x0, 0x44, 0xff, 0x35, 0x0, 0x22, 0x0, 0xed,
+      0xff, 0x10, 0x0, 0xd2, 0xff, 0x1b, 0x0, 0xeb, 0xff, 0x14, 0x0, 0xf0, 0xff,
+      0xff, 0xff, 0x3, 0x0, 0x29, 0x0, 0x1e, 0x0, 0x1, 0x0, 0x2, 0x0, 0x9, 0x0,
+      0xfb, 0xff, 0x14, 0x0, 0xd3, 0xff, 0x13, 0x0, 0xff, 0xff, 0x13, 0x0, 0x5,
+      0x0, 0x8, 0x0, 0xf4, 0xff, 0xc, 0x0, 0x19, 0x0, 0xfb, 0xff, 0xeb, 0xff,
+      0xff, 0xff, 0x6, 0x0, 0x21, 0x0, 0xfb, 0xff, 0x0, 0x0, 0xc, 0x0, 0x46,
+      0xff, 0x16, 0x0, 0x3a, 0x0, 0x3, 0x0, 0x19, 0x0, 0xd0, 0xff, 0x39, 0x0,
+      0x19, 0x0, 0x5c, 0x0, 0x1c, 0x0, 0x1e, 0x0, 0x10, 0x0, 0x2e, 0x0, 0xfd,
+      0xff, 0x9, 0x0, 0xfe, 0xff, 0x14, 0x0, 0x17, 0x0, 0xfb, 0xff, 0xe1, 0xff,
+      0x18, 0x0, 0x14, 0x0, 0xee, 0xff, 0x6, 0x0, 0x0, 0x0, 0x4, 0x0, 0xc, 0x0,
+      0x5, 0x0, 0xfd, 0xff, 0xe7, 0xff, 0xf8, 0xff, 0xb, 0x0, 0x1a, 0x0, 0xf6,
+      0xff, 0x0, 0x0, 0xc, 0x0, 0x4a, 0xff, 0x50, 0x0, 0xf5, 0xff, 0xed, 0xff,
+      0xf8, 0xff, 0xcf, 0xff, 0xe7, 0xff, 0xf0, 0xff, 0x20, 0x0, 0xf3, 0xff,
+      0x10, 0x0, 0xcc, 0xff, 0x7, 0x0, 0x21, 0x0, 0x0, 0x0, 0xfd, 0xff, 0x20,
+      0x0, 0x1c, 0x0, 0x3, 0x0, 0xd0, 0xff, 0xfe, 0xff, 0xea, 0xff, 0x31, 0x0,
+      0x3, 0x0, 0x0, 0x0, 0x5, 0x0, 0x1d, 0x0, 0xc, 0x0, 0xef, 0xff, 0xd0, 0xff,
+      0xfc, 0xff, 0xe8, 0xff, 0x10, 0x0, 0xe2, 0xff, 0x13, 0x0, 0xf2, 0xff,
+      0x31, 0xff, 0x25, 0x0, 0x12, 0x0, 0xdd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xe,
+      0x0, 0xe1, 0xff, 0x2, 0x0, 0xef, 0xff, 0xf2, 0xff, 0xf, 0x0, 0xf8, 0xff,
+      0x28, 0x0, 0xdc, 0xff, 0xf5, 0xff, 0xff, 0xff, 0x15, 0x0, 0x0, 0x0, 0xc7,
+      0xff, 0xf9, 0xff, 0x1d, 0x0, 0xed, 0xff, 0xd, 0x0, 0xf3, 0xff, 0xef, 0xff,
+      0x10, 0x0, 0x5, 0x0, 0xf7, 0xff, 0xf7, 0xff, 0xfd, 0xff, 0xf4, 0xff, 0x6,
+      0x0, 0xef, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x4f, 0xff, 0x37, 0x0, 0x1c, 0x0,
+      0x2, 0x0, 0x38, 0x0, 0xdc, 0xff, 0x12, 0x0, 0x14, 0x0, 0x26, 0x0, 0x28,
+      0x0, 0x9, 0x0, 0xfc, 0xff, 0xdb, 0xff, 0x19, 0x0, 0xdc, 0xff, 0xf4, 0xff,
+      0x33, 0x0, 0xf, 0x0, 0xf3, 0xff, 0xd0, 0xff, 0xd0, 0xff, 0xf6, 0xff, 0xf8,
+      0xff, 0xf, 0x0, 0xd6, 0xff, 0xfc, 0xff, 0x10, 0x0, 0x4, 0x0, 0xfb, 0xff,
+      0xe4, 0xff, 0xf6, 0xff, 0xe1, 0xff, 0x4, 0x0, 0xe6, 0xff, 0xfd, 0xff,
+      0xe4, 0xff, 0x51, 0xff, 0x21, 0x0, 0xc, 0x0, 0xeb, 0xff, 0xf1, 0xff, 0xd1,
+      0xff, 0xfd, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0xd6, 0xff, 0x6, 0x0, 0xda,
+      0xff, 0xf1, 0xff, 0xc, 0x0, 0xa, 0x0, 0xff, 0xff, 0xa, 0x0, 0x1c, 0x0,
+      0xfa, 0xff, 0xda, 0xff, 0xe8, 0xff, 0xe7, 0xff, 0x12, 0x0, 0xfa, 0xff,
+      0x0, 0x0, 0xf8, 0xff, 0x10, 0x0, 0xef, 0xff, 0xe9, 0xff, 0xf4, 0xff, 0xfb,
+      0xff, 0xf1, 0xff, 0x4, 0x0, 0xf1, 0xff, 0xf2, 0xff, 0xfd, 0xff, 0x53,
+      0xff, 0x5, 0x0, 0x10, 0x0, 0xa, 0x0, 0x22, 0x0, 0xa, 0x0, 0x38, 0x0, 0xe8,
+      0xff, 0x18, 0x0, 0x7, 0x0, 0xf5, 0xff, 0x27, 0x0, 0xc, 0x0, 0xf, 0x0,
+      0xe1, 0xff, 0xe8, 0xff, 0xfa, 0xff, 0xe6, 0xff, 0x18, 0x0, 0xe6, 0xff,
+      0xde, 0xff, 0xff, 0xff, 0x5, 0x0, 0x9, 0x0, 0xe4, 0xff, 0xf2, 0xff, 0xfd,
+      0xff, 0xff, 0xff, 0xe, 0x0, 0x4, 0x0, 0xff, 0xff, 0xf2, 0xff, 0x9, 0x0,
+      0xfe, 0xff, 0xed, 0xff, 0xf3, 0xff, 0x60, 0xff, 0x29, 0x0, 0x3, 0x0, 0xfb,
+      0xff, 0xfe, 0xff, 0xe7, 0xff, 0x6, 0x0, 0x15, 0x0, 0x15, 0x0, 0x0, 0x0,
+      0x8, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xe9, 0xff, 0x23, 0x0, 0xf5, 0xff, 0xfe,
+      0xff, 0x0, 0x0, 0xfd, 0xff, 0xda, 0xff, 0xf8, 0xff, 0xd9, 0xff, 0x1a, 0x0,
+      0x6, 0x0, 0xdc, 0xff, 0xe9, 0xff, 0xf7, 0xff, 0x0, 0x0, 0xfc, 0xff, 0x2,
+      0x0, 0x0, 0x0, 0xe6, 0xff, 0x1e, 0x0, 0xf6, 0xff, 0xee, 0xff, 0xf1, 0xff,
+      0x66, 0xff, 0x1f, 0x0, 0xf1, 0xff, 0xfd, 0xff, 0xcb, 0xff, 0x14, 0x0,
+      0xf8, 0xff, 0xf3, 0xff, 0x15, 0x0, 0xde, 0xff, 0xdf, 0xff, 0xf8, 0xff,
+      0xf7, 0xff, 0x1d, 0x0, 0xf2, 0xff, 0xa, 0x0, 0xda, 0xff, 0xe9, 0xff, 0xf7,
+      0xff, 0xf7, 0xff, 0xf1, 0xff, 0xf8, 0xff, 0x1a, 0x0, 0x6, 0x0, 0xc, 0x0,
+      0xe5, 0xff, 0xef, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x12, 0x0, 0x1, 0x0, 0x0,
+      0x0, 0x2, 0x0, 0xd, 0x0, 0xe5, 0xff, 0xfe, 0xff, 0x6b, 0xff, 0x21, 0x0,
+      0x1, 0x0, 0x5, 0x0, 0x1, 0x0, 0x15, 0x0, 0x10, 0x0, 0xf9, 0xff, 0xff,
+      0xff, 0xfe, 0xff, 0xd9, 0xff, 0xff, 0xff, 0xf5, 0xff, 0x1d, 0x0, 0x0, 0x0,
+      0xd, 0x0, 0xe9, 0xff, 0xdc, 0xff, 0xc, 0x0, 0xda, 0xff, 0xea, 0xff, 0x13,
+      0x0, 0x13, 0x0, 0x28, 0x0, 0xe3, 0xff, 0xd1, 0xff, 0xf6, 0xff, 0xa, 0x0,
+      0xd, 0x0, 0x16, 0x0, 0x6, 0x0, 0xf3, 0xff, 0x14, 0x0, 0xe, 0x0, 0xdf,
+      0xff, 0xe8, 0xff, 0x70, 0xff, 0x19, 0x0, 0xf, 0x0, 0x8, 0x0, 0xf5, 0xff,
+      0xc, 0x0, 0x11, 0x0, 0x26, 0x0, 0x1b, 0x0, 0x0, 0x0, 0x5, 0x0, 0xf7, 0xff,
+      0x0, 0x0, 0xfc, 0xff, 0x1a, 0x0, 0x2a, 0x0, 0xfb, 0xff, 0x0, 0x0, 0xfb,
+      0xff, 0xf8, 0xff, 0x1, 0x0, 0x7, 0x0, 0x5, 0x0, 0x1c, 0x0, 0xff, 0xff,
+      0xe5, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0x5, 0x0, 0xc, 0x0, 0xfe, 0xff, 0x7,
+      0x0, 0xa, 0x0, 0x10, 0x0, 0xe0, 0xff, 0xf9, 0xff, 0x6d, 0xff, 0x26, 0x0,
+      0xf0, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0x9, 0x0, 0xc, 0x0, 0xfb, 0xff, 0x9,
+      0x0, 0xf1, 0xff, 0xf0, 0xff, 0x3, 0x0, 0x8, 0x0, 0x32, 0x0, 0xfb, 0xff,
+      0x4, 0x0, 0xf1, 0xff, 0xee, 0xff, 0x10, 0x0, 0x0, 0x0, 0xee, 0xff, 0x9,
+      0x0, 0x24, 0x0, 0x18, 0x0, 0x8, 0x0, 0xec, 0xff, 0x0, 0x0, 0x9, 0x0, 0x7,
+      0x0, 0xe, 0x0, 0xfe, 0xff, 0x9, 0x0, 0xa, 0x0, 0x1d, 0x0, 0xee, 0xff,
+      0xf8, 0xff, 0x6c, 0xff, 0xb, 0x0, 0xf, 0x0, 0x0, 0x0, 0x14, 0x0, 0x9, 0x0,
+      0x2b, 0x0, 0x2, 0x0, 0x1c, 0x0, 0xb, 0x0, 0xfa, 0xff, 0x17, 0x0, 0x11,
+      0x0, 0xf8, 0xff, 0x3, 0x0, 0xef, 0xff, 0xee, 0xff, 0xf9, 0xff, 0xe, 0x0,
+      0xfc, 0xff, 0xfc, 0xff, 0x19, 0x0, 0xfd, 0xff, 0xf, 0x0, 0xf1, 0xff, 0xe4,
+      0xff, 0xfc, 0xff, 0x6, 0x0, 0xe, 0x0, 0x1f, 0x0, 0xf2, 0xff, 0x9, 0x0,
+      0x22, 0x0, 0x14, 0x0, 0xe5, 0xff, 0xfa, 0xff, 0x77, 0xff, 0x2c, 0x0, 0xf4,
+      0xff, 0x0, 0x0, 0x2, 0x0, 0x13, 0x0, 0xff, 0xff, 0x9, 0x0, 0x2c, 0x0, 0xd,
+      0x0, 0x14, 0x0, 0xf6, 0xff, 0xf6, 0xff, 0xef, 0xff, 0xf1, 0xff, 0xd, 0x0,
+      0x14, 0x0, 0x2, 0x0, 0x3, 0x0, 0xfe, 0xff, 0xf9, 0xff, 0xf3, 0xff, 0x11,
+      0x0, 0x8, 0x0, 0x1, 0x0, 0xf5, 0xff, 0x6, 0x0, 0x5, 0x0, 0x9, 0x0, 0xfc,
+      0xff, 0xf7, 0xff, 0x1, 0x0, 0x13, 0x0, 0x7, 0x0, 0xf9, 0xff, 0xef, 0xff,
+      0x71, 0xff, 0x34, 0x0, 0xf6, 0xff, 0xdc, 0xff, 0xec, 0xff, 0x13, 0x0,
+      0xfb, 0xff, 0xd6, 0xff, 0x7, 0x0, 0xd4, 0xff, 0xef, 0xff, 0xff, 0xff,
+      0xf6, 0xff, 0x3, 0x0, 0xfe, 0xff, 0x5, 0x0, 0xf3, 0xff, 0x2, 0x0, 0x5,
+      0x0, 0xf4, 0xff, 0x1, 0x0, 0xfc, 0xff, 0x18, 0x0, 0xa, 0x0, 0x2, 0x0,
+      0xe3, 0xff, 0xa, 0x0, 0x5, 0x0, 0xff, 0xff, 0xd, 0x0, 0x1, 0x0, 0x3, 0x0,
+      0xf, 0x0, 0x7, 0x0, 0xec, 0xff, 0xf8, 0xff, 0x7c, 0xff, 0x1c, 0x0, 0x14,
+      0x0, 0x9, 0x0, 0x20, 0x0, 0xe, 0x0, 0x19, 0x0, 0xfb, 0xff, 0x30, 0x0,
+      0x15, 0x0, 0xf7, 0xff, 0x1b, 0x0, 0xf5, 0xff, 0xfa, 0xff, 0xe4, 0xff, 0x3,
+      0x0, 0x13, 0x0, 0xf1, 0xff, 0x2, 0x0, 0x0, 0x0, 0xf1, 0xff, 0x7, 0x0,
+      0xfa, 0xff, 0xd, 0x0, 0xe6, 0xff, 0xec, 0xff, 0x5, 0x0, 0x1, 0x0, 0x10,
+      0x0, 0x9, 0x0, 0xfb, 0xff, 0xfc, 0xff, 0x6, 0x0, 0xfa, 0xff, 0xe8, 0xff,
+      0xf1, 0xff, 0x7c, 0xff, 0x1b, 0x0, 0xfd, 0xff, 0xeb, 0xff, 0xef, 0xff,
+      0xef, 0xff, 0xed, 0xff, 0xe, 0x0, 0x9, 0x0, 0xee, 0xff, 0xe, 0x0, 0xda,
+      0xff, 0xed, 0xff, 0xb, 0x0, 0x7, 0x0, 0x18, 0x0, 0x1c, 0x0, 0xb, 0x0,
+      0xf8, 0xff, 0xee, 0xff, 0xfa, 0xff, 0xeb, 0xff, 0x19, 0x0, 0xc, 0x0, 0xfb,
+      0xff, 0xf9, 0xff, 0x13, 0x0, 0xf5, 0xff, 0xfe, 0xff, 0xf1, 0xff, 0x3, 0x0,
+      0xf8, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xf5, 0xff, 0xf6, 0xff, 0x7f, 0xff,
+      0xf1, 0xff, 0x6, 0x0, 0xf7, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0x17, 0x0, 0xe3,
+      0xff, 0x6, 0x0, 0xe6, 0xff, 0xeb, 0xff, 0x11, 0x0, 0xf, 0x0, 0x1c, 0x0,
+      0xe8, 0xff, 0xf3, 0xff, 0xf2, 0xff, 0xf8, 0xff, 0x0, 0x0, 0xfb, 0xff,
+      0xef, 0xff, 0x4, 0x0, 0x8, 0x0, 0x5, 0x0, 0xfc, 0xff, 0xf9, 0xff, 0x9,
+      0x0, 0xf7, 0xff, 0x6, 0x0, 0x6, 0x0, 0xfc, 0xff, 0x1, 0x0, 0xf5, 0xff,
+      0xfa, 0xff, 0xe9, 0xff, 0x4, 0x0, 0x8c, 0xff, 0x4, 0x0, 0x4, 0x0, 0x11,
+      0x0, 0x25, 0x0, 0xe9, 0xff, 0xb, 0x0, 0xe, 0x0, 0x12, 0x0, 0x19, 0x0,
+      0xfb, 0xff, 0xfd, 0xff, 0x5, 0x0, 0xfb, 0xff, 0xf0, 0xff, 0xf1, 0xff,
+      0x1f, 0x0, 0xf5, 0xff, 0x0, 0x0, 0xef, 0xff, 0xef, 0xff, 0xfb, 0xff, 0x1,
+      0x0, 0xe, 0x0, 0xdc, 0xff, 0xfd, 0xff, 0xa, 0x0, 0x2, 0x0, 0xb, 0x0, 0xfe,
+      0xff, 0xfe, 0xff, 0xec, 0xff, 0x4, 0x0, 0xec, 0xff, 0xf4, 0xff, 0xee,
+      0xff, 0x87, 0xff, 0x9, 0x0, 0x0, 0x0, 0xea, 0xff, 0xdf, 0xff, 0x2, 0x0,
+      0xf3, 0xff, 0xfe, 0xff, 0x6, 0x0, 0xd9, 0xff, 0x4, 0x0, 0xe9, 0xff, 0xec,
+      0xff, 0xf6, 0xff, 0xfa, 0xff, 0x18, 0x0, 0x11, 0x0, 0xb, 0x0, 0xfc, 0xff,
+      0xf2, 0xff, 0xf9, 0xff, 0xf7, 0xff, 0x8, 0x0, 0x6, 0x0, 0x2, 0x0, 0x2,
+      0x0, 0xc, 0x0, 0xf2, 0xff, 0x3, 0x0, 0xfd, 0xff, 0x2, 0x0, 0x1, 0x0, 0xf9,
+      0xff, 0xf4, 0xff, 0xed, 0xff, 0x3, 0x0, 0x8d, 0xff, 0x11, 0x0, 0xf5, 0xff,
+      0xfb, 0xff, 0x2, 0x0, 0xfb, 0xff, 0x15, 0x0, 0xce, 0xff, 0x1, 0x0, 0xee,
+      0xff, 0xe1, 0xff, 0xb, 0x0, 0x2, 0x0, 0xf, 0x0, 0xe0, 0xff, 0x1, 0x0, 0x7,
+      0x0, 0xf5, 0xff, 0x13, 0x0, 0xf3, 0xff, 0xe3, 0xff, 0xf, 0x0, 0x7, 0x0,
+      0xc, 0x0, 0xee, 0xff, 0xf4, 0xff, 0xc, 0x0, 0x7, 0x0, 0x10, 0x0, 0xd, 0x0,
+      0x2, 0x0, 0xfd, 0xff, 0xfa, 0xff, 0xf5, 0xff, 0xe9, 0xff, 0xf9, 0xff,
+      0x8c, 0xff, 0x13, 0x0, 0xfb, 0xff, 0x2, 0x0, 0x7, 0x0, 0xf6, 0xff, 0xe,
+      0x0, 0x7, 0x0, 0x19, 0x0, 0xb, 0x0, 0x4, 0x0, 0xf8, 0xff, 0xa, 0x0, 0xe3,
+      0xff, 0x7, 0x0, 0x19, 0x0, 0x1c, 0x0, 0xa, 0x0, 0x9, 0x0, 0xf6, 0xff, 0x3,
+      0x0, 0x8, 0x0, 0xf9, 0xff, 0xd, 0x0, 0xed, 0xff, 0xf9, 0xff, 0xb, 0x0,
+      0x1, 0x0, 0xb, 0x0, 0x12, 0x0, 0xa, 0x0, 0xfc, 0xff, 0x5, 0x0, 0xea, 0xff,
+      0xf2, 0xff, 0xf3, 0xff, 0x8b, 0xff, 0x12, 0x0, 0xea, 0xff, 0xf1, 0xff,
+      0xe9, 0xff, 0xd, 0x0, 0xfd, 0xff, 0xfa, 0xff, 0x14, 0x0, 0xe4, 0xff, 0x4,
+      0x0, 0xf5, 0xff, 0xf4, 0xff, 0x9, 0x0, 0xf5, 0xff, 0x1a, 0x0, 0x8, 0x0,
+      0x8, 0x0, 0xb, 0x0, 0xfa, 0xff, 0xf5, 0xff, 0xf6, 0xff, 0x18, 0x0, 0x3,
+      0x0, 0xc, 0x0, 0x7, 0x0, 0xa, 0x0, 0xfc, 0xff, 0x7, 0x0, 0x2, 0x0, 0xb,
+      0x0, 0x6, 0x0, 0xf7, 0xff, 0xf9, 0xff, 0xf4, 0xff, 0xff, 0xff, 0x90, 0xff,
+      0x12, 0x0, 0xf0, 0xff, 0xff, 0xff, 0xa, 0x0, 0xf6, 0xff, 0x1d, 0x0, 0xe5,
+      0xff, 0x6, 0x0, 0xf4, 0xff, 0xe9, 0xff, 0x12, 0x0, 0x13, 0x0, 0xd, 0x0,
+      0xfe, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0x2, 0x0, 0xf, 0x0, 0xf6, 0xff, 0xf4,
+      0xff, 0x8, 0x0, 0xb, 0x0, 0x7, 0x0, 0xee, 0xff, 0xf4, 0xff, 0x5, 0x0, 0x4,
+      0x0, 0x9, 0x0, 0x17, 0x0, 0xa, 0x0, 0xfe, 0xff, 0xb, 0x0, 0xf7, 0xff,
+      0xeb, 0xff, 0xfc, 0xff, 0x99, 0xff, 0xe, 0x0, 0xfe, 0xff, 0xf, 0x0, 0xa,
+      0x0, 0xfe, 0xff, 0x11, 0x0, 0x10, 0x0, 0x24, 0x0, 0x16, 0x0, 0xc, 0x0,
+      0x5, 0x0, 0xa, 0x0, 0xea, 0xff, 0xf4, 0xff, 0x18, 0x0, 0x1d, 0x0, 0x4,
+      0x0, 0x2, 0x0, 0x2, 0x0, 0xf8, 0xff, 0x1, 0x0, 0xf3, 0xff, 0x7, 0x0, 0xf0,
+      0xff, 0xff, 0xff, 0x2, 0x0, 0xf8, 0xff, 0xb, 0x0, 0xfd, 0xff, 0xc, 0x0,
+      0xff, 0xff, 0x9, 0x0, 0xf1, 0xff, 0xfa, 0xff, 0xf5, 0xff, 0x94, 0xff,
+      0x1f, 0x0, 0xf4, 0xff, 0xeb, 0xff, 0xe1, 0xff, 0x4, 0x0, 0xf2, 0xff, 0xf2,
+      0xff, 0xf3, 0xff, 0xd4, 0xff, 0xf4, 0xff, 0xe5, 0xff, 0xed, 0xff, 0xb,
+      0x0, 0xf7, 0xff, 0x16, 0x0, 0xfe, 0xff, 0xc, 0x0, 0x1, 0x0, 0xf0, 0xff,
+      0xf6, 0xff, 0xf3, 0xff, 0x16, 0x0, 0xc, 0x0, 0xa, 0x0, 0xfc, 0xff, 0x9,
+      0x0, 0xff, 0xff, 0x2, 0x0, 0xf8, 0xff, 0x14, 0x0, 0x3, 0x0, 0x6, 0x0,
+      0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0x93, 0xff, 0x2, 0x0, 0x9, 0x0, 0x12,
+      0x0, 0x12, 0x0, 0xb, 0x0, 0x28, 0x0, 0xea, 0xff, 0x20, 0x0, 0xff, 0xff,
+      0xdf, 0xff, 0x20, 0x0, 0xa, 0x0, 0xff, 0xff, 0xe7, 0xff, 0x1, 0x0, 0xf4,
+      0xff, 0xf8, 0xff, 0x8, 0x0, 0xf9, 0xff, 0xfc, 0xff, 0xd, 0x0, 0xfd, 0xff,
+      0xa, 0x0, 0xf7, 0xff, 0xf9, 0xff, 0x0, 0x0, 0x6, 0x0, 0xe, 0x0, 0x18, 0x0,
+      0x11, 0x0, 0x4, 0x0, 0xf, 0x0, 0xfa, 0xff, 0xee, 0xff, 0xfe, 0xff, 0x9c,
+      0xff, 0x14, 0x0, 0xee, 0xff, 0x4, 0x0, 0xff, 0xff, 0xed, 0xff, 0x0, 0x0,
+      0x13, 0x0, 0x19, 0x0, 0xe, 0x0, 0x8, 0x0, 0xf9, 0xff, 0x6, 0x0, 0xf3,
+      0xff, 0x7, 0x0, 0x1b, 0x0, 0x1b, 0x0, 0x7, 0x0, 0xfe, 0xff, 0xf9, 0xff,
+      0x1, 0x0, 0xf8, 0xff, 0xfc, 0xff, 0x9, 0x0, 0xf6, 0xff, 0x3, 0x0, 0x4,
+      0x0, 0xfa, 0xff, 0x5, 0x0, 0xf8, 0xff, 0x14, 0x0, 0xfb, 0xff, 0xc, 0x0,
+      0xf4, 0xff, 0x0, 0x0, 0xef, 0xff, 0x97, 0xff, 0xd, 0x0, 0xf2, 0xff, 0xe6,
+      0xff, 0xdf, 0xff, 0x10, 0x0, 0xf5, 0xff, 0xed, 0xff, 0xf0, 0xff, 0xd3,
+      0xff, 0xf4, 0xff, 0xfd, 0xff, 0x1, 0x0, 0x19, 0x0, 0x9, 0x0, 0x13, 0x0,
+      0xf6, 0xff, 0xc, 0x0, 0x3, 0x0, 0x5, 0x0, 0xfe, 0xff, 0xfc, 0xff, 0xc,
+      0x0, 0xb, 0x0, 0xc, 0x0, 0xfd, 0xff, 0x4, 0x0, 0xf8, 0xff, 0xf8, 0xff,
+      0xfc, 0xff, 0xe, 0x0, 0x9, 0x0, 0xfe, 0xff, 0x2, 0x0, 0xfb, 0xff, 0x0,
+      0x0, 0x99, 0xff, 0xec, 0xff, 0x16, 0x0, 0x1d, 0x0, 0x32, 0x0, 0x25, 0x0,
+      0x24, 0x0, 0xf4, 0xff, 0x27, 0x0, 0x12, 0x0, 0xf3, 0xff, 0x1e, 0x0, 0x1,
+      0x0, 0xc, 0x0, 0xd7, 0xff, 0xfa, 0xff, 0x7, 0x0, 0xe9, 0xff, 0xe, 0x0,
+      0xf6, 0xff, 0xea, 0xff, 0xb, 0x0, 0xfd, 0xff, 0xd, 0x0, 0xef, 0xff, 0xfe,
+      0xff, 0xfc, 0xff, 0xc, 0x0, 0x6, 0x0, 0xfa, 0xff, 0x9, 0x0, 0xfc, 0xff,
+      0xb, 0x0, 0xfa, 0xff, 0xfa, 0xff, 0xf5, 0xff, 0xa7, 0xff, 0x16, 0x0, 0xf2,
+      0xff, 0xf9, 0xff, 0x3, 0x0, 0xe6, 0xff, 0xf1, 0xff, 0x10, 0x0, 0xa, 0x0,
+      0xf9, 0xff, 0x14, 0x0, 0xe5, 0xff, 0xfd, 0xff, 0xee, 0xff, 0x15, 0x0,
+      0x10, 0x0, 0x12, 0x0, 0x16, 0x0, 0xf2, 0xff, 0xf1, 0xff, 0x3, 0x0, 0xff,
+      0xff, 0x0, 0x0, 0x2, 0x0, 0x1, 0x0, 0x8, 0x0, 0x0, 0x0, 0x1, 0x0, 0xfb,
+      0xff, 0xf6, 0xff, 0x11, 0x0, 0x4, 0x0, 0xa, 0x0, 0xf9, 0xff, 0xfc, 0xff,
+      0xf6, 0xff, 0x99, 0xff, 0xff, 0xff, 0xee, 0xff, 0xe5, 0xff, 0xe5, 0xff,
+      0x8, 0x0, 0xf0, 0xff, 0xd5, 0xff, 0xfc, 0xff, 0xd9, 0xff, 0xe4, 0xff,
+      0xe7, 0xff, 0xf7, 0xff, 0x22, 0x0, 0xea, 0xff, 0x10, 0x0, 0xfb, 0xff,
+      0xf7, 0xff, 0x9, 0x0, 0xf9, 0xff, 0xfa, 0xff, 0x9, 0x0, 0x13, 0x0, 0xc,
+      0x0, 0x14, 0x0, 0xd, 0x0, 0x4, 0x0, 0x0, 0x0, 0x3, 0x0, 0xfd, 0xff, 0xd,
+      0x0, 0xc, 0x0, 0xfd, 0xff, 0x1, 0x0, 0x6, 0x0, 0xfc, 0xff, 0x8f, 0xff,
+      0xe5, 0xff, 0x1b, 0x0, 0x4, 0x0, 0xf, 0x0, 0x1a, 0x0, 0x1b, 0x0, 0xf4,
+      0xff, 0x17, 0x0, 0xfc, 0xff, 0xed, 0xff, 0xf7, 0xff, 0xf4, 0xff, 0x8, 0x0,
+      0xda, 0xff, 0x9, 0x0, 0xb, 0x0, 0xf1, 0xff, 0xe, 0x0, 0xe6, 0xff, 0xfa,
+      0xff, 0x6, 0x0, 0xf9, 0xff, 0x9, 0x0, 0xf7, 0xff, 0xf9, 0xff, 0x0, 0x0,
+      0xb, 0x0, 0x3, 0x0, 0xee, 0xff, 0xf, 0x0, 0xfb, 0xff, 0x12, 0x0, 0xf9,
+      0xff, 0xfd, 0xff, 0xfa, 0xff, 0xb9, 0xff, 0x39, 0x0, 0xed, 0xff, 0xb, 0x0,
+      0xa, 0x0, 0xe4, 0xff, 0xe9, 0xff, 0x1b, 0x0, 0xfa, 0xff, 0xf4, 0xff, 0x1b,
+      0x0, 0xe9, 0xff, 0xb, 0x0, 0xf4, 0xff, 0x15, 0x0, 0x10, 0x0, 0xf, 0x0,
+      0x1c, 0x0, 0xf3, 0xff, 0xd, 0x0, 0x2, 0x0, 0xf4, 0xff, 0xfe, 0xff, 0xee,
+      0xff, 0x0, 0x0, 0xfc, 0xff, 0xfe, 0xff, 0x6, 0x0, 0xf8, 0xff, 0xed, 0xff,
+      0xa, 0x0, 0x8, 0x0, 0x1, 0x0, 0xfd, 0xff, 0xf3, 0xff, 0xfb, 0xff, 0xaf,
+      0xff, 0x2a, 0x0, 0xe8, 0xff, 0xeb, 0xff, 0xf2, 0xff, 0xfa, 0xff, 0xd4,
+      0xff, 0xe0, 0xff, 0xd6, 0xff, 0xd1, 0xff, 0xdb, 0xff, 0xd4, 0xff, 0x9,
+      0x0, 0x20, 0x0, 0xf6, 0xff, 0x2, 0x0, 0xf5, 0xff, 0xef, 0xff, 0x8, 0x0,
+      0x1, 0x0, 0x3, 0x0, 0x9, 0x0, 0x1a, 0x0, 0xc, 0x0, 0xd, 0x0, 0xfe, 0xff,
+      0x6, 0x0, 0x1, 0x0, 0x2, 0x0, 0xec, 0xff, 0x8, 0x0, 0x6, 0x0, 0x2, 0x0,
+      0x0, 0x0, 0x8, 0x0, 0xf8, 0xff, 0xa2, 0xff, 0x2, 0x0, 0x1b, 0x0, 0xfb,
+      0xff, 0xd, 0x0, 0x23, 0x0, 0xe, 0x0, 0xf8, 0xff, 0xf6, 0xff, 0xf2, 0xff,
+      0xec, 0xff, 0xff, 0xff, 0xee, 0xff, 0x2, 0x0, 0xed, 0xff, 0xf3, 0xff,
+      0xef, 0xff, 0xf9, 0xff, 0xd, 0x0, 0xe7, 0xff, 0x1, 0x0, 0xb, 0x0, 0xf4,
+      0xff, 0x11, 0x0, 0xf4, 0xff, 0xef, 0xff, 0x5, 0x0, 0x0, 0x0, 0x9, 0x0,
+      0xe6, 0xff, 0x10, 0x0, 0xfb, 0xff, 0x10, 0x0, 0xfd, 0xff, 0xf8, 0xff, 0x9,
+      0x0, 0xcb, 0xff, 0x4e, 0x0, 0xe7, 0xff, 0x1a, 0x0, 0x17, 0x0, 0xe1, 0xff,
+      0xe1, 0xff, 0x17, 0x0, 0xf9, 0xff, 0xff, 0xff, 0x1f, 0x0, 0xf6, 0xff,
+      0xfd, 0xff, 0xfb, 0xff, 0x1a, 0x0, 0x8, 0x0, 0xa, 0x0, 0x14, 0x0, 0x2,
+      0x0, 0xfe, 0xff, 0xfd, 0xff, 0xf0, 0xff, 0xfe, 0xff, 0xee, 0xff, 0xee,
+      0xff, 0xf4, 0xff, 0x4, 0x0, 0x6, 0x0, 0xfc, 0xff, 0xf0, 0xff, 0xf, 0x0,
+      0xfd, 0xff, 0x3, 0x0, 0xff, 0xff, 0xf7, 0xff, 0x0, 0x0, 0xb2, 0xff, 0x28,
+      0x0, 0xed, 0xff, 0xf6, 0xff, 0xf3, 0xff, 0xf9, 0xff, 0xe0, 0xff, 0xdd,
+      0xff, 0xe8, 0xff, 0xdc, 0xff, 0xd4, 0xff, 0xee, 0xff, 0x4, 0x0, 0xe, 0x0,
+      0xf1, 0xff, 0xb, 0x0, 0xff, 0xff, 0xea, 0xff, 0x6, 0x0, 0xfd, 0xff, 0x6,
+      0x0, 0xb, 0x0, 0xf5, 0xff, 0x2, 0x0, 0xf6, 0xff, 0xf4, 0xff, 0x2, 0x0,
+      0xfc, 0xff, 0x5, 0x0, 0x0, 0x0, 0xb, 0x0, 0x6, 0x0, 0x2, 0x0, 0xfc, 0xff,
+      0x4, 0x0, 0xf4, 0xff, 0xb0, 0xff, 0x1f, 0x0, 0x1, 0x0, 0x1, 0x0, 0x19,
+      0x0, 0xa, 0x0, 0x18, 0x0, 0xfe, 0xff, 0xf0, 0xff, 0x9, 0x0, 0xeb, 0xff,
+      0x1f, 0x0, 0xf0, 0xff, 0x9, 0x0, 0xf3, 0xff, 0xe9, 0xff, 0x0, 0x0, 0xff,
+      0xff, 0x8, 0x0, 0xf8, 0xff, 0xef, 0xff, 0xfd, 0xff, 0xe2, 0xff, 0xf, 0x0,
+      0xd2, 0xff, 0xee, 0xff, 0x6, 0x0, 0xff, 0xff, 0xb, 0x0, 0xfb, 0xff, 0xc,
+      0x0, 0xf7, 0xff, 0x3, 0x0, 0xf7, 0xff, 0xf9, 0xff, 0xf2, 0xff, 0xd8, 0xff,
+      0x57, 0x0, 0xeb, 0xff, 0xc, 0x0, 0x5, 0x0, 0xe5, 0xff, 0xe6, 0xff, 0x20,
+      0x0, 0xf6, 0xff, 0xc, 0x0, 0x1c, 0x0, 0x9, 0x0, 0x7, 0x0, 0x4, 0x0, 0x22,
+      0x0, 0x12, 0x0, 0x11, 0x0, 0x15, 0x0, 0xfe, 0xff, 0x8, 0x0, 0xfd, 0xff,
+      0xe9, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0x8, 0x0, 0x3,
+      0x0, 0xfa, 0xff, 0x2, 0x0, 0xc, 0x0, 0xfe, 0xff, 0xfe, 0xff, 0xf9, 0xff,
+      0xfc, 0xff, 0xf4, 0xff, 0xc0, 0xff, 0x24, 0x0, 0x8, 0x0, 0xf9, 0xff, 0xe9,
+      0xff, 0x21, 0x0, 0xe5, 0xff, 0xde, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xd8,
+      0xff, 0xff, 0xff, 0xf9, 0xff, 0x16, 0x0, 0xe0, 0xff, 0x16, 0x0, 0x3, 0x0,
+      0xe1, 0xff, 0x9, 0x0, 0xf8, 0xff, 0xf4, 0xff, 0xc, 0x0, 0x0, 0x0, 0x14,
+      0x0, 0x2, 0x0, 0x2, 0x0, 0x2, 0x0, 0x8, 0x0, 0x7, 0x0, 0xf5, 0xff, 0xa,
+      0x0, 0x2, 0x0, 0xff, 0xff, 0xf8, 0xff, 0x5, 0x0, 0xf1, 0xff, 0xc6, 0xff,
+      0x37, 0x0, 0x0, 0x0, 0xd, 0x0, 0x13, 0x0, 0xff, 0xff, 0x4, 0x0, 0xf4,
+      0xff, 0xef, 0xff, 0xe, 0x0, 0xea, 0xff, 0x13, 0x0, 0xe8, 0xff, 0x13, 0x0,
+      0x9, 0x0, 0xec, 0xff, 0x6, 0x0, 0x4, 0x0, 0x8, 0x0, 0xef, 0xff, 0xe4,
+      0xff, 0x1, 0x0, 0xf7, 0xff, 0x14, 0x0, 0xd5, 0xff, 0xf6, 0xff, 0xff, 0xff,
+      0x12, 0x0, 0x6, 0x0, 0xfa, 0xff, 0xf, 0x0, 0xeb, 0xff, 0x1, 0x0, 0xfa,
+      0xff, 0x0, 0x0, 0xf2, 0xff, 0xde, 0xff, 0x50, 0x0, 0xec, 0xff, 0xc, 0x0,
+      0xf6, 0xff, 0xed, 0xff, 0xe6, 0xff, 0x12, 0x0, 0xd, 0x0, 0xb, 0x0, 0x13,
+      0x0, 0x4, 0x0, 0xfe, 0xff, 0xc, 0x0, 0x14, 0x0, 0x16, 0x0, 0x21, 0x0, 0x3,
+      0x0, 0x0, 0x0, 0xff, 0xff, 0xf3, 0xff, 0xf4, 0xff, 0xfa, 0xff, 0xf9, 0xff,
+      0xf9, 0xff, 0x6, 0x0, 0xfc, 0xff, 0xe, 0x0, 0xff, 0xff, 0x8, 0x0, 0xe,
+      0x0, 0xfd, 0xff, 0xf9, 0xff, 0x3, 0x0, 0xe, 0x0, 0xf9, 0xff, 0xc0, 0xff,
+      0x25, 0x0, 0x8, 0x0, 0xe8, 0xff, 0xd5, 0xff, 0x15, 0x0, 0xf9, 0xff, 0xeb,
+      0xff, 0xfb, 0xff, 0xee, 0xff, 0xe2, 0xff, 0xed, 0xff, 0xf3, 0xff, 0x14,
+      0x0, 0xe3, 0xff, 0x8, 0x0, 0x4, 0x0, 0xea, 0xff, 0x9, 0x0, 0xef, 0xff,
+      0xf0, 0xff, 0x0, 0x0, 0xf7, 0xff, 0xf, 0x0, 0xff, 0xff, 0xff, 0xff, 0x2,
+      0x0, 0x12, 0x0, 0x4, 0x0, 0xfd, 0xff, 0xe, 0x0, 0x2, 0x0, 0xff, 0xff,
+      0xfe, 0xff, 0xa, 0x0, 0xfe, 0xff, 0xd0, 0xff, 0x3c, 0x0, 0x0, 0x0, 0x17,
+      0x0, 0xa, 0x0, 0xec, 0xff, 0x1b, 0x0, 0xfe, 0xff, 0xe, 0x0, 0xa, 0x0,
+      0xeb, 0xff, 0xa, 0x0, 0x5, 0x0, 0x6, 0x0, 0xe, 0x0, 0xf0, 0xff, 0x0, 0x0,
+      0x12, 0x0, 0x8, 0x0, 0x3, 0x0, 0xf2, 0xff, 0xf9, 0xff, 0xf0, 0xff, 0x9,
+      0x0, 0xe1, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x17, 0x0, 0x0, 0x0, 0x11, 0x0,
+      0xd, 0x0, 0xf3, 0xff, 0x0, 0x0, 0xfc, 0xff, 0xf8, 0xff, 0x4, 0x0, 0xd9,
+      0xff, 0x41, 0x0, 0xf1, 0xff, 0xb, 0x0, 0xfc, 0xff, 0xf4, 0xff, 0xf1, 0xff,
+      0x8, 0x0, 0x27, 0x0, 0x16, 0x0, 0x1, 0x0, 0xf9, 0xff, 0xd, 0x0, 0x9, 0x0,
+      0x5, 0x0, 0x1c, 0x0, 0x21, 0x0, 0xfd, 0xff, 0xfd, 0xff, 0x2, 0x0, 0xfb,
+      0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0x6, 0x0, 0x13, 0x0, 0xfd, 0xff,
+      0x11, 0x0, 0x0, 0x0, 0xc, 0x0, 0xf, 0x0, 0xfa, 0xff, 0x2, 0x0, 0xfe, 0xff,
+      0xa, 0x0, 0xff, 0xff, 0xbf, 0xff, 0x1c, 0x0, 0x13, 0x0, 0xda, 0xff, 0xe1,
+      0xff, 0x19, 0x0, 0xa, 0x0, 0xe4, 0xff, 0x2, 0x0, 0xef, 0xff, 0xe6, 0xff,
+      0xf9, 0xff, 0xf6, 0xff, 0xc, 0x0, 0xf5, 0xff, 0xfe, 0xff, 0xf5, 0xff,
+      0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xfa, 0xff, 0xc, 0x0, 0xf8, 0xff,
+      0x10, 0x0, 0x0, 0x0, 0x5, 0x0, 0x5, 0x0, 0xc, 0x0, 0x6, 0x0, 0x9, 0x0,
+      0x11, 0x0, 0x5, 0x0, 0x3, 0x0, 0xff, 0xff, 0xfd, 0xff, 0x5, 0x0, 0xd9,
+      0xff, 0x38, 0x0, 0xfc, 0xff, 0x20, 0x0, 0x21, 0x0, 0xec, 0xff, 0x19, 0x0,
+      0xf5, 0xff, 0x23, 0x0, 0xe, 0x0, 0xf7, 0xff, 0x13, 0x0, 0x4, 0x0, 0x9,
+      0x0, 0xb, 0x0, 0xf4, 0xff, 0x5, 0x0, 0xa, 0x0, 0xb, 0x0, 0xd, 0x0, 0xed,
+      0xff, 0xfd, 0xff, 0xfb, 0xff, 0x5, 0x0, 0xe5, 0xff, 0x8, 0x0, 0xff, 0xff,
+      0x10, 0x0, 0x5, 0x0, 0x1a, 0x0, 0xe, 0x0, 0xf7, 0xff, 0xf9, 0xff, 0xfc,
+      0xff, 0xf8, 0xff, 0xfd, 0xff, 0xd2, 0xff, 0x33, 0x0, 0xee, 0xff, 0xff,
+      0xff, 0xf3, 0xff, 0xf9, 0xff, 0xec, 0xff, 0x3, 0x0, 0x24, 0x0, 0xf8, 0xff,
+      0x4, 0x0, 0xec, 0xff, 0xfe, 0xff, 0x5, 0x0, 0xfd, 0xff, 0x1e, 0x0, 0x16,
+      0x0, 0xf7, 0xff, 0x3, 0x0, 0xf6, 0xff, 0xf5, 0xff, 0xff, 0xff, 0x0, 0x0,
+      0xfd, 0xff, 0xe, 0x0, 0x10, 0x0, 0x1, 0x0, 0x7, 0x0, 0x1, 0x0, 0x11, 0x0,
+      0x11, 0x0, 0xfe, 0xff, 0x4, 0x0, 0xfb, 0xff, 0xb, 0x0, 0xf8, 0xff, 0xc2,
+      0xff, 0x17, 0x0, 0x3, 0x0, 0xe9, 0xff, 0xe5, 0xff, 0x1a, 0x0, 0x13, 0x0,
+      0xea, 0xff, 0xf, 0x0, 0xec, 0xff, 0xf2, 0xff, 0xfe, 0xff, 0xf2, 0xff, 0xf,
+      0x0, 0xe8, 0xff, 0xf8, 0xff, 0xee, 0xff, 0x2, 0x0, 0x2, 0x0, 0xf3, 0xff,
+      0xe9, 0xff, 0x6, 0x0, 0xfe, 0xff, 0xd, 0x0, 0xfb, 0xff, 0xfb, 0xff, 0xa,
+      0x0, 0x6, 0x0, 0x6, 0x0, 0xe, 0x0, 0x10, 0x0, 0x5, 0x0, 0x1, 0x0, 0xfb,
+      0xff, 0xf9, 0xff, 0xfe, 0xff, 0xde, 0xff, 0x33, 0x0, 0xea, 0xff, 0x25,
+      0x0, 0x1b, 0x0, 0xe5, 0xff, 0xc, 0x0, 0xf9, 0xff, 0x23, 0x0, 0xc, 0x0,
+      0xff, 0xff, 0x5, 0x0, 0x13, 0x0, 0xa, 0x0, 0x8, 0x0, 0xfc, 0xff, 0xe, 0x0,
+      0x5, 0x0, 0xd, 0x0, 0x6, 0x0, 0xf3, 0xff, 0xf8, 0xff, 0x9, 0x0, 0xfb,
+      0xff, 0xeb, 0xff, 0xfc, 0xff, 0x1, 0x0, 0xd, 0x0, 0x1, 0x0, 0x11, 0x0,
+      0xc, 0x0, 0xf3, 0xff, 0x0, 0x0, 0xf9, 0xff, 0xf8, 0xff, 0xf5, 0xff, 0xd2,
+      0xff, 0x1e, 0x0, 0xfa, 0xff, 0xf4, 0xff, 0xec, 0xff, 0x8, 0x0, 0xf3, 0xff,
+      0xfb, 0xff, 0x1d, 0x0, 0xf3, 0xff, 0x2, 0x0, 0xf4, 0xff, 0x0, 0x0, 0x3,
+      0x0, 0xfd, 0xff, 0x1d, 0x0, 0xb, 0x0, 0xf6, 0xff, 0xfe, 0xff, 0xf8, 0xff,
+      0x1, 0x0, 0x6, 0x0, 0x2, 0x0, 0xfe, 0xff, 0x11, 0x0, 0x0, 0x0, 0x1, 0x0,
+      0x1, 0x0, 0x2, 0x0, 0x3, 0x0, 0xe, 0x0, 0x0, 0x0, 0x3, 0x0, 0xfa, 0xff,
+      0x2, 0x0, 0xf9, 0xff, 0xcb, 0xff, 0xe, 0x0, 0xd, 0x0, 0xf0, 0xff, 0xf8,
+      0xff, 0x13, 0x0, 0x1f, 0x0, 0xe9, 0xff, 0x12, 0x0, 0xf1, 0xff, 0xf5, 0xff,
+      0x6, 0x0, 0xf7, 0xff, 0x12, 0x0, 0xf2, 0xff, 0xf6, 0xff, 0xeb, 0xff, 0x5,
+      0x0, 0x4, 0x0, 0xf6, 0xff, 0xf0, 0xff, 0xb, 0x0, 0x4, 0x0, 0x10, 0x0,
+      0xf1, 0xff, 0xee, 0xff, 0xa, 0x0, 0x3, 0x0, 0x6, 0x0, 0x1, 0x0, 0xa, 0x0,
+      0x3, 0x0, 0xff, 0xff, 0xf9, 0xff, 0xf3, 0xff, 0xf9, 0xff, 0xe3, 0xff,
+      0x2b, 0x0, 0xf6, 0xff, 0x1e, 0x0, 0x17, 0x0, 0xe3, 0xff, 0xc, 0x0, 0xf9,
+      0xff, 0x23, 0x0, 0x2, 0x0, 0x2, 0x0, 0x2, 0x0, 0x1a, 0x0, 0x4, 0x0, 0x7,
+      0x0, 0x5, 0x0, 0xc, 0x0, 0x6, 0x0, 0xa, 0x0, 0x7, 0x0, 0x2, 0x0, 0x2, 0x0,
+      0x3, 0x0, 0xfa, 0xff, 0xf6, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x4, 0x0, 0x0,
+      0x0, 0xc, 0x0, 0x6, 0x0, 0xfb, 0xff, 0xfe, 0xff, 0xf5, 0xff, 0xf7, 0xff,
+      0xf3, 0xff, 0xce, 0xff, 0x11, 0x0, 0x0, 0x0, 0xee, 0xff, 0xe7, 0xff, 0x13,
+      0x0, 0xf7, 0xff, 0xfc, 0xff, 0x15, 0x0, 0xf2, 0xff, 0xff, 0xff, 0xf1,
+      0xff, 0xf1, 0xff, 0x5, 0x0, 0xf1, 0xff, 0x14, 0x0, 0xb, 0x0, 0xf5, 0xff,
+      0xfe, 0xff, 0xed, 0xff, 0xfa, 0xff, 0x6, 0x0, 0x2, 0x0, 0x5, 0x0, 0x11,
+      0x0, 0xfd, 0xff, 0x4, 0x0, 0xfd, 0xff, 0x3, 0x0, 0xf7, 0xff, 0xb, 0x0,
+      0x3, 0x0, 0xff, 0xff, 0xf7, 0xff, 0x4, 0x0, 0xf6, 0xff, 0xcd, 0xff, 0xc,
+      0x0, 0x5, 0x0, 0xf7, 0xff, 0xfa, 0xff, 0x9, 0x0, 0x1a, 0x0, 0xf3, 0xff,
+      0x9, 0x0, 0xf0, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xa, 0x0, 0xfa,
+      0xff, 0xf7, 0xff, 0xef, 0xff, 0xe, 0x0, 0x0, 0x0, 0xf0, 0xff, 0xf0, 0xff,
+      0x8, 0x0, 0x6, 0x0, 0xf, 0x0, 0xf3, 0xff, 0xec, 0xff, 0x8, 0x0, 0x3, 0x0,
+      0x1, 0x0, 0xf8, 0xff, 0x7, 0x0, 0x3, 0x0, 0xfd, 0xff, 0xf9, 0xff, 0xf3,
+      0xff, 0xfb, 0xff, 0xe3, 0xff, 0x24, 0x0, 0xef, 0xff, 0x1c, 0x0, 0x1a, 0x0,
+      0xe6, 0xff, 0x0, 0x0, 0xfc, 0xff, 0x1e, 0x0, 0xb, 0x0, 0x4, 0x0, 0xff,
+      0xff, 0x13, 0x0, 0xff, 0xff, 0x2, 0x0, 0xe, 0x0, 0x10, 0x0, 0xff, 0xff,
+      0x8, 0x0, 0x2, 0x0, 0xff, 0xff, 0x0, 0x0, 0x6, 0x0, 0xfd, 0xff, 0xfd,
+      0xff, 0xfb, 0xff, 0xfd, 0xff, 0x6, 0x0, 0xfc, 0xff, 0xfe, 0xff, 0x4, 0x0,
+      0xfc, 0xff, 0xfc, 0xff, 0xf7, 0xff, 0xfd, 0xff, 0xf4, 0xff, 0xca, 0xff,
+      0x4, 0x0, 0x5, 0x0, 0xe3, 0xff, 0xe6, 0xff, 0x16, 0x0, 0xf6, 0xff, 0xf9,
+      0xff, 0x8, 0x0, 0xef, 0xff, 0xfa, 0xff, 0xf0, 0xff, 0xe9, 0xff, 0x5, 0x0,
+      0xf6, 0xff, 0x14, 0x0, 0x1, 0x0, 0xf6, 0xff, 0xfe, 0xff, 0xeb, 0xff, 0xfa,
+      0xff, 0x5, 0x0, 0x6, 0x0, 0xb, 0x0, 0xb, 0x0, 0xfb, 0xff, 0x4, 0x0, 0xfe,
+      0xff, 0xfe, 0xff, 0xef, 0xff, 0xa, 0x0, 0x3, 0x0, 0x2, 0x0, 0xfa, 0xff,
+      0x4, 0x0, 0xfa, 0xff, 0xd7, 0xff, 0x7, 0x0, 0x6, 0x0, 0x2, 0x0, 0x8, 0x0,
+      0x3, 0x0, 0x1c, 0x0, 0xee, 0xff, 0xd, 0x0, 0xf5, 0xff, 0xf9, 0xff, 0xa,
+      0x0, 0x0, 0x0, 0xa, 0x0, 0xff, 0xff, 0xf6, 0xff, 0xef, 0xff, 0xe, 0x0,
+      0x5, 0x0, 0xfe, 0xff, 0xf7, 0xff, 0x9, 0x0, 0x5, 0x0, 0xc, 0x0, 0xed,
+      0xff, 0xef, 0xff, 0x3, 0x0, 0x1, 0x0, 0xff, 0xff, 0xfe, 0xff, 0x4, 0x0,
+      0x1, 0x0, 0xfc, 0xff, 0xfd, 0xff, 0xf1, 0xff, 0x0, 0x0, 0xe2, 0xff, 0x19,
+      0x0, 0xf0, 0xff, 0x14, 0x0, 0x14, 0x0, 0xeb, 0xff, 0xfb, 0xff, 0xfb, 0xff,
+      0x1a, 0x0, 0x6, 0x0, 0x5, 0x0, 0xf9, 0xff, 0x16, 0x0, 0xff, 0xff, 0x1,
+      0x0, 0xe, 0x0, 0x14, 0x0, 0xf7, 0xff, 0x9, 0x0, 0xfe, 0xff, 0x4, 0x0, 0x1,
+      0x0, 0x4, 0x0, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x3, 0x0,
+      0xfc, 0xff, 0x1, 0x0, 0x4, 0x0, 0xfa, 0xff, 0xff, 0xff, 0xf8, 0xff, 0x3,
+      0x0, 0xf6, 0xff, 0xca, 0xff, 0xfb, 0xff, 0xa, 0x0, 0xe0, 0xff, 0xe1, 0xff,
+      0x1a, 0x0, 0xff, 0xff, 0xfc, 0xff, 0x2, 0x0, 0xe7, 0xff, 0xf7, 0xff, 0xf3,
+      0xff, 0xea, 0xff, 0x3, 0x0, 0xf9, 0xff, 0xd, 0x0, 0xfc, 0xff, 0xfd, 0xff,
+      0xfc, 0xff, 0xeb, 0xff, 0xfb, 0xff, 0x8, 0x0, 0xff, 0xff, 0xa, 0x0, 0xa,
+      0x0, 0xf9, 0xff, 0x6, 0x0, 0xfd, 0xff, 0x2, 0x0, 0xf6, 0xff, 0x9, 0x0,
+      0x7, 0x0, 0x0, 0x0, 0xfd, 0xff, 0x2, 0x0, 0x0, 0x0, 0xdd, 0xff, 0xa, 0x0,
+      0xfc, 0xff, 0x11, 0x0, 0x10, 0x0, 0xfa, 0xff, 0x16, 0x0, 0xf6, 0xff, 0xb,
+      0x0, 0x0, 0x0, 0xf9, 0xff, 0x8, 0x0, 0x2, 0x0, 0x9, 0x0, 0x1, 0x0, 0xf2,
+      0xff, 0xfb, 0xff, 0xc, 0x0, 0x7, 0x0, 0xff, 0xff, 0xf3, 0xff, 0x4, 0x0,
+      0x3, 0x0, 0x5, 0x0, 0xeb, 0xff, 0xf2, 0xff, 0x5, 0x0, 0x6, 0x0, 0x2, 0x0,
+      0x1, 0x0, 0x3, 0x0, 0x0, 0x0, 0xfa, 0xff, 0xfd, 0xff, 0xf7, 0xff, 0xfd,
+      0xff, 0xdf, 0xff, 0x10, 0x0, 0xf4, 0xff, 0xa, 0x0, 0xff, 0xff, 0xef, 0xff,
+      0xf1, 0xff, 0x2, 0x0, 0xd, 0x0, 0x1, 0x0, 0x1, 0x0, 0xf2, 0xff, 0xb, 0x0,
+      0xfb, 0xff, 0x1, 0x0, 0x10, 0x0, 0x18, 0x0, 0xf8, 0xff, 0x4, 0x0, 0xfa,
+      0xff, 0x4, 0x0, 0x3, 0x0, 0x1, 0x0, 0xf9, 0xff, 0x5, 0x0, 0x1, 0x0, 0x2,
+      0x0, 0x3, 0x0, 0xfe, 0xff, 0xff, 0xff, 0x5, 0x0, 0xfe, 0xff, 0x1, 0x0,
+      0xf9, 0xff, 0x9, 0x0, 0xf8, 0xff, 0xcc, 0xff, 0xf6, 0xff, 0xd, 0x0, 0xe2,
+      0xff, 0xe1, 0xff, 0x19, 0x0, 0x3, 0x0, 0xfa, 0xff, 0xfb, 0xff, 0xee, 0xff,
+      0xf4, 0xff, 0xf9, 0xff, 0xe3, 0xff, 0x9, 0x0, 0xf6, 0xff, 0x2, 0x0, 0xfb,
+      0xff, 0x0, 0x0, 0xfd, 0xff, 0xee, 0xff, 0xf3, 0xff, 0x8, 0x0, 0x1, 0x0,
+      0xa, 0x0, 0x2, 0x0, 0xf9, 0xff, 0x9, 0x0, 0x0, 0x0, 0x4, 0x0, 0xf6, 0xff,
+      0x8, 0x0, 0x5, 0x0, 0xfe, 0xff, 0xfd, 0xff, 0x2, 0x0, 0x0, 0x0, 0xe0,
+      0xff, 0xa, 0x0, 0xfa, 0xff, 0x16, 0x0, 0x14, 0x0, 0xef, 0xff, 0x11, 0x0,
+      0xf9, 0xff, 0xa, 0x0, 0x4, 0x0, 0xfc, 0xff, 0x3, 0x0, 0xb, 0x0, 0x9, 0x0,
+      0x5, 0x0, 0xf3, 0xff, 0x1, 0x0, 0x9, 0x0, 0x7, 0x0, 0x2, 0x0, 0xf6, 0xff,
+      0x0, 0x0, 0x3, 0x0, 0x1, 0x0, 0xed, 0xff, 0xf4, 0xff, 0x4, 0x0, 0x5, 0x0,
+      0xff, 0xff, 0x2, 0x0, 0x2, 0x0, 0xfb, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xf8,
+      0xff, 0xfd, 0xff, 0xdc, 0xff, 0xa, 0x0, 0xf9, 0xff, 0x1, 0x0, 0xf9, 0xff,
+      0xf7, 0xff, 0xf3, 0xff, 0x1, 0x0, 0xc, 0x0, 0xff, 0xff, 0xff, 0xff, 0xf1,
+      0xff, 0xa, 0x0, 0xfd, 0xff, 0xfd, 0xff, 0x10, 0x0, 0x14, 0x0, 0xf6, 0xff,
+      0x2, 0x0, 0xf8, 0xff, 0x2, 0x0, 0x2, 0x0, 0xff, 0xff, 0xfa, 0xff, 0xa,
+      0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfd, 0xff, 0x4, 0x0, 0xfe,
+      0xff, 0x1, 0x0, 0xf9, 0xff, 0x7, 0x0, 0xfa, 0xff, 0xcd, 0xff, 0xf4, 0xff,
+      0xe, 0x0, 0xe7, 0xff, 0xe9, 0xff, 0x15, 0x0, 0xc, 0x0, 0xfa, 0xff, 0xfb,
+      0xff, 0xf1, 0xff, 0xf1, 0xff, 0xfa, 0xff, 0xe8, 0xff, 0xb, 0x0, 0xf8,
+      0xff, 0xfb, 0xff, 0xf6, 0xff, 0x3, 0x0, 0xfe, 0xff, 0xee, 0xff, 0xf2,
+      0xff, 0x4, 0x0, 0xff, 0xff, 0xc, 0x0, 0x0, 0x0, 0xf4, 0xff, 0x8, 0x0, 0x1,
+      0x0, 0x4, 0x0, 0xf7, 0xff, 0x6, 0x0, 0x2, 0x0, 0xff, 0xff, 0xfe, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xe5, 0xff, 0xc, 0x0, 0xfc, 0xff, 0x1c, 0x0, 0x15,
+      0x0, 0xe9, 0xff, 0xd, 0x0, 0xfe, 0xff, 0xb, 0x0, 0x8, 0x0, 0xfb, 0xff,
+      0x1, 0x0, 0x11, 0x0, 0x4, 0x0, 0x3, 0x0, 0xfb, 0xff, 0x6, 0x0, 0x8, 0x0,
+      0x5, 0x0, 0x7, 0x0, 0xfc, 0xff, 0x0, 0x0, 0xff, 0xff, 0xfe, 0xff, 0xf6,
+      0xff, 0xf5, 0xff, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x5, 0x0, 0x1, 0x0, 0xfb,
+      0xff, 0xfd, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xda, 0xff, 0x4,
+      0x0, 0xff, 0xff, 0xf9, 0xff, 0xf3, 0xff, 0xfe, 0xff, 0xf2, 0xff, 0x2, 0x0,
+      0x3, 0x0, 0x1, 0x0, 0xfc, 0xff, 0xf1, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xf8,
+      0xff, 0x10, 0x0, 0x13, 0x0, 0xf6, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xff,
+      0xff, 0x1, 0x0, 0xfe, 0xff, 0x1, 0x0, 0xc, 0x0, 0x0, 0x0, 0x2, 0x0, 0x2,
+      0x0, 0x1, 0x0, 0xfb, 0xff, 0x5, 0x0, 0xff, 0xff, 0x2, 0x0, 0xfa, 0xff,
+      0x9, 0x0, 0xf9, 0xff, 0xcf, 0xff, 0xf4, 0xff, 0xd, 0x0, 0xee, 0xff, 0xee,
+      0xff, 0x11, 0x0, 0xb, 0x0, 0xfa, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf5, 0xff,
+      0xff, 0xff, 0xe9, 0xff, 0xa, 0x0, 0xfa, 0xff, 0xfc, 0xff, 0xf4, 0xff, 0x7,
+      0x0, 0x0, 0x0, 0xf2, 0xff, 0xf3, 0xff, 0x4, 0x0, 0x1, 0x0, 0xd, 0x0, 0xff,
+      0xff, 0xf2, 0xff, 0x6, 0x0, 0x2, 0x0, 0x3, 0x0, 0xf9, 0xff, 0x5, 0x0, 0x3,
+      0x0, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0x1, 0x0, 0xe6, 0xff, 0x10, 0x0,
+      0xf4, 0xff, 0x1c, 0x0, 0x18, 0x0, 0xe8, 0xff, 0x3, 0x0, 0xff, 0xff, 0x8,
+      0x0, 0xe, 0x0, 0xfe, 0xff, 0x3, 0x0, 0x12, 0x0, 0x4, 0x0, 0x3, 0x0, 0xff,
+      0xff, 0xc, 0x0, 0x2, 0x0, 0x8, 0x0, 0x6, 0x0, 0xfc, 0xff, 0xfc, 0xff, 0x3,
+      0x0, 0xfe, 0xff, 0xf9, 0xff, 0xf8, 0xff, 0xfd, 0xff, 0x7, 0x0, 0xff, 0xff,
+      0x3, 0x0, 0x1, 0x0, 0xfa, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xfb,
+      0xff, 0xd4, 0xff, 0x0, 0x0, 0x1, 0x0, 0xee, 0xff, 0xeb, 0xff, 0x6, 0x0,
+      0xf1, 0xff, 0x1, 0x0, 0xfd, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xf2, 0xff,
+      0xfa, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xf, 0x0, 0xd, 0x0, 0xf7, 0xff, 0xff,
+      0xff, 0xf0, 0xff, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x3, 0x0, 0xd, 0x0, 0xfe,
+      0xff, 0x2, 0x0, 0xff, 0xff, 0x0, 0x0, 0xf8, 0xff, 0x6, 0x0, 0x0, 0x0, 0x4,
+      0x0, 0xfb, 0xff, 0x7, 0x0, 0xfc, 0xff, 0xd4, 0xff, 0xf7, 0xff, 0x9, 0x0,
+      0xf8, 0xff, 0xf8, 0xff, 0xd, 0x0, 0xe, 0x0, 0xf9, 0xff, 0xf8, 0xff, 0xfa,
+      0xff, 0xf5, 0xff, 0x5, 0x0, 0xf4, 0xff, 0xb, 0x0, 0xfb, 0xff, 0xf8, 0xff,
+      0xf3, 0xff, 0x8, 0x0, 0x2, 0x0, 0xf7, 0xff, 0xf5, 0xff, 0x4, 0x0, 0x3,
+      0x0, 0xa, 0x0, 0xf9, 0xff, 0xf2, 0xff, 0x4, 0x0, 0x2, 0x0, 0x3, 0x0, 0xfa,
+      0xff, 0x3, 0x0, 0x1, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xf6, 0xff, 0x2, 0x0,
+      0xe6, 0xff, 0xe, 0x0, 0xf5, 0xff, 0x19, 0x0, 0x15, 0x0, 0xea, 0xff, 0xfe,
+      0xff, 0x0, 0x0, 0x8, 0x0, 0xf, 0x0, 0xfe, 0xff, 0x1, 0x0, 0x16, 0x0, 0x1,
+      0x0, 0x4, 0x0, 0x3, 0x0, 0xf, 0x0, 0xff, 0xff, 0x7, 0x0, 0x5, 0x0, 0x2,
+      0x0, 0xfe, 0xff, 0x3, 0x0, 0xfc, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfe, 0xff,
+      0x4, 0x0, 0xfe, 0xff, 0x0, 0x0, 0x0, 0x0, 0xfa, 0xff, 0x1, 0x0, 0xfa,
+      0xff, 0xfc, 0xff, 0xfb, 0xff, 0xd3, 0xff, 0xfb, 0xff, 0x5, 0x0, 0xe9,
+      0xff, 0xe7, 0xff, 0xf, 0x0, 0xf4, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xf8,
+      0xff, 0xfa, 0xff, 0xf7, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xd,
+      0x0, 0x6, 0x0, 0xfa, 0xff, 0xfd, 0xff, 0xf0, 0xff, 0x1, 0x0, 0x6, 0x0,
+      0x1, 0x0, 0x5, 0x0, 0xc, 0x0, 0xfe, 0xff, 0x3, 0x0, 0xfd, 0xff, 0x1, 0x0,
+      0xf7, 0xff, 0x5, 0x0, 0x4, 0x0, 0x3, 0x0, 0xfd, 0xff, 0x2, 0x0, 0xff,
+      0xff, 0xd7, 0xff, 0xfb, 0xff, 0x4, 0x0, 0x1, 0x0, 0x2, 0x0, 0x8, 0x0, 0xe,
+      0x0, 0xf8, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0x8, 0x0, 0xf9, 0xff,
+      0xa, 0x0, 0xfe, 0xff, 0xf5, 0xff, 0xf6, 0xff, 0x7, 0x0, 0x5, 0x0, 0xf8,
+      0xff, 0xf6, 0xff, 0x2, 0x0, 0x6, 0x0, 0x9, 0x0, 0xf5, 0xff, 0xf4, 0xff,
+      0x4, 0x0, 0x2, 0x0, 0x1, 0x0, 0xfa, 0xff, 0x2, 0x0, 0x0, 0x0, 0xfe, 0xff,
+      0xff, 0xff, 0xf4, 0xff, 0x0, 0x0, 0xe4, 0xff, 0x10, 0x0, 0xf3, 0xff, 0x13,
+      0x0, 0xe, 0x0, 0xed, 0xff, 0xf9, 0xff, 0x1, 0x0, 0x7, 0x0, 0xa, 0x0, 0x0,
+      0x0, 0xff, 0xff, 0x14, 0x0, 0xfe, 0xff, 0x4, 0x0, 0x9, 0x0, 0x11, 0x0,
+      0xfb, 0xff, 0x6, 0x0, 0x1, 0x0, 0x5, 0x0, 0xff, 0xff, 0x4, 0x0, 0xfc,
+      0xff, 0x0, 0x0, 0xfe, 0xff, 0xfe, 0xff, 0x2, 0x0, 0xfe, 0xff, 0xfd, 0xff,
+      0x1, 0x0, 0xfd, 0xff, 0x2, 0x0, 0xfa, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xd1,
+      0xff, 0xfa, 0xff, 0x5, 0x0, 0xe7, 0xff, 0xe7, 0xff, 0x12, 0x0, 0xf7, 0xff,
+      0xfd, 0xff, 0xf8, 0xff, 0xf7, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf0, 0xff,
+      0x2, 0x0, 0xf8, 0xff, 0x9, 0x0, 0x2, 0x0, 0xfa, 0xff, 0xff, 0xff, 0xee,
+      0xff, 0xfe, 0xff, 0x4, 0x0, 0x3, 0x0, 0x8, 0x0, 0x7, 0x0, 0xfd, 0xff, 0x5,
+      0x0, 0xfe, 0xff, 0x2, 0x0, 0xf4, 0xff, 0x5, 0x0, 0x4, 0x0, 0x3, 0x0, 0xfe,
+      0xff, 0xff, 0xff, 0xfe, 0xff, 0xdc, 0xff, 0xff, 0xff, 0x1, 0x0, 0x8, 0x0,
+      0x7, 0x0, 0x0, 0x0, 0xd, 0x0, 0xf9, 0xff, 0xfc, 0xff, 0x0, 0x0, 0xfa,
+      0xff, 0x8, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0xf7, 0xff, 0xf9, 0xff, 0x6,
+      0x0, 0x6, 0x0, 0xfd, 0xff, 0xfa, 0xff, 0x1, 0x0, 0x6, 0x0, 0x6, 0x0, 0xf3,
+      0xff, 0xf5, 0xff, 0x2, 0x0, 0x2, 0x0, 0x0, 0x0, 0xfb, 0xff, 0x1, 0x0,
+      0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xe,
+      0x0, 0xf6, 0xff, 0xd, 0x0, 0x8, 0x0, 0xf1, 0xff, 0xf5, 0xff, 0x1, 0x0,
+      0x5, 0x0, 0x9, 0x0, 0x0, 0x0, 0xfd, 0xff, 0xf, 0x0, 0xfd, 0xff, 0x1, 0x0,
+      0xb, 0x0, 0x10, 0x0, 0xf9, 0xff, 0x5, 0x0, 0x2, 0x0, 0x6, 0x0, 0xff, 0xff,
+      0x3, 0x0, 0xfd, 0xff, 0x2, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x1, 0x0, 0xff,
+      0xff, 0xfd, 0xff, 0x1, 0x0, 0xfd, 0xff, 0x4, 0x0, 0xfb, 0xff, 0xfe, 0xff,
+      0xfb, 0xff, 0xd1, 0xff, 0xf6, 0xff, 0x8, 0x0, 0xe7, 0xff, 0xe8, 0xff,
+      0x14, 0x0, 0xfb, 0xff, 0xfb, 0xff, 0xf6, 0xff, 0xf5, 0xff, 0xfa, 0xff,
+      0xfd, 0xff, 0xed, 0xff, 0x4, 0x0, 0xfa, 0xff, 0x4, 0x0, 0xfc, 0xff, 0xfe,
+      0xff, 0xff, 0xff, 0xf1, 0xff, 0xfe, 0xff, 0x4, 0x0, 0x3, 0x0, 0xa, 0x0,
+      0x4, 0x0, 0xfc, 0xff, 0x5, 0x0, 0xfd, 0xff, 0x2, 0x0, 0xf6, 0xff, 0x5,
+      0x0, 0x4, 0x0, 0x4, 0x0, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xe0, 0xff,
+      0x3, 0x0, 0xfe, 0xff, 0xf, 0x0, 0xc, 0x0, 0xfb, 0xff, 0xa, 0x0, 0xfa,
+      0xff, 0xff, 0xff, 0x3, 0x0, 0xfc, 0xff, 0xa, 0x0, 0x5, 0x0, 0x6, 0x0, 0x2,
+      0x0, 0xf9, 0xff, 0xfc, 0xff, 0x6, 0x0, 0x6, 0x0, 0x2, 0x0, 0xfc, 0xff,
+      0x0, 0x0, 0x6, 0x0, 0x4, 0x0, 0xf5, 0xff, 0xf7, 0xff, 0x1, 0x0, 0x2, 0x0,
+      0x1, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xff, 0xff, 0xf3,
+      0xff, 0xff, 0xff, 0xe2, 0xff, 0xb, 0x0, 0xf8, 0xff, 0x6, 0x0, 0x2, 0x0,
+      0xf7, 0xff, 0xf3, 0xff, 0x2, 0x0, 0x4, 0x0, 0x6, 0x0, 0xff, 0xff, 0xfc,
+      0xff, 0x9, 0x0, 0xfc, 0xff, 0x0, 0x0, 0xb, 0x0, 0xf, 0x0, 0xf8, 0xff, 0x3,
+      0x0, 0xfd, 0xff, 0x4, 0x0, 0xff, 0xff, 0x3, 0x0, 0x0, 0x0, 0x4, 0x0, 0x1,
+      0x0, 0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0xfc, 0xff, 0x3, 0x0, 0xff, 0xff,
+      0x4, 0x0, 0xfb, 0xff, 0x1, 0x0, 0xfa, 0xff, 0xd3, 0xff, 0xf6, 0xff, 0x8,
+      0x0, 0xeb, 0xff, 0xea, 0xff, 0x13, 0x0, 0xfe, 0xff, 0xfa, 0xff, 0xf5,
+      0xff, 0xf4, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xed, 0xff, 0x6, 0x0, 0xfa,
+      0xff, 0x2, 0x0, 0xf9, 0xff, 0x1, 0x0, 0xff, 0xff, 0xf2, 0xff, 0xfb, 0xff,
+      0x5, 0x0, 0x3, 0x0, 0xa, 0x0, 0x2, 0x0, 0xfa, 0xff, 0x5, 0x0, 0xff, 0xff,
+      0x3, 0x0, 0xf8, 0xff, 0x4, 0x0, 0x4, 0x0, 0x2, 0x0, 0x0, 0x0, 0xfb, 0xff,
+      0x0, 0x0, 0xe4, 0xff, 0x6, 0x0, 0xfa, 0xff, 0x13, 0x0, 0x10, 0x0, 0xf4,
+      0xff, 0x7, 0x0, 0xfc, 0xff, 0x0, 0x0, 0x6, 0x0, 0xfd, 0xff, 0x7, 0x0, 0x9,
+      0x0, 0x6, 0x0, 0x2, 0x0, 0xfb, 0xff, 0x1, 0x0, 0x4, 0x0, 0x7, 0x0, 0x2,
+      0x0, 0xfc, 0xff, 0xfe, 0xff, 0x4, 0x0, 0x2, 0x0, 0xf5, 0xff, 0xf9, 0xff,
+      0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0xfc, 0xff, 0x0, 0x0,
+      0xfe, 0xff, 0xf6, 0xff, 0xfd, 0xff, 0xdf, 0xff, 0x7, 0x0, 0xfb, 0xff,
+      0xff, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0xf3, 0xff, 0x2, 0x0, 0x0, 0x0, 0x2,
+      0x0, 0xfe, 0xff, 0xf9, 0xff, 0x4, 0x0, 0xfe, 0xff, 0xfd, 0xff, 0xd, 0x0,
+      0xe, 0x0, 0xf8, 0xff, 0x1, 0x0, 0xfb, 0xff, 0x4, 0x0, 0x0, 0x0, 0x1, 0x0,
+      0x0, 0x0, 0x6, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfd, 0xff,
+      0x3, 0x0, 0x0, 0x0, 0x5, 0x0, 0xfb, 0xff, 0x2, 0x0, 0xfc, 0xff, 0xd6,
+      0xff, 0xf7, 0xff, 0x8, 0x0, 0xf0, 0xff, 0xf0, 0xff, 0x10, 0x0, 0x3, 0x0,
+      0xf9, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf9, 0xff, 0x0, 0x0, 0xef, 0xff, 0x7,
+      0x0, 0xfb, 0xff, 0xff, 0xff, 0xf8, 0xff, 0x3, 0x0, 0xff, 0xff, 0xf5, 0xff,
+      0xf9, 0xff, 0x4, 0x0, 0x3, 0x0, 0x9, 0x0, 0xfd, 0xff, 0xf8, 0xff, 0x5,
+      0x0, 0x0, 0x0, 0x3, 0x0, 0xfb, 0xff, 0x3, 0x0, 0x3, 0x0, 0x1, 0x0, 0x0,
+      0x0, 0xfa, 0xff, 0x0, 0x0, 0xe6, 0xff, 0x8, 0x0, 0xfa, 0xff, 0x14, 0x0,
+      0x10, 0x0, 0xf2, 0xff, 0x4, 0x0, 0xfd, 0xff, 0x3, 0x0, 0x7, 0x0, 0xfd,
+      0xff, 0x6, 0x0, 0xc, 0x0, 0x4, 0x0, 0x3, 0x0, 0xfe, 0xff, 0x4, 0x0, 0x2,
+      0x0, 0x6, 0x0, 0x3, 0x0, 0xfe, 0xff, 0xfe, 0xff, 0x3, 0x0, 0x0, 0x0, 0xf7,
+      0xff, 0xfa, 0xff, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0xfc,
+      0xff, 0x1, 0x0, 0xfd, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xde, 0xff, 0x5, 0x0,
+      0xfe, 0xff, 0xf9, 0xff, 0xf6, 0xff, 0x1, 0x0, 0xf3, 0xff, 0x1, 0x0, 0xff,
+      0xff, 0xfe, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd,
+      0xff, 0xc, 0x0, 0xa, 0x0, 0xf9, 0xff, 0xff, 0xff, 0xf9, 0xff, 0x2, 0x0,
+      0x1, 0x0, 0x1, 0x0, 0x2, 0x0, 0x6, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1,
+      0x0, 0xfd, 0xff, 0x3, 0x0, 0x1, 0x0, 0x4, 0x0, 0xfc, 0xff, 0x2, 0x0, 0xfd,
+      0xff, 0xd8, 0xff, 0xf8, 0xff, 0x7, 0x0, 0xf4, 0xff, 0xf6, 0xff, 0xd, 0x0,
+      0x6, 0x0, 0xf9, 0xff, 0xf9, 0xff, 0xf7, 0xff, 0xf9, 0xff, 0x2, 0x0, 0xf1,
+      0xff, 0x8, 0x0, 0xfc, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0x5, 0x0, 0x0, 0x0,
+      0xf7, 0xff, 0xf8, 0xff, 0x2, 0x0, 0x3, 0x0, 0x8, 0x0, 0xfb, 0xff, 0xf8,
+      0xff, 0x5, 0x0, 0x1, 0x0, 0x3, 0x0, 0xfd, 0xff, 0x3, 0x0, 0x2, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0xf9, 0xff, 0x0, 0x0, 0xe8, 0xff, 0xb, 0x0, 0xf8, 0xff,
+      0x13, 0x0, 0xf, 0x0, 0xf1, 0xff, 0x1, 0x0, 0xff, 0xff, 0x4, 0x0, 0x6, 0x0,
+      0xff, 0xff, 0x2, 0x0, 0xd, 0x0, 0x2, 0x0, 0x2, 0x0, 0x1, 0x0, 0x7, 0x0,
+      0x1, 0x0, 0x6, 0x0, 0x3, 0x0, 0xfe, 0xff, 0xfe, 0xff, 0x2, 0x0, 0xfe,
+      0xff, 0xfa, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x4, 0x0, 0x0, 0x0, 0x3, 0x0,
+      0x0, 0x0, 0xfd, 0xff, 0x1, 0x0, 0xfd, 0xff, 0xfb, 0xff, 0xfd, 0xff, 0xdc,
+      0xff, 0x1, 0x0, 0x0, 0x0, 0xf3, 0xff, 0xf3, 0xff, 0x5, 0x0, 0xf5, 0xff,
+      0x0, 0x0, 0xfe, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0x0,
+      0x0, 0xfc, 0xff, 0x9, 0x0, 0x7, 0x0, 0xfa, 0xff, 0xff, 0xff, 0xf7, 0xff,
+      0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x4, 0x0, 0x6, 0x0, 0xff, 0xff, 0x2, 0x0,
+      0x0, 0x0, 0x1, 0x0, 0xfc, 0xff, 0x4, 0x0, 0x2, 0x0, 0x3, 0x0, 0xfd, 0xff,
+      0x2, 0x0, 0xfd, 0xff, 0xdc, 0xff, 0xfb, 0xff, 0x5, 0x0, 0xfb, 0xff, 0xfd,
+      0xff, 0x8, 0x0, 0x7, 0x0, 0xfa, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xfa, 0xff,
+      0x3, 0x0, 0xf7, 0xff, 0x8, 0x0, 0xfd, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0x5,
+      0x0, 0x2, 0x0, 0xfa, 0xff, 0xf8, 0xff, 0x2, 0x0, 0x2, 0x0, 0x7, 0x0, 0xf9,
+      0xff, 0xf7, 0xff, 0x3, 0x0, 0x1, 0x0, 0x2, 0x0, 0xfe, 0xff, 0x2, 0x0, 0x2,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0xf8, 0xff, 0x0, 0x0, 0xe8, 0xff, 0xc, 0x0, 0xf8,
+      0xff, 0x10, 0x0, 0xd, 0x0, 0xf1, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x6, 0x0,
+      0x7, 0x0, 0xff, 0xff, 0x0, 0x0, 0xd, 0x0, 0x1, 0x0, 0x2, 0x0, 0x4, 0x0,
+      0xa, 0x0, 0xff, 0xff, 0x5, 0x0, 0x3, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x2, 0x0,
+      0xfe, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0x3, 0x0, 0x0, 0x0, 0x2,
+      0x0, 0x1, 0x0, 0xfd, 0xff, 0x1, 0x0, 0xfd, 0xff, 0xfd, 0xff, 0xfd, 0xff,
+      0xdb, 0xff, 0xff, 0xff, 0x3, 0x0, 0xf0, 0xff, 0xf1, 0xff, 0x9, 0x0, 0xf8,
+      0xff, 0xff, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xf6,
+      0xff, 0x1, 0x0, 0xfb, 0xff, 0x7, 0x0, 0x4, 0x0, 0xfc, 0xff, 0xff, 0xff,
+      0xf6, 0xff, 0xfe, 0xff, 0x3, 0x0, 0xff, 0xff, 0x5, 0x0, 0x5, 0x0, 0xfe,
+      0xff, 0x2, 0x0, 0xff, 0xff, 0x2, 0x0, 0xfc, 0xff, 0x4, 0x0, 0x3, 0x0, 0x3,
+      0x0, 0xfe, 0xff, 0x1, 0x0, 0xfe, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x3, 0x0,
+      0x0, 0x0, 0x2, 0x0, 0x3, 0x0, 0x8, 0x0, 0xfa, 0xff, 0xfd, 0xff, 0xfc,
+      0xff, 0xfc, 0xff, 0x3, 0x0, 0xfb, 0xff, 0x7, 0x0, 0xff, 0xff, 0xfb, 0xff,
+      0xfa, 0xff, 0x6, 0x0, 0x3, 0x0, 0xfd, 0xff, 0xf9, 0xff, 0x1, 0x0, 0x2,
+      0x0, 0x5, 0x0, 0xf8, 0xff, 0xf8, 0xff, 0x2, 0x0, 0x2, 0x0, 0x2, 0x0, 0x0,
+      0x0, 0x2, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf8, 0xff, 0x0, 0x0, 0xe8,
+      0xff, 0xb, 0x0, 0xf8, 0xff, 0xc, 0x0, 0x9, 0x0, 0xf3, 0xff, 0xfb, 0xff,
+      0x1, 0x0, 0x6, 0x0, 0x6, 0x0, 0xff, 0xff, 0xff, 0xff, 0xb, 0x0, 0x0, 0x0,
+      0x1, 0x0, 0x6, 0x0, 0xb, 0x0, 0xfd, 0xff, 0x4, 0x0, 0x1, 0x0, 0x1, 0x0,
+      0xfe, 0xff, 0x1, 0x0, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x2,
+      0x0, 0x0, 0x0, 0x2, 0x0, 0x2, 0x0, 0xfe, 0xff, 0x2, 0x0, 0xfd, 0xff, 0xff,
+      0xff, 0xfc, 0xff, 0xdb, 0xff, 0xfe, 0xff, 0x4, 0x0, 0xef, 0xff, 0xf1,
+      0xff, 0xb, 0x0, 0xfa, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xfb,
+      0xff, 0xfb, 0xff, 0xf4, 0xff, 0x3, 0x0, 0xfb, 0xff, 0x5, 0x0, 0x1, 0x0,
+      0xfe, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xfd, 0xff, 0x3, 0x0, 0x1, 0x0, 0x6,
+      0x0, 0x3, 0x0, 0xfe, 0xff, 0x3, 0x0, 0x0, 0x0, 0x2, 0x0, 0xfc, 0xff, 0x4,
+      0x0, 0x3, 0x0, 0x3, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xff, 0xff, 0xe2, 0xff,
+      0x2, 0x0, 0x0, 0x0, 0x5, 0x0, 0x6, 0x0, 0xff, 0xff, 0x7, 0x0, 0xfb, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0x5, 0x0, 0xff, 0xff, 0x7, 0x0, 0x1,
+      0x0, 0xfb, 0xff, 0xfc, 0xff, 0x5, 0x0, 0x4, 0x0, 0xfe, 0xff, 0xfa, 0xff,
+      0x0, 0x0, 0x2, 0x0, 0x4, 0x0, 0xf7, 0xff, 0xf9, 0xff, 0x1, 0x0, 0x2, 0x0,
+      0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf9, 0xff,
+      0xff, 0xff, 0xe7, 0xff, 0xb, 0x0, 0xfa, 0xff, 0x7, 0x0, 0x5, 0x0, 0xf7,
+      0xff, 0xf9, 0xff, 0x1, 0x0, 0x4, 0x0, 0x4, 0x0, 0xff, 0xff, 0xfd, 0xff,
+      0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0xb, 0x0, 0xfc, 0xff, 0x4, 0x0,
+      0x0, 0x0, 0x1, 0x0, 0xfe, 0xff, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0, 0x0, 0x0,
+      0xff, 0xff, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0xff, 0xff, 0x3, 0x0,
+      0xfc, 0xff, 0x1, 0x0, 0xfd, 0xff, 0xdb, 0xff, 0xfd, 0xff, 0x5, 0x0, 0xf0,
+      0xff, 0xf2, 0xff, 0xc, 0x0, 0xfe, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xf9,
+      0xff, 0xfb, 0xff, 0xfd, 0xff, 0xf4, 0xff, 0x4, 0x0, 0xfc, 0xff, 0x3, 0x0,
+      0xfe, 0xff, 0x0, 0x0, 0xff, 0xff, 0xf7, 0xff, 0xfd, 0xff, 0x3, 0x0, 0x0,
+      0x0, 0x7, 0x0, 0x1, 0x0, 0xfd, 0xff, 0x3, 0x0, 0x0, 0x0, 0x2, 0x0, 0xfc,
+      0xff, 0x4, 0x0, 0x3, 0x0, 0x2, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xe5, 0xff, 0x5, 0x0, 0xfe, 0xff, 0x9, 0x0, 0x8, 0x0, 0xfc, 0xff, 0x6,
+      0x0, 0xfc, 0xff, 0x1, 0x0, 0x1, 0x0, 0xfe, 0xff, 0x4, 0x0, 0x3, 0x0, 0x6,
+      0x0, 0x1, 0x0, 0xfd, 0xff, 0xff, 0xff, 0x4, 0x0, 0x4, 0x0, 0x0, 0x0, 0xfb,
+      0xff, 0xff, 0xff, 0x2, 0x0, 0x2, 0x0, 0xf8, 0xff, 0xfb, 0xff, 0x0, 0x0,
+      0x2, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
+      0xfa, 0xff, 0xfe, 0xff, 0xe6, 0xff, 0x9, 0x0, 0xfb, 0xff, 0x2, 0x0, 0x0,
+      0x0, 0xfb, 0xff, 0xf8, 0xff, 0x1, 0x0, 0x2, 0x0, 0x3, 0x0, 0xfe, 0xff,
+      0xfb, 0xff, 0x5, 0x0, 0x0, 0x0, 0xff, 0xff, 0x9, 0x0, 0xa, 0x0, 0xfb,
+      0xff, 0x2, 0x0, 0xfe, 0xff, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x2,
+      0x0, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0x3, 0x0, 0x0,
+      0x0, 0x3, 0x0, 0xfc, 0xff, 0x2, 0x0, 0xfd, 0xff, 0xdd, 0xff, 0xfc, 0xff,
+      0x5, 0x0, 0xf2, 0xff, 0xf5, 0xff, 0xc, 0x0, 0x0, 0x0, 0xfc, 0xff, 0xfb,
+      0xff, 0xf9, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf4, 0xff, 0x5, 0x0, 0xfc,
+      0xff, 0x0, 0x0, 0xfc, 0xff, 0x1, 0x0, 0x0, 0x0, 0xf8, 0xff, 0xfc, 0xff,
+      0x3, 0x0, 0x0, 0x0, 0x7, 0x0, 0xff, 0xff, 0xfc, 0xff, 0x3, 0x0, 0x0, 0x0,
+      0x2, 0x0, 0xfd, 0xff, 0x4, 0x0, 0x3, 0x0, 0x2, 0x0, 0xff, 0xff, 0xfe,
+      0xff, 0xff, 0xff, 0xe8, 0xff, 0x7, 0x0, 0xfc, 0xff, 0xb, 0x0, 0xa, 0x0,
+      0xf9, 0xff, 0x4, 0x0, 0xfd, 0xff, 0x2, 0x0, 0x3, 0x0, 0xfe, 0xff, 0x3,
+      0x0, 0x6, 0x0, 0x4, 0x0, 0x2, 0x0, 0xff, 0xff, 0x2, 0x0, 0x3, 0x0, 0x4,
+      0x0, 0x1, 0x0, 0xfd, 0xff, 0xff, 0xff, 0x2, 0x0, 0x1, 0x0, 0xf9, 0xff,
+      0xfc, 0xff, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0xfe, 0xff,
+      0x0, 0x0, 0xfe, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xe4, 0xff, 0x7, 0x0, 0xfd,
+      0xff, 0xfd, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf8, 0xff, 0x0, 0x0, 0x1, 0x0,
+      0x1, 0x0, 0xfe, 0xff, 0xfb, 0xff, 0x1, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x8,
+      0x0, 0x8, 0x0, 0xfb, 0xff, 0x2, 0x0, 0xfc, 0xff, 0x1, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x1, 0x0, 0x3, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0xfe,
+      0xff, 0x3, 0x0, 0x0, 0x0, 0x3, 0x0, 0xfd, 0xff, 0x2, 0x0, 0xfe, 0xff,
+      0xdf, 0xff, 0xfe, 0xff, 0x4, 0x0, 0xf6, 0xff, 0xf8, 0xff, 0xa, 0x0, 0x2,
+      0x0, 0xfc, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf6,
+      0xff, 0x6, 0x0, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xff, 0x3, 0x0, 0x0, 0x0,
+      0xf9, 0xff, 0xfb, 0xff, 0x3, 0x0, 0x1, 0x0, 0x6, 0x0, 0xfd, 0xff, 0xfb,
+      0xff, 0x3, 0x0, 0x0, 0x0, 0x2, 0x0, 0xfd, 0xff, 0x3, 0x0, 0x2, 0x0, 0x1,
+      0x0, 0xff, 0xff, 0xfc, 0xff, 0x0, 0x0, 0xe9, 0xff, 0x8, 0x0, 0xfb, 0xff,
+      0xb, 0x0, 0xa, 0x0, 0xf7, 0xff, 0x2, 0x0, 0xfe, 0xff, 0x3, 0x0, 0x4, 0x0,
+      0xff, 0xff, 0x2, 0x0, 0x7, 0x0, 0x3, 0x0, 0x1, 0x0, 0x0, 0x0, 0x4, 0x0,
+      0x2, 0x0, 0x4, 0x0, 0x1, 0x0, 0xfd, 0xff, 0xfe, 0xff, 0x2, 0x0, 0x0, 0x0,
+      0xfa, 0xff, 0xfd, 0xff, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0,
+      0xfe, 0xff, 0x1, 0x0, 0xfe, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xe3, 0xff, 0x5,
+      0x0, 0xff, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0x3, 0x0, 0xf9, 0xff, 0x0, 0x0,
+      0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0x1, 0x0,
+      0xfc, 0xff, 0x7, 0x0, 0x6, 0x0, 0xfc, 0xff, 0x1, 0x0, 0xfb, 0xff, 0x0,
+      0x0, 0x1, 0x0, 0x0, 0x0, 0x2, 0x0, 0x3, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+      0x1, 0x0, 0xfd, 0xff, 0x3, 0x0, 0x1, 0x0, 0x3, 0x0, 0xfd, 0xff, 0x2, 0x0,
+      0xfe, 0xff, 0xe1, 0xff, 0xff, 0xff, 0x3, 0x0, 0xf9, 0xff, 0xfc, 0xff, 0x7,
+      0x0, 0x4, 0x0, 0xfc, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0x1, 0x0,
+      0xf8, 0xff, 0x5, 0x0, 0xfe, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0x4, 0x0, 0x0,
+      0x0, 0xfb, 0xff, 0xfa, 0xff, 0x2, 0x0, 0x1, 0x0, 0x6, 0x0, 0xfb, 0xff,
+      0xfb, 0xff, 0x3, 0x0, 0x1, 0x0, 0x1, 0x0, 0xfe, 0xff, 0x2, 0x0, 0x1, 0x0,
+      0x1, 0x0, 0x0, 0x0, 0xfb, 0xff, 0xff, 0xff, 0xea, 0xff, 0x9, 0x0, 0xfa,
+      0xff, 0xa, 0x0, 0x8, 0x0, 0xf8, 0xff, 0x0, 0x0, 0xff, 0xff, 0x4, 0x0, 0x4,
+      0x0, 0xff, 0xff, 0x1, 0x0, 0x7, 0x0, 0x2, 0x0, 0x1, 0x0, 0x2, 0x0, 0x6,
+      0x0, 0x0, 0x0, 0x4, 0x0, 0x1, 0x0, 0xfe, 0xff, 0xff, 0xff, 0x1, 0x0, 0xff,
+      0xff, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x2, 0x0, 0x0, 0x0, 0x1, 0x0,
+      0x1, 0x0, 0xfd, 0xff, 0x1, 0x0, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xe2,
+      0xff, 0x3, 0x0, 0x0, 0x0, 0xf7, 0xff, 0xf7, 0xff, 0x5, 0x0, 0xfa, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xfc, 0xff,
+      0x1, 0x0, 0xfc, 0xff, 0x6, 0x0, 0x4, 0x0, 0xfd, 0xff, 0x0, 0x0, 0xfa,
+      0xff, 0xff, 0xff, 0x2, 0x0, 0x0, 0x0, 0x3, 0x0, 0x3, 0x0, 0xff, 0xff, 0x2,
+      0x0, 0x0, 0x0, 0x1, 0x0, 0xfd, 0xff, 0x3, 0x0, 0x1, 0x0, 0x3, 0x0, 0xfe,
+      0xff, 0x1, 0x0, 0xfe, 0xff, 0xe3, 0xff, 0x0, 0x0, 0x2, 0x0, 0xfe, 0xff,
+      0xff, 0xff, 0x5, 0x0, 0x6, 0x0, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc,
+      0xff, 0x2, 0x0, 0xfb, 0xff, 0x5, 0x0, 0xfe, 0xff, 0xfd, 0xff, 0xfc, 0xff,
+      0x4, 0x0, 0x1, 0x0, 0xfd, 0xff, 0xfb, 0xff, 0x1, 0x0, 0x1, 0x0, 0x4, 0x0,
+      0xfa, 0xff, 0xfb, 0xff, 0x2, 0x0, 0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0x2,
+      0x0, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xea, 0xff,
+      0xa, 0x0, 0xfb, 0xff, 0x9, 0x0, 0x6, 0x0, 0xf8, 0xff, 0xfe, 0xff, 0xff,
+      0xff, 0x3, 0x0, 0x4, 0x0, 0xff, 0xff, 0xff, 0xff, 0x7, 0x0, 0x1, 0x0, 0x0,
+      0x0, 0x4, 0x0, 0x7, 0x0, 0xff, 0xff, 0x3, 0x0, 0x1, 0x0, 0xff, 0xff, 0xfe,
+      0xff, 0x1, 0x0, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0xfd, 0xff, 0x2, 0x0, 0xfd, 0xff, 0xff,
+      0xff, 0xfd, 0xff, 0xe2, 0xff, 0x1, 0x0, 0x2, 0x0, 0xf6, 0xff, 0xf6, 0xff,
+      0x7, 0x0, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0xfd, 0xff, 0xfa, 0xff, 0x2, 0x0, 0xfd, 0xff, 0x4, 0x0, 0x1, 0x0, 0xfe,
+      0xff, 0xff, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0x2, 0x0, 0x0, 0x0, 0x4, 0x0,
+      0x2, 0x0, 0xff, 0xff, 0x2, 0x0, 0x0, 0x0, 0x1, 0x0, 0xfd, 0xff, 0x3, 0x0,
+      0x1, 0x0, 0x2, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xfe, 0xff, 0xe6, 0xff, 0x2,
+      0x0, 0x0, 0x0, 0x2, 0x0, 0x2, 0x0, 0x2, 0x0, 0x5, 0x0, 0xfc, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xfd, 0xff, 0x2, 0x0, 0xfe, 0xff, 0x5, 0x0, 0xff, 0xff,
+      0xfd, 0xff, 0xfe, 0xff, 0x4, 0x0, 0x2, 0x0, 0xfe, 0xff, 0xfb, 0xff, 0x1,
+      0x0, 0x1, 0x0, 0x3, 0x0, 0xfa, 0xff, 0xfb, 0xff, 0x2, 0x0, 0x2, 0x0, 0x1,
+      0x0, 0x0, 0x0, 0x2, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xfc, 0xff,
+      0xfe, 0xff, 0xea, 0xff, 0x8, 0x0, 0xfb, 0xff, 0x5, 0x0, 0x3, 0x0, 0xfa,
+      0xff, 0xfd, 0xff, 0x0, 0x0, 0x3, 0x0, 0x3, 0x0, 0xff, 0xff, 0xfe, 0xff,
+      0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x0, 0x7, 0x0, 0xfe, 0xff, 0x2, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x1, 0x0, 0x2, 0x0, 0xfe, 0xff, 0x2, 0x0,
+      0xfd, 0xff, 0x0, 0x0, 0xfd, 0xff, 0xe2, 0xff, 0xff, 0xff, 0x2, 0x0, 0xf6,
+      0xff, 0xf7, 0xff, 0x8, 0x0, 0xfe, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc,
+      0xff, 0xfc, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0x3, 0x0, 0xfc, 0xff, 0x2, 0x0,
+      0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xfa, 0xff, 0xfd, 0xff, 0x2, 0x0, 0x0,
+      0x0, 0x5, 0x0, 0x1, 0x0, 0xfe, 0xff, 0x2, 0x0, 0x0, 0x0, 0x2, 0x0, 0xfe,
+      0xff, 0x3, 0x0, 0x1, 0x0, 0x2, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
+      0xe8, 0xff, 0x3, 0x0, 0xff, 0xff, 0x4, 0x0, 0x4, 0x0, 0xfe, 0xff, 0x4,
+      0x0, 0xfd, 0xff, 0x0, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x2, 0x0, 0x1, 0x0, 0x4,
+      0x0, 0x0, 0x0, 0xfe, 0xff, 0xff, 0xff, 0x4, 0x0, 0x2, 0x0, 0xff, 0xff,
+      0xfc, 0xff, 0x0, 0x0, 0x2, 0x0, 0x2, 0x0, 0xfa, 0xff, 0xfc, 0xff, 0x1,
+      0x0, 0x2, 0x0, 0x1, 0x0, 0x1, 0x0, 0x2, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xff,
+      0xff, 0xfc, 0xff, 0xfe, 0xff, 0xe9, 0xff, 0x7, 0x0, 0xfc, 0xff, 0x3, 0x0,
+      0x1, 0x0, 0xfc, 0xff, 0xfc, 0xff, 0x0, 0x0, 0x3, 0x0, 0x2, 0x0, 0xff,
+      0xff, 0xfd, 0xff, 0x3, 0x0, 0x1, 0x0, 0xff, 0xff, 0x5, 0x0, 0x7, 0x0,
+      0xfd, 0xff, 0x2, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0,
+      0xfe, 0xff, 0x2, 0x0, 0xfd, 0xff, 0x1, 0x0, 0xfd, 0xff, 0xe3, 0xff, 0xff,
+      0xff, 0x3, 0x0, 0xf7, 0xff, 0xf8, 0xff, 0x7, 0x0, 0xff, 0xff, 0xfd, 0xff,
+      0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xf8, 0xff, 0x4, 0x0,
+      0xfd, 0xff, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0xfa, 0xff, 0xfc,
+      0xff, 0x2, 0x0, 0x0, 0x0, 0x5, 0x0, 0xff, 0xff, 0xfd, 0xff, 0x3, 0x0, 0x1,
+      0x0, 0x1, 0x0, 0xfe, 0xff, 0x3, 0x0, 0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xe9, 0xff, 0x4, 0x0, 0xfe, 0xff, 0x6, 0x0, 0x5, 0x0,
+      0xfc, 0xff, 0x3, 0x0, 0xfd, 0xff, 0x2, 0x0, 0x2, 0x0, 0xff, 0xff, 0x2,
+      0x0, 0x2, 0x0, 0x3, 0x0, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0, 0x3, 0x0, 0x3,
+      0x0, 0x0, 0x0, 0xfd, 0xff, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0xfa, 0xff, 0xfd,
+      0xff, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x2, 0x0, 0x2, 0x0, 0xfe, 0xff, 0x0,
+      0x0, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xe8, 0xff, 0x6, 0x0, 0xfd, 0xff,
+      0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0x0, 0x0, 0x1, 0x0, 0x0,
+      0x0, 0xfe, 0xff, 0xfc, 0xff, 0x1, 0x0, 0x1, 0x0, 0xfe, 0xff, 0x5, 0x0,
+      0x6, 0x0, 0xfd, 0xff, 0x2, 0x0, 0xfe, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+      0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0xff,
+      0xff, 0x3, 0x0, 0xff, 0xff, 0x2, 0x0, 0xfe, 0xff, 0x1, 0x0, 0xfe, 0xff,
+      0xe3, 0xff, 0xfe, 0xff, 0x3, 0x0, 0xf9, 0xff, 0xfa, 0xff, 0x6, 0x0, 0x1,
+      0x0, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf9,
+      0xff, 0x4, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xfe, 0xff, 0x1, 0x0, 0x0, 0x0,
+      0xfb, 0xff, 0xfc, 0xff, 0x2, 0x0, 0x0, 0x0, 0x5, 0x0, 0xfe, 0xff, 0xfd,
+      0xff, 0x2, 0x0, 0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0x3, 0x0, 0x1, 0x0, 0x1,
+      0x0, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xe9, 0xff, 0x5, 0x0, 0xfd, 0xff,
+      0x7, 0x0, 0x5, 0x0, 0xfb, 0xff, 0x1, 0x0, 0xfe, 0xff, 0x2, 0x0, 0x2, 0x0,
+      0xff, 0xff, 0x1, 0x0, 0x3, 0x0, 0x2, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0,
+      0x1, 0x0, 0x3, 0x0, 0x0, 0x0, 0xfd, 0xff, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0,
+      0xfc, 0xff, 0xfd, 0xff, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x1, 0x0, 0x2, 0x0,
+      0xfe, 0xff, 0x0, 0x0, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xe6, 0xff, 0x3,
+      0x0, 0xff, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0x0, 0x0, 0xfb, 0xff, 0xff, 0xff,
+      0x0, 0x0, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x1, 0x0, 0xfe,
+      0xff, 0x5, 0x0, 0x5, 0x0, 0xfe, 0xff, 0x1, 0x0, 0xfd, 0xff, 0xff, 0xff,
+      0x1, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1,
+      0x0, 0xff, 0xff, 0x3, 0x0, 0x0, 0x0, 0x2, 0x0, 0xfe, 0xff, 0x1, 0x0, 0xfe,
+      0xff, 0xe4, 0xff, 0xff, 0xff, 0x2, 0x0, 0xfc, 0xff, 0xfd, 0xff, 0x4, 0x0,
+      0x2, 0x0, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0x1, 0x0, 0xfb,
+      0xff, 0x4, 0x0, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x1, 0x0, 0x1, 0x0,
+      0xfd, 0xff, 0xfc, 0xff, 0x2, 0x0, 0x0, 0x0, 0x4, 0x0, 0xfd, 0xff, 0xfd,
+      0xff, 0x2, 0x0, 0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0x3, 0x0, 0x1, 0x0, 0x1,
+      0x0, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xe9, 0xff, 0x5, 0x0, 0xfd, 0xff,
+      0x5, 0x0, 0x3, 0x0, 0xfc, 0xff, 0x0, 0x0, 0xff, 0xff, 0x2, 0x0, 0x1, 0x0,
+      0xff, 0xff, 0x0, 0x0, 0x3, 0x0, 0x2, 0x0, 0x0, 0x0, 0x2, 0x0, 0x3, 0x0,
+      0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0,
+      0xfd, 0xff, 0xfe, 0xff, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x1, 0x0, 0x2, 0x0,
+      0xff, 0xff, 0x1, 0x0, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xe6, 0xff, 0x1,
+      0x0, 0x0, 0x0, 0xfc, 0xff, 0xfb, 0xff, 0x2, 0x0, 0xfd, 0xff, 0xff, 0xff,
+      0x0, 0x0, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x1, 0x0, 0xfe,
+      0xff, 0x4, 0x0, 0x3, 0x0, 0xfe, 0xff, 0x1, 0x0, 0xfd, 0xff, 0xff, 0xff,
+      0x1, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0, 0x1, 0x0,
+      0x1, 0x0, 0xff, 0xff, 0x3, 0x0, 0x1, 0x0, 0x1, 0x0, 0xfe, 0xff, 0x0, 0x0,
+      0xff, 0xff, 0xe8, 0xff, 0x0, 0x0, 0x1, 0x0, 0xfe, 0xff, 0xff, 0xff, 0x2,
+      0x0, 0x2, 0x0, 0xfd, 0xff, 0x0, 0x0, 0xff, 0xff, 0xfd, 0xff, 0x0, 0x0,
+      0xfe, 0xff, 0x3, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x1, 0x0, 0x1,
+      0x0, 0xfe, 0xff, 0xfd, 0xff, 0x1, 0x0, 0x0, 0x0, 0x3, 0x0, 0xfd, 0xff,
+      0xfd, 0xff, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+      0x1, 0x0, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xec, 0xff, 0x3, 0x0, 0xfe,
+      0xff, 0x2, 0x0, 0x1, 0x0, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2, 0x0,
+      0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0x2, 0x0, 0x1, 0x0, 0x0, 0x0, 0x2, 0x0,
+      0x3, 0x0, 0x0, 0x0, 0x2, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+      0x1, 0x0, 0xfe, 0xff, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x2, 0x0, 0x0, 0x0, 0x1, 0x0, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec,
+      0xff, 0x1, 0x0, 0x0, 0x0, 0xfe, 0xff, 0xfd, 0xff, 0x1, 0x0, 0xff, 0xff,
+      0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x2,
+      0x0, 0xfe, 0xff, 0x2, 0x0, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0, 0xfd, 0xff,
+      0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0xff, 0xff, 0x1, 0x0,
+      0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0x2, 0x0, 0x1, 0x0, 0x1, 0x0, 0xff, 0xff,
+      0x0, 0x0, 0xff, 0xff, 0xef, 0xff, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x1, 0x0, 0xfe, 0xff, 0x0, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x0, 0x0,
+      0xff, 0xff, 0x2, 0x0, 0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0,
+      0xfe, 0xff, 0xfe, 0xff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0xfe, 0xff, 0xfe,
+      0xff, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1,
+      0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0x1, 0x0, 0xff, 0xff,
+      0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0x0, 0x0,
+      0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0x2, 0x0, 0x2,
+      0x0, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1,
+      0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+      0x0, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xf4, 0xff,
+      0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
+      0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x1, 0x0,
+      0xff, 0xff, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0xfe, 0xff, 0xff,
+      0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0xff, 0xff, 0x1, 0x0, 0x1,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0x0,
+      0x0, 0xff, 0xff, 0xf7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
+      0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0xff,
+      0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0xff, 0xff,
+      0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
+      0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+      0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xfd, 0xff, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0}},
+    {"WAV/Subject_002/SH/sh_hrir_order_7.wav",
+     {0x52, 0x49, 0x46, 0x46, 0x24, 0x80, 0x0, 0x0, 0x57, 0x41, 0x56, 0x45,
+      0x66, 0x6d, 0x74, 0x20, 0x10, 0x0, 0x0, 0x0, 0x1, 0x0, 0x40, 0x0, 0x80,
+      0xbb, 0x0, 0x0, 0x0, 0xc0, 0x5d, 0x0, 0x80, 0x0, 0x10, 0x0, 0x64, 0x61,
+      0x74, 0x61, 0x0, 0x80, 0x0, 0x0, 0xfe, 0xff, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xfe, 0xff, 0xff, 0xff, 0x0,
+      0x0, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0xf7, 0xff, 0x14, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x0, 0x0, 0xfd, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0x0, 0x0, 0xfe,
+      0xff, 0x1, 0x0, 0x2, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0xfd, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x5, 0x0, 0xf9, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+      0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+      0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x8, 0x0, 0xef, 0xff, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3,
+      0x0, 0x2, 0x0, 0x5, 0x0, 0x1, 0x0, 0x0, 0x0, 0x2, 0x0, 0xff, 0xff, 0xfe,
+      0xff, 0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3,
+      0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+      0x0, 0xf5, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x2, 0x0, 0x2,
+      0x0, 0x5, 0x0, 0x2, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x1,
+      0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0, 0x3, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0,
+      0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
+      0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0x0,
+      0x0, 0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0xff,
+      0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0xa, 0x0, 0xe5, 0xff, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x5,
+      0x0, 0x4, 0x0, 0x9, 0x0, 0x1, 0x0, 0x0, 0x0, 0x4, 0x0, 0xff, 0xff, 0xfd,
+      0xff, 0xfe, 0xff, 0x2, 0x0, 0x0, 0x0, 0xfd, 0xff, 0x0, 0x0, 0x0, 0x0, 0x5,
+      0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x5, 0x0, 0x3, 0x0, 0x1, 0x0, 0x1, 0x0,
+      0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0x2, 0x0,
+      0x1, 0x0, 0x2, 0x0, 0x2, 0x0, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0xfd, 0xff,
+      0x0, 0x0, 0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0xff,
+      0xff, 0x0, 0x0, 0x5, 0x0, 0xed, 0xff, 0x2, 0x0, 0x1, 0x0, 0x0, 0x0, 0x2,
+      0x0, 0x5, 0x0, 0x2, 0x0, 0x9, 0x0, 0x8, 0x0, 0xfe, 0xff, 0x6, 0x0, 0xfe,
+      0xff, 0xfd, 0xff, 0xfe, 0xff, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0x2, 0x0, 0x1, 0x0, 0xfb, 0xff, 0x2, 0x0, 0xfa, 0xff, 0xf9,
+      0xff, 0x1, 0x0, 0xf8, 0xff, 0x1, 0x0, 0xfe, 0xff, 0x1, 0x0, 0x1, 0x0, 0x1,
+      0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0x0,
+      0x0, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x3, 0x0, 0x1, 0x0, 0x7,
+      0x0, 0x0, 0x0, 0x4, 0x0, 0x1, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x0, 0x2, 0x0,
+      0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+      0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0xa, 0x0, 0xe4, 0xff, 0xff, 0xff, 0x2, 0x0,
+      0x3, 0x0, 0xfc, 0xff, 0x6, 0x0, 0x5, 0x0, 0xa, 0x0, 0x2, 0x0, 0x1, 0x0,
+      0x3, 0x0, 0x1, 0x0, 0xfd, 0xff, 0x5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x0,
+      0x0, 0x0, 0x2, 0x0, 0x7, 0x0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x8, 0x0, 0x9,
+      0x0, 0x1, 0x0, 0xa, 0x0, 0x1, 0x0, 0x5, 0x0, 0xfe, 0xff, 0x2, 0x0, 0xfe,
+      0xff, 0xff, 0xff, 0xfb, 0xff, 0x0, 0x0, 0x1, 0x0, 0xfd, 0xff, 0x0, 0x0,
+      0xfe, 0xff, 0x1, 0x0, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x0,
+      0x0, 0xf6, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfa,
+      0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x1,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0xf3, 0xff, 0xc3,
+      0xff, 0x4, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x7, 0x0, 0x22, 0x0, 0x2, 0x0, 0x3a,
+      0x0, 0x33, 0x0, 0xff, 0xff, 0x2c, 0x0, 0xfe, 0xff, 0xfe, 0xff, 0xf6, 0xff,
+      0x2, 0x0, 0xfe, 0xff, 0xf4, 0xff, 0x0, 0x0, 0xff, 0xff, 0xee, 0xff, 0x1,
+      0x0, 0xdb, 0xff, 0x2, 0x0, 0xd7, 0xff, 0xe1, 0xff, 0x0, 0x0, 0xe0, 0xff,
+      0x0, 0x0, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0xb,
+      0x0, 0x6, 0x0, 0x6, 0x0, 0x8, 0x0, 0x2, 0x0, 0xfe, 0xff, 0xff, 0xff, 0xfd,
+      0xff, 0x7, 0x0, 0x0, 0x0, 0xc, 0x0, 0x2, 0x0, 0x17, 0x0, 0x1, 0x0, 0x12,
+      0x0, 0x6, 0x0, 0x0, 0x0, 0xa, 0x0, 0x1, 0x0, 0x4, 0x0, 0x1, 0x0, 0x3, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x0, 0x2, 0x0, 0xff, 0xff, 0xfd, 0xff,
+      0xfe, 0xff, 0xd2, 0xff, 0x4e, 0xff, 0xfd, 0xff, 0x8, 0x0, 0xf, 0x0, 0xf5,
+      0xff, 0x6d, 0x0, 0x3, 0x0, 0xbe, 0x0, 0xaf, 0x0, 0xff, 0xff, 0x88, 0x0,
+      0x5, 0x0, 0xf6, 0xff, 0x12, 0x0, 0xf1, 0xff, 0xf4, 0xff, 0x18, 0x0, 0xf6,
+      0xff, 0x7, 0x0, 0xc3, 0xff, 0x0, 0x0, 0x9f, 0xff, 0x1, 0x0, 0x7e, 0xff,
+      0xb0, 0xff, 0x1, 0x0, 0xca, 0xff, 0x0, 0x0, 0xcc, 0xff, 0xfe, 0xff, 0x6,
+      0x0, 0xfd, 0xff, 0x8, 0x0, 0xea, 0xff, 0x4, 0x0, 0xff, 0xff, 0xf3, 0xff,
+      0x3, 0x0, 0x2, 0x0, 0x6, 0x0, 0x0, 0x0, 0xd, 0x0, 0xfe, 0xff, 0x17, 0x0,
+      0x0, 0x0, 0x13, 0x0, 0xff, 0xff, 0x23, 0x0, 0x4, 0x0, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0x6, 0x0, 0x0, 0x0, 0x3, 0x0, 0xfc, 0xff, 0xff, 0xff,
+      0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0x2, 0x0, 0x5, 0x0, 0x4, 0x0, 0xcd,
+      0xff, 0x6b, 0xff, 0xff, 0xff, 0x1, 0x0, 0xfc, 0xff, 0xff, 0xff, 0x3b, 0x0,
+      0x8, 0x0, 0x65, 0x0, 0x1, 0x0, 0x8, 0x0, 0x10, 0x0, 0x4, 0x0, 0x4, 0x0,
+      0xf6, 0xff, 0xe, 0x0, 0x14, 0x0, 0xec, 0xff, 0x10, 0x0, 0x1, 0x0, 0x1c,
+      0x0, 0xff, 0xff, 0x3b, 0x0, 0xf9, 0xff, 0x63, 0x0, 0x93, 0x0, 0xfc, 0xff,
+      0x62, 0x0, 0x1, 0x0, 0x3f, 0x0, 0x4, 0x0, 0xf8, 0xff, 0x3, 0x0, 0xed,
+      0xff, 0x15, 0x0, 0xe8, 0xff, 0xeb, 0xff, 0x10, 0x0, 0xf2, 0xff, 0xff,
+      0xff, 0xf7, 0xff, 0x3, 0x0, 0xdc, 0xff, 0xfe, 0xff, 0xc0, 0xff, 0x1, 0x0,
+      0x9f, 0xff, 0x1, 0x0, 0x8a, 0xff, 0xc5, 0xff, 0xff, 0xff, 0xc6, 0xff, 0x1,
+      0x0, 0xd6, 0xff, 0xff, 0xff, 0xe5, 0xff, 0xfe, 0xff, 0x1, 0x0, 0x2, 0x0,
+      0x5, 0x0, 0x3, 0x0, 0x7, 0x0, 0xf9, 0xff, 0x11, 0x0, 0xd4, 0x0, 0x68, 0x2,
+      0x15, 0x0, 0xe7, 0xff, 0xc3, 0xff, 0x16, 0x0, 0xe1, 0xfd, 0xff, 0xff,
+      0x92, 0xfc, 0x8, 0xfc, 0xfc, 0xff, 0xb8, 0xfc, 0x1b, 0x0, 0x14, 0x0, 0xfe,
+      0xff, 0x59, 0x0, 0x60, 0x0, 0xb, 0x0, 0x25, 0x0, 0x38, 0x0, 0x12, 0x2,
+      0xff, 0xff, 0x1a, 0x3, 0xfe, 0xff, 0xc3, 0x3, 0xec, 0x2, 0xf9, 0xff, 0x52,
+      0x2, 0xfc, 0xff, 0x30, 0x2, 0xe6, 0xff, 0xf4, 0xff, 0xce, 0xff, 0xda,
+      0xff, 0xf0, 0xff, 0xa8, 0xff, 0xc3, 0xff, 0xf6, 0xff, 0xe3, 0xff, 0xde,
+      0xff, 0xf3, 0xff, 0xe5, 0xff, 0x1a, 0xff, 0x1, 0x0, 0xcc, 0xfe, 0x5, 0x0,
+      0xa8, 0xfe, 0x5, 0x0, 0x4e, 0xfe, 0x6b, 0xff, 0x1, 0x0, 0x8f, 0xff, 0x2,
+      0x0, 0x9c, 0xff, 0x3, 0x0, 0x9a, 0xff, 0x13, 0x0, 0x2, 0x0, 0x13, 0x0,
+      0x6, 0x0, 0xf, 0x0, 0xa, 0x0, 0x4, 0x0, 0x15, 0x0, 0x34, 0x1, 0x12, 0x3,
+      0x1a, 0x0, 0xdf, 0xff, 0xb5, 0xff, 0x22, 0x0, 0xba, 0xfd, 0x8, 0x0, 0xaa,
+      0xfc, 0xb1, 0xfd, 0x6, 0x0, 0x7e, 0xfd, 0x7, 0x0, 0x21, 0x0, 0xe4, 0xff,
+      0x58, 0x0, 0x27, 0x0, 0xe8, 0xff, 0x29, 0x0, 0xf, 0x0, 0xf5, 0x0, 0xfc,
+      0xff, 0x19, 0x1, 0x4, 0x0, 0xaa, 0x0, 0x1b, 0xff, 0x13, 0x0, 0xa6, 0xff,
+      0x2, 0x0, 0x28, 0x0, 0xfc, 0xff, 0xff, 0xff, 0x5, 0x0, 0xf5, 0xff, 0x17,
+      0x0, 0x3a, 0x0, 0x83, 0x0, 0x12, 0x0, 0x22, 0x0, 0x14, 0x0, 0xb, 0x0, 0x1,
+      0x0, 0x3f, 0x0, 0xf9, 0xff, 0x92, 0x0, 0xfa, 0xff, 0x44, 0x1, 0xe6, 0xff,
+      0x81, 0x1, 0x37, 0x1, 0xeb, 0xff, 0x3d, 0x1, 0xfb, 0xff, 0xb8, 0x0, 0xfc,
+      0xff, 0x75, 0x0, 0xf8, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xef, 0xff, 0xe7,
+      0xff, 0xcc, 0xff, 0xf7, 0xff, 0x84, 0xff, 0x7b, 0xff, 0xd8, 0xfd, 0xb2,
+      0xff, 0x1f, 0x0, 0x59, 0x0, 0x8c, 0xff, 0xdc, 0x2, 0xda, 0xff, 0x9d, 0x3,
+      0xac, 0x5, 0xac, 0xff, 0xa3, 0x5, 0x9c, 0xff, 0xb2, 0xff, 0x3d, 0x0, 0x5c,
+      0xff, 0x28, 0xff, 0x11, 0x0, 0x61, 0xff, 0xd, 0xff, 0x8e, 0xfb, 0x24, 0x0,
+      0x1e, 0xf9, 0x60, 0x0, 0xa1, 0xf8, 0x28, 0xf8, 0x4b, 0x0, 0x73, 0xf9,
+      0x27, 0x0, 0xf9, 0xf9, 0x7d, 0x0, 0x47, 0x0, 0xe, 0x1, 0xc0, 0x0, 0x11,
+      0x0, 0xd1, 0x0, 0x86, 0x0, 0x13, 0x0, 0x9f, 0x0, 0xd6, 0x0, 0x5a, 0x0,
+      0x79, 0x0, 0x3a, 0x3, 0xfd, 0xff, 0x1f, 0x4, 0xec, 0xff, 0xef, 0x4, 0xd8,
+      0xff, 0xee, 0x5, 0xd1, 0x2, 0xf5, 0xff, 0x59, 0x2, 0xfd, 0xff, 0xe3, 0x1,
+      0x5, 0x0, 0x8, 0x2, 0x9b, 0xff, 0xeb, 0xff, 0xb9, 0xff, 0xc7, 0xff, 0x8c,
+      0xff, 0xba, 0xff, 0xf6, 0xff, 0xdb, 0xff, 0xea, 0xfe, 0x78, 0xfc, 0xb9,
+      0xff, 0x7b, 0x0, 0x3f, 0x1, 0x45, 0x0, 0xcc, 0x3, 0xfc, 0xff, 0xf6, 0x3,
+      0xe5, 0x2, 0xdf, 0xff, 0x31, 0x5, 0xbd, 0xfe, 0x5b, 0xff, 0x52, 0xff,
+      0x37, 0xfe, 0x6b, 0xfe, 0x2d, 0xff, 0xd, 0xff, 0x54, 0xfe, 0x70, 0xfd,
+      0x32, 0x0, 0xc3, 0xfc, 0x2e, 0x0, 0x25, 0xff, 0x65, 0x1, 0x1d, 0x0, 0xbd,
+      0xff, 0x2b, 0x0, 0x51, 0xfe, 0x39, 0x0, 0x34, 0x0, 0xc1, 0x0, 0xbe, 0x0,
+      0x95, 0x0, 0x9c, 0x0, 0x81, 0xff, 0x41, 0x0, 0x38, 0x0, 0xe9, 0xff, 0x2a,
+      0x0, 0x59, 0xff, 0x91, 0x0, 0x15, 0x0, 0xcc, 0xff, 0xf6, 0xff, 0x96, 0xfd,
+      0xfb, 0xff, 0xb4, 0xfd, 0xea, 0xfd, 0x10, 0x0, 0xfb, 0xfc, 0xb, 0x0, 0xc4,
+      0xfe, 0x21, 0x0, 0xec, 0xff, 0xb3, 0x0, 0xef, 0xff, 0xd9, 0x0, 0xff, 0xff,
+      0x8e, 0x0, 0x37, 0x0, 0x6, 0x0, 0xfe, 0x0, 0xc0, 0xff, 0xc3, 0xfe, 0x6a,
+      0x0, 0x0, 0x0, 0xc, 0x0, 0x33, 0x1, 0xc6, 0xff, 0x4f, 0x0, 0x3d, 0x3,
+      0xaf, 0x3, 0x9d, 0x0, 0xc9, 0xfe, 0x8e, 0xff, 0x21, 0x0, 0xba, 0xfe, 0xfb,
+      0xff, 0x1a, 0x0, 0x25, 0xff, 0x9b, 0x0, 0xdb, 0xff, 0x17, 0x3, 0xd7, 0xff,
+      0xaf, 0x2, 0x42, 0xff, 0xf6, 0xfe, 0xc2, 0x3, 0x4f, 0xff, 0x7a, 0x3, 0xc2,
+      0xff, 0x1, 0x6, 0x1e, 0x0, 0x5e, 0xff, 0x25, 0xff, 0xb, 0xff, 0x1a, 0x0,
+      0x97, 0xff, 0x6d, 0xff, 0xa3, 0xff, 0xd, 0xff, 0xb4, 0xfe, 0xe, 0xff,
+      0x78, 0xff, 0x24, 0xfb, 0x19, 0x0, 0x61, 0xfb, 0x3b, 0x0, 0xfc, 0xfb,
+      0x7b, 0x0, 0xad, 0xf9, 0x20, 0xfb, 0x37, 0x0, 0xe1, 0xfc, 0x1f, 0x0, 0x57,
+      0xfd, 0x1c, 0x0, 0x40, 0xfc, 0x25, 0x1, 0x46, 0x0, 0x7a, 0x0, 0xb2, 0x0,
+      0xe9, 0x0, 0x87, 0x0, 0x60, 0x0, 0x6c, 0x0, 0xc4, 0xff, 0xc6, 0xff, 0x86,
+      0xff, 0x63, 0xff, 0x66, 0xfe, 0x24, 0xfd, 0xd8, 0xfe, 0x13, 0x0, 0xeb,
+      0xff, 0x1a, 0x0, 0x73, 0x0, 0x76, 0xfd, 0x12, 0x4, 0x6, 0x1, 0x2f, 0x4,
+      0x9f, 0x2, 0x10, 0x3, 0xc6, 0x4, 0xce, 0x1, 0xad, 0x5, 0x80, 0x1, 0x5f,
+      0xff, 0xb7, 0x3, 0x32, 0xff, 0x72, 0xff, 0x90, 0xff, 0x4b, 0xff, 0x92,
+      0x3, 0x66, 0xff, 0xa9, 0x2, 0x15, 0xfe, 0xb6, 0xff, 0x57, 0xfc, 0x1, 0xfe,
+      0xe9, 0xfb, 0x99, 0xfd, 0x5c, 0xff, 0x6f, 0xfd, 0x8c, 0xfe, 0x8a, 0xfe,
+      0x8d, 0xff, 0x44, 0x0, 0x42, 0xfe, 0xaa, 0xff, 0x9e, 0xfd, 0x39, 0x0,
+      0x9e, 0xfe, 0x54, 0x0, 0x86, 0xff, 0x72, 0xff, 0x4, 0x0, 0x1, 0x1, 0xeb,
+      0xff, 0x52, 0xff, 0x84, 0xff, 0x83, 0xfe, 0x38, 0xfe, 0x3e, 0x0, 0x46,
+      0xfe, 0x57, 0x0, 0xa2, 0xff, 0x68, 0x0, 0xd4, 0x0, 0xb, 0xff, 0x88, 0xfd,
+      0xfc, 0xfb, 0xc2, 0x1, 0x3f, 0x0, 0xe9, 0xff, 0x33, 0x2, 0xc0, 0x2, 0xba,
+      0xff, 0xbd, 0xfd, 0x71, 0xf7, 0x9b, 0xff, 0xc2, 0x1, 0x5, 0x1, 0x31, 0x0,
+      0x99, 0xfe, 0xf9, 0x0, 0x96, 0x1, 0x6e, 0xfe, 0x10, 0x0, 0xba, 0x3, 0x5d,
+      0xfd, 0xbd, 0xff, 0x33, 0x0, 0x66, 0x0, 0x9, 0x9, 0xe3, 0x3, 0x84, 0x0,
+      0x26, 0x1, 0xa1, 0xff, 0x54, 0xfc, 0x9e, 0xfc, 0xbb, 0x0, 0x3d, 0xfd,
+      0x47, 0x0, 0x70, 0x2, 0x25, 0xff, 0x91, 0x0, 0xf6, 0x2, 0xa9, 0x0, 0x1b,
+      0xff, 0x50, 0x1, 0xf0, 0xfd, 0x45, 0x3, 0x17, 0x0, 0x91, 0x1, 0x11, 0x0,
+      0xea, 0xff, 0x6c, 0xff, 0x9d, 0x1, 0x64, 0x3, 0x94, 0xff, 0x8b, 0x1, 0xcd,
+      0xff, 0xa5, 0x0, 0xd1, 0xff, 0x45, 0x2, 0xc9, 0xfe, 0x74, 0xff, 0x75, 0x0,
+      0xf5, 0xfe, 0xea, 0xff, 0x73, 0xff, 0xe2, 0xfd, 0xd0, 0xfe, 0xe8, 0xff,
+      0x5a, 0xfd, 0x7b, 0x0, 0xdc, 0x2, 0x9b, 0x4, 0x5e, 0x2, 0x34, 0x0, 0x48,
+      0x0, 0x3e, 0x8, 0x69, 0xa, 0x13, 0x0, 0x85, 0x1, 0xbc, 0xfb, 0x7, 0xfe,
+      0x6a, 0xfd, 0x83, 0xfc, 0x8b, 0xfe, 0x3f, 0xfe, 0x42, 0xfd, 0x3c, 0xf9,
+      0xe8, 0x0, 0x6f, 0x0, 0x2d, 0xfb, 0x9e, 0x0, 0x8b, 0xf9, 0x4, 0xfd, 0x1e,
+      0x1, 0x2c, 0xf9, 0xc4, 0x0, 0x52, 0xff, 0x8, 0x4, 0xff, 0x0, 0x73, 0x5,
+      0xe5, 0x2, 0x40, 0x1, 0x35, 0x0, 0x15, 0xff, 0xef, 0x0, 0x62, 0x2, 0x5b,
+      0x4, 0x67, 0x1, 0x7f, 0x2, 0x2a, 0xff, 0x53, 0x0, 0x78, 0x4, 0x23, 0xff,
+      0x9a, 0x5, 0x3, 0xff, 0x25, 0x3, 0xaa, 0x3, 0x8f, 0xff, 0x41, 0x2, 0x75,
+      0xff, 0x1d, 0x4, 0x82, 0x0, 0xaf, 0x0, 0x33, 0x1, 0x88, 0xff, 0x33, 0xff,
+      0xfc, 0xfe, 0x5a, 0xfd, 0xe, 0xff, 0x7f, 0xff, 0xd9, 0x1, 0x65, 0x2, 0xd1,
+      0x4, 0x1b, 0xfb, 0x2, 0xfd, 0x46, 0xfb, 0x5c, 0xf8, 0xdc, 0xf9, 0x9, 0x1,
+      0x71, 0xfd, 0x9b, 0xfc, 0xa4, 0x0, 0x29, 0xf6, 0x3b, 0x1, 0x82, 0x2, 0xa6,
+      0x3, 0xf8, 0x2, 0x7c, 0xff, 0x6a, 0x0, 0xac, 0x3, 0xd0, 0xfa, 0xbd, 0x5,
+      0x70, 0x1, 0x84, 0xb, 0x85, 0x0, 0xc6, 0x8, 0xba, 0xb, 0xfa, 0x0, 0x7a,
+      0xb, 0xa2, 0x2, 0xc6, 0x5, 0x60, 0x6, 0x6c, 0xfd, 0x92, 0x6, 0x59, 0xfd,
+      0x90, 0xff, 0x51, 0x2, 0x57, 0x1, 0xda, 0xfd, 0x19, 0xff, 0x66, 0x3, 0x27,
+      0xfd, 0xc7, 0x5, 0x9f, 0xff, 0x89, 0xfe, 0x47, 0xfc, 0x77, 0xfe, 0x83,
+      0xf8, 0x8f, 0xff, 0x4f, 0xf8, 0xdc, 0xfd, 0x30, 0x0, 0x2, 0xfd, 0x5, 0x0,
+      0xe0, 0xfe, 0x3e, 0xff, 0xd3, 0x0, 0x5b, 0xff, 0xfe, 0x0, 0x6d, 0xfe,
+      0x56, 0x1, 0x8c, 0xff, 0xe0, 0xff, 0x5e, 0x2, 0x7f, 0x0, 0xbc, 0xff, 0x9b,
+      0x6, 0xd, 0x5, 0xa7, 0xf7, 0x18, 0xf3, 0x81, 0x7, 0x3c, 0xfd, 0xbd, 0xfd,
+      0x1c, 0xe8, 0xf5, 0xe0, 0x29, 0xfc, 0x2c, 0xf7, 0xb, 0x0, 0x6, 0x3, 0xe2,
+      0xf9, 0x4c, 0x8, 0x17, 0x1, 0xf3, 0xf8, 0xf4, 0x1, 0xde, 0x3, 0xed, 0x3,
+      0xef, 0x0, 0x17, 0xb, 0x24, 0x3, 0x85, 0x14, 0xa7, 0x7, 0x9d, 0x0, 0xdb,
+      0x6, 0xe1, 0xff, 0xc5, 0x4, 0x35, 0xfc, 0xaa, 0xff, 0xaa, 0xfc, 0xdb,
+      0xfe, 0xa9, 0x7, 0x6d, 0x2, 0x4c, 0x3, 0xec, 0x5, 0x81, 0xfe, 0x87, 0xfc,
+      0x20, 0xff, 0xac, 0xfc, 0xf5, 0x0, 0x94, 0x0, 0x4e, 0xfa, 0x7f, 0x1, 0x4e,
+      0xff, 0x79, 0x1, 0xe4, 0xfc, 0xc6, 0xfd, 0xbb, 0x1, 0xf0, 0x1, 0x9b, 0x1,
+      0x5, 0xfc, 0xe0, 0x0, 0xe4, 0x0, 0xb5, 0x0, 0x7, 0x0, 0xb8, 0x3, 0x3f,
+      0x1, 0x49, 0x4, 0x20, 0x1, 0xd4, 0xfd, 0xe7, 0xfc, 0xef, 0x6, 0x44, 0x10,
+      0x6e, 0x4, 0x2, 0xa, 0x96, 0xd, 0xa9, 0x5, 0x87, 0xf7, 0xb4, 0xff, 0xba,
+      0xf2, 0xfc, 0xfc, 0x3b, 0x1, 0xfa, 0xf8, 0xc9, 0xfd, 0x9e, 0xf9, 0xff,
+      0x2, 0x71, 0xfa, 0xc, 0x3, 0x3e, 0xa, 0x8, 0xf8, 0xc1, 0x3, 0x2c, 0x7,
+      0x7a, 0xfc, 0xf8, 0xfd, 0x9f, 0xfd, 0x43, 0xf8, 0x5e, 0xf2, 0xf9, 0xfd,
+      0x73, 0xf7, 0xd, 0xfb, 0x93, 0x5, 0x94, 0xfb, 0xbc, 0x5, 0x1f, 0xfa, 0xe1,
+      0x4, 0x50, 0xf6, 0x37, 0xfb, 0x9f, 0xfd, 0xfd, 0xfa, 0xb0, 0x0, 0x3b,
+      0xfe, 0x52, 0x5, 0xa9, 0xfa, 0xe4, 0xfa, 0x76, 0x2, 0x1a, 0x3, 0xb5, 0x2,
+      0x60, 0x7, 0xdc, 0x0, 0xab, 0xb, 0x43, 0x5, 0xf3, 0xff, 0x43, 0x3, 0xa3,
+      0x0, 0xea, 0x3, 0xb3, 0x1, 0xc2, 0xfe, 0xfd, 0x2, 0x49, 0xfe, 0x90, 0x1,
+      0xa2, 0xfe, 0xb3, 0xfe, 0x14, 0x1, 0x38, 0x1, 0x36, 0x0, 0x17, 0x6, 0x71,
+      0xa, 0xfc, 0xf6, 0x58, 0x6, 0xed, 0x8, 0x66, 0xf4, 0xae, 0xf4, 0x54, 0x2,
+      0x46, 0xff, 0xa9, 0x1, 0xe6, 0x3, 0xcb, 0xf7, 0x88, 0x2, 0x11, 0xff, 0x2,
+      0x2, 0x33, 0xf9, 0xb5, 0xf9, 0x23, 0xfe, 0xd3, 0x1, 0xae, 0xfb, 0xf9,
+      0xff, 0xd3, 0x0, 0x19, 0xff, 0x3b, 0xfb, 0x59, 0x1, 0x7e, 0xfd, 0x4c,
+      0xfc, 0x45, 0xfc, 0x29, 0x1, 0xdf, 0xf8, 0x55, 0x3, 0x37, 0xfb, 0x6c, 0x3,
+      0x81, 0xff, 0x63, 0xfe, 0x8f, 0x5, 0x3d, 0x1, 0x3, 0xfc, 0x2e, 0x2, 0x82,
+      0x0, 0x19, 0xfc, 0x9f, 0x0, 0xb2, 0x5, 0x96, 0xfe, 0xc8, 0x5, 0x8a, 0xff,
+      0x86, 0x1, 0x12, 0x1, 0xb7, 0x7, 0x64, 0x4, 0xed, 0xfe, 0x16, 0xff, 0xb1,
+      0xff, 0x2c, 0x1, 0x22, 0xfe, 0x91, 0x3, 0x2f, 0xff, 0xab, 0x1, 0x40, 0x0,
+      0xf6, 0xff, 0x8f, 0xfe, 0xf0, 0xfd, 0xef, 0x1, 0x15, 0x2, 0x5e, 0x1, 0xa6,
+      0x8, 0x4b, 0xfd, 0x1f, 0xee, 0x3a, 0xef, 0xd1, 0xfd, 0xe3, 0xfe, 0x82,
+      0xfd, 0x2f, 0xec, 0xa8, 0xee, 0x83, 0xfa, 0x10, 0x3, 0x9b, 0xfd, 0x37,
+      0x5, 0xe2, 0xfc, 0xc6, 0xfa, 0x7a, 0xf0, 0x12, 0xf9, 0x90, 0x1, 0x71,
+      0xfa, 0xf4, 0xf4, 0xea, 0x3, 0x62, 0xf7, 0x3b, 0x4, 0x81, 0xfe, 0x5a,
+      0xf2, 0xca, 0x0, 0x3, 0xf2, 0xd5, 0x3, 0xdd, 0xf0, 0x62, 0xff, 0x6b, 0xfd,
+      0xa2, 0x5, 0x76, 0x1, 0xe1, 0x5, 0x14, 0x7, 0x71, 0xfe, 0x79, 0x3, 0xfb,
+      0x1, 0xb2, 0x1, 0xd2, 0xfd, 0xb7, 0xfe, 0xca, 0x8, 0xc5, 0xfe, 0xad, 0x5,
+      0xe1, 0xfd, 0x76, 0xc, 0x6e, 0x0, 0x14, 0x6, 0x1b, 0xfc, 0x13, 0x0, 0x98,
+      0x3, 0xfa, 0xfd, 0xd5, 0xff, 0x4f, 0xff, 0x69, 0x3, 0xe4, 0xfe, 0xee, 0x0,
+      0xa6, 0x0, 0x1e, 0x0, 0x8a, 0x0, 0xa6, 0xfe, 0x3d, 0xfe, 0x3a, 0x2, 0x11,
+      0x9, 0x3, 0x13, 0x25, 0x2, 0x7e, 0x5, 0x6e, 0x9, 0xe1, 0xff, 0xab, 0x1,
+      0x38, 0x3, 0x82, 0xf5, 0x56, 0xb, 0x40, 0x5, 0x3f, 0x9, 0x71, 0xfb, 0x8a,
+      0xfc, 0xdc, 0x9, 0x95, 0xfc, 0x99, 0x7, 0x91, 0xa, 0x13, 0xfc, 0x5f, 0xfd,
+      0x13, 0xfd, 0x30, 0xfa, 0xe0, 0xf6, 0xca, 0xfe, 0x24, 0xeb, 0xd9, 0xf7,
+      0xa9, 0x3, 0xf9, 0xfc, 0xeb, 0xfb, 0xdd, 0x0, 0xdf, 0xfe, 0xf2, 0x6, 0xe7,
+      0x0, 0x4a, 0xfe, 0x42, 0xfb, 0x50, 0xf7, 0xc3, 0xfe, 0x5e, 0xfe, 0x93,
+      0xfb, 0x67, 0x0, 0xdf, 0x4, 0xc5, 0xfc, 0xf8, 0xfb, 0xfc, 0x1, 0xf4, 0xff,
+      0x29, 0xff, 0xd3, 0xfa, 0xed, 0xfb, 0xea, 0xfb, 0x1e, 0xfb, 0x53, 0xfe,
+      0x30, 0xf9, 0xb, 0xfe, 0xb3, 0xff, 0x72, 0x1, 0xf0, 0xfd, 0x5, 0x3, 0x54,
+      0xfd, 0xb6, 0x0, 0x4d, 0x0, 0xbb, 0x0, 0xfa, 0x1, 0xee, 0x0, 0x13, 0xfe,
+      0x55, 0x5, 0x66, 0x2, 0x9f, 0x0, 0x42, 0x14, 0x97, 0xf, 0x4c, 0x2, 0x20,
+      0x3, 0x4c, 0x1, 0xc8, 0x12, 0x37, 0x1c, 0x65, 0x4, 0x33, 0xd, 0xd1, 0x0,
+      0x76, 0xf9, 0xff, 0xfa, 0x17, 0x8, 0x24, 0xb, 0x6, 0xfa, 0x5c, 0xff, 0x93,
+      0xff, 0xeb, 0xfc, 0xd7, 0xff, 0x30, 0xf2, 0x0, 0xfc, 0x97, 0xee, 0xd1,
+      0xfc, 0x85, 0xff, 0x8, 0xfc, 0xd5, 0xff, 0x37, 0x0, 0x3e, 0x3, 0xe6, 0xfc,
+      0xc3, 0xfd, 0x87, 0xfd, 0x0, 0x5, 0x5e, 0xff, 0xd1, 0x1, 0xd8, 0x2, 0x17,
+      0xfd, 0xcd, 0xfc, 0x7a, 0xfc, 0x3b, 0x0, 0xf5, 0xfd, 0x67, 0xff, 0x47,
+      0xfb, 0x75, 0x1, 0xf5, 0xfb, 0x7a, 0xff, 0xe2, 0xfd, 0x1d, 0xfe, 0x3f,
+      0x0, 0x24, 0xfd, 0xaa, 0x2, 0xc4, 0xfa, 0x4f, 0xff, 0xe, 0xfd, 0xed, 0x0,
+      0x2b, 0x1, 0xf7, 0x1, 0xa1, 0x1, 0x65, 0x2, 0x73, 0x2, 0x1d, 0xff, 0xb6,
+      0xff, 0xac, 0x1, 0xc9, 0x3, 0x2d, 0xfd, 0x79, 0xf9, 0x5b, 0xfc, 0x4f, 0x1,
+      0xf6, 0x1, 0x53, 0xfb, 0x5f, 0x0, 0x60, 0x8, 0x7d, 0xf9, 0x22, 0xe, 0x54,
+      0xff, 0xd4, 0x2, 0x43, 0xfc, 0x88, 0xf6, 0x63, 0xf5, 0x92, 0x4, 0xe4, 0x0,
+      0x90, 0x4, 0xc2, 0xf5, 0xe, 0x5, 0x8, 0xf3, 0xa4, 0x1, 0x60, 0xf2, 0x4d,
+      0xf9, 0x54, 0xfd, 0x73, 0xfe, 0xfa, 0x2, 0x60, 0xff, 0x8e, 0xfa, 0xdf,
+      0xfe, 0xf5, 0xf9, 0x21, 0x2, 0x10, 0xf8, 0xca, 0xfc, 0x35, 0xf7, 0x1f,
+      0xfd, 0xb1, 0x1, 0x14, 0xff, 0x8, 0x1, 0xf0, 0xfe, 0x14, 0xfb, 0x21, 0xfd,
+      0x1e, 0xf8, 0xaa, 0x0, 0x42, 0xfc, 0xf8, 0x1, 0xc, 0xfa, 0x88, 0xf9, 0x54,
+      0x0, 0xdc, 0xfe, 0x60, 0x0, 0x93, 0xfd, 0x20, 0xfe, 0xf3, 0xfa, 0xe7,
+      0xfd, 0xd6, 0x0, 0x7c, 0xfc, 0x72, 0xfe, 0x3, 0xfe, 0x67, 0x0, 0xa1, 0xff,
+      0xe2, 0x2, 0xaa, 0x1, 0x3b, 0x3, 0x24, 0xfe, 0x1e, 0xf7, 0xb0, 0xfd, 0xc6,
+      0xfb, 0xb8, 0x2, 0xae, 0x3, 0xc4, 0x0, 0xcc, 0x8, 0x84, 0x1, 0xa9, 0x5,
+      0x2, 0x1, 0x7c, 0x8, 0xa8, 0x3, 0x6, 0xfc, 0x84, 0x7, 0xe5, 0x0, 0x70,
+      0xa, 0xdd, 0x2, 0x39, 0xfc, 0xd2, 0xfc, 0x3d, 0x1, 0x84, 0x1, 0x9b, 0xfc,
+      0x62, 0xf, 0xb6, 0x0, 0xeb, 0xa, 0xf0, 0xfe, 0xa5, 0x2, 0x34, 0xfd, 0x41,
+      0xff, 0x3c, 0xfe, 0x9d, 0xf9, 0xb3, 0x0, 0x55, 0xf5, 0xec, 0x0, 0x56, 0x1,
+      0xd3, 0x1, 0x7c, 0x0, 0x36, 0xff, 0xe8, 0x0, 0x8, 0xfb, 0x59, 0x2, 0x59,
+      0xfc, 0xb8, 0xfd, 0x23, 0xf2, 0x3b, 0x0, 0x10, 0xee, 0x3a, 0xfd, 0x59,
+      0x0, 0x7c, 0xf9, 0xc6, 0xfd, 0x13, 0x0, 0xa9, 0x1, 0x9e, 0xfd, 0xd5, 0xfd,
+      0x38, 0xff, 0x5e, 0xfc, 0x1f, 0x0, 0x1a, 0xfe, 0x8d, 0xfb, 0xe0, 0xfe,
+      0x89, 0xfb, 0xda, 0x3, 0xb1, 0xfe, 0xe2, 0x8, 0x9d, 0x5, 0xc9, 0xfe, 0x58,
+      0x6, 0x20, 0x1, 0x85, 0x2, 0x2a, 0xf, 0x1b, 0x9, 0xed, 0x1, 0x44, 0xfd,
+      0xe6, 0x3, 0xc2, 0xfd, 0x0, 0xfe, 0xdb, 0x12, 0x9b, 0xf, 0x24, 0xfc, 0x3c,
+      0x0, 0xc3, 0x1, 0x67, 0x3, 0xbf, 0xfc, 0x2d, 0x6, 0x83, 0x3, 0x7e, 0x9,
+      0xc7, 0xb, 0x70, 0x5, 0x33, 0x2, 0x85, 0xff, 0x87, 0xff, 0xf0, 0x4, 0x89,
+      0xfe, 0xe6, 0xff, 0x34, 0xff, 0x37, 0x5, 0xfe, 0x3, 0xe, 0x6, 0xd1, 0x3,
+      0xba, 0x0, 0x59, 0xff, 0xb5, 0xfe, 0x9b, 0x4, 0x4c, 0x1, 0x11, 0x1, 0xb,
+      0x4, 0x80, 0xfe, 0x3a, 0x4, 0x9d, 0xfe, 0xed, 0xfe, 0x51, 0x5, 0x8d, 0x1,
+      0x33, 0x6, 0x4c, 0x0, 0x5d, 0x3, 0xc5, 0x0, 0x5e, 0x1, 0x3c, 0xfe, 0x2c,
+      0x0, 0x5c, 0xfe, 0x66, 0x0, 0x88, 0xff, 0x49, 0xfe, 0xe8, 0xfd, 0x9b, 0x0,
+      0x80, 0x7, 0x5, 0x9, 0x55, 0x2, 0x50, 0x4, 0x97, 0xfb, 0x6, 0x4, 0x55,
+      0xfe, 0xc9, 0xfb, 0xc4, 0x4, 0xf0, 0x3, 0xbe, 0xfe, 0x7, 0xff, 0x19, 0x0,
+      0x99, 0xfd, 0x29, 0xfe, 0x59, 0x8, 0x2a, 0xff, 0xef, 0x0, 0x72, 0xfb,
+      0x9d, 0x0, 0x43, 0x2, 0x1c, 0x1, 0xce, 0xa, 0x25, 0x0, 0x59, 0xb, 0xcb,
+      0xe, 0xf1, 0x2, 0x1f, 0xf, 0x6b, 0xff, 0x70, 0x6, 0x5e, 0x2, 0x86, 0x6,
+      0xf8, 0x0, 0xa9, 0x1, 0xfc, 0xfd, 0x25, 0x4, 0xbc, 0x1, 0xac, 0xfd, 0x39,
+      0xfd, 0x57, 0x1, 0xe6, 0x7, 0xd6, 0x3, 0xe7, 0xfe, 0x5c, 0xfc, 0xe2, 0xfe,
+      0xe6, 0x1, 0x58, 0xfb, 0xd5, 0xfc, 0xe, 0xfd, 0xa6, 0x6, 0x20, 0xfe, 0x4a,
+      0x4, 0x9, 0x1, 0x24, 0x5, 0xf3, 0xfc, 0x4b, 0x2, 0x85, 0x0, 0xd9, 0xfd,
+      0x5d, 0xfe, 0x89, 0xfd, 0xbd, 0xff, 0x6f, 0x2, 0xa5, 0x1, 0x53, 0xff,
+      0x47, 0x1, 0x64, 0x1, 0xf3, 0xfd, 0x21, 0xfc, 0x40, 0xf7, 0xa8, 0xff,
+      0x35, 0x2, 0x45, 0xfb, 0x57, 0x2, 0x19, 0x2, 0x0, 0xf9, 0x40, 0x3, 0xf6,
+      0x0, 0x6d, 0x5, 0xec, 0xfb, 0x9b, 0x4, 0xfc, 0xff, 0x2b, 0xf5, 0xe4, 0x3,
+      0xb2, 0xff, 0x76, 0x3, 0x8d, 0x6, 0x74, 0x4, 0x14, 0xff, 0x2c, 0x6, 0x91,
+      0x9, 0x5a, 0xfa, 0xa9, 0x6, 0x9e, 0x2, 0x63, 0x7, 0x39, 0x3, 0x7c, 0xfd,
+      0x46, 0x6, 0x2d, 0x3, 0xbb, 0x9, 0x2, 0x0, 0x66, 0x4, 0x40, 0x2, 0x85,
+      0x4, 0xde, 0x4, 0xb7, 0xfc, 0x59, 0x5, 0xaa, 0x0, 0xa0, 0x1, 0x1a, 0xff,
+      0x37, 0x0, 0xdc, 0x0, 0x6d, 0x2, 0x9b, 0x0, 0x33, 0x7, 0x82, 0x0, 0x91,
+      0x4, 0xdb, 0x0, 0xad, 0x1, 0xf, 0x2, 0x77, 0x3, 0xf4, 0x0, 0xd6, 0x0,
+      0x67, 0x1, 0x39, 0x1, 0x9f, 0x0, 0x6e, 0x0, 0x5b, 0x1, 0xc1, 0xfb, 0xc0,
+      0xff, 0xc1, 0xfe, 0x4d, 0x4, 0x89, 0xf7, 0xff, 0xfb, 0xd3, 0x4, 0xcb, 0x1,
+      0xe8, 0x4, 0x20, 0x2, 0x2e, 0xfe, 0xfe, 0xff, 0x34, 0x2, 0xa0, 0xff, 0xd0,
+      0x1, 0x4c, 0x4, 0x73, 0xfd, 0xc6, 0xfb, 0x3b, 0x9, 0x74, 0xfd, 0xaa, 0x3,
+      0x83, 0x2, 0xa1, 0xff, 0xa8, 0xfe, 0xf7, 0x2, 0x35, 0x5, 0xe9, 0xfb, 0xd9,
+      0xfe, 0xe2, 0xfa, 0x9d, 0x1, 0xd5, 0x0, 0xb3, 0xfe, 0x7c, 0xfb, 0x34,
+      0xff, 0x60, 0x7, 0x79, 0xfc, 0xa1, 0x6, 0xf7, 0x0, 0xe5, 0x0, 0x88, 0x3,
+      0xaf, 0x1, 0x40, 0xfb, 0x1c, 0x0, 0xc9, 0x1, 0xc1, 0x1, 0x87, 0x3, 0xdd,
+      0xfe, 0x5e, 0x7, 0xa, 0x4, 0xc4, 0xd, 0x93, 0x3, 0x76, 0x2, 0x1a, 0x3,
+      0x76, 0x0, 0xa8, 0x0, 0x7f, 0x2, 0x95, 0x1, 0xf9, 0x0, 0x87, 0x1, 0x15,
+      0x1, 0xfd, 0x1, 0x66, 0x0, 0xf0, 0x0, 0xc9, 0x0, 0x37, 0x4, 0x3e, 0xff,
+      0x71, 0xf6, 0xdc, 0x0, 0x86, 0xfc, 0x96, 0xff, 0x63, 0x0, 0x4d, 0x4, 0x18,
+      0x2, 0xbe, 0xe, 0x60, 0x2, 0xb6, 0x4, 0xb3, 0xff, 0x16, 0x2, 0x2d, 0xfe,
+      0xc5, 0x0, 0x97, 0xfb, 0x1f, 0xf8, 0xcb, 0x3, 0xcf, 0xfd, 0xfb, 0x3, 0xcb,
+      0x0, 0x83, 0xf9, 0x91, 0x4, 0x3c, 0x1, 0xaa, 0x5, 0x97, 0xfd, 0xac, 0x1,
+      0x51, 0xfe, 0xc6, 0xfc, 0xd7, 0xfc, 0x36, 0xfe, 0x2b, 0x5, 0x8c, 0xfa,
+      0xa6, 0xfc, 0xf4, 0xfa, 0x88, 0x6, 0xf2, 0xff, 0xfc, 0xfd, 0x7f, 0xfb,
+      0x3f, 0xfb, 0xfc, 0x3, 0x60, 0xfc, 0x6d, 0x1, 0x93, 0x0, 0x72, 0x6, 0x39,
+      0x2, 0x2b, 0x4, 0x72, 0x2, 0x8c, 0x7, 0xe9, 0xfe, 0x9b, 0x0, 0x95, 0xfd,
+      0x1a, 0x1, 0xaf, 0x0, 0x9, 0xff, 0xb3, 0x0, 0x98, 0x1, 0xf4, 0xfd, 0x35,
+      0x1, 0x89, 0x0, 0xf5, 0x1, 0x1f, 0x0, 0xf6, 0x0, 0xe8, 0x1, 0xce, 0xff,
+      0x67, 0xf4, 0x94, 0xfc, 0x46, 0x5, 0xca, 0x0, 0xbd, 0xf8, 0xdf, 0x4, 0x2e,
+      0xf8, 0xc8, 0x12, 0x8c, 0x0, 0xf5, 0xfc, 0x62, 0xfc, 0xaa, 0x9, 0x6d,
+      0xfc, 0xc, 0xfe, 0x39, 0x2, 0x55, 0xfb, 0x7d, 0xfc, 0x12, 0xfd, 0x5d, 0x3,
+      0x7f, 0x1, 0xa6, 0x1, 0xe1, 0x7, 0x53, 0xf9, 0x78, 0x9, 0x24, 0xfb, 0xf,
+      0xfa, 0xc6, 0xfd, 0x5, 0xfe, 0xf9, 0xfc, 0xc1, 0xff, 0xc2, 0x0, 0x90,
+      0xfd, 0x3b, 0xff, 0x7f, 0xfb, 0x42, 0x3, 0xe0, 0xfc, 0xe9, 0xf9, 0xee,
+      0xfe, 0xaf, 0xfb, 0x94, 0x0, 0x2a, 0xfd, 0xc0, 0x1, 0x56, 0x1, 0xca, 0x4,
+      0xe, 0x1, 0x3f, 0x7, 0xd7, 0xfe, 0x99, 0x7, 0xc, 0xfc, 0xe1, 0xfd, 0x9b,
+      0xfe, 0x82, 0xff, 0x16, 0xff, 0xb1, 0xff, 0x12, 0xff, 0x34, 0x0, 0xce,
+      0xff, 0xe1, 0x1, 0x88, 0xff, 0xfa, 0x0, 0x1f, 0x0, 0x1b, 0x1, 0x93, 0x1,
+      0x57, 0xfe, 0xef, 0xf9, 0x19, 0xff, 0x73, 0x2, 0x19, 0x0, 0x6e, 0xfb,
+      0xc5, 0x3, 0x30, 0x4, 0xc6, 0x6, 0xd4, 0x1, 0x5b, 0x6, 0xc5, 0xff, 0xc5,
+      0x1, 0xd7, 0xfe, 0xc8, 0x6, 0xaa, 0xfb, 0xf7, 0xfb, 0x73, 0x4, 0x76, 0xfe,
+      0x9, 0x0, 0xb2, 0xfe, 0xa1, 0x2, 0xa1, 0x3, 0x38, 0xfa, 0xed, 0x2, 0x74,
+      0x0, 0x52, 0x1, 0xbf, 0x1, 0x82, 0x2, 0x39, 0xfd, 0xb7, 0xfc, 0xc0, 0xfb,
+      0xee, 0x1, 0xbb, 0x2, 0xe7, 0x0, 0xb, 0xfd, 0x6f, 0xfd, 0x16, 0x1, 0xa8,
+      0xff, 0xd, 0x1, 0xcf, 0xfc, 0x76, 0xfd, 0xc6, 0x2, 0xdc, 0xfd, 0xf7, 0xff,
+      0x44, 0xfe, 0x60, 0xfe, 0x78, 0xfb, 0x25, 0x2, 0x3a, 0xfd, 0x73, 0xfd,
+      0xf0, 0xfd, 0xf9, 0xfe, 0x82, 0xfd, 0x13, 0xff, 0xbd, 0xfe, 0x10, 0xff,
+      0x2b, 0x1, 0x13, 0x0, 0xcd, 0xfe, 0x5e, 0x0, 0x5f, 0x1, 0xa9, 0xff, 0x9d,
+      0x0, 0x7c, 0xfb, 0xcd, 0xf7, 0xf9, 0x2, 0x99, 0xfb, 0xe6, 0xfe, 0x9d, 0x0,
+      0xc1, 0x3, 0x69, 0x3, 0x28, 0x1, 0xde, 0xfa, 0x6b, 0x1, 0x14, 0x0, 0xa9,
+      0xfc, 0xe7, 0x0, 0x9e, 0x6, 0x51, 0xfa, 0x81, 0xff, 0x76, 0xff, 0xae, 0x0,
+      0x87, 0xfe, 0x2c, 0x4, 0xdd, 0xff, 0x8f, 0xff, 0xea, 0x3, 0xcd, 0x1, 0x8d,
+      0xfd, 0x4, 0x4, 0x76, 0xfe, 0x6e, 0x3, 0x79, 0xff, 0xe1, 0x1, 0xce, 0x2,
+      0xf6, 0x3, 0x4c, 0xfe, 0xba, 0x6, 0x84, 0xf8, 0x27, 0xfc, 0xff, 0x2, 0x4e,
+      0xff, 0x57, 0x3, 0xb1, 0xff, 0xa5, 0x1, 0xec, 0x1, 0xd9, 0xfe, 0x8d, 0x0,
+      0x33, 0xfe, 0x20, 0x0, 0xf1, 0xff, 0x96, 0xfe, 0xf2, 0xfd, 0x32, 0x0,
+      0xd1, 0xff, 0x35, 0xff, 0xc8, 0xfe, 0xab, 0xff, 0x26, 0x0, 0x3c, 0xff,
+      0xc6, 0xff, 0xff, 0xfd, 0x7c, 0xff, 0xa8, 0xff, 0x8b, 0x0, 0x34, 0xff,
+      0x8c, 0xfe, 0xa7, 0x0, 0x62, 0xff, 0xb9, 0xfd, 0xb3, 0xfe, 0x28, 0x5,
+      0x2c, 0xff, 0x74, 0xff, 0xa2, 0xfc, 0xcb, 0xfe, 0x56, 0xf6, 0x62, 0xfd,
+      0xef, 0xfb, 0xa6, 0xff, 0x5, 0x1, 0x81, 0xfb, 0x8f, 0xfe, 0x27, 0x3, 0x1a,
+      0xff, 0xc2, 0xfe, 0xe8, 0xfb, 0x37, 0x5, 0x2a, 0xff, 0xb4, 0x1, 0xf3, 0x0,
+      0x34, 0x8, 0xde, 0xfd, 0xc1, 0xff, 0x42, 0x0, 0x90, 0xff, 0x1f, 0x3, 0xb0,
+      0x3, 0x92, 0x0, 0xff, 0x0, 0x6b, 0xfd, 0xbc, 0xfd, 0x1a, 0xfe, 0x2a, 0xfd,
+      0xbf, 0xff, 0x1, 0xfe, 0x3d, 0x1, 0x69, 0x0, 0x21, 0x1, 0x9, 0xfe, 0x0,
+      0x0, 0x87, 0xfc, 0xde, 0xff, 0xd8, 0xfc, 0xe9, 0xfe, 0x3f, 0xfe, 0xac,
+      0xfd, 0x5e, 0xff, 0xa1, 0xfd, 0xbb, 0xff, 0x15, 0xff, 0x68, 0x0, 0x45,
+      0xff, 0x6e, 0xff, 0x14, 0x0, 0xe9, 0xfe, 0x74, 0xff, 0x5b, 0xfe, 0xaf,
+      0xff, 0x9c, 0xfe, 0x76, 0xff, 0xb9, 0x1, 0x0, 0xfc, 0x6b, 0xff, 0x6a, 0x3,
+      0x32, 0xff, 0x45, 0x3, 0xad, 0xff, 0xdc, 0x1, 0x85, 0x4, 0xd0, 0xfa, 0xcc,
+      0x2, 0xe1, 0xfd, 0x9, 0xfe, 0x80, 0xff, 0xed, 0xf7, 0xc, 0x4, 0xe2, 0x1,
+      0x3c, 0xfd, 0x70, 0x1, 0x70, 0xfa, 0x80, 0xff, 0x14, 0x0, 0x66, 0x0, 0x5d,
+      0x2, 0xb9, 0xfd, 0x6e, 0xfa, 0x2f, 0x3, 0x22, 0xfa, 0x79, 0x1, 0x2c, 0xff,
+      0x9f, 0x0, 0xbf, 0xfb, 0x76, 0x0, 0xed, 0xfd, 0x3b, 0x1, 0x2e, 0xff, 0x3a,
+      0x1, 0xc6, 0x4, 0xc1, 0xfe, 0x96, 0xff, 0x4e, 0xfd, 0x29, 0xff, 0xbc,
+      0xff, 0x86, 0x0, 0x8a, 0xfd, 0xf4, 0x1, 0xf8, 0x0, 0x90, 0xff, 0x4d, 0xfc,
+      0x2, 0xff, 0x9, 0x2, 0x11, 0x0, 0xcf, 0x2, 0x1e, 0xff, 0x9e, 0x0, 0x9e,
+      0xff, 0x7a, 0xff, 0x7d, 0x1, 0xd7, 0xff, 0x97, 0x0, 0x26, 0xff, 0x74,
+      0xfe, 0x10, 0xfe, 0x27, 0xfe, 0xd9, 0xff, 0xa3, 0xf9, 0x60, 0x3, 0x4d,
+      0x1, 0x29, 0xfd, 0xa8, 0x2, 0x1b, 0x3, 0xb9, 0xff, 0x41, 0x3, 0x90, 0xf7,
+      0xf, 0xfd, 0xb8, 0xfd, 0x8e, 0x0, 0x46, 0xfe, 0x70, 0x1, 0xbd, 0xff, 0xab,
+      0xfe, 0x2b, 0x1, 0x6a, 0xff, 0xe9, 0xff, 0xab, 0xff, 0xee, 0x0, 0x51, 0x0,
+      0x76, 0x3, 0xde, 0xfd, 0x35, 0xf6, 0xae, 0xff, 0xab, 0xfb, 0xdf, 0xff,
+      0x46, 0xfd, 0x83, 0xfe, 0xca, 0x2, 0xfc, 0xfe, 0x8e, 0xff, 0xe6, 0xfd,
+      0x92, 0xfe, 0xb0, 0x0, 0xbf, 0xfd, 0x1d, 0x1, 0x92, 0xfc, 0x48, 0x1, 0x5d,
+      0xfd, 0x47, 0x0, 0x1e, 0x0, 0xdd, 0x0, 0xd, 0x2, 0x9e, 0x0, 0xe6, 0x2,
+      0x4, 0xfe, 0x33, 0xfe, 0x18, 0x2, 0x42, 0xff, 0x34, 0x1, 0xff, 0xff, 0x9d,
+      0xff, 0x66, 0xff, 0x67, 0x0, 0xc9, 0xff, 0xa7, 0xff, 0xb2, 0xff, 0x5c,
+      0x0, 0x7, 0xff, 0x36, 0x1, 0x3c, 0xff, 0x1f, 0xfd, 0x18, 0xfa, 0xea, 0xff,
+      0x5, 0xff, 0xf8, 0x0, 0x17, 0xfc, 0x67, 0x3, 0x84, 0xfd, 0xb0, 0x0, 0xb2,
+      0xff, 0xfc, 0xfe, 0x68, 0xfc, 0x4f, 0x1, 0xfa, 0xff, 0x5c, 0xff, 0x82,
+      0xfd, 0xfd, 0x0, 0xde, 0xfa, 0x56, 0x0, 0x97, 0x0, 0x3e, 0x0, 0x6c, 0x0,
+      0x38, 0x0, 0x9d, 0xfb, 0xb8, 0xfb, 0x12, 0xfc, 0xfe, 0xfd, 0xb7, 0xfe,
+      0x8b, 0xfc, 0x60, 0xfe, 0xd9, 0xfd, 0x95, 0x0, 0xfa, 0xfd, 0x36, 0x1,
+      0x97, 0xff, 0xd5, 0x0, 0xed, 0x3, 0xa2, 0xfb, 0x9e, 0x1, 0xfc, 0xfb, 0xfe,
+      0x0, 0x66, 0xfd, 0xdd, 0xff, 0x3d, 0xff, 0xaa, 0xff, 0xb9, 0x0, 0x4d,
+      0xfe, 0x83, 0x0, 0xad, 0xfd, 0xca, 0xfe, 0x86, 0xff, 0xbc, 0xfe, 0x3d,
+      0xff, 0x74, 0xff, 0xf6, 0xff, 0xe1, 0xfe, 0x4f, 0x0, 0xe, 0x0, 0x52, 0x1,
+      0xce, 0xfe, 0x81, 0x0, 0x6f, 0xff, 0xc7, 0x0, 0xae, 0xfe, 0x6c, 0xfe,
+      0x43, 0xf9, 0x58, 0x1, 0xf4, 0xfe, 0x74, 0x1, 0x35, 0xfe, 0xc1, 0x0, 0x30,
+      0x2, 0xc3, 0x2, 0x87, 0xfe, 0xeb, 0x0, 0x90, 0x0, 0x27, 0xfd, 0x51, 0x0,
+      0x61, 0x5, 0xfc, 0xff, 0xef, 0x1, 0x8, 0x0, 0x3b, 0x0, 0xf4, 0xff, 0xfe,
+      0xfe, 0x3, 0xff, 0xc6, 0xfc, 0x76, 0x0, 0x9e, 0xfa, 0xfd, 0xfb, 0x59,
+      0xfe, 0x8a, 0xfc, 0xe, 0xff, 0x71, 0xfd, 0xec, 0xfe, 0xab, 0xfd, 0x7f,
+      0xff, 0x79, 0x2, 0x9c, 0x0, 0x70, 0x0, 0xba, 0x0, 0x60, 0xfe, 0xa6, 0x1,
+      0x6a, 0xff, 0x3e, 0xff, 0x63, 0xff, 0x47, 0x0, 0xd2, 0xff, 0x2a, 0x0,
+      0xd2, 0xff, 0xcd, 0x0, 0x1d, 0x0, 0x93, 0xff, 0xb9, 0xff, 0xbf, 0xff,
+      0x54, 0x0, 0x1d, 0xfe, 0xaf, 0xff, 0xe, 0x0, 0x6c, 0xff, 0xb9, 0xff, 0x1d,
+      0x1, 0x1b, 0x0, 0x6e, 0xff, 0x9f, 0xff, 0x99, 0xff, 0xf8, 0xff, 0x1d, 0x1,
+      0xea, 0xff, 0xd2, 0xfb, 0x44, 0xfe, 0xd9, 0xfe, 0x6d, 0x3, 0x21, 0x1,
+      0xf2, 0x0, 0x4e, 0x1, 0x74, 0x0, 0x9e, 0xfb, 0x46, 0x1, 0x2c, 0x0, 0xd3,
+      0xfe, 0x3a, 0x1, 0xd8, 0x2, 0xb5, 0xfd, 0xb3, 0x0, 0x58, 0x5, 0x25, 0xfd,
+      0xa7, 0xff, 0x18, 0xfe, 0x70, 0xfe, 0xdd, 0xfd, 0x9c, 0x1, 0x51, 0xfe,
+      0xdc, 0x1, 0xa7, 0xff, 0xbb, 0x1, 0x2a, 0x0, 0xfa, 0xff, 0x50, 0xff, 0x79,
+      0x1, 0x11, 0x1, 0x2f, 0xff, 0x85, 0x0, 0xf9, 0xff, 0x46, 0x0, 0x2d, 0x1,
+      0x9f, 0xfe, 0x4d, 0x1, 0x5d, 0x2, 0xee, 0xff, 0xaf, 0xfe, 0x7c, 0xff,
+      0xa4, 0xff, 0x2a, 0x0, 0x34, 0xfb, 0xdf, 0xff, 0xfc, 0xfc, 0x18, 0x2,
+      0x51, 0xfe, 0x52, 0xff, 0x96, 0xfe, 0xbd, 0x0, 0xb4, 0xfe, 0xb3, 0x0,
+      0xc1, 0xff, 0x54, 0xff, 0xef, 0xfe, 0xf7, 0xff, 0xc9, 0xff, 0x99, 0x0,
+      0x2d, 0x0, 0x3, 0x1, 0xb4, 0xfe, 0x10, 0xfb, 0x2b, 0xfe, 0x46, 0x1, 0xb6,
+      0xfe, 0xc0, 0x1, 0xa8, 0xff, 0x88, 0xfd, 0x93, 0xfe, 0xa3, 0xfc, 0xe5,
+      0xff, 0x9d, 0xfd, 0x31, 0x0, 0x60, 0xff, 0x4f, 0xf8, 0x6f, 0x0, 0xc7,
+      0xff, 0xb8, 0xfd, 0x9a, 0x1, 0x77, 0xff, 0xb7, 0xff, 0x55, 0x1, 0x1d,
+      0xff, 0xb9, 0xfd, 0xc0, 0xfa, 0x77, 0x3, 0xbc, 0x1, 0x12, 0x1, 0x5f, 0x1,
+      0xcb, 0x1, 0x5b, 0x0, 0xea, 0xff, 0xc5, 0x0, 0x79, 0xfe, 0xef, 0x0, 0x77,
+      0xfe, 0x6, 0xff, 0xa6, 0x2, 0x1e, 0x0, 0x7f, 0x2, 0xc5, 0x0, 0xe0, 0x2,
+      0x89, 0xff, 0x3c, 0x0, 0x7, 0xff, 0x99, 0xfe, 0xbd, 0xff, 0xb3, 0xfe,
+      0xa5, 0xfc, 0xd6, 0x3, 0x5f, 0xff, 0xc0, 0x2, 0xac, 0xff, 0x3e, 0x2, 0x1e,
+      0x0, 0xbd, 0x1, 0x41, 0xff, 0x44, 0x0, 0x6, 0xff, 0x5c, 0x1, 0x70, 0xfe,
+      0xf5, 0x0, 0x59, 0xff, 0xb3, 0x0, 0x4a, 0x0, 0xe0, 0xfe, 0xf2, 0x0, 0xb8,
+      0x0, 0xf1, 0xfe, 0xec, 0x0, 0x35, 0xff, 0x3a, 0x2, 0xef, 0xfb, 0x65, 0xfc,
+      0x86, 0xff, 0x5b, 0xfe, 0xfc, 0xfb, 0xe2, 0xfe, 0x65, 0xff, 0x8f, 0x0,
+      0x83, 0x0, 0xef, 0x0, 0x8e, 0x2, 0xf7, 0xfc, 0x50, 0xfe, 0x54, 0x1, 0x6b,
+      0xfd, 0x52, 0x1, 0xf4, 0xfd, 0x17, 0x5, 0xf1, 0xff, 0x58, 0x3, 0xb5, 0x0,
+      0x4e, 0x0, 0xdc, 0x0, 0x6a, 0xff, 0x68, 0xff, 0x59, 0x0, 0xea, 0xfd, 0x1a,
+      0x0, 0x6, 0xff, 0xd5, 0x1, 0x83, 0x0, 0x4c, 0x2, 0x5f, 0xff, 0x33, 0x2,
+      0x61, 0xff, 0xd, 0xff, 0x34, 0xfd, 0xe2, 0xfd, 0x2a, 0xfe, 0x90, 0xff,
+      0xfd, 0xfd, 0xed, 0x3, 0x35, 0x0, 0x5c, 0x1, 0x6e, 0xff, 0x97, 0x1, 0xbe,
+      0xff, 0xcb, 0x1, 0x22, 0xff, 0x24, 0x0, 0xd4, 0xfe, 0xe1, 0x0, 0x90, 0xfe,
+      0x7d, 0x0, 0x41, 0xff, 0xab, 0x1, 0xcd, 0xfe, 0x8d, 0xfc, 0xfc, 0x0, 0x7f,
+      0xfe, 0x23, 0x0, 0x67, 0x0, 0xf5, 0x1, 0x51, 0x0, 0x55, 0xfd, 0x3a, 0x0,
+      0xf5, 0xff, 0x8d, 0xfb, 0x32, 0xfe, 0x2d, 0x0, 0x6e, 0xfe, 0x1e, 0x2,
+      0x9c, 0x1, 0x88, 0xfd, 0x68, 0x0, 0xc, 0xfe, 0x26, 0x0, 0x3b, 0x0, 0x5e,
+      0xfe, 0x7, 0x1, 0x67, 0xfc, 0xe3, 0x3, 0xec, 0x0, 0xe3, 0xff, 0x11, 0x0,
+      0x64, 0x0, 0x91, 0x0, 0xd7, 0x0, 0x4b, 0xfe, 0xca, 0xff, 0xeb, 0x0, 0xbd,
+      0x1, 0xa0, 0x2, 0x97, 0x1, 0x81, 0xff, 0x49, 0x0, 0xe3, 0xff, 0xb6, 0x0,
+      0x7b, 0xfe, 0x1a, 0x0, 0x2e, 0xff, 0x9c, 0xff, 0xd7, 0xff, 0xf1, 0x0,
+      0xe0, 0xfe, 0xa7, 0x2, 0x53, 0x1, 0x9b, 0x1, 0x62, 0x1, 0xc, 0x1, 0xb,
+      0x0, 0xbd, 0x1, 0x8a, 0xff, 0xcf, 0xff, 0xce, 0xff, 0x36, 0x0, 0x48, 0x0,
+      0xb5, 0xff, 0x85, 0xff, 0x67, 0xff, 0xff, 0xfe, 0xc2, 0xfa, 0x14, 0x1,
+      0x2f, 0xff, 0xb1, 0x0, 0x6a, 0xff, 0x49, 0x0, 0xf3, 0xfe, 0x30, 0xff,
+      0x27, 0xfe, 0xda, 0xfe, 0x24, 0xff, 0x75, 0x1, 0x6f, 0x0, 0x99, 0xff,
+      0xcf, 0x1, 0x70, 0xff, 0x3a, 0xfe, 0xed, 0x0, 0xa1, 0x1, 0xfe, 0x0, 0x93,
+      0xff, 0xbe, 0xfe, 0xea, 0xfe, 0x0, 0xfe, 0x3f, 0x1, 0x87, 0xfe, 0x4a, 0x0,
+      0x4d, 0xfe, 0xbf, 0xff, 0xbe, 0xfe, 0x15, 0x0, 0x5, 0xfe, 0x8d, 0xfe,
+      0x9a, 0xfd, 0x8c, 0x2, 0xb5, 0x0, 0x98, 0xfc, 0xf1, 0x0, 0xe6, 0xfe, 0x85,
+      0x0, 0xaa, 0xff, 0x19, 0x0, 0xeb, 0x0, 0xb, 0x1, 0xf3, 0x0, 0x87, 0x0,
+      0x1d, 0x0, 0x7f, 0x2, 0xdf, 0xff, 0xdf, 0x0, 0xc4, 0x0, 0xb4, 0x0, 0xc1,
+      0x0, 0x65, 0x0, 0x4e, 0x0, 0xf1, 0xff, 0x3c, 0x0, 0xb6, 0x0, 0x16, 0x0,
+      0xca, 0x0, 0x44, 0xff, 0x86, 0x0, 0xbd, 0xff, 0x9c, 0xfe, 0x60, 0xfb,
+      0xe5, 0xfe, 0x93, 0xff, 0xf4, 0x0, 0x4b, 0xff, 0xe8, 0xff, 0x1c, 0x1,
+      0xf2, 0xfe, 0x9a, 0x1, 0x95, 0x0, 0xf2, 0x0, 0x41, 0xff, 0x4b, 0x0, 0x59,
+      0x2, 0x75, 0xff, 0x75, 0xff, 0x1d, 0x1, 0xf5, 0xfd, 0xf3, 0xff, 0x83,
+      0xfe, 0x9a, 0xff, 0x18, 0xff, 0xe7, 0xff, 0xf0, 0xfe, 0x8d, 0x2, 0xb8,
+      0xfe, 0x46, 0x0, 0x0, 0xfe, 0x2e, 0x0, 0xef, 0xfe, 0x38, 0x0, 0x77, 0xff,
+      0x8b, 0x0, 0xcd, 0x0, 0x89, 0x1, 0xf9, 0x1, 0xf9, 0xfd, 0xdb, 0x0, 0xf4,
+      0xfe, 0xc, 0x1, 0xa1, 0xfe, 0x17, 0x1, 0x8c, 0xff, 0x5a, 0x1, 0x69, 0x1,
+      0x9d, 0x0, 0xf2, 0xff, 0x41, 0x2, 0x8b, 0xfe, 0x35, 0xff, 0xf4, 0xff,
+      0x4f, 0x0, 0x3e, 0xff, 0xa7, 0xff, 0x4e, 0xff, 0x1e, 0x0, 0xaa, 0xff,
+      0x72, 0x1, 0xe2, 0xff, 0x37, 0x1, 0xbd, 0xff, 0xc8, 0x0, 0xc5, 0xfe, 0x43,
+      0xfe, 0xe2, 0xfa, 0x11, 0xff, 0x15, 0x0, 0x4e, 0xfe, 0x5a, 0x0, 0x52,
+      0xff, 0xe9, 0xfe, 0x7, 0x0, 0x96, 0xff, 0x48, 0xff, 0x27, 0x0, 0xb3, 0xff,
+      0xce, 0xfe, 0x69, 0x1, 0xf3, 0xfe, 0x7, 0xfe, 0x97, 0x1, 0xe6, 0xfe, 0x95,
+      0x2, 0x0, 0x0, 0x43, 0x0, 0x3f, 0x0, 0x76, 0xff, 0x1b, 0xff, 0xcd, 0xfe,
+      0x43, 0x0, 0xb9, 0xff, 0x35, 0x0, 0x4d, 0x1, 0x50, 0x0, 0xd7, 0x0, 0x9,
+      0x0, 0x8a, 0x1, 0x2, 0x1, 0x9, 0xff, 0xca, 0xfe, 0x40, 0x0, 0x5, 0x0,
+      0xf3, 0xff, 0xed, 0x0, 0xd3, 0xff, 0x6, 0x1, 0x30, 0x0, 0x48, 0x2, 0x47,
+      0x0, 0x4e, 0x2, 0x46, 0x0, 0x37, 0x4, 0x55, 0xfc, 0x57, 0xff, 0x70, 0xff,
+      0x5d, 0xff, 0x17, 0xff, 0xa, 0x0, 0x10, 0xff, 0xcc, 0x0, 0xeb, 0xff, 0xb3,
+      0x0, 0x17, 0x0, 0x2d, 0x0, 0xcd, 0x0, 0x2a, 0x1, 0x55, 0x0, 0xb0, 0xfe,
+      0x4a, 0xfd, 0x31, 0xfe, 0x63, 0xff, 0x15, 0x0, 0x92, 0xff, 0x7d, 0xff,
+      0x48, 0x0, 0x44, 0xfe, 0x7d, 0x0, 0xe, 0x1, 0x76, 0x2, 0x89, 0xff, 0x1a,
+      0xff, 0x7d, 0x0, 0x4c, 0xfe, 0xa9, 0xff, 0x2, 0x1, 0x0, 0x1, 0x14, 0x1,
+      0x8e, 0xff, 0xc7, 0xff, 0x59, 0xfe, 0x9c, 0xff, 0xef, 0x0, 0x97, 0x2,
+      0x20, 0x0, 0xc6, 0x2, 0x7e, 0x0, 0x43, 0x1, 0xc2, 0xff, 0x8, 0x0, 0xfc,
+      0x0, 0x53, 0x0, 0x32, 0xff, 0xb1, 0xff, 0xc7, 0xfe, 0x2d, 0x2, 0x64, 0xfe,
+      0xd6, 0x1, 0x7f, 0xff, 0x1f, 0x0, 0xb2, 0x0, 0xd5, 0xff, 0xfb, 0xff, 0x1b,
+      0xff, 0x86, 0xff, 0x17, 0xff, 0xe5, 0x2, 0x96, 0xfd, 0xf9, 0xfe, 0x92,
+      0xfe, 0xe8, 0xfe, 0x8c, 0xfe, 0xc0, 0xff, 0x16, 0xff, 0x9e, 0x0, 0xbb,
+      0xff, 0x3b, 0x0, 0x5e, 0x0, 0xd1, 0xff, 0xb3, 0x0, 0x4a, 0x0, 0xf6, 0x0,
+      0x64, 0xfe, 0xd8, 0xfc, 0xda, 0xff, 0x95, 0x0, 0x4f, 0x0, 0xce, 0x0, 0xe8,
+      0xff, 0x41, 0x0, 0x23, 0xfc, 0x44, 0x2, 0x33, 0x0, 0xf8, 0xfe, 0xc9, 0xfe,
+      0x24, 0xff, 0xb2, 0xfe, 0x7c, 0x1, 0xa0, 0x0, 0x67, 0x0, 0x44, 0x0, 0xa5,
+      0xff, 0x82, 0x0, 0x16, 0x0, 0xdd, 0xff, 0x65, 0x1, 0x5f, 0x0, 0xcc, 0x2,
+      0x6e, 0x1, 0x70, 0x0, 0x6c, 0x1, 0xfe, 0x2, 0x5e, 0x0, 0xd6, 0xff, 0xfc,
+      0xff, 0x78, 0x0, 0xd, 0x0, 0x49, 0xff, 0xa7, 0xfe, 0x1e, 0x2, 0x8f, 0xff,
+      0xcb, 0x1, 0x4d, 0xff, 0x7d, 0x1, 0x1b, 0x0, 0x1c, 0x0, 0xb, 0x0, 0x9e,
+      0xfe, 0x56, 0x2, 0x7a, 0xff, 0xa, 0x1, 0x44, 0xff, 0x66, 0x0, 0x51, 0x0,
+      0x3f, 0x0, 0xfb, 0xfe, 0x39, 0x0, 0x54, 0xff, 0x86, 0xff, 0x5c, 0x0, 0xc0,
+      0xff, 0xdb, 0x0, 0xb2, 0xff, 0xea, 0x0, 0x5c, 0xff, 0xf1, 0x0, 0xa6, 0xff,
+      0x78, 0xfd, 0x6e, 0x0, 0x92, 0x0, 0x48, 0x0, 0xc0, 0x0, 0x7a, 0xff, 0xd,
+      0x1, 0x7b, 0xfc, 0x45, 0x0, 0x2c, 0xff, 0x61, 0xff, 0x5f, 0xff, 0x1a, 0x0,
+      0xfa, 0xfe, 0xbf, 0x0, 0xf0, 0xff, 0x5c, 0x0, 0x36, 0x1, 0x38, 0x0, 0x41,
+      0x0, 0x43, 0x0, 0x3e, 0xff, 0x89, 0x0, 0x4d, 0x2, 0x75, 0x1, 0x5, 0x0,
+      0xd6, 0x1, 0x56, 0x0, 0x7b, 0x1, 0x98, 0x0, 0x7d, 0xff, 0x9e, 0xff, 0xe6,
+      0xfd, 0xf3, 0xfe, 0xb0, 0xff, 0xce, 0xfe, 0xf6, 0xff, 0x26, 0x0, 0xc6,
+      0x0, 0x20, 0x0, 0xbf, 0x0, 0x23, 0x0, 0x88, 0xff, 0x57, 0x0, 0xca, 0xff,
+      0x9e, 0xff, 0xc5, 0xff, 0xb2, 0xff, 0x29, 0x0, 0xc0, 0x0, 0x8b, 0xfe,
+      0x19, 0x0, 0x60, 0xff, 0xfa, 0xff, 0x4e, 0xff, 0x6c, 0xff, 0x31, 0x0,
+      0xa2, 0xff, 0x9d, 0x0, 0x22, 0x0, 0x41, 0x0, 0x35, 0xff, 0x2, 0x1, 0x76,
+      0xfe, 0xf7, 0xfc, 0xc5, 0xff, 0xb6, 0xfe, 0xc9, 0xff, 0xa8, 0xff, 0xb0,
+      0x0, 0x7f, 0xff, 0x3, 0xfd, 0x50, 0x3, 0x7f, 0x0, 0xf4, 0xfe, 0x1a, 0x0,
+      0x31, 0x0, 0x36, 0xfe, 0x40, 0x0, 0xd3, 0x1, 0x7f, 0xfe, 0x5a, 0xff, 0x86,
+      0xff, 0xe1, 0xff, 0x70, 0x0, 0x4, 0xff, 0x94, 0xff, 0xa3, 0xff, 0x58, 0x0,
+      0xb8, 0x0, 0x3a, 0xff, 0xcd, 0xff, 0x95, 0xff, 0xcc, 0xff, 0xe4, 0xff,
+      0x86, 0xff, 0x77, 0xff, 0x15, 0x1, 0x87, 0xff, 0x5c, 0x2, 0x4e, 0xff,
+      0xa8, 0x0, 0xd5, 0xff, 0xc, 0x0, 0x86, 0xff, 0xa7, 0x0, 0x9d, 0xff, 0xd3,
+      0x0, 0xb0, 0x0, 0x8e, 0x1, 0x38, 0x0, 0x75, 0xfd, 0x38, 0x1, 0xb2, 0x0,
+      0x94, 0xff, 0x16, 0x1, 0x52, 0xff, 0x8, 0x0, 0xa5, 0xff, 0xd1, 0xff, 0xfe,
+      0xff, 0x7e, 0x0, 0xff, 0xff, 0xd6, 0x0, 0x48, 0xff, 0x5c, 0xff, 0xda,
+      0xfe, 0xcd, 0xfe, 0x1b, 0xfd, 0x4c, 0x1, 0x5b, 0x0, 0x9d, 0xff, 0xaa,
+      0xff, 0x51, 0xff, 0xf1, 0xff, 0x79, 0xfe, 0xe0, 0xff, 0x3f, 0xff, 0x0,
+      0x0, 0xc8, 0xff, 0xd7, 0xff, 0xc1, 0x1, 0xc1, 0xff, 0xa0, 0xff, 0x39, 0x1,
+      0xd8, 0xff, 0xb0, 0x1, 0xa, 0x0, 0xd1, 0xff, 0x72, 0x0, 0xde, 0xff, 0x20,
+      0x1, 0x5c, 0xfd, 0x2b, 0xff, 0x4, 0x0, 0x60, 0xff, 0xf6, 0xfe, 0xe8, 0xfe,
+      0x38, 0x0, 0xfb, 0xfe, 0x2b, 0x0, 0x19, 0x0, 0x15, 0x0, 0x2, 0x0, 0x53,
+      0xfd, 0x2a, 0x1, 0xbf, 0xfe, 0x57, 0x0, 0x4f, 0xff, 0x46, 0x1, 0x72, 0xff,
+      0x2f, 0x1, 0xef, 0x0, 0x94, 0x0, 0xe1, 0x0, 0xd9, 0xff, 0xb8, 0xff, 0x3e,
+      0x0, 0x43, 0xff, 0x56, 0x0, 0x77, 0xff, 0xd4, 0xff, 0x9d, 0xff, 0x8a, 0x0,
+      0x24, 0x0, 0xa5, 0x0, 0x4a, 0xff, 0xb6, 0x0, 0x6d, 0xff, 0x68, 0x0, 0x8c,
+      0xff, 0x6c, 0xfe, 0x9d, 0xfd, 0x2b, 0xff, 0xfd, 0xff, 0x26, 0x0, 0xea,
+      0xff, 0xe7, 0xff, 0xaf, 0x0, 0xcf, 0xff, 0x21, 0x1, 0xd5, 0xff, 0x45, 0x2,
+      0x2b, 0x0, 0x5e, 0x0, 0x1b, 0x1, 0x85, 0xfe, 0x45, 0x0, 0xaa, 0xff, 0xb2,
+      0xff, 0x34, 0x0, 0x68, 0xff, 0x82, 0xff, 0xc2, 0xff, 0xd7, 0xff, 0x24,
+      0x1, 0xcc, 0xfd, 0x2e, 0xff, 0xee, 0xfe, 0xef, 0xfe, 0x4f, 0xfe, 0x87,
+      0xff, 0x45, 0x0, 0xc3, 0x0, 0x3a, 0x0, 0x96, 0x1, 0x31, 0x0, 0x3b, 0x0,
+      0xe9, 0xff, 0x82, 0xff, 0xfb, 0xff, 0x99, 0xff, 0x68, 0xff, 0xa4, 0x0,
+      0x41, 0xff, 0x41, 0x0, 0xed, 0x0, 0x14, 0xff, 0x42, 0x0, 0x64, 0xff, 0xa1,
+      0xff, 0xb3, 0xff, 0x80, 0xff, 0x10, 0x0, 0x2d, 0xff, 0xc9, 0xff, 0xb7,
+      0xff, 0xa2, 0x0, 0xb1, 0xff, 0xae, 0x0, 0x29, 0xff, 0xc3, 0x0, 0x75, 0xff,
+      0x97, 0x0, 0xd1, 0xfe, 0x36, 0xfe, 0x6d, 0xfd, 0xf4, 0xfe, 0x27, 0x0,
+      0x3d, 0x0, 0x8b, 0x0, 0x5f, 0xff, 0x11, 0xff, 0xf1, 0xfe, 0x3b, 0x1, 0xb8,
+      0xff, 0xfd, 0x0, 0xae, 0x0, 0xa6, 0xff, 0x3f, 0x0, 0xa3, 0xff, 0xce, 0xff,
+      0x77, 0x0, 0x77, 0xff, 0x10, 0x1, 0x9a, 0x0, 0x45, 0xff, 0xf8, 0x1, 0xca,
+      0xff, 0xcd, 0x1, 0x78, 0xfc, 0x21, 0x0, 0xe6, 0xfe, 0xca, 0xff, 0xa7,
+      0xff, 0xe, 0x0, 0xa2, 0x0, 0xa1, 0x0, 0xb6, 0x1, 0xd9, 0xff, 0x4d, 0x0,
+      0x5f, 0xfe, 0x8e, 0x0, 0xa3, 0xff, 0x3f, 0x0, 0x5, 0x0, 0x54, 0x0, 0xb3,
+      0xff, 0x58, 0x0, 0xf7, 0xff, 0x9b, 0xff, 0xe8, 0xff, 0xa0, 0xff, 0x71,
+      0x0, 0x6b, 0xff, 0x8d, 0xff, 0x2e, 0x0, 0x88, 0xff, 0xd6, 0xff, 0x5b, 0x0,
+      0xda, 0xff, 0x56, 0x0, 0x20, 0x0, 0xf3, 0xff, 0xbd, 0xff, 0xff, 0xff,
+      0x38, 0x0, 0xdb, 0x0, 0xe8, 0xff, 0x9e, 0xfe, 0x11, 0xfe, 0x58, 0xff,
+      0x83, 0x0, 0xec, 0x0, 0x38, 0x0, 0xba, 0xfe, 0x44, 0x1, 0x71, 0xfe, 0x80,
+      0x1, 0x8e, 0x0, 0xa6, 0x1, 0x8f, 0xfe, 0xe7, 0xff, 0x55, 0x0, 0xe1, 0xff,
+      0x9c, 0xff, 0x49, 0x0, 0xf7, 0x0, 0x9f, 0x0, 0x91, 0x0, 0x61, 0xff, 0x2b,
+      0x1, 0x66, 0x0, 0x81, 0x2, 0xc0, 0xff, 0x4b, 0xff, 0xb7, 0x0, 0x14, 0x0,
+      0x4, 0x0, 0xe1, 0xff, 0xb2, 0xff, 0x8, 0x1, 0xc, 0x0, 0xca, 0xff, 0x95,
+      0x0, 0x45, 0xfe, 0x38, 0x1, 0xcb, 0xff, 0x8a, 0x0, 0xe4, 0xff, 0x0, 0x0,
+      0xb7, 0xff, 0xcc, 0xff, 0x6, 0xff, 0x4b, 0xff, 0xfa, 0xfd, 0x9e, 0xff,
+      0x1e, 0x0, 0x48, 0x0, 0x13, 0xff, 0x39, 0x0, 0xca, 0xfe, 0xe6, 0xff, 0xc8,
+      0xff, 0x21, 0x0, 0xdd, 0xff, 0xf5, 0xff, 0xb5, 0xff, 0x44, 0x0, 0xc2,
+      0xff, 0x1f, 0x0, 0x0, 0x0, 0x59, 0x0, 0x51, 0xfe, 0x57, 0xfe, 0xd6, 0xff,
+      0x34, 0x0, 0xc6, 0xff, 0x84, 0x0, 0x31, 0x0, 0xf7, 0xff, 0x4c, 0xfe, 0x4,
+      0x2, 0xbc, 0xff, 0xe, 0x0, 0x6a, 0xff, 0xc8, 0xff, 0xe6, 0xfd, 0xb4, 0x0,
+      0xea, 0x0, 0x56, 0xff, 0x55, 0x0, 0xe6, 0xff, 0xf8, 0x0, 0x7f, 0x0, 0x3a,
+      0x1, 0xb4, 0x0, 0xf6, 0xff, 0x7f, 0x0, 0xb0, 0x0, 0xe7, 0xfe, 0x17, 0x1,
+      0x5e, 0x0, 0x3b, 0x0, 0x19, 0x0, 0xce, 0x0, 0x26, 0x0, 0xcd, 0xff, 0xe6,
+      0xfe, 0xf6, 0xfe, 0xc6, 0x0, 0x12, 0x0, 0xb6, 0x0, 0x8c, 0xff, 0x8c, 0x0,
+      0x6d, 0xff, 0x62, 0x0, 0xf5, 0xfe, 0x3e, 0xff, 0x29, 0x0, 0x7, 0x0, 0xb4,
+      0xfe, 0xff, 0x0, 0x36, 0x0, 0x20, 0x1, 0xa3, 0xff, 0x3a, 0x0, 0x37, 0x0,
+      0x56, 0x0, 0xaf, 0xff, 0x14, 0x0, 0x8a, 0xff, 0x85, 0x0, 0x70, 0xff, 0x18,
+      0x0, 0x71, 0xff, 0xe0, 0xff, 0x18, 0xff, 0xa8, 0xfe, 0xf3, 0xff, 0xd5,
+      0x0, 0x38, 0x0, 0x1f, 0x0, 0xc5, 0xff, 0x72, 0x0, 0x8d, 0xfd, 0x1c, 0x0,
+      0xbf, 0xff, 0xda, 0x0, 0xc7, 0xff, 0xe0, 0xff, 0xdc, 0xfe, 0xa, 0x0, 0x9f,
+      0x0, 0xcc, 0x0, 0xef, 0x0, 0x17, 0x0, 0x4d, 0x0, 0x7d, 0x0, 0xc1, 0x0,
+      0xeb, 0xff, 0xd9, 0x0, 0xcd, 0xff, 0x63, 0x0, 0x9f, 0x0, 0x5f, 0x0, 0xf2,
+      0xff, 0xc5, 0xff, 0xd6, 0xff, 0x7b, 0x0, 0xdd, 0xfe, 0xeb, 0xfe, 0xbe,
+      0x0, 0xa4, 0xff, 0x1d, 0xff, 0xc2, 0xff, 0xbd, 0xff, 0xe4, 0xff, 0x43,
+      0x0, 0x8b, 0xff, 0xf2, 0xff, 0xb4, 0xfe, 0x4, 0x0, 0xe4, 0xfe, 0xf1, 0xff,
+      0x34, 0xff, 0x4d, 0x1, 0x2d, 0x0, 0xe4, 0xff, 0x30, 0x0, 0x94, 0x0, 0x28,
+      0x0, 0x45, 0x0, 0x0, 0x0, 0x15, 0x0, 0xda, 0xff, 0x11, 0x0, 0x75, 0xff,
+      0xc6, 0xff, 0x4d, 0xff, 0xc, 0x0, 0x6c, 0xfe, 0xd, 0xfe, 0xe8, 0xff, 0xb3,
+      0xff, 0xea, 0xff, 0x71, 0xff, 0xea, 0xff, 0xf, 0x0, 0x2c, 0xfd, 0x6f, 0x1,
+      0x11, 0x0, 0x8c, 0x0, 0xd3, 0xff, 0xa, 0x0, 0xa5, 0xff, 0xdb, 0xff, 0x16,
+      0x1, 0xae, 0xff, 0xcb, 0xff, 0x3e, 0xff, 0xd0, 0x0, 0x58, 0x0, 0x44, 0x0,
+      0xeb, 0xff, 0x1b, 0xff, 0xad, 0xff, 0x94, 0x0, 0x4c, 0xfe, 0xd9, 0xff,
+      0x9, 0xff, 0xeb, 0xff, 0x16, 0x0, 0xd2, 0xff, 0xf5, 0xff, 0xfa, 0x0, 0x1e,
+      0x0, 0x90, 0x1, 0x2c, 0xff, 0xd2, 0xff, 0x2e, 0xff, 0xa0, 0xff, 0xf0,
+      0xff, 0xbf, 0xff, 0xe6, 0xff, 0x5a, 0xff, 0x67, 0x0, 0x9f, 0x0, 0x40, 0x0,
+      0x64, 0xfe, 0x55, 0x1, 0x52, 0x0, 0x9a, 0x0, 0xca, 0x0, 0xce, 0x0, 0x1c,
+      0x0, 0x63, 0x0, 0xd4, 0xff, 0xed, 0xff, 0x7e, 0x0, 0x9c, 0xff, 0xe9, 0xff,
+      0x4d, 0xff, 0x55, 0xff, 0xf8, 0xfe, 0x1f, 0xff, 0xd7, 0xfe, 0x54, 0x0,
+      0x35, 0x0, 0x3f, 0xff, 0x87, 0xff, 0x2a, 0xff, 0xa7, 0xff, 0x51, 0xff,
+      0xf7, 0xff, 0x6b, 0xff, 0xef, 0xff, 0x60, 0x0, 0x53, 0x0, 0xd9, 0x0, 0xf9,
+      0xff, 0x97, 0xff, 0xc8, 0x0, 0x9, 0x0, 0x6d, 0x0, 0x2d, 0x1, 0xb5, 0xff,
+      0xf4, 0x0, 0x65, 0xff, 0x4f, 0x0, 0x5b, 0xfe, 0x6d, 0xff, 0xab, 0xff,
+      0x8f, 0xff, 0xfc, 0xfe, 0x2a, 0x0, 0x9d, 0x0, 0x73, 0xff, 0x68, 0x0, 0xbe,
+      0xff, 0xfa, 0xff, 0xbb, 0x0, 0x89, 0xfe, 0x67, 0x0, 0x91, 0xfe, 0x4c, 0x0,
+      0xba, 0xff, 0x13, 0x0, 0x3e, 0x0, 0xdd, 0xff, 0x45, 0x0, 0xe6, 0xff, 0x3e,
+      0x0, 0x27, 0x0, 0xc5, 0xff, 0x6, 0x0, 0xcc, 0xff, 0xd, 0x0, 0xd5, 0x0,
+      0x11, 0x0, 0x1c, 0x0, 0x16, 0x0, 0xc4, 0xff, 0x48, 0x0, 0x8b, 0xff, 0xfd,
+      0xff, 0xc0, 0xff, 0x41, 0x0, 0xfa, 0xff, 0xa3, 0xfe, 0x96, 0xfe, 0x49,
+      0xff, 0x2c, 0x0, 0x8b, 0xff, 0x14, 0x0, 0x5a, 0xff, 0x1d, 0x0, 0xdf, 0x0,
+      0xb4, 0x0, 0x29, 0x0, 0x34, 0x0, 0xc4, 0xff, 0x68, 0x0, 0x71, 0x0, 0x6,
+      0x0, 0xb8, 0xff, 0xf, 0x0, 0x9, 0x0, 0x7, 0x0, 0xca, 0x0, 0xf0, 0xff,
+      0x6d, 0x0, 0x8f, 0xff, 0x40, 0x0, 0x48, 0xff, 0x98, 0xff, 0x6d, 0xff,
+      0xb3, 0xff, 0xe2, 0xfe, 0xff, 0xff, 0xf9, 0xff, 0x82, 0x0, 0x34, 0x0,
+      0xcb, 0x0, 0x44, 0x0, 0x9e, 0x1, 0x9c, 0x0, 0x2a, 0x0, 0x72, 0xff, 0xe9,
+      0xff, 0x3b, 0xff, 0x1e, 0x0, 0xb6, 0xff, 0xc4, 0xff, 0x6a, 0x0, 0xb0,
+      0xff, 0xde, 0xff, 0x6a, 0x0, 0x6e, 0xff, 0xc5, 0xff, 0xc, 0x0, 0x1e, 0x0,
+      0x32, 0x0, 0xe0, 0xff, 0x3b, 0x0, 0xf7, 0xff, 0xa2, 0xff, 0x4f, 0x0, 0xa8,
+      0xff, 0x2b, 0x0, 0xbb, 0xff, 0x3b, 0x0, 0x14, 0x0, 0x4f, 0xfe, 0xe3, 0xfe,
+      0x91, 0xff, 0xe8, 0xff, 0x52, 0x0, 0x59, 0x0, 0x91, 0xff, 0xc3, 0xff,
+      0xf3, 0xff, 0xba, 0xff, 0xa5, 0xff, 0xb, 0x0, 0x6a, 0x0, 0x8, 0x0, 0x93,
+      0x0, 0x28, 0x0, 0xb2, 0xfe, 0x6a, 0x0, 0x80, 0xff, 0x19, 0x1, 0xa, 0x1,
+      0x78, 0x0, 0x1a, 0x1, 0x4d, 0x0, 0x43, 0x0, 0xa0, 0xff, 0xdd, 0xff, 0xbc,
+      0xff, 0x54, 0x0, 0x82, 0xff, 0xd1, 0xff, 0x6, 0x0, 0xf9, 0xff, 0xbd, 0x0,
+      0xdb, 0xff, 0x78, 0xff, 0x8, 0x0, 0x88, 0x0, 0x17, 0x0, 0xf0, 0xff, 0x22,
+      0x0, 0x3, 0x0, 0xd7, 0xff, 0xde, 0xff, 0xee, 0xff, 0xce, 0xff, 0xf2, 0xff,
+      0x18, 0x0, 0xf5, 0x0, 0xef, 0xfe, 0xf4, 0xff, 0xfd, 0xff, 0xbb, 0xff,
+      0x5e, 0x0, 0x1a, 0x0, 0x3c, 0x0, 0xb9, 0xff, 0x12, 0x0, 0xef, 0xff, 0xf3,
+      0xff, 0xd4, 0xff, 0x65, 0x0, 0x91, 0x0, 0xca, 0x0, 0x97, 0xfe, 0x1e, 0xff,
+      0x46, 0xff, 0x73, 0x0, 0xa4, 0x0, 0xe6, 0xff, 0xea, 0xff, 0xd1, 0x0, 0x91,
+      0xff, 0x44, 0x0, 0x5d, 0x0, 0xde, 0x0, 0xa6, 0xff, 0x1, 0x0, 0x0, 0x0,
+      0xe9, 0xff, 0x14, 0xff, 0xcc, 0xff, 0xef, 0xff, 0x11, 0x0, 0x39, 0x0,
+      0x1f, 0x0, 0xae, 0xff, 0x38, 0x0, 0x64, 0x0, 0x17, 0x1, 0xdc, 0xff, 0x6d,
+      0x0, 0xce, 0xff, 0x3c, 0x0, 0xf5, 0xff, 0xc4, 0xff, 0xad, 0x0, 0x7e, 0xff,
+      0xf0, 0xff, 0x63, 0x0, 0xf6, 0xff, 0x15, 0x1, 0x71, 0xff, 0x6d, 0x0, 0x5a,
+      0x0, 0x67, 0x0, 0xe, 0x0, 0xdf, 0xff, 0x74, 0xff, 0xf9, 0xff, 0x3, 0xff,
+      0xc7, 0xff, 0xab, 0x0, 0x93, 0xff, 0xac, 0xff, 0x1, 0x0, 0xb5, 0xff, 0x35,
+      0x0, 0xa, 0x0, 0xfe, 0xff, 0xb4, 0xff, 0xe1, 0xff, 0xc, 0x0, 0x5a, 0x0,
+      0xda, 0xff, 0x91, 0x0, 0x19, 0x0, 0xbe, 0x0, 0x4b, 0xfe, 0xa4, 0xfe, 0xf7,
+      0xff, 0x5a, 0x0, 0x87, 0xff, 0x45, 0x0, 0x82, 0x0, 0xa9, 0xff, 0xc3, 0xfe,
+      0x45, 0x0, 0x0, 0x0, 0x1, 0x0, 0xb6, 0xff, 0x68, 0xff, 0x65, 0xff, 0x4a,
+      0x0, 0x2a, 0x0, 0xc5, 0xff, 0xea, 0xff, 0x9d, 0xff, 0x84, 0x0, 0xda, 0xff,
+      0x59, 0x0, 0x54, 0x0, 0x81, 0xff, 0xe6, 0x0, 0xf9, 0x0, 0xb, 0xff, 0x2b,
+      0x0, 0x1d, 0x0, 0xba, 0xff, 0x32, 0x0, 0x35, 0x0, 0x0, 0x0, 0x98, 0xff,
+      0xa0, 0xff, 0xc0, 0xff, 0xae, 0x0, 0xc6, 0xff, 0x9b, 0x0, 0xeb, 0xff,
+      0x9c, 0x0, 0xc1, 0xff, 0x43, 0x0, 0x55, 0xff, 0xd5, 0xff, 0x89, 0x0, 0xc3,
+      0xff, 0xdd, 0xff, 0x3e, 0x0, 0x74, 0x0, 0x7c, 0x0, 0x2b, 0x0, 0x25, 0x0,
+      0x51, 0x0, 0xf3, 0xff, 0xaf, 0xff, 0x14, 0x0, 0x15, 0x0, 0x63, 0x0, 0xb0,
+      0xff, 0x59, 0x0, 0xb8, 0xff, 0x6a, 0x0, 0xf7, 0xfe, 0x39, 0xff, 0x6, 0x0,
+      0x79, 0x0, 0xec, 0xff, 0xfb, 0xff, 0xe2, 0xff, 0x5c, 0x0, 0xd9, 0xfe,
+      0xbc, 0xff, 0xd3, 0xff, 0xb0, 0x0, 0x95, 0xff, 0xa5, 0xff, 0xc3, 0xff,
+      0xdd, 0xff, 0x5f, 0x0, 0xd9, 0xff, 0xb7, 0x0, 0xf2, 0xff, 0x3c, 0x0, 0xeb,
+      0xff, 0xe2, 0xff, 0xf9, 0xff, 0xd5, 0xff, 0xdf, 0x0, 0xf6, 0xff, 0x71,
+      0x0, 0x1, 0x0, 0xd7, 0xff, 0x95, 0xff, 0xf7, 0xff, 0x6b, 0x0, 0x18, 0xff,
+      0x80, 0xff, 0x76, 0x0, 0x8, 0x0, 0x7d, 0xff, 0xe1, 0xff, 0x8, 0x0, 0xfe,
+      0xff, 0x1b, 0x0, 0xd4, 0xff, 0xc9, 0xff, 0x1c, 0xff, 0xb, 0x0, 0x9b, 0xff,
+      0xd, 0x0, 0x14, 0x0, 0x6b, 0x0, 0x23, 0x0, 0xb3, 0xff, 0x8, 0x0, 0x3b,
+      0x0, 0x1b, 0x0, 0xb6, 0xff, 0x2, 0x0, 0x2d, 0x0, 0x25, 0x0, 0x18, 0x0,
+      0xe2, 0xff, 0x20, 0x0, 0xc8, 0xff, 0x4b, 0x0, 0x8a, 0xfe, 0xbb, 0xfe,
+      0xcf, 0xff, 0xf4, 0xff, 0xe8, 0xff, 0xfb, 0xff, 0x1b, 0x0, 0xa0, 0xff,
+      0x78, 0xff, 0xb8, 0x0, 0xed, 0xff, 0x63, 0xff, 0xb6, 0xff, 0x18, 0x0,
+      0x94, 0xff, 0xe7, 0xff, 0xcd, 0x0, 0x5e, 0xff, 0xfe, 0xff, 0x63, 0xff,
+      0xad, 0x0, 0x2, 0x0, 0xc5, 0xff, 0x9e, 0xff, 0xd5, 0xfe, 0x62, 0x0, 0x57,
+      0x0, 0x40, 0xff, 0xe2, 0xff, 0xb3, 0xff, 0xe6, 0xff, 0x26, 0x0, 0x39, 0x0,
+      0xf2, 0xff, 0x8b, 0x0, 0xc6, 0xff, 0x3, 0x1, 0xa2, 0xff, 0x16, 0x0, 0xa0,
+      0xff, 0xe6, 0xff, 0xeb, 0xff, 0x25, 0x0, 0x1e, 0x0, 0xfe, 0xff, 0x0, 0x0,
+      0xdc, 0x0, 0xf4, 0xff, 0x7b, 0xff, 0x4b, 0x0, 0x49, 0x0, 0x47, 0x0, 0x72,
+      0x0, 0x37, 0x0, 0x27, 0x0, 0xcd, 0xff, 0xf6, 0xff, 0xf, 0x0, 0x45, 0x0,
+      0xef, 0xff, 0x61, 0x0, 0xae, 0xff, 0xdd, 0xff, 0x9c, 0xff, 0xcd, 0xfe,
+      0x22, 0xff, 0xf4, 0xff, 0x2, 0x0, 0x2b, 0x0, 0x13, 0x0, 0xae, 0xff, 0xd0,
+      0xff, 0x23, 0x0, 0xe0, 0xfe, 0xcc, 0xff, 0x75, 0xff, 0x12, 0x0, 0x4a, 0x0,
+      0xd5, 0x0, 0xa0, 0xff, 0x48, 0xff, 0x4d, 0x0, 0x33, 0x0, 0x69, 0x0, 0x59,
+      0x0, 0x8c, 0xff, 0x36, 0x0, 0xa4, 0xff, 0x4c, 0x0, 0xdf, 0xff, 0x80, 0xff,
+      0xf4, 0x0, 0xd4, 0xff, 0x42, 0xff, 0x7f, 0xff, 0x16, 0x0, 0x90, 0xff,
+      0x1a, 0x0, 0xbc, 0xff, 0x69, 0xff, 0x29, 0x0, 0x2f, 0xff, 0x91, 0x0, 0x39,
+      0xff, 0x31, 0x0, 0xe0, 0xff, 0x52, 0x0, 0x11, 0x0, 0x78, 0x0, 0xda, 0xff,
+      0xee, 0xff, 0xfe, 0xff, 0x7b, 0x0, 0x85, 0xff, 0x13, 0x0, 0x6d, 0xff,
+      0xfd, 0xff, 0x21, 0x0, 0x11, 0x0, 0xe7, 0xff, 0xc, 0x0, 0x15, 0x0, 0xf8,
+      0xff, 0xb5, 0xff, 0x5e, 0x0, 0xe1, 0xff, 0x5e, 0x0, 0x2, 0x0, 0x85, 0xfe,
+      0x2e, 0xff, 0x6f, 0xff, 0xdb, 0xff, 0x10, 0x0, 0xd, 0x0, 0xe4, 0xff, 0x4a,
+      0x0, 0xe2, 0x0, 0xa6, 0xff, 0x20, 0x0, 0x23, 0x0, 0xcb, 0xff, 0xea, 0xff,
+      0x26, 0x0, 0xef, 0xff, 0xb6, 0xff, 0x58, 0xff, 0xba, 0xff, 0x25, 0x0,
+      0xe7, 0xff, 0xd8, 0xff, 0x46, 0xff, 0x29, 0x0, 0x57, 0xff, 0x1d, 0x0,
+      0x86, 0xff, 0x3b, 0x0, 0xe7, 0xff, 0x86, 0xff, 0xd3, 0xff, 0xd, 0x0, 0x1c,
+      0x0, 0x13, 0x0, 0x9a, 0x0, 0x6f, 0xff, 0x86, 0x0, 0x84, 0x0, 0x3c, 0x0,
+      0xf5, 0xff, 0xb, 0x0, 0xd1, 0xff, 0x71, 0x0, 0xde, 0xff, 0x6e, 0x0, 0x11,
+      0x0, 0x59, 0x0, 0xf2, 0xff, 0x40, 0x0, 0x79, 0xff, 0xba, 0xff, 0x3, 0x0,
+      0x11, 0x0, 0xdb, 0xff, 0x7, 0x0, 0xf2, 0xff, 0x7, 0x0, 0xf5, 0xff, 0x22,
+      0x0, 0xb2, 0xff, 0x56, 0x0, 0x1f, 0x0, 0x2b, 0x0, 0xb6, 0xff, 0x84, 0xfe,
+      0x9a, 0xff, 0xe4, 0xff, 0xfb, 0xff, 0x31, 0x0, 0x8c, 0x0, 0xdd, 0xff,
+      0xec, 0xff, 0x8c, 0x0, 0x1d, 0xff, 0xe2, 0xff, 0x7, 0x0, 0xc, 0x0, 0xf1,
+      0xff, 0x75, 0x0, 0xa3, 0x0, 0x92, 0xff, 0x68, 0x0, 0xa5, 0xff, 0x91, 0x0,
+      0xe6, 0xff, 0xcc, 0xff, 0x8, 0x0, 0x1b, 0x0, 0x0, 0x0, 0xc9, 0xff, 0xe2,
+      0xff, 0x47, 0x0, 0x40, 0x0, 0xd2, 0xff, 0xe8, 0xff, 0x96, 0x0, 0xb1, 0xff,
+      0x6b, 0x0, 0x57, 0xff, 0x8d, 0xff, 0x40, 0xff, 0x62, 0x0, 0x42, 0x0, 0x61,
+      0x0, 0x2, 0x0, 0x36, 0x0, 0x53, 0x0, 0x34, 0x0, 0x3a, 0x0, 0xd7, 0xff,
+      0x12, 0x0, 0xe3, 0xff, 0x88, 0x0, 0x5e, 0xff, 0xf6, 0xff, 0xe6, 0xff,
+      0xb2, 0xff, 0xe5, 0xff, 0x31, 0x0, 0xf0, 0xff, 0xb, 0x0, 0xf7, 0xff, 0xe0,
+      0xff, 0x1d, 0x0, 0xf8, 0xff, 0x42, 0x0, 0x39, 0x0, 0x48, 0x0, 0x91, 0xfe,
+      0xa9, 0xff, 0x36, 0xff, 0xf, 0x0, 0xb9, 0x0, 0x40, 0x0, 0xc, 0x0, 0x6f,
+      0x0, 0xd7, 0xff, 0xb0, 0xff, 0x22, 0x0, 0xbd, 0x0, 0x3a, 0xff, 0x4d, 0x0,
+      0x10, 0x0, 0x8d, 0x0, 0x13, 0x0, 0xd3, 0xff, 0xea, 0xff, 0xa3, 0xff, 0x6d,
+      0xff, 0xc8, 0xff, 0x6e, 0xff, 0x1, 0x0, 0x5f, 0x0, 0xd7, 0x0, 0x4, 0x0,
+      0x57, 0x0, 0x3e, 0x0, 0x6d, 0x0, 0x3, 0x0, 0xe8, 0xff, 0x9b, 0x0, 0xae,
+      0xff, 0xd6, 0xff, 0x9e, 0x0, 0x89, 0xff, 0x8f, 0x0, 0x1c, 0x0, 0xa7, 0x0,
+      0xd3, 0xff, 0x32, 0x0, 0xe, 0x0, 0x2, 0x0, 0xb5, 0xff, 0xfc, 0xff, 0xa5,
+      0xff, 0xef, 0xff, 0x6, 0x0, 0xe, 0x0, 0xbf, 0xff, 0xe9, 0xff, 0xbf, 0xff,
+      0xbb, 0xff, 0x9, 0x0, 0xc7, 0xff, 0x12, 0x0, 0xe9, 0xff, 0xda, 0xff, 0x5a,
+      0x0, 0xe9, 0xff, 0x17, 0x0, 0xce, 0xff, 0x2, 0x0, 0x6c, 0xfe, 0x99, 0xff,
+      0xfc, 0xff, 0x2e, 0x0, 0x26, 0x0, 0x56, 0x0, 0x6b, 0x0, 0xad, 0xff, 0x9f,
+      0xff, 0xee, 0xff, 0xde, 0xff, 0xc1, 0xff, 0xb7, 0xff, 0xf0, 0xff, 0x78,
+      0xff, 0x60, 0x0, 0x2d, 0x0, 0x72, 0xff, 0xc9, 0xff, 0xa0, 0xff, 0x17, 0x0,
+      0xdd, 0xff, 0xef, 0xff, 0x20, 0x0, 0x7b, 0xff, 0x76, 0x0, 0x9c, 0x0, 0xb7,
+      0xff, 0x5c, 0x0, 0xa1, 0x0, 0x15, 0x0, 0x27, 0x0, 0xf0, 0xff, 0x4d, 0x0,
+      0xc3, 0xff, 0x2, 0x0, 0x3f, 0xff, 0xfc, 0xff, 0x2f, 0x0, 0x65, 0x0, 0xb8,
+      0xff, 0x50, 0x0, 0xd6, 0xff, 0x57, 0x0, 0x15, 0x0, 0xbb, 0xff, 0x92, 0x0,
+      0xfa, 0xff, 0x8c, 0xff, 0x65, 0x0, 0x16, 0x0, 0x1b, 0x0, 0x4, 0x0, 0xe6,
+      0xff, 0x16, 0x0, 0xb4, 0xff, 0xf, 0x0, 0x9, 0x0, 0xed, 0xff, 0x46, 0x0,
+      0xd5, 0xff, 0xfe, 0xff, 0xae, 0xff, 0xdc, 0xff, 0xe4, 0xfe, 0xe6, 0xff,
+      0x5, 0x0, 0x8c, 0x0, 0x3f, 0x0, 0xea, 0xff, 0xf7, 0xff, 0x58, 0x0, 0x51,
+      0x0, 0x7c, 0xff, 0x4d, 0x0, 0xc, 0x0, 0xda, 0xff, 0x1c, 0x0, 0xe1, 0xff,
+      0xff, 0xff, 0x37, 0x0, 0xc6, 0xff, 0x47, 0x0, 0x8, 0x0, 0xba, 0xff, 0xc5,
+      0xff, 0x76, 0xff, 0x14, 0x0, 0xfe, 0xff, 0x81, 0x0, 0xda, 0xff, 0xc4, 0x0,
+      0x7, 0x0, 0x3e, 0x0, 0xf0, 0xff, 0xe6, 0xff, 0xf2, 0xff, 0xa8, 0xff, 0xde,
+      0xff, 0x9c, 0x0, 0xab, 0xff, 0x93, 0xff, 0xfe, 0xff, 0xf7, 0xff, 0xd6,
+      0xff, 0x10, 0x0, 0x35, 0x0, 0xe6, 0xff, 0xfa, 0xff, 0x15, 0x0, 0xc6, 0xff,
+      0x3b, 0x0, 0xd0, 0xff, 0x98, 0x0, 0x6, 0x0, 0xb8, 0xff, 0x18, 0x0, 0xef,
+      0xff, 0xe7, 0xff, 0xc3, 0xff, 0x22, 0x0, 0xec, 0xff, 0xe3, 0xff, 0x1a,
+      0x0, 0xd1, 0xff, 0xcd, 0xff, 0xdf, 0xff, 0xd1, 0xff, 0xb2, 0xfe, 0x98,
+      0xff, 0x97, 0xff, 0xf9, 0xff, 0x14, 0x0, 0xc2, 0xff, 0x44, 0x0, 0x98,
+      0xff, 0x39, 0x0, 0xac, 0xff, 0x4, 0x0, 0x73, 0xff, 0xb, 0x0, 0x26, 0x0,
+      0xb1, 0xff, 0x2a, 0x0, 0x69, 0x0, 0x18, 0x0, 0xc8, 0xff, 0xdb, 0xff, 0xea,
+      0xff, 0xfe, 0xff, 0xb8, 0xff, 0x19, 0x0, 0x76, 0xff, 0xc6, 0xff, 0x2a,
+      0x0, 0xbd, 0xff, 0x2b, 0x0, 0x6d, 0x0, 0x4e, 0x0, 0xf1, 0xff, 0x16, 0x0,
+      0x31, 0x0, 0x61, 0x0, 0x9, 0x0, 0x28, 0x0, 0xd8, 0xff, 0xca, 0xff, 0xba,
+      0xff, 0xf6, 0xff, 0xf5, 0xff, 0x26, 0x0, 0xf9, 0xff, 0x3a, 0x0, 0xa, 0x0,
+      0xb0, 0x0, 0x53, 0x0, 0x5b, 0xff, 0x60, 0x0, 0x24, 0x0, 0x22, 0x0, 0x64,
+      0x0, 0xfe, 0xff, 0xf3, 0xff, 0xd7, 0xff, 0x13, 0x0, 0xec, 0xff, 0xeb,
+      0xff, 0xe4, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xec, 0xff, 0xae, 0xff, 0xdf,
+      0xfe, 0x30, 0x0, 0xf2, 0xff, 0x1b, 0x0, 0x41, 0x0, 0x2c, 0x0, 0x5, 0x0,
+      0x1b, 0x0, 0x7e, 0x0, 0x83, 0xff, 0x4, 0x0, 0xa3, 0xff, 0x49, 0x0, 0x9,
+      0x0, 0x52, 0x0, 0x4b, 0x0, 0xa0, 0xff, 0x6d, 0x0, 0x1d, 0x0, 0x1f, 0x0,
+      0xce, 0xff, 0xe6, 0xff, 0xbb, 0xff, 0xd8, 0xff, 0x5, 0x0, 0x30, 0xff,
+      0x87, 0xff, 0xa0, 0x0, 0x22, 0x0, 0x4b, 0x0, 0x15, 0x0, 0xf, 0x0, 0xcc,
+      0xff, 0x1, 0x0, 0xc8, 0xff, 0xb, 0x0, 0xc7, 0xff, 0xc7, 0xff, 0xf3, 0xff,
+      0x97, 0xff, 0x1d, 0x0, 0xd7, 0xff, 0x15, 0x0, 0xee, 0xff, 0x62, 0x0, 0xf4,
+      0xff, 0xde, 0xff, 0x2f, 0x0, 0x32, 0x0, 0xd8, 0xff, 0xe5, 0xff, 0x9a,
+      0xff, 0xf8, 0xff, 0x26, 0x0, 0xe8, 0xff, 0xcf, 0xff, 0x44, 0x0, 0xe0,
+      0xff, 0xdb, 0xff, 0xeb, 0xff, 0xfd, 0xff, 0xee, 0xff, 0x2a, 0x0, 0x2d,
+      0x0, 0x80, 0xfe, 0xf7, 0xff, 0x9c, 0xff, 0x18, 0x0, 0xed, 0xff, 0x35, 0x0,
+      0x2f, 0x0, 0x2, 0x0, 0xcc, 0x0, 0xee, 0xff, 0xd, 0x0, 0x98, 0xff, 0x3,
+      0x0, 0xfe, 0xff, 0x22, 0x0, 0x70, 0x0, 0x23, 0x0, 0xbd, 0xff, 0xab, 0xff,
+      0xbd, 0xff, 0xc6, 0xff, 0x6, 0x0, 0x59, 0xff, 0x3d, 0x0, 0xb3, 0xff, 0x7a,
+      0xff, 0xfc, 0xff, 0xe3, 0xff, 0x17, 0x0, 0x87, 0x0, 0x30, 0x0, 0xfc, 0xff,
+      0xfe, 0xff, 0x2e, 0x0, 0x32, 0x0, 0x2c, 0x0, 0x59, 0x0, 0x82, 0x0, 0x6,
+      0x0, 0xfc, 0xff, 0xdb, 0xff, 0xbe, 0xff, 0x2a, 0x0, 0x4, 0x0, 0x49, 0x0,
+      0x25, 0x0, 0x5a, 0x0, 0xc, 0x0, 0x26, 0x0, 0xc4, 0xff, 0xe1, 0xff, 0x39,
+      0x0, 0x8, 0x0, 0xfe, 0xff, 0xfe, 0xff, 0xee, 0xff, 0x30, 0x0, 0xc3, 0xff,
+      0xf0, 0xff, 0xf, 0x0, 0xf5, 0xff, 0xb, 0x0, 0x21, 0x0, 0xf6, 0xff, 0xa5,
+      0xfe, 0x41, 0x0, 0xed, 0xff, 0xf3, 0xff, 0x16, 0x0, 0x85, 0x0, 0xe, 0x0,
+      0xad, 0xff, 0x7c, 0x0, 0x29, 0xff, 0xcb, 0xff, 0x94, 0xff, 0x22, 0x0,
+      0x4f, 0x0, 0x66, 0x0, 0xf, 0x0, 0x83, 0xff, 0x3f, 0x0, 0xe3, 0xff, 0x2a,
+      0x0, 0xf1, 0xff, 0xc5, 0xff, 0x1b, 0x0, 0x41, 0x0, 0x87, 0x0, 0x6c, 0xff,
+      0x34, 0x0, 0x56, 0x0, 0x22, 0x0, 0x72, 0x0, 0x1b, 0x0, 0x2c, 0x0, 0x92,
+      0xff, 0x50, 0x0, 0x9c, 0xff, 0x14, 0x0, 0x9a, 0xff, 0x1c, 0x0, 0x1c, 0x0,
+      0xe9, 0xff, 0x4, 0x0, 0xd9, 0xff, 0xce, 0xff, 0x41, 0x0, 0x1b, 0x0, 0xe4,
+      0xff, 0xad, 0xff, 0xfe, 0xff, 0x6f, 0x0, 0xa1, 0xff, 0xa, 0x0, 0xe7, 0xff,
+      0xb3, 0xff, 0x1a, 0x0, 0x5, 0x0, 0xf9, 0xff, 0x35, 0x0, 0xcd, 0xff, 0xd4,
+      0xff, 0x1a, 0x0, 0xdb, 0xff, 0x2e, 0x0, 0x25, 0x0, 0x6c, 0x0, 0xc2, 0xfe,
+      0x3f, 0x0, 0xb5, 0xff, 0xa5, 0xff, 0x84, 0x0, 0x47, 0x0, 0x4, 0x0, 0x58,
+      0x0, 0x79, 0x0, 0x96, 0x0, 0x39, 0x0, 0xb, 0x0, 0xcb, 0xff, 0x2f, 0x0,
+      0xa, 0x0, 0xc9, 0xff, 0x3d, 0x0, 0xb8, 0xff, 0xb2, 0xff, 0xa2, 0xff, 0xb6,
+      0xff, 0xeb, 0xff, 0x8b, 0xff, 0x18, 0x0, 0xfb, 0xff, 0x2d, 0x0, 0x1d, 0x0,
+      0xfb, 0xff, 0xf, 0x0, 0x78, 0x0, 0xf0, 0xff, 0xd9, 0xff, 0x4d, 0x0, 0xd6,
+      0xff, 0x49, 0x0, 0x63, 0x0, 0x37, 0x0, 0x47, 0x0, 0xe3, 0xff, 0x36, 0x0,
+      0xa, 0x0, 0xe0, 0xff, 0xa1, 0xff, 0x1c, 0x0, 0xed, 0xff, 0xf, 0x0, 0xb1,
+      0xff, 0xf9, 0xff, 0xfd, 0xff, 0x22, 0x0, 0xa, 0x0, 0x34, 0x0, 0xf1, 0xff,
+      0x16, 0x0, 0xed, 0xff, 0xf5, 0xff, 0x36, 0x0, 0xc7, 0xff, 0xdb, 0xff,
+      0x22, 0x0, 0xd1, 0xff, 0xa, 0x0, 0xd7, 0xff, 0x19, 0x0, 0xbb, 0xfe, 0xc,
+      0x0, 0x2, 0x0, 0xa5, 0xff, 0x19, 0x0, 0xfd, 0xff, 0x5e, 0x0, 0xd9, 0xff,
+      0x65, 0x0, 0xf9, 0xff, 0xd0, 0xff, 0xa1, 0xff, 0x21, 0x0, 0xd3, 0xff,
+      0x2e, 0x0, 0xd7, 0xff, 0x34, 0x0, 0x40, 0x0, 0xb5, 0xff, 0xce, 0xff, 0xee,
+      0xff, 0xee, 0xff, 0x1c, 0x0, 0x6, 0x0, 0x11, 0x0, 0x20, 0x0, 0x3a, 0x0,
+      0xc9, 0xff, 0x49, 0x0, 0x5b, 0x0, 0xe5, 0xff, 0x48, 0x0, 0xdb, 0xff, 0x40,
+      0x0, 0xf2, 0xff, 0xf4, 0xff, 0x11, 0x0, 0xd9, 0xff, 0xd2, 0xff, 0x12, 0x0,
+      0xb, 0x0, 0xf7, 0xff, 0xa2, 0xff, 0x36, 0x0, 0x6, 0x0, 0xff, 0xff, 0x25,
+      0x0, 0xf3, 0xff, 0xc3, 0xff, 0x1b, 0x0, 0x42, 0x0, 0x3f, 0x0, 0x1f, 0x0,
+      0x4, 0x0, 0xfd, 0xff, 0x15, 0x0, 0x36, 0x0, 0xd7, 0xff, 0xcf, 0xff, 0x11,
+      0x0, 0xc6, 0xff, 0xf4, 0xff, 0xe4, 0xff, 0x26, 0x0, 0xdd, 0xfe, 0x48, 0x0,
+      0xcd, 0xff, 0xf8, 0xff, 0x22, 0x0, 0xda, 0xff, 0x36, 0x0, 0x43, 0x0, 0x91,
+      0x0, 0xb1, 0xff, 0x1b, 0x0, 0xd, 0x0, 0xe3, 0xff, 0xea, 0xff, 0xe, 0x0,
+      0x9f, 0xff, 0x29, 0x0, 0x31, 0x0, 0x4e, 0x0, 0xda, 0xff, 0xb1, 0xff, 0xcf,
+      0xff, 0xae, 0xff, 0xc8, 0xff, 0x3e, 0x0, 0x54, 0x0, 0x97, 0xff, 0x31, 0x0,
+      0x16, 0x0, 0x29, 0x0, 0xd, 0x0, 0x3e, 0x0, 0x11, 0x0, 0xb7, 0xff, 0x4f,
+      0x0, 0x21, 0x0, 0x5c, 0x0, 0xd1, 0xff, 0xd5, 0xff, 0xda, 0xff, 0x3, 0x0,
+      0xab, 0xff, 0xae, 0xff, 0xee, 0xff, 0xd3, 0xff, 0x1d, 0x0, 0xa6, 0xff,
+      0xd, 0x0, 0xc7, 0xff, 0x24, 0x0, 0xc, 0x0, 0xf6, 0xff, 0x1e, 0x0, 0xf0,
+      0xff, 0xec, 0xff, 0x2b, 0x0, 0x5e, 0x0, 0xbf, 0xff, 0xdd, 0xff, 0xff,
+      0xff, 0xf6, 0xff, 0xdd, 0xff, 0xf5, 0xff, 0x5, 0x0, 0xa2, 0xfe, 0x19, 0x0,
+      0x5, 0x0, 0xd2, 0xff, 0xf, 0x0, 0xa, 0x0, 0x3a, 0x0, 0xad, 0xff, 0x8d,
+      0x0, 0x32, 0x0, 0x8, 0x0, 0x76, 0xff, 0x24, 0x0, 0xf8, 0xff, 0xc3, 0xff,
+      0xd0, 0xff, 0x71, 0x0, 0x3c, 0x0, 0xd7, 0xff, 0x0, 0x0, 0x2, 0x0, 0xfb,
+      0xff, 0xa, 0x0, 0xd0, 0xff, 0x8c, 0xff, 0xb4, 0xff, 0x22, 0x0, 0x69, 0xff,
+      0xe8, 0xff, 0x3c, 0x0, 0x46, 0x0, 0x2e, 0x0, 0xf8, 0xff, 0x50, 0x0, 0x3d,
+      0x0, 0xa9, 0xff, 0x60, 0x0, 0xbf, 0xff, 0xd7, 0xff, 0xcf, 0xff, 0xf6,
+      0xff, 0xab, 0xff, 0xb6, 0xff, 0x4a, 0x0, 0x25, 0x0, 0xf1, 0xff, 0x70, 0x0,
+      0xed, 0xff, 0xa4, 0xff, 0x1e, 0x0, 0x29, 0x0, 0x3e, 0x0, 0x3a, 0x0, 0x9,
+      0x0, 0xc, 0x0, 0x4b, 0x0, 0x42, 0x0, 0xd8, 0xff, 0xe6, 0xff, 0xf7, 0xff,
+      0x15, 0x0, 0xec, 0xff, 0x11, 0x0, 0xd5, 0xff, 0xb5, 0xfe, 0x55, 0x0, 0x21,
+      0x0, 0x1, 0x0, 0x51, 0x0, 0x21, 0x0, 0xb, 0x0, 0x27, 0x0, 0x7f, 0x0, 0x98,
+      0xff, 0x11, 0x0, 0xc5, 0xff, 0x2e, 0x0, 0x39, 0x0, 0x30, 0x0, 0x1, 0x0,
+      0xca, 0xff, 0x28, 0x0, 0x58, 0x0, 0x3a, 0x0, 0xe8, 0xff, 0xcf, 0xff, 0x13,
+      0x0, 0xf6, 0xff, 0x85, 0x0, 0x97, 0xff, 0xdd, 0xff, 0x32, 0x0, 0xe2, 0xff,
+      0xf4, 0xff, 0x5, 0x0, 0xe7, 0xff, 0xd7, 0xff, 0x12, 0x0, 0xef, 0xff, 0xfd,
+      0xff, 0x13, 0x0, 0xab, 0xff, 0x9, 0x0, 0xcc, 0xff, 0x0, 0x0, 0xac, 0xff,
+      0xb5, 0xff, 0x1b, 0x0, 0x2e, 0x0, 0xfb, 0xff, 0x92, 0xff, 0xdf, 0xff,
+      0x68, 0x0, 0xe6, 0xff, 0xf1, 0xff, 0xca, 0xff, 0xf6, 0xff, 0xc, 0x0, 0xe7,
+      0xff, 0x64, 0x0, 0x35, 0x0, 0xdc, 0xff, 0xdf, 0xff, 0xf5, 0xff, 0x18, 0x0,
+      0xe, 0x0, 0x3c, 0x0, 0x10, 0x0, 0x84, 0xfe, 0x4f, 0x0, 0xc0, 0xff, 0xed,
+      0xff, 0xc, 0x0, 0x8, 0x0, 0x2b, 0x0, 0x3, 0x0, 0x3e, 0x0, 0xf, 0x0, 0x1,
+      0x0, 0xbd, 0xff, 0xfa, 0xff, 0x10, 0x0, 0xb5, 0xff, 0x2d, 0x0, 0x34, 0x0,
+      0xaf, 0xff, 0xf1, 0xff, 0xdf, 0xff, 0x10, 0x0, 0x2, 0x0, 0x5, 0x0, 0x1a,
+      0x0, 0xe7, 0xff, 0xc0, 0xff, 0x31, 0x0, 0x78, 0xff, 0x14, 0x0, 0x24, 0x0,
+      0x3f, 0x0, 0xc9, 0xff, 0x26, 0x0, 0x16, 0x0, 0x40, 0x0, 0xc8, 0xff, 0x3d,
+      0x0, 0x22, 0x0, 0x34, 0x0, 0x20, 0x0, 0xf9, 0xff, 0xb0, 0xff, 0x8c, 0xff,
+      0x15, 0x0, 0x34, 0x0, 0xfa, 0xff, 0x22, 0x0, 0xe5, 0xff, 0xc, 0x0, 0xd4,
+      0xff, 0xeb, 0xff, 0x26, 0x0, 0x17, 0x0, 0xe8, 0xff, 0xe7, 0xff, 0x64, 0x0,
+      0x11, 0x0, 0xe2, 0xff, 0x1, 0x0, 0xfa, 0xff, 0x1f, 0x0, 0x23, 0x0, 0x17,
+      0x0, 0xcc, 0xff, 0xcb, 0xfe, 0x8c, 0x0, 0x7, 0x0, 0x1, 0x0, 0x19, 0x0,
+      0x2b, 0x0, 0xfa, 0xff, 0xee, 0xff, 0x62, 0x0, 0xf0, 0xff, 0xd3, 0xff,
+      0x13, 0x0, 0x1d, 0x0, 0x8, 0x0, 0x25, 0x0, 0x2d, 0x0, 0xe6, 0xff, 0x40,
+      0x0, 0x12, 0x0, 0xf2, 0xff, 0x17, 0x0, 0xf4, 0xff, 0x4c, 0x0, 0xf9, 0xff,
+      0x2b, 0x0, 0xe5, 0xff, 0x15, 0x0, 0xed, 0xff, 0xc, 0x0, 0xd6, 0xff, 0x40,
+      0x0, 0xdb, 0xff, 0xdb, 0xff, 0xf5, 0xff, 0x9f, 0xff, 0xf0, 0xff, 0xbb,
+      0xff, 0xe8, 0xff, 0x20, 0x0, 0x23, 0x0, 0x23, 0x0, 0xd2, 0xff, 0x98, 0xff,
+      0x2d, 0x0, 0x28, 0x0, 0xde, 0xff, 0xca, 0xff, 0xcd, 0xff, 0x47, 0x0, 0xd5,
+      0xff, 0xe7, 0xff, 0xe1, 0xff, 0xe6, 0xff, 0xf4, 0xff, 0xf7, 0xff, 0x5f,
+      0x0, 0x18, 0x0, 0xf2, 0xff, 0xfa, 0xff, 0x13, 0x0, 0x2, 0x0, 0x24, 0x0,
+      0xd, 0x0, 0x1a, 0x0, 0xb4, 0xfe, 0x48, 0x0, 0xbd, 0xff, 0xc2, 0xff, 0x1d,
+      0x0, 0xe, 0x0, 0x12, 0x0, 0xd, 0x0, 0x3c, 0x0, 0x5c, 0x0, 0xfe, 0xff,
+      0x4d, 0x0, 0xf0, 0xff, 0x7, 0x0, 0xf, 0x0, 0x27, 0x0, 0x3e, 0x0, 0xef,
+      0xff, 0xf5, 0xff, 0x96, 0xff, 0xe7, 0xff, 0x19, 0x0, 0xee, 0xff, 0x18,
+      0x0, 0xde, 0xff, 0x95, 0x0, 0xe7, 0xff, 0xba, 0xff, 0x11, 0x0, 0xfc, 0xff,
+      0x25, 0x0, 0xb6, 0xff, 0x30, 0x0, 0xc2, 0xff, 0x4c, 0x0, 0x2d, 0x0, 0x1a,
+      0x0, 0x4e, 0x0, 0x9, 0x0, 0x4a, 0x0, 0x8, 0x0, 0xc4, 0xff, 0xba, 0xff,
+      0xf9, 0xff, 0x4, 0x0, 0x1, 0x0, 0xe5, 0xff, 0xf2, 0xff, 0xeb, 0xff, 0x1b,
+      0x0, 0xda, 0xff, 0x20, 0x0, 0x17, 0x0, 0xe4, 0xff, 0xec, 0xff, 0x4d, 0x0,
+      0x19, 0x0, 0xf5, 0xff, 0xf, 0x0, 0x1e, 0x0, 0xf8, 0xff, 0x4, 0x0, 0xe7,
+      0xff, 0xe7, 0xff, 0xbc, 0xfe, 0x63, 0x0, 0x29, 0x0, 0xe2, 0xff, 0xf7,
+      0xff, 0x10, 0x0, 0x30, 0x0, 0xc4, 0xff, 0x14, 0x0, 0xc, 0x0, 0xe1, 0xff,
+      0xe6, 0xff, 0x54, 0x0, 0xf6, 0xff, 0x16, 0x0, 0xfe, 0xff, 0xe8, 0xff,
+      0x32, 0x0, 0xd8, 0xff, 0xe6, 0xff, 0xb, 0x0, 0x28, 0x0, 0x80, 0x0, 0xdf,
+      0xff, 0xbd, 0xff, 0x4b, 0x0, 0x5, 0x0, 0xdd, 0xff, 0x15, 0x0, 0x2d, 0x0,
+      0x6, 0x0, 0xfd, 0xff, 0xcd, 0xff, 0x2a, 0x0, 0xee, 0xff, 0xc8, 0xff, 0xbb,
+      0xff, 0xed, 0xff, 0xfb, 0xff, 0x22, 0x0, 0x7, 0x0, 0xc8, 0xff, 0xaf, 0xff,
+      0x2c, 0x0, 0x14, 0x0, 0xd4, 0xff, 0x20, 0x0, 0xfb, 0xff, 0xc0, 0xff, 0x10,
+      0x0, 0x5, 0x0, 0xf9, 0xff, 0x10, 0x0, 0xf2, 0xff, 0xed, 0xff, 0x25, 0x0,
+      0x15, 0x0, 0xe, 0x0, 0x17, 0x0, 0x5, 0x0, 0xe9, 0xff, 0xa, 0x0, 0xf1,
+      0xff, 0xf, 0x0, 0xce, 0xfe, 0x72, 0x0, 0xfa, 0xff, 0x49, 0x0, 0x12, 0x0,
+      0xde, 0xff, 0x4, 0x0, 0x50, 0x0, 0x65, 0x0, 0x3a, 0x0, 0x47, 0x0, 0x46,
+      0x0, 0x2d, 0x0, 0x9, 0x0, 0xe0, 0xff, 0x9, 0x0, 0xea, 0xff, 0xd3, 0xff,
+      0x2d, 0x0, 0xbe, 0xff, 0xf2, 0xff, 0x9, 0x0, 0xc5, 0xff, 0xfb, 0xff, 0xd4,
+      0xff, 0x6d, 0x0, 0xf0, 0xff, 0xe5, 0xff, 0xe0, 0xff, 0x19, 0x0, 0x13, 0x0,
+      0xdb, 0xff, 0xf9, 0xff, 0xec, 0xff, 0x9, 0x0, 0x14, 0x0, 0x1c, 0x0, 0x5,
+      0x0, 0xec, 0xff, 0x10, 0x0, 0xfd, 0xff, 0xc3, 0xff, 0xdd, 0xff, 0x9, 0x0,
+      0xd, 0x0, 0x18, 0x0, 0xe5, 0xff, 0xf, 0x0, 0xdf, 0xff, 0x37, 0x0, 0xf4,
+      0xff, 0xf9, 0xff, 0x29, 0x0, 0xf7, 0xff, 0xe7, 0xff, 0x18, 0x0, 0x15, 0x0,
+      0xf3, 0xff, 0x11, 0x0, 0xf5, 0xff, 0xf2, 0xff, 0xfc, 0xff, 0xea, 0xff,
+      0xf7, 0xff, 0x98, 0xfe, 0x54, 0x0, 0xe5, 0xff, 0xb, 0x0, 0xdb, 0xff, 0xe4,
+      0xff, 0xa, 0x0, 0xf8, 0xff, 0xf8, 0xff, 0x98, 0xff, 0x23, 0x0, 0xd8, 0xff,
+      0x43, 0x0, 0x23, 0x0, 0xa5, 0xff, 0x22, 0x0, 0xf9, 0xff, 0xf8, 0xff, 0x16,
+      0x0, 0xf7, 0xff, 0x33, 0x0, 0x20, 0x0, 0x15, 0x0, 0x32, 0x0, 0xf5, 0xff,
+      0x0, 0x0, 0x3a, 0x0, 0xbd, 0xff, 0xfc, 0xff, 0x46, 0x0, 0x33, 0x0, 0xfb,
+      0xff, 0xa6, 0xff, 0x5c, 0x0, 0xec, 0xff, 0xcf, 0xff, 0x3, 0x0, 0xf1, 0xff,
+      0x13, 0x0, 0xcc, 0xff, 0x4, 0x0, 0xc4, 0xff, 0xec, 0xff, 0xf, 0x0, 0x29,
+      0x0, 0xe, 0x0, 0x18, 0x0, 0x22, 0x0, 0xbe, 0xff, 0x7, 0x0, 0xa, 0x0, 0x6,
+      0x0, 0x2f, 0x0, 0xf9, 0xff, 0xf5, 0xff, 0x1d, 0x0, 0x2, 0x0, 0xfa, 0xff,
+      0xa, 0x0, 0xf6, 0xff, 0x5, 0x0, 0xff, 0xff, 0x3, 0x0, 0xec, 0xff, 0xcc,
+      0xfe, 0xa7, 0x0, 0x14, 0x0, 0x16, 0x0, 0x45, 0x0, 0xfe, 0xff, 0xde, 0xff,
+      0x30, 0x0, 0x35, 0x0, 0xf3, 0xff, 0xe, 0x0, 0x2b, 0x0, 0x2a, 0x0, 0xf7,
+      0xff, 0xf4, 0xff, 0xee, 0xff, 0xe7, 0xff, 0xe1, 0xff, 0x2d, 0x0, 0x0, 0x0,
+      0x1, 0x0, 0x18, 0x0, 0x14, 0x0, 0x2, 0x0, 0x24, 0x0, 0xdc, 0xff, 0xb3,
+      0xff, 0x42, 0x0, 0xea, 0xff, 0x25, 0x0, 0xfb, 0xff, 0xdd, 0xff, 0xd0,
+      0xff, 0xef, 0xff, 0xf7, 0xff, 0xf9, 0xff, 0xf0, 0xff, 0xca, 0xff, 0x1b,
+      0x0, 0xbe, 0xff, 0x20, 0x0, 0xb7, 0xff, 0xd9, 0xff, 0xf7, 0xff, 0xb, 0x0,
+      0x0, 0x0, 0xc3, 0xff, 0xa, 0x0, 0x16, 0x0, 0xf3, 0xff, 0xd7, 0xff, 0xd5,
+      0xff, 0xf5, 0xff, 0x5, 0x0, 0xe7, 0xff, 0x17, 0x0, 0x6, 0x0, 0x3, 0x0,
+      0x13, 0x0, 0x1, 0x0, 0x6, 0x0, 0x7, 0x0, 0x13, 0x0, 0xa, 0x0, 0xc4, 0xfe,
+      0x60, 0x0, 0x8, 0x0, 0xf2, 0xff, 0xff, 0xff, 0xed, 0xff, 0xfb, 0xff, 0xd8,
+      0xff, 0x55, 0x0, 0x87, 0x0, 0xea, 0xff, 0x1d, 0x0, 0x2d, 0x0, 0xbc, 0xff,
+      0xf5, 0xff, 0x14, 0x0, 0x21, 0x0, 0xed, 0xff, 0xc2, 0xff, 0xcf, 0xff, 0x5,
+      0x0, 0xb, 0x0, 0xd, 0x0, 0x2a, 0x0, 0xbf, 0xff, 0xf9, 0xff, 0xe1, 0xff,
+      0xc5, 0xff, 0xed, 0xff, 0x2a, 0x0, 0x17, 0x0, 0xd4, 0xff, 0x17, 0x0, 0xed,
+      0xff, 0x1d, 0x0, 0xdb, 0xff, 0xfe, 0xff, 0x14, 0x0, 0x1, 0x0, 0x9, 0x0,
+      0x18, 0x0, 0xcf, 0xff, 0xe1, 0xff, 0x1c, 0x0, 0x2f, 0x0, 0xf9, 0xff, 0x49,
+      0x0, 0xa, 0x0, 0x6, 0x0, 0xea, 0xff, 0xea, 0xff, 0x3b, 0x0, 0x6, 0x0, 0xa,
+      0x0, 0xf8, 0xff, 0x1f, 0x0, 0xee, 0xff, 0xf, 0x0, 0xf, 0x0, 0xf9, 0xff,
+      0x4, 0x0, 0x12, 0x0, 0xd, 0x0, 0xef, 0xff, 0xda, 0xfe, 0x6a, 0x0, 0xfe,
+      0xff, 0xef, 0xff, 0xcd, 0xff, 0xf, 0x0, 0xdc, 0xff, 0x15, 0x0, 0xf3, 0xff,
+      0xa6, 0xff, 0xfe, 0xff, 0x4e, 0x0, 0x2a, 0x0, 0x23, 0x0, 0x42, 0x0, 0x9,
+      0x0, 0xa0, 0xff, 0x2f, 0x0, 0xfb, 0xff, 0xec, 0xff, 0x4, 0x0, 0x3, 0x0,
+      0x2f, 0x0, 0x7, 0x0, 0x4f, 0x0, 0x5, 0x0, 0xcc, 0xff, 0x82, 0x0, 0x1, 0x0,
+      0xe, 0x0, 0x26, 0x0, 0xdb, 0xff, 0xd9, 0xff, 0xf0, 0xff, 0xdc, 0xff, 0x16,
+      0x0, 0xc0, 0xff, 0xf0, 0xff, 0xed, 0xff, 0x9, 0x0, 0x14, 0x0, 0xdc, 0xff,
+      0xe8, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0x0, 0x0, 0xbd, 0xff, 0x9, 0x0, 0x47,
+      0x0, 0xcb, 0xff, 0xef, 0xff, 0xf2, 0xff, 0xd0, 0xff, 0x12, 0x0, 0xf5,
+      0xff, 0x20, 0x0, 0xf7, 0xff, 0x13, 0x0, 0x6, 0x0, 0xfb, 0xff, 0xfc, 0xff,
+      0x14, 0x0, 0x16, 0x0, 0x24, 0x0, 0xce, 0xfe, 0x4a, 0x0, 0xce, 0xff, 0xf2,
+      0xff, 0xf7, 0xff, 0xa, 0x0, 0xe9, 0xff, 0x11, 0x0, 0xe7, 0xff, 0x47, 0x0,
+      0x2a, 0x0, 0x31, 0x0, 0x7, 0x0, 0x8, 0x0, 0xee, 0xff, 0xfd, 0xff, 0x22,
+      0x0, 0xcf, 0xff, 0xc0, 0xff, 0xa8, 0xff, 0x3, 0x0, 0x2c, 0x0, 0xe4, 0xff,
+      0xfb, 0xff, 0x99, 0xff, 0x1d, 0x0, 0xa, 0x0, 0xf0, 0xff, 0xff, 0xff, 0x40,
+      0x0, 0x2f, 0x0, 0xc5, 0xff, 0x23, 0x0, 0x0, 0x0, 0x31, 0x0, 0xb, 0x0,
+      0x27, 0x0, 0x22, 0x0, 0xeb, 0xff, 0x24, 0x0, 0xf6, 0xff, 0xe3, 0xff, 0xe8,
+      0xff, 0x4, 0x0, 0xe4, 0xff, 0x11, 0x0, 0x14, 0x0, 0x3, 0x0, 0xfa, 0xff,
+      0xfd, 0xff, 0xfa, 0xff, 0x3b, 0x0, 0xfd, 0xff, 0x10, 0x0, 0x4, 0x0, 0x1f,
+      0x0, 0xef, 0xff, 0x1c, 0x0, 0x13, 0x0, 0xfe, 0xff, 0xf5, 0xff, 0x1, 0x0,
+      0xf0, 0xff, 0xf0, 0xff, 0xef, 0xfe, 0x53, 0x0, 0x1d, 0x0, 0xf7, 0xff,
+      0xed, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf1, 0xff, 0x5, 0x0, 0xd9, 0xff, 0x4,
+      0x0, 0x0, 0x0, 0x3b, 0x0, 0xfc, 0xff, 0xf, 0x0, 0x5, 0x0, 0xe1, 0xff,
+      0x2a, 0x0, 0xb, 0x0, 0xdf, 0xff, 0xf7, 0xff, 0xa, 0x0, 0x26, 0x0, 0xf8,
+      0xff, 0x2, 0x0, 0xf0, 0xff, 0x42, 0x0, 0x19, 0x0, 0xea, 0xff, 0x29, 0x0,
+      0x1c, 0x0, 0xd8, 0xff, 0xd5, 0xff, 0x20, 0x0, 0xbe, 0xff, 0x3, 0x0, 0xef,
+      0xff, 0xdb, 0xff, 0xe6, 0xff, 0xf5, 0xff, 0xfa, 0xff, 0xeb, 0xff, 0xfa,
+      0xff, 0x24, 0x0, 0x13, 0x0, 0xb, 0x0, 0x7, 0x0, 0x6, 0x0, 0x13, 0x0, 0x3,
+      0x0, 0x19, 0x0, 0xfe, 0xff, 0xfd, 0xff, 0x17, 0x0, 0xc, 0x0, 0x22, 0x0,
+      0xf5, 0xff, 0x26, 0x0, 0xfa, 0xff, 0xf2, 0xff, 0xf5, 0xff, 0xf0, 0xff,
+      0xfa, 0xff, 0x1d, 0x0, 0xd9, 0xfe, 0x51, 0x0, 0xf9, 0xff, 0xf5, 0xff,
+      0xec, 0xff, 0xf3, 0xff, 0x1a, 0x0, 0x26, 0x0, 0x16, 0x0, 0xe8, 0xff, 0x3,
+      0x0, 0x43, 0x0, 0x3, 0x0, 0xf9, 0xff, 0xd7, 0xff, 0xe1, 0xff, 0xea, 0xff,
+      0xbb, 0xff, 0x2f, 0x0, 0xc3, 0xff, 0xd9, 0xff, 0xe, 0x0, 0xda, 0xff, 0xef,
+      0xff, 0x1d, 0x0, 0x10, 0x0, 0xfa, 0xff, 0x30, 0x0, 0xec, 0xff, 0x22, 0x0,
+      0x10, 0x0, 0xd4, 0xff, 0x18, 0x0, 0xe7, 0xff, 0x1c, 0x0, 0x22, 0x0, 0x42,
+      0x0, 0xf1, 0xff, 0xec, 0xff, 0xf1, 0xff, 0x3, 0x0, 0xd6, 0xff, 0xf0, 0xff,
+      0xe7, 0xff, 0x2, 0x0, 0x31, 0x0, 0x4, 0x0, 0x11, 0x0, 0xf8, 0xff, 0x19,
+      0x0, 0x6, 0x0, 0xf9, 0xff, 0xb, 0x0, 0x7, 0x0, 0x3, 0x0, 0x2a, 0x0, 0xfc,
+      0xff, 0x1a, 0x0, 0x0, 0x0, 0xea, 0xff, 0x8, 0x0, 0xed, 0xff, 0xec, 0xff,
+      0xf7, 0xff, 0xde, 0xfe, 0x5e, 0x0, 0x37, 0x0, 0x5, 0x0, 0xe1, 0xff, 0x16,
+      0x0, 0x28, 0x0, 0xb2, 0xff, 0x45, 0x0, 0xb, 0x0, 0xe9, 0xff, 0x3, 0x0,
+      0x3f, 0x0, 0xb6, 0xff, 0xc8, 0xff, 0xe8, 0xff, 0xfb, 0xff, 0x4, 0x0, 0xeb,
+      0xff, 0xc, 0x0, 0xed, 0xff, 0xe, 0x0, 0x2e, 0x0, 0xd8, 0xff, 0xda, 0xff,
+      0xbb, 0xff, 0x9, 0x0, 0xf1, 0xff, 0xf9, 0xff, 0x16, 0x0, 0x15, 0x0, 0xf6,
+      0xff, 0xd, 0x0, 0x11, 0x0, 0xf9, 0xff, 0xcf, 0xff, 0xfd, 0xff, 0xe8, 0xff,
+      0xef, 0xff, 0xec, 0xff, 0x12, 0x0, 0xe5, 0xff, 0xdf, 0xff, 0x15, 0x0,
+      0x2d, 0x0, 0xff, 0xff, 0x3c, 0x0, 0xff, 0xff, 0xee, 0xff, 0x8, 0x0, 0x19,
+      0x0, 0x0, 0x0, 0xfa, 0xff, 0xe, 0x0, 0xc, 0x0, 0x33, 0x0, 0xec, 0xff,
+      0x32, 0x0, 0x5, 0x0, 0xe2, 0xff, 0xe, 0x0, 0x7, 0x0, 0xf8, 0xff, 0x2, 0x0,
+      0xfd, 0xfe, 0x74, 0x0, 0x1c, 0x0, 0x1c, 0x0, 0xf8, 0xff, 0x13, 0x0, 0x1,
+      0x0, 0xb, 0x0, 0x52, 0x0, 0xfc, 0xff, 0x11, 0x0, 0x5b, 0x0, 0x15, 0x0,
+      0xc7, 0xff, 0xc, 0x0, 0x2, 0x0, 0xeb, 0xff, 0x2, 0x0, 0x8, 0x0, 0xee,
+      0xff, 0xb6, 0xff, 0xfb, 0xff, 0xcc, 0xff, 0xec, 0xff, 0x46, 0x0, 0xe1,
+      0xff, 0xda, 0xff, 0x33, 0x0, 0xe3, 0xff, 0xdf, 0xff, 0xb, 0x0, 0xc7, 0xff,
+      0x26, 0x0, 0xca, 0xff, 0xf, 0x0, 0x26, 0x0, 0x4, 0x0, 0x1, 0x0, 0xe8,
+      0xff, 0x3, 0x0, 0xc, 0x0, 0xe0, 0xff, 0xf0, 0xff, 0xec, 0xff, 0xd, 0x0,
+      0x11, 0x0, 0xe1, 0xff, 0xf8, 0xff, 0x2c, 0x0, 0xa, 0x0, 0xa, 0x0, 0xe5,
+      0xff, 0xea, 0xff, 0xd, 0x0, 0xf9, 0xff, 0x36, 0x0, 0xf7, 0xff, 0x28, 0x0,
+      0x2, 0x0, 0xec, 0xff, 0x16, 0x0, 0x2, 0x0, 0xff, 0xff, 0x13, 0x0, 0xe2,
+      0xfe, 0x49, 0x0, 0xfb, 0xff, 0xe9, 0xff, 0xcc, 0xff, 0xf, 0x0, 0x6, 0x0,
+      0xd0, 0xff, 0xec, 0xff, 0xf1, 0xff, 0xf7, 0xff, 0xd, 0x0, 0x17, 0x0, 0xb3,
+      0xff, 0xeb, 0xff, 0x0, 0x0, 0x4, 0x0, 0xf5, 0xff, 0xd0, 0xff, 0xf2, 0xff,
+      0xe6, 0xff, 0x1d, 0x0, 0x5, 0x0, 0xf8, 0xff, 0x1a, 0x0, 0xe6, 0xff, 0xfe,
+      0xff, 0xfe, 0xff, 0xfb, 0xff, 0x1b, 0x0, 0x2, 0x0, 0xfd, 0xff, 0x28, 0x0,
+      0xf9, 0xff, 0x9, 0x0, 0xf2, 0xff, 0xf2, 0xff, 0x1c, 0x0, 0xf6, 0xff, 0xfd,
+      0xff, 0xfc, 0xff, 0xd7, 0xff, 0xdf, 0xff, 0xea, 0xff, 0x5, 0x0, 0x2, 0x0,
+      0x16, 0x0, 0xfa, 0xff, 0xf4, 0xff, 0xea, 0xff, 0x14, 0x0, 0x0, 0x0, 0xfa,
+      0xff, 0x5, 0x0, 0xff, 0xff, 0x34, 0x0, 0xfc, 0xff, 0x24, 0x0, 0x6, 0x0,
+      0xed, 0xff, 0x1a, 0x0, 0x7, 0x0, 0xf6, 0xff, 0xfc, 0xff, 0x11, 0xff, 0x5d,
+      0x0, 0xb, 0x0, 0x2b, 0x0, 0x0, 0x0, 0xd, 0x0, 0xb9, 0xff, 0x27, 0x0, 0x1f,
+      0x0, 0xf1, 0xff, 0x13, 0x0, 0x1b, 0x0, 0x25, 0x0, 0xc6, 0xff, 0x1, 0x0,
+      0x14, 0x0, 0xf2, 0xff, 0xb, 0x0, 0x1d, 0x0, 0xf5, 0xff, 0xff, 0xff, 0x28,
+      0x0, 0xf0, 0xff, 0xd4, 0xff, 0x33, 0x0, 0xf8, 0xff, 0x6, 0x0, 0x38, 0x0,
+      0xf4, 0xff, 0xfd, 0xff, 0x7, 0x0, 0x7, 0x0, 0x9, 0x0, 0xe5, 0xff, 0xc8,
+      0xff, 0x18, 0x0, 0xd3, 0xff, 0xc, 0x0, 0xee, 0xff, 0xe2, 0xff, 0xf2, 0xff,
+      0xee, 0xff, 0xe2, 0xff, 0xdc, 0xff, 0xf2, 0xff, 0x14, 0x0, 0xd6, 0xff,
+      0xe2, 0xff, 0x1f, 0x0, 0xf3, 0xff, 0x5, 0x0, 0xd1, 0xff, 0xf3, 0xff, 0x3,
+      0x0, 0x2, 0x0, 0x32, 0x0, 0x16, 0x0, 0x15, 0x0, 0xf5, 0xff, 0xfa, 0xff,
+      0x7, 0x0, 0xfa, 0xff, 0xf7, 0xff, 0x17, 0x0, 0xfc, 0xfe, 0xa, 0x0, 0xdb,
+      0xff, 0x1d, 0x0, 0xfa, 0xff, 0x1, 0x0, 0xe6, 0xff, 0x27, 0x0, 0x17, 0x0,
+      0x13, 0x0, 0xf, 0x0, 0x6, 0x0, 0x1a, 0x0, 0xef, 0xff, 0xcc, 0xff, 0x22,
+      0x0, 0x1d, 0x0, 0xdd, 0xff, 0xc, 0x0, 0xc6, 0xff, 0x6, 0x0, 0x1e, 0x0,
+      0xaf, 0xff, 0x17, 0x0, 0x7, 0x0, 0x14, 0x0, 0x44, 0x0, 0xdb, 0xff, 0xc,
+      0x0, 0xf5, 0xff, 0x17, 0x0, 0xf4, 0xff, 0x18, 0x0, 0x19, 0x0, 0x0, 0x0,
+      0x1e, 0x0, 0xe, 0x0, 0x26, 0x0, 0x5, 0x0, 0xe7, 0xff, 0x1, 0x0, 0xf4,
+      0xff, 0xed, 0xff, 0xd3, 0xff, 0xed, 0xff, 0x32, 0x0, 0x14, 0x0, 0xe8,
+      0xff, 0xe3, 0xff, 0x11, 0x0, 0x10, 0x0, 0x5, 0x0, 0x1c, 0x0, 0xf1, 0xff,
+      0x8, 0x0, 0x3a, 0x0, 0xe, 0x0, 0x2, 0x0, 0xe4, 0xff, 0xff, 0xff, 0xfb,
+      0xff, 0xe9, 0xff, 0xef, 0xff, 0xed, 0xff, 0x13, 0xff, 0x37, 0x0, 0x1f,
+      0x0, 0xf7, 0xff, 0x10, 0x0, 0x5, 0x0, 0x0, 0x0, 0xfc, 0xff, 0x16, 0x0,
+      0xbd, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0x4b, 0x0, 0xef, 0xff, 0x0, 0x0, 0xeb,
+      0xff, 0xd7, 0xff, 0x3, 0x0, 0x2a, 0x0, 0xb, 0x0, 0x4, 0x0, 0xfb, 0xff,
+      0x9, 0x0, 0xfb, 0xff, 0x36, 0x0, 0x9, 0x0, 0x19, 0x0, 0x2e, 0x0, 0x16,
+      0x0, 0xef, 0xff, 0xee, 0xff, 0x7, 0x0, 0xfd, 0xff, 0x13, 0x0, 0xc5, 0xff,
+      0xf7, 0xff, 0xd2, 0xff, 0xec, 0xff, 0xc, 0x0, 0xc2, 0xff, 0x17, 0x0, 0xe4,
+      0xff, 0xd3, 0xff, 0xe7, 0xff, 0xed, 0xff, 0x15, 0x0, 0xd6, 0xff, 0xf6,
+      0xff, 0xee, 0xff, 0x3, 0x0, 0xb, 0x0, 0xd0, 0xff, 0xf5, 0xff, 0xf7, 0xff,
+      0x5, 0x0, 0x2f, 0x0, 0xf, 0x0, 0x0, 0x0, 0xe2, 0xff, 0xf4, 0xff, 0x1, 0x0,
+      0xee, 0xff, 0xfc, 0xff, 0xfa, 0xff, 0xff, 0xfe, 0x46, 0x0, 0x12, 0x0,
+      0x1a, 0x0, 0x25, 0x0, 0xf2, 0xff, 0xf7, 0xff, 0x26, 0x0, 0x55, 0x0, 0x3e,
+      0x0, 0xf9, 0xff, 0x2b, 0x0, 0x24, 0x0, 0xd4, 0xff, 0xf8, 0xff, 0xf9, 0xff,
+      0x32, 0x0, 0xdf, 0xff, 0xfd, 0xff, 0xd4, 0xff, 0xf5, 0xff, 0x13, 0x0,
+      0xa2, 0xff, 0xf0, 0xff, 0xd5, 0xff, 0x28, 0x0, 0x16, 0x0, 0xed, 0xff,
+      0xfe, 0xff, 0xf4, 0xff, 0xd, 0x0, 0xed, 0xff, 0x2e, 0x0, 0xe7, 0xff, 0x1,
+      0x0, 0xf5, 0xff, 0x29, 0x0, 0x1a, 0x0, 0x2, 0x0, 0xee, 0xff, 0x7, 0x0,
+      0xf1, 0xff, 0xe1, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0x1c, 0x0, 0x20, 0x0,
+      0xfa, 0xff, 0xea, 0xff, 0x16, 0x0, 0x4, 0x0, 0x3, 0x0, 0x0, 0x0, 0x2, 0x0,
+      0xe, 0x0, 0x25, 0x0, 0xe, 0x0, 0xf6, 0xff, 0xe8, 0xff, 0xf5, 0xff, 0x4,
+      0x0, 0xf7, 0xff, 0xf2, 0xff, 0xdd, 0xff, 0xf0, 0xfe, 0x31, 0x0, 0x17, 0x0,
+      0xd, 0x0, 0xdf, 0xff, 0x1, 0x0, 0xf3, 0xff, 0x6, 0x0, 0x23, 0x0, 0xb1,
+      0xff, 0xf1, 0xff, 0x6, 0x0, 0x27, 0x0, 0xfb, 0xff, 0x10, 0x0, 0x10, 0x0,
+      0xef, 0xff, 0x36, 0x0, 0x3, 0x0, 0xd, 0x0, 0xec, 0xff, 0x1b, 0x0, 0xed,
+      0xff, 0xfa, 0xff, 0xb, 0x0, 0xe3, 0xff, 0x18, 0x0, 0x1d, 0x0, 0xb, 0x0,
+      0xe0, 0xff, 0x18, 0x0, 0xb, 0x0, 0xe3, 0xff, 0x1e, 0x0, 0xeb, 0xff, 0xeb,
+      0xff, 0xfe, 0xff, 0x4, 0x0, 0x9, 0x0, 0xdc, 0xff, 0x15, 0x0, 0xe9, 0xff,
+      0x0, 0x0, 0x3, 0x0, 0xf6, 0xff, 0x9, 0x0, 0x1a, 0x0, 0xa, 0x0, 0xff, 0xff,
+      0xec, 0xff, 0x10, 0x0, 0xf6, 0xff, 0xee, 0xff, 0x5, 0x0, 0x15, 0x0, 0x2c,
+      0x0, 0xe, 0x0, 0x3, 0x0, 0xe9, 0xff, 0xed, 0xff, 0x5, 0x0, 0x5, 0x0, 0x4,
+      0x0, 0xff, 0xff, 0x0, 0xff, 0x46, 0x0, 0xfd, 0xff, 0x10, 0x0, 0x15, 0x0,
+      0xfa, 0xff, 0xce, 0xff, 0x2c, 0x0, 0x23, 0x0, 0xe0, 0xff, 0x15, 0x0, 0xe,
+      0x0, 0x2, 0x0, 0xa, 0x0, 0xe, 0x0, 0xf4, 0xff, 0x5, 0x0, 0xf5, 0xff, 0x1c,
+      0x0, 0xeb, 0xff, 0xf4, 0xff, 0x32, 0x0, 0xe1, 0xff, 0xe4, 0xff, 0xee,
+      0xff, 0xf4, 0xff, 0xda, 0xff, 0x37, 0x0, 0xa, 0x0, 0xe7, 0xff, 0x1b, 0x0,
+      0xf5, 0xff, 0x7, 0x0, 0xfc, 0xff, 0x10, 0x0, 0xf7, 0xff, 0x14, 0x0, 0x12,
+      0x0, 0x4, 0x0, 0xe9, 0xff, 0xc, 0x0, 0xdb, 0xff, 0xf4, 0xff, 0xed, 0xff,
+      0xc7, 0xff, 0x1b, 0x0, 0xf7, 0xff, 0x9, 0x0, 0xf9, 0xff, 0xec, 0xff, 0xf5,
+      0xff, 0xf8, 0xff, 0xef, 0xff, 0x3, 0x0, 0x16, 0x0, 0x27, 0x0, 0x23, 0x0,
+      0x4, 0x0, 0xfe, 0xff, 0xf7, 0xff, 0x1, 0x0, 0x7, 0x0, 0xff, 0xff, 0xf8,
+      0xff, 0x5, 0xff, 0x28, 0x0, 0x25, 0x0, 0x11, 0x0, 0x9, 0x0, 0xfe, 0xff,
+      0xe9, 0xff, 0x0, 0x0, 0x21, 0x0, 0x29, 0x0, 0x5, 0x0, 0xea, 0xff, 0x14,
+      0x0, 0xfd, 0xff, 0xf2, 0xff, 0xfb, 0xff, 0x1c, 0x0, 0x14, 0x0, 0xe9, 0xff,
+      0xe2, 0xff, 0x10, 0x0, 0xe, 0x0, 0xf3, 0xff, 0xf6, 0xff, 0xba, 0xff, 0xde,
+      0xff, 0x10, 0x0, 0xec, 0xff, 0xfd, 0xff, 0x7, 0x0, 0x2c, 0x0, 0xf2, 0xff,
+      0xfa, 0xff, 0x25, 0x0, 0xef, 0xff, 0xd1, 0xff, 0xff, 0xff, 0x14, 0x0,
+      0xfe, 0xff, 0x0, 0x0, 0xfb, 0xff, 0xf9, 0xff, 0xf1, 0xff, 0x18, 0x0, 0xe8,
+      0xff, 0x8, 0x0, 0x39, 0x0, 0x5, 0x0, 0xf7, 0xff, 0xf1, 0xff, 0xff, 0xff,
+      0x13, 0x0, 0xf4, 0xff, 0x4, 0x0, 0x11, 0x0, 0x20, 0x0, 0x1a, 0x0, 0xf,
+      0x0, 0x3, 0x0, 0xfe, 0xff, 0xfb, 0xff, 0x10, 0x0, 0x6, 0x0, 0x0, 0x0,
+      0x23, 0xff, 0x3c, 0x0, 0x21, 0x0, 0xf8, 0xff, 0xe6, 0xff, 0xff, 0xff,
+      0xdf, 0xff, 0x3e, 0x0, 0xa, 0x0, 0xb9, 0xff, 0x5, 0x0, 0x20, 0x0, 0xfc,
+      0xff, 0x1e, 0x0, 0x16, 0x0, 0xfa, 0xff, 0xd8, 0xff, 0xff, 0xff, 0x1c, 0x0,
+      0x3, 0x0, 0xf6, 0xff, 0xe3, 0xff, 0xdf, 0xff, 0xfe, 0xff, 0x2a, 0x0, 0x16,
+      0x0, 0xe9, 0xff, 0x3a, 0x0, 0xfa, 0xff, 0x6, 0x0, 0x13, 0x0, 0xeb, 0xff,
+      0xf7, 0xff, 0xf4, 0xff, 0xf5, 0xff, 0xb, 0x0, 0xf2, 0xff, 0xfe, 0xff,
+      0xf7, 0xff, 0xf4, 0xff, 0xf2, 0xff, 0xf4, 0xff, 0xef, 0xff, 0x2, 0x0,
+      0xdc, 0xff, 0x13, 0x0, 0xe0, 0xff, 0x14, 0x0, 0x21, 0x0, 0xf7, 0xff, 0xf0,
+      0xff, 0xeb, 0xff, 0xe9, 0xff, 0xfa, 0xff, 0xf4, 0xff, 0x1d, 0x0, 0x1b,
+      0x0, 0xf, 0x0, 0x6, 0x0, 0xf9, 0xff, 0x8, 0x0, 0x6, 0x0, 0xe, 0x0, 0x18,
+      0x0, 0x12, 0xff, 0x2b, 0x0, 0x12, 0x0, 0xfa, 0xff, 0xfc, 0xff, 0xf6, 0xff,
+      0x3, 0x0, 0x15, 0x0, 0x12, 0x0, 0xf0, 0xff, 0xf5, 0xff, 0xf3, 0xff, 0x7,
+      0x0, 0x9, 0x0, 0xe8, 0xff, 0xea, 0xff, 0x22, 0x0, 0xd5, 0xff, 0xe6, 0xff,
+      0x5, 0x0, 0x1a, 0x0, 0xfe, 0xff, 0xe5, 0xff, 0xfb, 0xff, 0xbd, 0xff, 0x1c,
+      0x0, 0x10, 0x0, 0xe1, 0xff, 0x17, 0x0, 0x33, 0x0, 0x2a, 0x0, 0xf1, 0xff,
+      0x15, 0x0, 0x0, 0x0, 0xc, 0x0, 0xde, 0xff, 0x5, 0x0, 0x3, 0x0, 0x4, 0x0,
+      0x5, 0x0, 0xf8, 0xff, 0xf1, 0xff, 0xdb, 0xff, 0x3, 0x0, 0xe2, 0xff, 0x5,
+      0x0, 0x18, 0x0, 0x13, 0x0, 0xe3, 0xff, 0x4, 0x0, 0xfd, 0xff, 0x11, 0x0,
+      0xfd, 0xff, 0xfa, 0xff, 0x2, 0x0, 0x11, 0x0, 0xd, 0x0, 0x8, 0x0, 0xf, 0x0,
+      0xfb, 0xff, 0xd, 0x0, 0xb, 0x0, 0x5, 0x0, 0xfe, 0xff, 0x26, 0xff, 0x35,
+      0x0, 0x36, 0x0, 0x1a, 0x0, 0x6, 0x0, 0xed, 0xff, 0x4, 0x0, 0x29, 0x0,
+      0x38, 0x0, 0xd1, 0xff, 0xd, 0x0, 0x3, 0x0, 0x7, 0x0, 0x10, 0x0, 0xa, 0x0,
+      0x5, 0x0, 0xf3, 0xff, 0x16, 0x0, 0xe, 0x0, 0xe, 0x0, 0xeb, 0xff, 0xf3,
+      0xff, 0xea, 0xff, 0xec, 0xff, 0x0, 0x0, 0xf0, 0xff, 0x18, 0x0, 0x0, 0x0,
+      0x9, 0x0, 0x6, 0x0, 0x28, 0x0, 0xe6, 0xff, 0xee, 0xff, 0xe0, 0xff, 0xec,
+      0xff, 0x8, 0x0, 0xf1, 0xff, 0xea, 0xff, 0x8, 0x0, 0xf8, 0xff, 0xf7, 0xff,
+      0xf4, 0xff, 0xf3, 0xff, 0x6, 0x0, 0xf6, 0xff, 0x4, 0x0, 0xf4, 0xff, 0x6,
+      0x0, 0x16, 0x0, 0xc, 0x0, 0x2, 0x0, 0xf2, 0xff, 0xec, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0x6, 0x0, 0x5, 0x0, 0x1, 0x0, 0xb, 0x0, 0x3, 0x0, 0xd, 0x0,
+      0xfe, 0xff, 0xe, 0x0, 0x17, 0x0, 0x6, 0xff, 0x1c, 0x0, 0xf5, 0xff, 0xff,
+      0xff, 0xe4, 0xff, 0xdb, 0xff, 0x9, 0x0, 0x13, 0x0, 0x11, 0x0, 0xc6, 0xff,
+      0xe9, 0xff, 0xb, 0x0, 0xd9, 0xff, 0x11, 0x0, 0xff, 0xff, 0xe, 0x0, 0xf9,
+      0xff, 0xe8, 0xff, 0xee, 0xff, 0xee, 0xff, 0xda, 0xff, 0x11, 0x0, 0xe3,
+      0xff, 0x7, 0x0, 0x11, 0x0, 0xf, 0x0, 0x8, 0x0, 0xf7, 0xff, 0x2, 0x0, 0x2,
+      0x0, 0x2c, 0x0, 0xfc, 0xff, 0x9, 0x0, 0xda, 0xff, 0x22, 0x0, 0x18, 0x0,
+      0x25, 0x0, 0xb, 0x0, 0x12, 0x0, 0x9, 0x0, 0xf1, 0xff, 0xe7, 0xff, 0xfd,
+      0xff, 0xed, 0xff, 0xf7, 0xff, 0x1a, 0x0, 0x0, 0x0, 0x9, 0x0, 0xf0, 0xff,
+      0x4, 0x0, 0x0, 0x0, 0xd, 0x0, 0x1, 0x0, 0xf6, 0xff, 0xf9, 0xff, 0xd, 0x0,
+      0xfe, 0xff, 0xf4, 0xff, 0x15, 0x0, 0x0, 0x0, 0xf, 0x0, 0xf7, 0xff, 0x3,
+      0x0, 0xf2, 0xff, 0x14, 0xff, 0x33, 0x0, 0x17, 0x0, 0x15, 0x0, 0xff, 0xff,
+      0xe6, 0xff, 0x4, 0x0, 0xe9, 0xff, 0x32, 0x0, 0xd6, 0xff, 0xe0, 0xff, 0xf0,
+      0xff, 0xc, 0x0, 0x0, 0x0, 0xa, 0x0, 0x8, 0x0, 0xd4, 0xff, 0x15, 0x0, 0xf4,
+      0xff, 0x19, 0x0, 0x5, 0x0, 0xa, 0x0, 0x30, 0x0, 0xfb, 0xff, 0x3, 0x0,
+      0xdf, 0xff, 0xfc, 0xff, 0x10, 0x0, 0x1, 0x0, 0xf, 0x0, 0x2f, 0x0, 0x1c,
+      0x0, 0xf4, 0xff, 0xfd, 0xff, 0xe5, 0xff, 0xfc, 0xff, 0xf1, 0xff, 0xf6,
+      0xff, 0x14, 0x0, 0x9, 0x0, 0xf3, 0xff, 0xed, 0xff, 0xed, 0xff, 0xf9, 0xff,
+      0xe, 0x0, 0xf9, 0xff, 0xe9, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xed, 0xff, 0x2,
+      0x0, 0xf1, 0xff, 0xea, 0xff, 0xfb, 0xff, 0x3, 0x0, 0xa, 0x0, 0x1, 0x0,
+      0xef, 0xff, 0x16, 0x0, 0x3, 0x0, 0x7, 0x0, 0x3, 0x0, 0x4, 0x0, 0x0, 0x0,
+      0x29, 0xff, 0x43, 0x0, 0x10, 0x0, 0xb, 0x0, 0xfb, 0xff, 0xf4, 0xff, 0xfc,
+      0xff, 0x28, 0x0, 0x52, 0x0, 0x17, 0x0, 0x1, 0x0, 0x2f, 0x0, 0xf3, 0xff,
+      0xc, 0x0, 0x10, 0x0, 0x29, 0x0, 0xf0, 0xff, 0xfd, 0xff, 0x0, 0x0, 0xf0,
+      0xff, 0xfa, 0xff, 0xed, 0xff, 0xdd, 0xff, 0x13, 0x0, 0x6, 0x0, 0xf0, 0xff,
+      0xfe, 0xff, 0xe8, 0xff, 0xe8, 0xff, 0xfe, 0xff, 0x3b, 0x0, 0xf6, 0xff,
+      0xf, 0x0, 0xd9, 0xff, 0x9, 0x0, 0x21, 0x0, 0xd, 0x0, 0x15, 0x0, 0xc, 0x0,
+      0x15, 0x0, 0xe2, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0xf2, 0xff, 0xc, 0x0, 0x1,
+      0x0, 0xf8, 0xff, 0xf5, 0xff, 0xb, 0x0, 0x4, 0x0, 0xfb, 0xff, 0x5, 0x0,
+      0xf8, 0xff, 0xf4, 0xff, 0xff, 0xff, 0x8, 0x0, 0x3, 0x0, 0xe3, 0xff, 0xa,
+      0x0, 0xf, 0x0, 0x6, 0x0, 0xf9, 0xff, 0xff, 0xff, 0xfa, 0xff, 0x27, 0xff,
+      0x3a, 0x0, 0x22, 0x0, 0xd0, 0xff, 0xe0, 0xff, 0x10, 0x0, 0x21, 0x0, 0xf5,
+      0xff, 0xfb, 0xff, 0xce, 0xff, 0xd3, 0xff, 0x17, 0x0, 0x8, 0x0, 0x10, 0x0,
+      0x9, 0x0, 0x10, 0x0, 0xd8, 0xff, 0x11, 0x0, 0xea, 0xff, 0x19, 0x0, 0x1,
+      0x0, 0xe1, 0xff, 0x24, 0x0, 0x22, 0x0, 0x13, 0x0, 0xf3, 0xff, 0x5, 0x0,
+      0x7, 0x0, 0x4, 0x0, 0x10, 0x0, 0x2e, 0x0, 0x10, 0x0, 0xff, 0xff, 0xf9,
+      0xff, 0xf7, 0xff, 0xf2, 0xff, 0xe6, 0xff, 0xa, 0x0, 0x15, 0x0, 0x4, 0x0,
+      0xff, 0xff, 0xf2, 0xff, 0xeb, 0xff, 0xfa, 0xff, 0x11, 0x0, 0xee, 0xff,
+      0xec, 0xff, 0x6, 0x0, 0xff, 0xff, 0xf7, 0xff, 0x4, 0x0, 0x3, 0x0, 0xf4,
+      0xff, 0xf4, 0xff, 0xfe, 0xff, 0xe, 0x0, 0xf6, 0xff, 0xe3, 0xff, 0x2, 0x0,
+      0x11, 0x0, 0x7, 0x0, 0xfd, 0xff, 0xb, 0x0, 0x3, 0x0, 0x3b, 0xff, 0x47,
+      0x0, 0x25, 0x0, 0xee, 0xff, 0x28, 0x0, 0xfc, 0xff, 0xf9, 0xff, 0x16, 0x0,
+      0x21, 0x0, 0x15, 0x0, 0x3, 0x0, 0x1d, 0x0, 0xfc, 0xff, 0xf8, 0xff, 0xc,
+      0x0, 0x12, 0x0, 0xfe, 0xff, 0xf1, 0xff, 0x11, 0x0, 0x10, 0x0, 0xef, 0xff,
+      0xf8, 0xff, 0x11, 0x0, 0x2, 0x0, 0xe6, 0xff, 0x10, 0x0, 0xf3, 0xff, 0x11,
+      0x0, 0xe, 0x0, 0x1a, 0x0, 0x16, 0x0, 0xf, 0x0, 0xf, 0x0, 0xe5, 0xff, 0xff,
+      0xff, 0xf1, 0xff, 0xfc, 0xff, 0x3, 0x0, 0xf, 0x0, 0x9, 0x0, 0xfc, 0xff,
+      0xf6, 0xff, 0xd6, 0xff, 0x0, 0x0, 0xf9, 0xff, 0x3, 0x0, 0xe2, 0xff, 0xf6,
+      0xff, 0x15, 0x0, 0x9, 0x0, 0xf6, 0xff, 0xf7, 0xff, 0xf3, 0xff, 0x0, 0x0,
+      0x4, 0x0, 0x5, 0x0, 0xf9, 0xff, 0xe2, 0xff, 0x0, 0x0, 0x22, 0x0, 0x4, 0x0,
+      0xfa, 0xff, 0xa, 0x0, 0x3, 0x0, 0x2c, 0xff, 0x1d, 0x0, 0x13, 0x0, 0x3,
+      0x0, 0xf, 0x0, 0xeb, 0xff, 0x15, 0x0, 0xf, 0x0, 0x25, 0x0, 0x19, 0x0,
+      0xf9, 0xff, 0x1, 0x0, 0xf3, 0xff, 0xf8, 0xff, 0x12, 0x0, 0x16, 0x0, 0x22,
+      0x0, 0xfd, 0xff, 0xf9, 0xff, 0xf1, 0xff, 0xd5, 0xff, 0xfe, 0xff, 0x2, 0x0,
+      0x12, 0x0, 0xdf, 0xff, 0x10, 0x0, 0x23, 0x0, 0xdf, 0xff, 0xc, 0x0, 0x4,
+      0x0, 0x14, 0x0, 0x18, 0x0, 0x0, 0x0, 0xf7, 0xff, 0xb, 0x0, 0xf2, 0xff,
+      0xb, 0x0, 0xa, 0x0, 0xf, 0x0, 0x12, 0x0, 0x4, 0x0, 0xf9, 0xff, 0xe9, 0xff,
+      0x11, 0x0, 0x3, 0x0, 0x0, 0x0, 0x21, 0x0, 0xef, 0xff, 0xf8, 0xff, 0xa,
+      0x0, 0x5, 0x0, 0xe, 0x0, 0x3, 0x0, 0x2, 0x0, 0x13, 0x0, 0x1, 0x0, 0xf2,
+      0xff, 0xe6, 0xff, 0xf2, 0xff, 0x1a, 0x0, 0x0, 0x0, 0xf6, 0xff, 0x2, 0x0,
+      0xfe, 0xff, 0x36, 0xff, 0x31, 0x0, 0x16, 0x0, 0xa, 0x0, 0x15, 0x0, 0xe4,
+      0xff, 0x1e, 0x0, 0x26, 0x0, 0x7, 0x0, 0xbf, 0xff, 0xf3, 0xff, 0x6, 0x0,
+      0xfb, 0xff, 0x0, 0x0, 0x30, 0x0, 0xea, 0xff, 0xdf, 0xff, 0x1, 0x0, 0x1e,
+      0x0, 0x7, 0x0, 0xd4, 0xff, 0xfa, 0xff, 0x30, 0x0, 0x8, 0x0, 0x22, 0x0,
+      0x7, 0x0, 0xf0, 0xff, 0x30, 0x0, 0x15, 0x0, 0xfc, 0xff, 0x2, 0x0, 0x1e,
+      0x0, 0x0, 0x0, 0xf1, 0xff, 0xfe, 0xff, 0x8, 0x0, 0xfc, 0xff, 0xed, 0xff,
+      0xa, 0x0, 0x3, 0x0, 0x1c, 0x0, 0xee, 0xff, 0xed, 0xff, 0xf5, 0xff, 0xfa,
+      0xff, 0xfe, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf9, 0xff, 0xfe,
+      0xff, 0xe5, 0xff, 0xf6, 0xff, 0xfd, 0xff, 0x10, 0x0, 0xfe, 0xff, 0xfe,
+      0xff, 0xe6, 0xff, 0xf9, 0xff, 0x9, 0x0, 0xfd, 0xff, 0xf3, 0xff, 0x0, 0x0,
+      0x7, 0x0, 0x29, 0xff, 0x30, 0x0, 0x8, 0x0, 0x7, 0x0, 0x2c, 0x0, 0xe2,
+      0xff, 0x1, 0x0, 0x1c, 0x0, 0x22, 0x0, 0x31, 0x0, 0xfe, 0xff, 0x1, 0x0,
+      0xf4, 0xff, 0xea, 0xff, 0x9, 0x0, 0xee, 0xff, 0x2a, 0x0, 0xde, 0xff, 0xf5,
+      0xff, 0xec, 0xff, 0xf5, 0xff, 0x1, 0x0, 0xa, 0x0, 0x7, 0x0, 0xc5, 0xff,
+      0x2, 0x0, 0xf2, 0xff, 0xe1, 0xff, 0xf6, 0xff, 0xb, 0x0, 0x17, 0x0, 0xe,
+      0x0, 0x15, 0x0, 0x8, 0x0, 0x6, 0x0, 0xed, 0xff, 0x1f, 0x0, 0xfc, 0xff,
+      0x3, 0x0, 0x18, 0x0, 0xf6, 0xff, 0xfb, 0xff, 0xeb, 0xff, 0x1, 0x0, 0x0,
+      0x0, 0x2, 0x0, 0x1d, 0x0, 0xf8, 0xff, 0xdd, 0xff, 0x5, 0x0, 0x0, 0x0, 0x5,
+      0x0, 0x9, 0x0, 0xfe, 0xff, 0xd, 0x0, 0xf8, 0xff, 0xfc, 0xff, 0xec, 0xff,
+      0x0, 0x0, 0xe, 0x0, 0xfa, 0xff, 0xfc, 0xff, 0xf4, 0xff, 0xef, 0xff, 0x3e,
+      0xff, 0x38, 0x0, 0x26, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xd, 0x0,
+      0x20, 0x0, 0x10, 0x0, 0xeb, 0xff, 0xf5, 0xff, 0x18, 0x0, 0x2, 0x0, 0x2,
+      0x0, 0x15, 0x0, 0xea, 0xff, 0xf0, 0xff, 0x7, 0x0, 0xfc, 0xff, 0xfa, 0xff,
+      0xee, 0xff, 0xdb, 0xff, 0x1, 0x0, 0x19, 0x0, 0xb, 0x0, 0xfd, 0xff, 0xf2,
+      0xff, 0xfe, 0xff, 0xe6, 0xff, 0xf9, 0xff, 0x8, 0x0, 0x9, 0x0, 0xe2, 0xff,
+      0xb, 0x0, 0xeb, 0xff, 0x9, 0x0, 0xf6, 0xff, 0xfc, 0xff, 0x1, 0x0, 0x4,
+      0x0, 0xf8, 0xff, 0xd, 0x0, 0xf7, 0xff, 0x8, 0x0, 0xc, 0x0, 0xf0, 0xff,
+      0x5, 0x0, 0x5, 0x0, 0xe, 0x0, 0x1, 0x0, 0x5, 0x0, 0xf7, 0xff, 0xfb, 0xff,
+      0xf4, 0xff, 0x3, 0x0, 0x1, 0x0, 0xf6, 0xff, 0xf5, 0xff, 0xf6, 0xff, 0x4,
+      0x0, 0x2, 0x0, 0x3, 0x0, 0x4, 0x0, 0xc, 0x0, 0x3f, 0xff, 0x37, 0x0, 0xff,
+      0xff, 0xf1, 0xff, 0xfa, 0xff, 0xf4, 0xff, 0xfb, 0xff, 0x15, 0x0, 0x2, 0x0,
+      0xf1, 0xff, 0xea, 0xff, 0xc, 0x0, 0xeb, 0xff, 0x6, 0x0, 0xfb, 0xff, 0xe3,
+      0xff, 0x4, 0x0, 0xd9, 0xff, 0xf8, 0xff, 0xe7, 0xff, 0x3, 0x0, 0x0, 0x0,
+      0xf6, 0xff, 0x12, 0x0, 0xea, 0xff, 0x19, 0x0, 0xe7, 0xff, 0xf6, 0xff, 0x0,
+      0x0, 0x1d, 0x0, 0x3, 0x0, 0x1c, 0x0, 0xf9, 0xff, 0xfa, 0xff, 0x18, 0x0,
+      0xfd, 0xff, 0xf, 0x0, 0x4, 0x0, 0x0, 0x0, 0xc, 0x0, 0xa, 0x0, 0xa, 0x0,
+      0xe8, 0xff, 0x5, 0x0, 0xf2, 0xff, 0xf8, 0xff, 0x6, 0x0, 0x13, 0x0, 0xfc,
+      0xff, 0x2, 0x0, 0xfb, 0xff, 0x0, 0x0, 0xb, 0x0, 0xee, 0xff, 0xe, 0x0, 0x2,
+      0x0, 0xfc, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0x2, 0x0, 0x8, 0x0, 0xa, 0x0,
+      0xb, 0x0, 0xfb, 0xff, 0x4b, 0xff, 0x2e, 0x0, 0x19, 0x0, 0xf8, 0xff, 0xd,
+      0x0, 0xf0, 0xff, 0xf7, 0xff, 0xec, 0xff, 0x21, 0x0, 0x14, 0x0, 0xeb, 0xff,
+      0xdc, 0xff, 0x6, 0x0, 0xea, 0xff, 0x0, 0x0, 0xf8, 0xff, 0x1a, 0x0, 0xf9,
+      0xff, 0xf6, 0xff, 0xd9, 0xff, 0xc, 0x0, 0xfc, 0xff, 0xa, 0x0, 0xf3, 0xff,
+      0xd2, 0xff, 0xf7, 0xff, 0x4, 0x0, 0xec, 0xff, 0x1, 0x0, 0x7, 0x0, 0x16,
+      0x0, 0x16, 0x0, 0xe9, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xe8, 0xff, 0xfd,
+      0xff, 0xfa, 0xff, 0xfe, 0xff, 0x16, 0x0, 0x5, 0x0, 0x7, 0x0, 0xec, 0xff,
+      0x1d, 0x0, 0x1, 0x0, 0xeb, 0xff, 0x14, 0x0, 0x4, 0x0, 0xfd, 0xff, 0x7,
+      0x0, 0x6, 0x0, 0xfe, 0xff, 0x8, 0x0, 0xfd, 0xff, 0x15, 0x0, 0xfa, 0xff,
+      0xee, 0xff, 0x8, 0x0, 0x5, 0x0, 0x11, 0x0, 0xfc, 0xff, 0xd, 0x0, 0xc, 0x0,
+      0x4, 0x0, 0x59, 0xff, 0x2c, 0x0, 0x19, 0x0, 0xf6, 0xff, 0xff, 0xff, 0xe7,
+      0xff, 0x19, 0x0, 0x19, 0x0, 0x7, 0x0, 0xeb, 0xff, 0xf9, 0xff, 0x4, 0x0,
+      0x3, 0x0, 0xf8, 0xff, 0x1a, 0x0, 0x16, 0x0, 0xf4, 0xff, 0xf1, 0xff, 0x8,
+      0x0, 0xcc, 0xff, 0xf3, 0xff, 0xe3, 0xff, 0xf2, 0xff, 0x10, 0x0, 0x18, 0x0,
+      0x11, 0x0, 0x1, 0x0, 0x1, 0x0, 0xfb, 0xff, 0xf4, 0xff, 0xc, 0x0, 0xf6,
+      0xff, 0xec, 0xff, 0xe5, 0xff, 0xf, 0x0, 0x18, 0x0, 0xe, 0x0, 0x11, 0x0,
+      0x5, 0x0, 0x15, 0x0, 0xfc, 0xff, 0xa, 0x0, 0xfe, 0xff, 0xfb, 0xff, 0xf7,
+      0xff, 0xfe, 0xff, 0xfb, 0xff, 0x7, 0x0, 0x9, 0x0, 0xd, 0x0, 0x7, 0x0, 0xc,
+      0x0, 0xe, 0x0, 0xfc, 0xff, 0x6, 0x0, 0x4, 0x0, 0xec, 0xff, 0x3, 0x0, 0xb,
+      0x0, 0xf, 0x0, 0xf2, 0xff, 0xfc, 0xff, 0x5, 0x0, 0x0, 0x0, 0x43, 0xff,
+      0x1c, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xe4, 0xff, 0x19, 0x0, 0xfc,
+      0xff, 0xfe, 0xff, 0xec, 0xff, 0xe5, 0xff, 0xe7, 0xff, 0x14, 0x0, 0x8, 0x0,
+      0xf7, 0xff, 0x7, 0x0, 0xfc, 0xff, 0xfe, 0xff, 0xf0, 0xff, 0xf7, 0xff, 0xe,
+      0x0, 0xff, 0xff, 0x1a, 0x0, 0x6, 0x0, 0x0, 0x0, 0x2, 0x0, 0x8, 0x0, 0x16,
+      0x0, 0xfd, 0xff, 0x10, 0x0, 0x11, 0x0, 0x20, 0x0, 0xe4, 0xff, 0xff, 0xff,
+      0x0, 0x0, 0xe8, 0xff, 0x1, 0x0, 0xfb, 0xff, 0xe, 0x0, 0x19, 0x0, 0xf8,
+      0xff, 0x1, 0x0, 0xf9, 0xff, 0x8, 0x0, 0xf6, 0xff, 0xf2, 0xff, 0xf8, 0xff,
+      0xa, 0x0, 0xec, 0xff, 0xf8, 0xff, 0xe, 0x0, 0xc, 0x0, 0xd, 0x0, 0x1, 0x0,
+      0x5, 0x0, 0x6, 0x0, 0xf4, 0xff, 0x0, 0x0, 0x11, 0x0, 0x3, 0x0, 0xee, 0xff,
+      0x2, 0x0, 0x0, 0x0, 0xf2, 0xff, 0x5b, 0xff, 0x2f, 0x0, 0x11, 0x0, 0x1c,
+      0x0, 0x1b, 0x0, 0xee, 0xff, 0xfb, 0xff, 0x12, 0x0, 0x2d, 0x0, 0xa, 0x0,
+      0x1f, 0x0, 0x6, 0x0, 0x11, 0x0, 0xfb, 0xff, 0xf0, 0xff, 0x3, 0x0, 0xfe,
+      0xff, 0x2, 0x0, 0x1a, 0x0, 0xfb, 0xff, 0xc, 0x0, 0xfc, 0xff, 0xf9, 0xff,
+      0xdf, 0xff, 0xe, 0x0, 0xfc, 0xff, 0x1, 0x0, 0x16, 0x0, 0xf9, 0xff, 0xa,
+      0x0, 0x1d, 0x0, 0x12, 0x0, 0xe9, 0xff, 0xe4, 0xff, 0xf9, 0xff, 0xa, 0x0,
+      0x2, 0x0, 0xfd, 0xff, 0xd, 0x0, 0x12, 0x0, 0xe8, 0xff, 0x11, 0x0, 0x3,
+      0x0, 0x15, 0x0, 0xfa, 0xff, 0xf3, 0xff, 0xe3, 0xff, 0xfb, 0xff, 0xa, 0x0,
+      0x2, 0x0, 0x8, 0x0, 0x8, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x0,
+      0xf1, 0xff, 0x6, 0x0, 0x12, 0x0, 0x4, 0x0, 0xed, 0xff, 0xfb, 0xff, 0xfb,
+      0xff, 0xff, 0xff, 0x54, 0xff, 0x23, 0x0, 0x9, 0x0, 0xfb, 0xff, 0xf5, 0xff,
+      0xfd, 0xff, 0x10, 0x0, 0xff, 0xff, 0x3, 0x0, 0xe5, 0xff, 0xb, 0x0, 0x19,
+      0x0, 0xfb, 0xff, 0x12, 0x0, 0xf7, 0xff, 0x7, 0x0, 0x1, 0x0, 0x0, 0x0,
+      0xfc, 0xff, 0xfe, 0xff, 0x6, 0x0, 0x5, 0x0, 0x1, 0x0, 0x3, 0x0, 0x15, 0x0,
+      0x0, 0x0, 0x11, 0x0, 0xed, 0xff, 0x0, 0x0, 0x13, 0x0, 0x13, 0x0, 0x14,
+      0x0, 0xe8, 0xff, 0xf8, 0xff, 0x5, 0x0, 0xc, 0x0, 0x6, 0x0, 0xf, 0x0, 0x14,
+      0x0, 0x4, 0x0, 0xf2, 0xff, 0x1a, 0x0, 0x7, 0x0, 0xa, 0x0, 0x0, 0x0, 0xf4,
+      0xff, 0xf6, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xff, 0xff, 0x9, 0x0, 0x20, 0x0,
+      0x19, 0x0, 0xfd, 0xff, 0xf5, 0xff, 0x11, 0x0, 0xe9, 0xff, 0x4, 0x0, 0xf,
+      0x0, 0xf9, 0xff, 0xf3, 0xff, 0xf7, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x55,
+      0xff, 0x28, 0x0, 0xa, 0x0, 0x9, 0x0, 0x15, 0x0, 0xf1, 0xff, 0x3, 0x0,
+      0xfd, 0xff, 0x9, 0x0, 0xe3, 0xff, 0xff, 0xff, 0x1, 0x0, 0x1, 0x0, 0x16,
+      0x0, 0xff, 0xff, 0xf9, 0xff, 0xf7, 0xff, 0x6, 0x0, 0x5, 0x0, 0x0, 0x0,
+      0x9, 0x0, 0x12, 0x0, 0x22, 0x0, 0xf2, 0xff, 0xa, 0x0, 0xf3, 0xff, 0xf7,
+      0xff, 0x1b, 0x0, 0x11, 0x0, 0xf, 0x0, 0x2, 0x0, 0x22, 0x0, 0xe7, 0xff,
+      0xf4, 0xff, 0xf2, 0xff, 0xee, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0x15, 0x0,
+      0xfd, 0xff, 0x7, 0x0, 0x7, 0x0, 0xf9, 0xff, 0x10, 0x0, 0xfb, 0xff, 0xec,
+      0xff, 0xcf, 0xff, 0xfe, 0xff, 0x6, 0x0, 0xfa, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0x9, 0x0, 0x3, 0x0, 0xf5, 0xff, 0x5, 0x0, 0xf0, 0xff, 0x7, 0x0,
+      0x13, 0x0, 0xf2, 0xff, 0xf1, 0xff, 0xfc, 0xff, 0x1, 0x0, 0x6, 0x0, 0x5f,
+      0xff, 0x22, 0x0, 0xc, 0x0, 0x12, 0x0, 0x1b, 0x0, 0xe8, 0xff, 0x4, 0x0,
+      0x9, 0x0, 0x30, 0x0, 0x20, 0x0, 0x15, 0x0, 0xa, 0x0, 0xfb, 0xff, 0xfe,
+      0xff, 0x1, 0x0, 0x1a, 0x0, 0x18, 0x0, 0xeb, 0xff, 0xa, 0x0, 0xde, 0xff,
+      0x6, 0x0, 0xb, 0x0, 0xa, 0x0, 0xf3, 0xff, 0xe4, 0xff, 0x1, 0x0, 0xc, 0x0,
+      0xd8, 0xff, 0x14, 0x0, 0x8, 0x0, 0xd, 0x0, 0xfe, 0xff, 0x6, 0x0, 0xee,
+      0xff, 0xb, 0x0, 0xf8, 0xff, 0x19, 0x0, 0x11, 0x0, 0x14, 0x0, 0x1, 0x0,
+      0xfc, 0xff, 0x9, 0x0, 0x3, 0x0, 0x13, 0x0, 0x0, 0x0, 0xf7, 0xff, 0x4, 0x0,
+      0xef, 0xff, 0x4, 0x0, 0x5, 0x0, 0x3, 0x0, 0x18, 0x0, 0x17, 0x0, 0x2, 0x0,
+      0xfd, 0xff, 0xf9, 0xff, 0xee, 0xff, 0xb, 0x0, 0x16, 0x0, 0xf9, 0xff, 0xf3,
+      0xff, 0xf9, 0xff, 0xf1, 0xff, 0xfd, 0xff, 0x61, 0xff, 0x1f, 0x0, 0x11,
+      0x0, 0xfa, 0xff, 0xf6, 0xff, 0xfb, 0xff, 0x1e, 0x0, 0x2, 0x0, 0x1e, 0x0,
+      0xd5, 0xff, 0xf1, 0xff, 0xf, 0x0, 0x6, 0x0, 0x13, 0x0, 0x21, 0x0, 0xc,
+      0x0, 0xea, 0xff, 0xf, 0x0, 0x0, 0x0, 0xf0, 0xff, 0xf5, 0xff, 0xfa, 0xff,
+      0x34, 0x0, 0xf, 0x0, 0x10, 0x0, 0xf8, 0xff, 0x8, 0x0, 0x3, 0x0, 0x8, 0x0,
+      0xe2, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xf7, 0xff, 0x3, 0x0, 0xfa, 0xff,
+      0xfd, 0xff, 0xf8, 0xff, 0x1, 0x0, 0xb, 0x0, 0xf4, 0xff, 0x3, 0x0, 0xe8,
+      0xff, 0xb, 0x0, 0xf6, 0xff, 0x9, 0x0, 0xf9, 0xff, 0xee, 0xff, 0xfa, 0xff,
+      0x9, 0x0, 0xf5, 0xff, 0x9, 0x0, 0x2, 0x0, 0x3, 0x0, 0xd, 0x0, 0xf1, 0xff,
+      0xf1, 0xff, 0xf3, 0xff, 0x2, 0x0, 0x12, 0x0, 0xf2, 0xff, 0xfa, 0xff, 0xfe,
+      0xff, 0xf7, 0xff, 0xa, 0x0, 0x5f, 0xff, 0x27, 0x0, 0xf9, 0xff, 0xff, 0xff,
+      0x18, 0x0, 0xed, 0xff, 0x9, 0x0, 0x8, 0x0, 0x27, 0x0, 0x14, 0x0, 0x2, 0x0,
+      0x3, 0x0, 0xc, 0x0, 0x6, 0x0, 0x1, 0x0, 0x0, 0x0, 0xa, 0x0, 0xed, 0xff,
+      0xf9, 0xff, 0xe9, 0xff, 0xc, 0x0, 0xe, 0x0, 0x1a, 0x0, 0x3, 0x0, 0xe9,
+      0xff, 0xb, 0x0, 0xec, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0x3, 0x0,
+      0xf9, 0xff, 0x14, 0x0, 0x3, 0x0, 0x8, 0x0, 0xf6, 0xff, 0x3, 0x0, 0xf8,
+      0xff, 0xfe, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xe0, 0xff, 0x1, 0x0, 0xf8,
+      0xff, 0xf5, 0xff, 0x10, 0x0, 0xe7, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfb,
+      0xff, 0xfc, 0xff, 0xfc, 0xff, 0x2, 0x0, 0x12, 0x0, 0xf7, 0xff, 0xe7, 0xff,
+      0xfa, 0xff, 0xff, 0xff, 0x13, 0x0, 0xf8, 0xff, 0xf9, 0xff, 0x8, 0x0, 0xf4,
+      0xff, 0xfa, 0xff, 0x61, 0xff, 0x24, 0x0, 0x9, 0x0, 0x3, 0x0, 0xff, 0xff,
+      0xfd, 0xff, 0x6, 0x0, 0xfd, 0xff, 0x31, 0x0, 0x19, 0x0, 0x5, 0x0, 0xb,
+      0x0, 0xf, 0x0, 0x5, 0x0, 0xfb, 0xff, 0x11, 0x0, 0x6, 0x0, 0x1, 0x0, 0xf3,
+      0xff, 0x2, 0x0, 0x4, 0x0, 0x1, 0x0, 0x10, 0x0, 0xd, 0x0, 0xf2, 0xff, 0xff,
+      0xff, 0xf9, 0xff, 0xda, 0xff, 0xf1, 0xff, 0x1, 0x0, 0xe, 0x0, 0xf0, 0xff,
+      0x1, 0x0, 0x18, 0x0, 0x3, 0x0, 0x4, 0x0, 0xf4, 0xff, 0xf8, 0xff, 0xf1,
+      0xff, 0xed, 0xff, 0xf1, 0xff, 0xfa, 0xff, 0x15, 0x0, 0xe, 0x0, 0x2, 0x0,
+      0xa, 0x0, 0xe, 0x0, 0xfa, 0xff, 0x4, 0x0, 0xfc, 0xff, 0xfe, 0xff, 0x3,
+      0x0, 0xfb, 0xff, 0xf, 0x0, 0x1, 0x0, 0xef, 0xff, 0xf3, 0xff, 0x3, 0x0,
+      0xc, 0x0, 0xfb, 0xff, 0x4, 0x0, 0xe, 0x0, 0xf6, 0xff, 0x8, 0x0, 0x68,
+      0xff, 0x2a, 0x0, 0x1, 0x0, 0x2, 0x0, 0xe8, 0xff, 0xfd, 0xff, 0x5, 0x0,
+      0x10, 0x0, 0x19, 0x0, 0xdc, 0xff, 0xf5, 0xff, 0x11, 0x0, 0xf3, 0xff, 0x10,
+      0x0, 0x5, 0x0, 0x5, 0x0, 0xe6, 0xff, 0x1, 0x0, 0x1, 0x0, 0xfa, 0xff, 0xf1,
+      0xff, 0x0, 0x0, 0x1, 0x0, 0x24, 0x0, 0x17, 0x0, 0x9, 0x0, 0xe3, 0xff,
+      0xfa, 0xff, 0x0, 0x0, 0xfb, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0xe,
+      0x0, 0x15, 0x0, 0x13, 0x0, 0xf5, 0xff, 0xf2, 0xff, 0xe6, 0xff, 0xe8, 0xff,
+      0x8, 0x0, 0xef, 0xff, 0x16, 0x0, 0xf8, 0xff, 0xf5, 0xff, 0x12, 0x0, 0xf6,
+      0xff, 0xd, 0x0, 0xa, 0x0, 0xfc, 0xff, 0xf3, 0xff, 0xf6, 0xff, 0xf0, 0xff,
+      0xa, 0x0, 0xff, 0xff, 0xf4, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0x3, 0x0, 0xf2,
+      0xff, 0xc, 0x0, 0xa, 0x0, 0x3, 0x0, 0xf, 0x0, 0x65, 0xff, 0x19, 0x0, 0xfc,
+      0xff, 0x6, 0x0, 0xfe, 0xff, 0xf1, 0xff, 0x1, 0x0, 0xf3, 0xff, 0x29, 0x0,
+      0x10, 0x0, 0xf7, 0xff, 0xed, 0xff, 0x6, 0x0, 0xfc, 0xff, 0xeb, 0xff, 0x11,
+      0x0, 0x13, 0x0, 0xf1, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xc, 0x0, 0xc, 0x0,
+      0xf, 0x0, 0xd, 0x0, 0xe1, 0xff, 0x0, 0x0, 0xf2, 0xff, 0xe1, 0xff, 0x7,
+      0x0, 0x14, 0x0, 0x4, 0x0, 0xfc, 0xff, 0xb, 0x0, 0x11, 0x0, 0xe, 0x0, 0xf7,
+      0xff, 0xfe, 0xff, 0xf2, 0xff, 0xeb, 0xff, 0xeb, 0xff, 0x7, 0x0, 0xf6,
+      0xff, 0x9, 0x0, 0x0, 0x0, 0xf6, 0xff, 0xc, 0x0, 0x7, 0x0, 0x12, 0x0, 0xef,
+      0xff, 0x0, 0x0, 0xf3, 0xff, 0xf5, 0xff, 0xf7, 0xff, 0x6, 0x0, 0x9, 0x0,
+      0xf4, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0x0, 0x0, 0xf9, 0xff, 0x7, 0x0, 0xe,
+      0x0, 0x6, 0x0, 0x3, 0x0, 0x71, 0xff, 0x10, 0x0, 0x10, 0x0, 0x2, 0x0, 0x4,
+      0x0, 0xfa, 0xff, 0xd, 0x0, 0xa, 0x0, 0x31, 0x0, 0xfc, 0xff, 0x6, 0x0, 0xe,
+      0x0, 0x3, 0x0, 0xf5, 0xff, 0xa, 0x0, 0x24, 0x0, 0xfb, 0xff, 0x3, 0x0,
+      0x13, 0x0, 0xf8, 0xff, 0xeb, 0xff, 0xe8, 0xff, 0x7, 0x0, 0xb, 0x0, 0x15,
+      0x0, 0xfe, 0xff, 0x2, 0x0, 0xf6, 0xff, 0x3, 0x0, 0xee, 0xff, 0xf3, 0xff,
+      0xdb, 0xff, 0xb, 0x0, 0x5, 0x0, 0xb, 0x0, 0x1a, 0x0, 0xfd, 0xff, 0x2, 0x0,
+      0xf0, 0xff, 0xf0, 0xff, 0x0, 0x0, 0xf3, 0xff, 0x13, 0x0, 0xf4, 0xff, 0x4,
+      0x0, 0xa, 0x0, 0x5, 0x0, 0xa, 0x0, 0x12, 0x0, 0x3, 0x0, 0xf9, 0xff, 0xf8,
+      0xff, 0xf1, 0xff, 0x4, 0x0, 0x2, 0x0, 0xf5, 0xff, 0xf6, 0xff, 0xfc, 0xff,
+      0xfb, 0xff, 0xff, 0xff, 0xa, 0x0, 0x1, 0x0, 0x5, 0x0, 0x10, 0x0, 0x6d,
+      0xff, 0x8, 0x0, 0xff, 0xff, 0xed, 0xff, 0xfc, 0xff, 0xf6, 0xff, 0x13, 0x0,
+      0x4, 0x0, 0x8, 0x0, 0xeb, 0xff, 0xed, 0xff, 0xa, 0x0, 0xf5, 0xff, 0x3,
+      0x0, 0x6, 0x0, 0x9, 0x0, 0xf5, 0xff, 0xfc, 0xff, 0x1, 0x0, 0xed, 0xff,
+      0xf5, 0xff, 0xfa, 0xff, 0xd, 0x0, 0x14, 0x0, 0x8, 0x0, 0x8, 0x0, 0x5, 0x0,
+      0xff, 0xff, 0x9, 0x0, 0xf4, 0xff, 0xed, 0xff, 0x3, 0x0, 0xa, 0x0, 0xe,
+      0x0, 0xb, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0xf7, 0xff, 0xf9, 0xff, 0x8,
+      0x0, 0xe4, 0xff, 0x6, 0x0, 0xf2, 0xff, 0xfa, 0xff, 0xf, 0x0, 0x5, 0x0,
+      0xa, 0x0, 0xfe, 0xff, 0xf7, 0xff, 0xfc, 0xff, 0x1, 0x0, 0xf6, 0xff, 0x0,
+      0x0, 0xff, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf7, 0xff, 0xf6, 0xff, 0xfc,
+      0xff, 0x9, 0x0, 0xfc, 0xff, 0x8, 0x0, 0xff, 0xff, 0x78, 0xff, 0xe, 0x0,
+      0x5, 0x0, 0x3, 0x0, 0x14, 0x0, 0xf8, 0xff, 0x0, 0x0, 0xf6, 0xff, 0x2e,
+      0x0, 0x8, 0x0, 0xfb, 0xff, 0x0, 0x0, 0x15, 0x0, 0xf5, 0xff, 0xf6, 0xff,
+      0xfe, 0xff, 0x2, 0x0, 0xfa, 0xff, 0x2, 0x0, 0x4, 0x0, 0xd, 0x0, 0x5, 0x0,
+      0xe, 0x0, 0xe8, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xfb, 0xff, 0xe, 0x0, 0xf8,
+      0xff, 0x1, 0x0, 0xf6, 0xff, 0x7, 0x0, 0x8, 0x0, 0x6, 0x0, 0xec, 0xff,
+      0xfa, 0xff, 0xf2, 0xff, 0xf3, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xf7, 0xff,
+      0xee, 0xff, 0xfc, 0xff, 0x2, 0x0, 0x1, 0x0, 0x5, 0x0, 0xf4, 0xff, 0xfe,
+      0xff, 0x7, 0x0, 0xf7, 0xff, 0xfc, 0xff, 0xf1, 0xff, 0xf0, 0xff, 0x0, 0x0,
+      0x6, 0x0, 0xf6, 0xff, 0xef, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0x6, 0x0, 0x3,
+      0x0, 0xfd, 0xff, 0x7, 0x0, 0x0, 0x0, 0x7c, 0xff, 0xa, 0x0, 0x2, 0x0, 0xfd,
+      0xff, 0x2, 0x0, 0x5, 0x0, 0x5, 0x0, 0x2, 0x0, 0x1f, 0x0, 0xfa, 0xff, 0xf,
+      0x0, 0x14, 0x0, 0xff, 0xff, 0xec, 0xff, 0xfb, 0xff, 0x6, 0x0, 0x5, 0x0,
+      0xf7, 0xff, 0x7, 0x0, 0xf0, 0xff, 0xfc, 0xff, 0xf7, 0xff, 0xe2, 0xff, 0x0,
+      0x0, 0x11, 0x0, 0xfd, 0xff, 0xb, 0x0, 0xf7, 0xff, 0xf9, 0xff, 0xfe, 0xff,
+      0xfa, 0xff, 0xf4, 0xff, 0x8, 0x0, 0x7, 0x0, 0x8, 0x0, 0x17, 0x0, 0x1, 0x0,
+      0xb, 0x0, 0xfc, 0xff, 0x6, 0x0, 0xf3, 0xff, 0xf9, 0xff, 0x8, 0x0, 0xfc,
+      0xff, 0x1, 0x0, 0xb, 0x0, 0x10, 0x0, 0xfb, 0xff, 0xa, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0xb, 0x0, 0x4, 0x0, 0xfd, 0xff, 0x1, 0x0, 0xfb, 0xff, 0xec, 0xff,
+      0xfc, 0xff, 0xf9, 0xff, 0x8, 0x0, 0x3, 0x0, 0xf4, 0xff, 0xff, 0xff, 0x3,
+      0x0, 0x7d, 0xff, 0xd, 0x0, 0xfe, 0xff, 0xf5, 0xff, 0xf8, 0xff, 0x9, 0x0,
+      0x4, 0x0, 0xf2, 0xff, 0x5, 0x0, 0xda, 0xff, 0xf6, 0xff, 0x5, 0x0, 0xff,
+      0xff, 0x2, 0x0, 0x5, 0x0, 0xee, 0xff, 0xf0, 0xff, 0xa, 0x0, 0x4, 0x0, 0x2,
+      0x0, 0xff, 0xff, 0x2, 0x0, 0xfe, 0xff, 0x4, 0x0, 0x9, 0x0, 0xec, 0xff,
+      0xfd, 0xff, 0x1b, 0x0, 0x3, 0x0, 0x9, 0x0, 0xf6, 0xff, 0x17, 0x0, 0xed,
+      0xff, 0x8, 0x0, 0xfa, 0xff, 0xf9, 0xff, 0xf3, 0xff, 0xf2, 0xff, 0x3, 0x0,
+      0x6, 0x0, 0x9, 0x0, 0xf6, 0xff, 0x0, 0x0, 0x0, 0x0, 0xfe, 0xff, 0xfb,
+      0xff, 0xfc, 0xff, 0x9, 0x0, 0xfb, 0xff, 0xf5, 0xff, 0x1, 0x0, 0xfa, 0xff,
+      0x5, 0x0, 0x2, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xf3, 0xff, 0xfc, 0xff, 0xf6,
+      0xff, 0xfd, 0xff, 0x2, 0x0, 0xf9, 0xff, 0x7, 0x0, 0x3, 0x0, 0x84, 0xff,
+      0xe, 0x0, 0x1, 0x0, 0x8, 0x0, 0xc, 0x0, 0xfe, 0xff, 0xfa, 0xff, 0xfc,
+      0xff, 0x32, 0x0, 0x4, 0x0, 0x11, 0x0, 0xff, 0xff, 0x8, 0x0, 0xf1, 0xff,
+      0xf2, 0xff, 0x5, 0x0, 0xb, 0x0, 0xef, 0xff, 0x10, 0x0, 0xf5, 0xff, 0x7,
+      0x0, 0xff, 0xff, 0xeb, 0xff, 0xeb, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0xf2,
+      0xff, 0x12, 0x0, 0x6, 0x0, 0xb, 0x0, 0xfa, 0xff, 0xf8, 0xff, 0xff, 0xff,
+      0xf0, 0xff, 0x6, 0x0, 0xf9, 0xff, 0xc, 0x0, 0xfc, 0xff, 0x3, 0x0, 0x13,
+      0x0, 0xfb, 0xff, 0x1, 0x0, 0xfd, 0xff, 0x5, 0x0, 0xfb, 0xff, 0xfa, 0xff,
+      0x1, 0x0, 0xfd, 0xff, 0xfd, 0xff, 0x0, 0x0, 0xff, 0xff, 0xfe, 0xff, 0xe,
+      0x0, 0x3, 0x0, 0x3, 0x0, 0x1, 0x0, 0xf7, 0xff, 0x2, 0x0, 0xfd, 0xff, 0x2,
+      0x0, 0x0, 0x0, 0xf7, 0xff, 0x1, 0x0, 0xfb, 0xff, 0x82, 0xff, 0x3, 0x0,
+      0x8, 0x0, 0xf2, 0xff, 0xed, 0xff, 0xd, 0x0, 0xe, 0x0, 0xfb, 0xff, 0x14,
+      0x0, 0xdc, 0xff, 0xb, 0x0, 0x6, 0x0, 0xfc, 0xff, 0x2, 0x0, 0xfb, 0xff,
+      0xb, 0x0, 0xf0, 0xff, 0xa, 0x0, 0x8, 0x0, 0xfa, 0xff, 0xfb, 0xff, 0xee,
+      0xff, 0xf2, 0xff, 0x8, 0x0, 0x10, 0x0, 0xf3, 0xff, 0xa, 0x0, 0x3, 0x0,
+      0x9, 0x0, 0xfe, 0xff, 0xf8, 0xff, 0xf3, 0xff, 0xf2, 0xff, 0x4, 0x0, 0x4,
+      0x0, 0x4, 0x0, 0x1, 0x0, 0x9, 0x0, 0xd, 0x0, 0xd, 0x0, 0x2, 0x0, 0xfd,
+      0xff, 0x7, 0x0, 0x0, 0x0, 0x1, 0x0, 0xfb, 0xff, 0x12, 0x0, 0x0, 0x0, 0xfa,
+      0xff, 0xfb, 0xff, 0x8, 0x0, 0xf, 0x0, 0x14, 0x0, 0x3, 0x0, 0xfd, 0xff,
+      0x2, 0x0, 0xf8, 0xff, 0x2, 0x0, 0xf7, 0xff, 0xfe, 0xff, 0x2, 0x0, 0xfc,
+      0xff, 0x0, 0x0, 0xff, 0xff, 0x84, 0xff, 0xa, 0x0, 0xf5, 0xff, 0xf9, 0xff,
+      0xb, 0x0, 0xff, 0xff, 0xc, 0x0, 0xff, 0xff, 0xe, 0x0, 0xe5, 0xff, 0xfd,
+      0xff, 0x4, 0x0, 0x6, 0x0, 0x9, 0x0, 0x4, 0x0, 0xed, 0xff, 0xea, 0xff, 0x3,
+      0x0, 0x2, 0x0, 0x7, 0x0, 0xff, 0xff, 0xf8, 0xff, 0x3, 0x0, 0xff, 0xff,
+      0x5, 0x0, 0xf4, 0xff, 0xea, 0xff, 0x1f, 0x0, 0x8, 0x0, 0xa, 0x0, 0xed,
+      0xff, 0x7, 0x0, 0xfd, 0xff, 0xf7, 0xff, 0xf9, 0xff, 0xf7, 0xff, 0xfc,
+      0xff, 0xf8, 0xff, 0x6, 0x0, 0x8, 0x0, 0x10, 0x0, 0xf7, 0xff, 0xf5, 0xff,
+      0xfe, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xee, 0xff, 0x7, 0x0, 0xf5, 0xff,
+      0xf9, 0xff, 0x2, 0x0, 0xfd, 0xff, 0x9, 0x0, 0x5, 0x0, 0xfa, 0xff, 0x0,
+      0x0, 0x0, 0x0, 0xfe, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xff, 0xff, 0x3, 0x0,
+      0x6, 0x0, 0xf9, 0xff, 0x82, 0xff, 0x4, 0x0, 0xf7, 0xff, 0x6, 0x0, 0x12,
+      0x0, 0xfa, 0xff, 0x5, 0x0, 0xf6, 0xff, 0x22, 0x0, 0x11, 0x0, 0x6, 0x0,
+      0xf6, 0xff, 0x12, 0x0, 0xfb, 0xff, 0xeb, 0xff, 0x5, 0x0, 0xd, 0x0, 0xf3,
+      0xff, 0xf7, 0xff, 0x4, 0x0, 0xb, 0x0, 0x1, 0x0, 0xfb, 0xff, 0xf4, 0xff,
+      0xee, 0xff, 0x1, 0x0, 0xfc, 0xff, 0xf6, 0xff, 0x4, 0x0, 0x13, 0x0, 0xfc,
+      0xff, 0xf7, 0xff, 0x8, 0x0, 0xfe, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0x8, 0x0,
+      0x8, 0x0, 0x2, 0x0, 0x7, 0x0, 0xfb, 0xff, 0xa, 0x0, 0xfa, 0xff, 0x11, 0x0,
+      0xf7, 0xff, 0x0, 0x0, 0x8, 0x0, 0xf3, 0xff, 0xf1, 0xff, 0x1, 0x0, 0x3,
+      0x0, 0xa, 0x0, 0xc, 0x0, 0xff, 0xff, 0x3, 0x0, 0x4, 0x0, 0xfa, 0xff, 0x5,
+      0x0, 0xfb, 0xff, 0x2, 0x0, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xf8, 0xff,
+      0x8a, 0xff, 0xa, 0x0, 0x4, 0x0, 0xf8, 0xff, 0xf9, 0xff, 0xd, 0x0, 0xd,
+      0x0, 0x2, 0x0, 0x6, 0x0, 0xdb, 0xff, 0xfe, 0xff, 0x10, 0x0, 0xf6, 0xff,
+      0xc, 0x0, 0x7, 0x0, 0xfe, 0xff, 0xe7, 0xff, 0x15, 0x0, 0x0, 0x0, 0x5, 0x0,
+      0xf0, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xf, 0x0, 0xf, 0x0, 0xf7, 0xff, 0xb,
+      0x0, 0x5, 0x0, 0x0, 0x0, 0xf9, 0xff, 0xf3, 0xff, 0xfe, 0xff, 0xfa, 0xff,
+      0x1, 0x0, 0xf6, 0xff, 0xb, 0x0, 0xf9, 0xff, 0x7, 0x0, 0x9, 0x0, 0xfd,
+      0xff, 0x1, 0x0, 0xfc, 0xff, 0x4, 0x0, 0x1, 0x0, 0xfc, 0xff, 0xfd, 0xff,
+      0xff, 0xff, 0xfb, 0xff, 0x5, 0x0, 0x0, 0x0, 0x2, 0x0, 0x2, 0x0, 0x5, 0x0,
+      0xff, 0xff, 0xfa, 0xff, 0x5, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xf6, 0xff, 0xfc,
+      0xff, 0x0, 0x0, 0xfc, 0xff, 0x0, 0x0, 0xa, 0x0, 0x89, 0xff, 0xa, 0x0,
+      0xf1, 0xff, 0xf9, 0xff, 0x15, 0x0, 0xf7, 0xff, 0x12, 0x0, 0xef, 0xff, 0x8,
+      0x0, 0xfd, 0xff, 0xf7, 0xff, 0xfe, 0xff, 0x8, 0x0, 0x1, 0x0, 0xfb, 0xff,
+      0xf1, 0xff, 0x6, 0x0, 0xfc, 0xff, 0xf8, 0xff, 0x3, 0x0, 0x7, 0x0, 0x9,
+      0x0, 0x4, 0x0, 0x0, 0x0, 0xe5, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x3, 0x0,
+      0x2, 0x0, 0x11, 0x0, 0xf6, 0xff, 0x8, 0x0, 0x13, 0x0, 0xf6, 0xff, 0xff,
+      0xff, 0xec, 0xff, 0x7, 0x0, 0xf9, 0xff, 0x4, 0x0, 0x0, 0x0, 0x9, 0x0,
+      0xf8, 0xff, 0xf4, 0xff, 0x0, 0x0, 0xf8, 0xff, 0xff, 0xff, 0xfa, 0xff, 0x3,
+      0x0, 0xf2, 0xff, 0x4, 0x0, 0xff, 0xff, 0xf9, 0xff, 0x6, 0x0, 0xff, 0xff,
+      0xfe, 0xff, 0x3, 0x0, 0x3, 0x0, 0xfe, 0xff, 0xf8, 0xff, 0xfa, 0xff, 0xff,
+      0xff, 0xfe, 0xff, 0x6, 0x0, 0xf9, 0xff, 0x8b, 0xff, 0x5, 0x0, 0xfe, 0xff,
+      0xfc, 0xff, 0x10, 0x0, 0xfe, 0xff, 0xc, 0x0, 0xf2, 0xff, 0x1f, 0x0, 0x4,
+      0x0, 0x7, 0x0, 0xfd, 0xff, 0x16, 0x0, 0x1, 0x0, 0xef, 0xff, 0xb, 0x0, 0x5,
+      0x0, 0x1, 0x0, 0x4, 0x0, 0x9, 0x0, 0x1, 0x0, 0xff, 0xff, 0x5, 0x0, 0xf1,
+      0xff, 0xf9, 0xff, 0xfc, 0xff, 0x3, 0x0, 0x0, 0x0, 0xfc, 0xff, 0x2, 0x0,
+      0xff, 0xff, 0xe9, 0xff, 0x10, 0x0, 0xf5, 0xff, 0xfd, 0xff, 0xfd, 0xff,
+      0x6, 0x0, 0x7, 0x0, 0xfd, 0xff, 0xfc, 0xff, 0xf7, 0xff, 0xfd, 0xff, 0xa,
+      0x0, 0x8, 0x0, 0x1, 0x0, 0xfa, 0xff, 0x1, 0x0, 0xfb, 0xff, 0xff, 0xff,
+      0x8, 0x0, 0x7, 0x0, 0xfa, 0xff, 0x3, 0x0, 0xfb, 0xff, 0x2, 0x0, 0x4, 0x0,
+      0x1, 0x0, 0x6, 0x0, 0xfc, 0xff, 0x2, 0x0, 0x2, 0x0, 0xfc, 0xff, 0xff,
+      0xff, 0x2, 0x0, 0x8e, 0xff, 0xd, 0x0, 0xfb, 0xff, 0xed, 0xff, 0x2, 0x0,
+      0x6, 0x0, 0x10, 0x0, 0x4, 0x0, 0xff, 0xff, 0xe7, 0xff, 0x0, 0x0, 0xb, 0x0,
+      0xf1, 0xff, 0xb, 0x0, 0x7, 0x0, 0x0, 0x0, 0xf4, 0xff, 0x9, 0x0, 0x4, 0x0,
+      0xf7, 0xff, 0xef, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0x12, 0x0, 0x5, 0x0, 0x4,
+      0x0, 0x0, 0x0, 0xfe, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xf4, 0xff, 0xf5, 0xff,
+      0xd, 0x0, 0xfe, 0xff, 0x2, 0x0, 0x5, 0x0, 0x6, 0x0, 0x11, 0x0, 0xfe, 0xff,
+      0xfa, 0xff, 0x7, 0x0, 0xf0, 0xff, 0x8, 0x0, 0xfa, 0xff, 0xff, 0xff, 0x6,
+      0x0, 0x4, 0x0, 0x5, 0x0, 0xfa, 0xff, 0x4, 0x0, 0x8, 0x0, 0x4, 0x0, 0x5,
+      0x0, 0xfe, 0xff, 0xfc, 0xff, 0x1, 0x0, 0x6, 0x0, 0xff, 0xff, 0xfa, 0xff,
+      0xfd, 0xff, 0x5, 0x0, 0xff, 0xff, 0xfe, 0xff, 0x0, 0x0, 0x94, 0xff, 0x11,
+      0x0, 0xf3, 0xff, 0xfe, 0xff, 0x16, 0x0, 0xf8, 0xff, 0x7, 0x0, 0xf0, 0xff,
+      0xa, 0x0, 0x3, 0x0, 0xf4, 0xff, 0xf3, 0xff, 0x13, 0x0, 0x5, 0x0, 0xfd,
+      0xff, 0xf7, 0xff, 0x9, 0x0, 0xfc, 0xff, 0xfb, 0xff, 0x6, 0x0, 0xf, 0x0,
+      0x3, 0x0, 0x19, 0x0, 0xf6, 0xff, 0xed, 0xff, 0x1, 0x0, 0xf3, 0xff, 0x4,
+      0x0, 0xfd, 0xff, 0xb, 0x0, 0x2, 0x0, 0x6, 0x0, 0xe, 0x0, 0xff, 0xff, 0xee,
+      0xff, 0xe8, 0xff, 0xfb, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0x9,
+      0x0, 0xf8, 0xff, 0xfc, 0xff, 0x5, 0x0, 0xfe, 0xff, 0x4, 0x0, 0xf4, 0xff,
+      0x6, 0x0, 0xed, 0xff, 0x0, 0x0, 0x3, 0x0, 0xf6, 0xff, 0xfb, 0xff, 0x1,
+      0x0, 0x2, 0x0, 0x2, 0x0, 0x6, 0x0, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff,
+      0x4, 0x0, 0x5, 0x0, 0x7, 0x0, 0xf8, 0xff, 0x93, 0xff, 0x4, 0x0, 0xf6,
+      0xff, 0x5, 0x0, 0xb, 0x0, 0xfe, 0xff, 0xff, 0xff, 0x8, 0x0, 0x1c, 0x0,
+      0x8, 0x0, 0x9, 0x0, 0x9, 0x0, 0x8, 0x0, 0xff, 0xff, 0xef, 0xff, 0xf, 0x0,
+      0x8, 0x0, 0xee, 0xff, 0x2, 0x0, 0xf3, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf1,
+      0xff, 0xf6, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xea, 0xff, 0xfa,
+      0xff, 0xed, 0xff, 0x6, 0x0, 0xe9, 0xff, 0x11, 0x0, 0xfb, 0xff, 0xfe, 0xff,
+      0xb, 0x0, 0x4, 0x0, 0x11, 0x0, 0xfc, 0xff, 0xfe, 0xff, 0xf6, 0xff, 0xfe,
+      0xff, 0x11, 0x0, 0x4, 0x0, 0x1, 0x0, 0x8, 0x0, 0xc, 0x0, 0xfc, 0xff, 0xb,
+      0x0, 0xa, 0x0, 0x2, 0x0, 0x4, 0x0, 0xfb, 0xff, 0x1, 0x0, 0x4, 0x0, 0x7,
+      0x0, 0x4, 0x0, 0x3, 0x0, 0xff, 0xff, 0x4, 0x0, 0x7, 0x0, 0x0, 0x0, 0xff,
+      0xff, 0xff, 0xff, 0x96, 0xff, 0x8, 0x0, 0xfb, 0xff, 0xf7, 0xff, 0xfd,
+      0xff, 0x7, 0x0, 0x11, 0x0, 0x2, 0x0, 0xf3, 0xff, 0xe6, 0xff, 0xf8, 0xff,
+      0xd, 0x0, 0xed, 0xff, 0x9, 0x0, 0xfd, 0xff, 0xf7, 0xff, 0xf2, 0xff, 0xe,
+      0x0, 0xf9, 0xff, 0xf3, 0xff, 0xee, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0x16,
+      0x0, 0xfc, 0xff, 0xff, 0xff, 0x6, 0x0, 0xf7, 0xff, 0xfe, 0xff, 0xf4, 0xff,
+      0x1, 0x0, 0x7, 0x0, 0x6, 0x0, 0xb, 0x0, 0xfa, 0xff, 0xfd, 0xff, 0xf8,
+      0xff, 0x4, 0x0, 0x2, 0x0, 0xf6, 0xff, 0xc, 0x0, 0xf5, 0xff, 0x5, 0x0,
+      0xfe, 0xff, 0x1, 0x0, 0x6, 0x0, 0x6, 0x0, 0x4, 0x0, 0xfc, 0xff, 0xfc,
+      0xff, 0x1, 0x0, 0xfe, 0xff, 0xfb, 0xff, 0x2, 0x0, 0xff, 0xff, 0x6, 0x0,
+      0x7, 0x0, 0xfb, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0x4, 0x0, 0x3, 0x0, 0x2,
+      0x0, 0x1, 0x0, 0x9e, 0xff, 0x12, 0x0, 0xf7, 0xff, 0xd, 0x0, 0x15, 0x0,
+      0xfd, 0xff, 0x5, 0x0, 0xfa, 0xff, 0x19, 0x0, 0x9, 0x0, 0xfb, 0xff, 0xfc,
+      0xff, 0xd, 0x0, 0xfe, 0xff, 0xf0, 0xff, 0xf8, 0xff, 0x6, 0x0, 0xfd, 0xff,
+      0x6, 0x0, 0xfc, 0xff, 0xa, 0x0, 0x2, 0x0, 0xd, 0x0, 0xf2, 0xff, 0xf2,
+      0xff, 0xb, 0x0, 0xf2, 0xff, 0x15, 0x0, 0xfa, 0xff, 0x9, 0x0, 0xf, 0x0,
+      0xff, 0xff, 0x12, 0x0, 0xf5, 0xff, 0xf9, 0xff, 0xf4, 0xff, 0x2, 0x0, 0xf1,
+      0xff, 0xfe, 0xff, 0xf7, 0xff, 0x0, 0x0, 0xf6, 0xff, 0xfb, 0xff, 0x2, 0x0,
+      0xfd, 0xff, 0x1, 0x0, 0xea, 0xff, 0x4, 0x0, 0xf7, 0xff, 0xfa, 0xff, 0xfc,
+      0xff, 0xe9, 0xff, 0xf6, 0xff, 0xfd, 0xff, 0x1, 0x0, 0xff, 0xff, 0x9, 0x0,
+      0xfa, 0xff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x4, 0x0, 0x3, 0x0, 0xfd, 0xff,
+      0x95, 0xff, 0x2, 0x0, 0xf9, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xb,
+      0x0, 0xff, 0xff, 0x14, 0x0, 0xfd, 0xff, 0x7, 0x0, 0x2, 0x0, 0x9, 0x0, 0x1,
+      0x0, 0xf0, 0xff, 0xa, 0x0, 0x9, 0x0, 0xfe, 0xff, 0x6, 0x0, 0xf6, 0xff,
+      0xf9, 0xff, 0xfa, 0xff, 0xf8, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0x0, 0x0, 0x6,
+      0x0, 0xed, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xa, 0x0, 0xe9, 0xff, 0xc, 0x0,
+      0xff, 0xff, 0x1, 0x0, 0x9, 0x0, 0xc, 0x0, 0xa, 0x0, 0x0, 0x0, 0xf8, 0xff,
+      0xf2, 0xff, 0xf9, 0xff, 0xa, 0x0, 0x5, 0x0, 0xfe, 0xff, 0x5, 0x0, 0x15,
+      0x0, 0x0, 0x0, 0x8, 0x0, 0x1, 0x0, 0x6, 0x0, 0x8, 0x0, 0x1, 0x0, 0xfc,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0xfc, 0xff, 0x4, 0x0,
+      0x2, 0x0, 0x4, 0x0, 0xf9, 0xff, 0xff, 0xff, 0x9b, 0xff, 0xb, 0x0, 0x0,
+      0x0, 0xf6, 0xff, 0x0, 0x0, 0x4, 0x0, 0x16, 0x0, 0xff, 0xff, 0xf2, 0xff,
+      0xd8, 0xff, 0xf5, 0xff, 0xb, 0x0, 0xf8, 0xff, 0xf, 0x0, 0xb, 0x0, 0xeb,
+      0xff, 0xf0, 0xff, 0x19, 0x0, 0x7, 0x0, 0x6, 0x0, 0xee, 0xff, 0xf6, 0xff,
+      0x8, 0x0, 0xc, 0x0, 0xe, 0x0, 0x6, 0x0, 0xfc, 0xff, 0xf, 0x0, 0x1, 0x0,
+      0xfc, 0xff, 0xfa, 0xff, 0xb, 0x0, 0xfc, 0xff, 0x6, 0x0, 0xfa, 0xff, 0xfb,
+      0xff, 0xf9, 0xff, 0x0, 0x0, 0x2, 0x0, 0xf2, 0xff, 0xd, 0x0, 0xeb, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4, 0x0, 0xf9, 0xff, 0x7, 0x0, 0x1,
+      0x0, 0xfc, 0xff, 0x3, 0x0, 0xf9, 0xff, 0xf9, 0xff, 0x1, 0x0, 0xf8, 0xff,
+      0x1, 0x0, 0x3, 0x0, 0xf8, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0x2, 0x0, 0x5,
+      0x0, 0xfd, 0xff, 0x0, 0x0, 0x9d, 0xff, 0x7, 0x0, 0xf2, 0xff, 0x12, 0x0,
+      0x1d, 0x0, 0xf4, 0xff, 0x4, 0x0, 0xf8, 0xff, 0x27, 0x0, 0x1d, 0x0, 0xfb,
+      0xff, 0xf8, 0xff, 0xb, 0x0, 0xf9, 0xff, 0xec, 0xff, 0xf7, 0xff, 0x16, 0x0,
+      0xee, 0xff, 0x0, 0x0, 0xfa, 0xff, 0xe, 0x0, 0x3, 0x0, 0x6, 0x0, 0xf0,
+      0xff, 0xe8, 0xff, 0x10, 0x0, 0xf4, 0xff, 0xfd, 0xff, 0x1, 0x0, 0x11, 0x0,
+      0x11, 0x0, 0x2, 0x0, 0x15, 0x0, 0xfd, 0xff, 0x5, 0x0, 0xf2, 0xff, 0xa,
+      0x0, 0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0xfe, 0xff, 0xf7, 0xff, 0xf5, 0xff,
+      0xe, 0x0, 0xfd, 0xff, 0x1, 0x0, 0x6, 0x0, 0xfd, 0xff, 0xfc, 0xff, 0x3,
+      0x0, 0xfe, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0x0, 0x0, 0x3, 0x0, 0xfd, 0xff,
+      0x5, 0x0, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x2, 0x0, 0xfb,
+      0xff, 0xfa, 0xff, 0x9f, 0xff, 0xa, 0x0, 0xf6, 0xff, 0xfe, 0xff, 0xf4,
+      0xff, 0xf7, 0xff, 0x2, 0x0, 0x2, 0x0, 0x1a, 0x0, 0xf2, 0xff, 0x4, 0x0,
+      0xf8, 0xff, 0x5, 0x0, 0x9, 0x0, 0xfd, 0xff, 0x9, 0x0, 0xf7, 0xff, 0xd,
+      0x0, 0x6, 0x0, 0xfb, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0x6, 0x0, 0xff, 0xff,
+      0x1, 0x0, 0x5, 0x0, 0xa, 0x0, 0x3, 0x0, 0x1, 0x0, 0x2, 0x0, 0x13, 0x0,
+      0xf7, 0xff, 0x8, 0x0, 0x3, 0x0, 0xf8, 0xff, 0x8, 0x0, 0xff, 0xff, 0x5,
+      0x0, 0x1, 0x0, 0xfd, 0xff, 0xf4, 0xff, 0x0, 0x0, 0x2, 0x0, 0xb, 0x0, 0xfb,
+      0xff, 0xfd, 0xff, 0xa, 0x0, 0xfa, 0xff, 0x8, 0x0, 0xff, 0xff, 0x1, 0x0,
+      0x5, 0x0, 0x0, 0x0, 0xfc, 0xff, 0xfd, 0xff, 0x2, 0x0, 0xfc, 0xff, 0x1,
+      0x0, 0xf4, 0xff, 0x1, 0x0, 0xfa, 0xff, 0x0, 0x0, 0xfd, 0xff, 0xa, 0x0,
+      0xa0, 0xff, 0x18, 0x0, 0xf9, 0xff, 0xed, 0xff, 0xf1, 0xff, 0xfd, 0xff,
+      0xe, 0x0, 0xfd, 0xff, 0xe8, 0xff, 0xbb, 0xff, 0xf2, 0xff, 0xf5, 0xff,
+      0xf5, 0xff, 0x10, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xfc, 0xff, 0x3, 0x0, 0x5,
+      0x0, 0x2, 0x0, 0xf9, 0xff, 0xff, 0xff, 0x10, 0x0, 0x12, 0x0, 0x1c, 0x0,
+      0x17, 0x0, 0x0, 0x0, 0x24, 0x0, 0x2, 0x0, 0xd, 0x0, 0x2, 0x0, 0x10, 0x0,
+      0x5, 0x0, 0xfb, 0xff, 0xe, 0x0, 0xf7, 0xff, 0x3, 0x0, 0x1, 0x0, 0x2, 0x0,
+      0xf6, 0xff, 0x8, 0x0, 0xee, 0xff, 0xf7, 0xff, 0x2, 0x0, 0xf3, 0xff, 0x1,
+      0x0, 0xf2, 0xff, 0x6, 0x0, 0xf4, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0xfc, 0xff,
+      0x0, 0x0, 0xfa, 0xff, 0xfc, 0xff, 0x5, 0x0, 0x1, 0x0, 0xf6, 0xff, 0xfb,
+      0xff, 0xfb, 0xff, 0xfe, 0xff, 0x1, 0x0, 0xff, 0xff, 0xfc, 0xff, 0xa7,
+      0xff, 0x1f, 0x0, 0xfd, 0xff, 0x13, 0x0, 0x1b, 0x0, 0xff, 0xff, 0x1, 0x0,
+      0xed, 0xff, 0x12, 0x0, 0xf8, 0xff, 0xf9, 0xff, 0xe2, 0xff, 0xd, 0x0, 0xf9,
+      0xff, 0xe4, 0xff, 0x5, 0x0, 0x1d, 0x0, 0xf9, 0xff, 0xf3, 0xff, 0x5, 0x0,
+      0x17, 0x0, 0x1, 0x0, 0x5, 0x0, 0xf3, 0xff, 0xef, 0xff, 0xfd, 0xff, 0xfc,
+      0xff, 0x0, 0x0, 0xf8, 0xff, 0x1d, 0x0, 0xf, 0x0, 0x8, 0x0, 0xa, 0x0, 0x5,
+      0x0, 0x1, 0x0, 0xf1, 0xff, 0x3, 0x0, 0xf9, 0xff, 0x2, 0x0, 0xfb, 0xff,
+      0x1, 0x0, 0xf4, 0xff, 0xee, 0xff, 0x15, 0x0, 0xfe, 0xff, 0xfd, 0xff, 0xd,
+      0x0, 0x0, 0x0, 0x8, 0x0, 0x3, 0x0, 0xfe, 0xff, 0x2, 0x0, 0x2, 0x0, 0xff,
+      0xff, 0x8, 0x0, 0xff, 0xff, 0x6, 0x0, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+      0xf8, 0xff, 0x2, 0x0, 0xff, 0xff, 0xff, 0xff, 0xae, 0xff, 0x24, 0x0, 0xef,
+      0xff, 0xa, 0x0, 0x6, 0x0, 0xee, 0xff, 0xf7, 0xff, 0xc, 0x0, 0xd, 0x0,
+      0xec, 0xff, 0x9, 0x0, 0xf1, 0xff, 0xfc, 0xff, 0x7, 0x0, 0x6, 0x0, 0x0,
+      0x0, 0xf5, 0xff, 0x10, 0x0, 0x3, 0x0, 0xf2, 0xff, 0xf9, 0xff, 0xf4, 0xff,
+      0xf5, 0xff, 0x2, 0x0, 0x7, 0x0, 0xfc, 0xff, 0x2, 0x0, 0x5, 0x0, 0xff,
+      0xff, 0xfc, 0xff, 0xd, 0x0, 0xf0, 0xff, 0xb, 0x0, 0x4, 0x0, 0xf8, 0xff,
+      0x1b, 0x0, 0x1, 0x0, 0xfd, 0xff, 0x1, 0x0, 0xfe, 0xff, 0xf7, 0xff, 0xfb,
+      0xff, 0x0, 0x0, 0x2, 0x0, 0x3, 0x0, 0x0, 0x0, 0x9, 0x0, 0x2, 0x0, 0x19,
+      0x0, 0x4, 0x0, 0x0, 0x0, 0x8, 0x0, 0x3, 0x0, 0xfe, 0xff, 0xfc, 0xff, 0x5,
+      0x0, 0x1, 0x0, 0xff, 0xff, 0xf6, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xfc, 0xff,
+      0x3, 0x0, 0xc, 0x0, 0xa8, 0xff, 0x24, 0x0, 0xef, 0xff, 0xe4, 0xff, 0xeb,
+      0xff, 0xf0, 0xff, 0x4, 0x0, 0xf5, 0xff, 0xcf, 0xff, 0xb5, 0xff, 0xe8,
+      0xff, 0xed, 0xff, 0xfb, 0xff, 0x13, 0x0, 0xfe, 0xff, 0xf2, 0xff, 0xf0,
+      0xff, 0xf3, 0xff, 0x2, 0x0, 0xfb, 0xff, 0xf5, 0xff, 0x0, 0x0, 0xf, 0x0,
+      0xf, 0x0, 0x1b, 0x0, 0x7, 0x0, 0xf9, 0xff, 0xb, 0x0, 0x8, 0x0, 0xfe, 0xff,
+      0x0, 0x0, 0x5, 0x0, 0xc, 0x0, 0x5, 0x0, 0xf, 0x0, 0x9, 0x0, 0xff, 0xff,
+      0x3, 0x0, 0x1, 0x0, 0xfa, 0xff, 0x5, 0x0, 0xf1, 0xff, 0xfc, 0xff, 0x2,
+      0x0, 0xfe, 0xff, 0xfe, 0xff, 0x3, 0x0, 0xa, 0x0, 0xf9, 0xff, 0xf3, 0xff,
+      0xff, 0xff, 0x2, 0x0, 0x1, 0x0, 0xf9, 0xff, 0xfc, 0xff, 0xa, 0x0, 0x4,
+      0x0, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x2, 0x0, 0xfe, 0xff, 0x0, 0x0,
+      0xff, 0xff, 0xbb, 0xff, 0x39, 0x0, 0xff, 0xff, 0x11, 0x0, 0x19, 0x0, 0xfd,
+      0xff, 0xf7, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0x5, 0x0, 0x1, 0x0, 0xf6, 0xff,
+      0x5, 0x0, 0xfb, 0xff, 0xfa, 0xff, 0xfc, 0xff, 0x11, 0x0, 0x0, 0x0, 0xf5,
+      0xff, 0xfa, 0xff, 0x6, 0x0, 0xf7, 0xff, 0xf6, 0xff, 0xeb, 0xff, 0xe4,
+      0xff, 0xe5, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf4, 0xff, 0x9, 0x0, 0x8, 0x0,
+      0xff, 0xff, 0x9, 0x0, 0x2, 0x0, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe,
+      0xff, 0xfb, 0xff, 0x0, 0x0, 0x1, 0x0, 0xf4, 0xff, 0xf0, 0xff, 0x10, 0x0,
+      0x4, 0x0, 0xfd, 0xff, 0x9, 0x0, 0xfb, 0xff, 0xe, 0x0, 0xfe, 0xff, 0xfc,
+      0xff, 0xfd, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x8, 0x0, 0x1, 0x0, 0xd, 0x0,
+      0xfe, 0xff, 0xff, 0xff, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0,
+      0xbe, 0xff, 0x31, 0x0, 0xf0, 0xff, 0x1e, 0x0, 0x16, 0x0, 0xf1, 0xff, 0xf7,
+      0xff, 0xc, 0x0, 0xa, 0x0, 0x11, 0x0, 0xe, 0x0, 0x5, 0x0, 0xf7, 0xff, 0xfd,
+      0xff, 0xf, 0x0, 0x5, 0x0, 0x8, 0x0, 0xb, 0x0, 0xfb, 0xff, 0xed, 0xff,
+      0xf2, 0xff, 0xf4, 0xff, 0xea, 0xff, 0xfe, 0xff, 0xe8, 0xff, 0xef, 0xff,
+      0xd, 0x0, 0xf6, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xc, 0x0, 0xf4, 0xff, 0x5,
+      0x0, 0xfe, 0xff, 0xfc, 0xff, 0xd, 0x0, 0x1, 0x0, 0x1, 0x0, 0xfd, 0xff,
+      0xfe, 0xff, 0xfb, 0xff, 0xf9, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff,
+      0x3, 0x0, 0x2, 0x0, 0xfd, 0xff, 0xa, 0x0, 0x0, 0x0, 0xff, 0xff, 0x2, 0x0,
+      0x5, 0x0, 0xf8, 0xff, 0xfd, 0xff, 0x4, 0x0, 0x9, 0x0, 0x2, 0x0, 0xf8,
+      0xff, 0x2, 0x0, 0x3, 0x0, 0xfe, 0xff, 0x3, 0x0, 0x6, 0x0, 0xb6, 0xff,
+      0x31, 0x0, 0xf2, 0xff, 0xf1, 0xff, 0xf7, 0xff, 0xfc, 0xff, 0x1, 0x0, 0xee,
+      0xff, 0xdd, 0xff, 0xd2, 0xff, 0xe5, 0xff, 0x8, 0x0, 0x2, 0x0, 0x10, 0x0,
+      0xf2, 0xff, 0xec, 0xff, 0xea, 0xff, 0xf4, 0xff, 0x1, 0x0, 0x4, 0x0, 0xeb,
+      0xff, 0xa, 0x0, 0xfb, 0xff, 0x2, 0x0, 0xff, 0xff, 0xf3, 0xff, 0xf7, 0xff,
+      0xb, 0x0, 0x6, 0x0, 0xfc, 0xff, 0xfe, 0xff, 0x4, 0x0, 0xfd, 0xff, 0x0,
+      0x0, 0x7, 0x0, 0xfe, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0x3, 0x0, 0xf8, 0xff,
+      0x6, 0x0, 0xef, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xf5, 0xff, 0xfd, 0xff,
+      0xf1, 0xff, 0xa, 0x0, 0xf6, 0xff, 0xed, 0xff, 0xfe, 0xff, 0xf7, 0xff,
+      0xfb, 0xff, 0xf3, 0xff, 0xfd, 0xff, 0x4, 0x0, 0x9, 0x0, 0x1, 0x0, 0xfb,
+      0xff, 0xfe, 0xff, 0x5, 0x0, 0x1, 0x0, 0x1, 0x0, 0x4, 0x0, 0xc3, 0xff,
+      0x3d, 0x0, 0xf8, 0xff, 0x5, 0x0, 0x13, 0x0, 0xf7, 0xff, 0xf8, 0xff, 0xfe,
+      0xff, 0xfa, 0xff, 0x21, 0x0, 0x3, 0x0, 0xa, 0x0, 0x3, 0x0, 0x0, 0x0, 0xf5,
+      0xff, 0xf1, 0xff, 0x14, 0x0, 0x2, 0x0, 0xfd, 0xff, 0xf6, 0xff, 0xfa, 0xff,
+      0xf8, 0xff, 0xe1, 0xff, 0xf0, 0xff, 0xc6, 0xff, 0xea, 0xff, 0x3, 0x0,
+      0xee, 0xff, 0xf9, 0xff, 0x9, 0x0, 0x3, 0x0, 0xf7, 0xff, 0x7, 0x0, 0xfb,
+      0xff, 0xfc, 0xff, 0xed, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x1, 0x0, 0x5, 0x0,
+      0x1, 0x0, 0xf7, 0xff, 0xed, 0xff, 0xc, 0x0, 0xfc, 0xff, 0xfc, 0xff, 0xff,
+      0xff, 0xfd, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfa,
+      0xff, 0xfe, 0xff, 0xb, 0x0, 0xfc, 0xff, 0xb, 0x0, 0x1, 0x0, 0xf9, 0xff,
+      0x1, 0x0, 0xfc, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x0, 0x0, 0xc9, 0xff, 0x2c,
+      0x0, 0xfd, 0xff, 0x18, 0x0, 0x9, 0x0, 0xf4, 0xff, 0xfa, 0xff, 0x10, 0x0,
+      0x8, 0x0, 0x10, 0x0, 0xc, 0x0, 0x6, 0x0, 0xfa, 0xff, 0x5, 0x0, 0x10, 0x0,
+      0xe, 0x0, 0xf, 0x0, 0xd, 0x0, 0x7, 0x0, 0xf9, 0xff, 0xf0, 0xff, 0xec,
+      0xff, 0xfc, 0xff, 0x7, 0x0, 0xfe, 0xff, 0x9, 0x0, 0xd, 0x0, 0x8, 0x0, 0x4,
+      0x0, 0xfc, 0xff, 0xc, 0x0, 0xf3, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0x8, 0x0,
+      0x5, 0x0, 0x1, 0x0, 0x2, 0x0, 0x0, 0x0, 0xfb, 0xff, 0xfe, 0xff, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0xfe, 0xff, 0xfc, 0xff, 0xf4, 0xff, 0x4, 0x0, 0xf2,
+      0xff, 0xfe, 0xff, 0x5, 0x0, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xff, 0x1, 0x0,
+      0x5, 0x0, 0x5, 0x0, 0x3, 0x0, 0xf5, 0xff, 0x2, 0x0, 0x1, 0x0, 0xfe, 0xff,
+      0x1, 0x0, 0x7, 0x0, 0xc8, 0xff, 0x33, 0x0, 0xff, 0xff, 0xff, 0xff, 0xf1,
+      0xff, 0x3, 0x0, 0xfb, 0xff, 0xf1, 0xff, 0xea, 0xff, 0xf4, 0xff, 0xe7,
+      0xff, 0xb, 0x0, 0xf9, 0xff, 0x5, 0x0, 0xea, 0xff, 0x1, 0x0, 0xf7, 0xff,
+      0xea, 0xff, 0xfe, 0xff, 0x3, 0x0, 0xf0, 0xff, 0x6, 0x0, 0x5, 0x0, 0x4,
+      0x0, 0xc, 0x0, 0xd, 0x0, 0xf8, 0xff, 0x10, 0x0, 0x7, 0x0, 0x7, 0x0, 0x4,
+      0x0, 0x4, 0x0, 0x1, 0x0, 0x0, 0x0, 0x13, 0x0, 0x3, 0x0, 0xfd, 0xff, 0xfe,
+      0xff, 0xfd, 0xff, 0xfc, 0xff, 0xd, 0x0, 0xf9, 0xff, 0xfb, 0xff, 0xfc,
+      0xff, 0xf6, 0xff, 0x3, 0x0, 0xf7, 0xff, 0x6, 0x0, 0xee, 0xff, 0xfb, 0xff,
+      0xfe, 0xff, 0x3, 0x0, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x4, 0x0, 0x9,
+      0x0, 0xfe, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0x4, 0x0, 0x2, 0x0, 0xfe, 0xff,
+      0x0, 0x0, 0xd1, 0xff, 0x3f, 0x0, 0xf9, 0xff, 0xe, 0x0, 0x5, 0x0, 0xf4,
+      0xff, 0xf4, 0xff, 0xf8, 0xff, 0xff, 0xff, 0x2e, 0x0, 0xff, 0xff, 0xb, 0x0,
+      0xfd, 0xff, 0x3, 0x0, 0xfb, 0xff, 0xff, 0xff, 0x11, 0x0, 0x1, 0x0, 0x0,
+      0x0, 0xfd, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf6, 0xff, 0xf0, 0xff, 0xd8,
+      0xff, 0x2, 0x0, 0xfe, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0x1a, 0x0, 0xf, 0x0,
+      0xf9, 0xff, 0x8, 0x0, 0x5, 0x0, 0xfb, 0xff, 0xed, 0xff, 0x1, 0x0, 0xf7,
+      0xff, 0x0, 0x0, 0xc, 0x0, 0x0, 0x0, 0x5, 0x0, 0xf4, 0xff, 0xe, 0x0, 0xfc,
+      0xff, 0x1, 0x0, 0xfe, 0xff, 0xfb, 0xff, 0xf4, 0xff, 0x7, 0x0, 0x0, 0x0,
+      0x2, 0x0, 0xfe, 0xff, 0x6, 0x0, 0xb, 0x0, 0xff, 0xff, 0x9, 0x0, 0x1, 0x0,
+      0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0x2, 0x0, 0xf9, 0xff,
+      0xcc, 0xff, 0x2d, 0x0, 0xff, 0xff, 0x6, 0x0, 0xfb, 0xff, 0xfb, 0xff, 0xfc,
+      0xff, 0x10, 0x0, 0x9, 0x0, 0xfe, 0xff, 0x3, 0x0, 0xe, 0x0, 0xf6, 0xff,
+      0xe, 0x0, 0x12, 0x0, 0x12, 0x0, 0x1, 0x0, 0x4, 0x0, 0xb, 0x0, 0x1, 0x0,
+      0xf0, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xc, 0x0, 0x14, 0x0, 0x15, 0x0, 0x0,
+      0x0, 0x10, 0x0, 0x7, 0x0, 0x2, 0x0, 0x11, 0x0, 0xec, 0xff, 0xff, 0xff,
+      0x2, 0x0, 0xe, 0x0, 0xe, 0x0, 0x9, 0x0, 0x3, 0x0, 0x5, 0x0, 0x0, 0x0,
+      0xf3, 0xff, 0x3, 0x0, 0x8, 0x0, 0x1, 0x0, 0x2, 0x0, 0x0, 0x0, 0xf4, 0xff,
+      0xa, 0x0, 0x4, 0x0, 0x8, 0x0, 0x3, 0x0, 0x1, 0x0, 0x0, 0x0, 0xfd, 0xff,
+      0x2, 0x0, 0x9, 0x0, 0x4, 0x0, 0x4, 0x0, 0xff, 0xff, 0x2, 0x0, 0x2, 0x0,
+      0xfc, 0xff, 0x3, 0x0, 0x2, 0x0, 0xc9, 0xff, 0x2d, 0x0, 0x3, 0x0, 0xee,
+      0xff, 0xf4, 0xff, 0x9, 0x0, 0x2, 0x0, 0xec, 0xff, 0xfd, 0xff, 0xf5, 0xff,
+      0xeb, 0xff, 0x7, 0x0, 0x1, 0x0, 0x5, 0x0, 0xea, 0xff, 0xfc, 0xff, 0xed,
+      0xff, 0xf5, 0xff, 0xf4, 0xff, 0xc, 0x0, 0xf8, 0xff, 0x3, 0x0, 0x1, 0x0,
+      0x7, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfa, 0xff, 0x0, 0x0, 0x1, 0x0, 0xa, 0x0,
+      0x6, 0x0, 0xb, 0x0, 0xfa, 0xff, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+      0xfb, 0xff, 0xfc, 0xff, 0xfb, 0xff, 0xe, 0x0, 0xf7, 0xff, 0xf9, 0xff, 0x6,
+      0x0, 0x6, 0x0, 0x4, 0x0, 0x9, 0x0, 0x8, 0x0, 0x3, 0x0, 0xfe, 0xff, 0xff,
+      0xff, 0x7, 0x0, 0x1, 0x0, 0x2, 0x0, 0x2, 0x0, 0x3, 0x0, 0x7, 0x0, 0xfd,
+      0xff, 0x5, 0x0, 0xfa, 0xff, 0x1, 0x0, 0x2, 0x0, 0x1, 0x0, 0x0, 0x0, 0xd7,
+      0xff, 0x30, 0x0, 0xf6, 0xff, 0x11, 0x0, 0xe, 0x0, 0xec, 0xff, 0xfc, 0xff,
+      0xf8, 0xff, 0x26, 0x0, 0x29, 0x0, 0xa, 0x0, 0xb, 0x0, 0xe, 0x0, 0x5, 0x0,
+      0x2, 0x0, 0x4, 0x0, 0xfd, 0xff, 0x8, 0x0, 0x5, 0x0, 0x3, 0x0, 0x0, 0x0,
+      0xf8, 0xff, 0xfe, 0xff, 0xed, 0xff, 0xef, 0xff, 0x2, 0x0, 0xf5, 0xff, 0xb,
+      0x0, 0xf3, 0xff, 0xe, 0x0, 0xf, 0x0, 0xfc, 0xff, 0xfc, 0xff, 0xfb, 0xff,
+      0xef, 0xff, 0xf6, 0xff, 0x1, 0x0, 0xf3, 0xff, 0xfa, 0xff, 0x2, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0xf6, 0xff, 0xf, 0x0, 0xa, 0x0, 0x0, 0x0, 0xfe, 0xff, 0xfb,
+      0xff, 0x5, 0x0, 0x4, 0x0, 0xfe, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0x3, 0x0,
+      0x8, 0x0, 0xff, 0xff, 0x5, 0x0, 0xfe, 0xff, 0x1, 0x0, 0xfe, 0xff, 0xfc,
+      0xff, 0xfd, 0xff, 0x6, 0x0, 0xfd, 0xff, 0xcb, 0xff, 0x1a, 0x0, 0xfb, 0xff,
+      0x5, 0x0, 0xfb, 0xff, 0xf5, 0xff, 0x7, 0x0, 0x8, 0x0, 0x18, 0x0, 0xfe,
+      0xff, 0x5, 0x0, 0xb, 0x0, 0x1, 0x0, 0xa, 0x0, 0xf, 0x0, 0x14, 0x0, 0xf6,
+      0xff, 0xfb, 0xff, 0x8, 0x0, 0x0, 0x0, 0xf1, 0xff, 0x3, 0x0, 0x4, 0x0, 0x8,
+      0x0, 0x1e, 0x0, 0x14, 0x0, 0xfa, 0xff, 0xd, 0x0, 0xa, 0x0, 0xf9, 0xff,
+      0xb, 0x0, 0xee, 0xff, 0x0, 0x0, 0x7, 0x0, 0x14, 0x0, 0xa, 0x0, 0xa, 0x0,
+      0x9, 0x0, 0x3, 0x0, 0xfd, 0xff, 0xf0, 0xff, 0xfc, 0xff, 0x8, 0x0, 0xfe,
+      0xff, 0x7, 0x0, 0xfd, 0xff, 0x5, 0x0, 0x4, 0x0, 0x8, 0x0, 0x2, 0x0, 0x3,
+      0x0, 0x8, 0x0, 0x2, 0x0, 0xf6, 0xff, 0x0, 0x0, 0x7, 0x0, 0xff, 0xff, 0x3,
+      0x0, 0x5, 0x0, 0xfe, 0xff, 0x5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0xcc,
+      0xff, 0x26, 0x0, 0x7, 0x0, 0xef, 0xff, 0xfa, 0xff, 0x7, 0x0, 0x4, 0x0,
+      0xee, 0xff, 0x3, 0x0, 0xfe, 0xff, 0xf9, 0xff, 0xc, 0x0, 0x3, 0x0, 0x4,
+      0x0, 0xff, 0xff, 0xef, 0xff, 0xe7, 0xff, 0x4, 0x0, 0xf8, 0xff, 0xe, 0x0,
+      0xfe, 0xff, 0x5, 0x0, 0x7, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf7, 0xff, 0xfe,
+      0xff, 0x7, 0x0, 0xfe, 0xff, 0x7, 0x0, 0x4, 0x0, 0x11, 0x0, 0xfb, 0xff,
+      0x6, 0x0, 0xfb, 0xff, 0xf3, 0xff, 0xf3, 0xff, 0xfa, 0xff, 0xf9, 0xff, 0x2,
+      0x0, 0xa, 0x0, 0xf8, 0xff, 0xf7, 0xff, 0x5, 0x0, 0x7, 0x0, 0xfe, 0xff,
+      0x4, 0x0, 0xff, 0xff, 0x2, 0x0, 0xfa, 0xff, 0x0, 0x0, 0x2, 0x0, 0xfd,
+      0xff, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x4, 0x0, 0xfb, 0xff, 0x3, 0x0, 0xf8,
+      0xff, 0xfe, 0xff, 0x5, 0x0, 0x0, 0x0, 0xff, 0xff, 0xd7, 0xff, 0x24, 0x0,
+      0xf1, 0xff, 0xd, 0x0, 0x15, 0x0, 0xec, 0xff, 0xfd, 0xff, 0xf7, 0xff, 0x28,
+      0x0, 0x23, 0x0, 0xe, 0x0, 0xb, 0x0, 0x9, 0x0, 0x6, 0x0, 0x7, 0x0, 0x5,
+      0x0, 0xe, 0x0, 0xfe, 0xff, 0x9, 0x0, 0xf7, 0xff, 0x4, 0x0, 0xf8, 0xff,
+      0xff, 0xff, 0xf4, 0xff, 0x2, 0x0, 0x2, 0x0, 0xfd, 0xff, 0xa, 0x0, 0xf4,
+      0xff, 0xb, 0x0, 0x15, 0x0, 0xfa, 0xff, 0x3, 0x0, 0xf5, 0xff, 0xfc, 0xff,
+      0xf9, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0x8, 0x0, 0xf8, 0xff, 0x4,
+      0x0, 0xf8, 0xff, 0xb, 0x0, 0x3, 0x0, 0x1, 0x0, 0xf9, 0xff, 0xf9, 0xff,
+      0xfd, 0xff, 0x5, 0x0, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x0, 0x0, 0x5,
+      0x0, 0x1, 0x0, 0x1, 0x0, 0xfd, 0xff, 0x1, 0x0, 0xff, 0xff, 0xfa, 0xff,
+      0xf9, 0xff, 0x2, 0x0, 0xf6, 0xff, 0xcf, 0xff, 0x17, 0x0, 0xfc, 0xff, 0xff,
+      0xff, 0xfa, 0xff, 0x4, 0x0, 0x5, 0x0, 0xfc, 0xff, 0x12, 0x0, 0xe5, 0xff,
+      0x0, 0x0, 0x5, 0x0, 0x5, 0x0, 0xd, 0x0, 0xfc, 0xff, 0x11, 0x0, 0xfa, 0xff,
+      0xfa, 0xff, 0x0, 0x0, 0xfe, 0xff, 0xf4, 0xff, 0x8, 0x0, 0xf, 0x0, 0xa,
+      0x0, 0x29, 0x0, 0xff, 0xff, 0x3, 0x0, 0x3, 0x0, 0xa, 0x0, 0xf9, 0xff, 0xa,
+      0x0, 0xef, 0xff, 0xfc, 0xff, 0x6, 0x0, 0xc, 0x0, 0xd, 0x0, 0xfc, 0xff,
+      0xa, 0x0, 0x3, 0x0, 0xfc, 0xff, 0xf2, 0xff, 0xfa, 0xff, 0x2, 0x0, 0xfe,
+      0xff, 0xff, 0xff, 0x0, 0x0, 0x2, 0x0, 0x4, 0x0, 0x2, 0x0, 0xfe, 0xff, 0x4,
+      0x0, 0x7, 0x0, 0x4, 0x0, 0xf8, 0xff, 0xff, 0xff, 0x6, 0x0, 0xfc, 0xff,
+      0x3, 0x0, 0x4, 0x0, 0xfe, 0xff, 0x1, 0x0, 0xfe, 0xff, 0xfc, 0xff, 0x0,
+      0x0, 0xd4, 0xff, 0x24, 0x0, 0x4, 0x0, 0xfa, 0xff, 0xfe, 0xff, 0xc, 0x0,
+      0x4, 0x0, 0xf3, 0xff, 0x12, 0x0, 0xfd, 0xff, 0xfe, 0xff, 0x9, 0x0, 0x7,
+      0x0, 0x2, 0x0, 0xf8, 0xff, 0xf0, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xf7, 0xff,
+      0x3, 0x0, 0xff, 0xff, 0x6, 0x0, 0x4, 0x0, 0xfd, 0xff, 0xf8, 0xff, 0xeb,
+      0xff, 0x2, 0x0, 0xfd, 0xff, 0xfc, 0xff, 0x6, 0x0, 0x2, 0x0, 0xe, 0x0,
+      0xfe, 0xff, 0xfa, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xf6, 0xff, 0xfe, 0xff,
+      0xf8, 0xff, 0x1, 0x0, 0xc, 0x0, 0xf5, 0xff, 0xf1, 0xff, 0x5, 0x0, 0x3,
+      0x0, 0x4, 0x0, 0xfd, 0xff, 0x1, 0x0, 0xfa, 0xff, 0xfd, 0xff, 0x1, 0x0,
+      0x0, 0x0, 0x1, 0x0, 0x4, 0x0, 0x1, 0x0, 0xff, 0xff, 0x4, 0x0, 0xf9, 0xff,
+      0x2, 0x0, 0xfa, 0xff, 0xfe, 0xff, 0x0, 0x0, 0x1, 0x0, 0xf9, 0xff, 0xd5,
+      0xff, 0x17, 0x0, 0xf4, 0xff, 0x12, 0x0, 0xe, 0x0, 0xeb, 0xff, 0x8, 0x0,
+      0xf5, 0xff, 0x2a, 0x0, 0x13, 0x0, 0x6, 0x0, 0xfe, 0xff, 0x11, 0x0, 0x7,
+      0x0, 0x5, 0x0, 0xa, 0x0, 0x11, 0x0, 0xf4, 0xff, 0x6, 0x0, 0xf5, 0xff, 0x2,
+      0x0, 0xff, 0xff, 0x6, 0x0, 0xf6, 0xff, 0x4, 0x0, 0xfa, 0xff, 0xfd, 0xff,
+      0xff, 0xff, 0xf7, 0xff, 0x4, 0x0, 0xf, 0x0, 0xf6, 0xff, 0xff, 0xff, 0xf9,
+      0xff, 0xfb, 0xff, 0xfc, 0xff, 0x6, 0x0, 0xfb, 0xff, 0x2, 0x0, 0x1, 0x0,
+      0xf9, 0xff, 0x2, 0x0, 0xfa, 0xff, 0x8, 0x0, 0x3, 0x0, 0x0, 0x0, 0xfe,
+      0xff, 0xfe, 0xff, 0xfc, 0xff, 0x3, 0x0, 0x3, 0x0, 0x0, 0x0, 0x3, 0x0,
+      0xff, 0xff, 0x5, 0x0, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0x3, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0xfb, 0xff, 0x3, 0x0, 0xf8, 0xff, 0xd0, 0xff, 0x12, 0x0, 0x3,
+      0x0, 0xfc, 0xff, 0xf9, 0xff, 0x4, 0x0, 0x9, 0x0, 0x0, 0x0, 0xd, 0x0, 0xe0,
+      0xff, 0xfe, 0xff, 0x2, 0x0, 0x2, 0x0, 0xa, 0x0, 0x5, 0x0, 0x5, 0x0, 0xf5,
+      0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xef, 0xff, 0x9, 0x0, 0xc, 0x0,
+      0x7, 0x0, 0x1e, 0x0, 0xf9, 0xff, 0xfe, 0xff, 0x0, 0x0, 0x6, 0x0, 0xf5,
+      0xff, 0xfe, 0xff, 0xef, 0xff, 0xf8, 0xff, 0x8, 0x0, 0x7, 0x0, 0xd, 0x0,
+      0x0, 0x0, 0x7, 0x0, 0x4, 0x0, 0xfb, 0xff, 0xf8, 0xff, 0xf6, 0xff, 0x3,
+      0x0, 0xfa, 0xff, 0xfd, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x5, 0x0, 0xfb,
+      0xff, 0x3, 0x0, 0x2, 0x0, 0x2, 0x0, 0xf9, 0xff, 0xfe, 0xff, 0x4, 0x0, 0x0,
+      0x0, 0x3, 0x0, 0x7, 0x0, 0xfd, 0xff, 0x5, 0x0, 0x1, 0x0, 0xfc, 0xff, 0x6,
+      0x0, 0xd5, 0xff, 0x18, 0x0, 0x1, 0x0, 0xfa, 0xff, 0x5, 0x0, 0x4, 0x0, 0x6,
+      0x0, 0xf4, 0xff, 0x17, 0x0, 0x8, 0x0, 0x1, 0x0, 0x4, 0x0, 0x6, 0x0, 0xfd,
+      0xff, 0x3, 0x0, 0xec, 0xff, 0x1, 0x0, 0x2, 0x0, 0xf4, 0xff, 0xfa, 0xff,
+      0xfd, 0xff, 0x0, 0x0, 0xfe, 0xff, 0xff, 0xff, 0xe5, 0xff, 0xeb, 0xff, 0x4,
+      0x0, 0xf3, 0xff, 0xf9, 0xff, 0x8, 0x0, 0x0, 0x0, 0xd, 0x0, 0x1, 0x0, 0xfa,
+      0xff, 0xf8, 0xff, 0xef, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0x5,
+      0x0, 0xd, 0x0, 0xfb, 0xff, 0xf4, 0xff, 0x8, 0x0, 0x5, 0x0, 0x5, 0x0, 0x0,
+      0x0, 0xfe, 0xff, 0xf7, 0xff, 0xfe, 0xff, 0x0, 0x0, 0xfd, 0xff, 0x1, 0x0,
+      0x5, 0x0, 0x2, 0x0, 0xfe, 0xff, 0x8, 0x0, 0xfa, 0xff, 0x2, 0x0, 0xfe,
+      0xff, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0xfc, 0xff, 0xd6, 0xff, 0xe, 0x0,
+      0xf4, 0xff, 0x10, 0x0, 0xa, 0x0, 0xef, 0xff, 0x6, 0x0, 0xf6, 0xff, 0x26,
+      0x0, 0xfd, 0xff, 0x5, 0x0, 0xf9, 0xff, 0x13, 0x0, 0x5, 0x0, 0x4, 0x0, 0x8,
+      0x0, 0xd, 0x0, 0xfc, 0xff, 0x5, 0x0, 0xf7, 0xff, 0xfb, 0xff, 0xfe, 0xff,
+      0x6, 0x0, 0xf4, 0xff, 0x8, 0x0, 0x0, 0x0, 0xff, 0xff, 0x6, 0x0, 0xf9,
+      0xff, 0x4, 0x0, 0xa, 0x0, 0xf4, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfb, 0xff,
+      0x2, 0x0, 0x3, 0x0, 0xfd, 0xff, 0x5, 0x0, 0x1, 0x0, 0xf8, 0xff, 0x6, 0x0,
+      0x1, 0x0, 0x6, 0x0, 0x2, 0x0, 0x0, 0x0, 0xf7, 0xff, 0xff, 0xff, 0xfe,
+      0xff, 0x3, 0x0, 0x0, 0x0, 0xfc, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x3,
+      0x0, 0x2, 0x0, 0x1, 0x0, 0x1, 0x0, 0x5, 0x0, 0x0, 0x0, 0xfd, 0xff, 0x1,
+      0x0, 0x2, 0x0, 0xd0, 0xff, 0x11, 0x0, 0x3, 0x0, 0xf9, 0xff, 0xf3, 0xff,
+      0xa, 0x0, 0x7, 0x0, 0x0, 0x0, 0x7, 0x0, 0xda, 0xff, 0xff, 0xff, 0xfd,
+      0xff, 0xfd, 0xff, 0x1, 0x0, 0xfa, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xf7,
+      0xff, 0xfe, 0xff, 0xf6, 0xff, 0xec, 0xff, 0xa, 0x0, 0x2, 0x0, 0x7, 0x0,
+      0x8, 0x0, 0x2, 0x0, 0x4, 0x0, 0x1, 0x0, 0x7, 0x0, 0xfd, 0xff, 0xf9, 0xff,
+      0xf6, 0xff, 0xfa, 0xff, 0x5, 0x0, 0x7, 0x0, 0x7, 0x0, 0xff, 0xff, 0xd,
+      0x0, 0x5, 0x0, 0x0, 0x0, 0xfd, 0xff, 0xfd, 0xff, 0x3, 0x0, 0xfa, 0xff,
+      0xfa, 0xff, 0xff, 0xff, 0x1, 0x0, 0x3, 0x0, 0xfc, 0xff, 0xfe, 0xff, 0x1,
+      0x0, 0x5, 0x0, 0x2, 0x0, 0xfd, 0xff, 0xff, 0xff, 0x3, 0x0, 0x3, 0x0, 0x2,
+      0x0, 0x5, 0x0, 0x0, 0x0, 0x3, 0x0, 0x3, 0x0, 0xfb, 0xff, 0x7, 0x0, 0xd6,
+      0xff, 0x19, 0x0, 0x2, 0x0, 0x1, 0x0, 0x7, 0x0, 0x2, 0x0, 0x9, 0x0, 0xf7,
+      0xff, 0x1a, 0x0, 0x3, 0x0, 0x1, 0x0, 0xfa, 0xff, 0x7, 0x0, 0xfd, 0xff,
+      0x6, 0x0, 0xf3, 0xff, 0x4, 0x0, 0x3, 0x0, 0xfb, 0xff, 0xf5, 0xff, 0xfd,
+      0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xf6, 0xff, 0x1,
+      0x0, 0xfd, 0xff, 0xf8, 0xff, 0xe, 0x0, 0x0, 0x0, 0xf, 0x0, 0xfc, 0xff,
+      0xfa, 0xff, 0xf3, 0xff, 0xee, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfc, 0xff,
+      0x7, 0x0, 0xc, 0x0, 0x5, 0x0, 0xf4, 0xff, 0xa, 0x0, 0x6, 0x0, 0x0, 0x0,
+      0xff, 0xff, 0x1, 0x0, 0xf8, 0xff, 0x2, 0x0, 0x2, 0x0, 0xfd, 0xff, 0x0,
+      0x0, 0x7, 0x0, 0x4, 0x0, 0xff, 0xff, 0x9, 0x0, 0xfa, 0xff, 0x0, 0x0, 0x0,
+      0x0, 0xff, 0xff, 0x1, 0x0, 0x2, 0x0, 0xff, 0xff, 0xd4, 0xff, 0xc, 0x0,
+      0xf4, 0xff, 0xc, 0x0, 0x8, 0x0, 0xf2, 0xff, 0x9, 0x0, 0xfd, 0xff, 0x20,
+      0x0, 0xf4, 0xff, 0x3, 0x0, 0xf5, 0xff, 0xf, 0x0, 0x8, 0x0, 0x1, 0x0, 0xf,
+      0x0, 0xa, 0x0, 0xf5, 0xff, 0x9, 0x0, 0xf1, 0xff, 0xf7, 0xff, 0x0, 0x0,
+      0x2, 0x0, 0xf8, 0xff, 0x9, 0x0, 0x11, 0x0, 0xfb, 0xff, 0xe, 0x0, 0xfc,
+      0xff, 0x4, 0x0, 0x4, 0x0, 0xf0, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0x1, 0x0,
+      0xb, 0x0, 0xc, 0x0, 0x0, 0x0, 0x6, 0x0, 0x2, 0x0, 0xf6, 0xff, 0xa, 0x0,
+      0x3, 0x0, 0x3, 0x0, 0x1, 0x0, 0x0, 0x0, 0xfb, 0xff, 0x1, 0x0, 0x3, 0x0,
+      0x4, 0x0, 0x2, 0x0, 0x0, 0x0, 0x3, 0x0, 0xfd, 0xff, 0x2, 0x0, 0x5, 0x0,
+      0x3, 0x0, 0x1, 0x0, 0x5, 0x0, 0x3, 0x0, 0x4, 0x0, 0xfe, 0xff, 0x1, 0x0,
+      0x2, 0x0, 0xd0, 0xff, 0xb, 0x0, 0x7, 0x0, 0xf5, 0xff, 0xf1, 0xff, 0xe,
+      0x0, 0x9, 0x0, 0xfe, 0xff, 0x3, 0x0, 0xdd, 0xff, 0xfb, 0xff, 0xfc, 0xff,
+      0xfd, 0xff, 0x2, 0x0, 0xfb, 0xff, 0xfb, 0xff, 0xf3, 0xff, 0xfb, 0xff,
+      0xfc, 0xff, 0xf8, 0xff, 0xee, 0xff, 0x8, 0x0, 0x1, 0x0, 0x7, 0x0, 0xf9,
+      0xff, 0x2, 0x0, 0x2, 0x0, 0x0, 0x0, 0x5, 0x0, 0x2, 0x0, 0xf7, 0xff, 0xfe,
+      0xff, 0xf6, 0xff, 0x7, 0x0, 0x5, 0x0, 0x2, 0x0, 0x0, 0x0, 0x6, 0x0, 0x5,
+      0x0, 0x1, 0x0, 0x2, 0x0, 0xff, 0xff, 0x1, 0x0, 0xff, 0xff, 0xff, 0xff,
+      0x0, 0x0, 0x9, 0x0, 0x4, 0x0, 0x1, 0x0, 0xfb, 0xff, 0x2, 0x0, 0x5, 0x0,
+      0x2, 0x0, 0xfd, 0xff, 0xff, 0xff, 0x3, 0x0, 0x5, 0x0, 0x0, 0x0, 0x7, 0x0,
+      0xfe, 0xff, 0x4, 0x0, 0x4, 0x0, 0xfd, 0xff, 0x5, 0x0, 0xda, 0xff, 0x10,
+      0x0, 0xff, 0xff, 0x6, 0x0, 0x9, 0x0, 0xfb, 0xff, 0x5, 0x0, 0xf9, 0xff,
+      0x1e, 0x0, 0xa, 0x0, 0x1, 0x0, 0xfb, 0xff, 0x6, 0x0, 0xfd, 0xff, 0xa, 0x0,
+      0xf3, 0xff, 0x6, 0x0, 0x9, 0x0, 0xfc, 0xff, 0xf6, 0xff, 0xfd, 0xff, 0xfa,
+      0xff, 0xfa, 0xff, 0xf9, 0xff, 0xe2, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0x1,
+      0x0, 0xf5, 0xff, 0xf, 0x0, 0x4, 0x0, 0xd, 0x0, 0xfd, 0xff, 0xf9, 0xff,
+      0xf7, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0x6, 0x0, 0x8,
+      0x0, 0x6, 0x0, 0xf6, 0xff, 0xa, 0x0, 0x7, 0x0, 0x3, 0x0, 0xfe, 0xff, 0x1,
+      0x0, 0x0, 0x0, 0xfe, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0x4, 0x0,
+      0x1, 0x0, 0xff, 0xff, 0x9, 0x0, 0xf9, 0xff, 0x2, 0x0, 0xff, 0xff, 0x0,
+      0x0, 0x0, 0x0, 0x6, 0x0, 0xfd, 0xff, 0xd3, 0xff, 0xfe, 0xff, 0xf6, 0xff,
+      0x7, 0x0, 0xfe, 0xff, 0xf1, 0xff, 0x8, 0x0, 0xfb, 0xff, 0x15, 0x0, 0xee,
+      0xff, 0x0, 0x0, 0xf4, 0xff, 0xa, 0x0, 0x4, 0x0, 0xfa, 0xff, 0xc, 0x0, 0x7,
+      0x0, 0xf4, 0xff, 0x8, 0x0, 0xf5, 0xff, 0xf4, 0xff, 0x1, 0x0, 0x3, 0x0,
+      0xf9, 0xff, 0xc, 0x0, 0xf, 0x0, 0xff, 0xff, 0x9, 0x0, 0x1, 0x0, 0x1, 0x0,
+      0x3, 0x0, 0xf1, 0xff, 0xfb, 0xff, 0x2, 0x0, 0x7, 0x0, 0xd, 0x0, 0x7, 0x0,
+      0x4, 0x0, 0x4, 0x0, 0x0, 0x0, 0xf1, 0xff, 0x6, 0x0, 0x5, 0x0, 0x3, 0x0,
+      0x0, 0x0, 0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0x8, 0x0, 0xfd, 0xff, 0xff,
+      0xff, 0x1, 0x0, 0x2, 0x0, 0xfa, 0xff, 0xff, 0xff, 0x6, 0x0, 0x3, 0x0, 0x1,
+      0x0, 0x6, 0x0, 0x2, 0x0, 0x3, 0x0, 0xfe, 0xff, 0x2, 0x0, 0x1, 0x0, 0xd5,
+      0xff, 0x8, 0x0, 0xc, 0x0, 0xf6, 0xff, 0xf5, 0xff, 0xa, 0x0, 0x7, 0x0, 0x0,
+      0x0, 0xfe, 0xff, 0xe4, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0x0, 0x0,
+      0xfd, 0xff, 0xf5, 0xff, 0xf1, 0xff, 0x3, 0x0, 0xfd, 0xff, 0xfc, 0xff,
+      0xf0, 0xff, 0x6, 0x0, 0xfe, 0xff, 0x7, 0x0, 0xf7, 0xff, 0xff, 0xff, 0x1,
+      0x0, 0x1, 0x0, 0x3, 0x0, 0x4, 0x0, 0xf7, 0xff, 0x5, 0x0, 0xf8, 0xff, 0x8,
+      0x0, 0xfe, 0xff, 0x0, 0x0, 0xf6, 0xff, 0x4, 0x0, 0xfe, 0xff, 0x2, 0x0,
+      0x1, 0x0, 0xfe, 0xff, 0xfb, 0xff, 0x0, 0x0, 0xfe, 0xff, 0xfe, 0xff, 0x6,
+      0x0, 0x2, 0x0, 0x5, 0x0, 0xf8, 0xff, 0x0, 0x0, 0x1, 0x0, 0xfe, 0xff, 0xfe,
+      0xff, 0xfc, 0xff, 0x2, 0x0, 0x5, 0x0, 0xfd, 0xff, 0x4, 0x0, 0xfc, 0xff,
+      0x2, 0x0, 0x4, 0x0, 0x0, 0x0, 0x4, 0x0, 0xdc, 0xff, 0x9, 0x0, 0xfd, 0xff,
+      0xa, 0x0, 0xc, 0x0, 0xf3, 0xff, 0x7, 0x0, 0xfc, 0xff, 0x1a, 0x0, 0x11,
+      0x0, 0x2, 0x0, 0xf5, 0xff, 0x6, 0x0, 0x0, 0x0, 0x4, 0x0, 0xfb, 0xff, 0xc,
+      0x0, 0x4, 0x0, 0xff, 0xff, 0xf5, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xf8, 0xff,
+      0xf9, 0xff, 0xe9, 0xff, 0x2, 0x0, 0x0, 0x0, 0x2, 0x0, 0xf7, 0xff, 0xf,
+      0x0, 0x7, 0x0, 0x8, 0x0, 0xff, 0xff, 0xf7, 0xff, 0xfa, 0xff, 0xf6, 0xff,
+      0x1, 0x0, 0xfb, 0xff, 0xfb, 0xff, 0x6, 0x0, 0x2, 0x0, 0x9, 0x0, 0xf5,
+      0xff, 0xa, 0x0, 0x5, 0x0, 0x1, 0x0, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
+      0x0, 0x0, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0x2, 0x0, 0x1, 0x0, 0x2,
+      0x0, 0x6, 0x0, 0xfa, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+      0x5, 0x0, 0xfb, 0xff, 0xd4, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0x2, 0x0, 0xf9,
+      0xff, 0xf6, 0xff, 0x7, 0x0, 0xfd, 0xff, 0x9, 0x0, 0xe7, 0xff, 0xfe, 0xff,
+      0xf4, 0xff, 0x6, 0x0, 0x8, 0x0, 0xf6, 0xff, 0xc, 0x0, 0x0, 0x0, 0xf6,
+      0xff, 0x8, 0x0, 0xfc, 0xff, 0xf1, 0xff, 0x4, 0x0, 0x2, 0x0, 0xfb, 0xff,
+      0x13, 0x0, 0xd, 0x0, 0x0, 0x0, 0xa, 0x0, 0x4, 0x0, 0xfd, 0xff, 0x0, 0x0,
+      0xef, 0xff, 0xf8, 0xff, 0x1, 0x0, 0x7, 0x0, 0xe, 0x0, 0x4, 0x0, 0x4, 0x0,
+      0x4, 0x0, 0xff, 0xff, 0xf3, 0xff, 0x5, 0x0, 0x5, 0x0, 0xff, 0xff, 0xfe,
+      0xff, 0xfe, 0xff, 0x2, 0x0, 0x1, 0x0, 0x5, 0x0, 0xff, 0xff, 0x2, 0x0, 0x0,
+      0x0, 0x1, 0x0, 0xf9, 0xff, 0xfe, 0xff, 0x8, 0x0, 0x0, 0x0, 0x2, 0x0, 0x4,
+      0x0, 0x0, 0x0, 0x3, 0x0, 0xff, 0xff, 0xff, 0xff, 0x4, 0x0, 0xd7, 0xff,
+      0x8, 0x0, 0xb, 0x0, 0xf5, 0xff, 0xf9, 0xff, 0x7, 0x0, 0x5, 0x0, 0x0, 0x0,
+      0xfa, 0xff, 0xf3, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xf5, 0xff, 0xfe, 0xff,
+      0xff, 0xff, 0xf2, 0xff, 0xf6, 0xff, 0x6, 0x0, 0xf9, 0xff, 0xfc, 0xff,
+      0xf2, 0xff, 0x4, 0x0, 0xf9, 0xff, 0x6, 0x0, 0xf1, 0xff, 0xfc, 0xff, 0x2,
+      0x0, 0xfe, 0xff, 0x0, 0x0, 0x5, 0x0, 0xf8, 0xff, 0x8, 0x0, 0xfb, 0xff,
+      0x3, 0x0, 0xff, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0x0, 0x0, 0xfe, 0xff, 0x2,
+      0x0, 0x6, 0x0, 0xfd, 0xff, 0xf9, 0xff, 0x0, 0x0, 0xff, 0xff, 0x2, 0x0,
+      0x5, 0x0, 0x3, 0x0, 0xfc, 0xff, 0xfd, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xfd, 0xff, 0x3, 0x0, 0x5, 0x0, 0xfc, 0xff, 0x2, 0x0,
+      0xfc, 0xff, 0x1, 0x0, 0x2, 0x0, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0x2,
+      0x0, 0xfd, 0xff, 0xb, 0x0, 0xc, 0x0, 0xef, 0xff, 0x6, 0x0, 0xfa, 0xff,
+      0x18, 0x0, 0x11, 0x0, 0x1, 0x0, 0xf5, 0xff, 0x9, 0x0, 0x1, 0x0, 0x2, 0x0,
+      0x0, 0x0, 0xe, 0x0, 0x2, 0x0, 0x2, 0x0, 0xfa, 0xff, 0xfe, 0xff, 0xfb,
+      0xff, 0xfc, 0xff, 0xf8, 0xff, 0xf3, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x0,
+      0x0, 0xf7, 0xff, 0x9, 0x0, 0x9, 0x0, 0x3, 0x0, 0xff, 0xff, 0xf8, 0xff,
+      0xfd, 0xff, 0xf9, 0xff, 0x1, 0x0, 0xf9, 0xff, 0xfe, 0xff, 0x2, 0x0, 0xff,
+      0xff, 0x8, 0x0, 0xf9, 0xff, 0x9, 0x0, 0x6, 0x0, 0x2, 0x0, 0xfe, 0xff, 0x1,
+      0x0, 0xfe, 0xff, 0x2, 0x0, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff, 0x0, 0x0,
+      0x1, 0x0, 0x4, 0x0, 0x4, 0x0, 0xfc, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff,
+      0xff, 0xfd, 0xff, 0x5, 0x0, 0xfa, 0xff, 0xd5, 0xff, 0xfa, 0xff, 0xfe,
+      0xff, 0xfd, 0xff, 0xf9, 0xff, 0xfb, 0xff, 0x5, 0x0, 0x0, 0x0, 0x1, 0x0,
+      0xe6, 0xff, 0xff, 0xff, 0xfc, 0xff, 0x3, 0x0, 0x5, 0x0, 0xf7, 0xff, 0x8,
+      0x0, 0xfb, 0xff, 0xf8, 0xff, 0x6, 0x0, 0xff, 0xff, 0xf1, 0xff, 0x4, 0x0,
+      0x3, 0x0, 0xff, 0xff, 0x17, 0x0, 0x5, 0x0, 0xfe, 0xff, 0x6, 0x0, 0x4, 0x0,
+      0xfa, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xfc, 0xff, 0x4, 0x0, 0x8, 0x0, 0xf,
+      0x0, 0x1, 0x0, 0x5, 0x0, 0x3, 0x0, 0xfd, 0xff, 0xf5, 0xff, 0x0, 0x0, 0x5,
+      0x0, 0xfc, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2, 0x0, 0x4, 0x0,
+      0xfe, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7, 0xff, 0xfe, 0xff, 0x7,
+      0x0, 0x0, 0x0, 0x3, 0x0, 0x3, 0x0, 0xff, 0xff, 0x3, 0x0, 0xff, 0xff, 0xff,
+      0xff, 0x3, 0x0, 0xd8, 0xff, 0x5, 0x0, 0x9, 0x0, 0xf7, 0xff, 0x0, 0x0, 0x5,
+      0x0, 0x4, 0x0, 0xff, 0xff, 0xfa, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+      0xf8, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xfa, 0xff, 0x7, 0x0,
+      0xf8, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x0, 0x0, 0xfc, 0xff, 0x7, 0x0, 0xef,
+      0xff, 0xf5, 0xff, 0x1, 0x0, 0xfa, 0xff, 0xfe, 0xff, 0x7, 0x0, 0xfd, 0xff,
+      0xc, 0x0, 0xfe, 0xff, 0x3, 0x0, 0xfe, 0xff, 0xf5, 0xff, 0xf8, 0xff, 0xff,
+      0xff, 0xfc, 0xff, 0x1, 0x0, 0xa, 0x0, 0xfc, 0xff, 0xf6, 0xff, 0x4, 0x0,
+      0x0, 0x0, 0x1, 0x0, 0x4, 0x0, 0x1, 0x0, 0xf9, 0xff, 0xfd, 0xff, 0xfe,
+      0xff, 0xff, 0xff, 0xfe, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x4, 0x0,
+      0xfc, 0xff, 0xff, 0xff, 0xfc, 0xff, 0x0, 0x0, 0x2, 0x0, 0xff, 0xff, 0xfe,
+      0xff, 0xdc, 0xff, 0x1, 0x0, 0xfa, 0xff, 0xe, 0x0, 0xd, 0x0, 0xf0, 0xff,
+      0x4, 0x0, 0xfd, 0xff, 0x16, 0x0, 0xe, 0x0, 0x2, 0x0, 0xf9, 0xff, 0xa, 0x0,
+      0x2, 0x0, 0x2, 0x0, 0x6, 0x0, 0xb, 0x0, 0x1, 0x0, 0x6, 0x0, 0xfd, 0xff,
+      0xff, 0xff, 0xfa, 0xff, 0x0, 0x0, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0x4, 0x0, 0xfa, 0xff, 0x6, 0x0, 0xb, 0x0, 0xfc, 0xff, 0x1,
+      0x0, 0xf8, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x0, 0x0, 0xf9, 0xff, 0xff, 0xff,
+      0x2, 0x0, 0xfd, 0xff, 0x6, 0x0, 0xfc, 0xff, 0x7, 0x0, 0x4, 0x0, 0x0, 0x0,
+      0xfa, 0xff, 0x0, 0x0, 0xff, 0xff, 0x3, 0x0, 0xff, 0xff, 0xfb, 0xff, 0xfe,
+      0xff, 0xfe, 0xff, 0x2, 0x0, 0x3, 0x0, 0x1, 0x0, 0xff, 0xff, 0xfd, 0xff,
+      0x1, 0x0, 0xff, 0xff, 0xfd, 0xff, 0x3, 0x0, 0xfe, 0xff, 0xd4, 0xff, 0xfc,
+      0xff, 0xff, 0xff, 0xf9, 0xff, 0xf6, 0xff, 0x1, 0x0, 0x5, 0x0, 0x1, 0x0,
+      0xf8, 0xff, 0xe8, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x0, 0x0, 0x3, 0x0, 0xf5,
+      0xff, 0x5, 0x0, 0xfa, 0xff, 0xf9, 0xff, 0x3, 0x0, 0xff, 0xff, 0xf2, 0xff,
+      0x5, 0x0, 0x4, 0x0, 0x4, 0x0, 0x12, 0x0, 0x5, 0x0, 0xff, 0xff, 0x4, 0x0,
+      0x7, 0x0, 0xfa, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0x5, 0x0, 0x8,
+      0x0, 0xa, 0x0, 0x1, 0x0, 0x5, 0x0, 0x2, 0x0, 0xff, 0xff, 0xf9, 0xff, 0xfc,
+      0xff, 0x5, 0x0, 0xfc, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0x1, 0x0, 0x0, 0x0,
+      0xfe, 0xff, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0, 0x2, 0x0, 0xf9, 0xff, 0xfe,
+      0xff, 0x5, 0x0, 0xff, 0xff, 0x4, 0x0, 0x1, 0x0, 0xfe, 0xff, 0x2, 0x0, 0x0,
+      0x0, 0xfb, 0xff, 0x3, 0x0, 0xda, 0xff, 0x7, 0x0, 0x7, 0x0, 0xfb, 0xff,
+      0x3, 0x0, 0x5, 0x0, 0x0, 0x0, 0xfe, 0xff, 0xfb, 0xff, 0x6, 0x0, 0x0, 0x0,
+      0x1, 0x0, 0xfa, 0xff, 0xfd, 0xff, 0x3, 0x0, 0xf2, 0xff, 0xfc, 0xff, 0xa,
+      0x0, 0xfa, 0xff, 0x0, 0x0, 0xfc, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x4, 0x0,
+      0xed, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfc, 0xff, 0x8, 0x0, 0x0,
+      0x0, 0xc, 0x0, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf4, 0xff, 0xf8, 0xff,
+      0xfb, 0xff, 0xfc, 0xff, 0x2, 0x0, 0xa, 0x0, 0xfd, 0xff, 0xf6, 0xff, 0x5,
+      0x0, 0x1, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0xf9, 0xff, 0x1, 0x0, 0x0,
+      0x0, 0xff, 0xff, 0xff, 0xff, 0x3, 0x0, 0x0, 0x0, 0xff, 0xff, 0x3, 0x0,
+      0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0x0, 0x0, 0xff, 0xff,
+      0xfd, 0xff, 0xdc, 0xff, 0xfe, 0xff, 0xf7, 0xff, 0xc, 0x0, 0xa, 0x0, 0xf0,
+      0xff, 0x0, 0x0, 0xfd, 0xff, 0xe, 0x0, 0xc, 0x0, 0x2, 0x0, 0xfc, 0xff, 0x9,
+      0x0, 0x2, 0x0, 0xff, 0xff, 0x9, 0x0, 0xd, 0x0, 0xfd, 0xff, 0x8, 0x0, 0xfc,
+      0xff, 0x0, 0x0, 0xfc, 0xff, 0x1, 0x0, 0xfa, 0xff, 0x5, 0x0, 0x4, 0x0,
+      0xfa, 0xff, 0x4, 0x0, 0xfc, 0xff, 0x3, 0x0, 0xb, 0x0, 0xf8, 0xff, 0x2,
+      0x0, 0xfa, 0xff, 0x1, 0x0, 0x2, 0x0, 0x5, 0x0, 0xfc, 0xff, 0x0, 0x0, 0x1,
+      0x0, 0xfa, 0xff, 0x4, 0x0, 0x0, 0x0, 0x5, 0x0, 0x1, 0x0, 0x0, 0x0, 0xfa,
+      0xff, 0xfe, 0xff, 0xfe, 0xff, 0x4, 0x0, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0,
+      0xff, 0xff, 0x1, 0x0, 0x3, 0x0, 0xff, 0xff, 0x1, 0x0, 0xfe, 0xff, 0x0,
+      0x0, 0xff, 0xff, 0xfb, 0xff, 0x2, 0x0, 0xfd, 0xff, 0xd5, 0xff, 0xfb, 0xff,
+      0x2, 0x0, 0xf7, 0xff, 0xf3, 0xff, 0x6, 0x0, 0x2, 0x0, 0xff, 0xff, 0xf3,
+      0xff, 0xe9, 0xff, 0xfd, 0xff, 0x0, 0x0, 0xff, 0xff, 0x3, 0x0, 0xf6, 0xff,
+      0x1, 0x0, 0xf7, 0xff, 0xfb, 0xff, 0x2, 0x0, 0x1, 0x0, 0xf5, 0xff, 0x5,
+      0x0, 0x6, 0x0, 0x5, 0x0, 0xd, 0x0, 0x0, 0x0, 0xff, 0xff, 0x1, 0x0, 0x7,
+      0x0, 0xf9, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0x7, 0x0, 0x5, 0x0,
+      0x8, 0x0, 0x0, 0x0, 0x6, 0x0, 0x2, 0x0, 0xfd, 0xff, 0xfc, 0xff, 0xfa,
+      0xff, 0x3, 0x0, 0xfe, 0xff, 0xfa, 0xff, 0xfe, 0xff, 0x2, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0xfe, 0xff, 0x2, 0x0, 0x4, 0x0, 0x3, 0x0, 0xfb, 0xff, 0xfe,
+      0xff, 0x4, 0x0, 0xfe, 0xff, 0x3, 0x0, 0x1, 0x0, 0xfd, 0xff, 0x2, 0x0,
+      0xff, 0xff, 0xfc, 0xff, 0x3, 0x0, 0xdd, 0xff, 0x7, 0x0, 0x3, 0x0, 0x0,
+      0x0, 0x7, 0x0, 0x2, 0x0, 0xff, 0xff, 0xfd, 0xff, 0x1, 0x0, 0xd, 0x0, 0x0,
+      0x0, 0x2, 0x0, 0xfe, 0xff, 0xfc, 0xff, 0x7, 0x0, 0xf3, 0xff, 0x0, 0x0,
+      0x9, 0x0, 0xfc, 0xff, 0xfe, 0xff, 0x1, 0x0, 0xfd, 0xff, 0xff, 0xff, 0x1,
+      0x0, 0xec, 0xff, 0xf5, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0x6, 0x0,
+      0x2, 0x0, 0xb, 0x0, 0x1, 0x0, 0xfc, 0xff, 0xf9, 0xff, 0xf4, 0xff, 0xfc,
+      0xff, 0xfc, 0xff, 0xfd, 0xff, 0x2, 0x0, 0xa, 0x0, 0xfd, 0xff, 0xf5, 0xff,
+      0x6, 0x0, 0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0xfb, 0xff, 0x0, 0x0,
+      0x0, 0x0, 0xfe, 0xff, 0x0, 0x0, 0x4, 0x0, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0,
+      0xfc, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x2, 0x0,
+      0xfd, 0xff, 0xda, 0xff, 0xfc, 0xff, 0xf7, 0xff, 0x9, 0x0, 0x5, 0x0, 0xf3,
+      0xff, 0x2, 0x0, 0xfd, 0xff, 0xd, 0x0, 0x5, 0x0, 0x0, 0x0, 0xfc, 0xff, 0xd,
+      0x0, 0x4, 0x0, 0xff, 0xff, 0xa, 0x0, 0xa, 0x0, 0xf8, 0xff, 0x7, 0x0, 0xfb,
+      0xff, 0xff, 0xff, 0xfe, 0xff, 0x5, 0x0, 0xf9, 0xff, 0x9, 0x0, 0x6, 0x0,
+      0xfd, 0xff, 0x3, 0x0, 0xfe, 0xff, 0xfd, 0xff, 0x8, 0x0, 0xf5, 0xff, 0x0,
+      0x0, 0xfc, 0xff, 0x2, 0x0, 0x5, 0x0, 0x6, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0,
+      0x0, 0xf9, 0xff, 0x4, 0x0, 0x2, 0x0, 0x4, 0x0, 0xff, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0x0, 0x0, 0x1, 0x0, 0x2, 0x0, 0x1, 0x0, 0x0, 0x0, 0x2, 0x0,
+      0xfe, 0xff, 0x1, 0x0, 0x5, 0x0, 0xfc, 0xff, 0x3, 0x0, 0xff, 0xff, 0x2,
+      0x0, 0xff, 0xff, 0xfd, 0xff, 0x2, 0x0, 0xff, 0xff, 0xd6, 0xff, 0xff, 0xff,
+      0x4, 0x0, 0xf6, 0xff, 0xf4, 0xff, 0x9, 0x0, 0x1, 0x0, 0x1, 0x0, 0xf2,
+      0xff, 0xeb, 0xff, 0xfd, 0xff, 0x2, 0x0, 0xfe, 0xff, 0x1, 0x0, 0xfc, 0xff,
+      0xfc, 0xff, 0xf5, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf7, 0xff,
+      0x5, 0x0, 0x5, 0x0, 0x4, 0x0, 0x8, 0x0, 0xfe, 0xff, 0x2, 0x0, 0xff, 0xff,
+      0x5, 0x0, 0xf9, 0xff, 0xfa, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0x5, 0x0, 0x2,
+      0x0, 0x6, 0x0, 0xfd, 0xff, 0x6, 0x0, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0xfa,
+      0xff, 0x0, 0x0, 0xfe, 0xff, 0xf8, 0xff, 0xff, 0xff, 0x1, 0x0, 0x2, 0x0,
+      0x1, 0x0, 0xfd, 0xff, 0x1, 0x0, 0x4, 0x0, 0x1, 0x0, 0xfd, 0xff, 0xfe,
+      0xff, 0x3, 0x0, 0xfd, 0xff, 0x2, 0x0, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0, 0x2,
+      0x0, 0xfd, 0xff, 0x3, 0x0, 0xde, 0xff, 0x6, 0x0, 0x1, 0x0, 0x4, 0x0, 0x9,
+      0x0, 0xfe, 0xff, 0x0, 0x0, 0xfc, 0xff, 0x3, 0x0, 0x12, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x1, 0x0, 0xfd, 0xff, 0x6, 0x0, 0xf6, 0xff, 0x6, 0x0, 0x6, 0x0, 0xfd,
+      0xff, 0xfa, 0xff, 0x3, 0x0, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xec,
+      0xff, 0xf9, 0xff, 0x2, 0x0, 0xfa, 0xff, 0xfa, 0xff, 0x5, 0x0, 0x3, 0x0,
+      0xa, 0x0, 0x1, 0x0, 0xfa, 0xff, 0xfa, 0xff, 0xf5, 0xff, 0xfd, 0xff, 0xfc,
+      0xff, 0xfd, 0xff, 0x3, 0x0, 0x8, 0x0, 0x0, 0x0, 0xf4, 0xff, 0x7, 0x0, 0x0,
+      0x0, 0x1, 0x0, 0xfe, 0xff, 0x1, 0x0, 0xfb, 0xff, 0x1, 0x0, 0xff, 0xff,
+      0xfe, 0xff, 0x0, 0x0, 0x5, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfd, 0xff,
+      0xfe, 0xff, 0x0, 0x0, 0xfe, 0xff, 0x0, 0x0, 0x2, 0x0, 0xfb, 0xff, 0xda,
+      0xff, 0xfc, 0xff, 0xf8, 0xff, 0x8, 0x0, 0x1, 0x0, 0xf6, 0xff, 0x1, 0x0,
+      0xfe, 0xff, 0x6, 0x0, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xb, 0x0, 0x5,
+      0x0, 0xfc, 0xff, 0xa, 0x0, 0x7, 0x0, 0xf8, 0xff, 0x8, 0x0, 0xfc, 0xff,
+      0xff, 0xff, 0x1, 0x0, 0x6, 0x0, 0xfa, 0xff, 0xe, 0x0, 0x7, 0x0, 0xfe,
+      0xff, 0x4, 0x0, 0x0, 0x0, 0xfa, 0xff, 0x5, 0x0, 0xf4, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0x3, 0x0, 0xa, 0x0, 0x4, 0x0, 0x1, 0x0, 0x3, 0x0, 0xff, 0xff,
+      0xf7, 0xff, 0x3, 0x0, 0x3, 0x0, 0x2, 0x0, 0xfc, 0xff, 0xff, 0xff, 0xfb,
+      0xff, 0x1, 0x0, 0x3, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0xfd,
+      0xff, 0x0, 0x0, 0x5, 0x0, 0xfb, 0xff, 0x4, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1,
+      0x0, 0xfe, 0xff, 0x1, 0x0, 0x1, 0x0, 0xd8, 0xff, 0x0, 0x0, 0x4, 0x0, 0xf6,
+      0xff, 0xf6, 0xff, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf0, 0xff, 0xf1, 0xff,
+      0xfe, 0xff, 0x3, 0x0, 0xfb, 0xff, 0x0, 0x0, 0xfd, 0xff, 0xf8, 0xff, 0xf6,
+      0xff, 0x1, 0x0, 0xfd, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0x4, 0x0, 0x3, 0x0,
+      0x5, 0x0, 0x1, 0x0, 0xfe, 0xff, 0x2, 0x0, 0xfe, 0xff, 0x4, 0x0, 0xfb,
+      0xff, 0xfa, 0xff, 0x2, 0x0, 0xfe, 0xff, 0x5, 0x0, 0x2, 0x0, 0x1, 0x0,
+      0xfd, 0xff, 0x4, 0x0, 0x0, 0x0, 0xff, 0xff, 0x3, 0x0, 0xfa, 0xff, 0xfe,
+      0xff, 0xff, 0xff, 0xf9, 0xff, 0x1, 0x0, 0x2, 0x0, 0x2, 0x0, 0xfe, 0xff,
+      0xfd, 0xff, 0x0, 0x0, 0x3, 0x0, 0x1, 0x0, 0xff, 0xff, 0xfe, 0xff, 0x2,
+      0x0, 0xfe, 0xff, 0x0, 0x0, 0x1, 0x0, 0xfe, 0xff, 0x2, 0x0, 0x2, 0x0, 0xfe,
+      0xff, 0x1, 0x0, 0xdf, 0xff, 0x4, 0x0, 0xff, 0xff, 0x7, 0x0, 0xa, 0x0,
+      0xfb, 0xff, 0x0, 0x0, 0xfc, 0xff, 0x7, 0x0, 0x12, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x4, 0x0, 0xff, 0xff, 0x6, 0x0, 0xf9, 0xff, 0x7, 0x0, 0x4, 0x0, 0x0, 0x0,
+      0xfc, 0xff, 0x5, 0x0, 0xfb, 0xff, 0x0, 0x0, 0xfd, 0xff, 0xef, 0xff, 0xfa,
+      0xff, 0xff, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0x3, 0x0, 0x5, 0x0, 0x7, 0x0,
+      0x0, 0x0, 0xfb, 0xff, 0xfc, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xfa, 0xff,
+      0xfe, 0xff, 0x2, 0x0, 0x5, 0x0, 0x2, 0x0, 0xf7, 0xff, 0x7, 0x0, 0x1, 0x0,
+      0x1, 0x0, 0xfe, 0xff, 0x1, 0x0, 0xfd, 0xff, 0x1, 0x0, 0xff, 0xff, 0xfd,
+      0xff, 0xfe, 0xff, 0x4, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfd, 0xff,
+      0xfe, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x3, 0x0, 0xfc, 0xff, 0xda,
+      0xff, 0xfb, 0xff, 0xf9, 0xff, 0x4, 0x0, 0xfe, 0xff, 0xf8, 0xff, 0x1, 0x0,
+      0x0, 0x0, 0x3, 0x0, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8, 0x0, 0x4,
+      0x0, 0xfc, 0xff, 0xa, 0x0, 0x3, 0x0, 0xf8, 0xff, 0x6, 0x0, 0xfd, 0xff,
+      0xfd, 0xff, 0x2, 0x0, 0x5, 0x0, 0xfc, 0xff, 0x10, 0x0, 0x8, 0x0, 0xfd,
+      0xff, 0x5, 0x0, 0x2, 0x0, 0xf7, 0xff, 0x3, 0x0, 0xf4, 0xff, 0x0, 0x0, 0x0,
+      0x0, 0x5, 0x0, 0xa, 0x0, 0x5, 0x0, 0x2, 0x0, 0x3, 0x0, 0xff, 0xff, 0xf7,
+      0xff, 0x1, 0x0, 0x5, 0x0, 0xff, 0xff, 0xfb, 0xff, 0x0, 0x0, 0xfd, 0xff,
+      0x1, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0xfc, 0xff,
+      0x0, 0x0, 0x4, 0x0, 0xfc, 0xff, 0x4, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0,
+      0xff, 0xff, 0x0, 0x0, 0x2, 0x0, 0xd9, 0xff, 0x1, 0x0, 0x5, 0x0, 0xf6,
+      0xff, 0xf8, 0xff, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf2, 0xff, 0xf5, 0xff,
+      0xfe, 0xff, 0x3, 0x0, 0xfa, 0xff, 0x0, 0x0, 0xff, 0xff, 0xf6, 0xff, 0xf7,
+      0xff, 0x3, 0x0, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xff, 0x2, 0x0, 0x3, 0x0,
+      0x5, 0x0, 0xfb, 0xff, 0xfb, 0xff, 0x2, 0x0, 0xfc, 0xff, 0x2, 0x0, 0xfc,
+      0xff, 0xfb, 0xff, 0x6, 0x0, 0xff, 0xff, 0x4, 0x0, 0x1, 0x0, 0xfd, 0xff,
+      0xfb, 0xff, 0x3, 0x0, 0xff, 0xff, 0x0, 0x0, 0x5, 0x0, 0xfb, 0xff, 0xfd,
+      0xff, 0x0, 0x0, 0xfb, 0xff, 0x1, 0x0, 0x3, 0x0, 0x1, 0x0, 0xfd, 0xff,
+      0xfd, 0xff, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0,
+      0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xfe, 0xff, 0x1, 0x0, 0x2, 0x0,
+      0xfe, 0xff, 0x0, 0x0, 0xe0, 0xff, 0x3, 0x0, 0xfd, 0xff, 0x9, 0x0, 0xb,
+      0x0, 0xf8, 0xff, 0xff, 0xff, 0xfd, 0xff, 0x9, 0x0, 0x11, 0x0, 0x0, 0x0,
+      0x1, 0x0, 0x4, 0x0, 0x0, 0x0, 0x6, 0x0, 0xfe, 0xff, 0x8, 0x0, 0x2, 0x0,
+      0x2, 0x0, 0xfc, 0xff, 0x4, 0x0, 0xfb, 0xff, 0x0, 0x0, 0xfc, 0xff, 0xf5,
+      0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf9, 0xff, 0x3, 0x0, 0x7, 0x0,
+      0x4, 0x0, 0x2, 0x0, 0xfa, 0xff, 0xfc, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xfa,
+      0xff, 0xfe, 0xff, 0x2, 0x0, 0x2, 0x0, 0x4, 0x0, 0xfa, 0xff, 0x6, 0x0, 0x1,
+      0x0, 0x1, 0x0, 0xfd, 0xff, 0x0, 0x0, 0xfe, 0xff, 0x1, 0x0, 0xff, 0xff,
+      0xfd, 0xff, 0xfe, 0xff, 0x3, 0x0, 0x2, 0x0, 0xff, 0xff, 0xff, 0xff, 0xfe,
+      0xff, 0xfe, 0xff, 0x0, 0x0, 0xfe, 0xff, 0xfe, 0xff, 0x3, 0x0, 0xfd, 0xff,
+      0xda, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0x2, 0x0, 0xfa, 0xff, 0xfc, 0xff, 0x0,
+      0x0, 0x0, 0x0, 0xfe, 0xff, 0xf4, 0xff, 0xff, 0xff, 0x0, 0x0, 0x5, 0x0,
+      0x5, 0x0, 0xf9, 0xff, 0x8, 0x0, 0x1, 0x0, 0xf7, 0xff, 0x5, 0x0, 0xff,
+      0xff, 0xfb, 0xff, 0x3, 0x0, 0x5, 0x0, 0xff, 0xff, 0xf, 0x0, 0x8, 0x0,
+      0xff, 0xff, 0x5, 0x0, 0x3, 0x0, 0xf8, 0xff, 0x1, 0x0, 0xf5, 0xff, 0x0,
+      0x0, 0x3, 0x0, 0x5, 0x0, 0xa, 0x0, 0x3, 0x0, 0x4, 0x0, 0x2, 0x0, 0xff,
+      0xff, 0xf7, 0xff, 0x1, 0x0, 0x7, 0x0, 0xfe, 0xff, 0xfb, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0x0, 0x0, 0x2, 0x0, 0xff, 0xff, 0x1, 0x0, 0x2, 0x0, 0x1, 0x0,
+      0xfb, 0xff, 0x0, 0x0, 0x3, 0x0, 0xfc, 0xff, 0x3, 0x0, 0x1, 0x0, 0x0, 0x0,
+      0x2, 0x0, 0xff, 0xff, 0xff, 0xff, 0x2, 0x0, 0xdc, 0xff, 0x3, 0x0, 0x5,
+      0x0, 0xf9, 0xff, 0xfc, 0xff, 0x9, 0x0, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff,
+      0xfa, 0xff, 0xff, 0xff, 0x3, 0x0, 0xf9, 0xff, 0xff, 0xff, 0x1, 0x0, 0xf6,
+      0xff, 0xf8, 0xff, 0x5, 0x0, 0xfc, 0xff, 0x0, 0x0, 0xfd, 0xff, 0x0, 0x0,
+      0x1, 0x0, 0x4, 0x0, 0xf7, 0xff, 0xf9, 0xff, 0x1, 0x0, 0xfc, 0xff, 0x0,
+      0x0, 0x0, 0x0, 0xfc, 0xff, 0x8, 0x0, 0x0, 0x0, 0x2, 0x0, 0xfe, 0xff, 0xfb,
+      0xff, 0xfa, 0xff, 0x1, 0x0, 0xfe, 0xff, 0x0, 0x0, 0x6, 0x0, 0xfc, 0xff,
+      0xfc, 0xff, 0x1, 0x0, 0xfd, 0xff, 0x1, 0x0, 0x2, 0x0, 0x1, 0x0, 0xfd,
+      0xff, 0xfe, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff,
+      0xfe, 0xff, 0x0, 0x0, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x0, 0x0, 0x1,
+      0x0, 0xff, 0xff, 0x0, 0x0, 0xe1, 0xff, 0x2, 0x0, 0xfa, 0xff, 0xa, 0x0,
+      0xb, 0x0, 0xf6, 0xff, 0x0, 0x0, 0xfd, 0xff, 0xa, 0x0, 0xe, 0x0, 0x0, 0x0,
+      0xff, 0xff, 0x6, 0x0, 0x1, 0x0, 0x3, 0x0, 0x2, 0x0, 0xa, 0x0, 0xff, 0xff,
+      0x3, 0x0, 0xfd, 0xff, 0x3, 0x0, 0xfb, 0xff, 0x0, 0x0, 0xfb, 0xff, 0xf9,
+      0xff, 0x1, 0x0, 0xfd, 0xff, 0x1, 0x0, 0xfb, 0xff, 0x3, 0x0, 0x8, 0x0, 0x0,
+      0x0, 0x2, 0x0, 0xfa, 0xff, 0xfd, 0xff, 0xfc, 0xff, 0x1, 0x0, 0xfc, 0xff,
+      0xff, 0xff, 0x1, 0x0, 0xff, 0xff, 0x4, 0x0, 0xfe, 0xff, 0x5, 0x0, 0x2,
+      0x0, 0x0, 0x0, 0xfd, 0xff, 0x0, 0x0, 0xfe, 0xff, 0x2, 0x0, 0xff, 0xff,
+      0xfd, 0xff, 0xff, 0xff, 0x2, 0x0, 0x2, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xfe, 0xff, 0x0, 0x0, 0xff, 0xff, 0xfe, 0xff, 0x3, 0x0, 0xfd, 0xff,
+      0xda, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
+      0x1, 0x0, 0x1, 0x0, 0xfb, 0xff, 0xef, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x3,
+      0x0, 0x4, 0x0, 0xf9, 0xff, 0x7, 0x0, 0xfd, 0xff, 0xf8, 0xff, 0x3, 0x0,
+      0x0, 0x0, 0xfa, 0xff, 0x4, 0x0, 0x4, 0x0, 0x0, 0x0, 0xd, 0x0, 0x5, 0x0,
+      0xff, 0xff, 0x4, 0x0, 0x4, 0x0, 0xf9, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
+      0xff, 0x4, 0x0, 0x5, 0x0, 0xa, 0x0, 0x2, 0x0, 0x4, 0x0, 0x2, 0x0, 0xfe,
+      0xff, 0xf9, 0xff, 0xff, 0xff, 0x7, 0x0, 0xfd, 0xff, 0xfc, 0xff, 0xff,
+      0xff, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0, 0xff, 0xff, 0x1, 0x0, 0x2, 0x0, 0x1,
+      0x0, 0xfc, 0xff, 0xff, 0xff, 0x1, 0x0, 0xfd, 0xff, 0x3, 0x0, 0x2, 0x0,
+      0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x3, 0x0, 0xde, 0xff, 0x4, 0x0,
+      0x4, 0x0, 0xfb, 0xff, 0x0, 0x0, 0x6, 0x0, 0xff, 0xff, 0xfe, 0xff, 0xf9,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0x2, 0x0, 0xfa, 0xff, 0xfe, 0xff, 0x3, 0x0,
+      0xf6, 0xff, 0xfb, 0xff, 0x6, 0x0, 0xfb, 0xff, 0x0, 0x0, 0xfe, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0x4, 0x0, 0xf4, 0xff, 0xf8, 0xff, 0x1, 0x0, 0xfd, 0xff,
+      0xff, 0xff, 0x3, 0x0, 0xfe, 0xff, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfd,
+      0xff, 0xf9, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x0, 0x0, 0x7, 0x0,
+      0xfd, 0xff, 0xfb, 0xff, 0x2, 0x0, 0xff, 0xff, 0x1, 0x0, 0x2, 0x0, 0x1,
+      0x0, 0xfc, 0xff, 0xfe, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x2, 0x0,
+      0x0, 0x0, 0xfd, 0xff, 0x1, 0x0, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+      0xff, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe1, 0xff, 0x0, 0x0, 0xfa, 0xff,
+      0x9, 0x0, 0x9, 0x0, 0xf6, 0xff, 0x0, 0x0, 0xfd, 0xff, 0xb, 0x0, 0xa, 0x0,
+      0x0, 0x0, 0xfe, 0xff, 0x6, 0x0, 0x3, 0x0, 0x2, 0x0, 0x4, 0x0, 0x8, 0x0,
+      0xfd, 0xff, 0x4, 0x0, 0xfe, 0xff, 0x1, 0x0, 0xfc, 0xff, 0x0, 0x0, 0xfb,
+      0xff, 0xfe, 0xff, 0x1, 0x0, 0xfe, 0xff, 0x2, 0x0, 0xfc, 0xff, 0x2, 0x0,
+      0x7, 0x0, 0xfd, 0xff, 0x2, 0x0, 0xfb, 0xff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0,
+      0xfd, 0xff, 0x0, 0x0, 0x0, 0x0, 0xfd, 0xff, 0x5, 0x0, 0x0, 0x0, 0x4, 0x0,
+      0x1, 0x0, 0x0, 0x0, 0xfd, 0xff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0,
+      0xfe, 0xff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0,
+      0x0, 0xff, 0xff, 0x1, 0x0, 0xff, 0xff, 0xfe, 0xff, 0x2, 0x0, 0xfe, 0xff,
+      0xdc, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf8, 0xff, 0x2, 0x0, 0x0,
+      0x0, 0x1, 0x0, 0xf9, 0xff, 0xef, 0xff, 0xfe, 0xff, 0x0, 0x0, 0x0, 0x0,
+      0x3, 0x0, 0xfb, 0xff, 0x3, 0x0, 0xfb, 0xff, 0xfb, 0xff, 0x1, 0x0, 0x0,
+      0x0, 0xf9, 0xff, 0x4, 0x0, 0x3, 0x0, 0x2, 0x0, 0xb, 0x0, 0x3, 0x0, 0xff,
+      0xff, 0x4, 0x0, 0x5, 0x0, 0xfb, 0xff, 0xfd, 0xff, 0xfa, 0xff, 0xff, 0xff,
+      0x4, 0x0, 0x4, 0x0, 0x8, 0x0, 0x1, 0x0, 0x4, 0x0, 0x1, 0x0, 0xfe, 0xff,
+      0xfb, 0xff, 0xfe, 0xff, 0x6, 0x0, 0xfd, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x0,
+      0x0, 0x1, 0x0, 0x2, 0x0, 0xfe, 0xff, 0x1, 0x0, 0x2, 0x0, 0x1, 0x0, 0xfc,
+      0xff, 0xff, 0xff, 0x0, 0x0, 0xfe, 0xff, 0x2, 0x0, 0x1, 0x0, 0xff, 0xff,
+      0x1, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x3, 0x0, 0xe0, 0xff, 0x4, 0x0, 0x2, 0x0,
+      0xfd, 0xff, 0x3, 0x0, 0x4, 0x0, 0x0, 0x0, 0xfe, 0xff, 0xfd, 0xff, 0x3,
+      0x0, 0x0, 0x0, 0x1, 0x0, 0xfb, 0xff, 0xff, 0xff, 0x3, 0x0, 0xf6, 0xff,
+      0xfe, 0xff, 0x6, 0x0, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff,
+      0xfe, 0xff, 0x2, 0x0, 0xf2, 0xff, 0xf9, 0xff, 0x1, 0x0, 0xfd, 0xff, 0xfe,
+      0xff, 0x5, 0x0, 0x0, 0x0, 0x9, 0x0, 0x1, 0x0, 0xfe, 0xff, 0xfd, 0xff,
+      0xf8, 0xff, 0xfc, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0x1, 0x0, 0x7, 0x0, 0xff,
+      0xff, 0xfb, 0xff, 0x3, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0xfc,
+      0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x2, 0x0, 0x1, 0x0,
+      0xfd, 0xff, 0x1, 0x0, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x0,
+      0x0, 0x0, 0x0, 0xfe, 0xff, 0xe1, 0xff, 0x0, 0x0, 0xfa, 0xff, 0x8, 0x0,
+      0x7, 0x0, 0xf6, 0xff, 0x1, 0x0, 0xfe, 0xff, 0xa, 0x0, 0x5, 0x0, 0x0, 0x0,
+      0xfd, 0xff, 0x6, 0x0, 0x3, 0x0, 0x0, 0x0, 0x6, 0x0, 0x8, 0x0, 0xfc, 0xff,
+      0x5, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xfd, 0xff, 0x0, 0x0, 0xfb, 0xff, 0x3,
+      0x0, 0x3, 0x0, 0xfd, 0xff, 0x3, 0x0, 0xfd, 0xff, 0x0, 0x0, 0x6, 0x0, 0xfb,
+      0xff, 0x1, 0x0, 0xfc, 0xff, 0x1, 0x0, 0x2, 0x0, 0x3, 0x0, 0xfe, 0xff, 0x1,
+      0x0, 0x0, 0x0, 0xfb, 0xff, 0x4, 0x0, 0x1, 0x0, 0x3, 0x0, 0x0, 0x0, 0xff,
+      0xff, 0xfd, 0xff, 0x0, 0x0, 0x1, 0x0, 0x2, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
+      0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x1,
+      0x0, 0x0, 0x0, 0xfe, 0xff, 0x2, 0x0, 0xff, 0xff, 0xdc, 0xff, 0xfe, 0xff,
+      0x1, 0x0, 0xfa, 0xff, 0xf8, 0xff, 0x4, 0x0, 0x0, 0x0, 0x1, 0x0, 0xf8,
+      0xff, 0xf0, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x3, 0x0, 0xfb,
+      0xff, 0x0, 0x0, 0xfa, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x1, 0x0, 0xf9, 0xff,
+      0x3, 0x0, 0x2, 0x0, 0x3, 0x0, 0x7, 0x0, 0x1, 0x0, 0x0, 0x0, 0x2, 0x0, 0x5,
+      0x0, 0xfc, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x4, 0x0, 0x3, 0x0,
+      0x5, 0x0, 0x0, 0x0, 0x4, 0x0, 0x1, 0x0, 0xfe, 0xff, 0xfe, 0xff, 0xfd,
+      0xff, 0x4, 0x0, 0xfe, 0xff, 0xfc, 0xff, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0,
+      0x0, 0xfe, 0xff, 0x1, 0x0, 0x2, 0x0, 0x1, 0x0, 0xfd, 0xff, 0xff, 0xff,
+      0x0, 0x0, 0xff, 0xff, 0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0, 0x1, 0x0,
+      0xfe, 0xff, 0x2, 0x0, 0xe2, 0xff, 0x5, 0x0, 0x2, 0x0, 0x0, 0x0, 0x6, 0x0,
+      0x1, 0x0, 0x0, 0x0, 0xfd, 0xff, 0x1, 0x0, 0x7, 0x0, 0x0, 0x0, 0xff, 0xff,
+      0xfd, 0xff, 0xff, 0xff, 0x4, 0x0, 0xf8, 0xff, 0x0, 0x0, 0x6, 0x0, 0xfd,
+      0xff, 0xff, 0xff, 0x0, 0x0, 0xfc, 0xff, 0xfe, 0xff, 0x0, 0x0, 0xf2, 0xff,
+      0xf9, 0xff, 0x0, 0x0, 0xfc, 0xff, 0xfd, 0xff, 0x5, 0x0, 0x1, 0x0, 0x8,
+      0x0, 0x1, 0x0, 0xfd, 0xff, 0xfd, 0xff, 0xf8, 0xff, 0xfd, 0xff, 0xfd, 0xff,
+      0xfe, 0xff, 0x1, 0x0, 0x6, 0x0, 0x0, 0x0, 0xfa, 0xff, 0x4, 0x0, 0x1, 0x0,
+      0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0xfd, 0xff, 0x0, 0x0, 0x0, 0x0, 0xfe, 0xff,
+      0xff, 0xff, 0x3, 0x0, 0x1, 0x0, 0xfd, 0xff, 0x2, 0x0, 0xfd, 0xff, 0xfe,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0xfe, 0xff, 0xe1, 0xff,
+      0xff, 0xff, 0xfa, 0xff, 0x6, 0x0, 0x4, 0x0, 0xf7, 0xff, 0x1, 0x0, 0xfe,
+      0xff, 0x8, 0x0, 0x1, 0x0, 0xff, 0xff, 0xfd, 0xff, 0x6, 0x0, 0x4, 0x0,
+      0xff, 0xff, 0x7, 0x0, 0x6, 0x0, 0xfb, 0xff, 0x5, 0x0, 0xfe, 0xff, 0xff,
+      0xff, 0xfe, 0xff, 0x1, 0x0, 0xfc, 0xff, 0x6, 0x0, 0x4, 0x0, 0xfe, 0xff,
+      0x4, 0x0, 0xff, 0xff, 0xff, 0xff, 0x5, 0x0, 0xf9, 0xff, 0x1, 0x0, 0xfe,
+      0xff, 0x2, 0x0, 0x5, 0x0, 0x3, 0x0, 0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0xfa,
+      0xff, 0x3, 0x0, 0x3, 0x0, 0x2, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfd, 0xff, 0x0,
+      0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xfe, 0xff, 0x1,
+      0x0, 0x0, 0x0, 0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0xfe,
+      0xff, 0x1, 0x0, 0x0, 0x0, 0xde, 0xff, 0x0, 0x0, 0x2, 0x0, 0xf9, 0xff,
+      0xf9, 0xff, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf8, 0xff, 0xf2, 0xff, 0xfe,
+      0xff, 0x0, 0x0, 0xfd, 0xff, 0x2, 0x0, 0xfd, 0xff, 0xfd, 0xff, 0xfa, 0xff,
+      0xff, 0xff, 0xfe, 0xff, 0x1, 0x0, 0xfa, 0xff, 0x3, 0x0, 0x2, 0x0, 0x4,
+      0x0, 0x3, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0xfd, 0xff, 0xfc,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0x4, 0x0, 0x2, 0x0, 0x3, 0x0, 0xff, 0xff,
+      0x3, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xfd, 0xff, 0x2, 0x0, 0xfe,
+      0xff, 0xfd, 0xff, 0x0, 0x0, 0x2, 0x0, 0x1, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x1,
+      0x0, 0x2, 0x0, 0x1, 0x0, 0xfe, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0, 0x1, 0x0, 0xfe, 0xff, 0x2, 0x0, 0xe3,
+      0xff, 0x5, 0x0, 0xff, 0xff, 0x2, 0x0, 0x7, 0x0, 0xfe, 0xff, 0x0, 0x0,
+      0xfd, 0xff, 0x4, 0x0, 0x9, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0x5, 0x0, 0xfb, 0xff, 0x3, 0x0, 0x5, 0x0, 0xfe, 0xff, 0xfe, 0xff,
+      0x1, 0x0, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xfb, 0xff, 0x0,
+      0x0, 0xfd, 0xff, 0xfc, 0xff, 0x5, 0x0, 0x3, 0x0, 0x6, 0x0, 0x2, 0x0, 0xfc,
+      0xff, 0xfd, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0x2,
+      0x0, 0x4, 0x0, 0x1, 0x0, 0xfa, 0xff, 0x5, 0x0, 0x2, 0x0, 0x1, 0x0, 0xff,
+      0xff, 0x0, 0x0, 0xfd, 0xff, 0x0, 0x0, 0x0, 0x0, 0xfe, 0xff, 0xff, 0xff,
+      0x2, 0x0, 0x1, 0x0, 0xfe, 0xff, 0x2, 0x0, 0xfd, 0xff, 0xff, 0xff, 0x0,
+      0x0, 0xff, 0xff, 0xff, 0xff, 0x2, 0x0, 0xfd, 0xff, 0xe1, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0x4, 0x0, 0x1, 0x0, 0xf9, 0xff, 0x1, 0x0, 0xff, 0xff, 0x5,
+      0x0, 0xfd, 0xff, 0x0, 0x0, 0xfe, 0xff, 0x5, 0x0, 0x4, 0x0, 0xfd, 0xff,
+      0x7, 0x0, 0x4, 0x0, 0xfa, 0xff, 0x5, 0x0, 0xff, 0xff, 0xfd, 0xff, 0xff,
+      0xff, 0x2, 0x0, 0xfd, 0xff, 0x8, 0x0, 0x5, 0x0, 0xfe, 0xff, 0x4, 0x0, 0x0,
+      0x0, 0xfd, 0xff, 0x4, 0x0, 0xf8, 0xff, 0x0, 0x0, 0xff, 0xff, 0x3, 0x0,
+      0x6, 0x0, 0x3, 0x0, 0x1, 0x0, 0x2, 0x0, 0x0, 0x0, 0xfa, 0xff, 0x2, 0x0,
+      0x4, 0x0, 0x1, 0x0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x0, 0x0, 0x1,
+      0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0xfd, 0xff, 0x0, 0x0, 0x1,
+      0x0, 0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0x0,
+      0x0, 0x1, 0x0, 0xdf, 0xff, 0x2, 0x0, 0x3, 0x0, 0xf9, 0xff, 0xfb, 0xff,
+      0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf8, 0xff, 0xf5, 0xff, 0xff, 0xff, 0x0,
+      0x0, 0xfc, 0xff, 0x1, 0x0, 0xfe, 0xff, 0xfc, 0xff, 0xfa, 0xff, 0x1, 0x0,
+      0xfd, 0xff, 0x1, 0x0, 0xfb, 0xff, 0x2, 0x0, 0x1, 0x0, 0x4, 0x0, 0xff,
+      0xff, 0xfe, 0xff, 0x1, 0x0, 0xff, 0xff, 0x3, 0x0, 0xff, 0xff, 0xfc, 0xff,
+      0x2, 0x0, 0xff, 0xff, 0x4, 0x0, 0x1, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x2, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0xfd, 0xff, 0x0, 0x0, 0xff, 0xff, 0xfd,
+      0xff, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0xfe, 0xff, 0x1, 0x0, 0x1,
+      0x0, 0x1, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
+      0x1, 0x0, 0xff, 0xff, 0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0, 0xe4,
+      0xff, 0x5, 0x0, 0xfe, 0xff, 0x4, 0x0, 0x8, 0x0, 0xfc, 0xff, 0x0, 0x0,
+      0xfd, 0xff, 0x6, 0x0, 0xa, 0x0, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0, 0x1, 0x0,
+      0x4, 0x0, 0xfd, 0xff, 0x4, 0x0, 0x3, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x1, 0x0,
+      0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xf6, 0xff, 0xfd, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfc, 0xff, 0x5, 0x0, 0x4, 0x0, 0x4, 0x0, 0x1, 0x0, 0xfc,
+      0xff, 0xfe, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x1,
+      0x0, 0x3, 0x0, 0x2, 0x0, 0xfb, 0xff, 0x5, 0x0, 0x2, 0x0, 0x0, 0x0, 0xfe,
+      0xff, 0x0, 0x0, 0xfd, 0xff, 0x1, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x0, 0x0, 0x2,
+      0x0, 0x1, 0x0, 0xfe, 0xff, 0x1, 0x0, 0xfd, 0xff, 0xff, 0xff, 0x0, 0x0,
+      0xff, 0xff, 0xff, 0xff, 0x2, 0x0, 0xfd, 0xff, 0xe1, 0xff, 0xff, 0xff,
+      0xfc, 0xff, 0x2, 0x0, 0xff, 0xff, 0xfc, 0xff, 0x1, 0x0, 0xff, 0xff, 0x3,
+      0x0, 0xfa, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x4, 0x0, 0x4, 0x0, 0xfc, 0xff,
+      0x6, 0x0, 0x2, 0x0, 0xfa, 0xff, 0x4, 0x0, 0xff, 0xff, 0xfc, 0xff, 0x1,
+      0x0, 0x3, 0x0, 0xfe, 0xff, 0x9, 0x0, 0x5, 0x0, 0xfe, 0xff, 0x3, 0x0, 0x2,
+      0x0, 0xfd, 0xff, 0x2, 0x0, 0xf8, 0xff, 0x0, 0x0, 0x1, 0x0, 0x3, 0x0, 0x7,
+      0x0, 0x3, 0x0, 0x1, 0x0, 0x2, 0x0, 0xff, 0xff, 0xfa, 0xff, 0x1, 0x0, 0x4,
+      0x0, 0x0, 0x0, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x2, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0xfd, 0xff, 0x0, 0x0, 0x1, 0x0,
+      0xff, 0xff, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0,
+      0x1, 0x0, 0xe1, 0xff, 0x3, 0x0, 0x3, 0x0, 0xfa, 0xff, 0xfd, 0xff, 0x6,
+      0x0, 0x0, 0x0, 0xff, 0xff, 0xf9, 0xff, 0xf9, 0xff, 0xff, 0xff, 0x1, 0x0,
+      0xfc, 0xff, 0x0, 0x0, 0x0, 0x0, 0xfa, 0xff, 0xfa, 0xff, 0x3, 0x0, 0xfd,
+      0xff, 0x0, 0x0, 0xfc, 0xff, 0x1, 0x0, 0x1, 0x0, 0x4, 0x0, 0xfb, 0xff,
+      0xfd, 0xff, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0xfd, 0xff, 0x4,
+      0x0, 0xff, 0xff, 0x2, 0x0, 0x0, 0x0, 0xfe, 0xff, 0xfd, 0xff, 0x1, 0x0,
+      0xff, 0xff, 0x0, 0x0, 0x3, 0x0, 0xfd, 0xff, 0xfe, 0xff, 0x0, 0x0, 0xfe,
+      0xff, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0xfe, 0xff, 0xfe, 0xff, 0x0, 0x0, 0x1,
+      0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0x0, 0xfe, 0xff,
+      0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0xe4,
+      0xff, 0x4, 0x0, 0xfd, 0xff, 0x5, 0x0, 0x8, 0x0, 0xfb, 0xff, 0x0, 0x0,
+      0xfe, 0xff, 0x7, 0x0, 0x9, 0x0, 0x1, 0x0, 0xff, 0xff, 0x3, 0x0, 0x2, 0x0,
+      0x3, 0x0, 0xff, 0xff, 0x5, 0x0, 0x1, 0x0, 0x1, 0x0, 0xfe, 0xff, 0x1, 0x0,
+      0xfc, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xf9, 0xff, 0xfe, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xfc, 0xff, 0x4, 0x0, 0x5, 0x0, 0x1, 0x0, 0x1, 0x0, 0xfc,
+      0xff, 0xff, 0xff, 0xfc, 0xff, 0x0, 0x0, 0xfd, 0xff, 0xff, 0xff, 0x1, 0x0,
+      0x1, 0x0, 0x2, 0x0, 0xfd, 0xff, 0x5, 0x0, 0x2, 0x0, 0x0, 0x0, 0xfe, 0xff,
+      0x0, 0x0, 0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x0, 0x0, 0x1, 0x0,
+      0x1, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xfe, 0xff, 0xff, 0xff, 0x1, 0x0, 0xff,
+      0xff, 0xff, 0xff, 0x2, 0x0, 0xfe, 0xff, 0xe1, 0xff, 0x0, 0x0, 0xfd, 0xff,
+      0x0, 0x0, 0xfd, 0xff, 0xfe, 0xff, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7,
+      0xff, 0xff, 0xff, 0xfe, 0xff, 0x3, 0x0, 0x4, 0x0, 0xfc, 0xff, 0x5, 0x0,
+      0x0, 0x0, 0xfb, 0xff, 0x2, 0x0, 0xff, 0xff, 0xfb, 0xff, 0x2, 0x0, 0x3,
+      0x0, 0x0, 0x0, 0x9, 0x0, 0x4, 0x0, 0xff, 0xff, 0x3, 0x0, 0x2, 0x0, 0xfc,
+      0xff, 0x0, 0x0, 0xf9, 0xff, 0xff, 0xff, 0x2, 0x0, 0x3, 0x0, 0x6, 0x0, 0x2,
+      0x0, 0x2, 0x0, 0x2, 0x0, 0xff, 0xff, 0xfb, 0xff, 0x0, 0x0, 0x4, 0x0, 0x0,
+      0x0, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0x0, 0x2, 0x0, 0xff, 0xff,
+      0x0, 0x0, 0x2, 0x0, 0x1, 0x0, 0xfd, 0xff, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff,
+      0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0,
+      0xe2, 0xff, 0x4, 0x0, 0x2, 0x0, 0xfb, 0xff, 0xff, 0xff, 0x5, 0x0, 0x0,
+      0x0, 0xff, 0xff, 0xfb, 0xff, 0xfd, 0xff, 0x0, 0x0, 0x1, 0x0, 0xfd, 0xff,
+      0x0, 0x0, 0x0, 0x0, 0xf9, 0xff, 0xfc, 0xff, 0x3, 0x0, 0xfd, 0xff, 0x0,
+      0x0, 0xfd, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0xf9, 0xff, 0xfc, 0xff,
+      0x1, 0x0, 0xfe, 0xff, 0x0, 0x0, 0x2, 0x0, 0xfe, 0xff, 0x5, 0x0, 0x0, 0x0,
+      0x1, 0x0, 0xff, 0xff, 0xfc, 0xff, 0xfd, 0xff, 0x0, 0x0, 0xfe, 0xff, 0x1,
+      0x0, 0x4, 0x0, 0xfe, 0xff, 0xfd, 0xff, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0,
+      0x1, 0x0, 0x1, 0x0, 0xfe, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x1, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xff,
+      0xff, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xff, 0x4, 0x0,
+      0xfc, 0xff, 0x5, 0x0, 0x7, 0x0, 0xfa, 0xff, 0x1, 0x0, 0xfd, 0xff, 0x7,
+      0x0, 0x8, 0x0, 0x1, 0x0, 0xfe, 0xff, 0x4, 0x0, 0x2, 0x0, 0x2, 0x0, 0x2,
+      0x0, 0x5, 0x0, 0x0, 0x0, 0x2, 0x0, 0xfe, 0xff, 0x1, 0x0, 0xfc, 0xff, 0x0,
+      0x0, 0xfd, 0xff, 0xfc, 0xff, 0x0, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xfd, 0xff,
+      0x3, 0x0, 0x5, 0x0, 0xff, 0xff, 0x1, 0x0, 0xfc, 0xff, 0xff, 0xff, 0xfe,
+      0xff, 0x1, 0x0, 0xfd, 0xff, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0x3, 0x0,
+      0xfe, 0xff, 0x4, 0x0, 0x2, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xff,
+      0xff, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0xff,
+      0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x1, 0x0, 0xff, 0xff, 0xff, 0xff,
+      0x2, 0x0, 0xfe, 0xff, 0xe2, 0xff, 0x0, 0x0, 0xff, 0xff, 0xfe, 0xff, 0xfc,
+      0xff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0xfe, 0xff, 0xf7, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0x2, 0x0, 0x3, 0x0, 0xfc, 0xff, 0x3, 0x0, 0xfe, 0xff, 0xfc,
+      0xff, 0x2, 0x0, 0x0, 0x0, 0xfa, 0xff, 0x2, 0x0, 0x2, 0x0, 0x1, 0x0, 0x8,
+      0x0, 0x3, 0x0, 0xff, 0xff, 0x3, 0x0, 0x2, 0x0, 0xfc, 0xff, 0xff, 0xff,
+      0xfa, 0xff, 0x0, 0x0, 0x3, 0x0, 0x3, 0x0, 0x6, 0x0, 0x1, 0x0, 0x2, 0x0,
+      0x1, 0x0, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x4, 0x0, 0xff, 0xff, 0xfe,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0,
+      0x2, 0x0, 0x1, 0x0, 0xfd, 0xff, 0xff, 0xff, 0x1, 0x0, 0xff, 0xff, 0x1,
+      0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0x2, 0x0, 0xe4,
+      0xff, 0x5, 0x0, 0x2, 0x0, 0xfd, 0xff, 0x1, 0x0, 0x3, 0x0, 0x0, 0x0, 0xfe,
+      0xff, 0xfd, 0xff, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0xfd, 0xff, 0xff, 0xff,
+      0x1, 0x0, 0xfa, 0xff, 0xfe, 0xff, 0x4, 0x0, 0xfd, 0xff, 0x0, 0x0, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0x2, 0x0, 0xf7, 0xff, 0xfb, 0xff, 0x0, 0x0,
+      0xfe, 0xff, 0xff, 0xff, 0x3, 0x0, 0xff, 0xff, 0x5, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0xfe, 0xff, 0xfb, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x1, 0x0,
+      0x4, 0x0, 0xfe, 0xff, 0xfd, 0xff, 0x2, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0,
+      0x1, 0x0, 0xfe, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+      0x0, 0x0, 0xfe, 0xff, 0x1, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe5, 0xff, 0x3, 0x0, 0xfc, 0xff,
+      0x5, 0x0, 0x5, 0x0, 0xfa, 0xff, 0x1, 0x0, 0xfe, 0xff, 0x7, 0x0, 0x5, 0x0,
+      0x0, 0x0, 0xff, 0xff, 0x4, 0x0, 0x2, 0x0, 0x1, 0x0, 0x3, 0x0, 0x5, 0x0,
+      0xfe, 0xff, 0x3, 0x0, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xff, 0x0, 0x0, 0xfd,
+      0xff, 0x0, 0x0, 0x1, 0x0, 0xfe, 0xff, 0x2, 0x0, 0xfd, 0xff, 0x1, 0x0, 0x5,
+      0x0, 0xfd, 0xff, 0x1, 0x0, 0xfd, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0xfe,
+      0xff, 0x0, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x3, 0x0, 0x0, 0x0, 0x3, 0x0, 0x1,
+      0x0, 0x0, 0x0, 0xfe, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0xff,
+      0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x1, 0x0, 0xff, 0xff, 0xe2, 0xff,
+      0x1, 0x0, 0x0, 0x0, 0xfd, 0xff, 0xfb, 0xff, 0x2, 0x0, 0x1, 0x0, 0x0, 0x0,
+      0xfc, 0xff, 0xf6, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0xfc,
+      0xff, 0x1, 0x0, 0xfd, 0xff, 0xfd, 0xff, 0x0, 0x0, 0x0, 0x0, 0xfb, 0xff,
+      0x3, 0x0, 0x2, 0x0, 0x1, 0x0, 0x6, 0x0, 0x2, 0x0, 0x0, 0x0, 0x2, 0x0, 0x3,
+      0x0, 0xfd, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0x0, 0x0, 0x3, 0x0, 0x3, 0x0,
+      0x4, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x0, 0xff, 0xff, 0xfe, 0xff, 0xfe,
+      0xff, 0x3, 0x0, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0,
+      0x1, 0x0, 0xff, 0xff, 0x1, 0x0, 0x2, 0x0, 0x1, 0x0, 0xfe, 0xff, 0xff,
+      0xff, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0, 0x0,
+      0x0, 0xff, 0xff, 0x2, 0x0, 0xe5, 0xff, 0x5, 0x0, 0x1, 0x0, 0xff, 0xff,
+      0x3, 0x0, 0x1, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x0, 0x0, 0x3, 0x0, 0x1, 0x0,
+      0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x2, 0x0, 0xfa, 0xff, 0xff, 0xff, 0x4,
+      0x0, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x1, 0x0,
+      0xf7, 0xff, 0xfc, 0xff, 0x1, 0x0, 0xfe, 0xff, 0xfe, 0xff, 0x3, 0x0, 0x1,
+      0x0, 0x5, 0x0, 0x1, 0x0, 0xff, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xfd, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0x1, 0x0, 0x4, 0x0, 0xff, 0xff, 0xfc, 0xff, 0x3,
+      0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0xff, 0xff, 0xff, 0x0,
+      0x0, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x1, 0x0, 0xfe,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+      0xe5, 0xff, 0x2, 0x0, 0xfc, 0xff, 0x4, 0x0, 0x4, 0x0, 0xfa, 0xff, 0x1,
+      0x0, 0xff, 0xff, 0x6, 0x0, 0x3, 0x0, 0x0, 0x0, 0xff, 0xff, 0x4, 0x0, 0x2,
+      0x0, 0xff, 0xff, 0x4, 0x0, 0x4, 0x0, 0xfd, 0xff, 0x3, 0x0, 0xfe, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0x0, 0x0, 0xfd, 0xff, 0x2, 0x0, 0x2, 0x0, 0xfe,
+      0xff, 0x2, 0x0, 0xff, 0xff, 0x0, 0x0, 0x4, 0x0, 0xfc, 0xff, 0x1, 0x0,
+      0xfe, 0xff, 0x1, 0x0, 0x2, 0x0, 0x2, 0x0, 0xff, 0xff, 0x1, 0x0, 0x0, 0x0,
+      0xfd, 0xff, 0x2, 0x0, 0x1, 0x0, 0x2, 0x0, 0x1, 0x0, 0x0, 0x0, 0xfe, 0xff,
+      0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0xe3, 0xff, 0x2, 0x0, 0x0, 0x0, 0xfc,
+      0xff, 0xfb, 0xff, 0x3, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff,
+      0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0xfd, 0xff, 0xff, 0xff, 0xfd,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xfb, 0xff, 0x3, 0x0, 0x1, 0x0,
+      0x2, 0x0, 0x3, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x2, 0x0, 0xfe, 0xff,
+      0xfe, 0xff, 0xfe, 0xff, 0x0, 0x0, 0x3, 0x0, 0x1, 0x0, 0x3, 0x0, 0xff,
+      0xff, 0x2, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x2, 0x0,
+      0xff, 0xff, 0xfe, 0xff, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0xff,
+      0xff, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0xfe, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+      0x0, 0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0x1,
+      0x0, 0xe6, 0xff, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0xfe, 0xff, 0x2, 0x0, 0x5, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x2, 0x0, 0xfc, 0xff, 0x0, 0x0, 0x3, 0x0, 0xff, 0xff, 0xff, 0xff,
+      0x0, 0x0, 0xfe, 0xff, 0xfe, 0xff, 0x0, 0x0, 0xf8, 0xff, 0xfc, 0xff, 0x0,
+      0x0, 0xff, 0xff, 0xfd, 0xff, 0x3, 0x0, 0x2, 0x0, 0x4, 0x0, 0x1, 0x0, 0xfe,
+      0xff, 0xfe, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x0,
+      0x0, 0x3, 0x0, 0x0, 0x0, 0xfd, 0xff, 0x3, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0xfe, 0xff, 0x0, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x0, 0x0, 0x1,
+      0x0, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0xfe, 0xff, 0xe6, 0xff, 0x1, 0x0, 0xfc,
+      0xff, 0x3, 0x0, 0x2, 0x0, 0xfb, 0xff, 0x1, 0x0, 0xff, 0xff, 0x4, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0xfe, 0xff, 0x4, 0x0, 0x2, 0x0, 0xfe, 0xff, 0x4, 0x0, 0x3,
+      0x0, 0xfd, 0xff, 0x3, 0x0, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x1, 0x0,
+      0xfe, 0xff, 0x4, 0x0, 0x3, 0x0, 0xfe, 0xff, 0x2, 0x0, 0x0, 0x0, 0xff,
+      0xff, 0x3, 0x0, 0xfb, 0xff, 0x1, 0x0, 0xff, 0xff, 0x2, 0x0, 0x3, 0x0, 0x2,
+      0x0, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0xfc, 0xff, 0x2, 0x0, 0x2, 0x0, 0x1,
+      0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xe4,
+      0xff, 0x2, 0x0, 0x1, 0x0, 0xfc, 0xff, 0xfc, 0xff, 0x3, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0xfb, 0xff, 0xf9, 0xff, 0xff, 0xff, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0,
+      0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xfc,
+      0xff, 0x2, 0x0, 0x1, 0x0, 0x2, 0x0, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0x1,
+      0x0, 0x2, 0x0, 0xff, 0xff, 0xfe, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x1,
+      0x0, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0, 0xff, 0xff, 0xff, 0xff, 0x1, 0x0,
+      0xfe, 0xff, 0x1, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+      0x0, 0x0, 0xfe, 0xff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+      0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x1, 0x0, 0x1,
+      0x0, 0xff, 0xff, 0x1, 0x0, 0xe7, 0xff, 0x4, 0x0, 0xff, 0xff, 0x2, 0x0,
+      0x4, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xfe, 0xff, 0x4, 0x0, 0x6, 0x0, 0x1, 0x0,
+      0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x2, 0x0, 0xfd, 0xff, 0x2, 0x0, 0x2, 0x0,
+      0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf9,
+      0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0x3, 0x0, 0x3, 0x0,
+      0x2, 0x0, 0x1, 0x0, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe,
+      0xff, 0xff, 0xff, 0x1, 0x0, 0x2, 0x0, 0x1, 0x0, 0xfd, 0xff, 0x3, 0x0, 0x1,
+      0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
+      0xff, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0, 0xff, 0xff,
+      0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x1, 0x0, 0xfe, 0xff, 0xe6,
+      0xff, 0x1, 0x0, 0xfd, 0xff, 0x2, 0x0, 0x0, 0x0, 0xfc, 0xff, 0x1, 0x0,
+      0xff, 0xff, 0x3, 0x0, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0x0, 0x3,
+      0x0, 0xfe, 0xff, 0x4, 0x0, 0x2, 0x0, 0xfd, 0xff, 0x3, 0x0, 0xff, 0xff,
+      0xfd, 0xff, 0x0, 0x0, 0x1, 0x0, 0xfe, 0xff, 0x6, 0x0, 0x3, 0x0, 0xff,
+      0xff, 0x3, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x2, 0x0, 0xfa, 0xff, 0x0, 0x0, 0x0,
+      0x0, 0x2, 0x0, 0x4, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0xfc,
+      0xff, 0x1, 0x0, 0x2, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0xff,
+      0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+      0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0xe5, 0xff, 0x2, 0x0, 0x1, 0x0, 0xfc,
+      0xff, 0xfd, 0xff, 0x3, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0xff, 0xfb, 0xff,
+      0xff, 0xff, 0x1, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xff, 0xff, 0xfd, 0xff, 0xfc,
+      0xff, 0x1, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xfd, 0xff, 0x2, 0x0, 0xff, 0xff,
+      0x2, 0x0, 0xfe, 0xff, 0xfe, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+      0xfe, 0xff, 0x1, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
+      0xff, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0xfe, 0xff, 0x0, 0x0, 0x0,
+      0x0, 0xfe, 0xff, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0xff, 0xff,
+      0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0,
+      0xe8, 0xff, 0x3, 0x0, 0xfe, 0xff, 0x3, 0x0, 0x5, 0x0, 0xfd, 0xff, 0x0,
+      0x0, 0xfe, 0xff, 0x5, 0x0, 0x6, 0x0, 0x1, 0x0, 0xff, 0xff, 0x2, 0x0, 0x1,
+      0x0, 0x2, 0x0, 0xff, 0xff, 0x3, 0x0, 0x2, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
+      0x0, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xff,
+      0xff, 0x0, 0x0, 0xfd, 0xff, 0x3, 0x0, 0x3, 0x0, 0x1, 0x0, 0x1, 0x0, 0xfd,
+      0xff, 0xff, 0xff, 0xfd, 0xff, 0x0, 0x0, 0xfe, 0xff, 0xff, 0xff, 0x0, 0x0,
+      0x1, 0x0, 0x1, 0x0, 0xfe, 0xff, 0x3, 0x0, 0x1, 0x0, 0x1, 0x0, 0xff, 0xff,
+      0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x0, 0x0, 0x1, 0x0,
+      0x1, 0x0, 0xff, 0xff, 0x1, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+      0x0, 0xff, 0xff, 0x1, 0x0, 0xfe, 0xff, 0xe6, 0xff, 0x0, 0x0, 0xfe, 0xff,
+      0x1, 0x0, 0xff, 0xff, 0xfe, 0xff, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0xfb,
+      0xff, 0xff, 0xff, 0x0, 0x0, 0x2, 0x0, 0x3, 0x0, 0xfd, 0xff, 0x3, 0x0, 0x0,
+      0x0, 0xfc, 0xff, 0x2, 0x0, 0xff, 0xff, 0xfc, 0xff, 0x1, 0x0, 0x1, 0x0,
+      0xff, 0xff, 0x6, 0x0, 0x3, 0x0, 0xff, 0xff, 0x3, 0x0, 0x1, 0x0, 0xfe,
+      0xff, 0x1, 0x0, 0xfb, 0xff, 0x0, 0x0, 0x1, 0x0, 0x2, 0x0, 0x4, 0x0, 0x1,
+      0x0, 0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0xfd, 0xff, 0x0, 0x0, 0x3, 0x0, 0x0,
+      0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+      0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0,
+      0xe6, 0xff, 0x2, 0x0, 0x2, 0x0, 0xfd, 0xff, 0xfe, 0xff, 0x3, 0x0, 0x0,
+      0x0, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0x0, 0x0, 0xfe, 0xff,
+      0x0, 0x0, 0x0, 0x0, 0xfc, 0xff, 0xfd, 0xff, 0x2, 0x0, 0xfe, 0xff, 0x0,
+      0x0, 0xfe, 0xff, 0x1, 0x0, 0x0, 0x0, 0x2, 0x0, 0xfc, 0xff, 0xfd, 0xff,
+      0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0x2, 0x0, 0x0, 0x0,
+      0x1, 0x0, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0,
+      0x0, 0x2, 0x0, 0xfe, 0xff, 0xfe, 0xff, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0,
+      0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff,
+      0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe8, 0xff, 0x2, 0x0, 0xfe,
+      0xff, 0x3, 0x0, 0x4, 0x0, 0xfc, 0xff, 0x0, 0x0, 0xfe, 0xff, 0x6, 0x0, 0x5,
+      0x0, 0x1, 0x0, 0xff, 0xff, 0x2, 0x0, 0x1, 0x0, 0x2, 0x0, 0x0, 0x0, 0x3,
+      0x0, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0xfe, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0x0, 0xfe, 0xff, 0x2,
+      0x0, 0x4, 0x0, 0x0, 0x0, 0x1, 0x0, 0xfd, 0xff, 0x0, 0x0, 0xfe, 0xff, 0x0,
+      0x0, 0xfe, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0xfe, 0xff, 0x2,
+      0x0, 0x1, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
+      0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0xff,
+      0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x1, 0x0, 0xff, 0xff,
+      0xe6, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x1,
+      0x0, 0xff, 0xff, 0x0, 0x0, 0xfa, 0xff, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0,
+      0x2, 0x0, 0xfd, 0xff, 0x2, 0x0, 0xff, 0xff, 0xfd, 0xff, 0x1, 0x0, 0x0,
+      0x0, 0xfc, 0xff, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x5, 0x0, 0x2, 0x0, 0x0,
+      0x0, 0x2, 0x0, 0x2, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xfc, 0xff, 0x0, 0x0, 0x2,
+      0x0, 0x2, 0x0, 0x4, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0xfd,
+      0xff, 0x0, 0x0, 0x2, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1,
+      0x0, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x0,
+      0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x1, 0x0, 0xe7, 0xff, 0x2, 0x0, 0x1, 0x0, 0xfe, 0xff, 0x0, 0x0,
+      0x2, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+      0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xfc, 0xff, 0xfe, 0xff, 0x2, 0x0,
+      0xfe, 0xff, 0x0, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xff, 0xff, 0x1, 0x0, 0xfb,
+      0xff, 0xfd, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x2, 0x0, 0x0, 0x0, 0x3,
+      0x0, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0x0, 0x0, 0x3, 0x0, 0xff, 0xff, 0xfe, 0xff, 0x1, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff,
+      0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x1, 0x0, 0xff, 0xff, 0x0,
+      0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xe7, 0xff,
+      0x1, 0x0, 0xfd, 0xff, 0x3, 0x0, 0x3, 0x0, 0xfc, 0xff, 0x1, 0x0, 0xff,
+      0xff, 0x5, 0x0, 0x3, 0x0, 0x0, 0x0, 0xff, 0xff, 0x2, 0x0, 0x1, 0x0, 0x1,
+      0x0, 0x1, 0x0, 0x3, 0x0, 0xff, 0xff, 0x2, 0x0, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0x0, 0x0, 0xfe, 0xff, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x1,
+      0x0, 0xfe, 0xff, 0x1, 0x0, 0x4, 0x0, 0xfe, 0xff, 0x1, 0x0, 0xfe, 0xff,
+      0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+      0x2, 0x0, 0xff, 0xff, 0x2, 0x0, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
+      0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+      0x1, 0x0, 0xff, 0xff, 0xe5, 0xff, 0x0, 0x0, 0x0, 0x0, 0xfe, 0xff, 0xfe,
+      0xff, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xff,
+      0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0xfe, 0xff, 0x1, 0x0, 0xfe, 0xff, 0xfe,
+      0xff, 0x0, 0x0, 0x0, 0x0, 0xfc, 0xff, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x3,
+      0x0, 0x1, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x0, 0xfe, 0xff, 0x0, 0x0, 0xfd,
+      0xff, 0x0, 0x0, 0x2, 0x0, 0x1, 0x0, 0x2, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1,
+      0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2, 0x0, 0xff, 0xff, 0xfe, 0xff,
+      0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0,
+      0x0, 0x0, 0xfe, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+      0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0xe7, 0xff, 0x2, 0x0,
+      0x0, 0x0, 0xff, 0xff, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
+      0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0xfc, 0xff,
+      0xff, 0xff, 0x2, 0x0, 0xff, 0xff, 0x0, 0x0, 0xfe, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0x0, 0x0, 0xfb, 0xff, 0xfe, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+      0x2, 0x0, 0x1, 0x0, 0x2, 0x0, 0x1, 0x0, 0xff, 0xff, 0xff, 0xff, 0xfd,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0x0, 0x2, 0x0, 0x0, 0x0,
+      0xfe, 0xff, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+      0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+      0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0xff, 0xff, 0xe8, 0xff, 0x0, 0x0, 0xfe, 0xff, 0x2, 0x0, 0x2, 0x0, 0xfd,
+      0xff, 0x1, 0x0, 0xff, 0xff, 0x4, 0x0, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0x2,
+      0x0, 0x2, 0x0, 0x0, 0x0, 0x1, 0x0, 0x2, 0x0, 0xff, 0xff, 0x2, 0x0, 0xff,
+      0xff, 0xfe, 0xff, 0xff, 0xff, 0x0, 0x0, 0xfe, 0xff, 0x0, 0x0, 0x1, 0x0,
+      0xff, 0xff, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0x3, 0x0, 0xfe, 0xff, 0x1,
+      0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+      0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+      0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0xe9, 0xff, 0x0, 0x0, 0x0, 0x0, 0xfe,
+      0xff, 0xfe, 0xff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfc, 0xff,
+      0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0xfe,
+      0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xfd, 0xff, 0x1, 0x0, 0x0, 0x0, 0x1,
+      0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0x0,
+      0x0, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0xff,
+      0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+      0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0xec, 0xff, 0x1,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x1,
+      0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0xfe,
+      0xff, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0x0, 0x0, 0xfc, 0xff, 0xfe, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
+      0xff, 0x2, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+      0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0x0, 0x1, 0x0, 0x0,
+      0x0, 0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+      0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+      0xff, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0xff, 0xff, 0xee, 0xff, 0x0, 0x0, 0xff, 0xff, 0x1, 0x0, 0x1, 0x0,
+      0xfe, 0xff, 0x1, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0, 0x1, 0x0, 0xff, 0xff, 0x1, 0x0,
+      0xff, 0xff, 0xfe, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x1, 0x0, 0x1,
+      0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0xfe, 0xff, 0x0,
+      0x0, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+      0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+      0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf0, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
+      0xff, 0xff, 0xff, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfe, 0xff,
+      0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf3, 0xff, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x1, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x1, 0x0, 0x1, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+      0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x1, 0x0, 0x1,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x1, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf5, 0xff, 0x0, 0x0,
+      0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+      0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf8, 0xff, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+      0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfa, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0xfc, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0xff, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+      0x0, 0x0, 0x0, 0x0}}};
 
 }  // namespace sadie
@@ -49,6 +49,9 @@ fi
 # Install google test
 git_clone_if_not_exist "googletest" "https://github.com/google/googletest.git" "master"
 
+# Install google benchmark (optional for benchmark builds)
+git_clone_if_not_exist "benchmark" "https://github.com/google/benchmark.git" "main"
+
 # Install CMake Android/iOS toolchain support (optional for Android/iOS builds)
 git_clone_if_not_exist "android-cmake" "https://github.com/taka-no-me/android-cmake.git" "master"
 git_clone_if_not_exist "ios-cmake" "https://github.com/leetal/ios-cmake" "master"